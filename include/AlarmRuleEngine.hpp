@@ -0,0 +1,466 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef ALARMRULEENGINE_H
+#define ALARMRULEENGINE_H
+
+#include <cstddef> // std::size_t
+#include <cstdint> // uint8_t, ...
+#include "BmsDataTypes.hpp"
+
+/**
+ * @file
+ * This header provides the evaluation of the alarm rules (triggers).
+ *
+ * The rules are compiled into a RuleTable when the settings are saved (see SettingsView). The table only
+ * contains the active rules, with all parameters resolved, so the cyclic evaluation does not need to
+ * read any parameter. The RuleEngine evaluates the table against the current data and sets the
+ * triggers in a TriggerState.
+ *
+ * The data source is any class with the methods
+ * @code
+ *   const BmsDataSnapshot& bms(uint8_t bmsNr);
+ *   float owTemperature(uint8_t sensorNr);                    // °C
+ *   uint8_t cellVoltageUnchangedCycles(uint8_t bmsNr);        // Cycles without a change of the cell voltages
+ *   uint8_t owSensorErrors();                                 // Error counter of the onewire sensors
+ *   bool batteryOnline();                                     // At least one battery pack is online
+ *   uint16_t soc();                                           // SoC of the inverter in %
+ *   uint8_t digitalInputs();                                  // Bit n: digital input n
+ * @endcode
+*/
+
+namespace alarmrules
+{
+
+/** Cause of a trigger; the values are written to the trigger log (see ALARM_CAUSE_* in AlarmRules.h) */
+enum class Cause : uint8_t
+{
+  DI                        = 0,
+  BMS_NO_DATA               = 1,
+  BMS_CELL_VOLTAGE_RANGE    = 2,
+  BMS_TOTAL_VOLTAGE_MIN     = 3,
+  BMS_TOTAL_VOLTAGE_MAX     = 4,
+  TEMPERATURE               = 5,
+  OW_SENSOR_ERROR           = 6,
+  CELL_VOLTAGE_PLAUSIBILITY = 7,
+  SOC                       = 8,
+  FAN                       = 9,
+  VIRTUAL_TRIGGER           = 10,
+};
+
+/** Value of a temperature, which could not be read */
+constexpr float SENSOR_READ_ERROR {0xFF00};
+
+/**
+ * Type of a rule. Usage of the rule fields:
+ *
+ * | Type                      | source          | first..last     | limit          | low         | high        | hysteresis |
+ * |---------------------------|-----------------|-----------------|----------------|-------------|-------------|------------|
+ * | BMS_NO_DATA               | BMS             |                 | Timeout [s]    |             |             |            |
+ * | BMS_CELL_VOLTAGE_RANGE    | BMS             | 0..cells-1      |                | Min [mV]    | Max [mV]    |            |
+ * | BMS_TOTAL_VOLTAGE_RANGE   | BMS             |                 |                | Min [V]     | Max [V]     | [V]        |
+ * | TEMP_MAX                  | TempSource, bms | Sensors         |                |             | Max [°C]    | [°C]       |
+ * | TEMP_MAX_REFERENCE        | TempSource, bms | Sensors         | Ref. sensor    |             | Offset [°C] | [°C]       |
+ * | TEMP_DIFFERENCE           | TempSource, bms | Sensors         |                |             | Max [°C]    | [°C]       |
+ * | OW_SENSOR_ERROR           |                 |                 | Max. errors    |             |             |            |
+ * | CELL_VOLTAGE_PLAUSIBILITY |                 | BMS             | Max. cycles    |             |             |            |
+ * | SOC                       |                 |                 |                | Off [%]     | On [%]      |            |
+ * | DIGITAL_INPUT             | Input           |                 |                |             |             |            |
+*/
+enum class RuleType : uint8_t
+{
+  BMS_NO_DATA,
+  BMS_CELL_VOLTAGE_RANGE,
+  BMS_TOTAL_VOLTAGE_RANGE,
+  TEMP_MAX,
+  TEMP_MAX_REFERENCE,
+  TEMP_DIFFERENCE,
+  OW_SENSOR_ERROR,
+  CELL_VOLTAGE_PLAUSIBILITY,
+  SOC,
+  DIGITAL_INPUT,
+};
+
+/** Source of the temperatures */
+enum class TempSource : uint8_t
+{
+  BMS = 1,
+  ONEWIRE = 2,
+};
+
+constexpr uint8_t FLAG_INVERT {0x01};  //!< DIGITAL_INPUT: Trigger on a low input
+
+/** One compiled rule */
+struct Rule
+{
+  RuleType type;
+  uint8_t  trigger;     //!< Trigger number 1..n
+  uint8_t  source;
+  uint8_t  bms;
+  uint8_t  first;
+  uint8_t  last;
+  uint8_t  flags;
+  uint16_t limit;
+  float    low;
+  float    high;
+  float    hysteresis;
+};
+
+inline bool operator==(const Rule& a, const Rule& b)
+{
+  return a.type == b.type && a.trigger == b.trigger && a.source == b.source && a.bms == b.bms &&
+    a.first == b.first && a.last == b.last && a.flags == b.flags && a.limit == b.limit &&
+    a.low == b.low && a.high == b.high && a.hysteresis == b.hysteresis;
+}
+
+/** Table of the active rules */
+template<std::size_t MAX_RULES>
+class RuleTable
+{
+  public:
+  void clear() { _count = 0; }
+
+  /** @return False, if the table is full */
+  bool add(const Rule& rule)
+  {
+    if (_count >= MAX_RULES) return false;
+    _rules[_count++] = rule;
+    return true;
+  }
+
+  std::size_t size() const { return _count; }
+  static constexpr std::size_t capacity() { return MAX_RULES; }
+  const Rule& operator[](std::size_t index) const { return _rules[index]; }
+
+  private:
+  Rule _rules[MAX_RULES];
+  std::size_t _count {0};
+};
+
+/**
+ * State of the triggers.
+ *
+ * All rules set their triggers in every cycle. A trigger, which was set active by one rule, stays active
+ * for the rest of the cycle, even if other rules for the same trigger are inactive. A trigger, which is
+ * not set by any rule, keeps its state.
+*/
+template<std::size_t TRIGGERS>
+class TriggerState
+{
+  public:
+  /** @brief Starts a new cycle; clears the causes. */
+  void beginCycle()
+  {
+    for (std::size_t i = 0; i < TRIGGERS; ++i)
+    {
+      _setActive[i] = false;
+      _causes[i] = 0;
+    }
+  }
+
+  /**
+   * @brief Sets a trigger.
+   * @param triggerNr Trigger number 1..TRIGGERS; 0 (no trigger) is ignored.
+  */
+  void set(uint8_t triggerNr, bool active, Cause cause)
+  {
+    if (triggerNr == 0 || triggerNr > TRIGGERS) return;
+    const std::size_t i = triggerNr - 1;
+    if (active)
+    {
+      _active[i] = true;
+      _setActive[i] = true;
+      _causes[i] |= static_cast<uint16_t>(1 << static_cast<uint8_t>(cause));
+    }
+    else if (!_setActive[i])
+    {
+      _active[i] = false;
+    }
+  }
+
+  /** @brief Resets a trigger (index 0..TRIGGERS-1) */
+  void reset(std::size_t index)
+  {
+    _active[index] = false;
+    _causes[index] = 0;
+  }
+
+  bool isActive(std::size_t index) const { return _active[index]; }
+
+  /** Returns the causes (bit n: Cause n) of the current cycle */
+  uint16_t causes(std::size_t index) const { return _causes[index]; }
+
+  private:
+  bool _active[TRIGGERS] {};
+  bool _setActive[TRIGGERS] {};
+  uint16_t _causes[TRIGGERS] {};
+};
+
+/**
+ * Evaluates a RuleTable. Holds the hysteresis state of each rule.
+*/
+template<std::size_t MAX_RULES>
+class RuleEngine
+{
+  public:
+  /** @brief Resets the hysteresis of all rules */
+  void reset()
+  {
+    for (std::size_t i = 0; i < MAX_RULES; ++i) _latch[i] = LATCH_NONE;
+    _table.clear();
+  }
+
+  /**
+   * @brief Takes over a new table (e.g. after the settings were saved).
+   *
+   * Unchanged rules keep their hysteresis, even if their position in the table has changed. The triggers of
+   * changed or removed rules are reset, so they are evaluated again from scratch with the new table; otherwise
+   * a trigger set by a latched rule would never be released.
+  */
+  template<std::size_t TRIGGERS>
+  void update(const RuleTable<MAX_RULES>& table, TriggerState<TRIGGERS>& triggers)
+  {
+    uint8_t latch[MAX_RULES] {};
+    bool carried[MAX_RULES] {};
+    for (std::size_t i = 0; i < table.size(); ++i)
+    {
+      for (std::size_t j = 0; j < _table.size(); ++j)
+      {
+        if (carried[j] || !(_table[j] == table[i])) continue;
+        latch[i] = _latch[j];
+        carried[j] = true;
+        break;
+      }
+    }
+
+    for (std::size_t j = 0; j < _table.size(); ++j)
+    {
+      const uint8_t trigger = _table[j].trigger;
+      if (!carried[j] && trigger > 0 && trigger <= TRIGGERS) triggers.reset(trigger - 1);
+    }
+
+    for (std::size_t i = 0; i < MAX_RULES; ++i) _latch[i] = latch[i];
+    _table = table;
+  }
+
+  /**
+   * @brief Evaluates all rules of the table.
+   * @param nowMs Current time in ms (millis()).
+  */
+  template<typename DATA, std::size_t TRIGGERS>
+  void evaluate(const RuleTable<MAX_RULES>& table, DATA& data, uint32_t nowMs, TriggerState<TRIGGERS>& triggers)
+  {
+    for (std::size_t i = 0; i < table.size(); ++i)
+    {
+      const Rule& rule = table[i];
+      uint8_t& latch = _latch[i];
+
+      switch (rule.type)
+      {
+        case RuleType::BMS_NO_DATA:
+          triggers.set(rule.trigger, (nowMs - static_cast<uint32_t>(data.bms(rule.source).lastDataMillis)) > static_cast<uint32_t>(rule.limit) * 1000,
+            Cause::BMS_NO_DATA);
+          break;
+
+        case RuleType::BMS_CELL_VOLTAGE_RANGE:
+          evaluateCellVoltage(rule, data.bms(rule.source), triggers);
+          break;
+
+        case RuleType::BMS_TOTAL_VOLTAGE_RANGE:
+          evaluateTotalVoltage(rule, data.bms(rule.source).getTotalVoltage(), latch, triggers);
+          break;
+
+        case RuleType::TEMP_MAX:
+          triggers.set(rule.trigger, evaluateTempMax(rule, data, rule.high, latch), Cause::TEMPERATURE);
+          break;
+
+        case RuleType::TEMP_MAX_REFERENCE:
+          triggers.set(rule.trigger, evaluateTempMax(rule, data, rule.high + temperature(rule, data, static_cast<uint8_t>(rule.limit)), latch),
+            Cause::TEMPERATURE);
+          break;
+
+        case RuleType::TEMP_DIFFERENCE:
+          triggers.set(rule.trigger, evaluateTempDifference(rule, data, latch), Cause::TEMPERATURE);
+          break;
+
+        case RuleType::OW_SENSOR_ERROR:
+          triggers.set(rule.trigger, data.owSensorErrors() > rule.limit, Cause::OW_SENSOR_ERROR);
+          break;
+
+        case RuleType::CELL_VOLTAGE_PLAUSIBILITY:
+          for (uint16_t bmsNr = rule.first; bmsNr <= rule.last; ++bmsNr)
+          {
+            triggers.set(rule.trigger, data.cellVoltageUnchangedCycles(static_cast<uint8_t>(bmsNr)) > rule.limit, Cause::CELL_VOLTAGE_PLAUSIBILITY);
+          }
+          break;
+
+        case RuleType::SOC:
+          evaluateSoc(rule, data, latch, triggers);
+          break;
+
+        case RuleType::DIGITAL_INPUT:
+        {
+          const bool input = ((data.digitalInputs() >> rule.source) & 0x01) == 0x01;
+          triggers.set(rule.trigger, input != ((rule.flags & FLAG_INVERT) == FLAG_INVERT), Cause::DI);
+          break;
+        }
+      }
+    }
+  }
+
+  private:
+  static constexpr uint8_t LATCH_NONE {0};
+  static constexpr uint8_t LATCH_LOW {1};
+  static constexpr uint8_t LATCH_HIGH {2};
+
+  template<std::size_t TRIGGERS>
+  static void evaluateCellVoltage(const Rule& rule, const BmsDataSnapshot& bms, TriggerState<TRIGGERS>& triggers)
+  {
+    for (uint16_t cell = rule.first; cell <= rule.last && cell < BMSDATA_MAX_CELLS; ++cell)
+    {
+      if (bms.cellVoltage[cell] < rule.low || bms.cellVoltage[cell] > rule.high)
+      {
+        triggers.set(rule.trigger, true, Cause::BMS_CELL_VOLTAGE_RANGE);
+        return; // One cell is enough
+      }
+    }
+    triggers.set(rule.trigger, false, Cause::BMS_CELL_VOLTAGE_RANGE);
+  }
+
+  /* Active below low or above high; inactive again after the voltage returned by the hysteresis */
+  template<std::size_t TRIGGERS>
+  static void evaluateTotalVoltage(const Rule& rule, float voltage, uint8_t& latch, TriggerState<TRIGGERS>& triggers)
+  {
+    if (voltage < rule.low)
+    {
+      latch = LATCH_LOW;
+      triggers.set(rule.trigger, true, Cause::BMS_TOTAL_VOLTAGE_MIN);
+    }
+    else if (voltage > rule.high)
+    {
+      latch = LATCH_HIGH;
+      triggers.set(rule.trigger, true, Cause::BMS_TOTAL_VOLTAGE_MAX);
+    }
+    else if (latch == LATCH_LOW)
+    {
+      const bool stillActive = (voltage <= rule.low + rule.hysteresis);
+      if (!stillActive) latch = LATCH_NONE;
+      triggers.set(rule.trigger, stillActive, Cause::BMS_TOTAL_VOLTAGE_MIN);
+    }
+    else if (latch == LATCH_HIGH)
+    {
+      const bool stillActive = (voltage >= rule.high - rule.hysteresis);
+      if (!stillActive) latch = LATCH_NONE;
+      triggers.set(rule.trigger, stillActive, Cause::BMS_TOTAL_VOLTAGE_MAX);
+    }
+    // else: Trigger is not touched
+  }
+
+  template<typename DATA>
+  static float temperature(const Rule& rule, DATA& data, uint8_t sensorNr)
+  {
+    if (rule.source == static_cast<uint8_t>(TempSource::BMS))
+    {
+      if (sensorNr >= BMSDATA_MAX_TEMPERATURES) return SENSOR_READ_ERROR;
+      return data.bms(rule.bms).getTempature(sensorNr);
+    }
+    if (rule.source == static_cast<uint8_t>(TempSource::ONEWIRE)) return data.owTemperature(sensorNr);
+    return 0;
+  }
+
+  /* Active if one sensor is above max; inactive again if all sensors are below max-hysteresis */
+  template<typename DATA>
+  static bool evaluateTempMax(const Rule& rule, DATA& data, float max, uint8_t& latch)
+  {
+    if (rule.type == RuleType::TEMP_MAX && max <= 0) return false; // No max. temperature
+
+    bool belowHysteresis = true;
+    for (uint16_t sensorNr = rule.first; sensorNr <= rule.last; ++sensorNr)
+    {
+      const float temp = temperature(rule, data, static_cast<uint8_t>(sensorNr));
+      if (temp == SENSOR_READ_ERROR) continue;
+      if (temp > max)
+      {
+        latch = LATCH_HIGH;
+        return true;
+      }
+      if (latch == LATCH_HIGH && temp > max - rule.hysteresis) belowHysteresis = false;
+    }
+
+    if (belowHysteresis) latch = LATCH_NONE;
+    return !belowHysteresis;
+  }
+
+  /* Active if the difference of the sensors is >= max; inactive again if it is below max-hysteresis */
+  template<typename DATA>
+  static bool evaluateTempDifference(const Rule& rule, DATA& data, uint8_t& latch)
+  {
+    float min = 0xFF;
+    float max = 0;
+    for (uint16_t sensorNr = rule.first; sensorNr <= rule.last; ++sensorNr)
+    {
+      const float temp = temperature(rule, data, static_cast<uint8_t>(sensorNr));
+      if (temp > max) max = temp;
+      if (temp < min) min = temp;
+    }
+
+    const float difference = max - min;
+    if (difference >= rule.high)
+    {
+      latch = LATCH_HIGH;
+      return true;
+    }
+    if (latch == LATCH_HIGH && difference >= rule.high - rule.hysteresis) return true;
+    latch = LATCH_NONE;
+    return false;
+  }
+
+  /* on > off: Active from SoC >= on until SoC <= off; on < off: active from SoC <= on until SoC >= off */
+  template<typename DATA, std::size_t TRIGGERS>
+  static void evaluateSoc(const Rule& rule, DATA& data, uint8_t& latch, TriggerState<TRIGGERS>& triggers)
+  {
+    if (!data.batteryOnline())
+    {
+      latch = LATCH_NONE;
+      return;
+    }
+
+    const float soc = data.soc();
+    const bool latched = (latch == LATCH_HIGH);
+    if (rule.high > rule.low)
+    {
+      if ((soc >= rule.high || latched) && soc > rule.low)
+      {
+        latch = LATCH_HIGH;
+        triggers.set(rule.trigger, true, Cause::SOC);
+      }
+      else if (soc <= rule.low && latched)
+      {
+        latch = LATCH_NONE;
+        triggers.set(rule.trigger, false, Cause::SOC);
+      }
+    }
+    else if (rule.low > rule.high)
+    {
+      if ((soc <= rule.high || latched) && soc < rule.low)
+      {
+        latch = LATCH_HIGH;
+        triggers.set(rule.trigger, true, Cause::SOC);
+      }
+      else if (soc >= rule.low && latched)
+      {
+        latch = LATCH_NONE;
+        triggers.set(rule.trigger, false, Cause::SOC);
+      }
+    }
+  }
+
+  uint8_t _latch[MAX_RULES] {};
+  RuleTable<MAX_RULES> _table;  //!< Table of the latches (see update())
+};
+
+} // namespace alarmrules
+
+#endif // ALARMRULEENGINE_H
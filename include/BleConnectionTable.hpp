@@ -0,0 +1,184 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef BLECONNECTIONTABLE_HPP
+#define BLECONNECTIONTABLE_HPP
+
+#include <cstddef> // std::size_t
+#include <cstdint> // uint8_t, ...
+
+/**
+ * @file
+ * Routing of BLE notifications to the configured devices and per-device notification statistics.
+ *
+ * - ConnectionTable: Maps the connection handle of a client to the device number. Small handles (the
+ *   NimBLE host hands them out in ascending order) are looked up directly in an array, so the notify
+ *   callback does not have to compare the peer address against all devices for every packet.
+ * - NotifyMonitor: Counts the notifications of one device, the notification rate, reassembly errors
+ *   and gaps without data (stale data).
+*/
+
+namespace ble
+{
+
+constexpr uint16_t INVALID_CONN_HANDLE {0xFFFF};
+constexpr uint8_t NO_DEVICE {0xFF};
+
+/**
+ * Maps connection handles to the device numbers 0..DEVICES-1.
+*/
+template<uint8_t DEVICES, uint16_t DIRECT_SLOTS = 16>
+class ConnectionTable
+{
+  public:
+  ConnectionTable() { clear(); }
+
+  void clear()
+  {
+    for (uint8_t& devNr : _direct) devNr = NO_DEVICE;
+    for (uint16_t& handle : _handles) handle = INVALID_CONN_HANDLE;
+  }
+
+  /** @brief Assigns the connection handle to the device. An old handle of the device is removed. */
+  void add(uint16_t connHandle, uint8_t devNr)
+  {
+    if (devNr >= DEVICES || connHandle == INVALID_CONN_HANDLE) return;
+    removeDevice(devNr);
+    removeHandle(connHandle);
+    _handles[devNr] = connHandle;
+    if (connHandle < DIRECT_SLOTS) _direct[connHandle] = devNr;
+  }
+
+  void removeDevice(uint8_t devNr)
+  {
+    if (devNr >= DEVICES) return;
+    const uint16_t handle = _handles[devNr];
+    if (handle < DIRECT_SLOTS) _direct[handle] = NO_DEVICE;
+    _handles[devNr] = INVALID_CONN_HANDLE;
+  }
+
+  void removeHandle(uint16_t connHandle)
+  {
+    const uint8_t devNr = find(connHandle);
+    if (devNr != NO_DEVICE) removeDevice(devNr);
+  }
+
+  /** @return The device number or NO_DEVICE */
+  uint8_t find(uint16_t connHandle) const
+  {
+    if (connHandle < DIRECT_SLOTS) return _direct[connHandle];
+    if (connHandle == INVALID_CONN_HANDLE) return NO_DEVICE;
+    for (uint8_t devNr = 0; devNr < DEVICES; ++devNr)
+    {
+      if (_handles[devNr] == connHandle) return devNr;
+    }
+    return NO_DEVICE;
+  }
+
+  uint16_t handle(uint8_t devNr) const { return devNr < DEVICES ? _handles[devNr] : INVALID_CONN_HANDLE; }
+
+  private:
+  uint8_t _direct[DIRECT_SLOTS];
+  uint16_t _handles[DEVICES];
+};
+
+/** Notification statistics of one device */
+struct NotifyStatistics
+{
+  uint32_t connects;
+  uint32_t disconnects;
+  uint32_t notifications;
+  uint32_t bytes;
+  uint32_t reassemblyErrors;  //!< Notifications, which did not fit into the expected frame sequence
+  uint32_t staleGaps;         //!< Gaps between two notifications longer than the stale time
+  uint32_t maxGapMs;          //!< Longest gap between two notifications
+  uint32_t lastNotifyAgeMs;   //!< Time since the last notification (0 if not connected)
+  float    notifyRate;        //!< Notifications per second in the last complete window
+};
+
+/**
+ * Collects the notification statistics of one device.
+ * Gaps are measured between two notifications of the same connection.
+*/
+class NotifyMonitor
+{
+  public:
+  static constexpr uint32_t DEFAULT_STALE_GAP_MS {5000};    //!< Same as the timeout of the BMS data
+  static constexpr uint32_t DEFAULT_RATE_WINDOW_MS {10000};
+
+  explicit NotifyMonitor(uint32_t staleGapMs = DEFAULT_STALE_GAP_MS, uint32_t rateWindowMs = DEFAULT_RATE_WINDOW_MS) :
+    _staleGapMs(staleGapMs), _rateWindowMs(rateWindowMs > 0 ? rateWindowMs : 1) {}
+
+  /** @brief The device was connected */
+  void connected(uint32_t nowMs)
+  {
+    _stats.connects++;
+    _connected = true;
+    _lastNotifyMs = nowMs;
+    _windowStartMs = nowMs;
+    _windowCount = 0;
+    _stats.notifyRate = 0;
+  }
+
+  /** @brief The device was disconnected */
+  void disconnected()
+  {
+    if (!_connected) return;
+    _stats.disconnects++;
+    _connected = false;
+    _stats.notifyRate = 0;
+  }
+
+  void notify(uint32_t nowMs, std::size_t length)
+  {
+    const uint32_t gap = nowMs - _lastNotifyMs;
+    if (_connected)
+    {
+      if (gap > _stats.maxGapMs) _stats.maxGapMs = gap;
+      if (gap > _staleGapMs) _stats.staleGaps++;
+    }
+    _lastNotifyMs = nowMs;
+    _stats.notifications++;
+    _stats.bytes += static_cast<uint32_t>(length);
+
+    _windowCount++;
+    const uint32_t window = nowMs - _windowStartMs;
+    if (window >= _rateWindowMs)
+    {
+      _stats.notifyRate = static_cast<float>(_windowCount) * 1000.0f / static_cast<float>(window);
+      _windowStartMs = nowMs;
+      _windowCount = 0;
+    }
+  }
+
+  void reassemblyError() { _stats.reassemblyErrors++; }
+
+  /** @brief Returns the statistics. The rate is 0, if no notification was received within the last window. */
+  NotifyStatistics statistics(uint32_t nowMs) const
+  {
+    NotifyStatistics stats = _stats;
+    if (!_connected)
+    {
+      stats.lastNotifyAgeMs = 0;
+      return stats;
+    }
+    stats.lastNotifyAgeMs = nowMs - _lastNotifyMs;
+    if (stats.lastNotifyAgeMs > _rateWindowMs) stats.notifyRate = 0;
+    return stats;
+  }
+
+  private:
+  const uint32_t _staleGapMs;
+  const uint32_t _rateWindowMs;
+  bool _connected {false};
+  uint32_t _lastNotifyMs {0};
+  uint32_t _windowStartMs {0};
+  uint32_t _windowCount {0};
+  NotifyStatistics _stats {};
+};
+
+} // namespace ble
+
+#endif // BLECONNECTIONTABLE_HPP
@@ -12,6 +12,9 @@
 #include "WebSettings.h"
 #include "defines.h"
 #include "BmsData.h"
+#include "BleConnectionTable.hpp"
+#include "PollScheduler.hpp"
+#include "CommStats.hpp"
 
 
 
@@ -46,6 +49,9 @@ public:
   void sendDataToNeey();
   void readDataFromNeey();
   static void setBalancerState(uint8_t u8_devNr, boolean bo_state);
+  static void getStatistics(uint8_t devNr, ble::NotifyStatistics &stats);
+  static pollscheduler::DeviceStatistics getPollStatistics(uint8_t devNr);
+  static void getCommStatistics(uint8_t devNr, commstats::Statistics &stats);
 
 private:
   uint8_t timer_startScan;
@@ -58,6 +58,8 @@ void bmsDataSemaphoreTake();
 void bmsDataSemaphoreGive();
 
 struct bmsData_s* getBmsData();
+void getBmsDataSnapshot(uint8_t devNr, BmsDataSnapshot &snapshot);
+void setBmsDataSnapshot(uint8_t devNr, const BmsDataSnapshot &snapshot);
 struct bmsFilterData_s* getBmsFilterData();
 uint8_t* getBmsFilterErrorCounter(uint8_t);
 
@@ -122,7 +124,11 @@ uint8_t getBmsLastChangeCellVoltageCrc(uint8_t devNr);
 void setBmsLastChangeCellVoltageCrc(uint8_t devNr, uint8_t value);
 
 unsigned long getBmsLastDataMillis(uint8_t devNr);
-void setBmsLastDataMillis(uint8_t devNr, unsigned long value);
+
+/* Ende einer Aktualisierung: Setzt den Zeitpunkt der letzten Daten und veröffentlicht den Snapshot des BMS
+ * (getBmsDataSnapshot). Jeder Treiber ruft die Funktion auf, nachdem er alle Werte eines Datensatzes gesetzt hat.
+ * Werte, die danach gesetzt werden, sind erst mit der nächsten Aktualisierung im Snapshot. */
+void bmsDataUpdateComplete(uint8_t devNr, unsigned long u32_lastDataMillis);
 
 //write serial data
 uint8_t *getSerialBmsWriteData(uint8_t devNr, serialDataRwTyp_e *dataTyp, uint8_t *rwDataLen);
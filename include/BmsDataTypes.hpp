@@ -88,6 +88,51 @@ constexpr uint16_t BMS_ERR_STATUS_RESERVED1     {utils::bitIdxToValue<uint16_t>(
 constexpr uint16_t BMS_ERR_STATUS_RESERVED2     {utils::bitIdxToValue<uint16_t>(BMS_ERR_STATUS_RESERVED2_BIT_IDX)};     //  16384 - bit14 Reserved
 constexpr uint16_t BMS_ERR_STATUS_RESERVED3     {utils::bitIdxToValue<uint16_t>(BMS_ERR_STATUS_RESERVED3_BIT_IDX)};     //  32768 - bit15 Reserved
 
+/** Maximum number of cell voltages stored per BMS */
+constexpr std::size_t BMSDATA_MAX_CELLS {24};
+
+/** Maximum number of temperature sensors stored per BMS */
+constexpr std::size_t BMSDATA_MAX_TEMPERATURES {3};
+
+/**
+ * @brief Consistent copy of the data of a single BMS.
+ * The snapshot is published by the BmsData module at the end of every update of a BMS
+ * (see bmsDataUpdateComplete()) and can be read without blocking the writers (see getBmsDataSnapshot()).
+ * The units are the same as in bmsData_s.
+*/
+struct BmsDataSnapshot
+{
+  uint16_t      cellVoltage[BMSDATA_MAX_CELLS];         //!< Cell voltages in mV, 0xFFFF if not valid
+  int16_t       totalVoltage;                           //!< Total voltage in 10mV
+  uint16_t      maxCellDifferenceVoltage;               //!< Max. cell difference in mV
+  uint16_t      avgVoltage;                             //!< Average cell voltage in mV
+  int16_t       totalCurrent;                           //!< Total current in 10mA
+  uint16_t      maxCellVoltage;                         //!< Max. cell voltage in mV
+  uint16_t      minCellVoltage;                         //!< Min. cell voltage in mV
+  uint8_t       maxVoltageCellNumber;                   //!< Cell number of the max. cell voltage
+  uint8_t       minVoltageCellNumber;                   //!< Cell number of the min. cell voltage
+  uint8_t       isBalancingActive;                      //!< Balancer state
+  uint8_t       chargePercentage;                       //!< SoC in %
+  int16_t       balancingCurrent;                       //!< Balancing current in 10mA
+  int16_t       temperature[BMSDATA_MAX_TEMPERATURES];  //!< Temperatures in 0.01°C
+  uint32_t      errors;                                 //!< Error bits, see BmsErrorBits
+  uint8_t       stateFETs;                              //!< Bit 0: FET charge, bit 1: FET discharge
+  unsigned long lastDataMillis;                         //!< Timestamp of the last complete data set
+
+  /** Returns the total voltage in V */
+  float getTotalVoltage() const { return static_cast<float>(totalVoltage / 100.0); }
+  /** Returns the total current in A */
+  float getTotalCurrent() const { return static_cast<float>(totalCurrent / 100.0); }
+  /** Returns the balancing current in A */
+  float getBalancingCurrent() const { return static_cast<float>(balancingCurrent / 100.0); }
+  /** Returns the temperature of the given sensor in °C */
+  float getTempature(std::size_t sensorNr) const { return static_cast<float>(temperature[sensorNr] / 100.0); }
+  /** Returns true, if the charge FET is on */
+  bool getStateFETsCharge() const { return (stateFETs & 0x01) == 0x01; }
+  /** Returns true, if the discharge FET is on */
+  bool getStateFETsDischarge() const { return (stateFETs & 0x02) == 0x02; }
+};
+
 /**
  * @brief This method convert the JkBmsWarnMsg into the BmsErrorStatus.
  * */
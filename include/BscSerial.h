@@ -9,6 +9,19 @@
 
 #include "Arduino.h"
 #include <SoftwareSerial.h>
+#include "PollScheduler.hpp"
+#include "CommStats.hpp"
+
+/* Die seriellen Schnittstellen werden in Gruppen abgefragt. Jede Gruppe hat einen eigenen Task.
+ * Gruppe 0: Serial 0 (HW Serial)
+ * Gruppe 1: Serial 1 (HW Serial1)
+ * Gruppe 2: Serial 2 (HW Serial2) und die Serial-Extension (Serial 3-10), da diese über Serial2 gemultiplext wird */
+#define SERIAL_PORT_GROUP_COUNT 3
+
+uint8_t serialGetPortGroup(uint8_t u8_devNr);
+uint32_t serialGetCycleTime(uint8_t u8_devNr);
+pollscheduler::DeviceStatistics serialGetPollStatistics(uint8_t u8_devNr);
+commstats::Source serialGetCommStatistics(uint8_t u8_devNr, commstats::Statistics &stats);
 
 class BscSerial {
 public:
@@ -21,13 +34,13 @@ public:
   void setSerialBaudrate(uint8_t u8_devNr);
   void setSerialRxBufferSize(uint8_t u8_devNr, uint16_t rxBufSize);
 
-  void cyclicRun();
+  uint32_t cyclicRun(uint8_t u8_portGroup); //Rückgabe: Zeit in ms bis das nächste Gerät der Gruppe fällig ist
 
   void setReadBmsFunktion(uint8_t u8_devNr, uint8_t funktionsTyp);
 
 
 private:
-  SemaphoreHandle_t mSerialMutex = NULL;
+  SemaphoreHandle_t mSerialMutex[SERIAL_PORT_GROUP_COUNT] = {NULL};
 
   void setSerialBaudrate(uint8_t u8_devNr, uint32_t baudrate);
 
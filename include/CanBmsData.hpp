@@ -0,0 +1,197 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef CANBMSDATA_H
+#define CANBMSDATA_H
+
+#include <cstddef> // std::size_t
+#include <cstdint> // uint8_t, ...
+#include "BmsDataTypes.hpp"
+
+/**
+ * @file
+ * This header provides the encoder and decoder of the extended BMS data frames (Victron, "Send extended data")
+ * and the scheduler, which distributes the frames over the cycles of the CAN task.
+ *
+ * Every BMS has a block of IDs starting at BASE_CAN_ID + (ID_STRIDE * bmsNr). All values are little endian.
+ *
+ * | Offset | Length | Content                                                            |
+ * |--------|--------|--------------------------------------------------------------------|
+ * | 0..3   | 8      | Cell voltages 1..16 in mV (4 cells per frame)                      |
+ * | 4      | 3      | Charge FET on, discharge FET on, balancing active (0/1 per byte)   |
+ * | 5      | 2      | Balancing current in 10mA                                          |
+ * | 6..7   | 8      | Cell voltages 17..24 in mV (4 cells per frame)                     |
+ *
+ * The offsets 0..5 are unchanged from the former layout with 16 cells, the cells 17..24 were appended
+ * behind them. Receivers, which only know the former layout, therefore still work.
+*/
+
+namespace canbmsdata
+{
+
+constexpr uint32_t BASE_CAN_ID {0x400};     //!< CAN ID of the first frame of BMS 0
+constexpr uint32_t ID_STRIDE {0x32};        //!< Distance of the ID blocks of two BMS
+constexpr uint8_t CELLS_PER_FRAME {4};      //!< Number of cell voltages in one cell frame
+constexpr uint8_t FRAME_STATE {4};          //!< Offset of the FET and balancer state frame
+constexpr uint8_t FRAME_BALANCING {5};      //!< Offset of the balancing current frame
+constexpr uint8_t FRAMES_PER_BMS {8};       //!< Number of frames per BMS
+constexpr uint8_t FRAME_LEN_MAX {8};        //!< Max. length of a frame
+
+static_assert(BMSDATA_MAX_CELLS == 24, "The frame layout is made for 24 cells");
+static_assert(FRAMES_PER_BMS <= ID_STRIDE, "The frames of one BMS must fit into the ID block");
+
+/** Returns the index of the first cell of the frame, or -1 if the frame has no cell voltages */
+constexpr int8_t firstCellOfFrame(uint8_t frame)
+{
+  return (frame < FRAME_STATE) ? static_cast<int8_t>(frame * CELLS_PER_FRAME) :
+         (frame > FRAME_BALANCING && frame < FRAMES_PER_BMS) ? static_cast<int8_t>((frame - 2) * CELLS_PER_FRAME) : -1;
+}
+
+/** Returns the CAN ID of the frame of the BMS */
+constexpr uint32_t canId(uint8_t bmsNr, uint8_t frame)
+{
+  return BASE_CAN_ID + (ID_STRIDE * bmsNr) + frame;
+}
+
+/**
+ * @brief Determines BMS number and frame from a CAN ID.
+ * @return false, if the ID is not an extended BMS data frame of one of the numberOfBms BMS.
+*/
+inline bool fromCanId(uint32_t id, uint8_t numberOfBms, uint8_t& bmsNr, uint8_t& frame)
+{
+  if (id < BASE_CAN_ID) return false;
+  const uint32_t offset = id - BASE_CAN_ID;
+  if ((offset / ID_STRIDE) >= numberOfBms || (offset % ID_STRIDE) >= FRAMES_PER_BMS) return false;
+  bmsNr = static_cast<uint8_t>(offset / ID_STRIDE);
+  frame = static_cast<uint8_t>(offset % ID_STRIDE);
+  return true;
+}
+
+/**
+ * @brief Encodes one frame of the BMS.
+ * @param data Buffer of at least FRAME_LEN_MAX bytes.
+ * @return Length of the frame; 0 if the frame number is not valid.
+*/
+inline uint8_t encodeFrame(const BmsDataSnapshot& snapshot, uint8_t frame, uint8_t* data)
+{
+  const int8_t firstCell = firstCellOfFrame(frame);
+  if (firstCell >= 0)
+  {
+    for (uint8_t i = 0; i < CELLS_PER_FRAME; ++i)
+    {
+      const uint16_t cellVoltage = snapshot.cellVoltage[firstCell + i];
+      data[i * 2] = static_cast<uint8_t>(cellVoltage & 0xFF);
+      data[i * 2 + 1] = static_cast<uint8_t>(cellVoltage >> 8);
+    }
+    return CELLS_PER_FRAME * 2;
+  }
+
+  if (frame == FRAME_STATE)
+  {
+    data[0] = snapshot.getStateFETsCharge() ? 1 : 0;
+    data[1] = snapshot.getStateFETsDischarge() ? 1 : 0;
+    data[2] = (snapshot.isBalancingActive != 0) ? 1 : 0;
+    return 3;
+  }
+
+  if (frame == FRAME_BALANCING)
+  {
+    const uint16_t balancingCurrent = static_cast<uint16_t>(snapshot.balancingCurrent);
+    data[0] = static_cast<uint8_t>(balancingCurrent & 0xFF);
+    data[1] = static_cast<uint8_t>(balancingCurrent >> 8);
+    return 2;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Decodes one frame of the BMS into the snapshot. Only the values of the frame are changed.
+ * @return false, if frame number or length are not valid.
+*/
+inline bool decodeFrame(uint8_t frame, const uint8_t* data, uint8_t len, BmsDataSnapshot& snapshot)
+{
+  const int8_t firstCell = firstCellOfFrame(frame);
+  if (firstCell >= 0)
+  {
+    if (len < CELLS_PER_FRAME * 2) return false;
+    for (uint8_t i = 0; i < CELLS_PER_FRAME; ++i)
+    {
+      snapshot.cellVoltage[firstCell + i] = static_cast<uint16_t>(data[i * 2] | (data[i * 2 + 1] << 8));
+    }
+    return true;
+  }
+
+  if (frame == FRAME_STATE)
+  {
+    if (len < 3) return false;
+    snapshot.stateFETs = static_cast<uint8_t>((data[0] != 0 ? 0x01 : 0) | (data[1] != 0 ? 0x02 : 0));
+    snapshot.isBalancingActive = (data[2] != 0) ? 1 : 0;
+    return true;
+  }
+
+  if (frame == FRAME_BALANCING)
+  {
+    if (len < 2) return false;
+    snapshot.balancingCurrent = static_cast<int16_t>(data[0] | (data[1] << 8));
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * Distributes the frames of all BMS over the cycles of the CAN task (round robin).
+ *
+ * With framesPerCycle = 0 all frames of one BMS are sent per cycle (former behavior). Otherwise at most
+ * framesPerCycle frames are sent per cycle and the next cycle continues with the following frame, also
+ * across the BMS boundary. This limits the bus load of one cycle independent of the number of BMS.
+*/
+class Scheduler
+{
+  public:
+  /**
+   * @brief Sends the frames of this cycle.
+   * @param send Callable void(uint8_t bmsNr, uint8_t frame), which encodes and sends the frame.
+   * @return Number of frames sent.
+  */
+  template<typename SEND>
+  uint8_t run(uint8_t numberOfBms, uint8_t framesPerCycle, SEND send)
+  {
+    if (numberOfBms == 0) return 0;
+    if (_bmsNr >= numberOfBms) { _bmsNr = 0; _frame = 0; }
+
+    const bool wholeBms = (framesPerCycle == 0);
+    if (wholeBms) framesPerCycle = FRAMES_PER_BMS - _frame;
+
+    uint8_t sent = 0;
+    while (sent < framesPerCycle)
+    {
+      send(_bmsNr, _frame);
+      sent++;
+      if (++_frame >= FRAMES_PER_BMS)
+      {
+        _frame = 0;
+        if (++_bmsNr >= numberOfBms) _bmsNr = 0;
+        if (wholeBms) break;
+      }
+    }
+    return sent;
+  }
+
+  /** Returns the BMS, which is sent next */
+  uint8_t nextBms() const { return _bmsNr; }
+
+  /** Returns the frame, which is sent next */
+  uint8_t nextFrame() const { return _frame; }
+
+  private:
+  uint8_t _bmsNr {0};
+  uint8_t _frame {0};
+};
+
+} // namespace canbmsdata
+
+#endif // CANBMSDATA_H
@@ -7,6 +7,7 @@
 #define CANBUS_H
 
 #include <Arduino.h>
+#include "CommStats.hpp"
 
 #define CAN_BMS_COMMUNICATION_TIMEOUT 5000
 
@@ -30,9 +31,29 @@ struct inverterData_s
 };
 
 
+struct canStatistics_s
+{
+  uint32_t rxFrames;          // Anzahl empfangener Frames
+  uint32_t rxDropped;         // Verlorene Frames, da die RX-Queue voll war
+  uint32_t rxOverrun;         // Verlorene Frames durch einen Überlauf des RX-FIFOs im Controller
+  uint32_t rxQueueHighWater;  // Maximaler Füllstand der RX-Queue
+  uint32_t rxQueueLength;     // Länge der RX-Queue
+
+  uint32_t txFrames;          // Anzahl gesendeter Frames
+  uint32_t txFailed;          // Frames, die nicht in die TX-Queue gestellt werden konnten
+  uint32_t txQueueFull;       // Anzahl Sendeversuche, bei denen die TX-Queue voll war
+  uint32_t txQueueLength;     // Länge der TX-Queue
+  uint32_t txLatencyLastUs;   // Wartezeit bis der letzte Frame in die TX-Queue gestellt wurde
+  uint32_t txLatencyMaxUs;    // Maximale Wartezeit
+};
+
+
 void canSetup();
 void loadCanSettings();
 void canTxCyclicRun();
+void canRxCyclicRun();
+void canGetStatistics(struct canStatistics_s &stats);
+void canGetBmsCommStatistics(commstats::Statistics &stats);
 void canSetChargeCurrentToZero(bool);
 void canSetDischargeCurrentToZero(bool);
 void canSetSocToFull(bool);
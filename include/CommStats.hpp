@@ -0,0 +1,145 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef COMMSTATS_HPP
+#define COMMSTATS_HPP
+
+#include <cstddef> // std::size_t
+#include <cstdint> // uint8_t, ...
+
+/**
+ * @file
+ * Communication quality of one BMS source (serial, bluetooth or CAN) in fixed-size memory.
+ *
+ * Sources with requests (serial) record each request and its result: a response with the response time, a
+ * timeout or an error. Sources, which send their data on their own (bluetooth, CAN), record each received data
+ * frame with received(); the response time is then the gap to the previous data frame and a gap longer than the
+ * timeout is counted as timeout.
+ *
+ * The response times are additionally counted in a histogram with the limits HISTOGRAM_LIMITS_MS.
+*/
+
+namespace commstats
+{
+
+constexpr std::size_t HISTOGRAM_BINS {9};
+
+/** Upper limits of the bins of the histogram in ms; the last bin has no upper limit */
+constexpr uint16_t HISTOGRAM_LIMITS_MS[HISTOGRAM_BINS - 1] {10, 20, 50, 100, 200, 500, 1000, 2000};
+
+/** Kind of the source (SERIAL and DISPLAY are macros of the Arduino core) */
+enum class Source : uint8_t
+{
+  NONE,
+  SERIAL_BMS,
+  BT_BMS,
+  CAN_BMS
+};
+
+constexpr const char* sourceName(Source source)
+{
+  return source == Source::SERIAL_BMS ? "serial" : source == Source::BT_BMS ? "bt" :
+    source == Source::CAN_BMS ? "can" : "";
+}
+
+struct Statistics
+{
+  uint32_t requests;
+  uint32_t responses;
+  uint32_t timeouts;
+  uint32_t checksumErrors;
+  uint32_t resyncs;            //!< Frame start searched again after invalid data (format error, garbage)
+  uint32_t plausibilityTrips;  //!< Cell voltages did not change for several polls (BMS hangs)
+  uint32_t responseLastUs;
+  uint32_t responseMinUs;
+  uint32_t responseAvgUs;      //!< Moving average (1/8)
+  uint32_t responseMaxUs;
+  uint32_t histogram[HISTOGRAM_BINS];
+};
+
+/** @brief False, if nothing was sent to or received from the source yet (e.g. not configured) */
+inline bool hasTraffic(const Statistics& stats)
+{
+  return stats.requests != 0 || stats.responses != 0 || stats.timeouts != 0;
+}
+
+/** @brief Bin of the histogram for a response time */
+inline std::size_t histogramBin(uint32_t responseUs)
+{
+  const uint32_t responseMs = responseUs / 1000;
+  std::size_t bin = 0;
+  while (bin < HISTOGRAM_BINS - 1 && responseMs >= HISTOGRAM_LIMITS_MS[bin]) ++bin;
+  return bin;
+}
+
+/**
+ * Records the statistics of one source.
+*/
+class Recorder
+{
+  public:
+  Recorder() { reset(); }
+
+  void reset()
+  {
+    _stats = Statistics {};
+    _lastReceivedUs = 0;
+    _received = false;
+  }
+
+  void request() { _stats.requests++; }
+
+  void response(uint32_t responseUs)
+  {
+    _stats.responseLastUs = responseUs;
+    if (_stats.responses == 0)
+    {
+      _stats.responseMinUs = responseUs;
+      _stats.responseMaxUs = responseUs;
+      _stats.responseAvgUs = responseUs;
+    }
+    else
+    {
+      if (responseUs < _stats.responseMinUs) _stats.responseMinUs = responseUs;
+      if (responseUs > _stats.responseMaxUs) _stats.responseMaxUs = responseUs;
+      _stats.responseAvgUs = static_cast<uint32_t>((static_cast<uint64_t>(_stats.responseAvgUs) * 7 + responseUs) / 8);
+    }
+    _stats.responses++;
+    _stats.histogram[histogramBin(responseUs)]++;
+  }
+
+  /**
+   * @brief Records a data frame of a source without requests.
+   * @param nowUs Time of the frame (micros())
+   * @param timeoutUs A longer gap to the previous frame is counted as timeout
+  */
+  void received(uint32_t nowUs, uint32_t timeoutUs)
+  {
+    if (_received)
+    {
+      const uint32_t gapUs = nowUs - _lastReceivedUs;
+      if (gapUs > timeoutUs) _stats.timeouts++;
+      response(gapUs);
+    }
+    _lastReceivedUs = nowUs;
+    _received = true;
+  }
+
+  void timeout() { _stats.timeouts++; }
+  void checksumError(uint32_t count = 1) { _stats.checksumErrors += count; }
+  void resync(uint32_t count = 1) { _stats.resyncs += count; }
+  void plausibilityTrip() { _stats.plausibilityTrips++; }
+
+  const Statistics& statistics() const { return _stats; }
+
+  private:
+  Statistics _stats;
+  uint32_t _lastReceivedUs;
+  bool _received;
+};
+
+} // namespace commstats
+
+#endif // COMMSTATS_HPP
@@ -0,0 +1,38 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef HEAPSTATS_H
+#define HEAPSTATS_H
+
+#include <Arduino.h>
+
+/* Fragmentierung des Heaps: Größter freier Block vor und nach den Web-Requests der Live-Daten
+ * (/getDashboardData, /bmsSpg/getBmsSpgData, /livedata/owTempLive/getOwTempData).
+ * Bleibt der Heap bei einem pollenden Browser stabil, ist der größte freie Block nach dem Request
+ * gleich dem davor (shrinks bleibt konstant).
+ * Die Funktionen werden nur aus loop() (server.handleClient()) aufgerufen. */
+
+struct heapStatistics_s
+{
+  uint32_t freeHeap;              // Aktuell freier Heap [Byte]
+  uint32_t minFreeHeap;           // Minimal freier Heap seit dem Start
+  uint32_t largestFreeBlock;      // Aktuell größter freier Block
+  uint16_t fragmentationPermille; // 1000 - größter Block / freier Heap
+
+  uint32_t requests;              // Gemessene Requests
+  uint32_t largestBeforeLast;     // Größter freier Block vor dem letzten Request
+  uint32_t largestAfterLast;      // Größter freier Block nach dem letzten Request
+  uint32_t largestMin;            // Kleinster größter Block (vor/nach) aller Requests
+  int32_t  freeDeltaLast;         // Änderung des freien Heaps durch den letzten Request
+  uint32_t shrinks;               // Requests, nach denen der größte freie Block kleiner war
+  uint16_t responseMaxLen;        // Längste Antwort (Größe des Scratch-Buffers prüfen)
+  uint32_t responseOverflows;     // Antworten, die nicht in den Scratch-Buffer gepasst haben
+};
+
+void heapStatsRequestBegin();
+void heapStatsRequestEnd(uint16_t u16_lResponseLen, bool bo_lOverflow);
+void heapStatsGetStatistics(struct heapStatistics_s &stats);
+
+#endif
@@ -0,0 +1,210 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef I2CBULKFRAME_H
+#define I2CBULKFRAME_H
+
+#include <cstddef> // std::size_t
+#include <cstdint> // uint8_t, ...
+#include "BmsDataTypes.hpp"
+#include <utils/Crc.hpp>
+
+/**
+ * @file
+ * This header provides the codec of the I2C bulk frame, which transfers all data of one BMS in a single
+ * I2C transaction (display and BSC slaves).
+ *
+ * Frame layout (all values little endian):
+ *
+ * | Offset | Length | Content                                                         |
+ * |--------|--------|-----------------------------------------------------------------|
+ * | 0      | 1      | Version (VERSION)                                               |
+ * | 1      | 1      | Frame type (TYPE_BMS)                                           |
+ * | 2      | 1      | BMS number                                                      |
+ * | 3      | 1      | Sequence number, incremented by the sender with every frame     |
+ * | 4      | 1      | Flags (FLAG_DATA_VALID)                                         |
+ * | 5      | 1      | Length of the payload                                           |
+ * | 6      | n      | Payload, see encodeBms()                                        |
+ * | 6+n    | 2      | CRC16 (Modbus) over header and payload                          |
+ *
+ * Fields may be appended to the payload without changing the version; the decoder ignores them.
+ * Changes of the existing fields require a new version.
+*/
+
+namespace i2cbulk
+{
+
+constexpr uint8_t VERSION {1};
+constexpr uint8_t TYPE_BMS {1};
+constexpr uint8_t FLAG_DATA_VALID {0x01};    //!< The BMS has delivered data within the last 5s
+
+constexpr std::size_t HEADER_LEN {6};
+constexpr std::size_t CRC_LEN {2};
+constexpr std::size_t BMS_PAYLOAD_LEN {BMSDATA_MAX_CELLS * 2 + 2 + 2 + 2 + 2 + 2 + 2 + 1 + 1 + 1 + 1 + 2 + BMSDATA_MAX_TEMPERATURES * 2 + 4 + 1};
+constexpr std::size_t BMS_FRAME_LEN {HEADER_LEN + BMS_PAYLOAD_LEN + CRC_LEN};
+
+static_assert(BMS_FRAME_LEN <= 100, "The frame must fit into the I2C buffer of the ESP32 (incl. transfer header)");
+
+/** Header of a received frame */
+struct FrameHeader
+{
+  uint8_t version;
+  uint8_t type;
+  uint8_t bmsNr;
+  uint8_t sequence;
+  uint8_t flags;
+};
+
+/** Result of decodeBms() */
+enum class DecodeResult : uint8_t
+{
+  OK,
+  TOO_SHORT,       //!< Less bytes than header, payload length and CRC
+  WRONG_CRC,       //!< CRC mismatch
+  WRONG_VERSION,   //!< Unknown version or frame type
+  WRONG_LENGTH,    //!< Payload too short for the version
+};
+
+namespace detail
+{
+
+class Writer
+{
+  public:
+  explicit Writer(uint8_t* data) : _pos(data) {}
+  void u8(uint8_t value) { *_pos++ = value; }
+  void u16(uint16_t value) { u8(static_cast<uint8_t>(value & 0xFF)); u8(static_cast<uint8_t>(value >> 8)); }
+  void u32(uint32_t value) { u16(static_cast<uint16_t>(value & 0xFFFF)); u16(static_cast<uint16_t>(value >> 16)); }
+  uint8_t* pos() const { return _pos; }
+
+  private:
+  uint8_t* _pos;
+};
+
+class Reader
+{
+  public:
+  explicit Reader(const uint8_t* data) : _pos(data) {}
+  uint8_t u8() { return *_pos++; }
+  uint16_t u16() { const uint16_t low = u8(); return static_cast<uint16_t>(low | (u8() << 8)); }
+  uint32_t u32() { const uint32_t low = u16(); return low | (static_cast<uint32_t>(u16()) << 16); }
+
+  private:
+  const uint8_t* _pos;
+};
+
+inline uint16_t crc(const uint8_t* data, std::size_t len)
+{
+  return utils::Crc16Modbus::compute(data, len);
+}
+
+} // namespace detail
+
+/**
+ * @brief Encodes the data of one BMS into a bulk frame.
+ * @param data Buffer of at least BMS_FRAME_LEN bytes.
+ * @return Length of the frame (BMS_FRAME_LEN).
+*/
+inline std::size_t encodeBms(const BmsDataSnapshot& snapshot, uint8_t bmsNr, uint8_t sequence, uint8_t flags, uint8_t* data)
+{
+  detail::Writer w(data);
+  w.u8(VERSION);
+  w.u8(TYPE_BMS);
+  w.u8(bmsNr);
+  w.u8(sequence);
+  w.u8(flags);
+  w.u8(static_cast<uint8_t>(BMS_PAYLOAD_LEN));
+
+  for (std::size_t i = 0; i < BMSDATA_MAX_CELLS; ++i) w.u16(snapshot.cellVoltage[i]);
+  w.u16(static_cast<uint16_t>(snapshot.totalVoltage));
+  w.u16(snapshot.maxCellDifferenceVoltage);
+  w.u16(snapshot.avgVoltage);
+  w.u16(static_cast<uint16_t>(snapshot.totalCurrent));
+  w.u16(snapshot.maxCellVoltage);
+  w.u16(snapshot.minCellVoltage);
+  w.u8(snapshot.maxVoltageCellNumber);
+  w.u8(snapshot.minVoltageCellNumber);
+  w.u8(snapshot.isBalancingActive);
+  w.u8(snapshot.chargePercentage);
+  w.u16(static_cast<uint16_t>(snapshot.balancingCurrent));
+  for (std::size_t i = 0; i < BMSDATA_MAX_TEMPERATURES; ++i) w.u16(static_cast<uint16_t>(snapshot.temperature[i]));
+  w.u32(snapshot.errors);
+  w.u8(snapshot.stateFETs);
+
+  w.u16(detail::crc(data, HEADER_LEN + BMS_PAYLOAD_LEN));
+  return static_cast<std::size_t>(w.pos() - data);
+}
+
+/**
+ * @brief Decodes a bulk frame. The snapshot is only changed if the frame is valid.
+ *        lastDataMillis is not part of the frame and is not changed.
+*/
+inline DecodeResult decodeBms(const uint8_t* data, std::size_t len, FrameHeader& header, BmsDataSnapshot& snapshot)
+{
+  if (len < HEADER_LEN + CRC_LEN) return DecodeResult::TOO_SHORT;
+  const std::size_t payloadLen = data[5];
+  if (len < HEADER_LEN + payloadLen + CRC_LEN) return DecodeResult::TOO_SHORT;
+
+  detail::Reader crcReader(&data[HEADER_LEN + payloadLen]);
+  if (crcReader.u16() != detail::crc(data, HEADER_LEN + payloadLen)) return DecodeResult::WRONG_CRC;
+
+  detail::Reader r(data);
+  header.version = r.u8();
+  header.type = r.u8();
+  header.bmsNr = r.u8();
+  header.sequence = r.u8();
+  header.flags = r.u8();
+  r.u8(); // payload length
+  if (header.version != VERSION || header.type != TYPE_BMS) return DecodeResult::WRONG_VERSION;
+  if (payloadLen < BMS_PAYLOAD_LEN) return DecodeResult::WRONG_LENGTH;
+
+  for (std::size_t i = 0; i < BMSDATA_MAX_CELLS; ++i) snapshot.cellVoltage[i] = r.u16();
+  snapshot.totalVoltage = static_cast<int16_t>(r.u16());
+  snapshot.maxCellDifferenceVoltage = r.u16();
+  snapshot.avgVoltage = r.u16();
+  snapshot.totalCurrent = static_cast<int16_t>(r.u16());
+  snapshot.maxCellVoltage = r.u16();
+  snapshot.minCellVoltage = r.u16();
+  snapshot.maxVoltageCellNumber = r.u8();
+  snapshot.minVoltageCellNumber = r.u8();
+  snapshot.isBalancingActive = r.u8();
+  snapshot.chargePercentage = r.u8();
+  snapshot.balancingCurrent = static_cast<int16_t>(r.u16());
+  for (std::size_t i = 0; i < BMSDATA_MAX_TEMPERATURES; ++i) snapshot.temperature[i] = static_cast<int16_t>(r.u16());
+  snapshot.errors = r.u32();
+  snapshot.stateFETs = r.u8();
+  return DecodeResult::OK;
+}
+
+/**
+ * Tracks the sequence numbers of one sender and counts the lost frames.
+*/
+class SequenceTracker
+{
+  public:
+  /**
+   * @brief Processes the sequence number of a received frame.
+   * @return Number of frames lost since the previous frame; 0 for the first frame.
+  */
+  uint8_t update(uint8_t sequence)
+  {
+    uint8_t lost = 0;
+    if (_valid) lost = static_cast<uint8_t>(sequence - static_cast<uint8_t>(_last + 1));
+    _last = sequence;
+    _valid = true;
+    return lost;
+  }
+
+  /** Forgets the last sequence number (e.g. after a reconnect of the sender) */
+  void reset() { _valid = false; }
+
+  private:
+  uint8_t _last {0};
+  bool _valid {false};
+};
+
+} // namespace i2cbulk
+
+#endif // I2CBULKFRAME_H
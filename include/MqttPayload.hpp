@@ -0,0 +1,100 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef MQTTPAYLOAD_HPP
+#define MQTTPAYLOAD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utils/TextBuffer.hpp>
+#include <Arduino.h> // PROGMEM (defines.h)
+#include "defines.h"
+#include "BmsDataTypes.hpp"
+#include "CommStats.hpp"
+
+/**
+ * @file
+ * This header provides the JSON documents of the aggregated MQTT mode (see mqttPublishBmsDataAggregated()),
+ * which only depend on the BMS data. They can therefore be tested and benchmarked on the host.
+*/
+
+namespace mqttpayload
+{
+
+/**
+ * Fixed buffer for one JSON document. If a text does not fit anymore, the document is marked as overflowed
+ * and must not be sent.
+*/
+template<std::size_t SIZE>
+using Payload = utils::TextBuffer<SIZE>;
+
+/**
+ * @brief Writes all data of a BMS as one JSON document. The keys are the topics of the single messages.
+ * @param valid False, if the data is older than 5s. Then only the valid flag (0) is written.
+*/
+template<typename PAYLOAD>
+void writeBmsData(PAYLOAD& payload, const BmsDataSnapshot& snapshot, bool valid)
+{
+  payload.reset();
+  if (!valid)
+  {
+    payload.appendf("{\"%s\":0}", mqttTopics[MQTT_TOPIC2_BMS_DATA_VALID]);
+    return;
+  }
+
+  // Invalid cells (0xFFFF) are written as null, invalid cells at the end are omitted
+  uint8_t cellCnt = BMSDATA_MAX_CELLS;
+  while (cellCnt > 0 && snapshot.cellVoltage[cellCnt - 1] == 0xFFFF) cellCnt--;
+
+  payload.appendf("{\"%s\":[", mqttTopics[MQTT_TOPIC2_CELL_VOLTAGE]);
+  for (uint8_t n = 0; n < cellCnt; n++)
+  {
+    if (snapshot.cellVoltage[n] == 0xFFFF) payload.append(n == 0 ? "null" : ",null");
+    else payload.appendf(n == 0 ? "%u" : ",%u", snapshot.cellVoltage[n]);
+  }
+  payload.append("],");
+
+  payload.appendf("\"%s\":%u,", mqttTopics[MQTT_TOPIC2_CELL_VOLTAGE_MAX], snapshot.maxCellVoltage);
+  payload.appendf("\"%s\":%u,", mqttTopics[MQTT_TOPIC2_CELL_VOLTAGE_MIN], snapshot.minCellVoltage);
+  payload.appendf("\"%s\":%.2f,", mqttTopics[MQTT_TOPIC2_TOTAL_VOLTAGE], snapshot.getTotalVoltage());
+  payload.appendf("\"%s\":%u,", mqttTopics[MQTT_TOPIC2_MAXCELL_DIFFERENCE_VOLTAGE], snapshot.maxCellDifferenceVoltage);
+  payload.appendf("\"%s\":%.2f,", mqttTopics[MQTT_TOPIC2_TOTAL_CURRENT], snapshot.getTotalCurrent());
+  payload.appendf("\"%s\":%u,", mqttTopics[MQTT_TOPIC2_BALANCING_ACTIVE], snapshot.isBalancingActive);
+  payload.appendf("\"%s\":%.2f,", mqttTopics[MQTT_TOPIC2_BALANCING_CURRENT], snapshot.getBalancingCurrent());
+  payload.appendf("\"%s\":[%.2f,%.2f,%.2f],", mqttTopics[MQTT_TOPIC2_TEMPERATURE],
+    snapshot.getTempature(0), snapshot.getTempature(1), snapshot.getTempature(2));
+  payload.appendf("\"%s\":%u,", mqttTopics[MQTT_TOPIC2_CHARGE_PERCENT], snapshot.chargePercentage);
+  payload.appendf("\"%s\":%u,", mqttTopics[MQTT_TOPIC2_ERRORS], static_cast<unsigned int>(snapshot.errors));
+  payload.appendf("\"%s\":%u,", mqttTopics[MQTT_TOPIC2_FET_STATE_CHARGE], snapshot.getStateFETsCharge());
+  payload.appendf("\"%s\":%u,", mqttTopics[MQTT_TOPIC2_FET_STATE_DISCHARGE], snapshot.getStateFETsDischarge());
+  payload.appendf("\"%s\":1}", mqttTopics[MQTT_TOPIC2_BMS_DATA_VALID]);
+}
+
+/**
+ * @brief Writes the communication statistics of a BMS as one JSON document (topic .../comm).
+ * The keys are the same as in the array comm of the REST API.
+*/
+template<typename PAYLOAD>
+void writeCommStatistics(PAYLOAD& payload, commstats::Source source, const commstats::Statistics& stats)
+{
+  payload.reset();
+  payload.appendf("{\"src\":\"%s\",\"requests\":%u,\"responses\":%u,\"timeouts\":%u,\"checksum_errors\":%u,"
+    "\"resyncs\":%u,\"plausibility_trips\":%u,", commstats::sourceName(source),
+    static_cast<unsigned int>(stats.requests), static_cast<unsigned int>(stats.responses),
+    static_cast<unsigned int>(stats.timeouts), static_cast<unsigned int>(stats.checksumErrors),
+    static_cast<unsigned int>(stats.resyncs), static_cast<unsigned int>(stats.plausibilityTrips));
+  payload.appendf("\"rt_last_us\":%u,\"rt_min_us\":%u,\"rt_avg_us\":%u,\"rt_max_us\":%u,\"histogram\":[",
+    static_cast<unsigned int>(stats.responseLastUs), static_cast<unsigned int>(stats.responseMinUs),
+    static_cast<unsigned int>(stats.responseAvgUs), static_cast<unsigned int>(stats.responseMaxUs));
+  for (std::size_t i = 0; i < commstats::HISTOGRAM_BINS; ++i)
+  {
+    payload.appendf(i == 0 ? "%u" : ",%u", static_cast<unsigned int>(stats.histogram[i]));
+  }
+  payload.append("]}");
+}
+
+} // namespace mqttpayload
+
+#endif // MQTTPAYLOAD_HPP
@@ -10,6 +10,18 @@
 
 #define DEVICE_DISCONNECTED_C_U16 DEVICE_DISCONNECTED_C*100
 
+struct owSensorStatistics_s
+{
+  uint8_t  resolution;   // Auflösung [bit]
+  uint32_t intervalMs;   // Messintervall [ms]
+  uint32_t reads;        // Erfolgreiche Messungen
+  uint32_t crcErrors;    // Scratchpad mit CRC-Fehler
+  uint32_t noResponse;   // Sensor hat nicht geantwortet
+  uint32_t retries;      // Wiederholungen im nächsten Durchlauf
+  uint32_t failures;     // Auch nach allen Wiederholungen nicht lesbar
+  bool     failed;       // Letzte Messung fehlgeschlagen
+};
+
 uint8_t getSensorAdrFromParams();
 void    takeOwSensorAddress();
 void    owSetup();
@@ -17,6 +29,7 @@ void    owSetup();
 void    owCyclicRun();
 float   owGetTemp(uint8_t sensNr);
 uint8_t owGetAllSensorError();
+bool    owGetSensorStatistics(uint8_t sensNr, struct owSensorStatistics_s &stats);
 String  getSensorAdr();
 
 #endif
\ No newline at end of file
@@ -0,0 +1,288 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef OWSCHEDULER_HPP
+#define OWSCHEDULER_HPP
+
+#include <cstddef> // std::size_t
+#include <cstdint> // uint8_t, ...
+#include <utils/Crc.hpp>
+
+/**
+ * @file
+ * Non-blocking scheduling of the OneWire temperature conversions (DS18B20, DS1822, DS18S20).
+ *
+ * Each sensor has its own resolution and refresh interval. The scheduler starts one conversion for all due
+ * sensors, waits (without blocking) for the conversion time of the highest resolution of these sensors and
+ * then reads a limited number of sensors per run. A failed read is retried in the next round instead of
+ * blocking the task with inline retries. CRC errors, missing responses, retries and failures are counted
+ * per sensor.
+ *
+ * The bus is any class with the methods
+ * @code
+ *   void startConversion();                                        // Convert T for all sensors
+ *   owscheduler::ReadResult read(uint8_t nr, int16_t& tempC100);   // Read scratchpad of a sensor
+ *   void onTemperature(uint8_t nr, int16_t tempC100);              // Valid temperature of a sensor
+ * @endcode
+*/
+
+namespace owscheduler
+{
+
+constexpr uint8_t MIN_RESOLUTION {9};
+constexpr uint8_t MAX_RESOLUTION {12};
+
+constexpr uint8_t FAMILY_DS18S20 {0x10};
+
+enum class ReadResult : uint8_t
+{
+  OK,
+  CRC_ERROR,    //!< The sensor answered, but the scratchpad is corrupted
+  NO_RESPONSE   //!< No presence pulse or only 0x00/0xFF on the bus
+};
+
+/** @brief Limits the resolution to 9..12 bit */
+constexpr uint8_t clampResolution(uint8_t resolution)
+{
+  return resolution < MIN_RESOLUTION ? MIN_RESOLUTION : (resolution > MAX_RESOLUTION ? MAX_RESOLUTION : resolution);
+}
+
+/** @brief Max. conversion time in ms (12 bit: 750 ms, 11 bit: 375 ms, 10 bit: 187 ms, 9 bit: 93 ms) */
+constexpr uint16_t conversionTimeMs(uint8_t resolution)
+{
+  return static_cast<uint16_t>(750 >> (MAX_RESOLUTION - clampResolution(resolution)));
+}
+
+/** @brief Dallas/Maxim CRC8 (x^8 + x^5 + x^4 + 1) */
+inline uint8_t crc8(const uint8_t* data, std::size_t len)
+{
+  return utils::Crc8Maxim::compute(data, len);
+}
+
+/**
+ * @brief Checks the scratchpad (9 bytes) and converts the temperature.
+ * @param family First byte of the sensor address.
+ * @param tempC100 Receives the temperature in 0.01 °C, if the result is OK.
+*/
+inline ReadResult decodeScratchPad(uint8_t family, const uint8_t (&scratchPad)[9], int16_t& tempC100)
+{
+  bool allZero = true;
+  bool allOnes = true;
+  for (uint8_t b : scratchPad)
+  {
+    allZero &= (b == 0x00);
+    allOnes &= (b == 0xFF);
+  }
+  if (allZero || allOnes) return ReadResult::NO_RESPONSE;
+  if (crc8(scratchPad, 8) != scratchPad[8]) return ReadResult::CRC_ERROR;
+
+  const int16_t raw = static_cast<int16_t>((scratchPad[1] << 8) | scratchPad[0]);
+  int32_t temp16; // 1/16 °C
+  if (family == FAMILY_DS18S20)
+  {
+    // 0.5 °C resolution, extended with COUNT_REMAIN and COUNT_PER_C
+    const uint8_t countRemain = scratchPad[6];
+    const uint8_t countPerC = scratchPad[7];
+    temp16 = static_cast<int32_t>(raw & ~1) * 8;
+    if (countPerC != 0) temp16 += -4 + ((countPerC - countRemain) * 16) / countPerC;
+  }
+  else
+  {
+    // The undefined low bits depend on the resolution in the configuration register
+    const uint8_t resolution = static_cast<uint8_t>(MIN_RESOLUTION + ((scratchPad[4] >> 5) & 0x03));
+    temp16 = raw & ~((1 << (MAX_RESOLUTION - resolution)) - 1);
+  }
+  tempC100 = static_cast<int16_t>(temp16 * 100 / 16);
+  return ReadResult::OK;
+}
+
+/** Statistics of one sensor */
+struct SensorStatistics
+{
+  uint32_t reads;        //!< Successful reads
+  uint32_t crcErrors;
+  uint32_t noResponse;
+  uint32_t retries;      //!< Reads repeated in the next round
+  uint32_t failures;     //!< Reads, which failed after all retries
+};
+
+/**
+ * Schedules the conversions and reads of up to N sensors.
+*/
+template<std::size_t N>
+class Scheduler
+{
+  public:
+  static constexpr uint8_t MAX_RETRIES {2};
+
+  /**
+   * @param maxReadsPerRun Max. number of sensors read in one call of run() (about 10 ms per sensor)
+  */
+  explicit Scheduler(uint8_t maxReadsPerRun) : _maxReadsPerRun(maxReadsPerRun > 0 ? maxReadsPerRun : 1) {}
+
+  /** @brief Sets the configuration of a sensor. The sensor is due immediately. */
+  void configure(uint8_t nr, bool present, uint8_t resolution, uint32_t intervalMs)
+  {
+    if (nr >= N) return;
+    Sensor& sensor = _sensors[nr];
+    sensor.present = present;
+    sensor.resolution = clampResolution(resolution);
+    sensor.intervalMs = intervalMs;
+    sensor.due = present;
+    sensor.pending = false;
+    sensor.retries = 0;
+    sensor.failed = false;
+  }
+
+  /** @brief Aborts the current round (e.g. after the sensors were reconfigured) */
+  void reset()
+  {
+    _state = State::IDLE;
+    for (Sensor& sensor : _sensors) sensor.pending = false;
+  }
+
+  /**
+   * @brief Advances the scheduler. Never waits for a conversion.
+   * @return Number of sensors read in this call.
+  */
+  template<typename BUS>
+  uint8_t run(uint32_t nowMs, BUS& bus)
+  {
+    updateDue(nowMs);
+
+    if (_state == State::IDLE)
+    {
+      uint8_t maxResolution = 0;
+      for (Sensor& sensor : _sensors)
+      {
+        if (!sensor.present || !sensor.due) continue;
+        sensor.pending = true;
+        if (sensor.resolution > maxResolution) maxResolution = sensor.resolution;
+      }
+      if (maxResolution == 0) return 0;
+
+      bus.startConversion();
+      _conversions++;
+      _conversionStartMs = nowMs;
+      _conversionTimeMs = conversionTimeMs(maxResolution);
+      _readIndex = 0;
+      _state = State::CONVERTING;
+      return 0;
+    }
+
+    if (_state == State::CONVERTING)
+    {
+      if (static_cast<uint32_t>(nowMs - _conversionStartMs) < _conversionTimeMs) return 0;
+      _state = State::READING;
+    }
+
+    uint8_t reads = 0;
+    while (_readIndex < N && reads < _maxReadsPerRun)
+    {
+      const uint8_t nr = static_cast<uint8_t>(_readIndex++);
+      Sensor& sensor = _sensors[nr];
+      if (!sensor.pending) continue;
+      sensor.pending = false;
+      reads++;
+
+      int16_t tempC100 = 0;
+      const ReadResult result = bus.read(nr, tempC100);
+      if (result == ReadResult::OK)
+      {
+        sensor.stats.reads++;
+        sensor.retries = 0;
+        sensor.failed = false;
+        sensor.due = false;
+        sensor.lastReadMs = _conversionStartMs;
+        bus.onTemperature(nr, tempC100);
+        continue;
+      }
+
+      if (result == ReadResult::CRC_ERROR) sensor.stats.crcErrors++;
+      else sensor.stats.noResponse++;
+
+      if (sensor.retries < MAX_RETRIES)
+      {
+        // Stays due and is read again after the next conversion
+        sensor.retries++;
+        sensor.stats.retries++;
+      }
+      else
+      {
+        sensor.stats.failures++;
+        sensor.retries = 0;
+        sensor.failed = true;
+        sensor.due = false;
+        sensor.lastReadMs = _conversionStartMs;
+      }
+    }
+
+    while (_readIndex < N && !_sensors[_readIndex].pending) _readIndex++;
+    if (_readIndex >= N) _state = State::IDLE;
+    return reads;
+  }
+
+  /** @brief True, if the last round of reads was completed (no conversion or reads outstanding) */
+  bool idle() const { return _state == State::IDLE; }
+
+  /** @brief True, if the sensor could not be read after all retries */
+  bool failed(uint8_t nr) const { return nr < N && _sensors[nr].present && _sensors[nr].failed; }
+
+  /** @brief True, if at least one sensor could not be read after all retries */
+  bool anyFailed() const
+  {
+    for (const Sensor& sensor : _sensors)
+      if (sensor.present && sensor.failed) return true;
+    return false;
+  }
+
+  bool present(uint8_t nr) const { return nr < N && _sensors[nr].present; }
+  uint8_t resolution(uint8_t nr) const { return nr < N ? _sensors[nr].resolution : 0; }
+  uint32_t intervalMs(uint8_t nr) const { return nr < N ? _sensors[nr].intervalMs : 0; }
+  const SensorStatistics& statistics(uint8_t nr) const { return _sensors[nr < N ? nr : 0].stats; }
+  uint32_t conversions() const { return _conversions; }
+
+  private:
+  enum class State : uint8_t
+  {
+    IDLE,
+    CONVERTING,
+    READING
+  };
+
+  struct Sensor
+  {
+    bool present {false};
+    bool due {false};
+    bool pending {false};   //!< Will be read after the current conversion
+    bool failed {false};
+    uint8_t resolution {MAX_RESOLUTION};
+    uint8_t retries {0};
+    uint32_t intervalMs {0};
+    uint32_t lastReadMs {0};
+    SensorStatistics stats {};
+  };
+
+  void updateDue(uint32_t nowMs)
+  {
+    for (Sensor& sensor : _sensors)
+    {
+      if (sensor.present && !sensor.due && static_cast<uint32_t>(nowMs - sensor.lastReadMs) >= sensor.intervalMs)
+        sensor.due = true;
+    }
+  }
+
+  Sensor _sensors[N];
+  const uint8_t _maxReadsPerRun;
+  State _state {State::IDLE};
+  std::size_t _readIndex {0};
+  uint32_t _conversionStartMs {0};
+  uint16_t _conversionTimeMs {0};
+  uint32_t _conversions {0};
+};
+
+} // namespace owscheduler
+
+#endif // OWSCHEDULER_HPP
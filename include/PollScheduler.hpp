@@ -0,0 +1,258 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef POLLSCHEDULER_HPP
+#define POLLSCHEDULER_HPP
+
+#include <cstddef> // std::size_t
+#include <cstdint> // uint8_t, ...
+
+/**
+ * @file
+ * Adaptive poll interval of the BMS (serial and bluetooth).
+ *
+ * Each device has its own poll interval between Config::minIntervalMs and Config::maxIntervalMs. After every
+ * successful poll the rate of change of the current and of the min./max. cell voltage since the previous poll
+ * is compared with the thresholds of the configuration:
+ *  - Busy (a threshold is reached): the interval is halved
+ *  - Quiet (both rates below a quarter of the thresholds): the interval grows by 25 %
+ *  - Otherwise the interval is kept
+ *
+ * All devices of a scheduler share one bus (e.g. a group of serial ports), so the polls are limited to
+ * Config::budgetPermille of the time of the bus: A device can only shorten its interval as far as the time of
+ * the bus left by the other devices allows. The time saved on quiet packs is therefore available to busy packs.
+ *
+ * @code
+ *  if (scheduler.due(nr, millis()))
+ *  {
+ *    const uint32_t startMs = millis();
+ *    const bool ok = readBms(nr);
+ *    scheduler.polled(nr, millis(), millis() - startMs, ok, sample);
+ *  }
+ *  vTaskDelay(pdMS_TO_TICKS(scheduler.nextDueMs(millis())));
+ * @endcode
+*/
+
+namespace pollscheduler
+{
+
+/** Interval of a device after it was enabled (the fixed cycle before the interval was adaptive) */
+constexpr uint32_t START_INTERVAL_MS {1000};
+
+struct Config
+{
+  uint32_t minIntervalMs {500};
+  uint32_t maxIntervalMs {3000};
+  uint16_t busyCurrentRate {100};  //!< Rate of change of the current in 10 mA/s, from which a pack is busy
+  uint16_t busyVoltageRate {2};    //!< Rate of change of the min./max. cell voltage in mV/s, from which a pack is busy
+  uint16_t budgetPermille {800};   //!< Max. share of the time of the bus used by the polls of all devices
+};
+
+/** Values of a pack after a poll */
+struct Sample
+{
+  int16_t current;          //!< Total current in 10 mA
+  uint16_t minCellVoltage;  //!< mV
+  uint16_t maxCellVoltage;  //!< mV
+};
+
+enum class Activity : uint8_t
+{
+  UNKNOWN,  //!< Not enough samples yet
+  QUIET,
+  NORMAL,
+  BUSY
+};
+
+constexpr const char* activityName(Activity activity)
+{
+  return activity == Activity::QUIET ? "quiet" : activity == Activity::NORMAL ? "normal" :
+    activity == Activity::BUSY ? "busy" : "unknown";
+}
+
+/** State of one device */
+struct DeviceStatistics
+{
+  bool enabled;
+  uint32_t intervalMs;   //!< Active poll interval
+  uint32_t durationMs;   //!< Average duration of a poll
+  Activity activity;     //!< Result of the last successful poll
+  uint32_t polls;
+};
+
+/**
+ * Poll intervals of up to N devices on one bus.
+*/
+template<std::size_t N>
+class Scheduler
+{
+  public:
+  explicit Scheduler(const Config& config = Config()) { setConfig(config); }
+
+  /** @brief Sets the bounds and thresholds; the intervals are limited to the new bounds */
+  void setConfig(const Config& config)
+  {
+    _config = config;
+    if (_config.minIntervalMs == 0) _config.minIntervalMs = 1;
+    if (_config.maxIntervalMs < _config.minIntervalMs) _config.maxIntervalMs = _config.minIntervalMs;
+    for (Device& device : _devices) device.intervalMs = clampInterval(device.intervalMs);
+  }
+
+  const Config& config() const { return _config; }
+
+  /** @brief Enables a device (it is due immediately) or disables it. Enabling an enabled device has no effect. */
+  void enable(uint8_t nr, bool enabled)
+  {
+    if (nr >= N || _devices[nr].enabled == enabled) return;
+    Device& device = _devices[nr];
+    device = Device();
+    device.enabled = enabled;
+    device.intervalMs = clampInterval(START_INTERVAL_MS);
+  }
+
+  /** @brief True, if the device has to be polled now */
+  bool due(uint8_t nr, uint32_t nowMs) const
+  {
+    if (nr >= N || !_devices[nr].enabled) return false;
+    const Device& device = _devices[nr];
+    return !device.started || static_cast<uint32_t>(nowMs - device.lastPollMs) >= device.intervalMs;
+  }
+
+  /**
+   * @brief Records a poll and adapts the interval of the device.
+   * @param durationMs Time the bus was used by the poll
+   * @param ok False, if the poll failed; the interval is kept and the sample is ignored
+  */
+  void polled(uint8_t nr, uint32_t nowMs, uint32_t durationMs, bool ok, const Sample& sample)
+  {
+    if (nr >= N || !_devices[nr].enabled) return;
+    Device& device = _devices[nr];
+
+    device.durationMs = device.started ? (device.durationMs * 3 + durationMs) / 4 : durationMs;
+    device.started = true;
+    device.lastPollMs = nowMs;
+    device.polls++;
+    if (!ok) return;
+
+    uint32_t intervalMs = device.intervalMs;
+    if (device.hasSample)
+    {
+      device.activity = classify(device.sample, sample, nowMs - device.sampleMs);
+      if (device.activity == Activity::BUSY) intervalMs /= 2;
+      else if (device.activity == Activity::QUIET) intervalMs += intervalMs / 4 + 1;
+    }
+    device.sample = sample;
+    device.sampleMs = nowMs;
+    device.hasSample = true;
+
+    // The budget of the bus has priority over the activity
+    const uint32_t minAllowedMs = minIntervalByBudget(nr);
+    if (intervalMs < minAllowedMs) intervalMs = minAllowedMs;
+    device.intervalMs = clampInterval(intervalMs);
+  }
+
+  /** @brief Time until the next device is due (0 = now); maxIntervalMs, if no device is enabled */
+  uint32_t nextDueMs(uint32_t nowMs) const
+  {
+    uint32_t nextMs = _config.maxIntervalMs;
+    for (const Device& device : _devices)
+    {
+      if (!device.enabled) continue;
+      if (!device.started) return 0;
+      const uint32_t elapsedMs = nowMs - device.lastPollMs;
+      if (elapsedMs >= device.intervalMs) return 0;
+      if (device.intervalMs - elapsedMs < nextMs) nextMs = device.intervalMs - elapsedMs;
+    }
+    return nextMs;
+  }
+
+  /** @brief Active interval of a device; 0, if it is not enabled */
+  uint32_t intervalMs(uint8_t nr) const
+  {
+    if (nr >= N || !_devices[nr].enabled) return 0;
+    return _devices[nr].intervalMs;
+  }
+
+  /** @brief Share of the time of the bus used by the polls of all devices with their current intervals */
+  uint32_t loadPermille() const
+  {
+    uint32_t load = 0;
+    for (const Device& device : _devices)
+    {
+      if (device.enabled) load += device.durationMs * 1000 / device.intervalMs;
+    }
+    return load;
+  }
+
+  DeviceStatistics statistics(uint8_t nr) const
+  {
+    if (nr >= N) return DeviceStatistics {};
+    const Device& device = _devices[nr];
+    return DeviceStatistics {device.enabled, intervalMs(nr), device.durationMs, device.activity, device.polls};
+  }
+
+  private:
+  struct Device
+  {
+    bool enabled {false};
+    bool started {false};    //!< Polled at least once
+    bool hasSample {false};
+    Activity activity {Activity::UNKNOWN};
+    uint32_t intervalMs {START_INTERVAL_MS};
+    uint32_t durationMs {0};
+    uint32_t lastPollMs {0};
+    uint32_t sampleMs {0};
+    uint32_t polls {0};
+    Sample sample {};
+  };
+
+  static uint32_t absDiff(int32_t a, int32_t b) { return static_cast<uint32_t>(a > b ? a - b : b - a); }
+
+  Activity classify(const Sample& last, const Sample& now, uint32_t elapsedMs) const
+  {
+    if (elapsedMs == 0) return Activity::NORMAL;
+
+    // Rates per second; scaled by 4 to compare with a quarter of the thresholds without losing the remainder
+    const uint32_t currentRate4 = absDiff(now.current, last.current) * 4000 / elapsedMs;
+    uint32_t voltageDiff = absDiff(now.minCellVoltage, last.minCellVoltage);
+    const uint32_t maxDiff = absDiff(now.maxCellVoltage, last.maxCellVoltage);
+    if (maxDiff > voltageDiff) voltageDiff = maxDiff;
+    const uint32_t voltageRate4 = voltageDiff * 4000 / elapsedMs;
+
+    if (currentRate4 >= 4u * _config.busyCurrentRate || voltageRate4 >= 4u * _config.busyVoltageRate) return Activity::BUSY;
+    if (currentRate4 < _config.busyCurrentRate && voltageRate4 < _config.busyVoltageRate) return Activity::QUIET;
+    return Activity::NORMAL;
+  }
+
+  /** @brief Shortest interval of the device, which keeps the load of all devices within the budget */
+  uint32_t minIntervalByBudget(uint8_t nr) const
+  {
+    const Device& device = _devices[nr];
+    if (device.durationMs == 0) return 0;
+
+    uint32_t othersPermille = 0;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      if (i == nr || !_devices[i].enabled) continue;
+      othersPermille += _devices[i].durationMs * 1000 / _devices[i].intervalMs;
+    }
+    if (othersPermille >= _config.budgetPermille) return _config.maxIntervalMs;
+    return device.durationMs * 1000 / (_config.budgetPermille - othersPermille);
+  }
+
+  uint32_t clampInterval(uint32_t intervalMs) const
+  {
+    if (intervalMs < _config.minIntervalMs) return _config.minIntervalMs;
+    if (intervalMs > _config.maxIntervalMs) return _config.maxIntervalMs;
+    return intervalMs;
+  }
+
+  Config _config;
+  Device _devices[N];
+};
+
+} // namespace pollscheduler
+
+#endif // POLLSCHEDULER_HPP
@@ -0,0 +1,135 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef RESTAPIJSON_H
+#define RESTAPIJSON_H
+
+#include <cstdint>
+#include "BmsDataTypes.hpp"
+#include "PollScheduler.hpp"
+#include "CommStats.hpp"
+
+/**
+ * @file
+ * This header provides the parts of the REST API document (see buildJsonRest()), which only depend on
+ * the BMS data. They are written with a utils::JsonWriter and can therefore be tested on the host.
+*/
+
+namespace restapi
+{
+
+/** Marks, that the cycle time is not part of the BMS entry (bms_bt) */
+constexpr int32_t NO_CYCLE_TIME {-1};
+
+/**
+ * @brief Writes one entry of the arrays bms_bt and bms_serial.
+ * @param json The JSON writer. The entry is written as array element.
+ * @param snapshot The BMS data.
+ * @param enabled True, if the BMS is configured.
+ * @param valid True, if the data is not older than 5s.
+ * @param nr Number of the BMS within the array.
+ * @param cycleTime Cycle time of the serial BMS in ms, or NO_CYCLE_TIME.
+ * @param nrOfCells Number of cells to be written (ID_PARAM_SERIAL_NUMBER_OF_CELLS).
+ * @param invalidCellAsZero If true, invalid cell voltages (0xFFFF) are written as 0.
+*/
+template<typename WRITER>
+void writeBmsEntry(WRITER& json, const BmsDataSnapshot& snapshot, bool enabled, bool valid, uint8_t nr,
+  int32_t cycleTime, uint8_t nrOfCells, bool invalidCellAsZero)
+{
+  if (nrOfCells > BMSDATA_MAX_CELLS) nrOfCells = BMSDATA_MAX_CELLS;
+
+  json.beginObject();
+  json.add("en", static_cast<uint8_t>(enabled));
+  json.add("valid", static_cast<uint8_t>(valid));
+  json.add("nr", nr);
+  if (cycleTime != NO_CYCLE_TIME) json.add("cycleTime", cycleTime);
+  json.add("cells", nrOfCells);
+
+  json.add("totalVolt", snapshot.getTotalVoltage());
+  json.add("totalCurr", snapshot.getTotalCurrent());
+  json.add("soc", snapshot.chargePercentage);
+  json.add("maxZellDiff", snapshot.maxCellDifferenceVoltage);
+  json.add("maxCellVolt", snapshot.maxCellVoltage);
+  json.add("minCellVolt", snapshot.minCellVoltage);
+  json.add("maxCellVoltNr", snapshot.maxVoltageCellNumber);
+  json.add("minCellVoltNr", snapshot.minVoltageCellNumber);
+  json.add("balOn", snapshot.isBalancingActive);
+  json.add("FetState", snapshot.stateFETs);
+  json.add("bmsErr", snapshot.errors);
+
+  json.beginArray("cell_voltage");
+  for (uint8_t i = 0; i < nrOfCells; ++i)
+  {
+    uint16_t cellVoltage = snapshot.cellVoltage[i];
+    if (invalidCellAsZero && cellVoltage == 0xFFFF) cellVoltage = 0;
+    json.value(cellVoltage);
+  }
+  json.endArray();
+
+  // The temperatures are written as integer values (°C), as before
+  json.beginArray("temperature");
+  for (std::size_t i = 0; i < BMSDATA_MAX_TEMPERATURES; ++i)
+  {
+    json.value(static_cast<int32_t>(snapshot.getTempature(i)));
+  }
+  json.endArray();
+
+  json.endObject();
+}
+
+/**
+ * @brief Writes one entry of the arrays poll.bt and poll.serial; devices, which are not polled, are skipped.
+ * @param json The JSON writer. The entry is written as array element.
+ * @param nr Number of the BMS within the array.
+ * @param stats State of the poll interval of the BMS.
+*/
+template<typename WRITER>
+void writePollEntry(WRITER& json, uint8_t nr, const pollscheduler::DeviceStatistics& stats)
+{
+  if (!stats.enabled) return;
+
+  json.beginObject();
+  json.add("nr", nr);
+  json.add("interval_ms", stats.intervalMs);
+  json.add("duration_ms", stats.durationMs);
+  json.add("activity", pollscheduler::activityName(stats.activity));
+  json.add("polls", stats.polls);
+  json.endObject();
+}
+
+/**
+ * @brief Writes one entry of the array comm; sources without any traffic are skipped.
+ * @param json The JSON writer. The entry is written as array element.
+ * @param source Kind of the source; a serial BMS can also be read via CAN (JK-BMS).
+ * @param nr Number of the BMS within the arrays bms_bt or bms_serial.
+ * @param stats Communication statistics of the BMS.
+*/
+template<typename WRITER>
+void writeCommEntry(WRITER& json, commstats::Source source, uint8_t nr, const commstats::Statistics& stats)
+{
+  if (!commstats::hasTraffic(stats)) return;
+
+  json.beginObject();
+  json.add("src", commstats::sourceName(source));
+  json.add("nr", nr);
+  json.add("requests", stats.requests);
+  json.add("responses", stats.responses);
+  json.add("timeouts", stats.timeouts);
+  json.add("checksum_errors", stats.checksumErrors);
+  json.add("resyncs", stats.resyncs);
+  json.add("plausibility_trips", stats.plausibilityTrips);
+  json.add("rt_last_us", stats.responseLastUs);
+  json.add("rt_min_us", stats.responseMinUs);
+  json.add("rt_avg_us", stats.responseAvgUs);
+  json.add("rt_max_us", stats.responseMaxUs);
+  json.beginArray("histogram");
+  for (std::size_t i = 0; i < commstats::HISTOGRAM_BINS; ++i) json.value(stats.histogram[i]);
+  json.endArray();
+  json.endObject();
+}
+
+} // namespace restapi
+
+#endif // RESTAPIJSON_H
@@ -0,0 +1,50 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef SERIALRX_H
+#define SERIALRX_H
+
+#include <Arduino.h>
+#include "defines.h"
+#include "utils/FrameDecoder.hpp"
+#include "CommStats.hpp"
+
+/* Empfang der seriellen BMS-Treiber
+ *
+ * Statt available()/read() Byte für Byte mit vTaskDelay(1/10ms) abzufragen, warten die Treiber auf ein
+ * RX-Event der UART (HardwareSerial::onReceive, ausgelöst durch das RX-Timeout oder einen vollen FIFO).
+ * Anschließend werden alle vorhandenen Bytes in einem Stück in den Puffer des Ports gelesen und von dort
+ * an den Treiber übergeben.
+ * Ports ohne RX-Event (SoftwareSerial) werden weiterhin im 1ms Raster abgefragt, aber ebenfalls blockweise gelesen.
+ *
+ * Die Frames der Antworten werden mit einem utils::FrameDecoder gesucht (serialRxReadFrame). Dieser findet nach
+ * Störungen auf der Leitung wieder den Anfang des nächsten Frames, ohne ihn zu verlieren.
+ *
+ * Zusätzlich wird je serieller Schnittstelle die Qualität der Kommunikation aufgezeichnet (commstats::Recorder):
+ * Anfragen, Antworten mit der Antwortzeit (Ende der Anfrage bis zum letzten Byte der Antwort), Timeouts,
+ * Checksummenfehler, Resyncs und die Auslösungen der Plausibilitätsprüfung. */
+
+#define SERIAL_RX_PORT_COUNT        4   // Serial, Serial1, Serial2, SoftwareSerial
+#define SERIAL_RX_BUFFER_SIZE     128   // Puffer je Port (Größe des UART FIFO)
+#define SERIAL_RX_TIMEOUT_SYMBOLS   2   // RX-Timeout der UART in Zeichen, nach dem das Event ausgelöst wird
+
+void serialRxInit();
+bool serialRxRegisterPort(Stream *port, bool bo_lEvents);
+void serialRxNotify(Stream *port);
+
+int16_t serialRxReadByte(Stream *port, uint32_t u32_lStartUs, uint32_t u32_lTimeoutMs);
+void serialRxClear(Stream *port);
+utils::FrameDecoder::Status serialRxReadFrame(Stream *port, uint8_t u8_devNr, utils::FrameDecoder &decoder,
+  uint32_t u32_lStartUs, uint32_t u32_lTimeoutMs, uint32_t u32_lFrameTimeoutMs=0);
+
+void serialRxRecordRequest(uint8_t u8_devNr);
+void serialRxRecordResponse(uint8_t u8_devNr, uint32_t u32_lStartUs);
+void serialRxRecordTimeout(uint8_t u8_devNr);
+void serialRxRecordChecksumError(uint8_t u8_devNr);
+void serialRxRecordDecoder(uint8_t u8_devNr, const utils::FrameDecoderStatistics &decoderStats);
+void serialRxRecordPlausibilityTrip(uint8_t u8_devNr);
+void serialRxGetCommStatistics(uint8_t u8_devNr, commstats::Statistics &stats);
+
+#endif
@@ -0,0 +1,129 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef SETTINGSVIEW_H
+#define SETTINGSVIEW_H
+
+#include <Arduino.h>
+#include "defines.h"
+#include "AlarmRuleEngine.hpp"
+
+/* Vorkompilierte, unveränderliche Sicht auf die Parameter, die in den zyklischen Tasks benötigt werden.
+ * Die Sicht wird beim Speichern der Parameter neu aufgebaut und per atomarem Pointertausch veröffentlicht.
+ * Die Tasks lesen damit einfache Felder, statt bei jedem Zugriff den Parameter-Mutex und die Hashmap zu nutzen.
+ *
+ * Nutzung: Sicht einmal pro Zyklus mit einer lokalen SettingsViewRef halten und nicht über den Zyklus hinaus speichern.
+ * Solange die Referenz besteht, wird der Puffer bei einem Neuaufbau nicht überschrieben. */
+
+// Alarmregeln: BMS (je 3), Temperatur, SoC, Digitaleingänge, Onewire Sensorfehler, Plausibilität
+#define SETTINGS_VIEW_MAX_ALARM_RULES (CNT_BT_ALARMS_RULES*3 + COUNT_TEMP_RULES + ANZAHL_RULES_TRIGGER_SOC + CNT_DIGITALIN + 2)
+
+struct settingsView_s
+{
+  // Geräte
+  bool     btDeviceConfigured[BT_DEVICES_COUNT];          // ID_PARAM_SS_BTDEV>0 und ID_PARAM_SS_BTDEVMAC gesetzt
+  uint8_t  serialConnectDevice[SERIAL_BMS_DEVICES_COUNT];  // ID_PARAM_SERIAL_CONNECT_DEVICE
+  uint8_t  serial2NumberOfBms;                             // ID_PARAM_SERIAL2_CONNECT_TO_ID
+
+  // Pollintervall der BMS (Serial und Bluetooth)
+  uint16_t bmsPollIntervalMin;                             // ID_PARAM_BMS_POLL_INTERVAL_MIN [ms]
+  uint16_t bmsPollIntervalMax;                             // ID_PARAM_BMS_POLL_INTERVAL_MAX [ms]
+
+  // Plausibilitätsprüfung der Zellspannungen
+  uint8_t  plausibilityCheckCellVoltage;                   // ID_PARAM_BMS_PLAUSIBILITY_CHECK_CELLVOLTAGE (0=aus)
+
+  // Display
+  bool     displayBulkData;                                // ID_PARAM_DISPLAY_BULK_DATA
+
+  // Alarmregeln; nur die aktiven Regeln, siehe AlarmRuleEngine.hpp
+  alarmrules::RuleTable<SETTINGS_VIEW_MAX_ALARM_RULES> alarmRules;
+
+  // CAN
+  bool     canEnable;                                      // ID_PARAM_BMS_CAN_ENABLE
+  bool     canExtendedDataEnable;                          // ID_PARAM_BMS_CAN_EXTENDED_DATA_ENABLE
+  uint8_t  canExtendedDataFrames;                          // ID_PARAM_BMS_CAN_EXTENDED_DATA_FRAMES (0=ein BMS pro Zyklus)
+  uint8_t  canBmsDatasource;                               // ID_PARAM_BMS_CAN_DATASOURCE
+
+  // Ladestrom reduzieren: Zellspannung
+  bool     chargeCellVoltageEn;                            // ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_EN
+  uint16_t chargeCellVoltageStart;                         // ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_STARTSPG [mV]
+  uint16_t chargeCellVoltageEnd;                           // ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_ENDSPG [mV]
+  uint8_t  chargeCellVoltageMinCurrent;                    // ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_MINDEST_STROM [A]
+
+  // Ladestrom reduzieren: Zelldrift
+  bool     chargeCellDriftEn;                              // ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLDRIFT_EN
+  uint8_t  chargeCellDriftStart;                           // ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_STARTABWEICHUNG [mV]
+  uint16_t chargeCellDriftStartCellVoltage;                // ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_STARTSPG_ZELLE [mV]
+  uint8_t  chargeCellDriftAPerMv;                          // ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_A_PRO_MV
+
+  // Ladestrom reduzieren: SoC
+  bool     chargeSocEn;                                    // ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_SOC_EN
+  uint8_t  chargeSocStart;                                 // ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_AB_SOC [%]
+  uint8_t  chargeSocAPerPercent;                           // ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_A_PRO_PERCENT_SOC
+
+  // Entladestrom reduzieren: Zellspannung
+  uint16_t dischargeCellVoltageStart;                      // ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_STARTSPG [mV]
+  uint16_t dischargeCellVoltageEnd;                        // ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_ENDSPG [mV]
+  uint8_t  dischargeCellVoltageMinCurrent;                 // ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_MINDEST_STROM [A]
+
+  // Ladespannung, maximaler Lade-/Entladestrom
+  float    maxChargeVoltage;                               // ID_PARAM_BMS_MAX_CHARGE_SPG [V]
+  uint16_t maxChargeCurrent;                               // ID_PARAM_BMS_MAX_CHARGE_CURRENT [A]
+  uint16_t maxDischargeCurrent;                            // ID_PARAM_BMS_MAX_DISCHARGE_CURRENT [A]
+
+  // Maximaler Lade-/Entladestrom pro Pack
+  uint16_t packChargeCurrent[SERIAL_BMS_DEVICES_COUNT];    // ID_PARAM_BATTERY_PACK_CHARGE_CURRENT [A]
+  uint16_t packDischargeCurrent[SERIAL_BMS_DEVICES_COUNT]; // ID_PARAM_BATTERY_PACK_DISCHARGE_CURRENT [A]
+
+  // SoC bei Unterschreiten einer Zellspannung
+  bool     socBelowCellVoltageEn;                          // ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_EN
+  uint16_t socBelowCellVoltage;                            // ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG [mV]
+  uint16_t socBelowCellVoltageEnd;                         // ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG_END [mV] (0=Startspannung)
+  uint16_t socBelowCellVoltageTime;                        // ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_TIME [s]
+  uint8_t  socBelowCellVoltageSoc;                         // ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SOC [%]
+
+  // Ladestrom Cut-Off
+  uint16_t chargeCutOffTime;                               // ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_TIME [s]
+  float    chargeCutOffCurrent;                            // ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_CURRENT [A]
+  uint8_t  chargeCutOffSoc;                                // ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_SOC [%]
+
+  // Dynamische Ladespannungsreduzierung
+  bool     chargeVoltageDynamicEn;                         // ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_EN
+  uint16_t chargeVoltageDynamicCellVoltage;                // ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_ZELLSPG [mV]
+  uint8_t  chargeVoltageDynamicDelta;                      // ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_DELTA [mV]
+
+  // Onewire
+  float    owTempOffset[MAX_ANZAHL_OW_SENSOREN];           // ID_PARAM_ONWIRE_TEMP_OFFSET [°C]
+  uint8_t  owResolution[MAX_ANZAHL_OW_SENSOREN];           // ID_PARAM_ONWIRE_RESOLUTION [bit]
+  uint16_t owRefreshInterval[MAX_ANZAHL_OW_SENSOREN];      // ID_PARAM_ONWIRE_REFRESH_INTERVAL [s]
+
+  // Aufzeichnung
+  bool     recordValuesEn;                                 // ID_PARAM_SYSTEM_RECORD_VALUES_PERIODE>0
+  uint16_t recordValuesTierPeriod[VALUE_LOG_TIERS];        // ID_PARAM_SYSTEM_RECORD_VALUES_TIER0..2_PERIODE [s]
+};
+
+void settingsViewRebuild();
+const settingsView_s* settingsViewAcquire();
+void settingsViewRelease(const settingsView_s *p_view);
+uint32_t getSettingsViewGeneration();
+
+/* Hält die aktuelle Sicht für die Lebensdauer des Objekts (z.B. SettingsViewRef()->canEnable) */
+class SettingsViewRef
+{
+public:
+  SettingsViewRef() : p_mView(settingsViewAcquire()) {}
+  ~SettingsViewRef() { settingsViewRelease(p_mView); }
+  SettingsViewRef(const SettingsViewRef&) = delete;
+  SettingsViewRef& operator=(const SettingsViewRef&) = delete;
+
+  const settingsView_s* operator->() const { return p_mView; }
+  const settingsView_s& operator*() const { return *p_mView; }
+  const settingsView_s* get() const { return p_mView; }
+
+private:
+  const settingsView_s *p_mView;
+};
+
+#endif
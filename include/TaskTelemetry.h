@@ -0,0 +1,46 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef TASKTELEMETRY_H
+#define TASKTELEMETRY_H
+
+#include <Arduino.h>
+#include <utils/TaskMonitor.hpp>
+
+/* Laufzeitdaten der Tasks: Dauer der Zyklen (Histogramm, min/avg/max), Jitter der Periode, CPU-Anteil und
+ * freier Stack (High-Water-Mark). Jeder Task misst nur die Arbeit eines Zyklus (ohne vTaskDelay) mit
+ * taskTelemetryBegin()/taskTelemetryEnd(); siehe utils/TaskMonitor.hpp.
+ * Der CPU-Anteil ist die gemessene Zeit pro Zeitfenster (utils::TaskMonitor::DEFAULT_WINDOW_US, inkl. Unterbrechungen
+ * durch höher priorisierte Tasks). */
+
+enum taskTelemetryId_e
+{
+  TASK_ID_LOOP,
+  TASK_ID_BLE,
+  TASK_ID_ALARMRULES,
+  TASK_ID_ONEWIRE,
+  TASK_ID_CANBUS_TX,
+  TASK_ID_CANBUS_RX,     // Nur Stack (wartet blockierend auf Frames)
+  TASK_ID_SERIAL,        // + Gruppe der seriellen Schnittstellen
+  TASK_ID_I2C = TASK_ID_SERIAL+3,
+  TASK_ID_WIFICONN,
+  TASK_TELEMETRY_COUNT
+};
+
+struct taskStatistics_s
+{
+  const char *name;           // Name des Tasks (FreeRTOS)
+  uint32_t stackFree;         // Minimal freier Stack seit dem Start [Byte]
+  bool     measured;          // Zyklen werden gemessen
+  utils::TaskStatistics runtime;
+};
+
+void taskTelemetryInit();
+void taskTelemetryRegister(uint8_t taskId);
+void taskTelemetryBegin(uint8_t taskId);
+void taskTelemetryEnd(uint8_t taskId);
+bool taskTelemetryGetStatistics(uint8_t taskId, struct taskStatistics_s &stats);
+
+#endif
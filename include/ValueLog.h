@@ -0,0 +1,72 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef VALUELOG_H
+#define VALUELOG_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+#include "defines.h"
+
+/* Aufzeichnung der Werte (Inverter, BMS, Temperatur) in Ringspeicher-Dateien im Dateisystem.
+ * Pro Stufe (10 Minuten, 24 Stunden, 7 Tage) eine Datei mit festen Datensätzen (min/max/avg pro Kanal), siehe utils/TimeSeries.hpp.
+ * Das Intervall jeder Stufe ist einstellbar (ID_PARAM_SYSTEM_RECORD_VALUES_TIER0..2_PERIODE); die Anzahl der Datensätze
+ * ergibt sich aus der Dauer der Stufe. Bei einer Änderung des Intervalls wird die Datei der Stufe neu angelegt.
+ *
+ * Abruf: /valueslog?tier=<0..2>&from=<epoch>&to=<epoch>&max=<Anzahl>
+ * Antwort (application/octet-stream, little endian):
+ *   uint16 version, uint16 Anzahl Kanäle, uint16 Größe eines Datensatzes, uint16 Periode [s],
+ *   pro Kanal: uint8 Wert (valueLogValue_e), uint8 Index (BMS-Nr. bzw. Onewire Sensor),
+ *   danach die Datensätze: uint32 time, int16 min[Kanäle], int16 max[Kanäle], int16 avg[Kanäle]
+ *
+ * Die Dateien werden erst angelegt, wenn die Aufzeichnung aktiviert ist (ID_PARAM_SYSTEM_RECORD_VALUES_PERIODE).
+ * Die Datei des bisherigen Formats ist unter /valueslog_legacy abrufbar, bis die Stufe 24 Stunden einen ganzen Tag enthält. */
+
+#define VALUE_LOG_VERSION        2    // Version der Antwort und der Kanaltabelle
+#define VALUE_LOG_CHANNELS      15
+#define VALUE_LOG_BMS_DATASOURCE 0xFF // Index der BMS-Kanäle: BMS der CAN Datenquelle (ID_PARAM_BMS_CAN_DATASOURCE)
+
+/* Werte, die aufgezeichnet werden können */
+enum valueLogValue_e : uint8_t
+{
+  VALUE_LOG_INVERTER_CURRENT,              // inverterData_s
+  VALUE_LOG_INVERTER_VOLTAGE,
+  VALUE_LOG_INVERTER_SOC,
+  VALUE_LOG_INVERTER_CHARGE_CURRENT,
+  VALUE_LOG_INVERTER_DISCHARGE_CURRENT,
+  VALUE_LOG_CALC_CHARGE_CURRENT_CELLVOLTAGE,
+  VALUE_LOG_CALC_CHARGE_CURRENT_SOC,
+  VALUE_LOG_CALC_CHARGE_CURRENT_CELLDRIFT,
+  VALUE_LOG_CALC_CHARGE_CURRENT_CUTOFF,
+  VALUE_LOG_BMS_TOTAL_VOLTAGE,             // [10mV]
+  VALUE_LOG_BMS_TOTAL_CURRENT,             // [10mA]
+  VALUE_LOG_BMS_SOC,                       // [%]
+  VALUE_LOG_BMS_MAX_CELL_VOLTAGE,          // [mV]
+  VALUE_LOG_BMS_MIN_CELL_VOLTAGE,          // [mV]
+  VALUE_LOG_OW_TEMPERATURE                 // [0.1°C]
+};
+
+struct valueLogChannel_s
+{
+  valueLogValue_e value;
+  uint8_t         index;                   // BMS-Nr. (VALUE_LOG_BMS_DATASOURCE) bzw. Onewire Sensor
+};
+
+struct valueLogStatistics_s
+{
+  uint32_t records[VALUE_LOG_TIERS];    // Anzahl gespeicherter Datensätze (inkl. RAM)
+  uint32_t writes[VALUE_LOG_TIERS];     // Anzahl Schreibzugriffe auf das Dateisystem
+  uint32_t bytesWritten[VALUE_LOG_TIERS];
+  uint32_t dropped[VALUE_LOG_TIERS];    // Verworfene Datensätze (Zeit nicht aufsteigend)
+};
+
+void valueLogInit();
+void valueLogCyclicRun();
+void valueLogFlush();
+void valueLogHandleRequest(WebServer * server);
+void valueLogHandleLegacyRequest(WebServer * server);
+void valueLogGetStatistics(struct valueLogStatistics_s &stats);
+
+#endif
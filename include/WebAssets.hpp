@@ -0,0 +1,153 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef WEBASSETS_HPP
+#define WEBASSETS_HPP
+
+#include <cstddef> // std::size_t
+#include <cstdint> // uint8_t, ...
+#include <cstdio>
+#include <cstring>
+
+/**
+ * @file
+ * Precompressed static web pages and the HTTP header logic to serve them.
+ *
+ * The pages of webpages.h are gzipped at build time by scripts/prebuild_webassets.py (webpages_gz.h). Each
+ * page gets a strong ETag, which is the hash of its content, so it changes with every firmware that changes
+ * the page. A browser revalidates the page with If-None-Match and gets a 304 without body, as long as the page
+ * is unchanged. Clients without gzip support get the uncompressed page.
+*/
+
+namespace webassets
+{
+
+struct Asset
+{
+  const uint8_t* gz;        //!< gzip compressed content (PROGMEM)
+  std::size_t gzLen;
+  const char* plain;        //!< Uncompressed content (PROGMEM) for clients without gzip
+  const char* contentType;
+  const char* etag;         //!< Strong ETag including the quotes
+};
+
+namespace detail
+{
+
+inline bool isSpace(char c) { return c == ' ' || c == '\t'; }
+
+/** @brief Trims spaces of the range [begin, end) */
+inline void trim(const char*& begin, const char*& end)
+{
+  while (begin < end && isSpace(*begin)) ++begin;
+  while (end > begin && isSpace(*(end - 1))) --end;
+}
+
+inline bool equalsIgnoreCase(const char* begin, const char* end, const char* text)
+{
+  const std::size_t len = std::strlen(text);
+  if (static_cast<std::size_t>(end - begin) != len) return false;
+  for (std::size_t i = 0; i < len; ++i)
+  {
+    char c = begin[i];
+    if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+    if (c != text[i]) return false;
+  }
+  return true;
+}
+
+/** @brief True, if the parameters of a coding ("gzip;q=0") set the quality to 0 */
+inline bool isQualityZero(const char* begin, const char* end)
+{
+  for (const char* p = begin; p < end; ++p)
+  {
+    if (*p != ';') continue;
+    const char* param = p + 1;
+    while (param < end && isSpace(*param)) ++param;
+    if (end - param < 2 || (param[0] != 'q' && param[0] != 'Q') || param[1] != '=') continue;
+
+    // q=0, q=0.0, q=0.00 or q=0.000
+    const char* value = param + 2;
+    const char* valueEnd = value;
+    while (valueEnd < end && *valueEnd != ';' && !isSpace(*valueEnd)) ++valueEnd;
+    if (value == valueEnd || *value != '0') return false;
+    for (const char* v = value + 1; v < valueEnd; ++v)
+    {
+      if (*v != '.' && *v != '0') return false;
+    }
+    return true;
+  }
+  return false;
+}
+
+} // namespace detail
+
+/** @brief True, if the Accept-Encoding header allows gzip (gzip, x-gzip or *, not with q=0) */
+inline bool acceptsGzip(const char* acceptEncoding)
+{
+  if (acceptEncoding == nullptr) return false;
+
+  const char* item = acceptEncoding;
+  while (*item != 0)
+  {
+    const char* itemEnd = item;
+    while (*itemEnd != 0 && *itemEnd != ',') ++itemEnd;
+
+    const char* coding = item;
+    const char* codingEnd = item;
+    while (codingEnd < itemEnd && *codingEnd != ';') ++codingEnd;
+    detail::trim(coding, codingEnd);
+
+    if (detail::equalsIgnoreCase(coding, codingEnd, "gzip") || detail::equalsIgnoreCase(coding, codingEnd, "x-gzip") ||
+        detail::equalsIgnoreCase(coding, codingEnd, "*"))
+    {
+      return !detail::isQualityZero(codingEnd, itemEnd);
+    }
+
+    item = (*itemEnd == ',') ? itemEnd + 1 : itemEnd;
+  }
+  return false;
+}
+
+/**
+ * @brief True, if the If-None-Match header contains the ETag (or "*"). As defined for If-None-Match, the
+ *        weak comparison is used, i.e. W/"x" matches "x".
+*/
+inline bool etagMatches(const char* ifNoneMatch, const char* etag)
+{
+  if (ifNoneMatch == nullptr || etag == nullptr || etag[0] == 0) return false;
+
+  const char* item = ifNoneMatch;
+  while (*item != 0)
+  {
+    const char* itemEnd = item;
+    while (*itemEnd != 0 && *itemEnd != ',') ++itemEnd;
+
+    const char* tag = item;
+    const char* tagEnd = itemEnd;
+    detail::trim(tag, tagEnd);
+    if (tagEnd - tag == 1 && *tag == '*') return true;
+    if (tagEnd - tag > 2 && tag[0] == 'W' && tag[1] == '/') tag += 2;
+
+    const std::size_t len = static_cast<std::size_t>(tagEnd - tag);
+    if (len == std::strlen(etag) && std::strncmp(tag, etag, len) == 0) return true;
+
+    item = (*itemEnd == ',') ? itemEnd + 1 : itemEnd;
+  }
+  return false;
+}
+
+/**
+ * @brief ETag of a file in the file system: size and time of the last change
+ * @param buf Buffer with at least 20 characters
+*/
+inline void fileEtag(char* buf, std::size_t bufSize, uint32_t size, uint32_t lastWrite)
+{
+  std::snprintf(buf, bufSize, "\"%lx-%lx\"", static_cast<unsigned long>(size), static_cast<unsigned long>(lastWrite));
+}
+
+} // namespace webassets
+
+#endif // WEBASSETS_HPP
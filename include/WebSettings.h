@@ -37,6 +37,55 @@
 
 #define BACKGROUND_COLOR "#ffffff"
 
+/* Index der Parameterseiten; wird beim Build von scripts/prebuild_parameter.py als params_idx.h erstellt.
+ * Strings werden nicht kopiert, sondern als Position und Länge im JSON der Seite abgelegt. */
+struct paramIdxStr_s
+{
+  uint16_t pos;             // 0 = nicht vorhanden
+  uint16_t len;
+};
+
+struct paramIdxEntry_s
+{
+  uint16_t name;
+  uint8_t  type;
+  uint8_t  dt;
+  uint8_t  flash;
+  uint8_t  groupsize;
+  uint8_t  labelOffset;
+  uint16_t depId;
+  uint8_t  depVal;
+  uint8_t  depDt;
+  int32_t  min;
+  int32_t  max;
+  uint16_t childFirst;      // Gruppen: Index des ersten Elements der Gruppe
+  uint16_t childCnt;        // Gruppen: Anzahl Elemente der Gruppe
+  uint16_t optionsFirst;    // Index in die Optionen
+  uint8_t  optionsCnt;
+  paramIdxStr_s label;
+  paramIdxStr_s labelEntry;
+  paramIdxStr_s help;
+  paramIdxStr_s def;
+  paramIdxStr_s unit;
+  paramIdxStr_s step;
+};
+
+struct paramIdxOption_s
+{
+  paramIdxStr_s v;
+  paramIdxStr_s l;
+  uint16_t d;               // Key der Beschreibung im Flash; 0 = keine
+};
+
+struct paramIdx_s
+{
+  const paramIdxEntry_s  *entries;
+  const paramIdxOption_s *options;
+  uint16_t entryCnt;
+  uint16_t pageCnt;         // Die ersten pageCnt Elemente sind die Elemente der Seite
+};
+
+
 #define BUTTON_SAVE  0
 #define BUTTON_1     1
 #define BUTTON_2     2
@@ -46,7 +95,7 @@
 class WebSettings {
 public:
   WebSettings();
-  void initWebSettings(const char *parameter, String confName, String configfile);
+  void initWebSettings(const char *parameter, const paramIdx_s &paramIdx, String confName, String configfile);
 
   //Parameterfile
   boolean deleteConfig();
@@ -80,6 +129,7 @@ public:
   void registerOnButton1(void (*callback)());
   void registerOnButton2(void (*callback)());
   void registerOnButton3(void (*callback)());
+  static void registerOnParameterChanged(void (*callback)());
 
   void setTimerHandlerName(String handlerName, uint16_t timerSec=1000);
   void handleHtmlFormRequest(WebServer * server);
@@ -88,11 +138,26 @@ public:
 
   void setParameter(uint16_t name, uint8_t group, String value, uint8_t u8_dataType);
 
-  static uint16_t getParmId(uint16_t id, uint8_t groupIdx);
+  static uint16_t getParmId(uint16_t id, uint8_t groupIdx) { return (id<<6) | (groupIdx&0x3F); }
   static void     getIdFromParamId(uint16_t paramId, uint16_t &id, uint8_t &groupIdx);
 
+  //Liest einen String des Index (siehe params_idx.h) aus dem JSON der Seite
+  static String getIdxString(const char *json, const paramIdxStr_s &str, const char *defaultValue)
+  {
+    if(str.pos==0) return defaultValue;
+
+    String retStr = "";
+    retStr.reserve(str.len);
+    for(uint16_t i=0; i<str.len; i++)
+    {
+      retStr += json[str.pos+i];
+    }
+    return retStr;
+  }
+
 private:
   const char *parameterFile;
+  const paramIdx_s *mParamIdx;
   String   str_mConfName;
   String   str_mConfigfile;
   uint8_t  u8_mJsonArraySize;
@@ -110,8 +175,8 @@ private:
   uint32_t copyFile(String fileSrc, String fileDst);
   uint32_t calcCrc(String fileSrc);
 
-  void getDefaultValuesFromNewKeys(const char *parameter, uint32_t jsonStartPos);
-  void buildSendHtml(WebServer * server, const char *parameter, uint32_t jsonStartPos);
+  void getDefaultValuesFromNewKeys(uint16_t u16_first, uint16_t u16_cnt);
+  void buildSendHtml(WebServer * server, uint16_t u16_first, uint16_t u16_cnt);
   void sendContentHtml(WebServer *server, const char *buf, bool send);
   //void readWebValues(WebServer * server, const String *parameter, uint32_t jsonStartPos);
 
@@ -119,32 +184,18 @@ private:
   void setString(uint16_t name, String value, uint8_t u8_dataType);
   void setInt(uint16_t name, int32_t value);
 
-  String   getJson_Key(const char *parameter, String key, uint8_t idx, uint32_t startPos, String defaultValue); //Universal über parameter key
-  uint8_t  getJsonSize(const char *parameter, uint8_t idx, uint32_t startPos);
-  uint8_t  getJsonGroupsize(const char *parameter, uint8_t idx, uint32_t startPos);
-  uint32_t getJsonName(const char *parameter, uint8_t idx, uint32_t startPos);
-  String   getJsonLabel(const char *parameter, uint8_t idx, uint32_t startPos);
-  String   getJsonLabelEntry(const char *parameter, uint8_t idx, uint32_t startPos);
-  String   getJsonHelp(const char *parameter, uint8_t idx, uint32_t startPos);
-  uint8_t  getJsonType(const char *parameter, uint8_t idx, uint32_t startPos);
-  String   getJsonDefault(const char *parameter, uint8_t idx, uint32_t startPos);
-  uint8_t  getJsonOptionsCnt(const char *parameter, uint8_t idx, uint32_t startPos);
-  uint32_t getJsonOptionsMin(const char *parameter, uint8_t idx, uint32_t startPos);
-  uint32_t getJsonOptionsMax(const char *parameter, uint8_t idx, uint32_t startPos);
-  std::vector<String> getJsonOptionValues(const char *parameter, uint8_t idx, uint32_t startPos);
-  std::vector<String> getJsonOptionLabels(const char *parameter, uint8_t idx, uint32_t startPos);
-  String   getJsonArrValue(const char *parameter, String str_key1, String str_key2, uint8_t u8_eCnt, uint8_t idx, uint32_t startPos);
-
-  void createHtmlTextfield(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos, const char * type, String value);
-  void createHtmlTextarea(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos, String value);
-  void createHtmlNumber(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos, String value);
-  void createHtmlFloat(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos, String value);
-  void createHtmlRange(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos, String value);
-  void createHtmlCheckbox(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos, String value);
-  void createHtmlStartSelect(char * buf, uint64_t *name, String *label, const char *parameter, uint8_t idx, uint32_t startPos);
+  String getIdxString(const paramIdxStr_s &str, const char *defaultValue);
+
+  void createHtmlTextfield(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const paramIdxEntry_s &entry, const char * type, String value);
+  void createHtmlTextarea(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const paramIdxEntry_s &entry, String value);
+  void createHtmlNumber(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const paramIdxEntry_s &entry, String value);
+  void createHtmlFloat(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const paramIdxEntry_s &entry, String value);
+  void createHtmlRange(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const paramIdxEntry_s &entry, String value);
+  void createHtmlCheckbox(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const paramIdxEntry_s &entry, String value);
+  void createHtmlStartSelect(char * buf, uint64_t *name, String *label);
   void createHtmlAddSelectOption(char * buf, String option, String label, String value);
-  void createHtmlStartMulti(char * buf, String *label, const char *parameter, uint8_t idx, uint32_t startPos, uint8_t u8_jsonType);
-  void createHtmlAddMultiOption(char * buf, uint16_t *name, uint64_t *nameExt, const char *parameter, uint8_t idx, uint32_t startPos, uint8_t option, String label, uint32_t value, uint8_t u8_dataType);
+  void createHtmlStartMulti(char * buf, String *label, uint8_t u8_jsonType);
+  void createHtmlAddMultiOption(char * buf, uint16_t *name, uint64_t *nameExt, const paramIdxEntry_s &entry, uint8_t option, String label, uint32_t value, uint8_t u8_dataType);
 
   void (*fn_mOnButtonSave)() = NULL;
   void (*fn_mOnButton1)() = NULL;
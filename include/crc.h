@@ -8,6 +8,9 @@
 
 #include <stdint.h>
 
+/* Gemeinsame CRC-Funktionen; die Berechnung erfolgt mit utils/Crc.hpp (Slice-by-4, siehe BSC_CRC_SLICES).
+ * Mit dem Build-Flag BSC_CRC_USE_ROM wird für calcCrc32() die Routine aus dem ROM des ESP32 verwendet. */
+
 uint16_t crc16 (uint8_t *nData, uint16_t wLength);
 uint32_t calcCrc32(uint8_t* pData, uint32_t DataLength);
 uint32_t calcCrc32(uint32_t crcIn, uint8_t* pData, uint32_t DataLength);
@@ -88,6 +88,7 @@ static const char COMPILE_DATE_TIME[] = "";
 
 //System
 #define WEBSERVER_PORT               80
+#define WEB_SCRATCH_BUFFER_SIZE      1024
 
 //Alarmrules
 #define CNT_ALARMS                   10
@@ -113,7 +114,11 @@ static const char COMPILE_DATE_TIME[] = "";
 //Onewire
 #define MAX_ANZAHL_OW_SENSOREN         64
 #define TEMP_IF_SENSOR_READ_ERROR  0xFF00
-#define OW_TEMP_AVG_CYCELS              3
+#define OW_CYCLE_TIME                 100 // Aufrufintervall owCyclicRun [ms]
+#define OW_MAX_READS_PER_CYCLE          8 // Max. Anzahl Sensoren, die pro Zyklus gelesen werden (ca. 10ms pro Sensor)
+
+//Aufzeichnung
+#define VALUE_LOG_TIERS                 3 // Stufen der Aufzeichnung (10 Minuten, 24 Stunden, 7 Tage)
 
 //Bluetooth
 #define BT_DEVICES_COUNT              7
@@ -247,6 +252,8 @@ enum serialDataRwTyp_e {BPN_NO_DATA, BPN_READ_SETTINGS, BPN_WRITE_READ_SETTINGS,
 #define ID_PARAM_ONWIRE_ENABLE                      50
 #define ID_PARAM_ONEWIRE_ADR                        51
 #define ID_PARAM_ONWIRE_TEMP_OFFSET                 52
+#define ID_PARAM_ONWIRE_RESOLUTION                  53
+#define ID_PARAM_ONWIRE_REFRESH_INTERVAL            54
 
 #define ID_PARAM_BMS_CAN_ENABLE                                         60
 #define ID_PARAM_BMS_CAN_DATASOURCE                                     61
@@ -366,6 +373,23 @@ enum serialDataRwTyp_e {BPN_NO_DATA, BPN_READ_SETTINGS, BPN_WRITE_READ_SETTINGS,
 
 #define ID_PARAM_DISPLAY_TIMEOUT 144
 
+#define ID_PARAM_BMS_CAN_RX_QUEUE_LENGTH 145
+#define ID_PARAM_BMS_CAN_TX_QUEUE_LENGTH 146
+#define ID_PARAM_BMS_CAN_TX_FRAME_GAP    147
+
+#define ID_PARAM_MQTT_AGGREGATED 148
+
+#define ID_PARAM_BMS_CAN_EXTENDED_DATA_FRAMES 149
+
+#define ID_PARAM_BMS_POLL_INTERVAL_MIN 150
+#define ID_PARAM_BMS_POLL_INTERVAL_MAX 151
+
+#define ID_PARAM_DISPLAY_BULK_DATA 152
+
+#define ID_PARAM_SYSTEM_RECORD_VALUES_TIER0_PERIODE 153
+#define ID_PARAM_SYSTEM_RECORD_VALUES_TIER1_PERIODE 154
+#define ID_PARAM_SYSTEM_RECORD_VALUES_TIER2_PERIODE 155
+
 
 //Auswahl Bluetooth Geräte
 #define ID_BT_DEVICE_NB             0
@@ -435,6 +459,7 @@ enum serialDataRwTyp_e {BPN_NO_DATA, BPN_READ_SETTINGS, BPN_WRITE_READ_SETTINGS,
 #define BMS_CHARGE_PERCENT                0x0D
 #define BMS_ERRORS                        0x0E
 #define BMS_LAST_DATA_MILLIS              0x0F
+#define BMS_BULK_DATA                     0x10  //Alle Daten eines BMS in einem Frame (I2cBulkFrame.hpp)
 
 //INVERTER_DATA 0x02
 #define INVERTER_VOLTAGE                  0x01
@@ -507,6 +532,8 @@ enum serialDataRwTyp_e {BPN_NO_DATA, BPN_READ_SETTINGS, BPN_WRITE_READ_SETTINGS,
 #define MQTT_TOPIC2_TOTAL_VOLT_MAX_COUNT        52
 #define MQTT_TOPIC2_AMOUNT_DCH_ENERGY           53
 #define MQTT_TOPIC2_AMOUNT_CH_ENERGY            54
+#define MQTT_TOPIC2_TASK                        55
+#define MQTT_TOPIC2_COMM                        56
 
 
 static const char* mqttTopics[] PROGMEM = {"", // 0
@@ -564,8 +591,8 @@ static const char* mqttTopics[] PROGMEM = {"", // 0
   "totalVoltMaxCount",         // 52
   "amountDchEnergy",           // 53
   "amountChEnergy",            // 54
-  "",                          // 55
-  "",                          // 56
+  "task",                      // 55
+  "comm",                      // 56
   "",                          // 57
   "",                          // 58
   "",                          // 59
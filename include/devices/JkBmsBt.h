@@ -23,7 +23,7 @@
 
 
 void    jkBmsBtDevInit(uint8_t devNr);
-void    jkBmsBtCopyData(uint8_t devNr, uint8_t frameVersion, uint8_t* pData, size_t length);
+bool    jkBmsBtCopyData(uint8_t devNr, uint8_t frameVersion, uint8_t* pData, size_t length);
 uint8_t jkBmsBtCrc(uint8_t *data, uint16_t len);
 void    jkBmsBtBuildSendFrame(uint8_t *frame, uint8_t address, uint32_t value, uint8_t length);
 
@@ -9,11 +9,33 @@
 #include "Arduino.h"
 #include "defines.h"
 
+struct i2cStatistics_s
+{
+  // Master
+  uint32_t txFrames;          // Anzahl gesendeter Transaktionen (Display, Slave-Anfragen)
+  uint32_t txBytes;           // Anzahl gesendeter Bytes
+  uint32_t txFailed;          // Transaktionen, die der Empfänger nicht bestätigt hat
+  uint32_t rxFrames;          // Gültige Bulk-Frames von den Slaves
+  uint32_t rxBytes;           // Von den Slaves empfangene Bytes
+  uint32_t rxTimeout;         // Anfragen ohne Antwort eines Slaves
+  uint32_t rxCrcError;        // Bulk-Frames mit falscher CRC
+  uint32_t rxInvalid;         // Bulk-Frames mit falscher Version, Typ oder Länge
+  uint32_t rxLost;            // Anhand der Sequenznummer erkannte verlorene Frames
+  uint32_t cycleTimeLastUs;   // Dauer des letzten Zyklus (Display und Slaves)
+  uint32_t cycleTimeMaxUs;    // Maximale Dauer eines Zyklus
+
+  // Slave
+  uint32_t slaveRequests;     // Anfragen vom Master
+  uint32_t slaveTxFrames;     // An den Master gesendete Bulk-Frames
+  uint32_t slaveTxBytes;      // An den Master gesendete Bytes
+};
+
 void i2cInit();
 void i2cCyclicRun();
 void i2cSendData(uint8_t i2cAdr, uint8_t data1, uint8_t data2, uint8_t data3, const void *dataAdr, uint8_t dataLen);
 void i2cSendData(uint8_t i2cAdr, uint8_t data1, uint8_t data2, uint8_t data3, String data, uint8_t dataLen);
 void i2cExtSerialSetEnable(uint8_t u8_serialDevNr, serialRxTxEn_e serialRxTxEn);
 bool isSerialExtEnabled();
+void i2cGetStatistics(struct i2cStatistics_s &stats);
 
 #endif
\ No newline at end of file
@@ -15,7 +15,6 @@ void writeLogToFS();
 #endif
 void deleteLogfile();
 void logTrigger(uint8_t triggerNr, uint8_t cause, bool trigger);
-void logValues();
 
 void fsLock();
 void fsUnlock();
@@ -8,6 +8,20 @@
 
 #include <Arduino.h>
 
+struct mqttStatistics_s
+{
+  uint32_t published;           // Anzahl gesendeter Nachrichten (Einzelnachrichten und JSON-Dokumente)
+  uint32_t publishFailed;       // Nachrichten, die der Client nicht senden konnte
+  uint32_t dropped;             // Abgelehnte Nachrichten, da der Sendebuffer voll war
+  uint32_t txBufferSize;        // Aktueller Füllstand des Sendebuffers
+  uint32_t txBufferHighWater;   // Maximaler Füllstand des Sendebuffers
+  uint32_t latencyLastMs;       // Zeit vom Einstellen in den Sendebuffer bis zum Senden der letzten Nachricht
+  uint32_t latencyMaxMs;        // Maximale Zeit im Sendebuffer
+  uint32_t aggregatedDocs;      // Gesendete JSON-Dokumente (aggregierter Modus)
+  uint32_t aggregatedMaxLen;    // Größtes gesendetes JSON-Dokument [Byte]
+  uint32_t aggregatedOverflow;  // JSON-Dokumente, die nicht in den Payload-Buffer gepasst haben
+};
+
 void initMqtt();
 bool mqttLoop();
 
@@ -15,6 +29,7 @@ bool mqttConnect();
 void mqttDisconnect();
 bool mqttConnected();
 uint16_t getTxBufferSize();
+void mqttGetStatistics(struct mqttStatistics_s &stats);
 
 void mqttPublish(int8_t t1, int8_t t2, int8_t t3, int8_t t4, String value);
 void mqttPublish(int8_t t1, int8_t t2, int8_t t3, int8_t t4, uint32_t value);
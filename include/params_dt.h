@@ -2,6 +2,7 @@
 
 #define DT_ID_PARAM_MQTT_DEVICE_NAME PARAM_DT_ST
 #define DT_ID_PARAM_DISPLAY_TIMEOUT PARAM_DT_U8
+#define DT_ID_PARAM_DISPLAY_BULK_DATA PARAM_DT_BO
 #define DT_ID_PARAM_WLAN_SSID PARAM_DT_ST
 #define DT_ID_PARAM_WLAN_PWD PARAM_DT_ST
 #define DT_ID_PARAM_WLAN_CONNECT_TIMEOUT PARAM_DT_U16
@@ -16,9 +17,13 @@
 #define DT_ID_PARAM_MQTT_PWD PARAM_DT_ST
 #define DT_ID_PARAM_MQTT_TOPIC_NAME PARAM_DT_ST
 #define DT_ID_PARAM_MQTT_SEND_DELAY PARAM_DT_U8
+#define DT_ID_PARAM_MQTT_AGGREGATED PARAM_DT_BO
 #define DT_ID_PARAM_SYSTEM_NTP_SERVER_NAME PARAM_DT_ST
 #define DT_ID_PARAM_SYSTEM_NTP_SERVER_PORT PARAM_DT_U16
 #define DT_ID_PARAM_SYSTEM_RECORD_VALUES_PERIODE PARAM_DT_U8
+#define DT_ID_PARAM_SYSTEM_RECORD_VALUES_TIER0_PERIODE PARAM_DT_U16
+#define DT_ID_PARAM_SYSTEM_RECORD_VALUES_TIER1_PERIODE PARAM_DT_U16
+#define DT_ID_PARAM_SYSTEM_RECORD_VALUES_TIER2_PERIODE PARAM_DT_U16
 #define DT_ID_PARAM_TRIGGER_NAMES PARAM_DT_ST
 #define DT_ID_PARAM_SS_BTDEV PARAM_DT_U8
 #define DT_ID_PARAM_SS_BTDEVMAC PARAM_DT_ST
@@ -26,6 +31,8 @@
 #define DT_ID_PARAM_SERIAL_CONNECT_DEVICE PARAM_DT_U8
 #define DT_ID_PARAM_SERIAL2_CONNECT_TO_ID PARAM_DT_U8
 #define DT_ID_PARAM_SERIAL_NUMBER_OF_CELLS PARAM_DT_U8
+#define DT_ID_PARAM_BMS_POLL_INTERVAL_MIN PARAM_DT_U16
+#define DT_ID_PARAM_BMS_POLL_INTERVAL_MAX PARAM_DT_U16
 #define DT_ID_PARAM_BMS_FILTER_RX_ERROR_COUNT PARAM_DT_U8
 #define DT_ID_PARAM_BMS_FILTER_CELL_VOLTAGE_PERCENT PARAM_DT_U8
 #define DT_ID_PARAM_BMS_PLAUSIBILITY_CHECK_CELLVOLTAGE PARAM_DT_U8
@@ -62,9 +69,15 @@
 #define DT_ID_PARAM_ONWIRE_ENABLE PARAM_DT_BO
 #define DT_ID_PARAM_ONEWIRE_ADR PARAM_DT_ST
 #define DT_ID_PARAM_ONWIRE_TEMP_OFFSET PARAM_DT_FL
+#define DT_ID_PARAM_ONWIRE_RESOLUTION PARAM_DT_U8
+#define DT_ID_PARAM_ONWIRE_REFRESH_INTERVAL PARAM_DT_U16
 #define DT_ID_PARAM_BMS_CAN_ENABLE PARAM_DT_BO
 #define DT_ID_PARAM_SS_CAN PARAM_DT_U8
 #define DT_ID_PARAM_BMS_CAN_EXTENDED_DATA_ENABLE PARAM_DT_BO
+#define DT_ID_PARAM_BMS_CAN_EXTENDED_DATA_FRAMES PARAM_DT_U8
+#define DT_ID_PARAM_BMS_CAN_RX_QUEUE_LENGTH PARAM_DT_U8
+#define DT_ID_PARAM_BMS_CAN_TX_QUEUE_LENGTH PARAM_DT_U8
+#define DT_ID_PARAM_BMS_CAN_TX_FRAME_GAP PARAM_DT_U8
 #define DT_ID_PARAM_BMS_CAN_DATASOURCE PARAM_DT_U8
 #define DT_ID_PARAM_BMS_CAN_DATASOURCE_SS1 PARAM_DT_U32
 #define DT_ID_PARAM_INVERTER_MULTI_BMS_VALUE_SOC PARAM_DT_U8
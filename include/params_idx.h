@@ -0,0 +1,626 @@
+/* ***********************************************************************************
+* Wichtiger Hinweis!
+* params_idx.h nicht manuell bearbeiten! Die Datei wird beim Build aus der params.h erstellt!
+* ***********************************************************************************/
+#include "WebSettings.h"
+
+const paramIdxEntry_s paramSystemIdxEntries[] PROGMEM = {
+  {45,0,8,0,0,0,0,0,1,0,100,0,0,0,0,{30,11},{0,0},{94,38},{63,3},{0,0},{0,0}},
+  {144,3,1,0,0,0,0,0,1,1,120,0,0,0,0,{156,15},{0,0},{0,0},{192,1},{220,3},{0,0}},
+  {152,10,9,0,0,0,0,0,1,0,100,0,0,0,0,{254,18},{0,0},{311,145},{294,1},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{469,4},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {40,0,8,0,0,0,0,0,1,0,100,0,0,0,0,{506,9},{0,0},{0,0},{537,0},{0,0},{0,0}},
+  {41,2,8,0,0,0,0,0,1,0,100,0,0,0,0,{567,13},{0,0},{0,0},{602,0},{0,0},{0,0}},
+  {96,3,3,0,0,0,0,0,1,0,3600,0,0,0,0,{632,20},{0,0},{721,143},{684,2},{671,1},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{877,9},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {36,0,8,1,0,0,0,0,1,0,100,0,0,0,0,{919,10},{0,0},{980,49},{951,0},{0,0},{0,0}},
+  {37,0,8,1,0,0,0,0,1,0,100,0,0,0,0,{1052,7},{0,0},{0,0},{1081,0},{0,0},{0,0}},
+  {38,0,8,1,0,0,0,0,1,0,100,0,0,0,0,{1123,6},{0,0},{0,0},{1151,13},{0,0},{0,0}},
+  {39,0,8,1,0,0,0,0,1,0,100,0,0,0,0,{1206,3},{0,0},{1248,8},{1231,0},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{1281,4},{0,0},{1305,64},{0,0},{0,0},{0,0}},
+  {44,10,9,0,0,0,0,0,1,0,100,0,0,0,0,{1392,11},{0,0},{0,0},{1425,1},{0,0},{0,0}},
+  {42,0,8,0,0,0,0,0,1,0,100,0,0,0,0,{1455,14},{0,0},{0,0},{1491,0},{0,0},{0,0}},
+  {43,3,3,0,0,0,0,0,1,1,10000,0,0,0,0,{1521,16},{0,0},{0,0},{1558,4},{0,0},{0,0}},
+  {86,0,8,0,0,0,0,0,1,0,100,0,0,0,0,{1611,8},{0,0},{0,0},{1641,0},{0,0},{0,0}},
+  {87,2,8,0,0,0,0,0,1,0,100,0,0,0,0,{1671,8},{0,0},{0,0},{1701,0},{0,0},{0,0}},
+  {46,0,8,0,0,0,0,0,1,0,100,0,0,0,0,{1731,15},{0,0},{0,0},{1768,3},{0,0},{0,0}},
+  {133,3,1,0,0,0,0,0,1,30,120,0,0,0,0,{1802,19},{0,0},{0,0},{1853,2},{1831,1},{0,0}},
+  {148,10,9,0,0,0,0,0,1,0,100,0,0,0,0,{1904,15},{0,0},{1958,213},{1941,1},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{2184,3},{0,0},{2207,64},{0,0},{0,0},{0,0}},
+  {122,0,8,1,0,0,0,0,1,0,100,0,0,0,0,{2295,14},{0,0},{0,0},{2331,12},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{2375,12},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {143,9,1,0,0,0,0,0,1,0,100,0,0,0,2,{2421,20},{0,0},{0,0},{2510,1},{0,0},{0,0}},
+  {153,3,3,0,0,0,0,0,1,1,60,0,0,0,0,{2541,20},{0,0},{2571,163},{2755,1},{2782,1},{0,0}},
+  {154,3,3,0,0,0,0,0,1,10,3600,0,0,0,0,{2814,20},{0,0},{0,0},{2855,2},{2886,1},{0,0}},
+  {155,3,3,0,0,0,0,0,1,60,21600,0,0,0,0,{2918,16},{0,0},{0,0},{2955,3},{2988,1},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{3009,11},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {0,12,0,0,10,1,0,0,1,0,100,30,1,0,0,{3043,19},{3079,7},{0,0},{0,0},{0,0},{0,0}},
+  {117,0,8,1,0,0,0,0,1,0,100,0,0,0,0,{3160,7},{0,0},{0,0},{3189,0},{0,0},{0,0}},
+};
+const paramIdxOption_s paramSystemIdxOptions[] PROGMEM = {
+  {{2468,1},{2475,3},0},
+  {{2486,1},{2493,3},0},
+};
+const paramIdx_s paramSystemIdx = {paramSystemIdxEntries, paramSystemIdxOptions, 31, 30};
+
+const paramIdxEntry_s paramBluetoothIdxEntries[] PROGMEM = {
+  {0,12,0,0,7,0,0,0,1,0,100,1,3,0,0,{20,9},{46,9},{0,0},{0,0},{0,0},{0,0}},
+  {4,9,1,0,0,0,0,0,1,0,100,0,0,0,4,{109,9},{0,0},{0,0},{280,1},{0,0},{0,0}},
+  {5,0,8,0,0,0,0,0,1,0,100,0,0,0,0,{310,11},{0,0},{0,0},{343,0},{0,0},{0,0}},
+  {126,9,1,0,0,0,0,0,1,0,100,0,0,4,11,{374,10},{0,0},{0,0},{790,1},{0,0},{0,0}},
+};
+const paramIdxOption_s paramBluetoothIdxOptions[] PROGMEM = {
+  {{146,1},{154,12},0},
+  {{175,1},{183,16},0},
+  {{208,1},{216,13},0},
+  {{238,1},{246,19},0},
+  {{412,1},{420,3},0},
+  {{432,1},{440,9},7488},
+  {{467,1},{475,9},7489},
+  {{502,1},{510,9},7490},
+  {{537,1},{545,9},7491},
+  {{572,1},{580,9},7492},
+  {{607,1},{615,9},7493},
+  {{642,1},{650,9},7494},
+  {{677,1},{685,9},7495},
+  {{712,1},{720,9},7496},
+  {{747,2},{756,10},7497},
+};
+const paramIdx_s paramBluetoothIdx = {paramBluetoothIdxEntries, paramBluetoothIdxOptions, 4, 1};
+
+const paramIdxEntry_s paramSerialIdxEntries[] PROGMEM = {
+  {0,12,0,0,11,0,0,0,1,0,100,15,1,0,0,{20,22},{59,6},{75,60},{0,0},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{652,25},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {108,3,1,0,0,0,0,0,1,1,8,0,0,0,0,{711,12},{0,0},{733,74},{828,1},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{864,9},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {141,3,1,0,0,0,0,0,1,4,24,0,0,0,0,{907,13},{0,0},{0,0},{941,2},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{979,13},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {150,3,3,0,0,0,0,0,1,100,3000,0,0,0,0,{1026,14},{0,0},{1050,298},{1369,3},{1402,2},{0,0}},
+  {151,3,3,0,0,0,0,0,1,500,3000,0,0,0,0,{1435,14},{0,0},{1459,130},{1610,4},{1644,2},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{1666,6},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {121,3,1,1,0,0,0,0,1,1,125,0,0,0,0,{1706,16},{0,0},{1732,73},{1826,1},{0,0},{0,0}},
+  {120,3,1,1,0,0,0,0,1,0,100,0,0,0,0,{1887,23},{0,0},{1920,20},{1972,1},{1950,1},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{2022,18},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {132,9,1,0,0,0,0,0,1,0,100,0,0,0,11,{2074,30},{0,0},{0,0},{2510,1},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{2531,17},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {0,12,0,0,11,0,0,0,1,0,100,16,2,0,0,{2571,22},{2610,6},{0,0},{0,0},{0,0},{0,0}},
+  {1,9,1,0,0,0,0,0,1,0,100,0,0,11,12,{190,6},{0,0},{0,0},{629,1},{0,0},{0,0}},
+  {127,3,3,0,0,0,0,0,1,0,5000,0,0,0,0,{2673,24},{0,0},{2707,13},{2753,1},{2730,2},{0,0}},
+  {130,3,3,0,0,0,0,0,1,0,5000,0,0,0,0,{2803,22},{0,0},{2835,13},{2881,1},{2858,2},{0,0}},
+};
+const paramIdxOption_s paramSerialIdxOptions[] PROGMEM = {
+  {{2132,1},{2140,3},0},
+  {{2152,1},{2160,9},7488},
+  {{2187,1},{2195,9},7489},
+  {{2222,1},{2230,9},7490},
+  {{2257,1},{2265,9},7491},
+  {{2292,1},{2300,9},7492},
+  {{2327,1},{2335,9},7493},
+  {{2362,1},{2370,9},7494},
+  {{2397,1},{2405,9},7495},
+  {{2432,1},{2440,9},7496},
+  {{2467,2},{2476,10},7497},
+  {{224,1},{232,12},0},
+  {{253,1},{261,13},0},
+  {{283,1},{291,7},0},
+  {{307,1},{315,6},0},
+  {{330,1},{338,10},0},
+  {{357,1},{365,8},0},
+  {{382,1},{390,10},0},
+  {{409,1},{417,29},0},
+  {{455,1},{463,22},0},
+  {{494,2},{503,22},0},
+  {{534,1},{542,36},0},
+  {{587,2},{596,18},0},
+};
+const paramIdx_s paramSerialIdx = {paramSerialIdxEntries, paramSerialIdxOptions, 18, 15};
+
+const paramIdxEntry_s paramAlarmBmsIdxEntries[] PROGMEM = {
+  {0,12,0,0,20,0,0,0,1,0,100,1,14,0,0,{20,15},{52,10},{0,0},{0,0},{0,0},{0,0}},
+  {9,9,1,0,0,0,0,0,1,0,100,0,0,0,19,{117,25},{0,0},{0,0},{677,3},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{699,19},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {17,9,1,0,0,0,0,0,1,0,100,0,0,19,11,{751,18},{0,0},{0,0},{1175,1},{0,0},{0,0}},
+  {12,3,1,0,0,0,0,0,1,1,255,0,0,0,0,{1206,19},{0,0},{0,0},{1257,2},{1235,1},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{1296,39},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {18,9,1,0,0,0,0,0,1,0,100,0,0,30,11,{1368,18},{0,0},{0,0},{1792,1},{0,0},{0,0}},
+  {14,3,1,0,0,0,0,0,1,1,24,0,0,0,0,{1823,24},{0,0},{0,0},{1868,2},{0,0},{0,0}},
+  {15,3,3,0,0,0,0,0,1,0,5000,0,0,0,0,{1916,16},{0,0},{0,0},{1965,4},{1942,2},{0,0}},
+  {16,3,3,0,0,0,0,0,1,0,5000,0,0,0,0,{2017,16},{0,0},{0,0},{2066,4},{2043,2},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{2108,40},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {19,9,1,0,0,0,0,0,1,0,100,0,0,41,11,{2181,18},{0,0},{0,0},{2605,1},{0,0},{0,0}},
+  {72,4,7,0,0,0,0,0,1,0,60,0,0,0,0,{2636,12},{0,0},{0,0},{2680,4},{2658,1},{0,0}},
+  {73,4,7,0,0,0,0,0,1,0,60,0,0,0,0,{2730,12},{0,0},{0,0},{2774,4},{2752,1},{0,0}},
+  {131,4,7,0,0,0,0,0,1,0,10,0,0,0,0,{2825,17},{0,0},{0,0},{2874,3},{2852,1},{0,0}},
+};
+const paramIdxOption_s paramAlarmBmsIdxOptions[] PROGMEM = {
+  {{170,3},{180,3},0},
+  {{192,1},{200,11},0},
+  {{220,1},{228,11},0},
+  {{248,1},{256,11},0},
+  {{276,1},{284,11},0},
+  {{304,1},{312,11},0},
+  {{332,1},{340,11},0},
+  {{360,1},{368,11},0},
+  {{388,1},{396,8},0},
+  {{413,1},{421,8},0},
+  {{438,1},{446,8},0},
+  {{463,2},{472,8},0},
+  {{489,2},{498,8},0},
+  {{515,2},{524,8},0},
+  {{541,2},{550,8},0},
+  {{567,2},{576,8},0},
+  {{593,2},{602,8},0},
+  {{619,2},{628,8},0},
+  {{645,2},{654,9},0},
+  {{797,1},{805,3},0},
+  {{817,1},{825,9},7488},
+  {{852,1},{860,9},7489},
+  {{887,1},{895,9},7490},
+  {{922,1},{930,9},7491},
+  {{957,1},{965,9},7492},
+  {{992,1},{1000,9},7493},
+  {{1027,1},{1035,9},7494},
+  {{1062,1},{1070,9},7495},
+  {{1097,1},{1105,9},7496},
+  {{1132,2},{1141,10},7497},
+  {{1414,1},{1422,3},0},
+  {{1434,1},{1442,9},7488},
+  {{1469,1},{1477,9},7489},
+  {{1504,1},{1512,9},7490},
+  {{1539,1},{1547,9},7491},
+  {{1574,1},{1582,9},7492},
+  {{1609,1},{1617,9},7493},
+  {{1644,1},{1652,9},7494},
+  {{1679,1},{1687,9},7495},
+  {{1714,1},{1722,9},7496},
+  {{1749,2},{1758,10},7497},
+  {{2227,1},{2235,3},0},
+  {{2247,1},{2255,9},7488},
+  {{2282,1},{2290,9},7489},
+  {{2317,1},{2325,9},7490},
+  {{2352,1},{2360,9},7491},
+  {{2387,1},{2395,9},7492},
+  {{2422,1},{2430,9},7493},
+  {{2457,1},{2465,9},7494},
+  {{2492,1},{2500,9},7495},
+  {{2527,1},{2535,9},7496},
+  {{2562,2},{2571,10},7497},
+};
+const paramIdx_s paramAlarmBmsIdx = {paramAlarmBmsIdxEntries, paramAlarmBmsIdxOptions, 15, 1};
+
+const paramIdxEntry_s paramAlarmTempIdxEntries[] PROGMEM = {
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{20,22},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {109,9,1,0,0,0,0,0,1,0,100,0,0,0,11,{76,7},{0,0},{0,0},{489,1},{0,0},{0,0}},
+  {110,3,1,0,0,0,0,0,1,5,240,0,0,0,0,{521,7},{0,0},{0,0},{561,1},{538,1},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{600,27},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {20,12,0,0,10,0,0,0,1,0,100,5,9,0,0,{660,27},{704,16},{0,0},{0,0},{0,0},{0,0}},
+  {128,9,1,0,0,0,0,0,1,0,100,0,0,11,2,{777,6},{0,0},{0,0},{861,1},{0,0},{0,0}},
+  {129,9,1,0,0,0,0,0,1,0,100,0,0,13,18,{893,47},{0,0},{0,0},{1453,1},{0,0},{0,0}},
+  {21,3,1,0,0,0,0,0,1,0,255,0,0,0,0,{1483,16},{0,0},{1556,43},{1521,0},{0,0},{0,0}},
+  {22,3,1,0,0,0,0,0,1,0,255,0,0,0,0,{1622,16},{0,0},{1695,43},{1660,0},{0,0},{0,0}},
+  {27,9,1,0,0,0,0,0,1,0,100,0,0,31,4,{1761,16},{0,0},{2012,197},{1994,1},{0,0},{0,0}},
+  {23,3,1,0,0,0,0,0,1,0,255,0,0,0,0,{2232,14},{0,0},{0,0},{2268,0},{0,0},{0,0}},
+  {24,4,7,0,0,0,0,0,1,0,70,0,0,0,0,{2316,6},{0,0},{0,0},{2344,0},{0,0},{0,0}},
+  {25,4,7,0,0,0,0,0,1,0,70,0,0,0,0,{2391,9},{0,0},{0,0},{2422,0},{0,0},{0,0}},
+  {26,9,1,0,0,0,0,0,1,0,100,0,0,35,11,{2469,14},{0,0},{0,0},{2889,1},{0,0},{0,0}},
+};
+const paramIdxOption_s paramAlarmTempIdxOptions[] PROGMEM = {
+  {{111,1},{119,3},0},
+  {{131,1},{139,9},7488},
+  {{166,1},{174,9},7489},
+  {{201,1},{209,9},7490},
+  {{236,1},{244,9},7491},
+  {{271,1},{279,9},7492},
+  {{306,1},{314,9},7493},
+  {{341,1},{349,9},7494},
+  {{376,1},{384,9},7495},
+  {{411,1},{419,9},7496},
+  {{446,2},{455,10},7497},
+  {{811,1},{819,3},0},
+  {{831,1},{839,7},0},
+  {{968,1},{976,11},0},
+  {{996,1},{1004,11},0},
+  {{1024,1},{1032,11},0},
+  {{1052,1},{1060,11},0},
+  {{1080,1},{1088,11},0},
+  {{1108,1},{1116,11},0},
+  {{1136,1},{1144,11},0},
+  {{1164,1},{1172,8},0},
+  {{1189,1},{1197,8},0},
+  {{1214,1},{1222,8},0},
+  {{1239,2},{1248,8},0},
+  {{1265,2},{1274,8},0},
+  {{1291,2},{1300,8},0},
+  {{1317,2},{1326,8},0},
+  {{1343,2},{1352,8},0},
+  {{1369,2},{1378,8},0},
+  {{1395,2},{1404,8},0},
+  {{1421,2},{1430,9},0},
+  {{1805,1},{1813,12},0},
+  {{1834,1},{1842,31},0},
+  {{1882,1},{1890,42},0},
+  {{1941,1},{1949,30},0},
+  {{2511,1},{2519,3},0},
+  {{2531,1},{2539,9},7488},
+  {{2566,1},{2574,9},7489},
+  {{2601,1},{2609,9},7490},
+  {{2636,1},{2644,9},7491},
+  {{2671,1},{2679,9},7492},
+  {{2706,1},{2714,9},7493},
+  {{2741,1},{2749,9},7494},
+  {{2776,1},{2784,9},7495},
+  {{2811,1},{2819,9},7496},
+  {{2846,2},{2855,10},7497},
+};
+const paramIdx_s paramAlarmTempIdx = {paramAlarmTempIdxEntries, paramAlarmTempIdxOptions, 14, 5};
+
+const paramIdxEntry_s paramDigitalOutIdxEntries[] PROGMEM = {
+  {0,12,0,0,6,0,0,0,1,0,100,1,4,0,0,{20,19},{56,13},{0,0},{0,0},{0,0},{0,0}},
+  {30,9,1,0,0,0,0,0,1,0,100,0,0,0,2,{124,21},{0,0},{0,0},{228,1},{0,0},{0,0}},
+  {31,3,3,0,0,0,0,0,1,100,10000,0,0,0,0,{259,11},{0,0},{0,0},{303,3},{280,2},{0,0}},
+  {33,3,1,0,0,0,0,0,1,0,254,0,0,0,0,{357,16},{0,0},{0,0},{405,1},{383,1},{0,0}},
+  {32,14,3,0,0,0,0,0,1,0,100,0,0,2,10,{453,15},{0,0},{0,0},{855,0},{0,0},{0,0}},
+};
+const paramIdxOption_s paramDigitalOutIdxOptions[] PROGMEM = {
+  {{173,1},{181,9},0},
+  {{199,1},{207,6},0},
+  {{497,1},{505,9},7488},
+  {{532,1},{540,9},7489},
+  {{567,1},{575,9},7490},
+  {{602,1},{610,9},7491},
+  {{637,1},{645,9},7492},
+  {{672,1},{680,9},7493},
+  {{707,1},{715,9},7494},
+  {{742,1},{750,9},7495},
+  {{777,1},{785,9},7496},
+  {{812,2},{821,10},7497},
+};
+const paramIdx_s paramDigitalOutIdx = {paramDigitalOutIdxEntries, paramDigitalOutIdxOptions, 5, 1};
+
+const paramIdxEntry_s paramDigitalInIdxEntries[] PROGMEM = {
+  {0,12,0,0,4,0,0,0,1,0,100,1,2,0,0,{20,20},{57,14},{0,0},{0,0},{0,0},{0,0}},
+  {34,10,9,0,0,0,0,0,1,0,100,0,0,0,0,{126,19},{0,0},{0,0},{168,1},{0,0},{0,0}},
+  {35,9,1,0,0,0,0,0,1,0,100,0,0,0,11,{199,15},{0,0},{0,0},{620,1},{0,0},{0,0}},
+};
+const paramIdxOption_s paramDigitalInIdxOptions[] PROGMEM = {
+  {{242,1},{250,3},0},
+  {{262,1},{270,9},7488},
+  {{297,1},{305,9},7489},
+  {{332,1},{340,9},7490},
+  {{367,1},{375,9},7491},
+  {{402,1},{410,9},7492},
+  {{437,1},{445,9},7493},
+  {{472,1},{480,9},7494},
+  {{507,1},{515,9},7495},
+  {{542,1},{550,9},7496},
+  {{577,2},{586,10},7497},
+};
+const paramIdx_s paramDigitalInIdx = {paramDigitalInIdxEntries, paramDigitalInIdxOptions, 3, 1};
+
+const paramIdxEntry_s paramOnewireAdrIdxEntries[] PROGMEM = {
+  {50,10,9,0,0,0,0,0,1,0,100,0,0,0,0,{30,14},{0,0},{0,0},{67,1},{0,0},{0,0}},
+  {0,12,0,0,64,0,0,0,1,0,100,2,1,0,0,{88,11},{116,7},{0,0},{0,0},{0,0},{0,0}},
+  {51,0,8,1,0,0,0,0,1,0,100,0,0,0,0,{179,7},{0,0},{0,0},{208,0},{0,0},{0,0}},
+};
+const paramIdxOption_s paramOnewireAdrIdxOptions[] PROGMEM = {
+  {{0,0},{0,0},0},
+};
+const paramIdx_s paramOnewireAdrIdx = {paramOnewireAdrIdxEntries, paramOnewireAdrIdxOptions, 3, 2};
+
+const paramIdxEntry_s paramOnewire2IdxEntries[] PROGMEM = {
+  {0,12,0,0,64,0,0,0,1,0,100,1,3,0,0,{20,16},{53,6},{0,0},{0,0},{0,0},{0,0}},
+  {52,4,7,0,0,0,0,0,1,-10,10,0,0,0,0,{115,6},{0,0},{0,0},{158,1},{131,6},{0,0}},
+  {53,9,1,0,0,0,0,0,1,0,100,0,0,0,4,{207,14},{0,0},{0,0},{421,2},{0,0},{0,0}},
+  {54,3,3,0,0,0,0,0,1,1,3600,0,0,0,0,{452,13},{0,0},{0,0},{497,1},{475,1},{0,0}},
+};
+const paramIdxOption_s paramOnewire2IdxOptions[] PROGMEM = {
+  {{248,1},{255,23},0},
+  {{286,2},{294,26},0},
+  {{328,2},{336,27},0},
+  {{371,2},{379,28},0},
+};
+const paramIdx_s paramOnewire2Idx = {paramOnewire2IdxEntries, paramOnewire2IdxOptions, 4, 1};
+
+const paramIdxEntry_s paramBmsToInverterIdxEntries[] PROGMEM = {
+  {60,10,9,0,0,0,0,0,1,0,100,0,0,0,0,{30,17},{0,0},{0,0},{70,1},{0,0},{0,0}},
+  {2,9,1,0,0,0,0,0,1,0,100,0,0,0,5,{100,6},{0,0},{0,0},{269,2},{0,0},{0,0}},
+  {125,10,9,0,0,0,0,0,1,0,100,0,0,0,0,{302,18},{0,0},{0,0},{343,1},{0,0},{0,0}},
+  {149,3,1,0,0,0,0,0,1,0,50,0,0,0,0,{375,31},{0,0},{477,253},{427,1},{454,6},{0,0}},
+  {145,3,1,0,0,0,0,0,1,5,100,0,0,0,0,{754,8},{0,0},{835,125},{783,2},{812,6},{0,0}},
+  {146,3,1,0,0,0,0,0,1,5,100,0,0,0,0,{984,8},{0,0},{1065,129},{1013,2},{1042,6},{0,0}},
+  {147,3,1,0,0,0,0,0,1,0,20,0,0,0,0,{1218,24},{0,0},{1309,127},{1263,1},{1290,2},{0,0}},
+  {61,9,1,0,0,0,0,0,1,0,100,0,0,5,18,{1459,20},{0,0},{0,0},{1993,1},{0,0},{0,0}},
+  {83,14,5,0,0,0,0,0,1,0,100,0,0,23,11,{2024,13},{0,0},{0,0},{2348,1},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{2368,23},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {116,9,1,0,0,0,0,0,1,0,100,0,0,34,4,{2425,3},{0,0},{0,0},{2568,1},{0,0},{0,0}},
+  {142,9,1,0,0,0,0,0,1,0,100,0,0,38,18,{2600,12},{0,0},{3205,42},{3125,1},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{3260,10},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {62,4,7,0,0,0,0,0,1,0,100,0,0,0,0,{3303,17},{0,0},{0,0},{3353,4},{3330,1},{0,0}},
+  {64,3,3,0,0,0,0,0,1,0,1000,0,0,0,0,{3409,14},{0,0},{0,0},{3456,3},{3433,1},{0,0}},
+  {65,3,3,0,0,0,0,0,1,0,1000,0,0,0,0,{3508,17},{0,0},{0,0},{3558,3},{3535,1},{0,0}},
+  {66,14,3,0,0,0,0,0,1,0,100,0,0,56,10,{3610,22},{0,0},{0,0},{4019,0},{0,0},{0,0}},
+  {67,14,3,0,0,0,0,0,1,0,100,0,0,66,10,{4049,25},{0,0},{0,0},{4461,0},{0,0},{0,0}},
+  {77,14,3,0,0,0,0,0,1,0,100,0,0,76,10,{4491,15},{0,0},{0,0},{4893,0},{0,0},{0,0}},
+  {0,15,0,0,11,0,0,0,1,0,100,62,2,0,0,{4913,20},{4950,10},{0,0},{0,0},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{5201,17},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {112,14,5,0,0,0,0,0,1,0,100,0,0,86,10,{5252,20},{0,0},{0,0},{5659,0},{0,0},{0,0}},
+  {113,14,5,0,0,0,0,0,1,0,100,0,0,96,10,{5690,19},{0,0},{0,0},{6096,0},{0,0},{0,0}},
+  {114,14,5,0,0,0,0,0,1,0,100,0,0,106,10,{6127,16},{0,0},{0,0},{6530,0},{0,0},{0,0}},
+  {115,14,5,0,0,0,0,0,1,0,100,0,0,116,10,{6561,15},{0,0},{0,0},{6963,0},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{6983,18},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {97,9,1,0,0,0,0,0,1,0,100,0,0,126,2,{7034,6},{0,0},{0,0},{7118,1},{0,0},{0,0}},
+  {98,3,1,0,0,0,0,0,1,0,64,0,0,0,0,{7149,12},{0,0},{7218,43},{7183,1},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{7274,42},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {74,10,9,0,0,0,0,0,1,0,100,0,0,0,0,{7349,7},{0,0},{0,0},{7379,1},{0,0},{0,0}},
+  {75,3,3,0,0,0,0,0,1,2500,5000,0,0,0,0,{7410,33},{0,0},{7453,91},{7578,4},{7554,2},{0,0}},
+  {76,3,3,0,0,0,0,0,1,2500,5000,0,0,0,0,{7634,21},{0,0},{7665,185},{7884,4},{7860,2},{0,0}},
+  {78,3,1,0,0,0,0,0,1,0,200,0,0,0,0,{7940,17},{0,0},{0,0},{7990,1},{7967,1},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{8029,34},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {68,10,9,0,0,0,0,0,1,0,100,0,0,0,0,{8096,7},{0,0},{0,0},{8126,1},{0,0},{0,0}},
+  {71,3,3,0,0,0,0,0,1,2500,5000,0,0,0,0,{8157,33},{0,0},{0,0},{8224,4},{8200,2},{0,0}},
+  {69,3,1,0,0,0,0,0,1,1,200,0,0,0,0,{8280,30},{0,0},{0,0},{8344,2},{8320,2},{0,0}},
+  {70,3,1,0,0,0,0,0,1,1,200,0,0,0,0,{8394,29},{0,0},{8492,63},{8456,1},{8433,1},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{8568,27},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {79,10,9,0,0,0,0,0,1,0,100,0,0,0,0,{8628,7},{0,0},{0,0},{8658,1},{0,0},{0,0}},
+  {80,3,1,0,0,0,0,0,1,1,99,0,0,0,0,{8689,18},{0,0},{0,0},{8740,2},{8717,1},{0,0}},
+  {81,3,1,0,0,0,0,0,1,1,100,0,0,0,0,{8789,24},{0,0},{8883,63},{8846,2},{8823,1},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{8959,45},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {138,3,3,0,0,0,0,0,1,0,5000,0,0,0,0,{9038,28},{0,0},{9076,126},{9236,1},{9212,2},{0,0}},
+  {139,3,3,0,0,0,0,0,1,2500,5000,0,0,0,0,{9287,16},{0,0},{9313,185},{9532,4},{9508,2},{0,0}},
+  {140,3,1,0,0,0,0,0,1,0,200,0,0,0,0,{9589,17},{0,0},{0,0},{9639,1},{9616,1},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{9678,40},{0,0},{9738,262},{0,0},{0,0},{0,0}},
+  {88,10,9,0,0,0,0,0,1,0,100,0,0,0,0,{10023,7},{0,0},{0,0},{10053,1},{0,0},{0,0}},
+  {89,3,3,0,0,0,0,0,1,2500,4000,0,0,0,0,{10084,23},{0,0},{0,0},{10141,4},{10117,2},{0,0}},
+  {92,3,3,0,0,0,0,0,1,0,4000,0,0,0,0,{10197,21},{0,0},{10289,108},{10252,1},{10228,2},{0,0}},
+  {90,3,1,0,0,0,0,0,1,1,100,0,0,0,0,{10420,3},{0,0},{0,0},{10456,1},{10433,1},{0,0}},
+  {91,3,3,0,0,0,0,0,1,0,3600,0,0,0,0,{10505,36},{0,0},{0,0},{10574,3},{10551,1},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{10616,42},{0,0},{10678,274},{0,0},{0,0},{0,0}},
+  {93,10,9,0,0,0,0,0,1,0,100,0,0,0,0,{10975,7},{0,0},{0,0},{11005,1},{0,0},{0,0}},
+  {94,3,3,0,0,0,0,0,1,2000,4000,0,0,0,0,{11036,18},{0,0},{0,0},{11088,4},{11064,2},{0,0}},
+  {95,3,1,0,0,0,0,0,1,1,100,0,0,0,0,{11144,18},{0,0},{0,0},{11196,1},{11172,2},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{11235,22},{0,0},{11277,172},{0,0},{0,0},{0,0}},
+  {82,3,3,0,0,0,0,0,1,0,30000,0,0,0,0,{11472,12},{0,0},{11494,24},{11551,1},{11528,1},{0,0}},
+  {84,4,7,0,0,0,0,0,1,0,1000,0,0,0,0,{11602,13},{0,0},{0,0},{11648,3},{11625,1},{0,0}},
+  {85,3,1,0,0,0,0,0,1,1,100,0,0,0,0,{11700,20},{0,0},{0,0},{11753,2},{11730,1},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{11793,15},{0,0},{11828,82},{0,0},{0,0},{0,0}},
+  {0,12,0,0,4,0,0,0,1,0,100,64,3,0,0,{0,0},{11929,4},{0,0},{0,0},{0,0},{0,0}},
+  {118,3,3,0,0,0,0,0,1,0,500,0,0,0,0,{5017,23},{0,0},{0,0},{5061,3},{0,0},{0,0}},
+  {119,3,3,0,0,0,0,0,1,0,500,0,0,0,0,{5112,26},{0,0},{0,0},{5159,3},{0,0},{0,0}},
+  {134,9,1,0,0,0,0,0,1,0,100,0,0,128,11,{11989,7},{0,0},{0,0},{12402,1},{0,0},{0,0}},
+  {135,3,1,0,0,0,0,0,1,1,100,0,0,0,0,{12434,17},{0,0},{0,0},{12483,2},{12461,1},{0,0}},
+  {136,3,1,0,0,0,0,0,1,1,100,0,0,0,0,{12533,17},{0,0},{0,0},{12582,2},{12560,1},{0,0}},
+};
+const paramIdxOption_s paramBmsToInverterIdxOptions[] PROGMEM = {
+  {{134,1},{142,12},0},
+  {{163,1},{171,9},0},
+  {{189,1},{197,4},0},
+  {{210,1},{218,7},0},
+  {{234,1},{242,12},0},
+  {{1507,1},{1515,11},0},
+  {{1535,1},{1543,11},0},
+  {{1563,1},{1571,11},0},
+  {{1591,1},{1599,11},0},
+  {{1619,1},{1627,11},0},
+  {{1647,1},{1655,11},0},
+  {{1675,1},{1683,11},0},
+  {{1703,1},{1711,8},0},
+  {{1728,1},{1736,8},0},
+  {{1753,1},{1761,8},0},
+  {{1778,2},{1787,8},0},
+  {{1804,2},{1813,8},0},
+  {{1830,2},{1839,8},0},
+  {{1856,2},{1865,8},0},
+  {{1882,2},{1891,8},0},
+  {{1908,2},{1917,8},0},
+  {{1934,2},{1943,8},0},
+  {{1960,2},{1969,9},0},
+  {{2066,1},{2074,8},0},
+  {{2091,1},{2099,8},0},
+  {{2116,1},{2124,8},0},
+  {{2141,1},{2149,8},0},
+  {{2166,1},{2174,8},0},
+  {{2191,1},{2199,8},0},
+  {{2216,1},{2224,8},0},
+  {{2241,1},{2249,8},0},
+  {{2266,1},{2274,8},0},
+  {{2291,1},{2299,8},0},
+  {{2316,2},{2325,9},0},
+  {{2456,1},{2464,12},0},
+  {{2484,1},{2491,14},0},
+  {{2513,1},{2520,15},0},
+  {{2543,1},{2550,3},0},
+  {{2640,1},{2648,11},0},
+  {{2668,1},{2676,11},0},
+  {{2696,1},{2704,11},0},
+  {{2724,1},{2732,11},0},
+  {{2752,1},{2760,11},0},
+  {{2780,1},{2788,11},0},
+  {{2808,1},{2816,11},0},
+  {{2836,1},{2844,8},0},
+  {{2861,1},{2869,8},0},
+  {{2886,1},{2894,8},0},
+  {{2911,2},{2920,8},0},
+  {{2937,2},{2946,8},0},
+  {{2963,2},{2972,8},0},
+  {{2989,2},{2998,8},0},
+  {{3015,2},{3024,8},0},
+  {{3041,2},{3050,8},0},
+  {{3067,2},{3076,8},0},
+  {{3093,2},{3102,9},0},
+  {{3661,1},{3669,9},7488},
+  {{3696,1},{3704,9},7489},
+  {{3731,1},{3739,9},7490},
+  {{3766,1},{3774,9},7491},
+  {{3801,1},{3809,9},7492},
+  {{3836,1},{3844,9},7493},
+  {{3871,1},{3879,9},7494},
+  {{3906,1},{3914,9},7495},
+  {{3941,1},{3949,9},7496},
+  {{3976,2},{3985,10},7497},
+  {{4103,1},{4111,9},7488},
+  {{4138,1},{4146,9},7489},
+  {{4173,1},{4181,9},7490},
+  {{4208,1},{4216,9},7491},
+  {{4243,1},{4251,9},7492},
+  {{4278,1},{4286,9},7493},
+  {{4313,1},{4321,9},7494},
+  {{4348,1},{4356,9},7495},
+  {{4383,1},{4391,9},7496},
+  {{4418,2},{4427,10},7497},
+  {{4535,1},{4543,9},7488},
+  {{4570,1},{4578,9},7489},
+  {{4605,1},{4613,9},7490},
+  {{4640,1},{4648,9},7491},
+  {{4675,1},{4683,9},7492},
+  {{4710,1},{4718,9},7493},
+  {{4745,1},{4753,9},7494},
+  {{4780,1},{4788,9},7495},
+  {{4815,1},{4823,9},7496},
+  {{4850,2},{4859,10},7497},
+  {{5301,1},{5309,9},7488},
+  {{5336,1},{5344,9},7489},
+  {{5371,1},{5379,9},7490},
+  {{5406,1},{5414,9},7491},
+  {{5441,1},{5449,9},7492},
+  {{5476,1},{5484,9},7493},
+  {{5511,1},{5519,9},7494},
+  {{5546,1},{5554,9},7495},
+  {{5581,1},{5589,9},7496},
+  {{5616,2},{5625,10},7497},
+  {{5738,1},{5746,9},7488},
+  {{5773,1},{5781,9},7489},
+  {{5808,1},{5816,9},7490},
+  {{5843,1},{5851,9},7491},
+  {{5878,1},{5886,9},7492},
+  {{5913,1},{5921,9},7493},
+  {{5948,1},{5956,9},7494},
+  {{5983,1},{5991,9},7495},
+  {{6018,1},{6026,9},7496},
+  {{6053,2},{6062,10},7497},
+  {{6172,1},{6180,9},7488},
+  {{6207,1},{6215,9},7489},
+  {{6242,1},{6250,9},7490},
+  {{6277,1},{6285,9},7491},
+  {{6312,1},{6320,9},7492},
+  {{6347,1},{6355,9},7493},
+  {{6382,1},{6390,9},7494},
+  {{6417,1},{6425,9},7495},
+  {{6452,1},{6460,9},7496},
+  {{6487,2},{6496,10},7497},
+  {{6605,1},{6613,9},7488},
+  {{6640,1},{6648,9},7489},
+  {{6675,1},{6683,9},7490},
+  {{6710,1},{6718,9},7491},
+  {{6745,1},{6753,9},7492},
+  {{6780,1},{6788,9},7493},
+  {{6815,1},{6823,9},7494},
+  {{6850,1},{6858,9},7495},
+  {{6885,1},{6893,9},7496},
+  {{6920,2},{6929,10},7497},
+  {{7068,1},{7076,3},0},
+  {{7088,1},{7096,7},0},
+  {{12024,1},{12032,3},0},
+  {{12044,1},{12052,9},7488},
+  {{12079,1},{12087,9},7489},
+  {{12114,1},{12122,9},7490},
+  {{12149,1},{12157,9},7491},
+  {{12184,1},{12192,9},7492},
+  {{12219,1},{12227,9},7493},
+  {{12254,1},{12262,9},7494},
+  {{12289,1},{12297,9},7495},
+  {{12324,1},{12332,9},7496},
+  {{12359,2},{12368,10},7497},
+};
+const paramIdx_s paramBmsToInverterIdx = {paramBmsToInverterIdxEntries, paramBmsToInverterIdxOptions, 67, 62};
+
+const paramIdxEntry_s paramDeviceNeeyBalancerIdxEntries[] PROGMEM = {
+  {0,12,0,0,7,0,4,1,1,0,100,1,8,0,0,{20,20},{57,4},{0,0},{0,0},{0,0},{0,0}},
+  {99,3,1,1,0,0,0,0,1,4,24,0,0,0,0,{154,5},{0,0},{0,0},{180,2},{0,0},{0,0}},
+  {100,4,7,1,0,0,0,0,1,0,1,0,0,0,0,{241,13},{0,0},{0,0},{275,5},{305,1},{315,5}},
+  {101,4,7,1,0,0,0,0,1,0,4,0,0,0,0,{362,20},{0,0},{0,0},{403,3},{433,1},{444,4}},
+  {102,4,7,1,0,0,0,0,1,1,5,0,0,0,0,{491,13},{0,0},{0,0},{525,4},{554,1},{565,5}},
+  {103,4,7,1,0,0,0,0,1,1,5,0,0,0,0,{613,20},{0,0},{0,0},{654,4},{683,1},{694,5}},
+  {104,3,3,1,0,0,0,0,1,1,500,0,0,0,0,{742,13},{0,0},{0,0},{776,3},{806,2},{0,0}},
+  {105,9,1,1,0,0,0,0,1,0,100,0,0,0,4,{851,7},{0,0},{0,0},{973,1},{0,0},{0,0}},
+  {107,9,1,1,0,0,0,0,1,0,100,0,0,4,12,{1017,11},{0,0},{0,0},{1456,1},{0,0},{0,0}},
+};
+const paramIdxOption_s paramDeviceNeeyBalancerIdxOptions[] PROGMEM = {
+  {{886,1},{894,3},0},
+  {{906,1},{914,3},0},
+  {{926,1},{934,3},0},
+  {{946,1},{954,4},0},
+  {{1056,1},{1064,3},0},
+  {{1076,3},{1086,3},0},
+  {{1098,1},{1106,9},7488},
+  {{1133,1},{1141,9},7489},
+  {{1168,1},{1176,9},7490},
+  {{1203,1},{1211,9},7491},
+  {{1238,1},{1246,9},7492},
+  {{1273,1},{1281,9},7493},
+  {{1308,1},{1316,9},7494},
+  {{1343,1},{1351,9},7495},
+  {{1378,1},{1386,9},7496},
+  {{1413,2},{1422,10},7497},
+};
+const paramIdx_s paramDeviceNeeyBalancerIdx = {paramDeviceNeeyBalancerIdxEntries, paramDeviceNeeyBalancerIdxOptions, 9, 1};
+
+const paramIdxEntry_s paramDeviceJbdBmsIdxEntries[] PROGMEM = {
+  {0,12,0,0,11,0,1,1,1,0,100,1,1,0,0,{20,7},{44,6},{0,0},{0,0},{0,0},{0,0}},
+  {124,3,3,1,0,0,0,0,1,1000,5000,0,0,0,0,{197,16},{0,0},{0,0},{234,4},{269,2},{0,0}},
+};
+const paramIdxOption_s paramDeviceJbdBmsIdxOptions[] PROGMEM = {
+  {{0,0},{0,0},0},
+};
+const paramIdx_s paramDeviceJbdBmsIdx = {paramDeviceJbdBmsIdxEntries, paramDeviceJbdBmsIdxOptions, 2, 1};
+
+const paramIdxEntry_s paramDeviceBpnIdxEntries[] PROGMEM = {
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{20,7},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {1,3,0,0,0,0,0,0,1,0,18,0,0,0,0,{59,13},{0,0},{0,0},{93,2},{121,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{134,5},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {16,3,0,0,0,0,0,0,1,0,1000,0,0,0,0,{172,16},{0,0},{0,0},{209,3},{240,2},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{255,9},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {17,9,1,0,0,0,0,0,1,0,100,0,0,0,2,{297,8},{0,0},{0,0},{394,1},{0,0},{0,0}},
+  {18,9,1,0,0,0,0,0,1,0,100,0,0,2,2,{425,8},{0,0},{0,0},{522,1},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{543,20},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {2,3,0,0,0,0,0,0,1,2500,4000,0,0,0,0,{595,16},{0,0},{0,0},{632,4},{667,2},{0,0}},
+  {3,3,0,0,0,0,0,0,1,2500,4000,0,0,0,0,{691,17},{0,0},{0,0},{729,4},{764,2},{0,0}},
+  {4,3,0,0,0,0,0,0,1,0,255,0,0,0,0,{788,26},{0,0},{0,0},{835,2},{864,1},{0,0}},
+  {5,9,1,0,0,0,0,0,1,0,100,0,0,4,4,{887,7},{0,0},{0,0},{1017,1},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{1038,23},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {6,4,0,0,0,0,0,0,1,0,70,0,0,0,0,{1093,19},{0,0},{0,0},{1147,4},{1177,1},{1131,4}},
+  {7,4,0,0,0,0,0,0,1,0,70,0,0,0,0,{1200,20},{0,0},{0,0},{1255,4},{1285,1},{1239,4}},
+  {8,3,0,0,0,0,0,0,1,0,255,0,0,0,0,{1308,29},{0,0},{0,0},{1358,1},{1386,1},{0,0}},
+  {9,9,1,0,0,0,0,0,1,0,100,0,0,8,4,{1409,7},{0,0},{0,0},{1539,1},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{1560,22},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {10,3,0,0,0,0,0,0,1,0,4000,0,0,0,0,{1615,18},{0,0},{0,0},{1654,3},{1685,1},{0,0}},
+  {11,3,0,0,0,0,0,0,1,0,255,0,0,0,0,{1709,28},{0,0},{0,0},{1758,1},{1786,1},{0,0}},
+  {12,9,1,0,0,0,0,0,1,0,100,0,0,12,4,{1810,7},{0,0},{0,0},{1940,1},{0,0},{0,0}},
+  {0,13,0,0,0,0,0,0,1,0,100,0,0,0,0,{1961,25},{0,0},{0,0},{0,0},{0,0},{0,0}},
+  {13,3,0,0,0,0,0,0,1,0,4000,0,0,0,0,{2019,21},{0,0},{0,0},{2061,3},{2092,1},{0,0}},
+  {14,3,0,0,0,0,0,0,1,0,255,0,0,0,0,{2116,31},{0,0},{0,0},{2168,1},{2196,1},{0,0}},
+  {15,9,1,0,0,0,0,0,1,0,100,0,0,16,4,{2220,7},{0,0},{0,0},{2350,1},{0,0},{0,0}},
+};
+const paramIdxOption_s paramDeviceBpnIdxOptions[] PROGMEM = {
+  {{333,1},{341,12},0},
+  {{362,1},{370,9},0},
+  {{461,1},{469,12},0},
+  {{490,1},{498,9},0},
+  {{922,1},{930,3},0},
+  {{942,1},{950,8},0},
+  {{967,1},{975,8},0},
+  {{992,1},{1000,2},0},
+  {{1444,1},{1452,3},0},
+  {{1464,1},{1472,8},0},
+  {{1489,1},{1497,8},0},
+  {{1514,1},{1522,2},0},
+  {{1845,1},{1853,3},0},
+  {{1865,1},{1873,8},0},
+  {{1890,1},{1898,8},0},
+  {{1915,1},{1923,2},0},
+  {{2255,1},{2263,3},0},
+  {{2275,1},{2283,8},0},
+  {{2300,1},{2308,8},0},
+  {{2325,1},{2333,2},0},
+};
+const paramIdx_s paramDeviceBpnIdx = {paramDeviceBpnIdxEntries, paramDeviceBpnIdxOptions, 25, 25};
+
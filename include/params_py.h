@@ -88,6 +88,14 @@ const String paramSystem PROGMEM = "{'page':["
     "'unit':'min',"
     "'dt':"+String(PARAM_DT_U8)+""
   "},"
+  "{"
+    "'name':"+String(ID_PARAM_DISPLAY_BULK_DATA)+","
+    "'label':'Display Bulk-Daten',"
+    "'type':"+String(HTML_INPUTCHECKBOX)+","
+    "'default':0,"
+    "'dt':"+String(PARAM_DT_BO)+","
+    "'help':'Die Daten eines BMS werden in einem Frame an das Display gesendet.\nNur aktivieren, wenn die Firmware des Displays den Bulk-Frame unterstützt.'"
+  "},"
 
   "{"
     "'label':'WLAN',"
@@ -217,6 +225,14 @@ const String paramSystem PROGMEM = "{'page':["
     "'max':120,"
     "'dt':"+String(PARAM_DT_U8)+""
   "},"
+  "{"
+    "'name':"+String(ID_PARAM_MQTT_AGGREGATED)+","
+    "'label':'JSON pro Gerät',"
+    "'type':"+String(HTML_INPUTCHECKBOX)+","
+    "'default':0,"
+    "'dt':"+String(PARAM_DT_BO)+","
+    "'help':'Die Daten eines BMS werden als ein JSON-Dokument an bms/bt/&lt;nr&gt; bzw. bms/serial/&lt;nr&gt; gesendet, die Onewire-Temperaturen als ein Dokument an temperatur.\nDie Einzelnachrichten der BMS-Daten entfallen.'"
+  "},"
 
   "{"
     "'label':'NTP',"
@@ -257,6 +273,37 @@ const String paramSystem PROGMEM = "{'page':["
     "'default':0,"
     "'dt':"+String(PARAM_DT_U8)+""
   "},"
+  "{"
+    "'name':"+String(ID_PARAM_SYSTEM_RECORD_VALUES_TIER0_PERIODE)+","
+    "'label':'Intervall 10 Minuten',"
+    "'help':'Die Werte werden jede Sekunde erfasst und über das Intervall zusammengefasst (min/max/Mittelwert).\nEine Änderung löscht die bisherige Aufzeichnung der Stufe.',"
+    "'type':"+String(HTML_INPUTNUMBER)+","
+    "'default':1,"
+    "'min':1,"
+    "'max':60,"
+    "'unit':'s',"
+    "'dt':"+String(PARAM_DT_U16)+""
+  "},"
+  "{"
+    "'name':"+String(ID_PARAM_SYSTEM_RECORD_VALUES_TIER1_PERIODE)+","
+    "'label':'Intervall 24 Stunden',"
+    "'type':"+String(HTML_INPUTNUMBER)+","
+    "'default':60,"
+    "'min':10,"
+    "'max':3600,"
+    "'unit':'s',"
+    "'dt':"+String(PARAM_DT_U16)+""
+  "},"
+  "{"
+    "'name':"+String(ID_PARAM_SYSTEM_RECORD_VALUES_TIER2_PERIODE)+","
+    "'label':'Intervall 7 Tage',"
+    "'type':"+String(HTML_INPUTNUMBER)+","
+    "'default':900,"
+    "'min':60,"
+    "'max':21600,"
+    "'unit':'s',"
+    "'dt':"+String(PARAM_DT_U16)+""
+  "},"
 
   "{"
     "'label':'Triggername',"
@@ -388,6 +435,34 @@ const String paramSerial PROGMEM = "{'page':["
     "'dt':"+String(PARAM_DT_U8)+""
   "},"
 
+  //Pollintervall
+  "{"
+    "'label':'Pollintervall',"
+    "'type':"+String(HTML_SEPARATION)+""
+  "},"
+  "{"
+    "'name':"+String(ID_PARAM_BMS_POLL_INTERVAL_MIN)+","
+    "'label':'Min. Intervall',"
+    "'help':'Das Intervall jedes BMS (Serial und Bluetooth) passt sich der Änderung von Strom und Zellspannungen an.\nBei starker Änderung wird das BMS bis zu diesem Intervall abgefragt.\nDie JK-BMS (Bluetooth) senden von sich aus, ihre Daten werden höchstens so oft ausgewertet, wie sie gesendet werden.',"
+    "'type':"+String(HTML_INPUTNUMBER)+","
+    "'default':500,"
+    "'min':100,"
+    "'max':3000,"
+    "'unit':'ms',"
+    "'dt':"+String(PARAM_DT_U16)+""
+  "},"
+  "{"
+    "'name':"+String(ID_PARAM_BMS_POLL_INTERVAL_MAX)+","
+    "'label':'Max. Intervall',"
+    "'help':'Intervall eines BMS ohne Änderung von Strom und Zellspannungen.\nDaten älter als 5 s gelten als ungültig, daher max. 3000 ms.',"
+    "'type':"+String(HTML_INPUTNUMBER)+","
+    "'default':3000,"
+    "'min':500,"
+    "'max':3000,"
+    "'unit':'ms',"
+    "'dt':"+String(PARAM_DT_U16)+""
+  "},"
+
   //Filter
   "{"
     "'label':'Filter',"
@@ -893,6 +968,29 @@ const String paramOnewire2 PROGMEM = "{'page':["
         "'min':-10,"
         "'max':10,"
         "'dt':"+String(PARAM_DT_FL)+""
+      "},"
+      "{"
+        "'name':"+String(ID_PARAM_ONWIRE_RESOLUTION)+","
+        "'label':'Aufl&ouml;sung',"
+        "'type':"+String(HTML_INPUTSELECT)+","
+        "'options':["
+          "{'v':9,'l':'9 Bit (0.5&deg;C, 93ms)'},"
+          "{'v':10,'l':'10 Bit (0.25&deg;C, 187ms)'},"
+          "{'v':11,'l':'11 Bit (0.125&deg;C, 375ms)'},"
+          "{'v':12,'l':'12 Bit (0.0625&deg;C, 750ms)'}"
+          "],"
+        "'default':12,"
+        "'dt':"+String(PARAM_DT_U8)+""
+      "},"
+      "{"
+        "'name':"+String(ID_PARAM_ONWIRE_REFRESH_INTERVAL)+","
+        "'label':'Messintervall',"
+        "'unit':'s',"
+        "'type':"+String(HTML_INPUTNUMBER)+","
+        "'default':5,"
+        "'min':1,"
+        "'max':3600,"
+        "'dt':"+String(PARAM_DT_U16)+""
       "}"
     "]"
   "}"
@@ -930,6 +1028,50 @@ const String paramBmsToInverter PROGMEM = "{'page':["
     "'default':'0',"
     "'dt':"+String(PARAM_DT_BO)+""
   "},"
+  "{"
+    "'name':"+String(ID_PARAM_BMS_CAN_EXTENDED_DATA_FRAMES)+","
+    "'label':'Extended data Frames pro Zyklus',"
+    "'type':"+String(HTML_INPUTNUMBER)+","
+    "'default':0,"
+    "'min':0,"
+    "'max':50,"
+    "'unit':'Frames',"
+    "'dt':"+String(PARAM_DT_U8)+","
+    "'help':'Jedes BMS sendet 8 Frames (Zellspannungen 1-24, FET-Status, Balancing-Strom).\nBei 0 werden pro Zyklus alle Frames eines BMS gesendet.\nSonst werden pro Zyklus max. so viele Frames gesendet und im nächsten Zyklus fortgesetzt (begrenzt die Buslast).'"
+  "},"
+  "{"
+    "'name':"+String(ID_PARAM_BMS_CAN_RX_QUEUE_LENGTH)+","
+    "'label':'RX Queue',"
+    "'type':"+String(HTML_INPUTNUMBER)+","
+    "'default':32,"
+    "'min':5,"
+    "'max':100,"
+    "'unit':'Frames',"
+    "'dt':"+String(PARAM_DT_U8)+","
+    "'help':'Anzahl der Frames, die der Canbus-Treiber zwischenspeichern kann.\nÄnderungen werden erst nach einem Neustart übernommen.'"
+  "},"
+  "{"
+    "'name':"+String(ID_PARAM_BMS_CAN_TX_QUEUE_LENGTH)+","
+    "'label':'TX Queue',"
+    "'type':"+String(HTML_INPUTNUMBER)+","
+    "'default':32,"
+    "'min':5,"
+    "'max':100,"
+    "'unit':'Frames',"
+    "'dt':"+String(PARAM_DT_U8)+","
+    "'help':'Anzahl der Frames, die zum Senden zwischengespeichert werden können.\nÄnderungen werden erst nach einem Neustart übernommen.'"
+  "},"
+  "{"
+    "'name':"+String(ID_PARAM_BMS_CAN_TX_FRAME_GAP)+","
+    "'label':'Pause zwischen TX Frames',"
+    "'type':"+String(HTML_INPUTNUMBER)+","
+    "'default':0,"
+    "'min':0,"
+    "'max':20,"
+    "'unit':'ms',"
+    "'dt':"+String(PARAM_DT_U8)+","
+    "'help':'Bei 0 werden die Frames so schnell gesendet, wie es der Bus zulässt.\nNur erhöhen, wenn der Wechselrichter Frames verliert.'"
+  "},"
   "{"
     "'name':"+String(ID_PARAM_BMS_CAN_DATASOURCE)+","
     "'label':'Datenquelle (Master)',"
@@ -8,7 +8,10 @@
 
 #include <Arduino.h>
 #include <WebServer.h>
+#include "WebAssets.hpp"
 
+void webUtilityCollectHeaders(WebServer &server);
+void sendWebAsset(WebServer &server, const webassets::Asset &asset);
 bool handleFileRead(fs::FS &fs, WebServer &server, bool fsIsSpiffs, const String &path);
 void handleFileUpload(fs::FS &fs, WebServer &server, bool fsIsSpiffs, const String &fileName);
 
@@ -0,0 +1,727 @@
+/* ***********************************************************************************
+* Wichtiger Hinweis!
+* webpages_gz.h nicht manuell bearbeiten! Die Datei wird beim Build aus der webpages.h erstellt!
+* ***********************************************************************************/
+#ifndef WEBPAGES_GZ_H
+#define WEBPAGES_GZ_H
+
+#include "webpages.h"
+#include "WebAssets.hpp"
+
+// htmlPageRoot: 5708 -> 1642 Byte
+const uint8_t htmlPageRootGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xC5,0x58,0x0D,0x6F,0xDB,0x36,0x10,0xFD,0x2B,0xDC,
+  0x8A,0x95,0x36,0x16,0xC9,0x92,0x96,0x8F,0x4E,0xB2,0x0C,0xC4,0x4D,0xD2,0x0C,0x68,0xB1,0xAC,0x31,0xBA,
+  0x0D,0x43,0x10,0x50,0x12,0x65,0x11,0x91,0x28,0x95,0xA4,0x9C,0x78,0x99,0xFF,0xFB,0x8E,0x94,0xEC,0x38,
+  0x89,0x1B,0x2B,0x6D,0xB0,0xC5,0xB0,0x2C,0x7E,0xDC,0xE3,0x7B,0x27,0xF2,0xEE,0x94,0xE1,0x77,0x47,0xBF,
+  0xBE,0x9D,0xFC,0x79,0x76,0x8C,0x4E,0x27,0x1F,0xDE,0x8F,0x86,0x99,0x2A,0x72,0xB8,0x52,0x92,0x8C,0x86,
+  0x8A,0xA9,0x9C,0x8E,0xC6,0xE7,0x6F,0x87,0x83,0xE6,0x76,0x58,0x50,0x45,0x50,0xA6,0x54,0x65,0xD1,0xCF,
+  0x35,0x9B,0x85,0xF8,0x6D,0xC9,0x15,0xE5,0xCA,0x9A,0xCC,0x2B,0x8A,0x51,0xDC,0xB4,0x42,0xAC,0xE8,0x8D,
+  0x1A,0x68,0xA8,0x00,0xC5,0x19,0x11,0x92,0xAA,0xB0,0x56,0xA9,0xF5,0x06,0xB7,0x10,0x9C,0x14,0x34,0xC4,
+  0x33,0x46,0xAF,0xAB,0x52,0xA8,0x35,0xC3,0x6B,0x96,0xA8,0x2C,0x4C,0xE8,0x8C,0xC5,0xD4,0x32,0x8D,0x1D,
+  0xC4,0x38,0x53,0x8C,0xE4,0x96,0x8C,0x49,0x4E,0x43,0x17,0x30,0x72,0xC6,0xAF,0x90,0xA0,0x79,0x88,0x19,
+  0x58,0x62,0x94,0x09,0x9A,0x86,0x38,0x21,0x8A,0xF8,0x3B,0x30,0x2C,0xD5,0x1C,0xC8,0xEA,0xE5,0xD1,0x6D,
+  0x0A,0xC8,0x56,0x4A,0x0A,0x96,0xCF,0xFD,0x53,0x9A,0xCF,0xA8,0x62,0x31,0x09,0x12,0x26,0xAB,0x9C,0xCC,
+  0x7D,0xC6,0x01,0x8A,0x5A,0x51,0x5E,0xC6,0x57,0x41,0x41,0xC4,0x94,0x71,0xDF,0xA9,0x6E,0x10,0xA9,0x55,
+  0x19,0x68,0x11,0x16,0xC9,0xD9,0x94,0xFB,0x31,0x90,0xA3,0x22,0x58,0x44,0x65,0x32,0x47,0xB7,0xCB,0x89,
+  0xC1,0xC2,0x6E,0x89,0xA3,0xDB,0x8A,0x24,0x09,0xE3,0x53,0xDF,0x03,0x73,0xE8,0x57,0x65,0xC5,0xC9,0x0C,
+  0xDD,0x96,0x33,0x2A,0xD2,0xBC,0xBC,0xF6,0x51,0xC6,0x92,0x84,0xF2,0xA0,0x2A,0x25,0xA8,0x29,0xB9,0x2F,
+  0x81,0xC8,0xD5,0x3C,0x80,0x89,0x00,0x14,0x91,0xF8,0x6A,0x2A,0xCA,0x9A,0x27,0x56,0x5C,0xE6,0xA5,0xF0,
+  0x5F,0xED,0x1F,0xEB,0x4F,0xD0,0xB4,0xAE,0x33,0xA6,0x68,0xB0,0x5C,0x62,0x0F,0x56,0x88,0x6B,0x21,0x61,
+  0x20,0xA1,0x29,0xA9,0x73,0x75,0xB7,0xA0,0xAC,0x08,0x07,0xD1,0x79,0x49,0x94,0x9F,0xD3,0x54,0x05,0x68,
+  0x69,0x85,0xDC,0x5D,0x10,0xE6,0xEE,0x83,0x31,0x32,0xCA,0x12,0x1A,0x97,0x82,0x18,0x2E,0xBC,0xE4,0x34,
+  0x40,0xC6,0x55,0x92,0xFD,0x4D,0x7D,0xD7,0x3E,0x10,0xB4,0x00,0xD4,0x48,0xF1,0x31,0x50,0xF3,0x33,0xAD,
+  0x03,0xDD,0x3E,0xA6,0xB9,0x67,0xFE,0xEE,0xD1,0x5C,0xD8,0x99,0xF6,0x7B,0x4E,0x6F,0x7C,0x37,0xB8,0xC3,
+  0xF4,0x1A,0xC4,0x98,0x88,0x44,0x3E,0x70,0x57,0x41,0x6E,0x9A,0x67,0xED,0x1F,0x38,0x4D,0xBB,0xF1,0x6F,
+  0xF3,0x18,0x96,0xCF,0x6A,0x2A,0x58,0x12,0xE8,0x8B,0x35,0x25,0x55,0x03,0x67,0x5A,0x8A,0x16,0x30,0xAE,
+  0xA8,0xA6,0x54,0x17,0x5C,0xFA,0x82,0x56,0x94,0xA8,0x9E,0x36,0xB6,0x52,0xA6,0x76,0x0A,0xC6,0x61,0x85,
+  0x9E,0xA7,0xB1,0x77,0xDC,0x54,0xF4,0xFB,0x2D,0x8F,0xB1,0xE2,0x1B,0x34,0x35,0x2A,0xA2,0xF2,0xC6,0x92,
+  0x19,0x49,0xE0,0xD1,0x79,0xE0,0x37,0xFD,0x75,0xCD,0x05,0xBE,0x62,0x1A,0x91,0x9E,0xBB,0xEB,0xEC,0x2C,
+  0xBF,0xF6,0x5E,0x3F,0xD8,0xE8,0xD3,0x35,0xF9,0xC6,0xF1,0x8F,0x1E,0x9B,0xA6,0x71,0x44,0x64,0xB6,0xC9,
+  0xB7,0x27,0x9E,0xFE,0xFC,0xD7,0x4C,0x36,0x3B,0xE5,0x7F,0x20,0x03,0x44,0x9E,0xB9,0xEF,0xD6,0x24,0x3C,
+  0xD3,0x32,0xAA,0x95,0x2A,0x37,0xEA,0x1E,0x1F,0xE9,0x0F,0xE8,0x16,0x09,0x15,0x0D,0xFB,0xE6,0xDE,0x12,
+  0x24,0x61,0xB5,0xF4,0x5D,0xBD,0x63,0x37,0x1D,0x53,0x7D,0xD4,0xD0,0xAE,0x1E,0xED,0xE2,0x83,0x76,0xCF,
+  0x7B,0x9B,0xCE,0x76,0xC3,0xEE,0xAB,0x24,0xF9,0x24,0x56,0x6C,0x46,0xD1,0xED,0x7D,0x39,0x0B,0x88,0xC2,
+  0x1A,0xAB,0x5D,0x15,0x39,0x48,0x1F,0xC4,0xF6,0x27,0x58,0x0C,0x07,0x4D,0x08,0x1D,0x0E,0x9A,0x44,0xA0,
+  0xC3,0xDE,0x68,0x98,0xB0,0x19,0x8A,0x73,0x22,0x25,0xC4,0x77,0x13,0x6D,0x74,0xA8,0xD5,0xF1,0xA6,0xED,
+  0xCC,0x72,0x3C,0x1A,0x13,0x05,0xC0,0x73,0x74,0x4E,0x52,0xAA,0xE6,0x48,0xA7,0x07,0x51,0xE6,0x39,0x15,
+  0xAF,0x79,0x24,0xAB,0x60,0xFD,0xFA,0xC9,0xB1,0xF7,0x6C,0x77,0x17,0xD6,0x02,0x0C,0x58,0x0A,0xE0,0xEF,
+  0xAD,0xD1,0x86,0x56,0x7C,0xBF,0x53,0x87,0x8F,0xC7,0x5D,0xED,0x53,0xC7,0xA8,0xE4,0x71,0x0E,0x71,0x35,
+  0xFC,0x1E,0x22,0xBA,0x71,0xB6,0xDD,0xE4,0x06,0x7B,0x00,0x39,0x48,0xC1,0x63,0x91,0x03,0x39,0x97,0x10,
+  0x32,0x06,0xF8,0xFB,0xD1,0xB0,0x1A,0xFD,0xCE,0x4E,0xD8,0x30,0x12,0x26,0x2D,0x81,0x43,0x58,0x12,0x62,
+  0x73,0x77,0x79,0xCD,0x52,0xF6,0x51,0x4A,0x86,0x11,0x84,0x8F,0x10,0x3B,0xF0,0x4B,0x6E,0x42,0x7C,0x00,
+  0x37,0x33,0x92,0xD7,0x54,0x77,0x01,0x69,0x33,0x19,0x7E,0xAB,0x4D,0x02,0xBE,0x85,0xD8,0xB9,0x69,0x18,
+  0x6A,0xC6,0xC7,0x9A,0x99,0x06,0xBC,0x6C,0x66,0xE9,0xB5,0x5B,0xBF,0xBD,0xF8,0xD2,0x1F,0x7E,0x9B,0x4C,
+  0x36,0x2C,0x5C,0x7C,0x56,0xAA,0xE3,0xB2,0xF8,0xCE,0x2A,0x15,0x94,0xC2,0x26,0xAA,0x70,0xB7,0xE9,0x51,
+  0x59,0x02,0xA5,0x82,0xE2,0x97,0x10,0x15,0x67,0x50,0x39,0x28,0x50,0x06,0x1B,0x90,0x0F,0x22,0xD5,0xEA,
+  0x1B,0x4F,0xAC,0x23,0x53,0x60,0xC8,0x61,0x93,0xD7,0xA1,0xD2,0x21,0x51,0x4E,0x91,0xD9,0xF4,0xB0,0x01,
+  0xCC,0xA1,0xB0,0x74,0x66,0x46,0x96,0x6B,0x7C,0xAD,0xF4,0x9C,0x64,0xE4,0xDA,0xF6,0x1E,0xD4,0x42,0x89,
+  0x69,0x3C,0x70,0x4F,0xA4,0xDC,0x35,0xEF,0xE8,0xF1,0x81,0xB1,0x6A,0x2C,0xF7,0x6D,0xFB,0x60,0x7D,0xF3,
+  0x7F,0x19,0xC5,0xDB,0x84,0x32,0x30,0x04,0xE1,0x77,0x49,0xF8,0x69,0xF7,0x6B,0x95,0x13,0xC1,0xA6,0x53,
+  0x2A,0x5E,0x52,0x22,0xC9,0x89,0x28,0xB6,0xA8,0x74,0x9D,0x2E,0x32,0x0D,0xD2,0x4B,0x29,0x3D,0xA7,0x02,
+  0xCA,0x43,0x34,0xFE,0x70,0x8E,0x7A,0x8E,0xE5,0xF5,0xBB,0x49,0x5E,0xAF,0x77,0x4C,0xD4,0xBB,0xF3,0x81,
+  0xF3,0x24,0xF9,0x71,0x21,0x9D,0x4F,0x2B,0xEA,0x9F,0x9E,0x98,0x75,0xB8,0x9A,0x75,0xF8,0xC4,0xAC,0xB3,
+  0xD5,0xAC,0x1F,0x1E,0x7B,0xD4,0xDD,0x46,0xC5,0xED,0x44,0xC5,0xED,0x44,0xC5,0x7D,0x92,0x8A,0xB7,0x8D,
+  0x8A,0xD7,0x89,0x8A,0xD7,0x89,0x8A,0xB7,0x99,0x4A,0xF7,0xDD,0xB1,0x25,0x48,0xE4,0x90,0x14,0xF5,0xFB,
+  0x42,0x1B,0x12,0xDE,0x37,0x4D,0xCA,0xBF,0x1A,0x70,0x15,0x75,0x1A,0xC0,0x63,0xC6,0x4D,0xDC,0xA9,0xF9,
+  0xF4,0x1B,0x40,0xF3,0x72,0xDA,0xF2,0x2B,0xA7,0x5D,0x41,0xAE,0x19,0x87,0xEA,0xCC,0x2E,0x2B,0xCA,0x7B,
+  0x58,0xBF,0xAA,0x49,0x7F,0x30,0x98,0x32,0x95,0xD5,0x11,0xBC,0xAD,0x14,0x03,0x99,0xC1,0xFB,0x14,0x9F,
+  0x5A,0x05,0x81,0x90,0x28,0xE3,0xCB,0xF4,0x1A,0xEF,0xE0,0xCB,0x28,0x27,0xFC,0x0A,0xF7,0x83,0x26,0x40,
+  0x9E,0xBF,0x05,0x3C,0xF4,0x8E,0xA9,0xD3,0x3A,0x5A,0x5B,0xF7,0xDE,0xB5,0xA9,0x09,0x64,0x2C,0x58,0xA5,
+  0x46,0x69,0xCD,0x63,0xCD,0x1C,0x4D,0xA9,0x3A,0x02,0xB7,0xF6,0xFA,0xE8,0x76,0x46,0x04,0xBA,0xD1,0x04,
+  0x50,0x88,0x38,0xBD,0x46,0x7F,0x7C,0x78,0x7F,0x0A,0xAD,0x8F,0xF0,0xE6,0x48,0xA5,0xEA,0xF5,0x03,0x33,
+  0x68,0x97,0x5C,0x40,0x8D,0x01,0xF9,0x07,0xDC,0x0F,0xEF,0x8A,0xE0,0x2F,0x98,0xBF,0xC4,0xD3,0x38,0x2C,
+  0x45,0x3D,0x95,0x31,0x69,0x9B,0x79,0xE7,0x7A,0x1E,0x0A,0x43,0xB4,0x8B,0x5E,0xBF,0x46,0xA6,0x5F,0x9B,
+  0xD6,0x52,0xF7,0x41,0x89,0xDF,0x2E,0x6C,0x72,0x34,0xF4,0xA1,0xD6,0x52,0x56,0x25,0x97,0x74,0x02,0x85,
+  0x98,0x0D,0x6F,0x13,0x4C,0xF5,0xF0,0x3F,0xA0,0x36,0x29,0xE3,0xBA,0x80,0x9D,0x64,0x03,0xED,0xE3,0x9C,
+  0xEA,0xDB,0xF1,0xFC,0x97,0xA4,0xF7,0x20,0x75,0xF5,0x6D,0xC6,0x39,0x15,0xFA,0x05,0x19,0x10,0x31,0x78,
+  0xE8,0x04,0x86,0xD0,0x29,0x8C,0xE9,0x3C,0x89,0xD1,0x8F,0xED,0x7A,0x7F,0x39,0x17,0x70,0x8F,0xB5,0xCB,
+  0xF0,0x16,0xF0,0x36,0x96,0xDE,0x87,0x6E,0x51,0xDC,0x8B,0x2E,0xC6,0xDE,0x66,0x63,0xEF,0x22,0x60,0x69,
+  0xAF,0x6D,0xFC,0x74,0x11,0x86,0x18,0x56,0x41,0xB7,0x4F,0x03,0x9A,0xDC,0xFE,0x40,0x26,0xD4,0x5F,0x9C,
+  0xC6,0x8A,0x26,0xDB,0xA4,0xB4,0xC6,0x26,0xCE,0xDA,0xA6,0xCE,0xD4,0xE6,0xAF,0x1C,0xE7,0xE4,0xC4,0x71,
+  0x70,0xB0,0xA0,0xB9,0xA4,0x5F,0xB1,0x3E,0xBC,0xF7,0x7D,0x2B,0x05,0x4D,0xC0,0x50,0xB8,0xF3,0xC8,0xAE,
+  0xF6,0x88,0xB3,0xDD,0x23,0x6D,0x99,0xF5,0x80,0x93,0xA8,0xB9,0x3E,0x3C,0xDB,0xE8,0xAC,0x8C,0xBF,0xC5,
+  0x27,0x9B,0x19,0xA4,0x84,0xE5,0xB5,0xA0,0xA8,0xB7,0xB6,0xEB,0x76,0xCD,0xAE,0xEB,0x7F,0x35,0xAB,0x95,
+  0x9B,0x9E,0xB6,0xD7,0x15,0xCE,0xC6,0x2D,0xB7,0xB7,0x6D,0xBF,0xEA,0xAA,0x66,0xA3,0xE5,0xFE,0x13,0x96,
+  0x0F,0xEA,0xF0,0xBE,0x6D,0x6C,0xEE,0x6C,0x0F,0xB6,0xAE,0xBA,0xAC,0x25,0x1F,0x9F,0xDF,0x31,0x0C,0xA1,
+  0x09,0x8C,0x3D,0x38,0xBF,0x6F,0xBA,0x9E,0xDF,0xA6,0x08,0xD8,0xA8,0xE9,0xE7,0x8B,0x65,0x88,0x09,0x70,
+  0x1F,0x22,0xC2,0x76,0xA0,0xC3,0x2E,0x40,0x6E,0x07,0xA0,0xB3,0x2E,0x40,0xDE,0x76,0x20,0xF7,0x0B,0xD2,
+  0x5C,0xE7,0xB9,0xDA,0xDC,0xC3,0x4E,0x48,0x1D,0xC4,0xB9,0x67,0x9D,0x90,0x3A,0xA8,0xF3,0xBE,0xA4,0xCE,
+  0x7D,0xAE,0x3A,0xEF,0xB0,0x13,0x52,0x07,0x75,0xDE,0x59,0x27,0x24,0x50,0xB7,0x58,0x2C,0x13,0xA7,0xC9,
+  0xF0,0xEF,0x8E,0x27,0x78,0x07,0x61,0x93,0x77,0x65,0x16,0x95,0xA6,0x30,0x56,0x04,0xFA,0x94,0xA8,0xE9,
+  0x32,0xC9,0xEA,0x63,0x50,0xD6,0x2A,0x74,0xE1,0x9C,0xB7,0x5D,0x92,0xF2,0x04,0x92,0xB0,0x4E,0x96,0x7A,
+  0x54,0x47,0x82,0xB6,0x74,0x80,0x52,0x66,0xD2,0xCC,0xEF,0xE1,0x55,0x3E,0x07,0x40,0xC8,0xAE,0x4E,0x3F,
+  0x58,0xAC,0xBA,0xA0,0x14,0x6C,0xD3,0xFF,0xD0,0xFC,0xAF,0x77,0xF4,0x2F,0xB5,0x7C,0x5C,0xD6,0x4C,0x16,
+  0x00,0x00,
+};
+const webassets::Asset htmlPageRootAsset = {htmlPageRootGz, sizeof(htmlPageRootGz), htmlPageRoot, "text/html", "\"28c33610eb64d6bc\""};
+
+// htmlPageSettings: 2463 -> 899 Byte
+const uint8_t htmlPageSettingsGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xC5,0x56,0xDB,0x8E,0xDB,0x36,0x10,0xFD,0x15,0x36,
+  0x01,0x56,0x36,0x60,0x59,0x96,0xB1,0x9B,0xA0,0xBA,0x15,0xDD,0xEC,0x06,0x79,0x48,0xD1,0x20,0x49,0x51,
+  0xF4,0xA9,0xA0,0xA8,0x91,0x45,0x2C,0x45,0x0A,0x24,0xE5,0x4B,0x0D,0xFF,0x7B,0x87,0xA2,0xDC,0xAC,0xB3,
+  0x46,0xBA,0xF1,0x43,0x6B,0x41,0xB4,0x48,0x6A,0xCE,0x9C,0x33,0xE4,0x0C,0x95,0xFD,0x70,0xF7,0xEB,0x9B,
+  0xCF,0x7F,0x7C,0xB8,0x27,0xEF,0x3E,0xFF,0xF2,0xBE,0xC8,0x1A,0xDB,0x0A,0x6C,0x81,0x56,0x45,0x66,0xB9,
+  0x15,0x50,0xDC,0x7E,0x7A,0x93,0x45,0xFE,0x31,0x6B,0xC1,0x52,0x22,0x69,0x0B,0x79,0xB0,0xE6,0xB0,0xE9,
+  0x94,0xB6,0x01,0x61,0x4A,0x5A,0x90,0x36,0x0F,0x36,0xBC,0xB2,0x4D,0x5E,0xC1,0x9A,0x33,0x08,0x87,0xCE,
+  0x8C,0x70,0xC9,0x2D,0xA7,0x22,0x34,0x8C,0x0A,0xC8,0xE3,0xA0,0xC8,0x04,0x97,0x0F,0x44,0x83,0xC8,0x03,
+  0x8E,0x96,0x01,0x69,0x34,0xD4,0x79,0x50,0x51,0x4B,0x93,0x19,0x4E,0x1B,0xBB,0x43,0x4F,0x8E,0x06,0xD9,
+  0xD7,0x88,0x1C,0xD6,0xB4,0xE5,0x62,0x97,0xBC,0x03,0xB1,0x06,0xCB,0x19,0x4D,0x2B,0x6E,0x3A,0x41,0x77,
+  0x09,0x97,0x08,0x05,0x61,0x29,0x14,0x7B,0x48,0x5B,0xAA,0x57,0x5C,0x26,0x8B,0x6E,0x4B,0x68,0x6F,0x55,
+  0x6A,0x61,0x6B,0x43,0x2A,0xF8,0x4A,0x26,0x0C,0xC9,0x81,0x4E,0x0F,0xA5,0xAA,0x76,0x64,0x7F,0x7C,0x31,
+  0x3D,0xCC,0x47,0xE2,0x64,0xDF,0xD1,0xAA,0xE2,0x72,0x95,0x2C,0xD1,0x1C,0xC7,0xAD,0xEA,0x24,0x5D,0x93,
+  0xBD,0x5A,0x83,0xAE,0x85,0xDA,0x24,0xA4,0xE1,0x55,0x05,0x32,0xED,0x94,0x41,0x35,0x4A,0x26,0x06,0x89,
+  0x3C,0xEC,0x52,0x7C,0x11,0x81,0x4A,0xCA,0x1E,0x56,0x5A,0xF5,0xB2,0x0A,0x99,0x12,0x4A,0x27,0x2F,0x5F,
+  0xDD,0xBB,0x2B,0xF5,0xBD,0x4D,0xC3,0x2D,0xA4,0x47,0x17,0x37,0xE8,0x81,0xF5,0xDA,0xE0,0x44,0x05,0x35,
+  0xED,0x85,0xFD,0xE2,0xD0,0x74,0x54,0xA2,0x68,0xA1,0xA8,0x4D,0x04,0xD4,0x36,0x25,0x47,0x2B,0x12,0x5F,
+  0xA3,0xB0,0xF8,0x15,0x1A,0x93,0x41,0x59,0x05,0x4C,0x69,0x3A,0x70,0x91,0x4A,0x42,0x4A,0x86,0x50,0x19,
+  0xFE,0x17,0x24,0xF1,0xFC,0xB5,0x86,0x16,0x51,0x4B,0x2B,0x6F,0x91,0x5A,0xD2,0x38,0x1D,0x64,0xFF,0x94,
+  0xE6,0xCD,0xF0,0x3B,0xA1,0x79,0x98,0x37,0x2E,0xEE,0x02,0xB6,0x49,0x9C,0x7E,0xC1,0x5C,0x7A,0x44,0x46,
+  0x75,0x65,0xBE,0x0A,0x57,0x4B,0xB7,0x7E,0xAD,0x93,0xD7,0x0B,0xDF,0xF7,0xF1,0xF5,0xCB,0x70,0x5C,0xAB,
+  0x95,0xE6,0x55,0xEA,0x9A,0x70,0x45,0x3B,0x0F,0x37,0xF4,0x2C,0xB4,0x38,0x6F,0xC1,0x51,0xEA,0x5B,0x69,
+  0x12,0x0D,0x1D,0x50,0x3B,0x71,0xC6,0x61,0xCD,0xED,0xAC,0xE5,0x12,0x3D,0x4C,0x96,0x0E,0x7B,0x16,0xD7,
+  0x7A,0x3A,0x1D,0x79,0xDC,0x5A,0x79,0x46,0x93,0x57,0x51,0xAA,0x6D,0x68,0x1A,0x5A,0xE1,0xD2,0x2D,0x31,
+  0x6E,0xEE,0x8E,0x87,0x06,0x6F,0xBD,0x2A,0xE9,0x24,0xBE,0x5E,0xCC,0x8E,0xF7,0xFC,0x66,0x9A,0x9E,0x8D,
+  0xE9,0x23,0xF9,0x43,0xE0,0x9F,0x2C,0x9B,0xA3,0x71,0x47,0x4D,0x73,0x2E,0xB6,0x6F,0x97,0xEE,0xFA,0xAF,
+  0x99,0x9C,0x0F,0xCA,0xFF,0x40,0x06,0x89,0x7C,0xE7,0xBE,0x7B,0x24,0xE1,0x3B,0x2D,0xCB,0xDE,0x5A,0x75,
+  0x56,0xF7,0xED,0x9D,0xBB,0x50,0xB7,0xAE,0x40,0x7B,0xF6,0xFE,0x39,0xD4,0xB4,0xE2,0xBD,0x49,0x62,0xB7,
+  0x63,0xCF,0xA5,0xA9,0x4B,0x35,0x72,0xED,0x66,0x9F,0x13,0x83,0x71,0xCF,0x2F,0xCF,0xE5,0xB6,0x67,0x77,
+  0x91,0xA4,0x84,0x32,0xCB,0xD7,0x40,0xF6,0xA7,0x72,0x0E,0x58,0x85,0x1D,0xD6,0xE8,0x95,0x2C,0x88,0x4B,
+  0xC4,0xF1,0x2F,0x3D,0x64,0x91,0x2F,0xA1,0x99,0x61,0x9A,0x77,0xB6,0xA8,0x7B,0xC9,0x1C,0x73,0xAC,0xB9,
+  0xA5,0x52,0x76,0x32,0x25,0xFB,0x35,0xD5,0x84,0x35,0xC0,0x1E,0x48,0xEE,0xAA,0x77,0xCD,0x75,0x3B,0x09,
+  0x3E,0x0E,0xD3,0x3F,0x05,0xD3,0x94,0xD7,0x64,0x32,0x4E,0xE7,0xC4,0xEA,0x1E,0xA6,0x7B,0xAC,0xB1,0x83,
+  0xFC,0xB9,0xAF,0xD6,0xF3,0x79,0xA4,0xC1,0x58,0xAA,0x6D,0x14,0xA4,0x07,0xE7,0xD2,0xFB,0xCA,0x22,0x7F,
+  0x72,0xB8,0x52,0x5B,0x64,0x15,0x5F,0x13,0x26,0xA8,0x31,0x79,0xE0,0x2B,0x9C,0x2B,0xEF,0xAE,0xC6,0x8D,
+  0x83,0x63,0x81,0x0A,0x88,0x92,0x4C,0x60,0x41,0xCD,0x5F,0x3C,0x75,0x13,0xBC,0x28,0xAE,0x5E,0xC6,0x8B,
+  0xC5,0x8F,0xD7,0x29,0x7A,0x41,0xE3,0x7F,0x81,0xF8,0x0A,0x21,0x0A,0xFE,0x31,0xFF,0x16,0x4C,0x23,0x82,
+  0xE2,0x9E,0x4B,0x63,0x41,0x88,0x5E,0xAE,0x40,0x1E,0x5F,0x8A,0x50,0xC3,0x89,0x90,0xF1,0xCC,0x08,0x4E,
+  0x07,0x5D,0x5D,0x7C,0x3A,0x84,0x5B,0xF9,0x1B,0xDA,0x22,0xB3,0x43,0x7F,0xAD,0x53,0x98,0x75,0xC5,0xA7,
+  0xA1,0x93,0x45,0xDD,0x39,0x9F,0xCF,0xC0,0x62,0x0D,0x1E,0xB4,0x76,0x10,0x00,0xF2,0x88,0x79,0x32,0x78,
+  0x31,0xB6,0x3F,0xD0,0xCD,0x08,0x7A,0xE7,0x7B,0x17,0xA3,0x51,0x41,0xF5,0x51,0xF4,0xCF,0xEE,0x59,0xC3,
+  0x0A,0xC4,0xE5,0xEC,0xCA,0xD6,0xFC,0xC9,0xE8,0x51,0xF2,0xEF,0xC0,0x1A,0x03,0x42,0x73,0xD6,0x60,0x8E,
+  0x5C,0xC9,0xD2,0x74,0xE9,0x55,0x56,0xEA,0xE2,0x3D,0xC5,0xB4,0x77,0x9E,0x70,0x79,0x2F,0xF6,0xB5,0xC1,
+  0x14,0xB1,0x74,0x74,0xF5,0x5B,0x87,0xDF,0x2C,0xF0,0x4C,0xAC,0xE0,0x98,0x7C,0x81,0x33,0xF5,0xA9,0xF6,
+  0xC8,0xF4,0xA4,0xF5,0xC9,0x13,0x0D,0x5F,0x62,0x7F,0x03,0xAF,0x08,0x10,0xAB,0x9F,0x09,0x00,0x00,
+};
+const webassets::Asset htmlPageSettingsAsset = {htmlPageSettingsGz, sizeof(htmlPageSettingsGz), htmlPageSettings, "text/html", "\"ee4fb77066938608\""};
+
+// htmlPageSchnittstellen: 2270 -> 814 Byte
+const uint8_t htmlPageSchnittstellenGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xC5,0x56,0x5D,0x8F,0xD3,0x38,0x14,0xFD,0x2B,0x5E,
+  0x90,0xC8,0x8C,0xD4,0x34,0x4D,0x35,0x03,0xDA,0x24,0xED,0x43,0x99,0x59,0x81,0x04,0x02,0xED,0xF0,0xB2,
+  0x8F,0x6E,0x7C,0x9B,0x58,0xE3,0xD8,0x91,0x7D,0xD3,0x8F,0xAD,0xFA,0xDF,0xF7,0x3A,0x4E,0x61,0xCA,0x54,
+  0x2C,0x0C,0x12,0x34,0x8A,0x5B,0xDB,0xB9,0xE7,0x9E,0x73,0x6D,0x9F,0xB4,0xF8,0xE3,0xE6,0xC3,0xEB,0x4F,
+  0xFF,0x7C,0xBC,0x65,0x6F,0x3E,0xBD,0x7F,0x37,0x2F,0x6A,0x6C,0x14,0xB5,0xC0,0xC5,0xBC,0x40,0x89,0x0A,
+  0xE6,0x8B,0xBB,0xD7,0x45,0x12,0x7E,0x16,0x0D,0x20,0x67,0x9A,0x37,0x30,0x8B,0xD6,0x12,0x36,0xAD,0xB1,
+  0x18,0xB1,0xD2,0x68,0x04,0x8D,0xB3,0x68,0x23,0x05,0xD6,0x33,0x01,0x6B,0x59,0x42,0xDC,0x77,0x46,0x4C,
+  0x6A,0x89,0x92,0xAB,0xD8,0x95,0x5C,0xC1,0x2C,0x8D,0xE6,0x85,0x92,0xFA,0x9E,0x59,0x50,0xB3,0x48,0x52,
+  0x64,0xC4,0x6A,0x0B,0xAB,0x59,0x24,0x38,0xF2,0x6C,0x44,0xD3,0x0E,0x77,0x94,0xC9,0xD3,0x60,0xFB,0x15,
+  0x21,0xC7,0x2B,0xDE,0x48,0xB5,0xCB,0xDE,0x80,0x5A,0x03,0xCA,0x92,0xE7,0x42,0xBA,0x56,0xF1,0x5D,0x26,
+  0x35,0x41,0x41,0xBC,0x54,0xA6,0xBC,0xCF,0x1B,0x6E,0x2B,0xA9,0xB3,0x49,0xBB,0x65,0xBC,0x43,0x93,0x23,
+  0x6C,0x31,0xE6,0x4A,0x56,0x3A,0x2B,0x89,0x1C,0xD8,0xFC,0xB0,0x34,0x62,0xC7,0xF6,0xC7,0x07,0xF3,0xC3,
+  0x78,0x20,0xCE,0xF6,0x2D,0x17,0x42,0xEA,0x2A,0x9B,0x52,0x38,0x8D,0xA3,0x69,0x35,0x5F,0xB3,0xBD,0x59,
+  0x83,0x5D,0x29,0xB3,0xC9,0x58,0x2D,0x85,0x00,0x9D,0xB7,0xC6,0x91,0x1A,0xA3,0x33,0x47,0x44,0xEE,0x77,
+  0x39,0x3D,0x48,0x40,0x4B,0x5E,0xDE,0x57,0xD6,0x74,0x5A,0xC4,0xA5,0x51,0xC6,0x66,0xCF,0x5F,0xDE,0xFA,
+  0x2B,0x0F,0xBD,0x4D,0x2D,0x11,0xF2,0x63,0x8A,0x6B,0xCA,0x50,0x76,0xD6,0xD1,0x84,0x80,0x15,0xEF,0x14,
+  0x7E,0x49,0xE8,0x5A,0xAE,0x49,0xB4,0x32,0x1C,0x33,0x05,0x2B,0xCC,0xD9,0x31,0x8A,0xA5,0x57,0x24,0x2C,
+  0x7D,0x49,0xC1,0xAC,0x57,0x26,0xA0,0x34,0x96,0xF7,0x5C,0xB4,0xD1,0x90,0xB3,0xBE,0x54,0x4E,0xFE,0x0B,
+  0x59,0x3A,0x7E,0x65,0xA1,0x21,0xD4,0x25,0xEA,0x05,0x51,0xCB,0x6A,0xAF,0x83,0xED,0x1F,0xD3,0xBC,0xEE,
+  0x3F,0x27,0x34,0x0F,0xE3,0xDA,0xD7,0x5D,0xC1,0x36,0x4B,0xF3,0x2F,0x98,0xD3,0x80,0x58,0x72,0x2B,0xDC,
+  0x57,0xE5,0x6A,0xF8,0x36,0xAC,0x75,0xF6,0x6A,0x12,0xFA,0xA1,0xBE,0x61,0x19,0x8E,0x6B,0x55,0x59,0x29,
+  0x72,0xDF,0xC4,0x15,0x6F,0x03,0x5C,0xDF,0x43,0x68,0x68,0x1E,0xC1,0x53,0xEA,0x1A,0xED,0x32,0x0B,0x2D,
+  0x70,0xBC,0xF0,0xC1,0xF1,0x4A,0xE2,0xA8,0x91,0x9A,0x32,0x5C,0x4C,0x3D,0xF6,0x28,0x5D,0xD9,0xCB,0xCB,
+  0x81,0xC7,0x02,0xF5,0x19,0x4D,0x41,0xC5,0xD2,0x6C,0x63,0x57,0x73,0x41,0x4B,0x37,0xA5,0xBA,0xF9,0x3B,
+  0xED,0x1B,0xBA,0x6D,0xB5,0xE4,0x17,0xE9,0xD5,0x64,0x74,0xBC,0xC7,0xD7,0x97,0xF9,0xD9,0x9A,0x3E,0x90,
+  0xDF,0x17,0xFE,0xD1,0xB2,0x79,0x1A,0x37,0xDC,0xD5,0xE7,0x6A,0xFB,0xD7,0xD4,0x5F,0xBF,0x9A,0xC9,0xF9,
+  0xA2,0xFC,0x06,0x32,0x44,0xE4,0x07,0xF7,0xDD,0x03,0x09,0x3F,0x18,0xB9,0xEC,0x10,0xCD,0x59,0xDD,0x8B,
+  0x1B,0x7F,0x91,0x6E,0x2B,0xC0,0x06,0xF6,0xE1,0x77,0x6C,0xB9,0x90,0x9D,0xCB,0x52,0xBF,0x63,0xCF,0x1D,
+  0x53,0x7F,0xD4,0xD8,0x95,0x9F,0xFD,0x9E,0x1A,0x0C,0x7B,0x7E,0x7A,0xEE,0x6C,0x07,0x76,0x4F,0x92,0x94,
+  0xF1,0x12,0xE5,0x1A,0xD8,0xFE,0x54,0xCE,0x81,0x5C,0xD8,0x63,0x0D,0x59,0xD9,0x84,0xF9,0x83,0x38,0x7C,
+  0xE5,0x87,0x22,0x09,0x16,0x5A,0x24,0xC1,0xC5,0xBD,0xED,0xCD,0x0B,0x21,0xD7,0xAC,0x54,0xDC,0xB9,0x59,
+  0x14,0xDC,0xC6,0x5B,0xAD,0xF7,0x9B,0x61,0x70,0x30,0x8B,0x88,0x19,0x5D,0x2A,0x32,0xB7,0xD9,0x33,0xB2,
+  0xD5,0x5E,0xF1,0x38,0x18,0xF4,0x78,0x9C,0x44,0xCF,0xE6,0x2F,0x9E,0xA7,0x93,0xC9,0x9F,0x57,0x39,0x25,
+  0xA1,0xE0,0xFF,0x81,0xF8,0x0A,0x21,0x89,0x3E,0x87,0x7F,0x0B,0xA6,0x56,0xD1,0xFC,0x56,0x6A,0x87,0xA0,
+  0x54,0xA7,0x2B,0xD0,0x2C,0x66,0x77,0x65,0x4D,0xEF,0x11,0xEC,0xC7,0x40,0x1F,0xA3,0x12,0x12,0x75,0xA2,
+  0x6C,0x30,0xF4,0xE8,0x74,0xD0,0x9B,0xD6,0xE3,0x21,0xDA,0x67,0xDF,0x10,0x9B,0x08,0xD3,0xA1,0x17,0x5C,
+  0xB4,0xF3,0xBF,0x41,0x71,0xE9,0x78,0xE7,0xAA,0x17,0xBC,0x6B,0x54,0x4E,0x9C,0x8A,0xA4,0x3D,0x97,0xFE,
+  0x3B,0x60,0xA5,0x1E,0x50,0x6F,0x64,0x25,0x91,0xDE,0x89,0xB4,0xDB,0x7E,0x1E,0xD6,0x81,0xA5,0x97,0xEC,
+  0x80,0x7C,0xD7,0x77,0x9E,0x8C,0x65,0x36,0x03,0xCE,0x07,0x0D,0x1B,0x69,0xE1,0x27,0x80,0xA6,0xA7,0x48,
+  0xEC,0xED,0xDB,0x27,0x83,0x2D,0x8F,0xAB,0xB1,0x50,0x1D,0xA0,0x31,0x58,0x3F,0x80,0x3A,0x69,0xC3,0x7E,
+  0x4F,0xFA,0x3F,0x32,0xFF,0x01,0xAE,0x2A,0x7C,0xF7,0xDE,0x08,0x00,0x00,
+};
+const webassets::Asset htmlPageSchnittstellenAsset = {htmlPageSchnittstellenGz, sizeof(htmlPageSchnittstellenGz), htmlPageSchnittstellen, "text/html", "\"1e77a6649ad3fdba\""};
+
+// htmlPageDevices: 1877 -> 746 Byte
+const uint8_t htmlPageDevicesGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xC5,0x55,0x5D,0x6F,0xDA,0x30,0x14,0xFD,0x2B,0x5E,
+  0x2B,0x2D,0xAD,0x44,0x08,0x41,0xB4,0xD5,0x9C,0xC0,0x03,0x85,0xA9,0x0F,0xFB,0x92,0xD6,0x97,0x3E,0x9A,
+  0xF8,0x42,0x2C,0x1C,0x3B,0xB2,0xCD,0xD7,0x10,0xFF,0x7D,0xD7,0x31,0xAC,0xA5,0x45,0xDD,0xBA,0x87,0x8D,
+  0x28,0x26,0xB6,0x73,0xCF,0x3D,0xE7,0xDA,0x3E,0xC9,0xDF,0x8D,0xBE,0xDE,0xDE,0x3F,0x7C,0x1B,0x93,0xBB,
+  0xFB,0xCF,0x9F,0x06,0x79,0xE9,0x2A,0x89,0x2D,0x30,0x3E,0xC8,0x9D,0x70,0x12,0x06,0xC3,0xEF,0xB7,0x79,
+  0x12,0x1E,0xF3,0x0A,0x1C,0x23,0x8A,0x55,0xD0,0x8F,0x96,0x02,0x56,0xB5,0x36,0x2E,0x22,0x85,0x56,0x0E,
+  0x94,0xEB,0x47,0x2B,0xC1,0x5D,0xD9,0xE7,0xB0,0x14,0x05,0xC4,0x4D,0xA7,0x45,0x84,0x12,0x4E,0x30,0x19,
+  0xDB,0x82,0x49,0xE8,0xA7,0xD1,0x20,0x97,0x42,0xCD,0x89,0x01,0xD9,0x8F,0x04,0x46,0x46,0xA4,0x34,0x30,
+  0xED,0x47,0x9C,0x39,0x46,0x5B,0x38,0x6D,0xDD,0x06,0x33,0x79,0x1A,0x64,0x3B,0x45,0xE4,0x78,0xCA,0x2A,
+  0x21,0x37,0xF4,0x0E,0xE4,0x12,0x9C,0x28,0x58,0xC6,0x85,0xAD,0x25,0xDB,0x50,0xA1,0x10,0x0A,0xE2,0x89,
+  0xD4,0xC5,0x3C,0xAB,0x98,0x99,0x09,0x45,0x3B,0xF5,0x9A,0xB0,0x85,0xD3,0x99,0x83,0xB5,0x8B,0x99,0x14,
+  0x33,0x45,0x0B,0x24,0x07,0x26,0xDB,0x4D,0x34,0xDF,0x90,0xED,0xE1,0xC5,0x6C,0xD7,0xDE,0x13,0x27,0xDB,
+  0x9A,0x71,0x2E,0xD4,0x8C,0x76,0x31,0x1C,0xC7,0x9D,0xAE,0x15,0x5B,0x92,0xAD,0x5E,0x82,0x99,0x4A,0xBD,
+  0xA2,0xA4,0x14,0x9C,0x83,0xCA,0x6A,0x6D,0x51,0x8D,0x56,0xD4,0x22,0x91,0xF9,0x26,0xC3,0x17,0x11,0x68,
+  0xC2,0x8A,0xF9,0xCC,0xE8,0x85,0xE2,0x71,0xA1,0xA5,0x36,0xF4,0xFC,0x7A,0xEC,0xAF,0x2C,0xF4,0x56,0xA5,
+  0x70,0x90,0x1D,0x52,0x5C,0x61,0x86,0x62,0x61,0x2C,0x4E,0x70,0x98,0xB2,0x85,0x74,0x8F,0x09,0x6D,0xCD,
+  0x14,0x8A,0x96,0x9A,0x39,0x2A,0x61,0xEA,0x32,0x72,0x88,0x22,0x69,0x0F,0x85,0xA5,0xD7,0x18,0x4C,0x1A,
+  0x65,0x1C,0x0A,0x6D,0x58,0xC3,0x45,0x69,0x05,0x19,0x69,0x4A,0x65,0xC5,0x0F,0xA0,0x69,0xFB,0xC6,0x40,
+  0x85,0xA8,0x13,0xA7,0x86,0x48,0x8D,0x96,0x5E,0x07,0xD9,0xBE,0xA4,0x79,0xD5,0xFC,0x8E,0x68,0xEE,0xDA,
+  0xA5,0xAF,0xBB,0x84,0x35,0x4D,0xB3,0x47,0xCC,0x6E,0x40,0x2C,0x98,0xE1,0xF6,0x59,0xB9,0x2A,0xB6,0x0E,
+  0x6B,0x4D,0x6F,0x3A,0xA1,0x1F,0xEA,0x1B,0x96,0xE1,0xB0,0x56,0x33,0x23,0x78,0xE6,0x9B,0x78,0xC6,0xEA,
+  0x00,0xD7,0xF4,0x1C,0x54,0x38,0xEF,0xC0,0x53,0x5A,0x54,0xCA,0x52,0x03,0x35,0x30,0x77,0xE1,0x83,0xE3,
+  0xA9,0x70,0xAD,0x4A,0x28,0xCC,0x70,0xD1,0xF5,0xD8,0xAD,0x74,0x6A,0x2E,0x2F,0xF7,0x3C,0x86,0x4E,0x9D,
+  0xD0,0x14,0x54,0x4C,0xF4,0x3A,0xB6,0x25,0xE3,0xB8,0x74,0x5D,0xAC,0x9B,0xBF,0xD3,0xA6,0xC1,0xDB,0xCC,
+  0x26,0xEC,0x22,0xED,0x75,0x5A,0x87,0xBB,0x7D,0x75,0x99,0x9D,0xAC,0xE9,0x13,0xF9,0x4D,0xE1,0x5F,0x2C,
+  0x9B,0xA7,0x31,0x62,0xB6,0x3C,0x55,0xDB,0x8F,0x5D,0x7F,0xFD,0x6B,0x26,0xA7,0x8B,0xF2,0x1F,0xC8,0x20,
+  0x91,0x37,0xEE,0xBB,0x27,0x12,0xDE,0x18,0x39,0x59,0x38,0xA7,0x4F,0xEA,0x1E,0x8E,0xFC,0x85,0xBA,0x0D,
+  0x07,0x13,0xD8,0x87,0xE7,0xD8,0x30,0x2E,0x16,0x96,0xA6,0x7E,0xC7,0x9E,0x3A,0xA6,0xFE,0xA8,0x91,0x9E,
+  0x9F,0xFD,0x93,0x1A,0xEC,0xF7,0x7C,0xF7,0xD4,0xD9,0x0E,0xEC,0xFE,0x4A,0x12,0x65,0x85,0x13,0x4B,0x20,
+  0xDB,0x63,0x39,0x3B,0x74,0x61,0x8F,0xB5,0xCF,0x4A,0x3A,0xC4,0x1F,0xC4,0xFD,0x5F,0xB6,0xCB,0x93,0x60,
+  0xA1,0x79,0x12,0x5C,0xDC,0xDB,0xDE,0x20,0xE7,0x62,0x49,0x0A,0xC9,0xAC,0xED,0x47,0xC1,0x6D,0xBC,0xD5,
+  0x7A,0xBF,0xD9,0x0F,0xEE,0xCD,0x22,0x22,0x5A,0x15,0x12,0xCD,0xAD,0x7F,0x86,0xB6,0xDA,0x28,0x6E,0x07,
+  0x83,0x6E,0xB7,0x93,0xE8,0x6C,0xF0,0xFE,0x3C,0xED,0x74,0x3E,0xF4,0x32,0x4C,0x82,0xC1,0xBF,0x81,0x78,
+  0x86,0x90,0x44,0xBF,0xC2,0x5F,0x83,0x29,0x65,0x34,0x18,0x0B,0x65,0x1D,0x48,0xB9,0x50,0x33,0x50,0x24,
+  0x26,0xA3,0xE6,0x9B,0x62,0x0F,0xAF,0x27,0xA8,0xE6,0x48,0xD2,0xDE,0xC9,0xA3,0xE3,0x41,0xEF,0x56,0x2F,
+  0x87,0x70,0x83,0xBD,0xA2,0x32,0x51,0x00,0x9B,0x21,0x93,0x4C,0x15,0x60,0xBC,0xE2,0xBC,0x1E,0x7C,0x19,
+  0x8F,0x1F,0xC8,0x61,0x2C,0x4F,0xEA,0x03,0x81,0xA3,0x36,0x94,0x39,0x69,0xBE,0x9F,0x3F,0x01,0xF0,0xD5,
+  0x3D,0x2F,0x55,0x07,0x00,0x00,
+};
+const webassets::Asset htmlPageDevicesAsset = {htmlPageDevicesGz, sizeof(htmlPageDevicesGz), htmlPageDevices, "text/html", "\"2620d08e11cb6952\""};
+
+// htmlPageAlarm: 1949 -> 757 Byte
+const uint8_t htmlPageAlarmGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xC5,0x55,0xD1,0x4E,0xDB,0x30,0x14,0xFD,0x15,0x0F,
+  0xA4,0x05,0xA4,0xA6,0x69,0xAA,0x02,0x9A,0x93,0x56,0x5A,0x81,0x89,0x87,0xA1,0x4D,0x82,0x97,0x3D,0xBA,
+  0xF1,0x6D,0x62,0xD5,0xB1,0x23,0xC7,0x29,0xED,0xAA,0xFE,0xFB,0xAE,0xE3,0x74,0x50,0xA8,0x18,0xEC,0x61,
+  0x6B,0x14,0x37,0xB6,0x73,0xCF,0x3D,0xE7,0xDA,0x3E,0x49,0x3F,0x5C,0x7D,0xBB,0xBC,0xFF,0xF1,0xFD,0x9A,
+  0xDC,0xDC,0xDF,0x7E,0x9D,0xA4,0x85,0x2D,0x25,0xB6,0xC0,0xF8,0x24,0xB5,0xC2,0x4A,0x98,0x4C,0xEF,0x2E,
+  0xD3,0xC8,0x3F,0xA6,0x25,0x58,0x46,0x14,0x2B,0x61,0x1C,0x2C,0x05,0x3C,0x54,0xDA,0xD8,0x80,0x64,0x5A,
+  0x59,0x50,0x76,0x1C,0x3C,0x08,0x6E,0x8B,0x31,0x87,0xA5,0xC8,0x20,0x6C,0x3B,0x3D,0x22,0x94,0xB0,0x82,
+  0xC9,0xB0,0xCE,0x98,0x84,0x71,0x1C,0x4C,0x52,0x29,0xD4,0x82,0x18,0x90,0xE3,0x40,0x60,0x64,0x40,0x0A,
+  0x03,0xF3,0x71,0xC0,0x99,0x65,0xB4,0x87,0xD3,0xB5,0x5D,0x63,0x26,0x47,0x83,0x6C,0xE6,0x88,0x1C,0xCE,
+  0x59,0x29,0xE4,0x9A,0xDE,0x80,0x5C,0x82,0x15,0x19,0x4B,0xB8,0xA8,0x2B,0xC9,0xD6,0x54,0x28,0x84,0x82,
+  0x70,0x26,0x75,0xB6,0x48,0x4A,0x66,0x72,0xA1,0xE8,0xA0,0x5A,0x11,0xD6,0x58,0x9D,0x58,0x58,0xD9,0x90,
+  0x49,0x91,0x2B,0x9A,0x21,0x39,0x30,0xC9,0x76,0xA6,0xF9,0x9A,0x6C,0x76,0x2F,0x26,0xDB,0x7E,0x47,0x9C,
+  0x6C,0x2A,0xC6,0xB9,0x50,0x39,0x1D,0x62,0x38,0x8E,0x5B,0x5D,0x29,0xB6,0x24,0x1B,0xBD,0x04,0x33,0x97,
+  0xFA,0x81,0x92,0x42,0x70,0x0E,0x2A,0xA9,0x74,0x8D,0x6A,0xB4,0xA2,0x35,0x12,0x59,0xAC,0x13,0x7C,0x11,
+  0x81,0x66,0x2C,0x5B,0xE4,0x46,0x37,0x8A,0x87,0x99,0x96,0xDA,0xD0,0xE3,0xF3,0x6B,0x77,0x25,0xBE,0xF7,
+  0x50,0x08,0x0B,0xC9,0x2E,0xC5,0x19,0x66,0xC8,0x1A,0x53,0xE3,0x04,0x87,0x39,0x6B,0xA4,0x7D,0x4C,0x58,
+  0x57,0x4C,0xA1,0x68,0xA9,0x99,0xA5,0x12,0xE6,0x36,0x21,0xBB,0x28,0x12,0x8F,0x50,0x58,0x7C,0x8E,0xC1,
+  0xA4,0x55,0xC6,0x21,0xD3,0x86,0xB5,0x5C,0x94,0x56,0x90,0x90,0xB6,0x54,0xB5,0xF8,0x09,0x34,0xEE,0x5F,
+  0x18,0x28,0x11,0x75,0x66,0xD5,0x14,0xA9,0xD1,0xC2,0xE9,0x20,0x9B,0x97,0x34,0xCF,0xDA,0xDF,0x1E,0xCD,
+  0x6D,0xBF,0x70,0x75,0x97,0xB0,0xA2,0x71,0xF2,0x88,0x39,0xF4,0x88,0x19,0x33,0xBC,0x7E,0x56,0xAE,0x92,
+  0xAD,0xFC,0x5A,0xD3,0x8B,0x81,0xEF,0xFB,0xFA,0xFA,0x65,0xD8,0xAD,0x55,0x6E,0x04,0x4F,0x5C,0x13,0xE6,
+  0xAC,0xF2,0x70,0x6D,0xCF,0x42,0x89,0xF3,0x16,0x1C,0xA5,0xA6,0x54,0x35,0x35,0x50,0x01,0xB3,0x27,0x2E,
+  0x38,0x9C,0x0B,0xDB,0x2B,0x85,0xC2,0x0C,0x27,0x43,0x87,0xDD,0x8B,0xE7,0xE6,0xF4,0xB4,0xE3,0x31,0xB5,
+  0xEA,0x80,0x26,0xAF,0x62,0xA6,0x57,0x61,0x5D,0x30,0x8E,0x4B,0x37,0xC4,0xBA,0xB9,0x3B,0x6E,0x1B,0xBC,
+  0x4D,0x3E,0x63,0x27,0xF1,0x68,0xD0,0xDB,0xDD,0xFD,0xB3,0xD3,0xE4,0x60,0x4D,0x9F,0xC8,0x6F,0x0B,0xFF,
+  0x62,0xD9,0x1C,0x8D,0x2B,0x56,0x17,0x87,0x6A,0xFB,0x65,0xE8,0xAE,0x7F,0xCD,0xE4,0x70,0x51,0xFE,0x03,
+  0x19,0x24,0xF2,0xCE,0x7D,0xF7,0x44,0xC2,0x3B,0x23,0x67,0x8D,0xB5,0xFA,0xA0,0xEE,0xE9,0x95,0xBB,0x50,
+  0xB7,0xE1,0x60,0x3C,0x7B,0xFF,0x1C,0x1A,0xC6,0x45,0x53,0xD3,0xD8,0xED,0xD8,0x43,0xC7,0xD4,0x1D,0x35,
+  0x32,0x72,0xB3,0x6F,0xA9,0x41,0xB7,0xE7,0x87,0x87,0xCE,0xB6,0x67,0xF7,0x57,0x92,0x28,0xCB,0xAC,0x58,
+  0x02,0xD9,0xEC,0xCB,0xD9,0xA2,0x0B,0x3B,0xAC,0x2E,0x2B,0x19,0x10,0x77,0x10,0xBB,0xBF,0x64,0x9B,0x46,
+  0xDE,0x42,0xD3,0xC8,0xBB,0xB8,0xB3,0xBD,0x49,0xCA,0xC5,0x92,0x64,0x92,0xD5,0xF5,0x38,0xF0,0x6E,0xE3,
+  0xAC,0xD6,0xF9,0x4D,0x37,0xD8,0x99,0x45,0x40,0xB4,0xCA,0x24,0x9A,0xDB,0xF8,0x08,0x6D,0xB5,0x55,0xDC,
+  0xF7,0x06,0xDD,0xEF,0x47,0xC1,0xD1,0xE4,0xE3,0x71,0x3C,0x18,0x7C,0x1A,0x25,0x98,0x04,0x83,0xFF,0x00,
+  0xF1,0x0C,0x21,0x0A,0x7E,0x87,0xBF,0x06,0x53,0xC8,0x60,0x72,0x2D,0x54,0x6D,0x41,0xCA,0x46,0xE5,0xA0,
+  0x48,0x48,0x3E,0x4B,0x66,0x4A,0x03,0x39,0x48,0xB5,0x0B,0x89,0x50,0xD1,0x9E,0xAC,0xCE,0xCD,0x83,0xFD,
+  0x41,0xE7,0x58,0x2F,0x87,0x70,0x93,0xBD,0xA2,0x34,0x62,0x2E,0xDD,0xD4,0x3A,0xC1,0x69,0x35,0x99,0xDE,
+  0xDE,0xA5,0x51,0x75,0x28,0xE3,0x1B,0x91,0xEE,0xD1,0xE4,0x3A,0x2C,0xF7,0x08,0xB8,0x93,0x1A,0xF3,0x04,
+  0x72,0xAF,0xF5,0xCB,0x15,0xB5,0xDF,0xE1,0x5F,0x54,0x1D,0x84,0x35,0x9D,0x07,0x00,0x00,
+};
+const webassets::Asset htmlPageAlarmAsset = {htmlPageAlarmGz, sizeof(htmlPageAlarmGz), htmlPageAlarm, "text/html", "\"ac5e6f6ae5f0e61a\""};
+
+// htmlPageMenuLivedata: 1947 -> 757 Byte
+const uint8_t htmlPageMenuLivedataGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xC5,0x55,0x5D,0x4F,0xDB,0x30,0x14,0xFD,0x2B,0xDE,
+  0x90,0x16,0x90,0x9A,0xA6,0xA9,0x0A,0x68,0x4E,0x9A,0x87,0x52,0x26,0x1E,0x40,0x4C,0x02,0x69,0xDA,0xA3,
+  0x13,0xDF,0x36,0x16,0x8E,0x1D,0x39,0xEE,0xD7,0xAA,0xFE,0xF7,0x5D,0xC7,0x2D,0x50,0xA8,0x60,0xEC,0x61,
+  0x6B,0x14,0x37,0xB6,0x73,0xCF,0x3D,0xE7,0xDA,0x3E,0x49,0x3F,0x8D,0x6F,0x2F,0xEE,0x7F,0x7E,0xBF,0x24,
+  0x57,0xF7,0x37,0xD7,0x59,0x5A,0xDA,0x4A,0x62,0x0B,0x8C,0x67,0xA9,0x15,0x56,0x42,0x36,0xBA,0xBB,0x48,
+  0x23,0xFF,0x98,0x56,0x60,0x19,0x51,0xAC,0x82,0x61,0x30,0x17,0xB0,0xA8,0xB5,0xB1,0x01,0x29,0xB4,0xB2,
+  0xA0,0xEC,0x30,0x58,0x08,0x6E,0xCB,0x21,0x87,0xB9,0x28,0x20,0x6C,0x3B,0x1D,0x22,0x94,0xB0,0x82,0xC9,
+  0xB0,0x29,0x98,0x84,0x61,0x1C,0x64,0xA9,0x14,0xEA,0x81,0x18,0x90,0xC3,0x40,0x60,0x64,0x40,0x4A,0x03,
+  0x93,0x61,0xC0,0x99,0x65,0xB4,0x83,0xD3,0x8D,0x5D,0x61,0x26,0x47,0x83,0xAC,0x27,0x88,0x1C,0x4E,0x58,
+  0x25,0xE4,0x8A,0x5E,0x81,0x9C,0x83,0x15,0x05,0x4B,0xB8,0x68,0x6A,0xC9,0x56,0x54,0x28,0x84,0x82,0x30,
+  0x97,0xBA,0x78,0x48,0x2A,0x66,0xA6,0x42,0xD1,0x5E,0xBD,0x24,0x6C,0x66,0x75,0x62,0x61,0x69,0x43,0x26,
+  0xC5,0x54,0xD1,0x02,0xC9,0x81,0x49,0x36,0xB9,0xE6,0x2B,0xB2,0xDE,0xBD,0x98,0x6C,0xBA,0x5B,0xE2,0x64,
+  0x5D,0x33,0xCE,0x85,0x9A,0xD2,0x3E,0x86,0xE3,0xB8,0xD5,0xB5,0x62,0x73,0xB2,0xD6,0x73,0x30,0x13,0xA9,
+  0x17,0x94,0x94,0x82,0x73,0x50,0x49,0xAD,0x1B,0x54,0xA3,0x15,0x6D,0x90,0xC8,0xC3,0x2A,0xC1,0x17,0x11,
+  0x28,0x67,0xC5,0xC3,0xD4,0xE8,0x99,0xE2,0x61,0xA1,0xA5,0x36,0xF4,0xE8,0xEC,0xD2,0x5D,0x89,0xEF,0x2D,
+  0x4A,0x61,0x21,0xD9,0xA5,0x38,0xC5,0x0C,0xC5,0xCC,0x34,0x38,0xC1,0x61,0xC2,0x66,0xD2,0x3E,0x25,0x6C,
+  0x6A,0xA6,0x50,0xB4,0xD4,0xCC,0x52,0x09,0x13,0x9B,0x90,0x5D,0x14,0x89,0x07,0x28,0x2C,0x3E,0xC3,0x60,
+  0xD2,0x2A,0xE3,0x50,0x68,0xC3,0x5A,0x2E,0x4A,0x2B,0x48,0x48,0x5B,0xAA,0x46,0xFC,0x02,0x1A,0x77,0xCF,
+  0x0D,0x54,0x88,0x9A,0x5B,0x35,0x42,0x6A,0xB4,0x74,0x3A,0xC8,0xFA,0x35,0xCD,0xD3,0xF6,0xB7,0x47,0x73,
+  0xD3,0x2D,0x5D,0xDD,0x25,0x2C,0x69,0x9C,0x3C,0x61,0xF6,0x3D,0x62,0xC1,0x0C,0x6F,0x5E,0x94,0xAB,0x62,
+  0x4B,0xBF,0xD6,0xF4,0xBC,0xE7,0xFB,0xBE,0xBE,0x7E,0x19,0x76,0x6B,0x35,0x35,0x82,0x27,0xAE,0x09,0xA7,
+  0xAC,0xF6,0x70,0x6D,0xCF,0x42,0x85,0xF3,0x16,0x1C,0xA5,0x59,0xA5,0x1A,0x6A,0xA0,0x06,0x66,0x8F,0x5D,
+  0x70,0x38,0x11,0xB6,0x53,0x09,0x85,0x19,0x8E,0xFB,0x0E,0xBB,0x13,0x4F,0xCC,0xC9,0xC9,0x96,0xC7,0xC8,
+  0xAA,0x03,0x9A,0xBC,0x8A,0x5C,0x2F,0xC3,0xA6,0x64,0x1C,0x97,0xAE,0x8F,0x75,0x73,0x77,0xDC,0x36,0x78,
+  0x9B,0x69,0xCE,0x8E,0xE3,0x41,0xAF,0xB3,0xBB,0xBB,0xA7,0x27,0xC9,0xC1,0x9A,0x3E,0x93,0xDF,0x16,0xFE,
+  0xD5,0xB2,0x39,0x1A,0x63,0xD6,0x94,0x87,0x6A,0xFB,0xAD,0xEF,0xAE,0x7F,0xCD,0xE4,0x70,0x51,0xFE,0x03,
+  0x19,0x24,0xF2,0xC1,0x7D,0xF7,0x4C,0xC2,0x07,0x23,0xF3,0x99,0xB5,0xFA,0xA0,0xEE,0xD1,0xD8,0x5D,0xA8,
+  0xDB,0x70,0x30,0x9E,0xBD,0x7F,0x0E,0x0D,0xE3,0x62,0xD6,0xD0,0xD8,0xED,0xD8,0x43,0xC7,0xD4,0x1D,0x35,
+  0x32,0x70,0xB3,0x7F,0x52,0x83,0xED,0x9E,0xEF,0x1F,0x3A,0xDB,0x9E,0xDD,0x5F,0x49,0xA2,0xAC,0xB0,0x62,
+  0x0E,0x64,0xBD,0x2F,0x67,0x83,0x2E,0xEC,0xB0,0xB6,0x59,0x49,0x8F,0xB8,0x83,0xB8,0xFD,0x4B,0x36,0x69,
+  0xE4,0x2D,0x34,0x8D,0xBC,0x8B,0x3B,0xDB,0xCB,0x52,0x2E,0xE6,0xA4,0x90,0xAC,0x69,0x86,0x81,0x77,0x1B,
+  0x67,0xB5,0xCE,0x6F,0xB6,0x83,0x5B,0xB3,0x08,0x88,0x56,0x85,0x44,0x73,0x1B,0x7E,0x46,0x5B,0x6D,0x15,
+  0x77,0xBD,0x41,0x77,0xBB,0x51,0xF0,0x39,0xFB,0x72,0x14,0xF7,0x7A,0x5F,0x07,0x09,0x26,0xC1,0xE0,0x77,
+  0x20,0x5E,0x20,0x44,0xC1,0x63,0xF8,0x5B,0x30,0xA5,0x0C,0xB2,0x6B,0x94,0x8D,0x5F,0x04,0x50,0xBB,0x17,
+  0x22,0xE4,0xBF,0x27,0x62,0xEB,0xDD,0xC1,0xFE,0xA0,0xF3,0xA7,0xD7,0x43,0xB8,0xA5,0xDE,0xD0,0x15,0xE9,
+  0xC5,0x3D,0xBA,0x90,0x4B,0xE9,0x14,0xA6,0x75,0x76,0xFB,0x83,0xB8,0x11,0xC0,0x15,0x9F,0x19,0xC7,0xA1,
+  0x3E,0x44,0xE0,0x7D,0xE0,0xBC,0x29,0xC6,0xF8,0x59,0x7B,0x86,0x3C,0xBA,0xB9,0x23,0x63,0xAF,0xEB,0x11,
+  0x73,0xAF,0xF5,0x8B,0x15,0xB5,0x5F,0xE1,0xDF,0x9E,0xCB,0x86,0xED,0x9B,0x07,0x00,0x00,
+};
+const webassets::Asset htmlPageMenuLivedataAsset = {htmlPageMenuLivedataGz, sizeof(htmlPageMenuLivedataGz), htmlPageMenuLivedata, "text/html", "\"bb9a105eee97bde6\""};
+
+// htmlPageBmsSpg: 4311 -> 1604 Byte
+const uint8_t htmlPageBmsSpgGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xC5,0x58,0x5B,0x73,0xDA,0x46,0x14,0xFE,0x2B,0xA7,
+  0xF1,0xD8,0x12,0x63,0x24,0x24,0x6C,0xEC,0x58,0x42,0x3C,0x38,0x97,0x26,0x33,0x49,0x1F,0x1A,0x4F,0x27,
+  0x6D,0xA7,0x0F,0x8B,0xB4,0xA0,0x9D,0x88,0x95,0xBA,0x5A,0x81,0x29,0xC3,0x7F,0xEF,0xD9,0x8B,0x00,0xC7,
+  0x44,0x34,0x7D,0x68,0xE3,0x41,0xB0,0x7B,0xEE,0xB7,0x6F,0x57,0x19,0xFF,0x90,0x95,0xA9,0x5C,0x57,0x14,
+  0x72,0xB9,0x28,0x26,0x63,0xFB,0xA4,0x24,0x9B,0x8C,0x17,0x54,0x12,0x48,0x73,0x22,0x6A,0x2A,0x13,0xA7,
+  0x91,0x33,0xEF,0xA5,0x63,0x77,0x39,0x59,0xD0,0xC4,0x59,0x32,0xBA,0xAA,0x4A,0x21,0x1D,0x48,0x4B,0x2E,
+  0x29,0x47,0xAE,0x15,0xCB,0x64,0x9E,0x64,0x74,0xC9,0x52,0xEA,0xE9,0x45,0x1F,0x18,0x67,0x92,0x91,0xC2,
+  0xAB,0x53,0x52,0xD0,0x24,0xF4,0x03,0xD4,0x22,0x99,0x2C,0xE8,0xE4,0xFE,0xD3,0xAB,0xF1,0xC0,0xFC,0x1C,
+  0xD7,0x72,0x8D,0x5F,0xCA,0x3E,0x6C,0x66,0xA8,0xCE,0x9B,0x91,0x05,0x2B,0xD6,0xD1,0x3B,0x5A,0x2C,0xA9,
+  0x64,0x29,0x89,0x33,0x56,0x57,0x05,0x59,0x47,0x8C,0x17,0x8C,0x53,0x6F,0x5A,0x94,0xE9,0x97,0x78,0x41,
+  0xC4,0x9C,0xF1,0x28,0xA8,0x1E,0x81,0x34,0xB2,0x8C,0x25,0x7D,0x94,0x1E,0x29,0xD8,0x9C,0x47,0x29,0x7A,
+  0x44,0x45,0xBC,0x9D,0x96,0xD9,0x1A,0x36,0x2D,0x63,0xBC,0xF5,0xAD,0xB7,0xB0,0xA9,0x48,0x96,0x31,0x3E,
+  0x8F,0x86,0x28,0x8E,0xFB,0xB2,0xAC,0x38,0x59,0xC2,0xA6,0x5C,0x52,0x31,0x2B,0xCA,0x55,0x04,0x39,0xCB,
+  0x32,0xCA,0xE3,0xAA,0xAC,0x31,0x84,0x92,0x47,0x35,0x3A,0xF2,0x65,0x1D,0x23,0x23,0x2A,0x9A,0x92,0xF4,
+  0xCB,0x5C,0x94,0x0D,0xCF,0xBC,0xB4,0x2C,0x4A,0x11,0x9D,0xDD,0xBC,0x51,0x7F,0xB1,0x59,0xAD,0x72,0x26,
+  0x69,0xDC,0x9A,0x18,0xA1,0x85,0xB4,0x11,0x35,0x12,0x32,0x3A,0x23,0x4D,0x21,0xF7,0x06,0xEB,0x8A,0x70,
+  0x0C,0xBA,0x28,0x89,0x8C,0x0A,0x3A,0x93,0x31,0xB4,0x52,0x10,0x5E,0x63,0x60,0xE1,0x0D,0x0A,0x83,0x8E,
+  0x2C,0xA3,0x69,0x29,0x88,0xF6,0x85,0x97,0x9C,0xC6,0xA0,0x53,0x55,0xB3,0xBF,0x68,0x14,0xFA,0xB7,0x82,
+  0x2E,0x50,0xEB,0x54,0xF2,0x7B,0x74,0x2D,0xCA,0x55,0x1C,0xB0,0x79,0xEE,0xE6,0x48,0xFF,0x7B,0xE2,0xE6,
+  0xD6,0xCF,0x55,0xDE,0x0B,0xFA,0x18,0x85,0xF1,0x5E,0xE7,0xD0,0x68,0x4C,0x89,0xC8,0xEA,0xAF,0xD2,0xB5,
+  0x20,0x8F,0xA6,0xC0,0xD1,0x6D,0x60,0xD6,0x26,0xBF,0xA6,0x0C,0x6D,0xAD,0xE6,0x82,0x65,0xB1,0x7A,0x78,
+  0x73,0x52,0x19,0x75,0x7A,0x25,0xE9,0x02,0xE9,0x92,0x2A,0x97,0x9A,0x05,0xAF,0x23,0x41,0x2B,0x4A,0xA4,
+  0xAB,0x84,0xBD,0x19,0x93,0xFD,0x05,0xE3,0x68,0xC1,0x1D,0x2A,0xDD,0xFD,0x70,0x26,0x7A,0x3D,0xEB,0xC7,
+  0xBD,0xE4,0x47,0x62,0x32,0x51,0x4C,0xCB,0x47,0xAF,0xCE,0x49,0x86,0xA5,0x1B,0x62,0xDE,0xD4,0x27,0xD4,
+  0x0F,0xFC,0x88,0xF9,0x94,0xB8,0xE1,0x75,0xD0,0x6F,0x3F,0xFE,0xA8,0x17,0x1F,0xCD,0xE9,0x41,0xF8,0x3A,
+  0xF1,0xCF,0xCA,0xA6,0xDC,0x78,0x4D,0xEA,0xFC,0x58,0x6E,0xDF,0x0E,0xD5,0xDF,0x7F,0xED,0xC9,0xF1,0xA4,
+  0xFC,0x0F,0xCE,0xA0,0x23,0xDF,0xD9,0x77,0x07,0x21,0x7C,0xA7,0xE4,0xB4,0x91,0xB2,0x3C,0x1A,0xF7,0xFD,
+  0x6B,0xF5,0x87,0x71,0x8B,0x8C,0x0A,0xE3,0xBD,0xF9,0xED,0x09,0x92,0xB1,0xA6,0x8E,0x42,0xD5,0xB1,0xC7,
+  0xC6,0x54,0x8D,0x1A,0x5C,0x2B,0xEA,0x3F,0xC9,0x81,0xED,0xF9,0xE1,0xB1,0xD9,0x36,0xDE,0xFD,0xAB,0x90,
+  0x22,0x92,0x4A,0xB6,0xA4,0xB0,0x79,0x1A,0xCE,0x16,0xA1,0x57,0xE9,0xB2,0x56,0x21,0x00,0x35,0x88,0xF6,
+  0x2B,0xDE,0x8E,0x07,0x06,0x42,0x2D,0x92,0xFA,0x0A,0xB9,0xA5,0xB7,0x12,0xA4,0x6A,0x45,0x3C,0x05,0x2E,
+  0x11,0x8C,0x14,0x3B,0x1C,0x62,0x2C,0xD4,0x84,0xD7,0x5E,0x4D,0x05,0x9B,0xC5,0x90,0x53,0x36,0xCF,0x91,
+  0xED,0xC6,0xF0,0x99,0x19,0x87,0x2B,0x3D,0xE4,0xDB,0xC1,0xE0,0x50,0xAF,0xAF,0xB1,0xDB,0xE2,0xF5,0xCA,
+  0xCA,0x4D,0xCB,0x22,0x3B,0xC4,0x25,0x08,0xFD,0x9B,0x21,0xCE,0xFD,0x1E,0xD4,0x02,0x7F,0x44,0x17,0xE8,
+  0x77,0xE8,0xBF,0x54,0xDF,0x16,0xDA,0x0C,0x68,0x83,0x45,0x6D,0xD0,0x29,0xF1,0x10,0x1A,0x53,0x54,0xC1,
+  0x4B,0x65,0x4F,0x75,0xCB,0xCE,0xB8,0x8F,0x79,0x55,0xC7,0x42,0x01,0xBE,0x42,0x14,0xD8,0x48,0x81,0x41,
+  0xCC,0x4A,0xB1,0x88,0x40,0xFF,0x54,0xF0,0xF2,0xAB,0xEB,0x85,0xB7,0x08,0xBD,0xBD,0xFD,0xD6,0x67,0xD7,
+  0xEE,0x88,0x52,0xE2,0xD2,0xF5,0xEE,0x82,0x8C,0xCE,0x7B,0x9D,0xBA,0xFD,0x29,0x11,0x51,0x44,0x66,0x3A,
+  0xFD,0xDF,0xB0,0x33,0x0A,0xCE,0x7B,0x31,0xB4,0xB8,0x07,0xE6,0x74,0xEA,0x50,0x1A,0x45,0x53,0x8A,0x5A,
+  0x68,0xBF,0x8B,0xA5,0xC3,0xE4,0x67,0xD7,0x0B,0x7C,0xCC,0xEB,0x2E,0x90,0x23,0x71,0xB4,0xA9,0xD9,0x9D,
+  0x5F,0x20,0x28,0xCA,0x62,0x6F,0x1D,0x54,0x63,0xA4,0x7B,0x48,0x3F,0xF7,0xC5,0x0F,0x83,0xE0,0x7C,0x57,
+  0x7B,0xB3,0xB0,0x13,0x64,0x7A,0x48,0xC1,0x47,0x5D,0x16,0xA8,0xFC,0x8C,0x10,0x82,0xC4,0x5D,0x7F,0x2B,
+  0x1B,0x0A,0xCA,0x51,0xB7,0xA7,0xCE,0x69,0x22,0xBC,0xB9,0x9A,0x3A,0x2C,0xAB,0x71,0xB1,0x6F,0x62,0xA8,
+  0x88,0xC0,0xAD,0x27,0x0B,0x08,0xEF,0xFC,0xD1,0x79,0xDF,0x62,0xD2,0x6D,0xD0,0x87,0xFD,0x23,0xF0,0x6F,
+  0x7B,0xD8,0xE8,0xE7,0xC7,0x02,0x6C,0x53,0x69,0x1B,0xD1,0x74,0x5D,0xA0,0x9A,0xCB,0xF6,0xE1,0xD3,0xD6,
+  0xB4,0xC7,0x7F,0x04,0xCE,0xB0,0x3F,0x82,0x5F,0x1C,0xCC,0xC5,0x2E,0x3F,0x64,0x8A,0x51,0x35,0x38,0x8B,
+  0x60,0xE2,0xF4,0x74,0xAF,0x62,0x87,0xE2,0x89,0x0F,0x5E,0xA8,0x17,0xC7,0x1C,0xB0,0x85,0xFA,0x4E,0xFB,
+  0xD7,0xFD,0xE0,0x9B,0xF6,0x85,0x11,0xB1,0x36,0x3B,0x1C,0xC0,0xDE,0x84,0x8D,0xAD,0x94,0xAA,0x53,0x5B,
+  0x42,0x8D,0x0A,0xD0,0x82,0x45,0x18,0x98,0x02,0x3F,0x03,0x22,0x38,0x7B,0x1B,0xDE,0x5C,0x5D,0x8D,0x76,
+  0x05,0xB6,0x10,0x89,0x3D,0x71,0x85,0x22,0x57,0x5A,0xEC,0x99,0xC5,0x16,0xD7,0x4A,0x9C,0x4F,0x26,0xD7,
+  0x2A,0xDC,0xDB,0x03,0x08,0x1A,0x98,0x1B,0xA4,0xBA,0x79,0x4D,0xC6,0x19,0x5B,0x42,0x5A,0x90,0xBA,0x4E,
+  0x1C,0x73,0xE1,0xC1,0xFB,0x9F,0xBE,0xF2,0xD8,0x4D,0x7B,0x5F,0x71,0xA0,0xE4,0x69,0x81,0xF7,0xAB,0xE4,
+  0x05,0xCE,0x8E,0x06,0x5D,0x3F,0x17,0x74,0x96,0x38,0xBE,0x3F,0x70,0x5E,0x4C,0x2E,0xCE,0xB0,0x0F,0xEF,
+  0xAE,0x63,0x34,0x82,0xC2,0x27,0x54,0x7C,0xA5,0x61,0xE0,0xEC,0xC4,0xBB,0xD4,0xE4,0x85,0x33,0xF9,0x8D,
+  0x16,0x85,0xDA,0xE3,0x0D,0x9F,0x53,0xDE,0x72,0x0D,0x30,0x08,0x8C,0x47,0x98,0xCF,0x41,0x44,0x07,0x79,
+  0x69,0x87,0xD7,0x31,0x0C,0x2C,0x4B,0x1C,0xD5,0x1C,0x4E,0xCB,0xAA,0x17,0x7B,0xDA,0x34,0xD8,0x51,0x30,
+  0xA1,0x4E,0x6B,0x63,0x47,0x0E,0xBB,0xC9,0xC3,0x6E,0xF2,0x55,0x37,0xF9,0xBA,0x9B,0x3C,0xEA,0x26,0xDF,
+  0x74,0x93,0x6F,0xBB,0xC9,0x2F,0xBB,0xC9,0x77,0x27,0xD2,0x72,0x2A,0x6D,0x27,0xF2,0x16,0x9E,0x48,0x5C,
+  0x78,0x22,0x73,0xE1,0x89,0xD4,0x85,0xC7,0x73,0x77,0xF8,0xAC,0x53,0xC1,0x2A,0x39,0x99,0x35,0x3C,0x55,
+  0x3D,0x0A,0x73,0x2A,0x5F,0x13,0x49,0xDC,0x1E,0x6C,0x96,0x38,0xCC,0x8F,0xB9,0x94,0x15,0x24,0xC0,0xE9,
+  0x0A,0x3E,0x7F,0xFC,0xF0,0x0E,0x57,0x3F,0xD3,0x3F,0x1B,0x5A,0x4B,0xB7,0x17,0x6B,0xA2,0x5F,0x72,0x81,
+  0x03,0xB6,0xAE,0x15,0xF0,0x63,0x07,0x62,0xA7,0x22,0x7F,0xAB,0x4F,0xE9,0x61,0x33,0x70,0x65,0xCE,0x6A,
+  0x5F,0xF3,0x7D,0x52,0x7C,0x90,0x24,0x70,0x0D,0x17,0x17,0xA0,0xF7,0x95,0x68,0x53,0xAB,0x3D,0xBC,0x62,
+  0xA3,0x40,0x41,0x25,0x2C,0x49,0x81,0x56,0x50,0x93,0x95,0xAC,0xAB,0x92,0xD7,0xF4,0x01,0x0F,0x67,0x1F,
+  0x4F,0x35,0x26,0x5D,0x27,0x76,0x7A,0xB1,0xE2,0x4C,0x11,0xAC,0x13,0xF8,0x48,0x64,0xEE,0xE3,0x6B,0x4B,
+  0x29,0x5C,0x23,0xEA,0x17,0x94,0xCF,0x65,0x3E,0x18,0x1A,0x2E,0x7D,0xF8,0x24,0x80,0x6F,0x98,0xCD,0x02,
+  0x01,0xCF,0xC7,0x38,0xDF,0x14,0x54,0xFD,0xBC,0x5F,0xBF,0xCF,0x5C,0x33,0x10,0xBD,0x18,0x4F,0x7A,0xBC,
+  0x44,0xB8,0x6A,0x85,0x30,0xC3,0x8A,0x0C,0xCF,0x02,0xAB,0x09,0xC6,0xCA,0x94,0x75,0x4F,0x01,0xDD,0x81,
+  0xB6,0x14,0x43,0x93,0xD4,0x2A,0x74,0x1D,0xCC,0x2C,0xEA,0x42,0x1E,0x5F,0x1B,0x75,0xA6,0x0E,0x5C,0xC2,
+  0x31,0x9D,0x9A,0x47,0x57,0xE8,0x27,0x7C,0x8B,0xD5,0xAC,0x58,0x27,0xFD,0x5A,0xE2,0x93,0xAA,0xA2,0x3C,
+  0x7B,0xA5,0x04,0x5C,0xDC,0xC5,0xC3,0xA6,0xCB,0xB9,0x89,0x75,0x4E,0x13,0xF1,0xD5,0x06,0x21,0xD1,0x88,
+  0xEA,0x0D,0xB4,0x20,0xF5,0x12,0xB5,0x28,0xF7,0x39,0x9A,0x0A,0xF0,0x06,0x29,0xC0,0x55,0x4B,0x96,0x20,
+  0x1A,0xB3,0x31,0x6A,0xC0,0xAF,0xCB,0x4B,0x1B,0x23,0x46,0xF1,0x7E,0xEF,0x3E,0x8B,0xBF,0x95,0x3B,0xCD,
+  0xD7,0xF3,0x35,0xDC,0xFA,0x1A,0xFC,0x51,0xC8,0x14,0xE1,0x77,0xFE,0x07,0x8A,0x3A,0xE7,0xCE,0x29,0x61,
+  0xC6,0x39,0x15,0xEF,0x1E,0x3E,0x7E,0x38,0x10,0xBD,0x0C,0xB5,0xF0,0x05,0x9F,0xD6,0x55,0xEC,0xC4,0x3C,
+  0xE1,0x97,0xC3,0x78,0xBB,0xDD,0xB6,0x7D,0x87,0xE9,0x71,0x9D,0x1F,0xDF,0x3C,0x38,0x7D,0x70,0x50,0xEB,
+  0xFD,0xA2,0xFE,0x54,0xCD,0x55,0xF3,0x2A,0x77,0x77,0xA0,0x5B,0xE3,0xA9,0x9F,0xE6,0xEA,0x6C,0x6F,0x68,
+  0xDB,0xB2,0x92,0x2D,0x68,0xD9,0xC8,0x04,0xD1,0x37,0xB0,0x5B,0x35,0xE6,0x1A,0x5B,0x5A,0xF5,0xBC,0xA2,
+  0xAA,0xEA,0xAE,0x18,0xC7,0xD7,0x14,0xA4,0xC8,0x07,0xC3,0xEF,0x3A,0xBB,0xE9,0x40,0x9B,0x4A,0x18,0xD3,
+  0xB9,0xDB,0x52,0x28,0x6E,0x86,0x69,0x3C,0x30,0x87,0xCD,0x40,0xFF,0x0F,0xC6,0xDF,0x2E,0x33,0xD9,0xE1,
+  0xD7,0x10,0x00,0x00,
+};
+const webassets::Asset htmlPageBmsSpgAsset = {htmlPageBmsSpgGz, sizeof(htmlPageBmsSpgGz), htmlPageBmsSpg, "text/html", "\"ca47001d270719ff\""};
+
+// htmlPageStatus: 2088 -> 934 Byte
+const uint8_t htmlPageStatusGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xC5,0x56,0x4D,0x93,0xE2,0x36,0x10,0xFD,0x2B,0x4A,
+  0xA5,0x6A,0x0D,0x55,0x18,0x30,0x99,0xD9,0xAD,0xB2,0x31,0x07,0x66,0x26,0x99,0xA4,0x76,0x33,0xA9,0x0C,
+  0x87,0xE4,0x28,0xAC,0x36,0x56,0x46,0x96,0x1C,0xA9,0x0D,0x38,0x14,0xFF,0x3D,0x2D,0x0B,0x67,0x77,0xB2,
+  0x1C,0xB2,0x39,0x24,0xB8,0x6C,0xAC,0x8F,0x7E,0xFD,0xDE,0x93,0xD4,0xB0,0xFC,0xEA,0xFE,0xE9,0x6E,0xF3,
+  0xEB,0x4F,0x0F,0xEC,0x71,0xF3,0xE1,0xFD,0x6A,0x59,0x61,0xAD,0xE8,0x09,0x5C,0xAC,0x96,0x28,0x51,0xC1,
+  0x6A,0xFD,0x7C,0xB7,0x9C,0x85,0xD7,0x65,0x0D,0xC8,0x99,0xE6,0x35,0xE4,0xD1,0x5E,0xC2,0xA1,0x31,0x16,
+  0x23,0x56,0x18,0x8D,0xA0,0x31,0x8F,0x0E,0x52,0x60,0x95,0x0B,0xD8,0xCB,0x02,0xE2,0xBE,0x31,0x61,0x52,
+  0x4B,0x94,0x5C,0xC5,0xAE,0xE0,0x0A,0xF2,0x24,0x5A,0x2D,0x95,0xD4,0x2F,0xCC,0x82,0xCA,0x23,0x49,0x91,
+  0x11,0xAB,0x2C,0x94,0x79,0x24,0x38,0xF2,0x74,0x42,0xC3,0x0E,0x3B,0xCA,0xE4,0x69,0xB0,0x53,0x49,0xC8,
+  0x71,0xC9,0x6B,0xA9,0xBA,0xF4,0x11,0xD4,0x1E,0x50,0x16,0x3C,0x13,0xD2,0x35,0x8A,0x77,0xA9,0xD4,0x04,
+  0x05,0xF1,0x56,0x99,0xE2,0x25,0xAB,0xB9,0xDD,0x49,0x9D,0xCE,0x9B,0x23,0xE3,0x2D,0x9A,0x0C,0xE1,0x88,
+  0x31,0x57,0x72,0xA7,0xD3,0x82,0xC8,0x81,0xCD,0xCE,0x5B,0x23,0x3A,0x76,0x1A,0x26,0x66,0xE7,0xE9,0x85,
+  0x38,0x3B,0x35,0x5C,0x08,0xA9,0x77,0xE9,0x82,0xC2,0xA9,0x1F,0x4D,0xA3,0xF9,0x9E,0x9D,0xCC,0x1E,0x6C,
+  0xA9,0xCC,0x21,0x65,0x95,0x14,0x02,0x74,0xD6,0x18,0x47,0x6A,0x8C,0x4E,0x1D,0x11,0x79,0xE9,0x32,0x9A,
+  0x48,0x40,0x5B,0x5E,0xBC,0xEC,0xAC,0x69,0xB5,0x88,0x0B,0xA3,0x8C,0x4D,0xBF,0x7E,0xFB,0xE0,0xAF,0x2C,
+  0xB4,0x0E,0x95,0x44,0xC8,0x86,0x14,0xB7,0x94,0xA1,0x68,0xAD,0xA3,0x01,0x01,0x25,0x6F,0x15,0x7E,0x4C,
+  0xE8,0x1A,0xAE,0x49,0xB4,0x32,0x1C,0x53,0x05,0x25,0x66,0x6C,0x88,0x62,0xC9,0x0D,0x09,0x4B,0xDE,0x52,
+  0x30,0xEB,0x95,0x09,0x28,0x8C,0xE5,0x3D,0x17,0x6D,0x34,0x64,0xAC,0xB7,0xCA,0xC9,0x3F,0x20,0x4D,0xA6,
+  0xEF,0x2C,0xD4,0x84,0xBA,0x45,0xBD,0x26,0x6A,0x69,0xE5,0x75,0xB0,0xD3,0xE7,0x34,0x6F,0xFB,0xCF,0x2B,
+  0x9A,0xE7,0x69,0xE5,0x7D,0x57,0x70,0x4C,0x93,0xEC,0x23,0xE6,0x22,0x20,0x16,0xDC,0x0A,0xF7,0x37,0xBB,
+  0x6A,0x7E,0x0C,0x6B,0x9D,0xBE,0x9B,0x87,0x76,0xF0,0x37,0x2C,0xC3,0xB0,0x56,0x3B,0x2B,0x45,0xE6,0x1F,
+  0xF1,0x8E,0x37,0x01,0xAE,0x6F,0x21,0xD4,0x34,0x8E,0xE0,0x29,0xB5,0xB5,0x76,0xA9,0x85,0x06,0x38,0x8E,
+  0x7C,0x70,0x5C,0x4A,0x9C,0xD4,0x52,0x53,0x86,0xD1,0xC2,0x63,0x4F,0x92,0xD2,0x8E,0xC7,0x17,0x1E,0x6B,
+  0xD4,0x57,0x34,0x05,0x15,0x5B,0x73,0x8C,0x5D,0xC5,0x05,0x2D,0xDD,0x82,0x7C,0xF3,0x77,0xD2,0x3F,0xE8,
+  0xB6,0xBB,0x2D,0x1F,0x25,0x37,0xF3,0xC9,0x70,0x4F,0x6F,0xC7,0xD9,0x55,0x4F,0x3F,0x91,0xDF,0x1B,0xFF,
+  0xD9,0xB2,0x79,0x1A,0xF7,0xDC,0x55,0xD7,0xBC,0xFD,0x76,0xE1,0xAF,0xFF,0x9A,0xC9,0x75,0x53,0xFE,0x07,
+  0x32,0x44,0xE4,0x0B,0xF7,0xDD,0x27,0x12,0xBE,0x30,0x72,0xDB,0x22,0x9A,0xAB,0xBA,0xD7,0xF7,0xFE,0x22,
+  0xDD,0x56,0x80,0x0D,0xEC,0xC3,0x7B,0x6C,0xB9,0x90,0xAD,0x4B,0x13,0xBF,0x63,0xAF,0x1D,0x53,0x7F,0xD4,
+  0xD8,0x8D,0x1F,0xFD,0x27,0x1E,0x5C,0xF6,0xFC,0xE2,0xDA,0xD9,0x0E,0xEC,0xFE,0x95,0xA4,0x94,0x17,0x28,
+  0xF7,0xC0,0x4E,0xAF,0xE5,0x9C,0xA9,0x0A,0x7B,0xAC,0x4B,0x56,0x36,0x67,0xFE,0x20,0x5E,0xBE,0xB2,0xF3,
+  0x72,0x16,0x4A,0xE8,0x72,0x16,0xAA,0xB8,0x2F,0x7B,0xAB,0xA5,0x90,0x7B,0x56,0x28,0xEE,0x5C,0x1E,0x85,
+  0x6A,0xE3,0x4B,0xAD,0xAF,0x37,0x97,0xCE,0x4A,0x45,0xAB,0x35,0x47,0x02,0xEE,0xD8,0x33,0x2F,0x01,0x3B,
+  0x76,0x47,0x22,0xAD,0x51,0x8A,0x72,0xC5,0xEC,0x19,0x39,0xB6,0x8E,0xB0,0x29,0x86,0xA0,0x09,0xEE,0x15,
+  0xE6,0xA5,0x94,0x12,0x68,0x63,0x81,0x49,0x91,0x47,0xAE,0x0F,0xA0,0x8E,0x19,0xF5,0x0C,0x11,0xB3,0x40,
+  0xC6,0x15,0x56,0x36,0xB8,0x2A,0x5B,0x5D,0x78,0x4F,0xD9,0x0E,0xF0,0x9E,0xEA,0xFF,0x68,0xCC,0x4E,0x7B,
+  0x6E,0xD9,0xB1,0x42,0x6C,0x58,0xCE,0x34,0x1C,0xD8,0x2F,0x1F,0xDE,0x3F,0x52,0xEB,0x67,0xF8,0xBD,0x05,
+  0x87,0xA3,0x71,0xD6,0x0F,0x4E,0x8D,0xB6,0x24,0xAE,0xF3,0x49,0xA0,0xA8,0xB8,0xDE,0x01,0xCD,0x1F,0xF0,
+  0x3C,0x8E,0x2C,0xD9,0x08,0x2B,0xE9,0xA6,0xFD,0x3C,0xCF,0x9E,0x66,0xE4,0xEC,0x86,0xBD,0x79,0xC3,0xFA,
+  0xFE,0xC0,0xCF,0xF7,0x51,0x6D,0x19,0x7B,0x8F,0xB5,0x43,0x56,0x77,0x4F,0xDB,0xDF,0x08,0xEA,0x87,0xE7,
+  0xA7,0x1F,0xA7,0x0D,0xB7,0x0E,0x06,0x14,0xD7,0xD0,0x04,0xD8,0xD0,0x6E,0x18,0x67,0xC2,0x14,0x6D,0x4D,
+  0x72,0xA7,0x44,0xFC,0x41,0x81,0x7F,0x5D,0x77,0xDF,0x8B,0xD1,0x20,0x7A,0x3C,0x95,0x5A,0x83,0xF5,0xBF,
+  0xA8,0x03,0x96,0x43,0x4B,0xFB,0x4A,0x96,0xDD,0xA8,0x4F,0x31,0x61,0xB4,0x05,0xA0,0xA4,0xDF,0x2F,0x31,
+  0x61,0xDF,0x50,0x4D,0x3B,0x0F,0xC2,0x1A,0xD0,0xA3,0xE8,0xBB,0x87,0x4D,0x34,0x61,0x51,0xEF,0x8B,0xAB,
+  0xB6,0xA6,0x3F,0x1B,0xC8,0xA9,0x0F,0x6D,0x0B,0x83,0x09,0x28,0x6B,0x30,0x2D,0xE6,0xC9,0x7C,0x3E,0xBF,
+  0x74,0x39,0xD0,0x82,0x4C,0xF2,0x2E,0xFA,0x51,0x4B,0xE9,0x0F,0x52,0xD3,0x89,0xA7,0x11,0xDC,0x84,0xF9,
+  0x23,0x8F,0x1B,0xD6,0x33,0xB8,0x4E,0xB0,0xE4,0xC1,0x9C,0x58,0xFC,0xB5,0x10,0x19,0xAD,0x74,0x58,0x24,
+  0xDA,0x46,0xFE,0x2F,0xC1,0x9F,0x6B,0xB7,0x9D,0x44,0x28,0x08,0x00,0x00,
+};
+const webassets::Asset htmlPageStatusAsset = {htmlPageStatusGz, sizeof(htmlPageStatusGz), htmlPageStatus, "text/html", "\"2b8ed8ae826cf10d\""};
+
+// htmlPageOwTempLive: 3046 -> 1195 Byte
+const uint8_t htmlPageOwTempLiveGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xC5,0x56,0xEF,0x6E,0xDB,0x36,0x10,0xFF,0xBC,0xB7,
+  0xB8,0x35,0x40,0x25,0x21,0x91,0x2C,0x67,0x49,0xDB,0x89,0xB6,0x3F,0xA4,0xE9,0xD6,0x01,0xFD,0x03,0xAC,
+  0x41,0x37,0x60,0xD8,0x07,0x5A,0xA4,0x2D,0x22,0x12,0xA9,0x91,0x94,0x1D,0xD7,0xF0,0x3B,0xED,0x19,0xF6,
+  0x64,0xBB,0x93,0x64,0x27,0x71,0x8C,0xA5,0x5D,0x81,0xCD,0x84,0x24,0x93,0xBC,0xFB,0xDD,0xDD,0xEF,0xC8,
+  0x23,0x47,0xDF,0x0A,0x93,0xFB,0x55,0x2D,0xA1,0xF0,0x55,0x39,0x19,0xF5,0x6F,0xC9,0xC5,0x64,0x54,0x49,
+  0xCF,0x21,0x2F,0xB8,0x75,0xD2,0x8F,0x83,0xC6,0xCF,0xE2,0x17,0xC1,0x60,0x32,0xF2,0xCA,0x97,0x72,0x32,
+  0x1A,0xF4,0x5F,0xE7,0x57,0xF8,0x21,0x3D,0x58,0xCF,0x8C,0xF6,0xF1,0x8C,0x57,0xAA,0x5C,0x65,0xAF,0x65,
+  0xB9,0x90,0x5E,0xE5,0x9C,0x09,0xE5,0xEA,0x92,0xAF,0x32,0xA5,0x4B,0xA5,0x65,0x3C,0x2D,0x4D,0x7E,0xCD,
+  0x2A,0x6E,0xE7,0x4A,0x67,0x69,0x7D,0x03,0xBC,0xF1,0x86,0x79,0x79,0xE3,0x63,0x5E,0xAA,0xB9,0xCE,0x72,
+  0xA9,0xBD,0xB4,0x6C,0x33,0x35,0x62,0x05,0xEB,0xAD,0x20,0xDB,0x24,0x39,0xC2,0xE3,0x1C,0xAC,0x6B,0x2E,
+  0x84,0xD2,0xF3,0xEC,0x14,0xD5,0x71,0xDC,0x9B,0x5A,0xF3,0x05,0xAC,0xCD,0x42,0xDA,0x59,0x69,0x96,0x19,
+  0x14,0x4A,0x08,0xA9,0x59,0x6D,0x9C,0xF2,0xCA,0xE8,0xCC,0xA1,0x23,0xD7,0x2B,0x86,0x82,0x08,0x34,0xE5,
+  0xF9,0xF5,0xDC,0x9A,0x46,0x8B,0x38,0x37,0xA5,0xB1,0xD9,0xD1,0xB3,0x57,0xD4,0x58,0xD7,0x5B,0x16,0xCA,
+  0x4B,0xB6,0x35,0x71,0x8E,0x16,0xF2,0xC6,0x3A,0x9C,0x10,0x72,0xC6,0x9B,0xD2,0xDF,0x1A,0x74,0x35,0xD7,
+  0x18,0x74,0x69,0xB8,0xCF,0x4A,0x39,0xF3,0x0C,0xB6,0x5A,0x30,0x3C,0xC3,0xC0,0x86,0xCF,0x50,0x19,0xDA,
+  0xC8,0x84,0xCC,0x8D,0xE5,0xAD,0x2F,0xDA,0x68,0xC9,0xA0,0xA5,0xCA,0xA9,0x4F,0x32,0x1B,0x26,0xCF,0xAD,
+  0xAC,0x10,0x75,0xEA,0xF5,0x05,0xBA,0x96,0x15,0x14,0x07,0xAC,0x1F,0xBA,0x79,0xDE,0xFE,0xEE,0xB9,0xB9,
+  0x49,0x0A,0xE2,0xBD,0x94,0x37,0xD9,0x90,0xDD,0x62,0x9E,0x76,0x88,0x39,0xB7,0xC2,0xED,0xD1,0x55,0xF1,
+  0x9B,0x78,0xA9,0x84,0x2F,0xB2,0xE7,0x69,0xD7,0xEF,0xF8,0xED,0xD2,0xB0,0xCD,0xD5,0xDC,0x2A,0xC1,0xE8,
+  0x15,0xCF,0x79,0xDD,0xC1,0xB5,0x3D,0x2F,0x2B,0x9C,0xF7,0x92,0x5C,0x6A,0x2A,0xED,0x32,0x2B,0x6B,0xC9,
+  0x7D,0x48,0xCA,0xF1,0x4C,0xF9,0x93,0x4A,0x69,0xB4,0x10,0x9E,0x12,0xF6,0xC9,0x70,0x66,0xA3,0xA8,0xF7,
+  0xE3,0xC2,0xEB,0x03,0x31,0x75,0x51,0x4C,0xCD,0x4D,0xEC,0x0A,0x2E,0x30,0x75,0xA7,0xC8,0x1B,0x3D,0xC3,
+  0xF6,0x85,0x8F,0x9D,0x4F,0x79,0x38,0x3C,0x4B,0x4F,0xB6,0x4F,0x72,0x1E,0xB1,0x83,0x9C,0xDE,0x09,0xBF,
+  0x25,0xFE,0x41,0xDA,0xC8,0x8D,0x4B,0xEE,0x8A,0x43,0xDC,0xFE,0x70,0x4A,0xED,0xBF,0xF6,0xE4,0x30,0x29,
+  0xFF,0x83,0x33,0xE8,0xC8,0x17,0xAE,0xBB,0x3B,0x21,0x7C,0xA1,0xE6,0xB4,0xF1,0xDE,0x1C,0x8C,0xFB,0xE2,
+  0x92,0x1A,0xC6,0x6D,0x85,0xB4,0x9D,0xF7,0xDD,0xFF,0xD8,0x72,0xA1,0x1A,0x97,0x0D,0x69,0xC5,0x1E,0xDA,
+  0xA6,0xB4,0xD5,0xE0,0x8C,0x66,0x3F,0x87,0x83,0x7E,0xCD,0x9F,0x1E,0xDA,0xDB,0x9D,0x77,0xFF,0x2A,0xA4,
+  0x8C,0xE7,0x5E,0x2D,0x24,0xAC,0xEF,0x87,0xB3,0xC1,0x42,0x4A,0x58,0xBD,0x55,0x48,0x81,0x36,0x62,0xFF,
+  0x61,0x9B,0xD1,0xA0,0x2B,0xA1,0x7D,0x25,0x4D,0xA6,0x9C,0xEC,0x76,0x14,0x80,0x33,0xA5,0x12,0x70,0xF4,
+  0x22,0xA5,0x46,0x2B,0x60,0x8F,0x10,0xA0,0xFA,0x14,0x57,0xE6,0x53,0x7C,0x67,0xB1,0xC0,0x77,0x08,0xBF,
+  0x7D,0x8E,0x5E,0xA6,0xD4,0x58,0xBC,0x94,0xD3,0x6B,0xE5,0x1F,0x95,0x7B,0x6C,0x7E,0x57,0xE2,0x70,0x90,
+  0x75,0x85,0x04,0x89,0xA7,0x48,0x0A,0xA9,0xE6,0x85,0xC7,0xDA,0xB7,0x17,0x56,0x6E,0x55,0xED,0x27,0xB3,
+  0x46,0xE7,0x94,0x10,0x40,0xFD,0x0F,0x52,0x23,0xE9,0xA1,0x6B,0x3F,0xEF,0x6C,0xB4,0x96,0xA5,0xAC,0x60,
+  0x0C,0x78,0x16,0x35,0x15,0x56,0xF8,0x24,0xB7,0x58,0x54,0xE4,0x2B,0x1C,0xC5,0x5E,0x18,0x50,0xA1,0x0D,
+  0x22,0x46,0x52,0x89,0xD2,0x5A,0xDA,0xD7,0x57,0x6F,0xDF,0xC0,0x38,0x18,0x4D,0xED,0xA4,0xC3,0x82,0xA3,
+  0x00,0x8E,0x61,0x0B,0x88,0x7F,0x03,0x88,0x21,0x60,0x3B,0x40,0x3A,0x4B,0x12,0x5E,0xD7,0x52,0x8B,0x97,
+  0x85,0x2A,0x45,0x48,0x58,0x1D,0xE2,0xE7,0xDA,0x15,0x28,0x18,0x50,0xFD,0x73,0xC1,0xF1,0xD6,0xD0,0x43,
+  0x97,0xE2,0x18,0xFE,0xFA,0xF3,0xE5,0x57,0x5B,0x9E,0x5A,0xB4,0xFB,0x95,0x18,0xB5,0x35,0x73,0x2B,0x9D,
+  0x7B,0x18,0xC1,0x7E,0x00,0x79,0xC9,0x9D,0x7B,0xC7,0x2B,0x49,0x02,0xB8,0xFE,0x82,0x6E,0x78,0xC1,0xCB,
+  0x86,0x86,0xD2,0xAE,0x8B,0x75,0x1D,0x3B,0xE7,0xE9,0xA3,0x7E,0x6D,0x60,0x97,0x6C,0xBC,0x3A,0x74,0x09,
+  0xFA,0xC8,0xCB,0x5D,0xBE,0x4F,0xFA,0x44,0x7D,0x24,0xFC,0x68,0x5D,0x4A,0x0F,0xFB,0xA1,0xCC,0xA5,0xEF,
+  0xE3,0xB8,0x58,0xFD,0x24,0xC2,0x3D,0xAF,0xA3,0xFB,0xFE,0xDD,0x41,0x63,0x9F,0x03,0xE4,0x1E,0x20,0xDD,
+  0xC9,0x20,0xE0,0xAA,0x9A,0x6C,0x05,0x5A,0xCC,0xE3,0x80,0x52,0x3A,0x9A,0x0E,0x02,0xB6,0xD9,0x05,0x86,
+  0xB8,0x97,0xDC,0xF3,0x30,0x82,0xF5,0x02,0x37,0xEC,0x4D,0xE1,0x7D,0x8D,0xCA,0x5A,0x2E,0xE1,0xD7,0xB7,
+  0x6F,0x5E,0x63,0xEF,0x67,0xF9,0x47,0x23,0x9D,0x0F,0x23,0xD6,0x4E,0x26,0x46,0x63,0x7A,0xC4,0xCA,0x79,
+  0xCC,0x11,0xDE,0xAA,0xF4,0x9C,0x5C,0xDF,0xE2,0x85,0xD1,0x1A,0x40,0xCD,0x20,0xF4,0x85,0x72,0x49,0x2B,
+  0xF8,0x81,0x04,0x61,0x3C,0x86,0x33,0x78,0xFA,0x14,0xDA,0x71,0xD2,0x6D,0x1C,0x8D,0xE1,0xF9,0x4A,0x1A,
+  0x00,0x64,0xBC,0xE5,0x01,0x87,0xA1,0x57,0x76,0xB5,0xD1,0x4E,0x5E,0x61,0x21,0x4C,0xF0,0x34,0x57,0xB8,
+  0x14,0x18,0xAE,0x01,0x92,0x9E,0xE1,0xAE,0x53,0xE3,0x94,0xA9,0xD1,0xB3,0x33,0xA6,0x8E,0x8F,0xA3,0xF5,
+  0x37,0x40,0x76,0xC3,0x0E,0xE2,0x37,0xF5,0xFB,0x68,0x78,0x8E,0xC8,0xF7,0xD2,0xA6,0x4E,0x60,0x37,0x4D,
+  0xC9,0xC5,0x1F,0xBE,0x36,0x9B,0x6D,0x5C,0x98,0xFE,0x30,0xF8,0xF1,0xD5,0x55,0x70,0x02,0x01,0xD2,0xF2,
+  0x7E,0x79,0x85,0x1C,0x13,0x39,0x38,0xE0,0x2D,0x66,0xB8,0x17,0xF4,0xAA,0x92,0xA6,0xF1,0xE3,0x61,0x9A,
+  0xA6,0xFD,0x10,0xB2,0x2C,0x90,0x20,0x0A,0x82,0x66,0x2D,0xC6,0xB0,0x54,0x1A,0x6B,0x0F,0xCE,0xF8,0xAB,
+  0x4E,0x3E,0x0C,0x76,0x5C,0x23,0x20,0x29,0xA7,0x51,0x5B,0x5E,0xBA,0xBA,0x32,0x1A,0x74,0xB7,0x55,0x5A,
+  0x8B,0x93,0x91,0x50,0x0B,0x68,0x57,0xF3,0x38,0xE8,0x2E,0x69,0x01,0x16,0x20,0xBA,0xA6,0xF5,0x83,0xFD,
+  0x1D,0x2B,0x00,0xA3,0xF3,0x12,0xEF,0x84,0xE3,0x27,0x78,0x1B,0x6D,0x0F,0x8A,0xA4,0xB0,0x72,0x36,0x0E,
+  0x92,0x64,0x10,0x3C,0x99,0x3C,0x3D,0x42,0x3B,0xDF,0x9F,0x31,0xB4,0x82,0xCA,0x8F,0x40,0xEC,0x21,0x0C,
+  0x82,0x9D,0xFA,0x3F,0xC1,0x14,0x65,0x30,0x21,0xA2,0x24,0x9E,0x53,0x8D,0x95,0x1A,0xC2,0xF7,0xBF,0x44,
+  0x5B,0xC1,0x01,0xC6,0x71,0x5B,0x39,0x1F,0x24,0xED,0xB6,0x84,0x2A,0x4A,0xC8,0x8E,0x1F,0x76,0x87,0x95,
+  0x8E,0x8F,0x41,0x7B,0xA1,0xFF,0x1B,0x76,0xFE,0xF7,0x5F,0xE6,0x0B,0x00,0x00,
+};
+const webassets::Asset htmlPageOwTempLiveAsset = {htmlPageOwTempLiveGz, sizeof(htmlPageOwTempLiveGz), htmlPageOwTempLive, "text/html", "\"93f2d21891caa3e8\""};
+
+// htmlPageBscDataLive: 8249 -> 1900 Byte
+const uint8_t htmlPageBscDataLiveGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xC5,0x5A,0x6D,0x6F,0xDB,0x36,0x10,0xFE,0xDE,0x5F,
+  0xC1,0xB5,0x58,0x65,0x23,0xF1,0x8B,0xDC,0xBC,0xB4,0x92,0x6C,0xA0,0x4E,0xD3,0x75,0x43,0xE3,0x02,0x4B,
+  0x50,0x0C,0x2B,0x8A,0x82,0x92,0x68,0x9B,0xB5,0x44,0x69,0x24,0x9D,0xC4,0x33,0xF2,0xDF,0x77,0x14,0x25,
+  0x59,0x4E,0x2C,0x8B,0x2E,0x86,0x2D,0x86,0x25,0x59,0x3C,0x3E,0x7C,0xEE,0xA8,0x7B,0x74,0x24,0xE2,0xFD,
+  0x14,0x26,0x81,0x5C,0xA5,0x04,0xCD,0x65,0x1C,0x8D,0xBC,0xFC,0x48,0x70,0x38,0xF2,0x62,0x22,0x31,0x0A,
+  0xE6,0x98,0x0B,0x22,0x87,0xD6,0x52,0x4E,0x3B,0xAF,0xAD,0xDE,0xC8,0x93,0x54,0x46,0x64,0xE4,0xF5,0xF2,
+  0xB3,0x90,0x2B,0x38,0xA9,0x7E,0x68,0x3D,0x4D,0x98,0xEC,0x4C,0x71,0x4C,0xA3,0x95,0xF3,0x81,0x44,0xB7,
+  0x44,0xD2,0x00,0xBB,0x21,0x15,0x69,0x84,0x57,0x0E,0x65,0x11,0x65,0xA4,0xE3,0x47,0x49,0xB0,0x70,0x63,
+  0xCC,0x67,0x94,0x39,0xFD,0xF4,0x1E,0xE1,0xA5,0x4C,0x5C,0x49,0xEE,0x65,0x07,0x47,0x74,0xC6,0x9C,0x80,
+  0x30,0x49,0xB8,0xFB,0xE0,0x27,0xE1,0x0A,0xAD,0x0B,0x43,0xF7,0xA1,0x1B,0x00,0x3C,0xB4,0xA1,0x75,0x8A,
+  0xC3,0x90,0xB2,0x99,0x33,0x80,0xEE,0x70,0x5F,0x26,0x29,0xC3,0xB7,0x68,0x9D,0xDC,0x12,0x3E,0x8D,0x92,
+  0x3B,0x07,0xCD,0x69,0x18,0x12,0xE6,0xA6,0x89,0xA0,0x92,0x26,0xCC,0x11,0x40,0x64,0xB1,0x72,0xC1,0x10,
+  0x80,0x7C,0x1C,0x2C,0x66,0x3C,0x59,0xB2,0xB0,0x13,0x24,0x51,0xC2,0x9D,0x17,0x67,0x97,0xEA,0xE3,0xEA,
+  0x5F,0x77,0x73,0x2A,0x89,0x5B,0x0C,0x71,0x0A,0x23,0x04,0x4B,0x2E,0xA0,0x21,0x24,0x53,0xBC,0x8C,0xE4,
+  0x66,0x40,0x91,0x62,0x06,0x4E,0x47,0x09,0x96,0x4E,0x44,0xA6,0xD2,0x45,0x45,0x2F,0x64,0x9F,0x80,0x63,
+  0xF6,0x19,0x74,0x46,0x99,0x67,0x21,0x09,0x12,0x8E,0x33,0x2E,0x2C,0x61,0xC4,0x45,0x59,0xA8,0x04,0xFD,
+  0x9B,0x38,0x76,0xF7,0x9C,0x93,0x18,0x50,0x7D,0xC9,0xC6,0x40,0xCD,0x99,0x2B,0x3F,0xD0,0xFA,0x29,0xCD,
+  0xD3,0xEC,0x6F,0x8B,0xE6,0x43,0x77,0xAE,0xE2,0x1E,0x91,0x7B,0xC7,0x76,0x37,0x98,0x03,0x8D,0x18,0x60,
+  0x1E,0x8A,0x47,0xE1,0x8A,0xF1,0x7D,0xE7,0x8E,0x86,0x72,0xEE,0x9C,0xF7,0xF5,0x6F,0x1D,0x5F,0x3D,0x0D,
+  0xC5,0x5C,0xCD,0x38,0x0D,0x5D,0x75,0xE8,0xCC,0x70,0xAA,0xE1,0xB2,0x5F,0x92,0xC4,0xD0,0x2E,0x89,0xA2,
+  0xB4,0x8C,0x99,0x70,0x38,0x49,0x09,0x96,0x2D,0xD5,0xB9,0x33,0xA5,0xF2,0x38,0xA6,0x0C,0x46,0x68,0x0D,
+  0x14,0xF6,0xB1,0x3D,0xE5,0xED,0x76,0xCE,0x63,0x2C,0xD9,0x0E,0x9F,0xB4,0x17,0x7E,0x72,0xDF,0x11,0x73,
+  0x1C,0xC2,0xD4,0x0D,0x20,0x6E,0xEA,0x6B,0x67,0x07,0xF8,0xF2,0x99,0x8F,0x5B,0xF6,0x49,0xFF,0xB8,0xF8,
+  0x76,0x4F,0xDB,0xEE,0xCE,0x98,0x56,0xDC,0xCF,0x02,0xFF,0x64,0xDA,0x14,0x8D,0x77,0x58,0xCC,0x77,0xC5,
+  0xF6,0xFD,0x40,0x7D,0xFE,0x6B,0x26,0xBB,0x83,0xF2,0x3F,0x90,0x01,0x22,0x07,0x3E,0x77,0x15,0x17,0x0E,
+  0xEC,0xE9,0x2F,0xA5,0x4C,0x76,0xFA,0x3D,0x7E,0xA7,0x3E,0xE0,0x37,0x0F,0x09,0xD7,0xEC,0xF5,0x75,0x87,
+  0xE3,0x90,0x2E,0x85,0x63,0xAB,0x27,0x76,0x57,0x9A,0xAA,0x54,0x43,0x27,0xAA,0xD5,0x24,0x06,0xF9,0x33,
+  0x3F,0xD8,0x95,0xDB,0x9A,0xDD,0x0F,0xB9,0xE4,0xE0,0x40,0xD2,0x5B,0x82,0xD6,0xDB,0xEE,0x3C,0x80,0x90,
+  0x2A,0xAC,0x7C,0x54,0xD4,0x47,0x2A,0x11,0xF3,0x93,0xFB,0xE0,0xF5,0xB4,0x84,0x7A,0xD7,0xD9,0x49,0x27,
+  0xED,0xC7,0xDA,0xAC,0xB5,0x5F,0xFD,0xFB,0x69,0x1B,0x45,0x45,0xDE,0x9E,0x54,0xF3,0xD6,0xEB,0x69,0x4A,
+  0x9E,0x08,0x38,0x4D,0xE5,0x68,0xBA,0x64,0x81,0x8A,0x29,0x02,0x66,0xE3,0x58,0x5C,0x00,0xD1,0x56,0x48,
+  0x6E,0x27,0x38,0x26,0xC7,0x08,0x2E,0x7E,0x0D,0xCB,0xCB,0x09,0x6F,0xAF,0x23,0x22,0x91,0x1A,0x18,0x0D,
+  0x11,0xBC,0x64,0x96,0x31,0x48,0x77,0x77,0x46,0xE4,0x65,0x44,0xD4,0xA5,0x18,0xAF,0x6E,0xF0,0x4C,0x75,
+  0x68,0x59,0x05,0x3D,0xAB,0xFD,0xA5,0xFF,0xD5,0x55,0xFD,0x18,0xB9,0x53,0xF0,0xD0,0x55,0xB5,0x15,0xCA,
+  0xDF,0x0D,0x22,0x98,0xCD,0x49,0x12,0x92,0x96,0xE4,0x4B,0xD2,0x76,0x73,0xB3,0x0A,0xEC,0x78,0xF5,0x6B,
+  0xD8,0xB2,0x54,0x0C,0x3F,0xC0,0x4B,0xCC,0x6A,0x77,0x29,0x63,0x84,0x7F,0xB8,0xB9,0xFA,0x38,0xCC,0xA9,
+  0x1E,0x59,0xA8,0x65,0x1D,0x65,0x1C,0x8F,0xAC,0xB6,0x05,0xCF,0x06,0x6F,0xD1,0x61,0xDF,0xA5,0xDE,0x00,
+  0x0E,0x47,0x47,0xED,0x75,0x1D,0xAA,0x1F,0x8B,0xFE,0xB7,0xBF,0x49,0x14,0x7D,0x4E,0x22,0x89,0x67,0xC4,
+  0x3A,0xA2,0x80,0x1F,0x0E,0x4B,0xD7,0x0B,0xD4,0x47,0x46,0xEE,0xC3,0x5E,0x44,0x88,0xFB,0x9F,0x60,0xFF,
+  0x8E,0x4E,0xA7,0x56,0x0D,0x5E,0xD5,0xC4,0xDD,0x0B,0xE6,0xE3,0xE8,0x13,0xAB,0x83,0xD1,0x8D,0x6E,0x13,
+  0x9B,0x8B,0x9C,0xFD,0x1E,0x36,0xA5,0xC9,0x7E,0xB0,0xF7,0x44,0x5E,0xCB,0x6C,0x62,0x77,0x23,0x95,0xED,
+  0x0D,0x9C,0x28,0x6B,0xE4,0x54,0x31,0x69,0x88,0x50,0x2C,0x2E,0x39,0xAF,0x0D,0x91,0x6E,0x35,0x8E,0xD1,
+  0x84,0x1B,0x44,0x69,0xC2,0xCD,0x1D,0xDC,0x03,0xB8,0x65,0xB4,0x1F,0x50,0x24,0x41,0x1D,0x8C,0x6A,0xDA,
+  0xDF,0x59,0x26,0x12,0xEF,0x0D,0xF6,0xC6,0xC0,0x00,0xE8,0x62,0x59,0x1F,0xED,0x8D,0x81,0xBB,0x43,0x22,
+  0x36,0xB9,0x2C,0x00,0x00,0xA7,0x29,0x61,0xE1,0xC5,0x9C,0x46,0x61,0x2B,0x1F,0x15,0x34,0xAA,0xAA,0x49,
+  0x6F,0xA3,0x28,0x97,0x25,0xD1,0x6A,0xAF,0x55,0x5E,0x63,0xC8,0x6B,0xEC,0xD9,0xB6,0x8B,0x21,0xAF,0xAB,
+  0xB2,0x65,0x8D,0xAF,0xAE,0xAD,0x63,0xC5,0xD2,0x3A,0xC6,0xED,0x4C,0x03,0x7C,0xB0,0xF5,0xBD,0x73,0xD7,
+  0x7F,0x62,0x7A,0x83,0x72,0x6B,0x99,0xD9,0xFB,0xD5,0x61,0x81,0xED,0x3B,0x2C,0x71,0xAB,0x8D,0xD6,0xB7,
+  0x98,0xA3,0xFB,0xB9,0x94,0x4A,0xF0,0x80,0x20,0xFA,0xE3,0xEA,0xE3,0x07,0xF8,0xF5,0x3B,0xF9,0x6B,0x49,
+  0x84,0x6C,0xB5,0xDD,0xAC,0xB1,0x9B,0x30,0x0E,0xCA,0xB4,0x12,0xEA,0xB9,0x87,0xEA,0x9A,0xCD,0x08,0xD8,
+  0x17,0x78,0xC0,0x9B,0x4E,0x51,0x4B,0xCE,0xA9,0xE8,0x66,0x66,0x59,0x7A,0xA0,0xE1,0x10,0x9D,0xA0,0x97,
+  0x2F,0x51,0x76,0x5F,0xF5,0x5C,0x0A,0x75,0x0F,0xAA,0xAC,0x36,0xBC,0x6C,0x98,0x90,0xE8,0xBB,0x48,0xD8,
+  0x27,0xFF,0x3B,0x40,0xFD,0x76,0xFD,0x69,0xD2,0x4D,0x55,0xD5,0x5E,0xC0,0x88,0x14,0x4C,0xC8,0x0D,0xBC,
+  0x18,0xDB,0xEE,0x33,0xE5,0xEA,0x02,0x5C,0x5D,0xA8,0xB0,0x2C,0x94,0xDC,0x3D,0x7B,0xAA,0x80,0xCF,0x6A,
+  0x67,0x43,0x45,0xE0,0x68,0xF1,0x44,0xE2,0xAA,0x3A,0x9B,0x53,0xE9,0x82,0xE9,0x37,0x41,0x38,0xC5,0xD1,
+  0x97,0xC5,0xD7,0x6E,0x00,0xF6,0xDF,0x6E,0x75,0x87,0x2F,0xF4,0xAB,0xFB,0xEC,0xC1,0x60,0x90,0xAD,0x27,
+  0xB1,0x61,0x80,0xD2,0xD6,0x35,0x05,0x2E,0x9E,0x4C,0x13,0x60,0x65,0x6B,0x02,0x9C,0x27,0x5E,0x03,0x24,
+  0x58,0x99,0x80,0x3D,0x7A,0x33,0x34,0x80,0x56,0xAC,0x0D,0xC1,0xAB,0xA2,0xDA,0x0C,0x5E,0x58,0x1B,0x81,
+  0x6F,0x2B,0x76,0x13,0xF8,0xC6,0xFA,0x40,0xE6,0x13,0x7E,0x18,0xF7,0x09,0x3F,0x90,0xBD,0xD9,0x00,0x55,
+  0x7B,0x93,0x01,0xCA,0xB7,0x74,0x03,0x70,0x66,0x67,0x02,0x58,0x7D,0xD1,0x36,0x60,0x16,0xA6,0x46,0x3C,
+  0xCB,0x77,0x65,0x13,0xD1,0xCC,0x50,0x25,0xF5,0x46,0x5F,0xCE,0x7F,0x44,0x5E,0xE4,0x81,0x02,0xE3,0xCB,
+  0x83,0xC5,0x45,0x1E,0x20,0x2F,0x1A,0xDE,0x48,0x5A,0xE4,0x01,0xE2,0x52,0x81,0x6D,0x12,0x16,0x69,0x24,
+  0x2D,0x1A,0xB0,0x41,0x56,0xE4,0x41,0xC2,0xA2,0x21,0x0D,0x45,0x45,0x1E,0x24,0x2B,0x25,0xB4,0x49,0xD6,
+  0xCB,0x83,0x44,0x25,0x87,0x36,0x13,0x14,0x79,0xA0,0xA4,0x3C,0xE1,0x3D,0xE1,0x07,0x33,0x6F,0x86,0x37,
+  0x15,0x13,0x69,0x28,0x27,0x1A,0xB6,0x51,0x4A,0xA4,0xB9,0x98,0x68,0x44,0x13,0x21,0x91,0xA6,0x52,0x92,
+  0x93,0x2C,0x65,0x04,0x3E,0x45,0xBD,0x04,0x65,0x5F,0xCB,0xFA,0xE5,0xF2,0xC6,0x3A,0x46,0x16,0x0C,0x30,
+  0x16,0xC1,0x47,0x58,0x65,0xAB,0xAA,0x0B,0xEE,0xE8,0x75,0xA0,0xB6,0x94,0x34,0x26,0xC9,0x52,0x0E,0xED,
+  0x7E,0xBF,0x9F,0xDF,0x12,0x50,0x32,0x42,0xE5,0xA5,0x4A,0x33,0xD5,0xCA,0xA1,0x3E,0xBA,0xA3,0x2C,0x4C,
+  0xEE,0xA0,0x45,0xDE,0x68,0xFB,0x96,0x55,0x16,0x71,0x00,0xA8,0x3A,0xF7,0xB3,0xC5,0x6F,0xBE,0xEA,0xF5,
+  0x7A,0x7A,0x3B,0x54,0x6D,0x47,0x8E,0xBC,0x90,0xDE,0xA2,0x20,0xC2,0x42,0x0C,0x2D,0xBD,0x0B,0x68,0xC1,
+  0xF2,0x58,0xED,0x03,0xE6,0x37,0xF3,0x4D,0x3C,0x0B,0x25,0x2C,0x88,0x68,0xB0,0x18,0x3E,0x8F,0x92,0x20,
+  0xDB,0x89,0xE8,0xCE,0x39,0x99,0x0E,0xAD,0x6E,0xB7,0x67,0x3D,0x1F,0xBD,0x7C,0x01,0xE3,0xBC,0x39,0x71,
+  0x61,0x14,0xE8,0xDC,0x00,0xF1,0x08,0xA1,0x67,0x95,0xDD,0xF7,0xC1,0xCC,0x23,0x6B,0x34,0xBE,0xBE,0x40,
+  0xE0,0x19,0x61,0x85,0x41,0x0F,0xF8,0x6F,0x39,0x91,0xAF,0xAC,0x2D,0x7D,0x13,0x8A,0xF4,0xBC,0xDE,0x2E,
+  0xDB,0xB3,0xDD,0x08,0xAB,0xE8,0xA9,0x8F,0xC5,0x7A,0x7D,0x1B,0x29,0xDF,0x10,0x02,0xDB,0xB4,0x04,0xCA,
+  0x16,0xE1,0x23,0x28,0x9F,0x91,0x7E,0x57,0xA0,0xBE,0xD7,0x4B,0x47,0x9E,0xDE,0xE2,0x05,0x20,0xEC,0x47,
+  0x04,0x65,0xFB,0x1F,0x43,0xAB,0xB2,0x49,0xA3,0x76,0x38,0x00,0x47,0x2A,0x93,0x70,0xD4,0x77,0x90,0xD7,
+  0x83,0xB3,0xBA,0xD6,0x2E,0x2A,0xF8,0xC7,0xAB,0xF1,0xBE,0x35,0xEA,0xC0,0x5F,0xEE,0xE9,0x4B,0xE6,0x8B,
+  0xD4,0x8D,0x3F,0x97,0x1D,0x4F,0x8C,0x40,0x4E,0xF6,0x83,0xBC,0x36,0x02,0x79,0xBD,0x1F,0xC4,0x1E,0x18,
+  0xA1,0xD8,0x83,0x06,0x98,0x33,0x33,0x98,0xB3,0x3D,0x30,0xBD,0x2C,0xC2,0x3A,0xCA,0xB6,0x19,0xDC,0x7E,
+  0x52,0xA7,0x46,0x20,0xA7,0xFB,0x41,0xDE,0x18,0x81,0xBC,0x69,0x08,0xCF,0x2B,0x33,0x7F,0x5E,0x35,0xC0,
+  0x9C,0x9B,0xC1,0x9C,0x1B,0x46,0xD9,0x6C,0xEE,0x1B,0xA6,0xDE,0x6C,0xE6,0xCF,0x1A,0x3C,0x33,0x4B,0x2B,
+  0xBB,0x21,0xAF,0x6C,0xB3,0xC4,0xB2,0x1B,0x32,0xCB,0x36,0x4B,0x2D,0xFB,0xB5,0x61,0x9C,0xCD,0x66,0xBF,
+  0x61,0xF2,0xCD,0xE6,0xFE,0xBC,0xC1,0x33,0xC3,0xC4,0x6A,0xC8,0x2C,0xDB,0x2C,0xB5,0xEC,0x86,0xDC,0xB2,
+  0xCD,0x92,0xCB,0x7E,0xD3,0x14,0xE7,0x5E,0xA6,0xDD,0xA6,0x12,0x7E,0x85,0xEF,0xBB,0x48,0x95,0x35,0x28,
+  0x84,0x4A,0x92,0x70,0xC2,0x02,0x82,0xF2,0x82,0xBD,0x8E,0x4E,0xB5,0x48,0x1D,0xD5,0xF9,0x33,0xC6,0x11,
+  0x66,0x01,0x65,0x33,0xA4,0x37,0xDF,0xEB,0xC0,0x74,0x89,0xB4,0x0D,0x93,0xDB,0xF2,0x6D,0x96,0x6A,0x2D,
+  0xD1,0xCC,0xAC,0x2C,0x44,0x6B,0x99,0x81,0x65,0x56,0x1E,0xBD,0xBF,0xBC,0x11,0x75,0x40,0x65,0xA5,0xB5,
+  0x8B,0x58,0xF5,0x71,0xBE,0xA2,0xCC,0x8C,0x59,0xA5,0x44,0xAE,0x8F,0x19,0xBC,0x8E,0x09,0xE7,0x09,0xAF,
+  0xE5,0x95,0x17,0x6B,0x8D,0xAC,0x54,0xBC,0x72,0x46,0x19,0x3B,0xB6,0x8C,0x7D,0xC2,0x0D,0xC2,0x36,0xD9,
+  0x0D,0xAE,0x07,0xA8,0x74,0x1E,0x95,0x85,0xCB,0xCE,0x88,0x1C,0x30,0xF6,0x56,0x05,0x5E,0x33,0xF6,0x75,
+  0x72,0x51,0xD7,0x5F,0x2D,0xBE,0xB6,0x7B,0xFD,0xFC,0x94,0xD3,0x8D,0x5A,0xD0,0x35,0x3D,0xD6,0x9B,0x45,
+  0xE7,0x36,0xDE,0x66,0x7E,0x34,0x4C,0x00,0x0B,0x43,0x28,0x93,0xF6,0xC2,0x64,0x8B,0xCC,0x6D,0x98,0xB7,
+  0x3B,0x72,0xB4,0x57,0xD4,0x5B,0x79,0x11,0xB7,0xA9,0xDF,0xF2,0x1A,0xF7,0xF1,0xE6,0xA9,0x5B,0x56,0xC4,
+  0x6E,0xA5,0x0E,0xD6,0x15,0x70,0x2F,0xFB,0x1F,0x81,0x7F,0x00,0xD7,0x09,0x77,0xCF,0x39,0x20,0x00,0x00,
+};
+const webassets::Asset htmlPageBscDataLiveAsset = {htmlPageBscDataLiveGz, sizeof(htmlPageBscDataLiveGz), htmlPageBscDataLive, "text/html", "\"623c91a240dfbaca\""};
+
+// htmlPageSupport: 2508 -> 1100 Byte
+const uint8_t htmlPageSupportGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xC5,0x56,0x6D,0x6F,0xDB,0x36,0x10,0xFE,0x2B,0xB7,
+  0x14,0xA8,0x12,0xC0,0x92,0x62,0x23,0x69,0x37,0xC9,0x36,0xB0,0xBC,0x6C,0xE9,0xB0,0xAE,0x01,0xDA,0x62,
+  0xD8,0x47,0x4A,0x3A,0x5B,0xAC,0x29,0x52,0x23,0x4F,0x56,0x1C,0x23,0xFF,0x7D,0x47,0xD1,0x6E,0x9A,0xD6,
+  0x58,0xD7,0x7D,0xD8,0x2C,0x48,0x16,0x5F,0xEE,0xE1,0xF3,0xDC,0x1D,0x8F,0x9A,0x7E,0x77,0xF5,0xE6,0xF2,
+  0xDD,0x1F,0xB7,0xD7,0x70,0xF3,0xEE,0xF5,0xAF,0xF3,0x69,0x4D,0x8D,0xE2,0x27,0x8A,0x6A,0x3E,0x25,0x49,
+  0x0A,0xE7,0x17,0x6F,0x2F,0xA7,0x69,0x78,0x9D,0x36,0x48,0x02,0x6A,0xA2,0x36,0xC6,0x3F,0x3B,0xB9,0x9E,
+  0x45,0x97,0x46,0x13,0x6A,0x8A,0xDF,0x6D,0x5A,0x8C,0xA0,0x0C,0xAD,0x59,0x44,0x78,0x47,0xA9,0x87,0xCA,
+  0xA1,0xAC,0x85,0x75,0x48,0xB3,0x8E,0x16,0xF1,0xF7,0xD1,0x0E,0x42,0x8B,0x06,0x67,0xD1,0x5A,0x62,0xDF,
+  0x1A,0x4B,0x9F,0x18,0xF6,0xB2,0xA2,0x7A,0x56,0xE1,0x5A,0x96,0x18,0x0F,0x8D,0x11,0x48,0x2D,0x49,0x0A,
+  0x15,0xBB,0x52,0x28,0x9C,0x8D,0x19,0x43,0x49,0xBD,0x02,0x8B,0x6A,0x16,0x49,0xB6,0x8C,0xA0,0xB6,0xB8,
+  0x98,0x45,0x95,0x20,0x91,0x8D,0x78,0xD8,0xD1,0x86,0xC9,0xFA,0xE5,0x61,0xBB,0x60,0xE4,0x78,0x21,0x1A,
+  0xA9,0x36,0xD9,0x0D,0xAA,0x35,0x92,0x2C,0x45,0x5E,0x49,0xD7,0x2A,0xB1,0xC9,0xA4,0x66,0x28,0x8C,0x0B,
+  0x65,0xCA,0x55,0xDE,0x08,0xBB,0x94,0x3A,0x3B,0x6D,0xEF,0x40,0x74,0x64,0x72,0x2F,0x22,0x16,0x4A,0x2E,
+  0x75,0x56,0x32,0x39,0xB4,0xF9,0x43,0x61,0xAA,0x0D,0x6C,0xF7,0x13,0xF3,0x87,0x64,0x47,0x1C,0xB6,0xAD,
+  0xA8,0x2A,0xA9,0x97,0xD9,0x84,0xCD,0xB9,0x9F,0x4C,0xAB,0xC5,0x1A,0xB6,0x66,0x8D,0x76,0xA1,0x4C,0x9F,
+  0x41,0x2D,0xAB,0x0A,0x75,0xDE,0x1A,0xC7,0x6A,0x8C,0xCE,0x1C,0x13,0x59,0x6D,0x72,0x9E,0xC8,0x40,0x85,
+  0x28,0x57,0x4B,0x6B,0x3A,0x5D,0xC5,0xA5,0x51,0xC6,0x66,0xCF,0x5E,0x5C,0xFB,0x2B,0x0F,0xAD,0xBE,0x96,
+  0x84,0xF9,0x7E,0x89,0x73,0x5E,0xA1,0xEC,0xAC,0xE3,0x81,0x0A,0x17,0xA2,0x53,0xF4,0xB8,0xA0,0x6B,0x85,
+  0x66,0xD1,0xCA,0x08,0xCA,0x14,0x2E,0x28,0x87,0xBD,0x15,0x8C,0xCF,0x58,0xD8,0xF8,0x05,0x1B,0xC3,0xA0,
+  0xAC,0xC2,0xD2,0x58,0x31,0x70,0xD1,0x46,0x63,0x0E,0x83,0xAB,0x9C,0xBC,0xC7,0x6C,0x9C,0xBC,0xB4,0xD8,
+  0x30,0x6A,0x41,0xFA,0x82,0xA9,0x65,0xB5,0xD7,0x01,0xDB,0x2F,0x69,0x9E,0x0F,0xBF,0x27,0x34,0x1F,0x92,
+  0xDA,0xFB,0x5D,0xE1,0x5D,0x36,0xCE,0x1F,0x31,0x27,0x01,0xB1,0x14,0xB6,0x72,0x9F,0xB9,0xAB,0x11,0x77,
+  0x21,0xD6,0xD9,0xCB,0xD3,0xD0,0x0E,0xFE,0x0D,0x61,0xD8,0xC7,0x6A,0x69,0x65,0x95,0xFB,0x47,0xBC,0x14,
+  0x6D,0x80,0x1B,0x5A,0x84,0x0D,0x8F,0x13,0x7A,0x4A,0x5D,0xA3,0x5D,0x66,0xB1,0x45,0x41,0xC7,0xDE,0x38,
+  0x5E,0x48,0x1A,0x35,0x52,0xF3,0x0A,0xC7,0x13,0x8F,0x3D,0x1A,0x2F,0xEC,0xC9,0xC9,0x8E,0xC7,0x05,0xE9,
+  0x03,0x9A,0x82,0x8A,0xC2,0xDC,0xC5,0xAE,0x16,0x15,0x87,0x6E,0xC2,0x7E,0xF3,0xF7,0x78,0x78,0xF0,0x6D,
+  0x97,0x85,0x38,0x1E,0x9F,0x9D,0x8E,0xF6,0x77,0x72,0x7E,0x92,0x1F,0xF4,0xE9,0x27,0xF2,0x07,0xC7,0x7F,
+  0x11,0x36,0x4F,0xE3,0x4A,0xB8,0xFA,0x90,0x6F,0x7F,0x9A,0xF8,0xEB,0xBF,0x66,0x72,0xD8,0x29,0xFF,0x03,
+  0x19,0x26,0xF2,0x8D,0x79,0xF7,0x89,0x84,0x6F,0xB4,0x2C,0x3A,0x22,0x73,0x50,0xF7,0xC5,0x95,0xBF,0x58,
+  0xB7,0xAD,0xD0,0x06,0xF6,0xE1,0x3D,0xB6,0xA2,0x92,0x9D,0xCB,0xC6,0x3E,0x63,0x0F,0x6D,0x53,0xBF,0xD5,
+  0xE0,0xCC,0x8F,0xFE,0x13,0x1F,0xEC,0x72,0x7E,0x72,0x68,0x6F,0x07,0x76,0xFF,0x4A,0x52,0x26,0x4A,0x92,
+  0x6B,0x84,0xED,0x53,0x39,0x0F,0x5C,0x85,0x3D,0xD6,0x6E,0x55,0x38,0x05,0xBF,0x11,0x77,0x7F,0xF9,0xC3,
+  0x34,0x0D,0x25,0x74,0x9A,0x86,0x83,0xC0,0x97,0xBD,0xF9,0xB4,0x92,0x6B,0x28,0x95,0x70,0x8E,0xEB,0xFB,
+  0x50,0x6D,0x7C,0xA9,0xF5,0xF5,0x66,0xD7,0xB9,0x2B,0x16,0x11,0x18,0x5D,0x2A,0x2E,0x6E,0xB3,0x23,0x2E,
+  0xAB,0x83,0xE2,0x24,0x14,0xE8,0x24,0x49,0xA3,0xA3,0xF9,0xF3,0x67,0xE3,0xD3,0xD3,0x1F,0xCE,0x72,0x5E,
+  0x84,0x8D,0xBF,0x02,0xF1,0x19,0x42,0x1A,0x7D,0x34,0xFF,0x3B,0x98,0x5A,0x45,0xF3,0xF7,0xBE,0x62,0x3B,
+  0x7A,0xDE,0x75,0x7C,0x0A,0xD1,0x7D,0xA7,0x97,0xFB,0x99,0x29,0x0B,0x79,0xA2,0x66,0x57,0xC4,0x23,0x18,
+  0x54,0xCF,0xA2,0xC7,0x7A,0x74,0xEE,0x6B,0x06,0xCB,0x6C,0xE7,0xAF,0x34,0x70,0xD0,0xE1,0x5A,0x53,0xCF,
+  0xBC,0x14,0xC3,0x71,0xDB,0x01,0x1F,0x8E,0xC0,0x91,0xF0,0xEF,0x0E,0x35,0xBC,0x35,0x0B,0xEA,0x85,0x45,
+  0x46,0xC2,0x72,0x45,0xC0,0x27,0x9C,0x82,0x1F,0x6D,0x81,0x92,0x92,0x69,0xDA,0x7A,0xA0,0x5F,0xD0,0xE3,
+  0x84,0x5B,0x0F,0xF6,0xBA,0xA3,0x7B,0x1A,0x01,0x2E,0x85,0x02,0x53,0x40,0x23,0x69,0x18,0xE6,0xA1,0xF8,
+  0x86,0x33,0xDA,0xE3,0x8D,0xC0,0xF8,0x2E,0xD1,0x2D,0x00,0xF9,0xC0,0x6A,0xE0,0x37,0x6E,0xBF,0xBE,0x7C,
+  0x3F,0x82,0x95,0xD0,0x1A,0x9C,0x2C,0x6B,0x08,0x4A,0x0B,0xB4,0x0A,0x97,0xA8,0x47,0xD0,0x0B,0x07,0xB2,
+  0x6E,0xF6,0x58,0x6C,0xC8,0xDD,0xA4,0xFC,0xD4,0x1E,0x2D,0x81,0x74,0xB4,0x83,0xED,0x0D,0x78,0x3A,0x3C,
+  0xFF,0xD6,0x9A,0x0F,0xC8,0xBC,0xBB,0xA7,0xCE,0x63,0xA2,0x7E,0x9D,0x84,0xE9,0x4F,0x0B,0xEB,0x55,0x4C,
+  0x45,0x38,0x74,0x8F,0x3E,0x88,0xB5,0x70,0xA5,0x95,0x2D,0x65,0xBD,0xD4,0x5C,0x17,0x12,0xD3,0xA2,0x3E,
+  0x8E,0xFC,0x47,0x82,0xCB,0xD2,0xB4,0xEF,0xFB,0xA4,0x15,0x9B,0x56,0xA8,0xA4,0xC1,0xD4,0xD5,0x7C,0x98,
+  0xEB,0x65,0x23,0xF4,0x64,0x12,0x9D,0xE4,0x47,0xF3,0xDB,0x61,0x28,0x83,0xAF,0x4F,0x9F,0xA6,0x62,0x3E,
+  0xB8,0x30,0x10,0xF8,0x1D,0x59,0x77,0xD5,0x79,0x77,0xC0,0x67,0xA1,0x66,0x2D,0xC5,0x20,0xCE,0x73,0x76,
+  0xE4,0x67,0x49,0x3D,0x78,0xFB,0x5A,0x72,0x1B,0x95,0x8F,0x1E,0xB7,0x06,0x91,0xF0,0x76,0xC3,0x5D,0xEC,
+  0x25,0x89,0xF0,0xA6,0xF5,0xA9,0x06,0x47,0xAF,0xD8,0x45,0xC5,0x21,0xDC,0x23,0x10,0x2B,0xDE,0x4E,0x12,
+  0x2D,0xEA,0x2C,0x3E,0xD9,0x45,0xF4,0x4A,0xA2,0xFB,0x68,0xCC,0x0B,0xC3,0x22,0x58,0xD8,0x03,0xC4,0x96,
+  0x58,0x89,0xB2,0xA6,0x04,0x42,0x1A,0x08,0xCD,0x4F,0xCE,0x16,0xA3,0x14,0x21,0xDC,0x77,0x7C,0x54,0x71,
+  0x26,0xD1,0xA0,0xCA,0x95,0xB5,0x42,0x9E,0xCB,0x59,0xF6,0x33,0xF6,0x72,0xC8,0xAF,0x5A,0x14,0xA8,0x43,
+  0x26,0x85,0x2C,0x4E,0xC3,0xD6,0x1C,0xBE,0xB5,0xE6,0x7F,0x01,0x39,0x25,0x89,0xFE,0xCC,0x09,0x00,0x00,
+};
+const webassets::Asset htmlPageSupportAsset = {htmlPageSupportGz, sizeof(htmlPageSupportGz), htmlPageSupport, "text/html", "\"653ebb7d974220a5\""};
+
+// htmlPageUpload: 168 -> 155 Byte
+const uint8_t htmlPageUploadGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x2D,0x8E,0xCD,0x0A,0xC2,0x30,0x10,0x84,0x5F,0x65,
+  0x3D,0xED,0x49,0xF2,0x02,0xDB,0x5C,0xFC,0xC1,0x83,0xD2,0x40,0xE3,0x41,0xC4,0x43,0xDA,0xA6,0x34,0x90,
+  0x3F,0xCA,0x06,0xF1,0xED,0xAD,0xA9,0xA7,0x99,0x81,0xF9,0x86,0xA1,0xDD,0xB1,0x3D,0xE8,0x87,0x3A,0xC1,
+  0x45,0xDF,0xAE,0x92,0x66,0x0E,0x5E,0xD2,0x94,0x96,0x00,0xC1,0xF2,0x9C,0xC6,0x06,0x55,0xDB,0x69,0x04,
+  0x33,0xB0,0x4B,0xB1,0x41,0x51,0xB2,0x4F,0x66,0x54,0x7D,0x3C,0xBF,0x11,0x6C,0x1C,0xF8,0x93,0x6D,0x83,
+  0xA1,0x78,0x76,0xD9,0x2C,0x2C,0x7E,0xEC,0x7E,0x34,0x6C,0x50,0x92,0x8B,0xB9,0x30,0x6C,0x8D,0xC9,0x79,
+  0x8B,0x10,0x4D,0x58,0xFD,0xF3,0x85,0xB0,0x11,0xDE,0x4A,0xEA,0x0B,0x73,0x8A,0xF2,0x5E,0x87,0x49,0xFC,
+  0x23,0xD5,0xA5,0x55,0xEA,0xA5,0x2F,0x0D,0x13,0xCA,0xED,0xA8,0x00,0x00,0x00,
+};
+const webassets::Asset htmlPageUploadAsset = {htmlPageUploadGz, sizeof(htmlPageUploadGz), htmlPageUpload, "text/html", "\"08137e55b707371c\""};
+
+// htmlFavicon: 1417 -> 421 Byte
+const uint8_t htmlFaviconGz[] PROGMEM = {
+  0x1F,0x8B,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xD5,0x94,0x51,0x8E,0x9B,0x30,0x10,0x86,0xAF,0x62,
+  0xB9,0xCF,0x0C,0x83,0xB1,0x31,0x44,0x81,0x55,0xB7,0x52,0x2F,0xD0,0xF6,0x00,0x88,0x18,0xB0,0x4A,0x4C,
+  0x84,0xAD,0x90,0xED,0xE9,0x3B,0xA1,0xBB,0xD0,0xAD,0xB4,0xD2,0x26,0x4F,0x5B,0x24,0x84,0x3C,0x1E,0xBE,
+  0x7F,0xE6,0x1F,0xCB,0xFB,0x87,0xCB,0x71,0x60,0x67,0x33,0x79,0x3B,0xBA,0x92,0x27,0x80,0x9C,0x19,0xD7,
+  0x8C,0x07,0xEB,0xBA,0x92,0xFF,0xF8,0xFE,0x35,0xCA,0xF9,0x43,0xB5,0xF7,0xE7,0x8E,0xCD,0xF6,0x10,0x7A,
+  0x4A,0x41,0x3C,0x1E,0x39,0xEB,0x8D,0xED,0xFA,0xB0,0x2E,0xFF,0x22,0x24,0xB4,0xB2,0x66,0x7E,0x1C,0x2F,
+  0x25,0x47,0x86,0x8C,0x32,0xAE,0x2F,0x67,0xA4,0xE4,0x7C,0xC9,0xFB,0x10,0x4E,0xBB,0x38,0x9E,0xE7,0x19,
+  0xE6,0x14,0xC6,0xA9,0x8B,0x05,0x22,0xC6,0x24,0xC1,0xAB,0xFD,0x64,0x9A,0xC0,0xE8,0x47,0x09,0x5A,0x64,
+  0x39,0x67,0x4F,0x25,0x4F,0x35,0xA4,0x52,0xF0,0x55,0x3F,0x81,0x42,0xAB,0xAD,0x00,0x91,0x42,0x92,0x91,
+  0x66,0x6B,0x87,0xA1,0xE4,0x9F,0xB0,0x69,0x79,0xBC,0x71,0x04,0x82,0x14,0x62,0xE1,0x24,0x12,0x92,0x7C,
+  0xC3,0x68,0xC8,0x51,0x6E,0x18,0x8D,0x50,0xA0,0x58,0x31,0xA2,0x3E,0xC8,0xF6,0x15,0x49,0x92,0xAE,0xD4,
+  0x2B,0x09,0xD5,0x7B,0x51,0x39,0x1A,0xF5,0x1A,0x95,0xA5,0x20,0xF5,0x5A,0x94,0x7C,0x3F,0xAA,0x36,0x0B,
+  0x27,0x98,0xCB,0xC2,0x49,0x15,0xE8,0x44,0x16,0x58,0x2C,0x28,0x95,0x81,0x46,0x81,0xE9,0x9A,0xDD,0x2E,
+  0x0F,0x2D,0x47,0x17,0xA2,0xB6,0x3E,0xDA,0x81,0xB2,0x7C,0xED,0x7C,0xE4,0xCD,0x64,0x5F,0x36,0xBC,0xFD,
+  0x65,0x48,0xB8,0x00,0xAD,0xB2,0xD3,0x85,0x33,0x1F,0xA6,0xF1,0xA7,0x89,0x9E,0x0B,0x02,0x91,0x49,0x45,
+  0xAE,0x5D,0x25,0xA3,0x7A,0xB0,0x1D,0x8D,0xD8,0xB8,0xC3,0x4B,0xC0,0x35,0xFD,0x38,0x3D,0x47,0x7C,0x78,
+  0x1A,0x88,0x34,0x58,0x67,0xA2,0x3F,0xF5,0xEF,0x12,0x10,0x6A,0x99,0xFB,0xCE,0x9F,0xEA,0x86,0x36,0x4F,
+  0x93,0x21,0xED,0xB3,0xA1,0x49,0x07,0x0A,0xB9,0x7B,0xBB,0xF8,0x3C,0xD9,0x7A,0xB8,0xA5,0x81,0xEA,0x71,
+  0x1F,0x2F,0x8A,0x15,0x7D,0xA9,0xF4,0xCD,0x44,0xA5,0x41,0xD1,0xF1,0x94,0xF2,0xBF,0x36,0xF1,0x9E,0x2E,
+  0x6E,0x37,0xF1,0xDB,0x5B,0x26,0xEA,0x82,0x8E,0x71,0x26,0xB3,0xB7,0xE5,0x4D,0xDB,0x7C,0x78,0x13,0xEF,
+  0xE9,0xE2,0x76,0x13,0xBF,0xFC,0x6B,0xE2,0xF5,0xEA,0xAB,0x7E,0x03,0xF1,0xD5,0x5E,0xC9,0x89,0x05,0x00,
+  0x00,
+};
+const webassets::Asset htmlFaviconAsset = {htmlFaviconGz, sizeof(htmlFaviconGz), htmlFavicon, "image/svg+xml", "\"7702724821a84b55\""};
+
+#endif
@@ -291,7 +291,7 @@ const char htmlPageBmsSpg[] PROGMEM = "<!doctype html>"
   "</div>"
   "<br><br>"
   "<div class='chart-wrap vertical'>"
-  "<div class='grid'>"
+  "<div id='grid' class='grid'>"
   "<div id='b0' class='bar'></div>"
   "<div id='b1' class='bar'></div>"
   "<div id='b2' class='bar'></div>"
@@ -317,8 +317,17 @@ const char htmlPageBmsSpg[] PROGMEM = "<!doctype html>"
     "xhttp.onreadystatechange = function() {"
       "if (this.readyState == 4 && this.status == 200) {"
         "let values = this.responseText.split(';');"
+        "let cnt = Math.floor(values.length/2);"
+        "let grid = document.getElementById('grid');"
+        "while (grid.children.length < cnt) {"
+          "let bar = document.createElement('div');"
+          "bar.id = 'b' + grid.children.length;"
+          "bar.className = 'bar';"
+          "grid.appendChild(bar);"
+        "}"
+        "while (grid.children.length > cnt) {grid.removeChild(grid.lastChild);}"
         "let n = 0;"
-        "for (let i=0; i<(values.length/2); i++) {"
+        "for (let i=0; i<cnt; i++) {"
           "let divId = 'b' + i;"
           "document.getElementById(divId).style.width = values[n] + '%';"
           "document.getElementById(divId).innerHTML = values[n+1] + '&nbsp;';"
@@ -326,7 +335,7 @@ const char htmlPageBmsSpg[] PROGMEM = "<!doctype html>"
         "}"
       "}"
     "};"
-    "xhttp.open('GET', 'getBmsSpgData', true);"
+    "xhttp.open('GET', 'getBmsSpgData' + location.search, true);"
     "xhttp.timeout=1000;"
     "xhttp.send();"
     "var timer = window.setTimeout('getData()', 1000);"
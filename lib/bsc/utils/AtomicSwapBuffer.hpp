@@ -0,0 +1,147 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+
+#ifndef UTILS_ATOMICSWAPBUFFER_H
+#define UTILS_ATOMICSWAPBUFFER_H
+
+#include <atomic>
+#include <cstddef> // std::size_t
+#include <cstdint> // uint32_t
+
+/**
+ * @file
+ * This header provides a buffer for data that is read often and changed rarely, e.g. settings.
+ *
+ * The writer fills an inactive buffer and publishes it with an atomic pointer swap. Readers get a
+ * pointer to the published, immutable value and read plain fields without any locking.
+ *
+ * The buffers are statically allocated. Readers, which keep the pointer for a longer time (e.g. a cycle
+ * of a task, which can be preempted while the value is published several times), hold the buffer with
+ * acquire() / release(). The writer gets a free buffer with tryWriteBuffer(), which never returns the
+ * published buffer or a buffer held by a reader:
+ * @code
+ *  // Writer
+ *  DATA_TYPE* value;
+ *  while ((value = buffer.tryWriteBuffer()) == nullptr) wait();
+ *  fill(*value);
+ *  buffer.publish();
+ *
+ *  // Reader
+ *  const DATA_TYPE* value = buffer.acquire();
+ *  use(*value);
+ *  buffer.release(value);
+ * @endcode
+ *
+ * Without acquire() (get() and writeBuffer()) the buffers are used round robin, i.e. a buffer is reused
+ * after BUFFER_COUNT - 1 further publications and a reader must not keep the pointer longer than that.
+ *
+ * @note Only ONE writer at a time is allowed. Multiple writers must be serialized by the caller.
+*/
+
+namespace utils
+{
+
+template<typename DATA_TYPE, std::size_t BUFFER_COUNT = 3>
+class AtomicSwapBuffer
+{
+  static_assert(BUFFER_COUNT >= 2, "AtomicSwapBuffer requires at least two buffers");
+
+  public:
+  AtomicSwapBuffer() = default;
+
+  // Do not allow to copy this class
+  AtomicSwapBuffer(const AtomicSwapBuffer&) = delete;
+  AtomicSwapBuffer& operator=(const AtomicSwapBuffer&) = delete;
+
+  /**
+   * @brief Returns the buffer to be filled by the writer. It is not visible to the readers until publish() is called.
+   *
+   * @note The buffer contains the value of an older publication, so the writer has to set all fields.
+   * @note The buffer is not checked for readers, which hold it with acquire(); use tryWriteBuffer() then.
+  */
+  DATA_TYPE& writeBuffer() noexcept
+  {
+    return _buffers[_writeIndex];
+  }
+
+  /**
+   * @brief Selects the buffer to be filled by the writer: neither the published buffer nor a buffer held by a reader.
+   * @return The buffer (filled by publish()), or nullptr if all other buffers are held by readers.
+  */
+  DATA_TYPE* tryWriteBuffer() noexcept
+  {
+    const DATA_TYPE* published = _current.load(std::memory_order_seq_cst);
+    for (std::size_t i = 0; i < BUFFER_COUNT; ++i)
+    {
+      const std::size_t index = (_writeIndex + i) % BUFFER_COUNT;
+      if (&_buffers[index] == published || _readers[index].load(std::memory_order_seq_cst) != 0) continue;
+      _writeIndex = index;
+      return &_buffers[index];
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Publishes the write buffer. Subsequent calls of get() return the new value.
+  */
+  void publish() noexcept
+  {
+    _current.store(&_buffers[_writeIndex], std::memory_order_seq_cst);
+    _writeIndex = (_writeIndex + 1) % BUFFER_COUNT;
+    _generation.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Returns the current value. Never nullptr, a value-initialized buffer is returned until the first publication.
+  */
+  const DATA_TYPE* get() const noexcept
+  {
+    return _current.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Returns the number of publications. Readers can use it to detect changes.
+  */
+  std::size_t generation() const noexcept
+  {
+    return _generation.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Returns the current value and holds it until release() is called. The writer does not reuse the
+   *        buffer as long as it is held, so the value stays unchanged, even over several publications.
+  */
+  const DATA_TYPE* acquire() noexcept
+  {
+    for (;;)
+    {
+      const DATA_TYPE* value = _current.load(std::memory_order_seq_cst);
+      std::atomic<uint32_t>& readers = _readers[value - _buffers];
+      readers.fetch_add(1, std::memory_order_seq_cst);
+      // The writer could have selected the buffer before it was held, if it was published again in between
+      if (_current.load(std::memory_order_seq_cst) == value) return value;
+      readers.fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  /** @brief Releases a value returned by acquire() */
+  void release(const DATA_TYPE* value) noexcept
+  {
+    if (value == nullptr) return;
+    _readers[value - _buffers].fetch_sub(1, std::memory_order_release);
+  }
+
+  private:
+  DATA_TYPE _buffers[BUFFER_COUNT] {};
+  std::atomic<uint32_t> _readers[BUFFER_COUNT] {};
+  std::size_t _writeIndex {1};
+  std::atomic<const DATA_TYPE*> _current {&_buffers[0]};
+  std::atomic<std::size_t> _generation {0};
+};
+
+} // namespace utils
+
+#endif // UTILS_ATOMICSWAPBUFFER_H
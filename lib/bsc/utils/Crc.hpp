@@ -0,0 +1,224 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef UTILS_CRC_HPP
+#define UTILS_CRC_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/**
+ * @file
+ * Table driven CRC calculation with compile time generated tables and the checksums of the devices.
+ *
+ * The CRC is calculated with one of three strategies, selected by the template parameter SLICES:
+ *  - 1: byte by byte with one table (256 entries)
+ *  - 4: slice-by-4, four bytes per step with four tables
+ *  - 8: slice-by-8, eight bytes per step with eight tables
+ * Slicing removes the dependency of every table access on the previous one, which costs more table memory
+ * (SLICES * 256 entries in flash). All strategies deliver the same result. The default strategy can be changed
+ * with the build flag BSC_CRC_SLICES.
+ *
+ * @code
+ *  uint16_t crc = utils::Crc16Modbus::compute(frame, len);
+ *  uint16_t crc = utils::Crc16Modbus::compute<8>(frame, len);
+ *  // In parts:
+ *  uint32_t crc = utils::Crc32Mpeg2::INIT;
+ *  crc = utils::Crc32Mpeg2::update(crc, part1, len1);
+ *  crc = utils::Crc32Mpeg2::update(crc, part2, len2);
+ * @endcode
+ *
+ * None of the used CRCs has a final XOR value, so update() can be continued with a previous result.
+*/
+
+#ifndef BSC_CRC_SLICES
+#define BSC_CRC_SLICES 4
+#endif
+
+namespace utils
+{
+
+namespace detail
+{
+
+template<typename T, T POLY, bool REFLECTED, uint8_t SLICES>
+constexpr std::array<std::array<T, 256>, SLICES> makeCrcTables()
+{
+  constexpr uint8_t WIDTH = std::numeric_limits<T>::digits;
+  constexpr T TOP_BIT = static_cast<T>(T(1) << (WIDTH - 1));
+
+  std::array<std::array<T, 256>, SLICES> tables {};
+  for (uint16_t i = 0; i < 256; ++i)
+  {
+    T crc = REFLECTED ? static_cast<T>(i) : static_cast<T>(static_cast<T>(i) << (WIDTH - 8));
+    for (uint8_t bit = 0; bit < 8; ++bit)
+    {
+      if (REFLECTED) crc = (crc & 1) ? static_cast<T>((crc >> 1) ^ POLY) : static_cast<T>(crc >> 1);
+      else crc = (crc & TOP_BIT) ? static_cast<T>((crc << 1) ^ POLY) : static_cast<T>(crc << 1);
+    }
+    tables[0][i] = crc;
+  }
+
+  // tables[k][i]: CRC of byte i followed by k zero bytes
+  for (uint8_t k = 1; k < SLICES; ++k)
+  {
+    for (uint16_t i = 0; i < 256; ++i)
+    {
+      const T prev = tables[k - 1][i];
+      if (REFLECTED) tables[k][i] = static_cast<T>((WIDTH > 8 ? (prev >> 8) : 0) ^ tables[0][prev & 0xFF]);
+      else tables[k][i] = static_cast<T>((WIDTH > 8 ? (prev << 8) : 0) ^ tables[0][(prev >> (WIDTH - 8)) & 0xFF]);
+    }
+  }
+  return tables;
+}
+
+inline uint32_t loadLe32(const uint8_t* data)
+{
+  return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+         (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+inline uint32_t loadBe32(const uint8_t* data)
+{
+  return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) |
+         (static_cast<uint32_t>(data[2]) << 8) | static_cast<uint32_t>(data[3]);
+}
+
+} // namespace detail
+
+/**
+ * @tparam T Type of the CRC register (width 8, 16 or 32 bit).
+ * @tparam POLY Polynomial; bit reversed for reflected CRCs (e.g. 0xA001 instead of 0x8005).
+ * @tparam REFLECTED True for LSB first CRCs (refin = refout = true).
+ *
+ * @note Slicing of not reflected CRCs is only supported for a width of 32 bit.
+*/
+template<typename T, T POLY, T INITIAL, bool REFLECTED>
+class Crc
+{
+  static_assert(std::is_unsigned<T>::value && sizeof(T) <= 4, "8, 16 or 32 bit CRC");
+
+  public:
+  using value_type = T;
+  static constexpr T INIT = INITIAL;
+
+  template<uint8_t SLICES>
+  static constexpr std::array<std::array<T, 256>, SLICES> TABLES = detail::makeCrcTables<T, POLY, REFLECTED, SLICES>();
+
+  /** @brief Continues the calculation of crc over further data */
+  template<uint8_t SLICES = BSC_CRC_SLICES>
+  static T update(T crc, const uint8_t* data, std::size_t len)
+  {
+    static_assert(SLICES == 1 || SLICES == 4 || SLICES == 8, "Supported strategies: 1, 4 or 8 slices");
+    static_assert(SLICES == 1 || REFLECTED || sizeof(T) == 4, "Slicing of not reflected CRCs requires 32 bit");
+
+    if constexpr (SLICES == 8)
+    {
+      const auto& t = TABLES<SLICES>;
+      for (; len >= 8; len -= 8, data += 8)
+      {
+        if constexpr (REFLECTED)
+        {
+          const uint32_t one = static_cast<uint32_t>(crc) ^ detail::loadLe32(data);
+          const uint32_t two = detail::loadLe32(data + 4);
+          crc = static_cast<T>(t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][one >> 24] ^
+                               t[3][two & 0xFF] ^ t[2][(two >> 8) & 0xFF] ^ t[1][(two >> 16) & 0xFF] ^ t[0][two >> 24]);
+        }
+        else
+        {
+          const uint32_t one = static_cast<uint32_t>(crc) ^ detail::loadBe32(data);
+          const uint32_t two = detail::loadBe32(data + 4);
+          crc = static_cast<T>(t[7][one >> 24] ^ t[6][(one >> 16) & 0xFF] ^ t[5][(one >> 8) & 0xFF] ^ t[4][one & 0xFF] ^
+                               t[3][two >> 24] ^ t[2][(two >> 16) & 0xFF] ^ t[1][(two >> 8) & 0xFF] ^ t[0][two & 0xFF]);
+        }
+      }
+    }
+    else if constexpr (SLICES == 4)
+    {
+      const auto& t = TABLES<SLICES>;
+      for (; len >= 4; len -= 4, data += 4)
+      {
+        if constexpr (REFLECTED)
+        {
+          const uint32_t one = static_cast<uint32_t>(crc) ^ detail::loadLe32(data);
+          crc = static_cast<T>(t[3][one & 0xFF] ^ t[2][(one >> 8) & 0xFF] ^ t[1][(one >> 16) & 0xFF] ^ t[0][one >> 24]);
+        }
+        else
+        {
+          const uint32_t one = static_cast<uint32_t>(crc) ^ detail::loadBe32(data);
+          crc = static_cast<T>(t[3][one >> 24] ^ t[2][(one >> 16) & 0xFF] ^ t[1][(one >> 8) & 0xFF] ^ t[0][one & 0xFF]);
+        }
+      }
+    }
+
+    // Remaining bytes (and the byte wise strategy) with the first table
+    const auto& t0 = TABLES<SLICES>[0];
+    constexpr uint8_t WIDTH = std::numeric_limits<T>::digits;
+    while (len--)
+    {
+      if constexpr (REFLECTED) crc = static_cast<T>((WIDTH > 8 ? (crc >> 8) : 0) ^ t0[(crc ^ *data++) & 0xFF]);
+      else crc = static_cast<T>((WIDTH > 8 ? (crc << 8) : 0) ^ t0[((crc >> (WIDTH - 8)) ^ *data++) & 0xFF]);
+    }
+    return crc;
+  }
+
+  template<uint8_t SLICES = BSC_CRC_SLICES>
+  static T compute(const uint8_t* data, std::size_t len)
+  {
+    return update<SLICES>(INIT, data, len);
+  }
+};
+
+/** Modbus (serial BMS, I2C bulk frames, plausibility check of the cell voltages) */
+using Crc16Modbus = Crc<uint16_t, 0xA001, 0xFFFF, true>;
+/** CRC-32/MPEG-2 (MSB first, firmware update of the BPN) */
+using Crc32Mpeg2 = Crc<uint32_t, 0x04C11DB7, 0xFFFFFFFF, false>;
+/** Dallas/Maxim CRC8 (x^8 + x^5 + x^4 + 1) of the OneWire scratchpad and ROM codes */
+using Crc8Maxim = Crc<uint8_t, 0x8C, 0x00, true>;
+
+/**
+ * Simple checksums of the device protocols
+*/
+namespace checksum
+{
+
+/** @brief Sum of all bytes (8 bit) */
+inline uint8_t sum8(const uint8_t* data, std::size_t len)
+{
+  uint8_t sum = 0;
+  while (len--) sum = static_cast<uint8_t>(sum + *data++);
+  return sum;
+}
+
+/** @brief Sum of all bytes (16 bit) */
+inline uint16_t sum16(const uint8_t* data, std::size_t len)
+{
+  uint16_t sum = 0;
+  while (len--) sum = static_cast<uint16_t>(sum + *data++);
+  return sum;
+}
+
+/** @brief Two's complement of the 16 bit sum (sum of data and checksum is 0) */
+inline uint16_t negSum16(const uint8_t* data, std::size_t len)
+{
+  return static_cast<uint16_t>(~sum16(data, len) + 1);
+}
+
+/** @brief XOR of all bytes */
+inline uint8_t xor8(const uint8_t* data, std::size_t len)
+{
+  uint8_t value = 0;
+  while (len--) value ^= *data++;
+  return value;
+}
+
+} // namespace checksum
+
+} // namespace utils
+
+#endif // UTILS_CRC_HPP
@@ -0,0 +1,385 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef UTILS_FRAMEDECODER_HPP
+#define UTILS_FRAMEDECODER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "utils/Crc.hpp"
+
+/**
+ * @file
+ * Incremental decoder for the frames of the serial BMS protocols.
+ *
+ * The decoder gets the received bytes one by one (push()) or in chunks of any size (feed()) and writes the frame
+ * into a buffer of the caller, so the driver can parse the frame in place. The protocol is described by a
+ * FrameFormat:
+ *  - Start of frame (SOI, 1..4 bytes), optionally stored in the buffer
+ *  - Frame length: fixed, from a length field or up to the end byte (EOI)
+ *  - Length and checksum fields binary (big endian) or ASCII-hex
+ *  - Checksum type and the covered range
+ *
+ * All positions of the format are positions in the raw frame on the wire, i.e. the SOI starts at 0.
+ *
+ * If a started frame turns out to be invalid (length, EOI, size or checksum), the bytes after its start are
+ * replayed from the buffer. So a frame, whose start was hidden in a broken frame or in garbage containing a SOI
+ * byte, is still found. Bytes following a complete frame are kept for the next frame.
+ *
+ * @code
+ *  static constexpr utils::FrameFormat format {.soi = {0xDD}, .soiLen = 1, ...};
+ *  uint8_t buf[255];
+ *  utils::FrameDecoder decoder(format, buf, sizeof(buf));
+ *  while (decoder.push(readByte()) != utils::FrameDecoder::Status::Frame) {}
+ *  parse(decoder.frame(), decoder.length());
+ * @endcode
+*/
+
+namespace utils
+{
+
+struct FrameFormat
+{
+  enum class Length : uint8_t
+  {
+    Fixed,  //!< Every frame has fixedLen bytes
+    Field,  //!< Length = (length field & lenMask) + lenAdd
+    Eoi     //!< The frame ends with the first EOI byte
+  };
+
+  enum class Checksum : uint8_t
+  {
+    None,
+    Sum8,     //!< Sum of all bytes (8 bit)
+    Sum16,    //!< Sum of all bytes (16 bit)
+    NegSum16  //!< Two's complement of the 16 bit sum
+  };
+
+  enum class Encoding : uint8_t
+  {
+    Binary,   //!< Fields are big endian bytes
+    AsciiHex  //!< Fields are hex characters, 2 per byte
+  };
+
+  uint8_t soi[4] {};
+  uint8_t soiLen {1};
+  bool storeSoi {true};             //!< If false, the buffer starts with the byte after the SOI
+  int16_t eoi {-1};                 //!< Last byte of every frame, -1 = none
+
+  Length length {Length::Fixed};
+  uint16_t fixedLen {0};            //!< Length::Fixed: length of the frame including SOI
+  uint16_t lenPos {0};              //!< Length::Field: position and size (bytes/characters) of the length field
+  uint8_t lenSize {1};
+  uint16_t lenMask {0xFFFF};
+  int16_t lenAdd {0};               //!< Bytes of the frame, which are not counted by the length field
+  uint16_t maxLen {0xFFFF};         //!< Max. length of a frame including SOI
+
+  Encoding encoding {Encoding::Binary};
+  Checksum checksum {Checksum::None};
+  uint8_t checksumSize {0};         //!< Size of the checksum field (bytes/characters), max. 4 bytes
+  uint8_t checksumTail {0};         //!< Bytes between the checksum field and the end of the frame (e.g. EOI)
+  uint16_t checksumStart {0};       //!< First byte covered by the checksum; it ends in front of the checksum field
+};
+
+struct FrameDecoderStatistics
+{
+  uint32_t frames;          //!< Valid frames
+  uint32_t checksumErrors;  //!< Frames with a wrong checksum
+  uint32_t formatErrors;    //!< Started frames with a wrong length, EOI or size
+  uint32_t skippedBytes;    //!< Bytes outside of a frame
+};
+
+class FrameDecoder
+{
+  public:
+  enum class Status : uint8_t
+  {
+    Incomplete,     //!< More bytes are required
+    Frame,          //!< A valid frame is in the buffer, see frame() and length()
+    ChecksumError,  //!< The frame was dropped, the decoder looks for the next one
+    FormatError     //!< The frame was dropped, the decoder looks for the next one
+  };
+
+  FrameDecoder(const FrameFormat& format, uint8_t* buffer, std::size_t size) :
+    _format(format), _buf(buffer), _size(size), _offset(format.storeSoi ? 0 : format.soiLen)
+  {
+    reset();
+  }
+
+  /** @brief Drops the current frame and all pending bytes (e.g. before a new request) */
+  void reset()
+  {
+    _len = 0;
+    _frameLen = 0;
+    _soiMatched = 0;
+    _complete = false;
+    _replayPos = 0;
+    _replayEnd = 0;
+  }
+
+  /** @brief Decodes the next byte. After a Frame, the next byte starts a new frame. */
+  Status push(uint8_t byte)
+  {
+    if (_complete) nextFrame();
+
+    if (_replayPos < _replayEnd)
+    {
+      // Bytes behind the last frame are pending: they are in front of the new byte
+      if (_replayEnd < _size)
+      {
+        _buf[_replayEnd++] = byte;
+        return replay(Status::Incomplete);
+      }
+      _stats.skippedBytes += static_cast<uint32_t>(_replayEnd - _replayPos);
+      _replayPos = _replayEnd = 0;
+    }
+
+    const Status status = step(byte);
+    if (status == Status::Incomplete || status == Status::Frame) return status;
+    requeue(status);
+    return replay(status);
+  }
+
+  /**
+   * @brief Decodes a chunk of bytes up to the end of the next frame or error.
+   * @param consumed Number of bytes of data used; the rest has to be passed again
+  */
+  Status feed(const uint8_t* data, std::size_t len, std::size_t& consumed)
+  {
+    for (consumed = 0; consumed < len;)
+    {
+      const Status status = push(data[consumed++]);
+      if (status != Status::Incomplete) return status;
+    }
+    return Status::Incomplete;
+  }
+
+  /**
+   * @brief End of the transmission (e.g. timeout): The current frame can not be completed anymore. It is dropped
+   *        and its bytes are searched for a complete frame, whose start was hidden in the dropped frame.
+   *        Call it again after a Frame, until it returns Incomplete.
+  */
+  Status flush()
+  {
+    if (_complete) nextFrame();
+    for (;;)
+    {
+      if (_replayPos < _replayEnd)
+      {
+        if (replay(Status::Incomplete) == Status::Frame) return Status::Frame;
+      }
+      else if (_len > 0) requeue(Status::FormatError);
+      else break;
+    }
+    _soiMatched = 0;
+    return Status::Incomplete;
+  }
+
+  /** @brief The last frame; without the SOI, if it is not stored */
+  const uint8_t* frame() const { return _buf; }
+  uint8_t* frame() { return _buf; }
+
+  /** @brief Length of the last frame in the buffer (without the SOI, if it is not stored) */
+  uint16_t length() const { return static_cast<uint16_t>(_len); }
+
+  /** @brief Bytes of the current frame or pending bytes, which were received but are not yet part of a frame */
+  std::size_t pending() const { return _complete ? (_replayEnd - _replayPos) : (_len + (_replayEnd - _replayPos)); }
+
+  const FrameDecoderStatistics& statistics() const { return _stats; }
+
+  private:
+  /** @brief Processes one byte of the current frame */
+  Status step(uint8_t byte)
+  {
+    if (_soiMatched < _format.soiLen)
+    {
+      if (byte != _format.soi[_soiMatched])
+      {
+        _stats.skippedBytes += _soiMatched;
+        _soiMatched = 0;
+        _len = 0;
+        if (byte != _format.soi[0])
+        {
+          ++_stats.skippedBytes;
+          return Status::Incomplete;
+        }
+      }
+      if (_format.storeSoi) _buf[_len++] = byte;
+      ++_soiMatched;
+      return Status::Incomplete;
+    }
+
+    if (_len >= _size) return Status::FormatError;
+    _buf[_len++] = byte;
+    const std::size_t raw = _len + _offset;
+
+    if (_format.length == FrameFormat::Length::Eoi)
+    {
+      if (byte == static_cast<uint8_t>(_format.eoi)) return finish();
+      return (raw >= _format.maxLen) ? Status::FormatError : Status::Incomplete;
+    }
+
+    if (_frameLen == 0)
+    {
+      if (_format.length == FrameFormat::Length::Fixed) _frameLen = _format.fixedLen;
+      else if (raw == static_cast<std::size_t>(_format.lenPos) + _format.lenSize)
+      {
+        uint32_t value = 0;
+        if (!readField(_format.lenPos, _format.lenSize, value)) return Status::FormatError;
+        const int32_t frameLen = static_cast<int32_t>(value & _format.lenMask) + _format.lenAdd;
+        if (frameLen < static_cast<int32_t>(raw + _format.checksumSize + _format.checksumTail))
+          return Status::FormatError;
+        _frameLen = static_cast<std::size_t>(frameLen);
+      }
+      else return Status::Incomplete;
+
+      if (_frameLen > _format.maxLen || _frameLen > _size + _offset) return Status::FormatError;
+    }
+
+    return (raw == _frameLen) ? finish() : Status::Incomplete;
+  }
+
+  Status finish()
+  {
+    if (_format.eoi >= 0 && _buf[_len - 1] != static_cast<uint8_t>(_format.eoi)) return Status::FormatError;
+    if (!checkChecksum()) return Status::ChecksumError;
+
+    _complete = true;
+    ++_stats.frames;
+    return Status::Frame;
+  }
+
+  bool checkChecksum() const
+  {
+    if (_format.checksum == FrameFormat::Checksum::None) return true;
+
+    const std::size_t raw = _len + _offset;
+    const std::size_t fieldSize = _format.checksumSize;
+    if (raw < fieldSize + _format.checksumTail) return false;
+    const std::size_t fieldPos = raw - _format.checksumTail - fieldSize;
+    if (fieldPos < _format.checksumStart) return false;
+
+    // The SOI bytes, which are not in the buffer, are added separately
+    uint16_t sum = 0;
+    std::size_t start = _format.checksumStart;
+    for (; start < _offset && start < fieldPos; ++start) sum = static_cast<uint16_t>(sum + _format.soi[start]);
+    sum = static_cast<uint16_t>(sum + checksum::sum16(&_buf[start - _offset], fieldPos - start));
+
+    uint32_t expected = 0;
+    uint32_t mask = 0xFFFF;
+    switch (_format.checksum)
+    {
+      case FrameFormat::Checksum::Sum8: expected = sum & 0xFF; mask = 0xFF; break;
+      case FrameFormat::Checksum::Sum16: expected = sum; break;
+      case FrameFormat::Checksum::NegSum16: expected = static_cast<uint16_t>(~sum + 1); break;
+      default: break;
+    }
+
+    uint32_t received = 0;
+    if (!readField(static_cast<uint16_t>(fieldPos), _format.checksumSize, received)) return false;
+    // Only the bits of the field, if it is smaller than the checksum (and vice versa)
+    const uint8_t fieldBits = (_format.encoding == FrameFormat::Encoding::AsciiHex) ? _format.checksumSize * 4 : _format.checksumSize * 8;
+    if (fieldBits < 32) mask &= (1UL << fieldBits) - 1;
+    return (received & mask) == (expected & mask);
+  }
+
+  /** @brief Reads a length or checksum field at the raw frame position pos */
+  bool readField(uint16_t pos, uint8_t size, uint32_t& value) const
+  {
+    value = 0;
+    if (pos < _offset) return false;
+    const uint8_t* p = &_buf[pos - _offset];
+    for (uint8_t i = 0; i < size; ++i)
+    {
+      if (_format.encoding == FrameFormat::Encoding::Binary) value = (value << 8) | p[i];
+      else
+      {
+        const int8_t nibble = hexValue(p[i]);
+        if (nibble < 0) return false;
+        value = (value << 4) | static_cast<uint8_t>(nibble);
+      }
+    }
+    return true;
+  }
+
+  static int8_t hexValue(uint8_t c)
+  {
+    if (c >= '0' && c <= '9') return static_cast<int8_t>(c - '0');
+    if (c >= 'A' && c <= 'F') return static_cast<int8_t>(c - 'A' + 10);
+    if (c >= 'a' && c <= 'f') return static_cast<int8_t>(c - 'a' + 10);
+    return -1;
+  }
+
+  /**
+   * @brief Drops the current frame. The bytes after its start are put in front of the pending bytes, so they
+   *        are decoded again. The first SOI byte is not replayed, so every requeue makes progress.
+  */
+  void requeue(Status status)
+  {
+    if (status == Status::ChecksumError) ++_stats.checksumErrors;
+    else ++_stats.formatErrors;
+
+    // Stored bytes of the dropped frame [from, _len) and the pending bytes [_replayPos, _replayEnd).
+    // Every step stores at most the byte it has read, so _len <= _replayPos, if bytes are pending.
+    const std::size_t from = _format.storeSoi ? 1 : 0;
+    const std::size_t pendingLen = _replayEnd - _replayPos;
+    if (pendingLen > 0) std::memmove(&_buf[_len], &_buf[_replayPos], pendingLen);
+    _replayEnd = _len + pendingLen;
+    _replayPos = (_len > from) ? from : _len;
+
+    _len = 0;
+    _frameLen = 0;
+    _soiMatched = 0;
+  }
+
+  /** @brief Decodes the pending bytes up to the end of the next frame */
+  Status replay(Status result)
+  {
+    while (_replayPos < _replayEnd)
+    {
+      const Status status = step(_buf[_replayPos++]);
+      if (status == Status::Frame) return status; // The rest stays pending
+      if (status != Status::Incomplete)
+      {
+        requeue(status);
+        result = status;
+      }
+    }
+    _replayPos = _replayEnd = 0;
+    return result;
+  }
+
+  void nextFrame()
+  {
+    _complete = false;
+    _len = 0;
+    _frameLen = 0;
+    _soiMatched = 0;
+
+    // Move the pending bytes to the front, they are overwritten by the next frame otherwise
+    const std::size_t pendingLen = _replayEnd - _replayPos;
+    if (pendingLen > 0) std::memmove(_buf, &_buf[_replayPos], pendingLen);
+    _replayPos = 0;
+    _replayEnd = pendingLen;
+  }
+
+  const FrameFormat& _format;
+  uint8_t* const _buf;
+  const std::size_t _size;
+  const std::size_t _offset;   //!< Bytes of the raw frame, which are not stored (SOI)
+
+  std::size_t _len {0};        //!< Stored bytes of the current frame
+  std::size_t _frameLen {0};   //!< Raw length of the current frame, 0 = unknown
+  uint8_t _soiMatched {0};
+  bool _complete {false};
+  std::size_t _replayPos {0};  //!< Pending bytes [_replayPos, _replayEnd) in the buffer, behind the current frame
+  std::size_t _replayEnd {0};
+  FrameDecoderStatistics _stats {};
+};
+
+} // namespace utils
+
+#endif // UTILS_FRAMEDECODER_HPP
@@ -0,0 +1,263 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+
+#ifndef UTILS_JSONWRITER_H
+#define UTILS_JSONWRITER_H
+
+#include <cmath>   // std::isfinite
+#include <cstddef> // std::size_t
+#include <cstdint> // uint32_t
+#include <cstdio>  // std::snprintf
+#include <cstring> // std::strlen, std::memcpy
+#include <type_traits>
+
+/**
+ * @file
+ * This header provides a streaming JSON writer with a fixed size buffer.
+ *
+ * The writer never allocates memory. The JSON text is collected in an internal buffer and handed over
+ * to the sink in chunks every time the buffer is full and when flush() is called. The sink is any
+ * callable with the signature void(const char* data, std::size_t length), e.g. a lambda that calls
+ * WebServer::sendContent().
+ *
+ * Numbers and booleans are written as native JSON values, strings are escaped. Commas between the
+ * members of objects and arrays are inserted automatically.
+ *
+ * Example:
+ * @code
+ *   auto sink = [server](const char* data, std::size_t len) { server->sendContent(data, len); };
+ *   utils::JsonWriter<512, decltype(sink)> json(sink);
+ *   json.beginObject().beginObject("system").add("name", "bsc").endObject().endObject();
+ *   json.flush();
+ * @endcode
+*/
+
+namespace utils
+{
+
+template<std::size_t BUFFER_SIZE, typename SINK>
+class JsonWriter
+{
+  static_assert(BUFFER_SIZE >= 32, "JsonWriter requires a buffer of at least 32 bytes");
+
+  public:
+  /** Max. nesting depth of objects and arrays */
+  static constexpr uint8_t MAX_DEPTH {31};
+
+  explicit JsonWriter(SINK sink) : _sink(sink) {}
+
+  // Do not allow to copy this class
+  JsonWriter(const JsonWriter&) = delete;
+  JsonWriter& operator=(const JsonWriter&) = delete;
+
+  /** @brief Starts an object. If key is not nullptr, the object is written as member of the enclosing object. */
+  JsonWriter& beginObject(const char* key = nullptr) { return beginContainer(key, '{'); }
+  JsonWriter& endObject() { return endContainer('}'); }
+
+  /** @brief Starts an array. If key is not nullptr, the array is written as member of the enclosing object. */
+  JsonWriter& beginArray(const char* key = nullptr) { return beginContainer(key, '['); }
+  JsonWriter& endArray() { return endContainer(']'); }
+
+  /**
+   * @brief Writes an integer value.
+   * @param key Name of the member, or nullptr for an array element.
+  */
+  template<typename T, typename std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> = true>
+  JsonWriter& add(const char* key, T value)
+  {
+    member(key);
+    char buf[24];
+    char* end = buf + sizeof(buf);
+    char* pos = end;
+
+    using UNSIGNED_TYPE = typename std::make_unsigned<T>::type;
+    UNSIGNED_TYPE absValue = static_cast<UNSIGNED_TYPE>(value);
+    const bool isNegative = (value < 0);
+    if (isNegative) absValue = static_cast<UNSIGNED_TYPE>(UNSIGNED_TYPE(0) - absValue);
+
+    do
+    {
+      *--pos = static_cast<char>('0' + (absValue % 10));
+      absValue /= 10;
+    } while (absValue != 0);
+    if (isNegative) *--pos = '-';
+
+    write(pos, static_cast<std::size_t>(end - pos));
+    return *this;
+  }
+
+  /**
+   * @brief Writes a floating point value with a fixed number of decimals (like String(float)).
+   *        NaN and infinity are written as null, because JSON does not support them.
+  */
+  JsonWriter& add(const char* key, float value, uint8_t decimals = 2) { return add(key, static_cast<double>(value), decimals); }
+
+  JsonWriter& add(const char* key, double value, uint8_t decimals = 2)
+  {
+    member(key);
+    if (!std::isfinite(value))
+    {
+      write("null", 4);
+      return *this;
+    }
+
+    char buf[40];
+    const int len = std::snprintf(buf, sizeof(buf), "%.*f", static_cast<int>(decimals), value);
+    if (len > 0) write(buf, (static_cast<std::size_t>(len) < sizeof(buf)) ? static_cast<std::size_t>(len) : sizeof(buf) - 1);
+    return *this;
+  }
+
+  JsonWriter& add(const char* key, bool value)
+  {
+    member(key);
+    if (value) write("true", 4);
+    else write("false", 5);
+    return *this;
+  }
+
+  /** @brief Writes an escaped string value. nullptr is written as null. */
+  JsonWriter& add(const char* key, const char* value)
+  {
+    member(key);
+    if (value == nullptr) write("null", 4);
+    else writeString(value);
+    return *this;
+  }
+
+  /** @brief Writes a null value. */
+  JsonWriter& addNull(const char* key)
+  {
+    member(key);
+    write("null", 4);
+    return *this;
+  }
+
+  /** @brief Writes an array element (same as add(nullptr, value)). */
+  template<typename T>
+  JsonWriter& value(T value) { return add(nullptr, value); }
+
+  /** @brief Hands the buffered JSON text over to the sink. */
+  void flush()
+  {
+    if (_len == 0) return;
+    _sink(_buffer, _len);
+    _bytesFlushed += _len;
+    _chunks++;
+    _len = 0;
+  }
+
+  /** Returns the number of bytes written so far (flushed and buffered) */
+  std::size_t bytesWritten() const { return _bytesFlushed + _len; }
+
+  /** Returns the number of chunks handed over to the sink */
+  uint32_t chunks() const { return _chunks; }
+
+  /** Returns the current nesting depth; 0 if all objects and arrays are closed */
+  uint8_t depth() const { return _depth; }
+
+  /** Returns true, if the nesting was wrong (too deep or more containers closed than opened) */
+  bool hasError() const { return _error; }
+
+  private:
+  JsonWriter& beginContainer(const char* key, char c)
+  {
+    member(key);
+    write(c);
+    if (_depth >= MAX_DEPTH)
+    {
+      _error = true;
+      return *this;
+    }
+    _depth++;
+    _hasMembers &= ~(1UL << _depth);
+    return *this;
+  }
+
+  JsonWriter& endContainer(char c)
+  {
+    if (_depth == 0) _error = true;
+    else _depth--;
+    write(c);
+    return *this;
+  }
+
+  /** Writes the separator to the previous member and the key (if any) */
+  void member(const char* key)
+  {
+    const uint32_t mask = (1UL << _depth);
+    if ((_hasMembers & mask) != 0) write(',');
+    _hasMembers |= mask;
+
+    if (key != nullptr)
+    {
+      writeString(key);
+      write(':');
+    }
+  }
+
+  void writeString(const char* str)
+  {
+    static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+    write('"');
+    const char* start = str;
+    for (; *str != '\0'; ++str)
+    {
+      const unsigned char c = static_cast<unsigned char>(*str);
+      if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+      write(start, static_cast<std::size_t>(str - start));
+      start = str + 1;
+      switch (c)
+      {
+        case '"':  write("\\\"", 2); break;
+        case '\\': write("\\\\", 2); break;
+        case '\n': write("\\n", 2); break;
+        case '\r': write("\\r", 2); break;
+        case '\t': write("\\t", 2); break;
+        default:
+        {
+          const char esc[6] = {'\\', 'u', '0', '0', HEX_DIGITS[c >> 4], HEX_DIGITS[c & 0x0F]};
+          write(esc, sizeof(esc));
+          break;
+        }
+      }
+    }
+    write(start, static_cast<std::size_t>(str - start));
+    write('"');
+  }
+
+  void write(char c)
+  {
+    if (_len == BUFFER_SIZE) flush();
+    _buffer[_len++] = c;
+  }
+
+  void write(const char* data, std::size_t len)
+  {
+    while (len > 0)
+    {
+      if (_len == BUFFER_SIZE) flush();
+      const std::size_t n = (len < (BUFFER_SIZE - _len)) ? len : (BUFFER_SIZE - _len);
+      std::memcpy(&_buffer[_len], data, n);
+      _len += n;
+      data += n;
+      len -= n;
+    }
+  }
+
+  SINK _sink;
+  char _buffer[BUFFER_SIZE];
+  std::size_t _len {0};
+  std::size_t _bytesFlushed {0};
+  uint32_t _chunks {0};
+  uint32_t _hasMembers {0}; //!< Bit n is set, if the container at depth n has already a member
+  uint8_t _depth {0};
+  bool _error {false};
+};
+
+} // namespace utils
+
+#endif // UTILS_JSONWRITER_H
@@ -0,0 +1,127 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+
+#ifndef UTILS_SEQLOCK_H
+#define UTILS_SEQLOCK_H
+
+#include <atomic>
+#include <cstddef> // std::size_t
+#include <cstdint> // uint32_t
+#include <cstring> // std::memcpy
+#include <type_traits>
+
+/**
+ * @file
+ * This header provides a sequence lock (seqlock) for small, trivially copyable data structures.
+ *
+ * A seqlock allows one writer to publish a new value while any number of readers copy the
+ * latest value without blocking the writer. The writer increments the sequence counter before
+ * and after updating the data, so the counter is odd while a write is in progress. A reader
+ * copies the data and retries if the counter was odd or has changed during the copy.
+ *
+ * The data is stored as an array of relaxed atomic words, so concurrent reads and writes are
+ * well defined and a torn copy is always detected by the sequence counter.
+ *
+ * @note Only ONE writer at a time is allowed. Multiple writers must be serialized by the caller,
+ *       e.g. with a mutex.
+ * @note On a preemptive RTOS a reader with a higher priority than the writer can preempt the
+ *       writer in the middle of a write. Use tryRead() / read() with a bounded number of retries
+ *       and fall back to the lock that serializes the writers in that case.
+*/
+
+namespace utils
+{
+
+template<typename DATA_TYPE>
+class SeqLock
+{
+  static_assert(std::is_trivially_copyable<DATA_TYPE>::value, "SeqLock requires a trivially copyable data type");
+
+  public:
+  SeqLock() = default;
+
+  // Do not allow to copy this class
+  SeqLock(const SeqLock&) = delete;
+  SeqLock& operator=(const SeqLock&) = delete;
+
+  /**
+   * @brief Publishes a new value.
+   * @param[in] value The value to be published.
+   *
+   * @note Must not be called concurrently from more than one writer.
+  */
+  void write(const DATA_TYPE& value) noexcept
+  {
+    uint32_t words[WORD_COUNT] = {};
+    std::memcpy(words, &value, sizeof(DATA_TYPE));
+
+    const uint32_t seq = _sequence.load(std::memory_order_relaxed);
+    _sequence.store(seq + 1, std::memory_order_relaxed); // Odd: write in progress
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (std::size_t i = 0; i < WORD_COUNT; ++i)
+      _data[i].store(words[i], std::memory_order_relaxed);
+
+    _sequence.store(seq + 2, std::memory_order_release); // Even: write done
+  }
+
+  /**
+   * @brief Tries to copy a consistent value once.
+   * @param[out] value Receives the value, only valid if true is returned.
+   * @return true if the copy is consistent, false if a write was in progress or happened during the copy.
+  */
+  bool tryRead(DATA_TYPE& value) const noexcept
+  {
+    const uint32_t seqBegin = _sequence.load(std::memory_order_acquire);
+    if (seqBegin & 1U)
+      return false;
+
+    uint32_t words[WORD_COUNT];
+    for (std::size_t i = 0; i < WORD_COUNT; ++i)
+      words[i] = _data[i].load(std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (seqBegin != _sequence.load(std::memory_order_relaxed))
+      return false;
+
+    std::memcpy(&value, words, sizeof(DATA_TYPE));
+    return true;
+  }
+
+  /**
+   * @brief Copies a consistent value, retries up to \a maxRetries times.
+   * @param[out] value Receives the value, only valid if true is returned.
+   * @param[in] maxRetries Maximum number of retries after the first attempt.
+   * @return true if a consistent copy could be taken.
+  */
+  bool read(DATA_TYPE& value, std::size_t maxRetries) const noexcept
+  {
+    for (std::size_t i = 0; i <= maxRetries; ++i)
+    {
+      if (tryRead(value))
+        return true;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Returns the current sequence number. It is incremented by two on every completed write.
+  */
+  uint32_t sequence() const noexcept
+  {
+    return _sequence.load(std::memory_order_acquire);
+  }
+
+  private:
+  static constexpr std::size_t WORD_COUNT {(sizeof(DATA_TYPE) + sizeof(uint32_t) - 1) / sizeof(uint32_t)};
+
+  std::atomic<uint32_t> _sequence {0};
+  std::atomic<uint32_t> _data[WORD_COUNT] {};
+};
+
+} // namespace utils
+
+#endif // UTILS_SEQLOCK_H
@@ -0,0 +1,142 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+
+#ifndef UTILS_TASKMONITOR_H
+#define UTILS_TASKMONITOR_H
+
+#include <cstddef> // std::size_t
+#include <cstdint> // uint32_t, ...
+
+/**
+ * @file
+ * This header provides the runtime measurement of a cyclic task.
+ *
+ * A task calls begin() before and end() after the work of one cycle (not around the delay). From the
+ * timestamps the TaskMonitor calculates
+ * - a histogram of the cycle durations with fixed buckets (see TASK_MONITOR_BUCKET_LIMITS_US),
+ * - min/avg/max of the cycle durations,
+ * - the jitter of the cycle period (difference between two successive periods; last, max and the smoothed
+ *   value with gain 1/16 as in RFC 3550),
+ * - the CPU share (busy time / elapsed time) of the last complete window.
+ *
+ * Each call only needs a few additions and comparisons, so it can stay enabled in production.
+ * The timestamps are in µs and may wrap around (32 bit, about 71 minutes).
+*/
+
+namespace utils
+{
+
+/** Upper limits of the histogram buckets; the last bucket counts all longer cycles */
+constexpr uint32_t TASK_MONITOR_BUCKET_LIMITS_US[] = {100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000};
+constexpr std::size_t TASK_MONITOR_BUCKETS {sizeof(TASK_MONITOR_BUCKET_LIMITS_US) / sizeof(uint32_t) + 1};
+
+/** Runtime statistics of one task */
+struct TaskStatistics
+{
+  uint32_t cycles;
+  uint32_t durationLastUs;
+  uint32_t durationMinUs;
+  uint32_t durationAvgUs;
+  uint32_t durationMaxUs;
+  uint32_t periodLastUs;       //!< Time between the start of the last two cycles
+  uint32_t jitterUs;           //!< Smoothed jitter of the period (RFC 3550)
+  uint32_t jitterMaxUs;
+  uint16_t cpuPermille;        //!< Busy time in the last complete window (0..1000)
+  uint32_t histogram[TASK_MONITOR_BUCKETS];
+};
+
+/**
+ * Measures the cycles of one task. Not thread safe; begin() and end() are called by the task itself.
+*/
+class TaskMonitor
+{
+  public:
+  static constexpr uint32_t DEFAULT_WINDOW_US {10000000};
+
+  explicit TaskMonitor(uint32_t windowUs = DEFAULT_WINDOW_US) : _windowUs(windowUs > 0 ? windowUs : 1) {}
+
+  /** @brief Returns the bucket of a cycle duration */
+  static std::size_t bucket(uint32_t durationUs)
+  {
+    std::size_t i = 0;
+    while (i < TASK_MONITOR_BUCKETS - 1 && durationUs > TASK_MONITOR_BUCKET_LIMITS_US[i]) ++i;
+    return i;
+  }
+
+  /** @brief Start of the work of a cycle */
+  void begin(uint32_t nowUs)
+  {
+    if (_started)
+    {
+      const uint32_t period = nowUs - _beginUs;
+      if (_periods > 0)
+      {
+        const uint32_t diff = period > _stats.periodLastUs ? period - _stats.periodLastUs : _stats.periodLastUs - period;
+        if (diff > _stats.jitterMaxUs) _stats.jitterMaxUs = diff;
+        // J = J + (|D| - J) / 16; scaled by 16 to keep the fraction
+        _jitter16 += diff - ((_jitter16 + 8) >> 4);
+        _stats.jitterUs = (_jitter16 + 8) >> 4;
+      }
+      _stats.periodLastUs = period;
+      _periods++;
+    }
+    else
+    {
+      _started = true;
+      _windowStartUs = nowUs;
+    }
+    _beginUs = nowUs;
+    _running = true;
+  }
+
+  /** @brief End of the work of a cycle */
+  void end(uint32_t nowUs)
+  {
+    if (!_running) return;
+    _running = false;
+
+    const uint32_t duration = nowUs - _beginUs;
+    _stats.cycles++;
+    _stats.durationLastUs = duration;
+    if (_stats.cycles == 1 || duration < _stats.durationMinUs) _stats.durationMinUs = duration;
+    if (duration > _stats.durationMaxUs) _stats.durationMaxUs = duration;
+    _durationSumUs += duration;
+    _stats.histogram[bucket(duration)]++;
+
+    _windowBusyUs += duration;
+    const uint32_t window = nowUs - _windowStartUs;
+    if (window >= _windowUs)
+    {
+      const uint64_t permille = static_cast<uint64_t>(_windowBusyUs) * 1000 / window;
+      _stats.cpuPermille = static_cast<uint16_t>(permille > 1000 ? 1000 : permille);
+      _windowStartUs = nowUs;
+      _windowBusyUs = 0;
+    }
+  }
+
+  TaskStatistics statistics() const
+  {
+    TaskStatistics stats = _stats;
+    stats.durationAvgUs = _stats.cycles > 0 ? static_cast<uint32_t>(_durationSumUs / _stats.cycles) : 0;
+    return stats;
+  }
+
+  private:
+  const uint32_t _windowUs;
+  bool _started {false};
+  bool _running {false};
+  uint32_t _beginUs {0};
+  uint32_t _periods {0};
+  uint32_t _jitter16 {0};
+  uint64_t _durationSumUs {0};
+  uint32_t _windowStartUs {0};
+  uint32_t _windowBusyUs {0};
+  TaskStatistics _stats {};
+};
+
+} // namespace utils
+
+#endif // UTILS_TASKMONITOR_H
@@ -0,0 +1,114 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef UTILS_TEXTBUFFER_HPP
+#define UTILS_TEXTBUFFER_HPP
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+/**
+ * @file
+ * Fixed size text buffer to build responses and messages without heap allocations.
+ *
+ * The buffer is meant as scratch buffer, which is reused for every request: reset() only rewinds the write
+ * position (like a bump allocator). If a text does not fit anymore, the buffer is marked as overflowed, the text
+ * is dropped and all further appends are ignored, so a truncated response can be detected before it is sent.
+ *
+ * @code
+ *  static utils::TextBuffer<512> buf;
+ *  buf.reset();
+ *  buf.appendf("%u;%.2f;", nr, value);
+ *  buf.append("|");
+ *  if (!buf.overflow()) send(buf.data(), buf.length());
+ * @endcode
+*/
+
+namespace utils
+{
+
+template<std::size_t SIZE>
+class TextBuffer
+{
+  static_assert(SIZE > 1 && SIZE <= UINT16_MAX, "Size of the buffer");
+
+  public:
+  void reset()
+  {
+    _len = 0;
+    _overflow = false;
+    _data[0] = 0;
+  }
+
+  /** @brief Appends a text without formatting */
+  void append(const char* text)
+  {
+    if (_overflow || text == nullptr) return;
+    const std::size_t len = std::strlen(text);
+    if (_len + len >= SIZE)
+    {
+      setOverflow();
+      return;
+    }
+    std::memcpy(&_data[_len], text, len + 1);
+    _len += len;
+    updateHighWater();
+  }
+
+  /** @brief Appends formatted text (printf) */
+  void appendf(const char* format, ...) __attribute__((format(printf, 2, 3)))
+  {
+    if (_overflow) return;
+
+    va_list args;
+    va_start(args, format);
+    const int len = std::vsnprintf(&_data[_len], SIZE - _len, format, args);
+    va_end(args);
+
+    if (len < 0 || _len + static_cast<std::size_t>(len) >= SIZE)
+    {
+      setOverflow();
+      return;
+    }
+    _len += static_cast<std::size_t>(len);
+    updateHighWater();
+  }
+
+  bool overflow() const { return _overflow; }
+  const char* data() const { return _data; }
+  uint16_t length() const { return static_cast<uint16_t>(_len); }
+  static constexpr std::size_t capacity() { return SIZE - 1; }
+
+  /** @brief Max. length since the creation of the buffer (to check the size) */
+  uint16_t highWater() const { return static_cast<uint16_t>(_highWater); }
+  /** @brief Number of overflows since the creation of the buffer */
+  uint32_t overflows() const { return _overflows; }
+
+  private:
+  void setOverflow()
+  {
+    _overflow = true;
+    _data[_len] = 0; // Drop the partially written text
+    ++_overflows;
+  }
+
+  void updateHighWater()
+  {
+    if (_len > _highWater) _highWater = _len;
+  }
+
+  char _data[SIZE] {};
+  std::size_t _len {0};
+  std::size_t _highWater {0};
+  uint32_t _overflows {0};
+  bool _overflow {false};
+};
+
+} // namespace utils
+
+#endif // UTILS_TEXTBUFFER_HPP
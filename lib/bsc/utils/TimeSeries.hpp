@@ -0,0 +1,343 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+
+#ifndef UTILS_TIMESERIES_H
+#define UTILS_TIMESERIES_H
+
+#include <cstddef> // std::size_t
+#include <cstdint> // uint32_t, ...
+#include <cstring> // std::memcpy
+
+/**
+ * @file
+ * This header provides a binary time series log with fixed size records, which are stored in a ring.
+ *
+ * - TimeSeriesRecord: One record with min/max/avg of each channel for one period.
+ * - TimeSeriesAggregator: Collects the samples of one period and creates the record.
+ * - TimeSeriesStore: Ring of records on a storage (e.g. a file). Records are collected in RAM and written
+ *   as batch to reduce the flash wear. Time ranges are found with a binary search, so only the
+ *   requested records are read.
+ *
+ * The storage is any class with the methods
+ * @code
+ *   bool read(uint32_t offset, void* data, std::size_t len);
+ *   bool write(uint32_t offset, const void* data, std::size_t len);
+ * @endcode
+ * Writes happen only at offsets up to the current end of the storage, so it does not have to be
+ * preallocated.
+*/
+
+namespace utils
+{
+
+/** One record of a time series: min, max and average of each channel in the period starting at time */
+template<std::size_t CHANNELS>
+struct TimeSeriesRecord
+{
+  uint32_t time;             //!< Start of the period (epoch in s)
+  int16_t  min[CHANNELS];
+  int16_t  max[CHANNELS];
+  int16_t  avg[CHANNELS];
+};
+
+/**
+ * Aggregates the samples of all channels over a period.
+*/
+template<std::size_t CHANNELS>
+class TimeSeriesAggregator
+{
+  public:
+  using Record = TimeSeriesRecord<CHANNELS>;
+
+  explicit TimeSeriesAggregator(uint32_t periodS) : _periodS(periodS > 0 ? periodS : 1) {}
+
+  /**
+   * @brief Adds the samples of all channels.
+   * @param record Receives the record of the previous period, if it is complete.
+   * @return True, if the previous period is complete and record was written.
+  */
+  bool add(uint32_t time, const int16_t (&values)[CHANNELS], Record& record)
+  {
+    const uint32_t periodStart = time - (time % _periodS);
+    bool complete = false;
+    if (_count > 0 && periodStart != _periodStart) complete = flush(record);
+
+    if (_count == 0)
+    {
+      _periodStart = periodStart;
+      for (std::size_t i = 0; i < CHANNELS; ++i)
+      {
+        _min[i] = values[i];
+        _max[i] = values[i];
+        _sum[i] = 0;
+      }
+    }
+
+    for (std::size_t i = 0; i < CHANNELS; ++i)
+    {
+      if (values[i] < _min[i]) _min[i] = values[i];
+      if (values[i] > _max[i]) _max[i] = values[i];
+      _sum[i] += values[i];
+    }
+    _count++;
+    return complete;
+  }
+
+  /**
+   * @brief Creates the record of the current (incomplete) period and starts a new one.
+   * @return False, if there are no samples.
+  */
+  bool flush(Record& record)
+  {
+    if (_count == 0) return false;
+    record.time = _periodStart;
+    for (std::size_t i = 0; i < CHANNELS; ++i)
+    {
+      record.min[i] = _min[i];
+      record.max[i] = _max[i];
+      record.avg[i] = static_cast<int16_t>(_sum[i] / static_cast<int32_t>(_count));
+    }
+    _count = 0;
+    return true;
+  }
+
+  /** @brief Changes the period. The samples of the current period are discarded. */
+  void setPeriod(uint32_t periodS)
+  {
+    _periodS = periodS > 0 ? periodS : 1;
+    _count = 0;
+  }
+
+  uint32_t periodS() const { return _periodS; }
+
+  private:
+  uint32_t _periodS;
+  uint32_t _periodStart {0};
+  uint32_t _count {0};
+  int16_t _min[CHANNELS] {};
+  int16_t _max[CHANNELS] {};
+  int32_t _sum[CHANNELS] {};
+};
+
+/**
+ * Ring of fixed size records on a storage.
+ *
+ * The storage starts with a header (capacity, layout, oldest record, number of records), followed by the
+ * records. The header is written after every batch. If the header does not match (e.g. other record size or
+ * layout), the store starts empty. The layout is defined by the user (e.g. channel assignment and period).
+ *
+ * The records must be appended in ascending time order. Records, which are not newer than the last one
+ * (e.g. after the clock was set back), are dropped.
+*/
+template<typename RECORD, typename STORAGE, std::size_t BATCH>
+class TimeSeriesStore
+{
+  static_assert(BATCH > 0, "TimeSeriesStore requires a batch size > 0");
+  static_assert(offsetof(RECORD, time) == 0, "The time must be the first member of the record");
+
+  public:
+  static constexpr uint32_t MAGIC {0x53544342}; // "BCTS"
+  static constexpr uint16_t VERSION {2};
+
+  struct Header
+  {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordSize;
+    uint32_t capacity;
+    uint32_t layout;       //!< User defined, see begin()
+    uint32_t first;        //!< Slot of the oldest record
+    uint32_t count;        //!< Number of stored records
+  };
+
+  static constexpr uint32_t HEADER_SIZE {sizeof(Header)};
+
+  TimeSeriesStore(STORAGE& storage, uint32_t capacity) : _storage(storage), _capacity(capacity > 0 ? capacity : 1) {}
+
+  // Do not allow to copy this class
+  TimeSeriesStore(const TimeSeriesStore&) = delete;
+  TimeSeriesStore& operator=(const TimeSeriesStore&) = delete;
+
+  /**
+   * @brief Changes the capacity. Call begin() afterwards.
+  */
+  void setCapacity(uint32_t capacity) { _capacity = capacity > 0 ? capacity : 1; }
+
+  /**
+   * @brief Reads the header from the storage. Records collected in RAM are discarded.
+   * @param layout User defined value, which must match the stored one (e.g. channel assignment and period).
+   * @return True, if existing records were found. Otherwise the store is initialized empty.
+  */
+  bool begin(uint32_t layout = 0)
+  {
+    _pending = 0;
+    _layout = layout;
+    Header header {};
+    if (_storage.read(0, &header, sizeof(header)) && header.magic == MAGIC && header.version == VERSION &&
+        header.recordSize == sizeof(RECORD) && header.capacity == _capacity && header.layout == _layout &&
+        header.first < _capacity && header.count <= _capacity)
+    {
+      _first = header.first;
+      _count = header.count;
+      _lastTime = 0;
+      if (_count > 0) readTime(_count - 1, _lastTime);
+      return _count > 0;
+    }
+
+    _first = 0;
+    _count = 0;
+    _lastTime = 0;
+    writeHeader();
+    return false;
+  }
+
+  /** @brief Appends a record. The batch is written, if it is full or holds as many records as the ring. */
+  void append(const RECORD& record)
+  {
+    if (record.time <= _lastTime && (_count > 0 || _pending > 0))
+    {
+      _dropped++;
+      return;
+    }
+    _lastTime = record.time;
+    _batch[_pending++] = record;
+    if (_pending == BATCH || _pending == _capacity) flush();
+  }
+
+  /**
+   * @brief Writes the records collected in RAM to the storage (max. two writes, if the ring wraps around)
+   *        and updates the header.
+   * @return False, if a write failed. The records are discarded anyway.
+  */
+  bool flush()
+  {
+    if (_pending == 0) return true;
+
+    bool ok = true;
+    std::size_t done = 0;
+    while (done < _pending)
+    {
+      // Contiguous part up to the end of the ring
+      const uint32_t slot = (_first + _count) % _capacity;
+      std::size_t n = _pending - done;
+      if (n > _capacity - slot) n = _capacity - slot;
+
+      ok &= _storage.write(slotOffset(slot), &_batch[done], n * sizeof(RECORD));
+      _writes++;
+      _bytesWritten += n * sizeof(RECORD);
+
+      _count += static_cast<uint32_t>(n);
+      if (_count > _capacity)
+      {
+        _first = (_first + (_count - _capacity)) % _capacity;
+        _count = _capacity;
+      }
+      done += n;
+    }
+    _pending = 0;
+    ok &= writeHeader();
+    return ok;
+  }
+
+  /**
+   * @brief Calls callback(const RECORD&) for all records with from <= time <= to (stored and pending).
+   * @param maxRecords Max. number of records; 0 = unlimited.
+   * @return Number of records passed to the callback.
+  */
+  template<typename CALLBACK>
+  uint32_t readRange(uint32_t from, uint32_t to, CALLBACK callback, uint32_t maxRecords = 0)
+  {
+    uint32_t found = 0;
+    if (from > to) return 0;
+
+    // Binary search of the first stored record with time >= from
+    uint32_t low = 0;
+    uint32_t high = _count;
+    while (low < high)
+    {
+      const uint32_t mid = low + (high - low) / 2;
+      uint32_t time = 0;
+      if (!readTime(mid, time)) return 0;
+      if (time < from) low = mid + 1;
+      else high = mid;
+    }
+
+    RECORD chunk[READ_CHUNK];
+    for (uint32_t i = low; i < _count;)
+    {
+      // Contiguous part up to the end of the ring
+      const uint32_t slot = (_first + i) % _capacity;
+      uint32_t n = _count - i;
+      if (n > READ_CHUNK) n = READ_CHUNK;
+      if (n > _capacity - slot) n = _capacity - slot;
+      if (!_storage.read(slotOffset(slot), chunk, n * sizeof(RECORD))) return found;
+      _reads++;
+
+      for (uint32_t k = 0; k < n; ++k)
+      {
+        if (chunk[k].time > to) return found;
+        callback(chunk[k]);
+        if (++found == maxRecords) return found;
+      }
+      i += n;
+    }
+
+    for (std::size_t k = 0; k < _pending; ++k)
+    {
+      if (_batch[k].time < from) continue;
+      if (_batch[k].time > to) break;
+      callback(_batch[k]);
+      if (++found == maxRecords) break;
+    }
+    return found;
+  }
+
+  /** Returns the number of records (stored and pending) */
+  uint32_t size() const { return _count + static_cast<uint32_t>(_pending); }
+  uint32_t capacity() const { return _capacity; }
+  std::size_t pending() const { return _pending; }
+
+  /** Statistics: number of write/read calls to the storage, bytes written, dropped records */
+  uint32_t writes() const { return _writes; }
+  uint32_t reads() const { return _reads; }
+  uint32_t bytesWritten() const { return _bytesWritten; }
+  uint32_t dropped() const { return _dropped; }
+
+  private:
+  static constexpr uint32_t READ_CHUNK {8};
+
+  static uint32_t slotOffset(uint32_t slot) { return HEADER_SIZE + slot * static_cast<uint32_t>(sizeof(RECORD)); }
+
+  bool readTime(uint32_t index, uint32_t& time)
+  {
+    _reads++;
+    return _storage.read(slotOffset((_first + index) % _capacity), &time, sizeof(time));
+  }
+
+  bool writeHeader()
+  {
+    const Header header {MAGIC, VERSION, static_cast<uint16_t>(sizeof(RECORD)), _capacity, _layout, _first, _count};
+    _writes++;
+    return _storage.write(0, &header, sizeof(header));
+  }
+
+  STORAGE& _storage;
+  uint32_t _capacity;
+  uint32_t _layout {0};
+  uint32_t _first {0};
+  uint32_t _count {0};
+  uint32_t _lastTime {0};
+  RECORD _batch[BATCH];
+  std::size_t _pending {0};
+  uint32_t _writes {0};
+  uint32_t _reads {0};
+  uint32_t _bytesWritten {0};
+  uint32_t _dropped {0};
+};
+
+} // namespace utils
+
+#endif // UTILS_TIMESERIES_H
@@ -0,0 +1,75 @@
+# Copyright (c) 2024 Meik Jäckle
+#
+# This software is released under the MIT License.
+# https://opensource.org/licenses/MIT
+
+# Compares two benchmark results of the native_bench environment (JSON lines, see test/common/Benchmark.hpp).
+# Lines with the prefix "BENCHMARK " (stdout of the test) are accepted as well.
+#
+#   python scripts/benchmark_compare.py <baseline> <current> [--threshold 10]
+#
+# Returns 1, if a benchmark is slower than the baseline by more than the threshold (percent).
+
+import argparse
+import json
+import sys
+
+PREFIX = "BENCHMARK "
+
+
+def load(path):
+    results = {}
+    with open(path, "r") as file:
+        for line in file:
+            line = line.strip()
+            pos = line.find(PREFIX)
+            if pos >= 0:
+                line = line[pos + len(PREFIX):]
+            if not line.startswith("{"):
+                continue
+            try:
+                entry = json.loads(line)
+            except ValueError:
+                continue
+            # If a benchmark was run multiple times, the last result is used
+            results[entry["name"]] = entry
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two benchmark results")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0, help="allowed slowdown in percent (default 10)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    regressions = 0
+    print("%-45s %14s %14s %9s" % ("name", "baseline [ns]", "current [ns]", "change"))
+    for name in sorted(set(baseline) | set(current)):
+        if name not in baseline:
+            print("%-45s %14s %14.2f %9s" % (name, "-", current[name]["ns_per_op"], "new"))
+            continue
+        if name not in current:
+            print("%-45s %14.2f %14s %9s" % (name, baseline[name]["ns_per_op"], "-", "removed"))
+            continue
+
+        old = baseline[name]["ns_per_op"]
+        new = current[name]["ns_per_op"]
+        change = (new - old) * 100.0 / old if old > 0 else 0.0
+        mark = ""
+        if change > args.threshold:
+            mark = "  REGRESSION"
+            regressions += 1
+        print("%-45s %14.2f %14.2f %+8.1f%%%s" % (name, old, new, change, mark))
+
+    if regressions > 0:
+        print("%d benchmark(s) slower than %.1f%%" % (regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -224,3 +224,166 @@ for zeile in datei:
 datei.close()
 dateiOut.close()
 
+
+
+########################################################
+# Build params_idx.h
+# Index der JSON-Parameterseiten aus der params.h.
+# Die WebSettings nutzen den Index beim Aufbau der
+# Seiten, statt das JSON für jedes Feld neu zu durchsuchen.
+########################################################
+import re
+
+# Einfacher JSON-Parser, der zu jedem Wert die Position im Rohtext liefert.
+# Knoten: (typ, start, ende, inhalt); bei Strings zeigen start/ende auf den Text ohne Anführungszeichen.
+def idxSkipWs(s, p):
+    while p < len(s) and s[p] in b' \t\r\n':
+        p += 1
+    return p
+
+def idxParse(s, p):
+    p = idxSkipWs(s, p)
+    c = s[p:p+1]
+    if c == b'{':
+        start = p
+        obj = dict()
+        p = idxSkipWs(s, p+1)
+        while s[p:p+1] != b'}':
+            key, p = idxParse(s, p)
+            p = idxSkipWs(s, p)
+            p = p+1 # ':'
+            val, p = idxParse(s, p)
+            obj[s[key[1]:key[2]].decode('utf-8')] = val
+            p = idxSkipWs(s, p)
+            if s[p:p+1] == b',':
+                p = idxSkipWs(s, p+1)
+        return ('obj', start, p, obj), p+1
+    elif c == b'[':
+        start = p
+        arr = []
+        p = idxSkipWs(s, p+1)
+        while s[p:p+1] != b']':
+            val, p = idxParse(s, p)
+            arr.append(val)
+            p = idxSkipWs(s, p)
+            if s[p:p+1] == b',':
+                p = idxSkipWs(s, p+1)
+        return ('arr', start, p, arr), p+1
+    elif c == b'"':
+        start = p+1
+        p = start
+        while s[p:p+1] != b'"':
+            if s[p:p+1] == b'\\':
+                p += 1
+            p += 1
+        return ('str', start, p, None), p+1
+    else:
+        start = p
+        while p < len(s) and s[p:p+1] not in (b',', b'}', b']', b' ', b'\t', b'\r', b'\n'):
+            p += 1
+        return ('num', start, p, None), p
+
+def idxText(s, obj, key, default):
+    if key in obj:
+        return s[obj[key][1]:obj[key][2]].decode('utf-8')
+    return default
+
+# Wie isNumber() + atoi() in WebSettings.cpp
+def idxInt(s, obj, key, default):
+    txt = idxText(s, obj, key, None)
+    if txt is None:
+        return default
+    for c in txt:
+        if not c.isdigit() and c != '-':
+            return default
+    m = re.match(r'^-?[0-9]+', txt)
+    if m:
+        return int(m.group(0))
+    return 0
+
+# {pos,len} eines String-Wertes; pos=0 bedeutet nicht vorhanden
+def idxStr(obj, key):
+    if key in obj:
+        return "{%i,%i}" % (obj[key][1], obj[key][2]-obj[key][1])
+    return "{0,0}"
+
+dateiOut = open('./include/params_idx.h','w')
+dateiOut.write("/* ***********************************************************************************\n")
+dateiOut.write("* Wichtiger Hinweis!\n")
+dateiOut.write("* params_idx.h nicht manuell bearbeiten! Die Datei wird beim Build aus der params.h erstellt!\n")
+dateiOut.write("* ***********************************************************************************/\n")
+dateiOut.write("#include \"WebSettings.h\"\n\n")
+
+datei = open('./include/params.h','rb')
+paramsH = datei.read()
+datei.close()
+
+for m in re.finditer(rb'const char (\w+)\[\] PROGMEM = R"rawliteral\((.*?)\)rawliteral";', paramsH, re.S):
+    pageName = m.group(1).decode('utf-8')
+    s = m.group(2)
+    if len(s) > 0xFFFF:
+        print("Error: " + pageName + " ist zu groß für den Index")
+        continue
+
+    root, p = idxParse(s, 0)
+    page = root[3]['page'][3]
+
+    # Elemente: Erst alle Elemente der Seite, danach die Elemente der Gruppen (zusammenhängend)
+    entries = []
+    options = []
+    todo = [(page, None)]
+    while len(todo) > 0:
+        elements, parentIdx = todo.pop(0)
+        first = len(entries)
+        if parentIdx is not None:
+            entries[parentIdx]['childFirst'] = first
+            entries[parentIdx]['childCnt'] = len(elements)
+        for e in elements:
+            obj = e[3]
+            entry = dict()
+            entry['obj'] = obj
+            entry['childFirst'] = 0
+            entry['childCnt'] = 0
+            entry['optionsFirst'] = len(options)
+            entry['optionsCnt'] = 0
+            if 'options' in obj:
+                for o in obj['options'][3]:
+                    options.append(o[3])
+                entry['optionsCnt'] = len(obj['options'][3])
+            entries.append(entry)
+        for i, e in enumerate(elements):
+            if 'group' in e[3]:
+                todo.append((e[3]['group'][3], first+i))
+
+    dateiOut.write("const paramIdxEntry_s " + pageName + "IdxEntries[] PROGMEM = {\n")
+    for entry in entries:
+        obj = entry['obj']
+        dateiOut.write("  {%i,%i,%i,%i,%i,%i,%i,%i,%i,%i,%i,%i,%i,%i,%i,%s,%s,%s,%s,%s,%s},\n" % (
+            idxInt(s, obj, 'name', 0),
+            idxInt(s, obj, 'type', 0),
+            idxInt(s, obj, 'dt', 0),
+            1 if idxText(s, obj, 'flash', '') == '1' else 0,
+            idxInt(s, obj, 'groupsize', 0),
+            idxInt(s, obj, 'label_offset', 0),
+            idxInt(s, obj, 'depId', 0),
+            idxInt(s, obj, 'depVal', 0),
+            idxInt(s, obj, 'depDt', 1),
+            idxInt(s, obj, 'min', 0),
+            idxInt(s, obj, 'max', 100),
+            entry['childFirst'], entry['childCnt'],
+            entry['optionsFirst'] if entry['optionsCnt'] > 0 else 0, entry['optionsCnt'],
+            idxStr(obj, 'label'), idxStr(obj, 'label_entry'), idxStr(obj, 'help'),
+            idxStr(obj, 'default'), idxStr(obj, 'unit'), idxStr(obj, 'step')))
+    dateiOut.write("};\n")
+
+    dateiOut.write("const paramIdxOption_s " + pageName + "IdxOptions[] PROGMEM = {\n")
+    for o in options:
+        dateiOut.write("  {%s,%s,%i},\n" % (idxStr(o, 'v'), idxStr(o, 'l'), idxInt(s, o, 'd', 0)))
+    if len(options) == 0:
+        dateiOut.write("  {{0,0},{0,0},0},\n")
+    dateiOut.write("};\n")
+
+    dateiOut.write("const paramIdx_s " + pageName + "Idx = {" + pageName + "IdxEntries, " + pageName + "IdxOptions, " +
+        str(len(entries)) + ", " + str(len(page)) + "};\n\n")
+
+dateiOut.close()
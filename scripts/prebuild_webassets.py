@@ -0,0 +1,120 @@
+# Copyright (c) 2024 Meik Jäckle
+#
+# This software is released under the MIT License.
+# https://opensource.org/licenses/MIT
+
+# Vorkomprimierte Web-Assets (gzip), siehe include/WebAssets.hpp
+#
+# 1. include/webpages_gz.h: Alle Seiten aus der webpages.h gzip-komprimiert, mit ETag (Hash des Inhalts)
+# 2. ./data: Zu jeder Textdatei (htm, css, js, ...) wird eine <datei>.gz erstellt (uploadfs),
+#    handleFileRead() liefert diese aus, wenn der Browser gzip unterstützt.
+#
+# Muss nach der prebuild_parameter.py laufen, da diese die webpages.h erstellt.
+
+import gzip
+import hashlib
+import os
+
+def gzipBytes(data):
+    # mtime=0, damit das Ergebnis bei gleichem Inhalt immer gleich ist
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+def etag(data):
+    return "\\\"" + hashlib.sha1(data).hexdigest()[0:16] + "\\\""
+
+# Liest die Werte aller 'const char name[] PROGMEM = "..." "...";' (aneinandergereihte C-Strings)
+def readCStrings(text):
+    pages = []
+    pos = 0
+    while True:
+        start = text.find("const char ", pos)
+        if start < 0:
+            break
+        nameEnd = text.find("[]", start)
+        assign = text.find("=", start)
+        name = text[start+11:nameEnd].strip()
+        if nameEnd < 0 or assign < 0 or "PROGMEM" not in text[nameEnd:assign]:
+            pos = start+11
+            continue
+
+        p = assign+1
+        value = bytearray()
+        while p < len(text):
+            c = text[p]
+            if c == '"':
+                p += 1
+                while text[p] != '"':
+                    if text[p] == '\\':
+                        esc = text[p+1]
+                        value += {'n': b'\n', 't': b'\t', 'r': b'\r', '"': b'"', '\\': b'\\', '\'': b'\''}.get(esc, esc.encode('utf-8'))
+                        p += 2
+                    else:
+                        value += text[p].encode('utf-8')
+                        p += 1
+                p += 1
+            elif c == ';':
+                break
+            elif text.startswith("//", p):
+                p = text.find("\n", p)
+            else:
+                p += 1
+        pages.append((name, bytes(value)))
+        pos = p
+    return pages
+
+def contentType(name):
+    if name == "htmlFavicon":
+        return "image/svg+xml"
+    return "text/html"
+
+
+########################################################
+# Build webpages_gz.h
+########################################################
+datei = open('./include/webpages.h', 'r', encoding='utf-8')
+pages = readCStrings(datei.read())
+datei.close()
+
+dateiOut = open('./include/webpages_gz.h', 'w')
+dateiOut.write("/* ***********************************************************************************\n")
+dateiOut.write("* Wichtiger Hinweis!\n")
+dateiOut.write("* webpages_gz.h nicht manuell bearbeiten! Die Datei wird beim Build aus der webpages.h erstellt!\n")
+dateiOut.write("* ***********************************************************************************/\n")
+dateiOut.write("#ifndef WEBPAGES_GZ_H\n#define WEBPAGES_GZ_H\n\n")
+dateiOut.write("#include \"webpages.h\"\n#include \"WebAssets.hpp\"\n\n")
+
+for name, value in pages:
+    gz = gzipBytes(value)
+    dateiOut.write("// %s: %i -> %i Byte\n" % (name, len(value), len(gz)))
+    dateiOut.write("const uint8_t %sGz[] PROGMEM = {\n" % name)
+    for i in range(0, len(gz), 20):
+        dateiOut.write("  " + ",".join("0x%02X" % b for b in gz[i:i+20]) + ",\n")
+    dateiOut.write("};\n")
+    dateiOut.write("const webassets::Asset %sAsset = {%sGz, sizeof(%sGz), %s, \"%s\", \"%s\"};\n\n" %
+        (name, name, name, name, contentType(name), etag(value)))
+
+dateiOut.write("#endif\n")
+dateiOut.close()
+
+
+########################################################
+# gzip der Dateien für das Dateisystem (./data)
+########################################################
+GZ_EXTENSIONS = ('.htm', '.html', '.css', '.js', '.json', '.svg', '.xml', '.txt')
+
+if os.path.isdir('./data'):
+    for root, dirs, files in os.walk('./data'):
+        for f in files:
+            if not f.lower().endswith(GZ_EXTENSIONS):
+                continue
+            src = os.path.join(root, f)
+            dst = src + ".gz"
+            if os.path.exists(dst) and os.path.getmtime(dst) >= os.path.getmtime(src):
+                continue
+            datei = open(src, 'rb')
+            data = datei.read()
+            datei.close()
+            datei = open(dst, 'wb')
+            datei.write(gzipBytes(data))
+            datei.close()
+            print("gzip: " + dst)
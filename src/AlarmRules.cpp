@@ -9,6 +9,7 @@
 #include "Ow.h"
 #include "Canbus.h"
 #include "BmsData.h"
+#include "SettingsView.h"
 #include "mqtt_t.h"
 #include "FreqCountESP.h"
 #include "log.h"
@@ -20,14 +21,14 @@ static SemaphoreHandle_t doMutex = NULL;
 static SemaphoreHandle_t alarmSettingsChangeMutex = NULL;
 
 
-bool bo_Alarm[CNT_ALARMS];
+static alarmrules::TriggerState<CNT_ALARMS> triggerState;
+static alarmrules::RuleEngine<SETTINGS_VIEW_MAX_ALARM_RULES> ruleEngine;
+static uint32_t u32_mRuleEngineGeneration = 0;
 bool bo_Alarm_old[CNT_ALARMS];
-uint16_t alarmCauseAktiv[CNT_ALARMS];
 
 uint16_t u16_DoPulsOffCounter[CNT_DIGITALOUT];
 uint8_t u8_DoVerzoegerungTimer[CNT_DIGITALOUT];
 
-bool bo_alarmActivate[CNT_ALARMS]; //Merker ob ein Alarm in diesem 'run' gesetzt wurde
 bool bo_timerPulseOffIsRunning;
 
 bool bo_mChangeAlarmSettings;
@@ -37,29 +38,69 @@ uint8_t u8_mTachoChannel;
 
 uint16_t vTrigger;
 
-//Hysterese
-uint32_t u32_hystereseTotalVoltageMin=0;
-uint32_t u32_hystereseTotalVoltageMax=0;
-uint8_t u8_merkerHysterese_TriggerAtSoc=0;
+static BmsDataSnapshot alarmRuleBmsSnapshot[BMSDATA_NUMBER_ALLDEVICES];
+
+static_assert(ALARM_CAUSE_DI==(uint8_t)alarmrules::Cause::DI &&
+  ALARM_CAUSE_BMS_NO_DATA==(uint8_t)alarmrules::Cause::BMS_NO_DATA &&
+  ALARM_CAUSE_BMS_CELL_VOLTAGE==(uint8_t)alarmrules::Cause::BMS_CELL_VOLTAGE_RANGE &&
+  ALARM_CAUSE_BMS_TOTAL_VOLTAGE_MIN==(uint8_t)alarmrules::Cause::BMS_TOTAL_VOLTAGE_MIN &&
+  ALARM_CAUSE_BMS_TOTAL_VOLTAGE_MAX==(uint8_t)alarmrules::Cause::BMS_TOTAL_VOLTAGE_MAX &&
+  ALARM_CAUSE_TEMPERATUR==(uint8_t)alarmrules::Cause::TEMPERATURE &&
+  ALARM_CAUSE_OW_SENSOR_ERR==(uint8_t)alarmrules::Cause::OW_SENSOR_ERROR &&
+  ALARM_CAUSE_CELL_VOLTAGE_PLAUSIBILITY==(uint8_t)alarmrules::Cause::CELL_VOLTAGE_PLAUSIBILITY &&
+  ALARM_CAUSE_SOC==(uint8_t)alarmrules::Cause::SOC &&
+  ALARM_CAUSE_FAN==(uint8_t)alarmrules::Cause::FAN &&
+  ALARM_VIRTUAL_TRIGGER==(uint8_t)alarmrules::Cause::VIRTUAL_TRIGGER, "Alarm causes do not match");
+static_assert(TEMP_IF_SENSOR_READ_ERROR==alarmrules::SENSOR_READ_ERROR, "TEMP_IF_SENSOR_READ_ERROR does not match");
+
+/* Datenquelle für die RuleEngine. Die BMS-Daten werden pro Zyklus nur einmal und nur bei Bedarf geholt. */
+class AlarmRuleData
+{
+  public:
+  explicit AlarmRuleData(uint8_t diData) : u8_mDiData(diData)
+  {
+    inverterDataSemaphoreTake();
+    inverterData_s *inverterData = getInverterData();
+    bo_mBatteryOnline = !inverterData->noBatteryPackOnline;
+    u16_mSoc = inverterData->inverterSoc;
+    inverterDataSemaphoreGive();
+  }
+
+  const BmsDataSnapshot& bms(uint8_t bmsNr)
+  {
+    if(bmsNr>=BMSDATA_NUMBER_ALLDEVICES) bmsNr=0;
+    if(!isBitSet(u32_mLoaded,bmsNr))
+    {
+      getBmsDataSnapshot(bmsNr, alarmRuleBmsSnapshot[bmsNr]);
+      bitSet(u32_mLoaded,bmsNr);
+    }
+    return alarmRuleBmsSnapshot[bmsNr];
+  }
+
+  float owTemperature(uint8_t sensorNr) { return owGetTemp(sensorNr); }
+  uint8_t cellVoltageUnchangedCycles(uint8_t bmsNr) { return getBmsLastChangeCellVoltageCrc(bmsNr); }
+  uint8_t owSensorErrors() { return owGetAllSensorError(); }
+  bool batteryOnline() { return bo_mBatteryOnline; }
+  uint16_t soc() { return u16_mSoc; }
+  uint8_t digitalInputs() { return u8_mDiData; }
+
+  private:
+  uint32_t u32_mLoaded = 0;
+  uint8_t u8_mDiData;
+  bool bo_mBatteryOnline;
+  uint16_t u16_mSoc;
+};
 
-void rules_Bms();
-void rules_Temperatur();
 void rules_CanInverter();
 void rules_Tacho();
-bool temperatur_maxWertUeberwachung(uint8_t);
-bool temperatur_maxWertUeberwachungReferenz(uint8_t);
-bool temperatur_DifferenzUeberwachung(uint8_t);
-void temperatur_senorsErrors();
 void runDigitalAusgaenge();
 void doOffPulse(TimerHandle_t xTimer);
-void getDIs();
+uint8_t getDIs();
 void setDOs();
 void tachoInit();
 bool tachoRead(uint16_t &tachoRpm);
 void tachoSetMux(uint8_t channel);
 void setAlarmToBtDevices(uint8_t u8_AlarmNr, boolean bo_Alarm);
-void rules_PlausibilityCeck();
-void rules_soc();
 void rules_vTrigger();
 
 
@@ -68,19 +109,18 @@ void initAlarmRules()
   u8_mDoByte = 0;
   bo_timerPulseOffIsRunning = false;
   bo_mChangeAlarmSettings=false;
-  u8_merkerHysterese_TriggerAtSoc=false;
   vTrigger=0;
+  ruleEngine.reset();
 
   for(uint8_t i=0;i<CNT_ALARMS;i++)
   {
-    bo_Alarm[i] = false;
+    triggerState.reset(i);
     bo_Alarm_old[i] = false;
-    alarmCauseAktiv[i]=0;
 
     //Initialwerte per mqqt senden
     if(WebSettings::getBool(ID_PARAM_MQTT_SERVER_ENABLE,0))
     {
-      mqttPublish(MQTT_TOPIC_ALARM, i+1, -1, -1, bo_Alarm[i]);
+      mqttPublish(MQTT_TOPIC_ALARM, i+1, -1, -1, triggerState.isActive(i));
 
     }
   }
@@ -138,7 +178,7 @@ bool isTriggerActive(uint16_t paramId, uint8_t groupNr, uint8_t dataType)
 
 bool getAlarm(uint8_t alarmNr)
 {
-  return bo_Alarm[alarmNr];
+  return triggerState.isActive(alarmNr);
 }
 
 uint16_t getAlarm()
@@ -146,32 +186,14 @@ uint16_t getAlarm()
   uint16_t u16_lAlm=0;
   for(uint8_t i=0; i<10;i++)
   {
-    u16_lAlm |= (bo_Alarm[i] << i);
+    u16_lAlm |= (triggerState.isActive(i) << i);
   }
   return u16_lAlm;
 }
 
 void setAlarm(uint8_t alarmNr, bool bo_lAlarm, uint8_t cause)
 {
-  if(alarmNr==0)return;
-
-  alarmNr--;
-  if(bo_lAlarm)
-  {
-    //BSC_LOGD(TAG,"setAlarm: alarmNr=%i TRUE",alarmNr);
-    bo_Alarm[alarmNr]=true;
-    bitSet(alarmCauseAktiv[alarmNr],cause);
-    bo_alarmActivate[alarmNr]=true;
-  }
-  else if(bo_alarmActivate[alarmNr]!=true)
-  {
-    //BSC_LOGD(TAG,"setAlarm: alarmNr=%i FALSE",alarmNr);
-    bo_Alarm[alarmNr]=bo_lAlarm;
-    if(bo_lAlarm)
-    {
-      bo_alarmActivate[alarmNr]=true;
-    }
-  }
+  triggerState.set(alarmNr, bo_lAlarm, (alarmrules::Cause)cause);
 }
 
 /* Wenn sich die Triggergründe geändert haben, dann Meldung ins Log */
@@ -182,17 +204,16 @@ void handleLogTrigger(uint16_t (&alarmCauseAktivLast)[CNT_ALARMS])
     for(uint8_t cause=0; cause < 16; cause++)
     {
       if(isBitSet(alarmCauseAktivLast[triggerNr], cause)==0 &&
-        isBitSet(alarmCauseAktiv[triggerNr], cause)==1)
+        isBitSet(triggerState.causes(triggerNr), cause)==1)
       {
         BSC_LOGI(TAG,"Trigger %i high, cause %i",triggerNr+1,cause);
         logTrigger(triggerNr, cause, true);
       }
       else if(isBitSet(alarmCauseAktivLast[triggerNr], cause)==1 &&
-        isBitSet(alarmCauseAktiv[triggerNr], cause)==0)
+        isBitSet(triggerState.causes(triggerNr), cause)==0)
       {
         BSC_LOGI(TAG,"Trigger %i low, cause %i",triggerNr+1,cause);
         logTrigger(triggerNr, cause, false);
-        bitClear(alarmCauseAktiv[triggerNr],cause);
       }
     }
   }
@@ -217,41 +238,35 @@ void runAlarmRules()
 
   // Merker für die letzten Alarm Gründe
   uint16_t alarmCauseAktivLast[CNT_ALARMS];
-  memcpy(alarmCauseAktivLast, alarmCauseAktiv, sizeof(uint16_t)*CNT_ALARMS);
+  for(uint8_t triggerNr=0; triggerNr<CNT_ALARMS; triggerNr++) alarmCauseAktivLast[triggerNr]=triggerState.causes(triggerNr);
   // Lösche den letzten Triggergrund; Der Grund wird in dem Durchgang neu gesetzt
-  for(uint8_t triggerNr=0; triggerNr<CNT_ALARMS; triggerNr++) alarmCauseAktiv[triggerNr]=0;
+  triggerState.beginCycle();
 
   //Toggle LED
   if(getHwVersion()==0)u8_mDoByte ^= (1 << 7);
   else digitalWrite(GPIO_LED1_HW1, !digitalRead(GPIO_LED1_HW1));
 
-  //Merker vor jedem run auf false setzen
-  for(i=0;i<CNT_ALARMS;i++){bo_alarmActivate[i]=false;}
-
-  //Bluetooth+Serial BMS
-  rules_Bms();
-
-  //Temperatur Alarm
-  rules_Temperatur();
-
-  //Plausibility ceck (Zellvoltage)
-  rules_PlausibilityCeck();
-
-  //Inverter (CAN)
-  rules_CanInverter();
-
-  //Digitaleingänge
-  getDIs();
+  //Vorkompilierte Regeln (BMS, Temperatur, Plausibilität, Digitaleingänge, SoC)
+  //Nach einer Änderung der Parameter werden die Merker der Hysterese unveränderter Regeln übernommen
+  uint32_t u32_lGeneration = getSettingsViewGeneration();
+  SettingsViewRef lView;
+  if(u32_lGeneration!=u32_mRuleEngineGeneration)
+  {
+    ruleEngine.update(lView->alarmRules, triggerState);
+    u32_mRuleEngineGeneration=u32_lGeneration;
+  }
+  AlarmRuleData alarmRuleData(getDIs());
+  ruleEngine.evaluate(lView->alarmRules, alarmRuleData, millis(), triggerState);
 
   //Tacho auswerten
   //rules_Tacho();
 
-  //Rules Soc
-  rules_soc();
-
   //Virtual Trigger
   rules_vTrigger();
 
+  //Inverter (CAN)
+  rules_CanInverter();
+
   //ChangeAlarmSettings Flag lokal zwischenspeichern
   if(xSemaphoreTake(alarmSettingsChangeMutex, 25/portTICK_PERIOD_MS) == pdTRUE)
   {
@@ -266,21 +281,21 @@ void runAlarmRules()
     if(bo_lChangeAlarmSettings)
     {
       BSC_LOGD(TAG,"Reset Trigger (Nr=%i) - %s",i+1,WebSettings::getStringFlash(ID_PARAM_TRIGGER_NAMES,i).c_str());
-      bo_Alarm[i]=false;
+      triggerState.reset(i);
       bo_Alarm_old[i]=true;
-      alarmCauseAktiv[i]=0;
     }
 
-    if(bo_Alarm[i]!=bo_Alarm_old[i]) //Flankenwechsel
+    bool bo_lAlarm = triggerState.isActive(i);
+    if(bo_lAlarm!=bo_Alarm_old[i]) //Flankenwechsel
     {
-      BSC_LOGI(TAG, "Trigger %i, value %i - %s",i+1,bo_Alarm[i],WebSettings::getStringFlash(ID_PARAM_TRIGGER_NAMES,i).c_str());
-      bo_Alarm_old[i] = bo_Alarm[i];
+      BSC_LOGI(TAG, "Trigger %i, value %i - %s",i+1,bo_lAlarm,WebSettings::getStringFlash(ID_PARAM_TRIGGER_NAMES,i).c_str());
+      bo_Alarm_old[i] = bo_lAlarm;
 
       //Bei Statusänderung mqqt msg absetzen
       if(WebSettings::getBool(ID_PARAM_MQTT_SERVER_ENABLE,0))
       {
-        BSC_LOGD(TAG, "Trigger %i: %i - %s",i+1,bo_Alarm[i],WebSettings::getStringFlash(ID_PARAM_TRIGGER_NAMES,i).c_str());
-        mqttPublish(MQTT_TOPIC_ALARM, i+1, -1, -1, bo_Alarm[i]);
+        BSC_LOGD(TAG, "Trigger %i: %i - %s",i+1,bo_lAlarm,WebSettings::getStringFlash(ID_PARAM_TRIGGER_NAMES,i).c_str());
+        mqttPublish(MQTT_TOPIC_ALARM, i+1, -1, -1, bo_lAlarm);
       }
 
       //Bearbeiten der 6 Relaisausgaenge
@@ -289,7 +304,7 @@ void runAlarmRules()
       {
         if(isTriggerSelected(ID_PARAM_DO_AUSLOESUNG_BEI,b,DT_ID_PARAM_DO_AUSLOESUNG_BEI,i))
         {
-          if(bo_Alarm[i]==true)
+          if(bo_lAlarm==true)
           {
             if(u8_DoVerzoegerungTimer[b]==0xFF) //Verzoegerungstimer nur starten wenn er noch nicht läuft
             {
@@ -310,7 +325,7 @@ void runAlarmRules()
       }
 
       //Alarm an BT Device weiterleiten
-      setAlarmToBtDevices(i, bo_Alarm[i]);
+      setAlarmToBtDevices(i, bo_lAlarm);
     }
   }
 
@@ -421,48 +436,13 @@ void doOffPulse(TimerHandle_t xTimer)
   xSemaphoreGive(doMutex);
 }
 
-void getDIs()
+uint8_t getDIs()
 {
-  //Lese der Eingänge
+  //Lese der Eingänge; die Auswertung erfolgt über die vorkompilierten Regeln
   xSemaphoreTake(doMutex, portMAX_DELAY);
   uint8_t u8_lDiData = dioRwInOut();
   xSemaphoreGive(doMutex);
-
-  //Bearbeiten der 4 Digitaleingänge
-  for(uint8_t i=0; i<CNT_DIGITALIN; i++)
-  {
-    uint8_t u8_lAlarmNr  = WebSettings::getInt(ID_PARAM_DI_ALARM_NR,i,DT_ID_PARAM_DI_ALARM_NR);
-    bool    bo_lDiInvert = WebSettings::getBool(ID_PARAM_DI_INVERTIERT,i);
-
-    if(u8_lAlarmNr==0) continue;
-
-    if((u8_lDiData & (1<<i)) == (1<<i))
-    {
-      if(!bo_lDiInvert)
-      {
-        setAlarm(u8_lAlarmNr,true,ALARM_CAUSE_DI);
-        //BSC_LOGD(TAG,"Alarm (a) DI TRUE; Alarm %i", u8_lAlarmNr);
-      }
-      else
-      {
-        setAlarm(u8_lAlarmNr,false,ALARM_CAUSE_DI);
-        //BSC_LOGD(TAG,"Alarm (b) DI FALSE; Alarm %i", u8_lAlarmNr);
-      }
-    }
-    else
-    {
-      if(!bo_lDiInvert)
-      {
-        setAlarm(u8_lAlarmNr,false,ALARM_CAUSE_DI);
-        //BSC_LOGD(TAG,"Alarm (c) DI FALSE; Alarm %i", u8_lAlarmNr);
-      }
-      else
-      {
-        setAlarm(u8_lAlarmNr,true,ALARM_CAUSE_DI);
-        //BSC_LOGD(TAG,"Alarm (d) DI TRUE; Alarm %i", u8_lAlarmNr);
-      }
-    }
-  }
+  return u8_lDiData;
 }
 
 void tachoInit()
@@ -573,168 +553,6 @@ void rules_Tacho()
 
 
 
-void rules_Bms()
-{
-  uint8_t i,tmp,u8_lAlarmruleBmsNr;
-  uint8_t u8_bmsSerial2=(uint8_t)WebSettings::getInt(ID_PARAM_SERIAL_CONNECT_DEVICE,2,DT_ID_PARAM_SERIAL_CONNECT_DEVICE);
-  uint8_t u8_numberOfBmsOnSerial2=(uint8_t)WebSettings::getInt(ID_PARAM_SERIAL2_CONNECT_TO_ID,0,DT_ID_PARAM_SERIAL2_CONNECT_TO_ID);
-
-  for(i=0; i<CNT_BT_ALARMS_RULES; i++)
-  {
-    u8_lAlarmruleBmsNr=WebSettings::getInt(ID_PARAM_ALARM_BTDEV_BMS_SELECT,i,DT_ID_PARAM_ALARM_BTDEV_BMS_SELECT);
-    if(u8_lAlarmruleBmsNr==127) continue; //'AUS'
-    //BSC_LOGE(TAG,"u8_lAlarmruleBmsNr=%i, u8_numberOfBmsOnSerial2=%i, u8_bmsSerial2=%i",u8_lAlarmruleBmsNr,u8_numberOfBmsOnSerial2,u8_bmsSerial2);
-    //Ist überhaupt ein Device parametriert?
-    if((u8_lAlarmruleBmsNr<BT_DEVICES_COUNT && WebSettings::getInt(ID_PARAM_SS_BTDEV,u8_lAlarmruleBmsNr,DT_ID_PARAM_SS_BTDEV)>0 && !WebSettings::getString(ID_PARAM_SS_BTDEVMAC,u8_lAlarmruleBmsNr).equals("")) ||
-      (u8_lAlarmruleBmsNr>=BT_DEVICES_COUNT && WebSettings::getInt(ID_PARAM_SERIAL_CONNECT_DEVICE,u8_lAlarmruleBmsNr-BT_DEVICES_COUNT,DT_ID_PARAM_SERIAL_CONNECT_DEVICE)!=0 ) ||
-      (u8_lAlarmruleBmsNr>(BT_DEVICES_COUNT+2) && u8_lAlarmruleBmsNr<(u8_numberOfBmsOnSerial2+BT_DEVICES_COUNT+2) && (u8_bmsSerial2==ID_SERIAL_DEVICE_SEPLOSBMS || u8_bmsSerial2==ID_SERIAL_DEVICE_SYLCINBMS ||
-      u8_bmsSerial2==ID_SERIAL_DEVICE_GOBELBMS || u8_bmsSerial2==ID_SERIAL_DEVICE_GOBEL_PC200)) )
-    {
-      //Wenn Alram für das Device aktiv ist
-      if(WebSettings::getInt(ID_PARAM_ALARM_BTDEV_ALARM_AKTION,i,DT_ID_PARAM_ALARM_BTDEV_ALARM_AKTION)>0)
-      {
-        //Alarm wenn keine Daten mehr vom BT-Device kommen
-        if((millis()-getBmsLastDataMillis(u8_lAlarmruleBmsNr))>((uint32_t)WebSettings::getInt(ID_PARAM_ALARM_BTDEV_ALARM_TIME_OUT,i,DT_ID_PARAM_ALARM_BTDEV_ALARM_TIME_OUT)*1000))
-        {
-          //Alarm
-          //debugPrintf("BT Alarm (%i)",u8_lAlarmruleBmsNr);
-          tmp=WebSettings::getInt(ID_PARAM_ALARM_BTDEV_ALARM_AKTION,i,DT_ID_PARAM_ALARM_BTDEV_ALARM_AKTION);
-          setAlarm(tmp,true,ALARM_CAUSE_BMS_NO_DATA);
-          //BSC_LOGD(TAG,"Alarm BMS no data - TRUE; Alarm %i", tmp);
-        }
-        else
-        {
-          tmp=WebSettings::getInt(ID_PARAM_ALARM_BTDEV_ALARM_AKTION,i,DT_ID_PARAM_ALARM_BTDEV_ALARM_AKTION);
-          setAlarm(tmp,false,ALARM_CAUSE_BMS_NO_DATA);
-          //BSC_LOGD(TAG,"Alarm BMS no data - FALSE; Alarm %i", tmp);
-        }
-      }
-
-      //Überwachung Zellspannung
-      //BSC_LOGD(TAG, "(i=%i) Zell Spg. Outside, enable=%i",i, WebSettings::getInt(ID_PARAM_ALARM_BT_CELL_SPG_ALARM_AKTION,i,DT_ID_PARAM_ALARM_BT_CELL_SPG_ALARM_AKTION));
-      if(WebSettings::getInt(ID_PARAM_ALARM_BT_CELL_SPG_ALARM_AKTION,i,DT_ID_PARAM_ALARM_BT_CELL_SPG_ALARM_AKTION)>0)
-      {
-      //debugPrintf("Zell Spg. Outside cellCnt=%i",WebSettings::getInt(ID_PARAM_ALARM_BT_CNT_CELL_CTRL,0,i,0));
-        for(uint8_t cc=0; cc<WebSettings::getInt(ID_PARAM_ALARM_BT_CNT_CELL_CTRL,i,DT_ID_PARAM_ALARM_BT_CNT_CELL_CTRL); cc++)
-        {
-          //debugPrintf("i=%i, cc=%i, cellspg=%i, min=%i, max=%i",i,cc,getBmsCellVoltage(i,cc),WebSettings::getInt(ID_PARAM_ALARM_BT_CELL_SPG_MIN,0,i,0),WebSettings::getInt(ID_PARAM_ALARM_BT_CELL_SPG_MAX,0,i,0));
-          if(getBmsCellVoltage(u8_lAlarmruleBmsNr,cc) < WebSettings::getInt(ID_PARAM_ALARM_BT_CELL_SPG_MIN,i,DT_ID_PARAM_ALARM_BT_CELL_SPG_MIN)
-            || getBmsCellVoltage(u8_lAlarmruleBmsNr,cc) > WebSettings::getInt(ID_PARAM_ALARM_BT_CELL_SPG_MAX,i,DT_ID_PARAM_ALARM_BT_CELL_SPG_MAX))
-          {
-            //Alarm
-            tmp=WebSettings::getInt(ID_PARAM_ALARM_BT_CELL_SPG_ALARM_AKTION,i,DT_ID_PARAM_ALARM_BT_CELL_SPG_ALARM_AKTION);
-            setAlarm(tmp,true,ALARM_CAUSE_BMS_CELL_VOLTAGE);
-            //BSC_LOGD(TAG, "Zell Spg. Outside (%i) alarmNr=%i", i,tmp);
-            break; //Sobald eine Zelle Alarm meldet kann abgebrochen werden
-          }
-          else
-          {
-            tmp=WebSettings::getInt(ID_PARAM_ALARM_BT_CELL_SPG_ALARM_AKTION,i,DT_ID_PARAM_ALARM_BT_CELL_SPG_ALARM_AKTION);
-            setAlarm(tmp,false,ALARM_CAUSE_BMS_CELL_VOLTAGE);
-            //BSC_LOGD(TAG,"Alarm BMS Zell Spg. - FALSE; Alarm %i", tmp);
-          }
-        }
-      }
-
-      //Überwachung Gesamtspannung
-      uint8_t u8_lAlarm = WebSettings::getInt(ID_PARAM_ALARM_BT_GESAMT_SPG_ALARM_AKTION,i,DT_ID_PARAM_ALARM_BT_GESAMT_SPG_ALARM_AKTION);
-      if(u8_lAlarm>0)
-      {
-        //Total voltage Min
-        if(getBmsTotalVoltage(u8_lAlarmruleBmsNr) < WebSettings::getFloat(ID_PARAM_ALARM_BT_GESAMT_SPG_MIN,i))
-        {
-          //Alarm
-          bitSet(u32_hystereseTotalVoltageMin,i);
-          bitClear(u32_hystereseTotalVoltageMax,i);
-          setAlarm(u8_lAlarm,true,ALARM_CAUSE_BMS_TOTAL_VOLTAGE_MAX);
-          //BSC_LOGD(TAG,"Alarm BMS Gesamtspannung - TRUE; Alarm %i", u8_lAlarm);
-        }
-        //Total voltage Max
-        else if(getBmsTotalVoltage(u8_lAlarmruleBmsNr) > WebSettings::getFloat(ID_PARAM_ALARM_BT_GESAMT_SPG_MAX,i))
-        {
-          //Alarm
-          bitSet(u32_hystereseTotalVoltageMax,i);
-          bitClear(u32_hystereseTotalVoltageMin,i);
-          setAlarm(u8_lAlarm,true,ALARM_CAUSE_BMS_TOTAL_VOLTAGE_MIN);
-          //BSC_LOGD(TAG,"Alarm BMS Gesamtspannung - TRUE; Alarm %i", u8_lAlarm);
-        }
-        else
-        {
-          float fl_totalVoltageHysterese = WebSettings::getFloat(ID_PARAM_ALARM_BT_GESAMT_SPG_HYSTERESE,i);
-          if(isBitSet(u32_hystereseTotalVoltageMin,i))
-          {
-            if(getBmsTotalVoltage(u8_lAlarmruleBmsNr) > (WebSettings::getFloat(ID_PARAM_ALARM_BT_GESAMT_SPG_MIN,i)+fl_totalVoltageHysterese))
-            {
-              bitClear(u32_hystereseTotalVoltageMin,i);
-              setAlarm(u8_lAlarm,false,ALARM_CAUSE_BMS_TOTAL_VOLTAGE_MAX);
-            }
-            else setAlarm(u8_lAlarm,true,ALARM_CAUSE_BMS_TOTAL_VOLTAGE_MAX);
-          }
-          else if(isBitSet(u32_hystereseTotalVoltageMax,i))
-          {
-            if(getBmsTotalVoltage(u8_lAlarmruleBmsNr) < (WebSettings::getFloat(ID_PARAM_ALARM_BT_GESAMT_SPG_MAX,i)-fl_totalVoltageHysterese))
-            {
-              bitClear(u32_hystereseTotalVoltageMax,i);
-              setAlarm(u8_lAlarm,false,ALARM_CAUSE_BMS_TOTAL_VOLTAGE_MIN);
-            }
-            else setAlarm(u8_lAlarm,true,ALARM_CAUSE_BMS_TOTAL_VOLTAGE_MIN);
-          }
-          /*else
-          {
-            setAlarm(u8_lAlarm,false);
-            //BSC_LOGD(TAG,"Alarm BMS Gesamtspannung - FALSE; Alarm %i", u8_lAlarm);
-          }*/
-        }
-      }
-    }
-  }
-}
-
-
-void rules_Temperatur()
-{
-  uint8_t sensorVon, sensorBis, alarmNr;
-  bool bo_lAlarm;
-
-  for(uint8_t i=0;i<COUNT_TEMP_RULES;i++)
-  {
-    bo_lAlarm = false;
-    sensorVon = WebSettings::getInt(ID_PARAM_TEMP_ALARM_SENSOR_VON,i,DT_ID_PARAM_TEMP_ALARM_SENSOR_VON);
-    sensorBis = WebSettings::getInt(ID_PARAM_TEMP_ALARM_SENSOR_BIS,i,DT_ID_PARAM_TEMP_ALARM_SENSOR_BIS);
-
-    if(sensorVon>=0 && sensorBis>=0 && sensorBis>=sensorVon)
-    {
-      switch (WebSettings::getInt(ID_PARAM_TEMP_ALARM_UEBERWACH_FUNKTION,i,DT_ID_PARAM_TEMP_ALARM_UEBERWACH_FUNKTION))
-      {
-        case ID_TEMP_ALARM_FUNKTION_NB:
-          break;
-
-        case ID_TEMP_ALARM_FUNKTION_MAXWERT:
-          if(temperatur_maxWertUeberwachung(i)){bo_lAlarm=true;}
-          break;
-
-        case ID_TEMP_ALARM_FUNKTION_MAXWERT_REFERENZ:
-          if(temperatur_maxWertUeberwachungReferenz(i)){bo_lAlarm=true;}
-          break;
-
-        case ID_TEMP_ALARM_FUNKTION_DIFFERENZ:
-          if(temperatur_DifferenzUeberwachung(i)){bo_lAlarm=true;}
-          break;
-
-        default:
-          break;
-      }
-
-      alarmNr=WebSettings::getInt(ID_PARAM_TEMP_ALARM_AKTION,i,DT_ID_PARAM_TEMP_ALARM_AKTION);
-      setAlarm(alarmNr,bo_lAlarm,ALARM_CAUSE_TEMPERATUR);
-      //BSC_LOGD(TAG,"Alarm BMS Temperatur - %i; Alarm %i",bo_lAlarm,alarmNr);
-    }
-  }
-
-  temperatur_senorsErrors();
-}
-
-
 void rules_CanInverter()
 {
   //Ladeleistung bei Alarm auf 0 Regeln
@@ -750,150 +568,6 @@ void rules_CanInverter()
   else canSetSocToFull(false);
 }
 
-uint16_t u16_mMerkerTemperaturTrigger=0;
-void setMerker(uint8_t merkerNr, bool val)
-{
-  if(val) u16_mMerkerTemperaturTrigger |= (1<<merkerNr);
-  else u16_mMerkerTemperaturTrigger &= ~(1<<merkerNr); //bit loeschen
-}
-
-bool isMerker(uint8_t merkerNr)
-{
-  if((u16_mMerkerTemperaturTrigger>>merkerNr)&0x01) return true;
-  else return false;
-}
-
-/*
- * Hohlt die Temperaturen von der entsprechenden Quelle (BMS, onewire) für die Alarmrules
- */
-float getTemp_TempAlarmrule(uint8_t u8_ruleNr, uint8_t u8_sensorNr)
-{
-  uint8_t u8_lRuleTempQuelle=WebSettings::getInt(ID_PARAM_TEMP_ALARM_TEMP_QUELLE,u8_ruleNr,DT_ID_PARAM_TEMP_ALARM_TEMP_QUELLE);
-
-  if(u8_lRuleTempQuelle==1) //BMS
-  {
-    uint8_t u8_lRuleBmsQuelle=WebSettings::getInt(ID_PARAM_TEMP_ALARM_BMS_QUELLE,u8_ruleNr,DT_ID_PARAM_TEMP_ALARM_BMS_QUELLE);
-    return getBmsTempature(u8_lRuleBmsQuelle,u8_sensorNr);
-  }
-  else if(u8_lRuleTempQuelle==2) //Onewire
-  {
-    return owGetTemp(u8_sensorNr);
-  }
-
-  BSC_LOGE(TAG,"Error while reading the temperatures for the alarm rules");
-  return 0; //Fehler
-}
-
-bool temperatur_maxWertUeberwachung(uint8_t i)
-{
-  bool bo_lHystMerker=true;
-  float maxTemp = WebSettings::getFloat(ID_PARAM_TEMP_ALARM_WERT1,i);
-  float hysterese = WebSettings::getFloat(ID_PARAM_TEMP_ALARM_WERT2,i);
-
-  if(maxTemp<=0) return false; //Wenn keine Max.Temp. angegeben ist
-
-  for(uint8_t n=WebSettings::getInt(ID_PARAM_TEMP_ALARM_SENSOR_VON,i,DT_ID_PARAM_TEMP_ALARM_SENSOR_VON);n<WebSettings::getInt(ID_PARAM_TEMP_ALARM_SENSOR_BIS,i,DT_ID_PARAM_TEMP_ALARM_SENSOR_BIS)+1;n++)
-  {
-    if(getTemp_TempAlarmrule(i,n)>maxTemp && getTemp_TempAlarmrule(i,n)!=TEMP_IF_SENSOR_READ_ERROR)
-    {
-      setMerker(i,true);
-      return true;
-    }
-    else if(isMerker(i) && getTemp_TempAlarmrule(i,n)>maxTemp-hysterese && getTemp_TempAlarmrule(i,n)!=TEMP_IF_SENSOR_READ_ERROR)
-    {
-      bo_lHystMerker=false;
-    }
-  }
-
-  if(bo_lHystMerker)
-  {
-    setMerker(i,false); //Merker löschen, wenn alle Werte kleiner der Hysterese Waren
-    return false;
-  }
-  else return true;
-}
-
-
-bool temperatur_maxWertUeberwachungReferenz(uint8_t i)
-{
-  bool bo_lHystMerker=true;
-  float aktTemp = 0;
-  float tempOffset = WebSettings::getFloat(ID_PARAM_TEMP_ALARM_WERT1,i);
-  float hysterese = WebSettings::getFloat(ID_PARAM_TEMP_ALARM_WERT2,i);
-
-  aktTemp = tempOffset + getTemp_TempAlarmrule(i,WebSettings::getInt(ID_PARAM_TEMP_ALARM_SENSOR_VERGLEICH,i,DT_ID_PARAM_TEMP_ALARM_SENSOR_VERGLEICH));
-  for(uint8_t n=WebSettings::getInt(ID_PARAM_TEMP_ALARM_SENSOR_VON,i,DT_ID_PARAM_TEMP_ALARM_SENSOR_VON);n<WebSettings::getInt(ID_PARAM_TEMP_ALARM_SENSOR_BIS,i,DT_ID_PARAM_TEMP_ALARM_SENSOR_BIS)+1;n++)
-  {
-    if(getTemp_TempAlarmrule(i,n)>aktTemp && getTemp_TempAlarmrule(i,n)!=TEMP_IF_SENSOR_READ_ERROR)
-    {
-      setMerker(i,true);
-      return true;
-    }
-    else if(isMerker(i) && getTemp_TempAlarmrule(i,n)>aktTemp-hysterese && getTemp_TempAlarmrule(i,n)!=TEMP_IF_SENSOR_READ_ERROR)
-    {
-      bo_lHystMerker=false;
-    }
-  }
-
-  if(bo_lHystMerker)
-  {
-    setMerker(i,false); //Merker löschen, wenn alle Werte kleiner der Hysterese Waren
-    return false;
-  }
-  else return true;
-}
-
-
-bool temperatur_DifferenzUeberwachung(uint8_t i)
-{
-  bool bo_lHystMerker=true;
-  float f_lTempMin = 0xFF;
-  float f_lTempMax = 0;
-
-  float f_lMaxTempDiff = WebSettings::getFloat(ID_PARAM_TEMP_ALARM_WERT1,i);
-  float hysterese = WebSettings::getFloat(ID_PARAM_TEMP_ALARM_WERT2,i);
-
-  for(uint8_t n=WebSettings::getInt(ID_PARAM_TEMP_ALARM_SENSOR_VON,i,DT_ID_PARAM_TEMP_ALARM_SENSOR_VON);n<WebSettings::getInt(ID_PARAM_TEMP_ALARM_SENSOR_BIS,i,DT_ID_PARAM_TEMP_ALARM_SENSOR_BIS)+1;n++)
-  {
-    if(getTemp_TempAlarmrule(i,n)>f_lTempMax) f_lTempMax=getTemp_TempAlarmrule(i,n);
-    if(getTemp_TempAlarmrule(i,n)<f_lTempMin) f_lTempMin=getTemp_TempAlarmrule(i,n);
-  }
-
-  if(f_lTempMax-f_lTempMin>=f_lMaxTempDiff)
-  {
-    setMerker(i,true);
-    return true;
-  }
-  else if(isMerker(i) && f_lTempMax-f_lTempMin>=f_lMaxTempDiff-hysterese)
-  {
-    bo_lHystMerker=false;
-  }
-
-  if(bo_lHystMerker)
-  {
-    setMerker(i,false); //Merker löschen, wenn alle Werte kleiner der Hysterese Waren
-    return false;
-  }
-  else return true;
-}
-
-
-void temperatur_senorsErrors()
-{
-  boolean bo_lAlarm = false;
-  uint8_t u8_lOwTempSensorErrors = owGetAllSensorError();
-
-  uint8_t u8_lSensorNoValueTime = WebSettings::getInt(ID_PARAM_TEMP_SENSOR_TIMEOUT_TIME,0,DT_ID_PARAM_TEMP_SENSOR_TIMEOUT_TIME); //Time in secounds
-  uint8_t u8_lTrigger = WebSettings::getInt(ID_PARAM_TEMP_SENSOR_TIMEOUT_TRIGGER,0,DT_ID_PARAM_TEMP_SENSOR_TIMEOUT_TRIGGER);
-
-  if(u8_lTrigger>0) //If enabled
-  {
-    if(u8_lOwTempSensorErrors>u8_lSensorNoValueTime) bo_lAlarm=true;
-    setAlarm(u8_lTrigger,bo_lAlarm,ALARM_CAUSE_OW_SENSOR_ERR);
-  }
-}
-
-
 //Alarm an BT Device weiterleiten
 void setAlarmToBtDevices(uint8_t u8_AlarmNr, boolean bo_Alarm)
 {
@@ -905,85 +579,6 @@ void setAlarmToBtDevices(uint8_t u8_AlarmNr, boolean bo_Alarm)
 }
 
 
-void rules_PlausibilityCeck()
-{
-  uint8_t u8_lTriggerPlausibilityCeckCellVoltage = WebSettings::getInt(ID_PARAM_BMS_PLAUSIBILITY_CHECK_CELLVOLTAGE,0,DT_ID_PARAM_BMS_PLAUSIBILITY_CHECK_CELLVOLTAGE);
-  if(u8_lTriggerPlausibilityCeckCellVoltage>0)
-  {
-    for(uint8_t i=BT_DEVICES_COUNT;i<BT_DEVICES_COUNT+SERIAL_BMS_DEVICES_COUNT;i++)
-    {
-      uint8_t u8_lCrcErrorCounter = getBmsLastChangeCellVoltageCrc(i);
-      if(u8_lCrcErrorCounter>CYCLES_BMS_VALUES_PLAUSIBILITY_CHECK) //Wenn sich der Wert x Zyklen nicht mehr geändert hat
-      {
-        setAlarm(u8_lTriggerPlausibilityCeckCellVoltage,true,ALARM_CAUSE_CELL_VOLTAGE_PLAUSIBILITY); //Trigger setzen
-      }
-      else
-      {
-        setAlarm(u8_lTriggerPlausibilityCeckCellVoltage,false,ALARM_CAUSE_CELL_VOLTAGE_PLAUSIBILITY); //Trigger zurücksetzen
-      }
-    }
-  }
-}
-
-
-//
-void rules_soc()
-{
-  inverterDataSemaphoreTake();
-  inverterData_s *inverterData = getInverterData();
-  inverterDataSemaphoreGive();
-
-  if(inverterData->noBatteryPackOnline==true) //Wenn kein Batterypack online ist, dann zurück
-  {
-    u8_merkerHysterese_TriggerAtSoc=0;
-    return;
-  }
-
-  uint8_t u8_lTriggerAtSocTriggerNr=0;
-  uint8_t u8_lTriggerAtSoc_SocOn=0;
-  uint8_t u8_lTriggerAtSoc_SocOff=0;
-  for(uint8_t ruleNr=0;ruleNr<ANZAHL_RULES_TRIGGER_SOC;ruleNr++)
-  {
-    u8_lTriggerAtSocTriggerNr = WebSettings::getInt(ID_PARAM_TRIGGER_AT_SOC,ruleNr,DT_ID_PARAM_TRIGGER_AT_SOC);
-    //BSC_LOGI(TAG,"ruleNr=%i, trigger=%i",ruleNr,u8_lTriggerAtSocTriggerNr);
-    if(u8_lTriggerAtSocTriggerNr>0)
-    {
-      u8_lTriggerAtSoc_SocOn = WebSettings::getInt(ID_PARAM_TRIGGER_AT_SOC_ON,ruleNr,DT_ID_PARAM_TRIGGER_AT_SOC_ON);
-      u8_lTriggerAtSoc_SocOff = WebSettings::getInt(ID_PARAM_TRIGGER_AT_SOC_OFF,ruleNr,DT_ID_PARAM_TRIGGER_AT_SOC_OFF);
-      //BSC_LOGI(TAG,"ruleNr=%i, socOn=%i, socOff=%i, hyst=%i",ruleNr, u8_lTriggerAtSoc_SocOn,u8_lTriggerAtSoc_SocOff,u8_merkerHysterese_TriggerAtSoc);
-
-      if(u8_lTriggerAtSoc_SocOn>u8_lTriggerAtSoc_SocOff)
-      {
-        if((inverterData->inverterSoc>=u8_lTriggerAtSoc_SocOn || isBitSet(u8_merkerHysterese_TriggerAtSoc,ruleNr)==1) && inverterData->inverterSoc>u8_lTriggerAtSoc_SocOff)
-        {
-          bitSet(u8_merkerHysterese_TriggerAtSoc,ruleNr);
-          setAlarm(u8_lTriggerAtSocTriggerNr,true,ALARM_CAUSE_SOC); //Trigger setzen
-        }
-        else if(inverterData->inverterSoc<=u8_lTriggerAtSoc_SocOff && isBitSet(u8_merkerHysterese_TriggerAtSoc,ruleNr)==1)
-        {
-          bitClear(u8_merkerHysterese_TriggerAtSoc,ruleNr);
-          setAlarm(u8_lTriggerAtSocTriggerNr,false,ALARM_CAUSE_SOC); //Trigger zurücksetzen
-        }
-      }
-      else if(u8_lTriggerAtSoc_SocOff>u8_lTriggerAtSoc_SocOn)
-      {
-        if((inverterData->inverterSoc<=u8_lTriggerAtSoc_SocOn || isBitSet(u8_merkerHysterese_TriggerAtSoc,ruleNr)==1) && inverterData->inverterSoc<u8_lTriggerAtSoc_SocOff)
-        {
-          bitSet(u8_merkerHysterese_TriggerAtSoc,ruleNr);
-          setAlarm(u8_lTriggerAtSocTriggerNr,true,ALARM_CAUSE_SOC); //Trigger setzen
-        }
-        else if(inverterData->inverterSoc>=u8_lTriggerAtSoc_SocOff && isBitSet(u8_merkerHysterese_TriggerAtSoc,ruleNr)==1)
-        {
-          bitClear(u8_merkerHysterese_TriggerAtSoc,ruleNr);
-          setAlarm(u8_lTriggerAtSocTriggerNr,false,ALARM_CAUSE_SOC); //Trigger zurücksetzen
-        }
-      }
-      // else -> Error
-    }
-  }
-
-}
-
 //
 void rules_vTrigger()
 {
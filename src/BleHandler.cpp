@@ -10,6 +10,8 @@
 #include "devices/JkBmsBt.h"
 #include "devices/NeeyBalancer.h"
 #include "AlarmRules.h"
+#include "BleConnectionTable.hpp"
+#include "SettingsView.h"
 
 
 static const char *TAG = "BLE_HANDLER";
@@ -17,6 +19,23 @@ static const char *TAG = "BLE_HANDLER";
 bool bleNeeyBalancerConnect(uint8_t deviceNr);
 
 static bleDevice bleDevices[BT_DEVICES_COUNT];
+
+// Zuordnung Connection-Handle -> Device und Statistik der Notifications.
+// onConnect/onDisconnect laufen im BLE Task, die Notify-Callbacks im NimBLE Host Task; beide greifen auf die
+// Tabelle zu. Geschützt durch mBleStatisticsMutex (BleHandler::init() leert sie, bevor die Tasks laufen).
+static ble::ConnectionTable<BT_DEVICES_COUNT> bleConnections;
+static ble::NotifyMonitor bleNotifyMonitor[BT_DEVICES_COUNT];
+static SemaphoreHandle_t mBleStatisticsMutex = NULL;
+
+// Kommunikationsstatistik (siehe CommStats.hpp). Die Geräte senden von sich aus; die Antwortzeit ist der Abstand
+// zwischen zwei Datenframes. Geschützt durch mBleStatisticsMutex.
+#define BLE_COMM_TIMEOUT_US 5000000
+static commstats::Recorder bleCommStatistics[BT_DEVICES_COUNT];
+
+// Die JK-BMS senden die Zellinfos von sich aus. Ausgewertet wird eine Zellinfo nur, wenn das Gerät laut
+// Pollintervall fällig ist (siehe PollScheduler.hpp), die anderen werden verworfen. Geschützt durch mBleStatisticsMutex.
+static pollscheduler::Scheduler<BT_DEVICES_COUNT> blePollScheduler;
+static bool bo_mSkipCellInfo[BT_DEVICES_COUNT];
 NimBLEScan* pBLEScan;
 NimBLEAdvertisedDevice* advDevice;
 uint8_t u8_mAdvDeviceNumber;
@@ -69,7 +88,12 @@ class ClientCallbacks : public NimBLEClientCallbacks
         bleDevices[i].balancerOn=e_BalancerWaitForCmd;
         bleDevices[i].isConnect = true;
         bleDevices[i].doConnect = btDoConnectionWaitStart;
-        setBmsLastDataMillis(i,millis());
+        bmsDataUpdateComplete(i,millis());
+
+        xSemaphoreTake(mBleStatisticsMutex, portMAX_DELAY);
+        bleConnections.add(pClient->getConnId(), i);
+        bleNotifyMonitor[i].connected(millis());
+        xSemaphoreGive(mBleStatisticsMutex);
       }
     }
 
@@ -92,6 +116,11 @@ class ClientCallbacks : public NimBLEClientCallbacks
         bleDevices[i].doConnect = btDoConnectionIdle;
         bleDevices[i].deviceTyp = ID_BT_DEVICE_NB;
         bleDevices[i].macAdr = "";
+
+        xSemaphoreTake(mBleStatisticsMutex, portMAX_DELAY);
+        bleConnections.removeDevice(i);
+        bleNotifyMonitor[i].disconnected();
+        xSemaphoreGive(mBleStatisticsMutex);
       }
     }
   }
@@ -170,54 +199,121 @@ class MyAdvertisedDeviceCallbacks: public NimBLEAdvertisedDeviceCallbacks
 
 
 
-// Notification / Indication receiving handler callback
-void notifyCB_NEEY(NimBLERemoteCharacteristic* pRemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify)
+//Liefert das Device zur Verbindung der Notification; NO_DEVICE, wenn die Verbindung keinem Device zugeordnet ist
+static uint8_t getNotifyDevNr(NimBLERemoteCharacteristic* pRemoteCharacteristic)
 {
-  std::string notifyMacAdr = pRemoteCharacteristic->getRemoteService()->getClient()->getPeerAddress().toString();
-  //BSC_LOGI(TAG,"neey_cb mac=%s, len=%i",notifyMacAdr.c_str(),length);
+  uint16_t u16_lConnId=pRemoteCharacteristic->getRemoteService()->getClient()->getConnId();
+  xSemaphoreTake(mBleStatisticsMutex, portMAX_DELAY);
+  uint8_t u8_lDevNr=bleConnections.find(u16_lConnId);
+  xSemaphoreGive(mBleStatisticsMutex);
+  return u8_lDevNr;
+}
 
-  for(uint8_t i=0;i<BT_DEVICES_COUNT;i++)
+static void countNotify(uint8_t devNr, size_t length, bool bo_reassemblyError)
+{
+  xSemaphoreTake(mBleStatisticsMutex, portMAX_DELAY);
+  bleNotifyMonitor[devNr].notify(millis(), length);
+  if(bo_reassemblyError)
   {
-    if(bleDevices[i].macAdr.equals(notifyMacAdr.c_str()))
-    {
-      //Daten kopieren
-      NeeyBalancer::neeyBalancerCopyData(i, pData, length);
-    }
+    bleNotifyMonitor[devNr].reassemblyError();
+    bleCommStatistics[devNr].resync();
   }
+  xSemaphoreGive(mBleStatisticsMutex);
 }
 
-//String temp="";
-void notifyCB_JKBMS(NimBLERemoteCharacteristic* pRemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify)
+//Ein vollständiger Datenframe (bzw. der Anfang davon) wurde empfangen
+static void countDataFrame(uint8_t devNr)
+{
+  xSemaphoreTake(mBleStatisticsMutex, portMAX_DELAY);
+  bleCommStatistics[devNr].received(micros(), BLE_COMM_TIMEOUT_US);
+  xSemaphoreGive(mBleStatisticsMutex);
+}
+
+//Anfrage an das Gerät gesendet
+static void countRequest(uint8_t devNr)
 {
-  std::string notifyMacAdr = pRemoteCharacteristic->getRemoteService()->getClient()->getPeerAddress().toString();
+  xSemaphoreTake(mBleStatisticsMutex, portMAX_DELAY);
+  bleCommStatistics[devNr].request();
+  xSemaphoreGive(mBleStatisticsMutex);
+}
 
-  for(uint8_t i=0;i<BT_DEVICES_COUNT;i++)
+/* Ist die Zellinfo des Geräts fällig? Die Werte der letzten ausgewerteten Zellinfo passen das Pollintervall an. */
+static bool pollCellInfo(uint8_t devNr)
+{
+  uint32_t u32_lNowMillis=millis();
+  xSemaphoreTake(mBleStatisticsMutex, portMAX_DELAY);
+  //Noch nicht im Scheduler (gerade verbunden): jede Zellinfo auswerten
+  bool bo_lDue=blePollScheduler.intervalMs(devNr)==0 || blePollScheduler.due(devNr, u32_lNowMillis);
+  if(bo_lDue && getBmsLastDataMillis(devNr)>0)
   {
-    if(bleDevices[i].macAdr.equals(notifyMacAdr.c_str()))
-    {
-      //BSC_LOGI(TAG,"JKBMS RX len=%i", length);
+    BmsDataSnapshot lSnapshot;
+    getBmsDataSnapshot(devNr, lSnapshot);
+    blePollScheduler.polled(devNr, u32_lNowMillis, 0, true,
+      pollscheduler::Sample {lSnapshot.totalCurrent, lSnapshot.minCellVoltage, lSnapshot.maxCellVoltage});
+  }
+  xSemaphoreGive(mBleStatisticsMutex);
+  return bo_lDue;
+}
 
-      /*for(uint16_t i=0; i<length; i++)
-      {
-        temp += pData[i];
-        temp+=" ";
-      }
-      BSC_LOGI(TAG,"JKBMS RX data=%s", temp.c_str());
-      temp="";*/
+// Notification / Indication receiving handler callback
+void notifyCB_NEEY(NimBLERemoteCharacteristic* pRemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify)
+{
+  uint8_t u8_lDevNr = getNotifyDevNr(pRemoteCharacteristic);
+  //BSC_LOGI(TAG,"neey_cb dev=%i, len=%i",u8_lDevNr,length);
+  if(u8_lDevNr==ble::NO_DEVICE) return;
+
+  //Daten kopieren
+  NeeyBalancer::neeyBalancerCopyData(u8_lDevNr, pData, length);
+  countNotify(u8_lDevNr, length, false);
+  countDataFrame(u8_lDevNr);
+}
 
-      uint8_t u8_frameVersion=FRAME_VERSION_JK02;
-      switch(bleDevices[i].deviceTyp)
-      {
-        case ID_BT_DEVICE_JKBMS_JK02_32S:
-          u8_frameVersion=FRAME_VERSION_JK02_32S;
-          break;
-      }
+//String temp="";
+void notifyCB_JKBMS(NimBLERemoteCharacteristic* pRemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify)
+{
+  uint8_t u8_lDevNr = getNotifyDevNr(pRemoteCharacteristic);
+  if(u8_lDevNr==ble::NO_DEVICE) return;
+
+  //BSC_LOGI(TAG,"JKBMS RX len=%i", length);
 
-      jkBmsBtCopyData(i, u8_frameVersion, pData, length);
+  /*for(uint16_t i=0; i<length; i++)
+  {
+    temp += pData[i];
+    temp+=" ";
+  }
+  BSC_LOGI(TAG,"JKBMS RX data=%s", temp.c_str());
+  temp="";*/
 
-      bleDevices[i].sendDataStep=0;
+  //Zellinfo nur im Pollintervall auswerten; die Folgeframes gehören zur gleichen Zellinfo.
+  //Jeder andere Frametyp (0x01 Settings, 0x03 Device-Info) beendet eine verworfene Zellinfo.
+  if(length>=5 && pData[0]==0x55 && pData[1]==0xAA && pData[2]==0xEB && pData[3]==0x90)
+  {
+    if(pData[4]==0x02)
+    {
+      countDataFrame(u8_lDevNr);
+      bo_mSkipCellInfo[u8_lDevNr]=!pollCellInfo(u8_lDevNr);
     }
+    else bo_mSkipCellInfo[u8_lDevNr]=false;
   }
+  if(bo_mSkipCellInfo[u8_lDevNr])
+  {
+    countNotify(u8_lDevNr, length, false);
+    bleDevices[u8_lDevNr].sendDataStep=0;
+    return;
+  }
+
+  uint8_t u8_frameVersion=FRAME_VERSION_JK02;
+  switch(bleDevices[u8_lDevNr].deviceTyp)
+  {
+    case ID_BT_DEVICE_JKBMS_JK02_32S:
+      u8_frameVersion=FRAME_VERSION_JK02_32S;
+      break;
+  }
+
+  bool bo_lFrameOk = jkBmsBtCopyData(u8_lDevNr, u8_frameVersion, pData, length);
+  countNotify(u8_lDevNr, length, !bo_lFrameOk);
+
+  bleDevices[u8_lDevNr].sendDataStep=0;
 }
 
 
@@ -485,13 +581,15 @@ void BleHandler::init()
   bo_mBtNotAllDeviceConnectedOrScanRunning=false;
   u8_mSendDataToNeey=0;
 
+  if(mBleStatisticsMutex==NULL) mBleStatisticsMutex = xSemaphoreCreateMutex();
+  bleConnections.clear();
+
   for(uint8_t i=0;i<BT_DEVICES_COUNT;i++)
   {
     bleDevices[i].doConnect = btDoConnectionIdle;
     bleDevices[i].isConnect = false;
     bleDevices[i].macAdr = "";
     bleDevices[i].deviceTyp = ID_BT_DEVICE_NB;
-    setBmsLastDataMillis(i,0);
     bleDevices[i].sendDataStep=0;
     bleDevices[i].balancerOn=e_BalancerWaitForCmd;
 
@@ -499,7 +597,7 @@ void BleHandler::init()
     {
       setBmsCellVoltage(i,n,0);
     }
-
+    bmsDataUpdateComplete(i,0);
   }
 
   NimBLEDevice::init("");
@@ -584,6 +682,20 @@ void BleHandler::run()
   //Devices trennen wenn notwendig
   handleDisconnectionToDevices();
 
+  //Pollintervall der verbundenen JK-BMS
+  SettingsViewRef lView;
+  pollscheduler::Config lPollConfig;
+  lPollConfig.minIntervalMs = lView->bmsPollIntervalMin;
+  lPollConfig.maxIntervalMs = lView->bmsPollIntervalMax;
+  xSemaphoreTake(mBleStatisticsMutex, portMAX_DELAY);
+  blePollScheduler.setConfig(lPollConfig);
+  for(uint8_t i=0;i<BT_DEVICES_COUNT;i++)
+  {
+    blePollScheduler.enable(i, bleDevices[i].isConnect && (bleDevices[i].deviceTyp==ID_BT_DEVICE_JKBMS_JK02 ||
+      bleDevices[i].deviceTyp==ID_BT_DEVICE_JKBMS_JK02_32S));
+  }
+  xSemaphoreGive(mBleStatisticsMutex);
+
   //Überprüfe ob Devices verbunden werden müssen
   boolean bo_lDoStartBtScan=handleConnectionToDevices();
 
@@ -724,6 +836,7 @@ bool BleHandler::handleConnectionToDevices()
             case ID_BT_DEVICE_NEEY4A:
               BSC_LOGD(TAG,"BT write dev=%i",i);
               bleDevices[i].pChr->writeValue(NeeyBalancer_getInfo, 20);
+              countRequest(i);
               bleDevices[i].doConnect = btDoConnectionIdle;
               bleDevices[i].sendDataStep = 0;
               break;
@@ -734,6 +847,7 @@ bool BleHandler::handleConnectionToDevices()
               uint8_t frame[20];
               jkBmsBtBuildSendFrame(frame, JKBMS_BT_COMMAND_DEVICE_INFO, 0x00000000, 0x00);
               bleDevices[i].pChr->writeValue(frame, 20);
+              countRequest(i);
 
               bleDevices[i].doConnect = btDoConnectionIdle;
               break;
@@ -750,6 +864,7 @@ bool BleHandler::handleConnectionToDevices()
                 case 0:
                   bleDevices[i].sendDataStep++;
                   NeeyBalancer::neeyWriteMsg2(bleDevices[i].pChr);
+                  countRequest(i);
                   break;
                 case 1:
                   if(u8_mSendDataToNeey>0)
@@ -813,6 +928,7 @@ bool BleHandler::handleConnectionToDevices()
               uint8_t frame[20];
               jkBmsBtBuildSendFrame(frame, JKBMS_BT_COMMAND_CELL_INFO, 0x00000000, 0x00);
               bleDevices[i].pChr->writeValue(frame, 20);
+              countRequest(i);
 
               bleDevices[i].sendDataStep=0;
               }
@@ -916,3 +1032,37 @@ uint8_t BleHandler::bmsIsConnect(uint8_t devNr)
   }
   return 0;
 }
+
+
+void BleHandler::getStatistics(uint8_t devNr, ble::NotifyStatistics &stats)
+{
+  if(mBleStatisticsMutex==NULL || devNr>=BT_DEVICES_COUNT)
+  {
+    memset(&stats, 0, sizeof(stats));
+    return;
+  }
+  xSemaphoreTake(mBleStatisticsMutex, portMAX_DELAY);
+  stats = bleNotifyMonitor[devNr].statistics(millis());
+  xSemaphoreGive(mBleStatisticsMutex);
+}
+
+void BleHandler::getCommStatistics(uint8_t devNr, commstats::Statistics &stats)
+{
+  if(mBleStatisticsMutex==NULL || devNr>=BT_DEVICES_COUNT)
+  {
+    stats = commstats::Statistics {};
+    return;
+  }
+  xSemaphoreTake(mBleStatisticsMutex, portMAX_DELAY);
+  stats = bleCommStatistics[devNr].statistics();
+  xSemaphoreGive(mBleStatisticsMutex);
+}
+
+pollscheduler::DeviceStatistics BleHandler::getPollStatistics(uint8_t devNr)
+{
+  if(mBleStatisticsMutex==NULL || devNr>=BT_DEVICES_COUNT) return pollscheduler::DeviceStatistics {};
+  xSemaphoreTake(mBleStatisticsMutex, portMAX_DELAY);
+  pollscheduler::DeviceStatistics stats = blePollScheduler.statistics(devNr);
+  xSemaphoreGive(mBleStatisticsMutex);
+  return stats;
+}
@@ -7,15 +7,22 @@
 #include "BmsData.h"
 #include "BmsDataTypes.hpp"
 #include "WebSettings.h"
+#include <utils/SeqLock.hpp>
 
 static const char * TAG = "BMSDATA";
 
+// Number of lock-free read attempts before getBmsDataSnapshot() falls back to the mutex
+static constexpr std::size_t BMSDATA_SNAPSHOT_READ_RETRIES = 3;
+
 static SemaphoreHandle_t mBmsDataMutex = NULL;
 static SemaphoreHandle_t mBmsDataReadMutex = NULL;
 
 static struct bmsData_s bmsData;
 struct bmsFilterData_s bmsFilterData;
 
+// Consistent copies of the data of each BMS; written under mBmsDataMutex, read lock-free
+static utils::SeqLock<BmsDataSnapshot> bmsDataSnapshot[BMSDATA_NUMBER_ALLDEVICES];
+
 static uint8_t bmsSettingsReadback[BT_DEVICES_COUNT][32];
 
 static bool bo_SOC100CellvolHasBeenReached[BMSDATA_NUMBER_ALLDEVICES];
@@ -47,7 +54,7 @@ void bmsDataInit()
     {
       setBmsCellVoltage(i,n,0xFFFF);
     }
-    setBmsLastDataMillis(i,0);
+    bmsDataUpdateComplete(i,0);
     u8_mBmsFilterErrorCounter[i]=0;
   }
 
@@ -91,6 +98,68 @@ struct bmsData_s* getBmsData()
   return &bmsData;
 }
 
+
+/* Copies the data of one BMS into its snapshot.
+ * Must be called with taken mBmsDataMutex, which serializes the writers of the seqlock. */
+static void publishBmsDataSnapshot(uint8_t devNr)
+{
+  BmsDataSnapshot snapshot;
+  memcpy(snapshot.cellVoltage, bmsData.bmsCellVoltage[devNr], sizeof(snapshot.cellVoltage));
+  snapshot.totalVoltage = bmsData.bmsTotalVoltage[devNr];
+  snapshot.maxCellDifferenceVoltage = bmsData.bmsMaxCellDifferenceVoltage[devNr];
+  snapshot.avgVoltage = bmsData.bmsAvgVoltage[devNr];
+  snapshot.totalCurrent = bmsData.bmsTotalCurrent[devNr];
+  snapshot.maxCellVoltage = bmsData.bmsMaxCellVoltage[devNr];
+  snapshot.minCellVoltage = bmsData.bmsMinCellVoltage[devNr];
+  snapshot.maxVoltageCellNumber = bmsData.bmsMaxVoltageCellNumber[devNr];
+  snapshot.minVoltageCellNumber = bmsData.bmsMinVoltageCellNumber[devNr];
+  snapshot.isBalancingActive = bmsData.bmsIsBalancingActive[devNr];
+  snapshot.chargePercentage = bmsData.bmsChargePercentage[devNr];
+  snapshot.balancingCurrent = bmsData.bmsBalancingCurrent[devNr];
+  memcpy(snapshot.temperature, bmsData.bmsTempature[devNr], sizeof(snapshot.temperature));
+  snapshot.errors = bmsData.bmsErrors[devNr];
+  snapshot.stateFETs = bmsData.bmsStateFETs[devNr];
+  snapshot.lastDataMillis = bmsData.bmsLastDataMillis[devNr];
+  bmsDataSnapshot[devNr].write(snapshot);
+}
+
+/* Returns a consistent copy of all data of one BMS as it was when the BMS delivered its last complete data set.
+ * The copy is taken without blocking the writers. Only if a writer is active for too long (e.g. preempted by
+ * the reading task), the mutex is taken to wait for the end of the write. */
+void getBmsDataSnapshot(uint8_t devNr, BmsDataSnapshot &snapshot)
+{
+  if(bmsDataSnapshot[devNr].read(snapshot, BMSDATA_SNAPSHOT_READ_RETRIES)) return;
+
+  xSemaphoreTake(mBmsDataMutex, portMAX_DELAY);
+  bmsDataSnapshot[devNr].tryRead(snapshot); //No writer active while holding the mutex
+  xSemaphoreGive(mBmsDataMutex);
+}
+
+/* Sets all data of one BMS at once (e.g. received from a BSC slave) and publishes the snapshot.
+ * The filters of the single setters are not applied. */
+void setBmsDataSnapshot(uint8_t devNr, const BmsDataSnapshot &snapshot)
+{
+  xSemaphoreTake(mBmsDataMutex, portMAX_DELAY);
+  memcpy(bmsData.bmsCellVoltage[devNr], snapshot.cellVoltage, sizeof(snapshot.cellVoltage));
+  bmsData.bmsTotalVoltage[devNr] = snapshot.totalVoltage;
+  bmsData.bmsMaxCellDifferenceVoltage[devNr] = snapshot.maxCellDifferenceVoltage;
+  bmsData.bmsAvgVoltage[devNr] = snapshot.avgVoltage;
+  bmsData.bmsTotalCurrent[devNr] = snapshot.totalCurrent;
+  bmsData.bmsMaxCellVoltage[devNr] = snapshot.maxCellVoltage;
+  bmsData.bmsMinCellVoltage[devNr] = snapshot.minCellVoltage;
+  bmsData.bmsMaxVoltageCellNumber[devNr] = snapshot.maxVoltageCellNumber;
+  bmsData.bmsMinVoltageCellNumber[devNr] = snapshot.minVoltageCellNumber;
+  bmsData.bmsIsBalancingActive[devNr] = snapshot.isBalancingActive;
+  bmsData.bmsChargePercentage[devNr] = snapshot.chargePercentage;
+  bmsData.bmsBalancingCurrent[devNr] = snapshot.balancingCurrent;
+  memcpy(bmsData.bmsTempature[devNr], snapshot.temperature, sizeof(snapshot.temperature));
+  bmsData.bmsErrors[devNr] = snapshot.errors;
+  bmsData.bmsStateFETs[devNr] = snapshot.stateFETs;
+  bmsData.bmsLastDataMillis[devNr] = snapshot.lastDataMillis;
+  publishBmsDataSnapshot(devNr);
+  xSemaphoreGive(mBmsDataMutex);
+}
+
 uint16_t getBmsCellVoltage(uint8_t devNr, uint8_t cellNr)
 {
   xSemaphoreTake(mBmsDataMutex, portMAX_DELAY);
@@ -469,10 +538,14 @@ unsigned long getBmsLastDataMillis(uint8_t devNr)
   xSemaphoreGive(mBmsDataMutex);
   return ret;
 }
-void setBmsLastDataMillis(uint8_t devNr, unsigned long value)
+
+
+/* Der Zeitpunkt der letzten Daten wird immer zusammen mit dem Snapshot gesetzt (siehe auch setBmsDataSnapshot) */
+void bmsDataUpdateComplete(uint8_t devNr, unsigned long u32_lastDataMillis)
 {
   xSemaphoreTake(mBmsDataMutex, portMAX_DELAY);
-  bmsData.bmsLastDataMillis[devNr] = value;
+  bmsData.bmsLastDataMillis[devNr] = u32_lastDataMillis;
+  publishBmsDataSnapshot(devNr);
   xSemaphoreGive(mBmsDataMutex);
 }
 
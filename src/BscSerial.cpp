@@ -12,6 +12,10 @@
 #include "dio.h"
 #include "i2c.h"
 #include "crc.h"
+#include "SerialRx.h"
+#include "SettingsView.h"
+#include "PollScheduler.hpp"
+#include "Canbus.h"
 
 //include Devices
 #include "devices/serialDevData.h"
@@ -30,7 +34,11 @@
 
 static const char *TAG = "BSC_SERIAL";
 
-uint32_t serialMqttSendeTimer;
+static uint32_t serialMqttSendeTimer[SERIAL_PORT_GROUP_COUNT];
+
+/* Pollintervall je Gerät, siehe PollScheduler.hpp. Die Geräte einer Gruppe teilen sich die Schnittstelle,
+ * daher hat jede Gruppe einen eigenen Scheduler. */
+static pollscheduler::Scheduler<SERIAL_BMS_DEVICES_COUNT> serialPollScheduler[SERIAL_PORT_GROUP_COUNT];
 
 struct serialDeviceData_s
 {
@@ -39,9 +47,18 @@ struct serialDeviceData_s
 
   uint32_t u32_baudrate;
   uint8_t u8_mFilterBmsCellVoltageMaxCount=0;
+  uint8_t u8_funktionsTyp=ID_SERIAL_DEVICE_NB;
+
+  uint32_t u32_lastPollMillis=0;
+  uint32_t u32_cycleTime=0;
 };
 struct serialDeviceData_s serialDeviceData[SERIAL_BMS_DEVICES_COUNT];
 
+/* Die Treiber halten ihren Zustand in statischen Variablen (Port, devNr, ...).
+ * Damit zwei Gruppen nicht gleichzeitig den gleichen Treiber nutzen, gibt es je Treiber ein Mutex. */
+#define SERIAL_DRIVER_COUNT (ID_SERIAL_DEVICE_GOBEL_PC200+1)
+static SemaphoreHandle_t serialDriverMutex[SERIAL_DRIVER_COUNT];
+
 void cbSetRxTxEn(uint8_t u8_devNr, uint8_t e_rw);
 
 #ifdef UTEST_BMS_FILTER
@@ -56,7 +73,13 @@ BscSerial::BscSerial()
 
 void BscSerial::initSerial()
 {
-  mSerialMutex = xSemaphoreCreateMutex();
+  serialRxInit();
+  for(uint8_t i=0;i<SERIAL_PORT_GROUP_COUNT;i++)
+  {
+    mSerialMutex[i] = xSemaphoreCreateMutex();
+    serialMqttSendeTimer[i]=millis();
+  }
+  for(uint8_t i=0;i<SERIAL_DRIVER_COUNT;i++) serialDriverMutex[i] = xSemaphoreCreateMutex();
 
   pinMode(SERIAL1_PIN_TX_EN, OUTPUT);  //HW serial0
   pinMode(SERIAL2_PIN_TX_EN, OUTPUT);  //HW serial1
@@ -77,20 +100,69 @@ void BscSerial::initSerial()
     BSC_LOGI(TAG, "initSerial SerialNr=%i, funktionsTyp=%i",i,funktionsTyp);
     setReadBmsFunktion(i, funktionsTyp);
   }
-
-  serialMqttSendeTimer=millis();
 }
 
 void BscSerial::stopCyclicRun(bool state)
 {
-  if(state==true)
+  for(uint8_t i=0;i<SERIAL_PORT_GROUP_COUNT;i++)
   {
-    xSemaphoreTake(mSerialMutex, portMAX_DELAY);
+    if(state==true) xSemaphoreTake(mSerialMutex[i], portMAX_DELAY);
+    else xSemaphoreGive(mSerialMutex[SERIAL_PORT_GROUP_COUNT-1-i]);
   }
-  else
+}
+
+
+uint8_t serialGetPortGroup(uint8_t u8_devNr)
+{
+  if(u8_devNr<2) return u8_devNr;
+  return 2;
+}
+
+
+/* Zeit zwischen den letzten beiden Abfragen der Schnittstelle in ms (0 = noch nicht gemessen) */
+uint32_t serialGetCycleTime(uint8_t u8_devNr)
+{
+  if(u8_devNr>=SERIAL_BMS_DEVICES_COUNT) return 0;
+  return serialDeviceData[u8_devNr].u32_cycleTime;
+}
+
+
+/* Kommunikationsstatistik des Geräts. Das JK-BMS über CAN wird vom CAN-Task aufgezeichnet.
+ * Mehrere BMS an Serial 2 (Seplos, Sylcin, Gobel) teilen sich die Statistik von Serial 2; nur die Auslösungen
+ * der Plausibilitätsprüfung werden je BMS gezählt. */
+commstats::Source serialGetCommStatistics(uint8_t u8_devNr, commstats::Statistics &stats)
+{
+  if(u8_devNr<3 && SettingsViewRef()->serialConnectDevice[u8_devNr]==ID_SERIAL_DEVICE_JKBMS_CAN)
   {
-    xSemaphoreGive(mSerialMutex);
+    commstats::Statistics serialStats;
+    serialRxGetCommStatistics(u8_devNr, serialStats);
+    canGetBmsCommStatistics(stats);
+    stats.plausibilityTrips = serialStats.plausibilityTrips; //Die Plausibilitätsprüfung läuft im seriellen Task
+    return commstats::Source::CAN_BMS;
   }
+  serialRxGetCommStatistics(u8_devNr, stats);
+  return commstats::Source::SERIAL_BMS;
+}
+
+
+/* Pollintervall und Zustand des Geräts (intervalMs=0: Gerät wird nicht abgefragt) */
+pollscheduler::DeviceStatistics serialGetPollStatistics(uint8_t u8_devNr)
+{
+  if(u8_devNr>=SERIAL_BMS_DEVICES_COUNT) return pollscheduler::DeviceStatistics {};
+  return serialPollScheduler[serialGetPortGroup(u8_devNr)].statistics(u8_devNr);
+}
+
+/* Die Treiber warten in serialRxReadByte() auf das RX-Event der UART, statt den Port zyklisch abzufragen.
+ * Das Event kommt, wenn nach empfangenen Zeichen für SERIAL_RX_TIMEOUT_SYMBOLS Zeichenzeiten nichts mehr kommt
+ * oder der FIFO voll ist. onReceive() bleibt über end()/begin() erhalten.
+ * Nach end()/begin() sind auch die noch nicht gelesenen Daten im Puffer des Ports ungültig. */
+static void setRxEvent(HardwareSerial &serial)
+{
+  Stream *port = &serial;
+  serialRxRegisterPort(port, true);
+  serialRxClear(port);
+  serial.setRxTimeout(SERIAL_RX_TIMEOUT_SYMBOLS);
+  serial.onReceive([port](){ serialRxNotify(port); });
 }
 
 void BscSerial::setHwSerial(uint8_t u8_devNr, uint32_t baudrate)
@@ -102,24 +174,28 @@ void BscSerial::setHwSerial(uint8_t u8_devNr, uint32_t baudrate)
     Serial.end();
     Serial.begin(baudrate,SERIAL_8N1,SERIAL1_PIN_RX,SERIAL1_PIN_TX);
         serialDeviceData[u8_devNr].stream_mPort=&Serial;
+    setRxEvent(Serial);
   }
   else if(u8_devNr==1) // Hw Serial 2
   {
     Serial1.end();
     Serial1.begin(baudrate,SERIAL_8N1,SERIAL2_PIN_RX,SERIAL2_PIN_TX);
         serialDeviceData[u8_devNr].stream_mPort=&Serial1;
+    setRxEvent(Serial1);
   }
   else if(u8_devNr==2) // Hw Serial 0
   {
     Serial2.end();
     Serial2.begin(baudrate,SERIAL_8N1,SERIAL3_PIN_RX,SERIAL3_PIN_TX);
         serialDeviceData[u8_devNr].stream_mPort=&Serial2;
+    setRxEvent(Serial2);
   }
   else if(u8_devNr>2 && isSerialExtEnabled()) // Hw Serial 0
   {
     Serial2.end();
     Serial2.begin(baudrate,SERIAL_8N1,SERIAL3_PIN_RX,SERIAL3_PIN_TX);
         serialDeviceData[u8_devNr].stream_mPort=&Serial2;
+    setRxEvent(Serial2);
   }
 }
 
@@ -129,6 +205,7 @@ void BscSerial::setSoftSerial(uint8_t u8_devNr, uint32_t baudrate) // Sw Serial
   static SoftwareSerial mySwSerial(SERIAL3_PIN_RX,SERIAL3_PIN_TX,false);
   serialDeviceData[u8_devNr].stream_mPort = &mySwSerial;
   static_cast<SoftwareSerial*>(serialDeviceData[u8_devNr].stream_mPort)->begin(baudrate);
+  serialRxRegisterPort(&mySwSerial, false); //Kein RX-Event; wird abgefragt
 }
 
 
@@ -167,6 +244,9 @@ void BscSerial::setReadBmsFunktion(uint8_t u8_devNr, uint8_t funktionsTyp)
 
   //xSemaphoreTake(mSerialMutex, portMAX_DELAY);
 
+  if(funktionsTyp<SERIAL_DRIVER_COUNT) serialDeviceData[u8_devNr].u8_funktionsTyp = funktionsTyp;
+  else serialDeviceData[u8_devNr].u8_funktionsTyp = ID_SERIAL_DEVICE_NB;
+
   switch (funktionsTyp)
   {
     case ID_SERIAL_DEVICE_NB:
@@ -302,30 +382,42 @@ void cbSetRxTxEn(uint8_t u8_devNr, uint8_t e_rw)
 }
 
 
-void BscSerial::cyclicRun()
+uint32_t BscSerial::cyclicRun(uint8_t u8_portGroup)
 {
-  xSemaphoreTake(mSerialMutex, portMAX_DELAY);
+  if(u8_portGroup>=SERIAL_PORT_GROUP_COUNT) return 1000;
+
+  xSemaphoreTake(mSerialMutex[u8_portGroup], portMAX_DELAY);
+  pollscheduler::Scheduler<SERIAL_BMS_DEVICES_COUNT> &lScheduler = serialPollScheduler[u8_portGroup];
+  SettingsViewRef lView;
+  pollscheduler::Config lPollConfig;
+  lPollConfig.minIntervalMs = lView->bmsPollIntervalMin;
+  lPollConfig.maxIntervalMs = lView->bmsPollIntervalMax;
+  lScheduler.setConfig(lPollConfig);
+
   bool bo_lMqttSendMsg=false;
   uint8_t u8_lNumberOfSeplosBms = 0;
-  uint8_t u8_lBmsOnSerial2 = (uint8_t)WebSettings::getInt(ID_PARAM_SERIAL_CONNECT_DEVICE,2,DT_ID_PARAM_SERIAL_CONNECT_DEVICE);
+  uint8_t u8_lBmsOnSerial2 = lView->serialConnectDevice[2];
   if(isMultiple485bms(u8_lBmsOnSerial2))
   {
     if(isSerialExtEnabled()) u8_lNumberOfSeplosBms=0;
-    else u8_lNumberOfSeplosBms=WebSettings::getInt(ID_PARAM_SERIAL2_CONNECT_TO_ID,0,DT_ID_PARAM_SERIAL2_CONNECT_TO_ID);
+    else u8_lNumberOfSeplosBms=lView->serial2NumberOfBms;
   }
 
-  if((millis()-serialMqttSendeTimer)>60000)
+  if((millis()-serialMqttSendeTimer[u8_portGroup])>60000)
   {
-    serialMqttSendeTimer=millis();
+    serialMqttSendeTimer[u8_portGroup]=millis();
     bo_lMqttSendMsg=true;
   }
 
   for(uint8_t i=0;i<SERIAL_BMS_DEVICES_COUNT;i++)
   {
+    if(serialGetPortGroup(i)!=u8_portGroup) continue;
+
     if(serialDeviceData[i].readBms==0) //Wenn nicht Initialisiert
     {
       if(u8_lNumberOfSeplosBms==0 || i<2 || i>(u8_lNumberOfSeplosBms+1))
       {
+        lScheduler.enable(i,false);
         continue;
       }
     }
@@ -334,13 +426,22 @@ void BscSerial::cyclicRun()
     if(i>2 && !isSerialExtEnabled() && serialDeviceData[i].readBms!=0)
     {
       BSC_LOGE(TAG,"No serial extension but device ist set! serial=%i",i);
+      lScheduler.enable(i,false);
       continue;
     }
 
+    //Nur die fälligen Geräte abfragen
+    lScheduler.enable(i,true);
+    if(!lScheduler.due(i,millis())) continue;
+
     bool    bo_lBmsReadOk=false;
     uint8_t u8_lReason=1;
     uint8_t u8_serDeviceNr=i;
 
+    uint32_t u32_lPollMillis=millis();
+    if(serialDeviceData[i].u32_lastPollMillis>0) serialDeviceData[i].u32_cycleTime=u32_lPollMillis-serialDeviceData[i].u32_lastPollMillis;
+    serialDeviceData[i].u32_lastPollMillis=u32_lPollMillis;
+
     //Workaround: Notwendig damit der Transceiver nicht in einen komischen Zustand geht, indem er den RX "flattern" lässt.
     //Unklar wo das Verhalten herkommt.
     if(i>2 && isSerialExtEnabled())
@@ -392,7 +493,12 @@ void BscSerial::cyclicRun()
 
     //BSC_LOGI(TAG, "cyclicRun dev=%i, u8_BmsDataAdr=%i, u8_NumberOfDevices=%i, u8_deviceNr=%i", u8_serDeviceNr, devData.u8_BmsDataAdr,devData.u8_NumberOfDevices,devData.u8_deviceNr);
     if(serialDeviceData[u8_serDeviceNr].readBms!=NULL)
+    {
+      SemaphoreHandle_t lDriverMutex = serialDriverMutex[serialDeviceData[u8_serDeviceNr].u8_funktionsTyp];
+      xSemaphoreTake(lDriverMutex, portMAX_DELAY);
       bo_lBmsReadOk=serialDeviceData[u8_serDeviceNr].readBms(serialDeviceData[u8_serDeviceNr].stream_mPort, u8_serDeviceNr, &cbSetRxTxEn, &devData); //Wenn kein Fehler beim Holen der Daten vom BMS
+      xSemaphoreGive(lDriverMutex);
+    }
     else BSC_LOGE(TAG,"Error readBms nullptr, dev=%i",u8_serDeviceNr);
 
     if(devData.bo_writeData) free(lRwData);
@@ -424,7 +530,7 @@ void BscSerial::cyclicRun()
     //xSemaphoreGive(mSerialMutex);
     if(bo_lBmsReadOk)
     {
-      setBmsLastDataMillis(BT_DEVICES_COUNT+i,millis());
+      bmsDataUpdateComplete(BT_DEVICES_COUNT+i,millis());
     }
     else
     {
@@ -440,7 +546,7 @@ void BscSerial::cyclicRun()
      * Es wird über alle Cellspannungen eine CRC16 gebildet. Die CRC muss sich in gewissen Abständen ändern,
      * da nie alle Zellspannungen konstant sind. Es wird immer eine der Zellen um +/- ein mV schwanken.
     */
-    uint8_t u8_lTriggerPlausibilityCeckCellVoltage = WebSettings::getInt(ID_PARAM_BMS_PLAUSIBILITY_CHECK_CELLVOLTAGE,0,DT_ID_PARAM_BMS_PLAUSIBILITY_CHECK_CELLVOLTAGE);
+    uint8_t u8_lTriggerPlausibilityCeckCellVoltage = lView->plausibilityCheckCellVoltage;
     if(u8_lTriggerPlausibilityCeckCellVoltage>0)
     {
       bmsDataSemaphoreTake();
@@ -458,6 +564,7 @@ void BscSerial::cyclicRun()
           if(crcErrorCounter==CYCLES_BMS_VALUES_PLAUSIBILITY_CHECK)
           {
             BSC_LOGE(TAG,"ERROR: device=%i, No change in cell voltage",i);
+            serialRxRecordPlausibilityTrip(i);
             //Der entsprechende Trigger wird in den Alarmrules gesetzt
           }
         }
@@ -472,8 +579,16 @@ void BscSerial::cyclicRun()
       }
     }
 
+    //Pollintervall anhand der Änderung von Strom und Zellspannungen anpassen
+    BmsDataSnapshot lSnapshot;
+    getBmsDataSnapshot(BT_DEVICES_COUNT+i, lSnapshot);
+    uint32_t u32_lNowMillis=millis();
+    lScheduler.polled(i, u32_lNowMillis, u32_lNowMillis-u32_lPollMillis, bo_lBmsReadOk,
+      pollscheduler::Sample {lSnapshot.totalCurrent, lSnapshot.minCellVoltage, lSnapshot.maxCellVoltage});
   }
-  xSemaphoreGive(mSerialMutex);
+  uint32_t u32_lNextDueMs = lScheduler.nextDueMs(millis());
+  xSemaphoreGive(mSerialMutex[u8_portGroup]);
+  return u32_lNextDueMs;
 }
 
 
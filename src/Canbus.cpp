@@ -8,15 +8,18 @@
 #include "WebSettings.h"
 #include "defines.h"
 #include "BmsData.h"
+#include "SettingsView.h"
 #include "Ow.h"
 #include "mqtt_t.h"
 #include <ESP32TWAISingleton.hpp>
+#include <driver/twai.h>
 #include "log.h"
 #include "AlarmRules.h"
+#include "CanBmsData.hpp"
 
 static const char *TAG = "CAN";
 
-void readCanMessages();
+void readCanMessages(uint32_t u32_waitMs);
 void sendBmsCanMessages();
 void sendCanMsg_35e_370_371();
 void sendCanMsg_351();
@@ -36,6 +39,14 @@ void onCanReceive(int packetSize);
 static SemaphoreHandle_t mInverterDataMutex = NULL;
 static struct inverterData_s inverterData;
 
+static SemaphoreHandle_t mCanStatisticsMutex = NULL;
+static struct canStatistics_s canStatistics;
+static commstats::Recorder canBmsCommStatistics; // JK-BMS über CAN; geschützt durch mCanStatisticsMutex
+static bool bo_mCanInitialized = false;
+static uint8_t u8_mCanTxFrameGap = 0;
+
+#define CAN_TX_TIMEOUT_MS 100
+
 uint8_t u8_mMqttTxTimer=0;
 
 uint8_t u8_mBmsDatasource;
@@ -105,6 +116,9 @@ struct data373
 void canSetup()
 {
   mInverterDataMutex = xSemaphoreCreateMutex();
+  mCanStatisticsMutex = xSemaphoreCreateMutex();
+  memset(&canStatistics, 0, sizeof(canStatistics));
+  canBmsCommStatistics.reset();
 
   u8_mBmsDatasource=0;
   alarmSetChargeCurrentToZero=false;
@@ -117,8 +131,14 @@ void canSetup()
   loadCanSettings();
 
   constexpr bool CAN_ENABLE_ALERTS {true};
-  constexpr std::size_t CAN_RX_QUEUE_LENGTH {10};
-  constexpr std::size_t CAN_TX_QUEUE_LENGTH {10};
+  constexpr std::size_t CAN_QUEUE_LENGTH_DEFAULT {32};
+  std::size_t CAN_RX_QUEUE_LENGTH = WebSettings::getInt(ID_PARAM_BMS_CAN_RX_QUEUE_LENGTH,0,DT_ID_PARAM_BMS_CAN_RX_QUEUE_LENGTH);
+  std::size_t CAN_TX_QUEUE_LENGTH = WebSettings::getInt(ID_PARAM_BMS_CAN_TX_QUEUE_LENGTH,0,DT_ID_PARAM_BMS_CAN_TX_QUEUE_LENGTH);
+  if(CAN_RX_QUEUE_LENGTH==0) CAN_RX_QUEUE_LENGTH=CAN_QUEUE_LENGTH_DEFAULT;
+  if(CAN_TX_QUEUE_LENGTH==0) CAN_TX_QUEUE_LENGTH=CAN_QUEUE_LENGTH_DEFAULT;
+  canStatistics.rxQueueLength = CAN_RX_QUEUE_LENGTH;
+  canStatistics.txQueueLength = CAN_TX_QUEUE_LENGTH;
+
   const can::Baudrate baudrate = (u8_mSelCanInverter==ID_CAN_DEVICE_VICTRON_250K) ? can::Baudrate::BAUD_250KBPS :
                                                                                     can::Baudrate::BAUD_500KBPS;
   const esp_err_t err = CAN.begin(GPIO_NUM_5, // Rx pin
@@ -127,7 +147,34 @@ void canSetup()
                                   CAN_ENABLE_ALERTS,
                                   CAN_RX_QUEUE_LENGTH,
                                   CAN_TX_QUEUE_LENGTH);
-  BSC_LOGI(TAG, "%s", CAN.getErrorText(err).c_str());
+  BSC_LOGI(TAG, "%s, rxQueue=%i, txQueue=%i", CAN.getErrorText(err).c_str(), CAN_RX_QUEUE_LENGTH, CAN_TX_QUEUE_LENGTH);
+  bo_mCanInitialized = (err==ESP_OK);
+}
+
+void canGetStatistics(struct canStatistics_s &stats)
+{
+  if(mCanStatisticsMutex==NULL)
+  {
+    memset(&stats, 0, sizeof(stats));
+    return;
+  }
+  xSemaphoreTake(mCanStatisticsMutex, portMAX_DELAY);
+  stats = canStatistics;
+  xSemaphoreGive(mCanStatisticsMutex);
+}
+
+/* Kommunikationsstatistik des JK-BMS über CAN. Das BMS sendet von sich aus; die Antwortzeit ist der Abstand
+ * zwischen zwei Status-Frames (0x02F4), ein Abstand über CAN_BMS_COMMUNICATION_TIMEOUT zählt als Timeout. */
+void canGetBmsCommStatistics(commstats::Statistics &stats)
+{
+  if(mCanStatisticsMutex==NULL)
+  {
+    stats = commstats::Statistics {};
+    return;
+  }
+  xSemaphoreTake(mCanStatisticsMutex, portMAX_DELAY);
+  stats = canBmsCommStatistics.statistics();
+  xSemaphoreGive(mCanStatisticsMutex);
 }
 
 void inverterDataSemaphoreTake()
@@ -150,6 +197,7 @@ void loadCanSettings()
   inverterData.noBatteryPackOnline = true;
   u8_mBmsDatasource = WebSettings::getInt(ID_PARAM_BMS_CAN_DATASOURCE,0,DT_ID_PARAM_BMS_CAN_DATASOURCE);
   u8_mSelCanInverter = WebSettings::getInt(ID_PARAM_SS_CAN,0,DT_ID_PARAM_SS_CAN);
+  u8_mCanTxFrameGap = WebSettings::getInt(ID_PARAM_BMS_CAN_TX_FRAME_GAP,0,DT_ID_PARAM_BMS_CAN_TX_FRAME_GAP);
   uint8_t u8_lNumberOfSerial2BMSs = WebSettings::getInt(ID_PARAM_SERIAL2_CONNECT_TO_ID,0,DT_ID_PARAM_SERIAL2_CONNECT_TO_ID);
 
   uint32_t bmsConnectFilter=0;
@@ -204,10 +252,9 @@ uint16_t getAktualChargeCurrentSoll()
 //Wird vom Task aus der main.c zyklisch aufgerufen
 void canTxCyclicRun()
 {
-  if(WebSettings::getBool(ID_PARAM_BMS_CAN_ENABLE,0))
+  if(SettingsViewRef()->canEnable)
   {
     u8_mMqttTxTimer++;
-    readCanMessages();
     sendBmsCanMessages();
     if(u8_mMqttTxTimer>=15)u8_mMqttTxTimer=0;
   }
@@ -215,34 +262,57 @@ void canTxCyclicRun()
 }
 
 
-void readCanMessages()
+/* Wird vom RX-Task aus der main.c zyklisch aufgerufen.
+ * Wartet blockierend auf empfangene Frames, damit die Daten ohne Verzögerung in den BmsData landen. */
+void canRxCyclicRun()
+{
+  if(!bo_mCanInitialized || !SettingsViewRef()->canEnable)
+  {
+    vTaskDelay(pdMS_TO_TICKS(1000));
+    return;
+  }
+
+  readCanMessages(1000);
+}
+
+
+void readCanMessages(uint32_t u32_waitMs)
 {
   twai_message_t canMessage;
   twai_status_info_t canStatus;
 
+  // Warten bis ein Frame empfangen wurde
+  if(twai_receive(&canMessage, pdMS_TO_TICKS(u32_waitMs))!=ESP_OK) return;
+
   canStatus = CAN.getStatus();
+  xSemaphoreTake(mCanStatisticsMutex, portMAX_DELAY);
+  canStatistics.rxDropped = canStatus.rx_missed_count;
+  canStatistics.rxOverrun = canStatus.rx_overrun_count;
+  if(canStatus.msgs_to_rx+1>canStatistics.rxQueueHighWater) canStatistics.rxQueueHighWater=canStatus.msgs_to_rx+1;
+  xSemaphoreGive(mCanStatisticsMutex);
 
   // JK-BMS CAN
   bool isJkCanBms=false;
   uint8_t u8_jkCanBms;
+  SettingsViewRef settings;
   for(uint8_t i=0; i<3; i++)
   {
-    if(WebSettings::getInt(ID_PARAM_SERIAL_CONNECT_DEVICE,i,DT_ID_PARAM_SERIAL_CONNECT_DEVICE)==ID_SERIAL_DEVICE_JKBMS_CAN)
+    if(settings->serialConnectDevice[i]==ID_SERIAL_DEVICE_JKBMS_CAN)
     {
       isJkCanBms=true;
       u8_jkCanBms=BMSDATA_FIRST_DEV_SERIAL+i;
       //BSC_LOGI(TAG,"JK: dev=%i",u8_jkCanBms);
 
-      setBmsLastDataMillis(u8_jkCanBms,millis()); //Nur zum Test
+      bmsDataUpdateComplete(u8_jkCanBms,millis()); //Nur zum Test
       break;
     }
   }
 
-  for(uint8_t i=0;i<10;i++)
+  // Den ersten Frame und alle weiteren Frames, die sich bereits in der Queue befinden, verarbeiten
+  uint32_t u32_lRxFrames=0;
+  do
   {
-    canStatus = CAN.getStatus();
-    if(canStatus.msgs_to_rx==0) break;
-    CAN.read(&canMessage);
+    u32_lRxFrames++;
 
     #ifdef CAN_DEBUG
     BSC_LOGI(TAG,"RX ID: %i",canMessage.identifier);
@@ -279,7 +349,11 @@ void readCanMessages()
         setBmsTotalVoltage_int(u8_jkCanBms,can_batVolt);
         setBmsTotalCurrent_int(u8_jkCanBms,can_batCurr);
         setBmsChargePercentage(u8_jkCanBms,can_soc);
-        setBmsLastDataMillis(u8_jkCanBms,millis());
+        bmsDataUpdateComplete(u8_jkCanBms,millis());
+
+        xSemaphoreTake(mCanStatisticsMutex, portMAX_DELAY);
+        canBmsCommStatistics.received(micros(), CAN_BMS_COMMUNICATION_TIMEOUT*1000);
+        xSemaphoreGive(mCanStatisticsMutex);
 
         //BSC_LOGI(TAG,"JK: volt=%i, curr=%i, soc=%i",can_batVolt,can_batCurr,can_soc);
       }
@@ -289,27 +363,50 @@ void readCanMessages()
         setBmsMaxVoltageCellNumber(u8_jkCanBms,canMessage.data[2]);
         setBmsMinCellVoltage(u8_jkCanBms,((uint16_t)canMessage.data[4]<<8 | canMessage.data[3]));
         setBmsMinVoltageCellNumber(u8_jkCanBms,canMessage.data[5]);
-        setBmsLastDataMillis(u8_jkCanBms,millis());
+        bmsDataUpdateComplete(u8_jkCanBms,millis());
       }
       else if(canMessage.identifier==0x05F4) //1524; Cell temperature
       {
-        setBmsLastDataMillis(u8_jkCanBms,millis());
+        bmsDataUpdateComplete(u8_jkCanBms,millis());
       }
       else if(canMessage.identifier==0x07F4) //2036; Warning message
       {
-        setBmsLastDataMillis(u8_jkCanBms,millis());
+        bmsDataUpdateComplete(u8_jkCanBms,millis());
       }
     }
 
-  }
+  } while(u32_lRxFrames<canStatistics.rxQueueLength && twai_receive(&canMessage, 0)==ESP_OK);
+
+  xSemaphoreTake(mCanStatisticsMutex, portMAX_DELAY);
+  canStatistics.rxFrames += u32_lRxFrames;
+  xSemaphoreGive(mCanStatisticsMutex);
 }
 
 
+/* Der Frame wird in die TX-Queue des Treibers gestellt. Ist die Queue voll, dann wird gewartet bis
+ * wieder Platz ist (max. CAN_TX_TIMEOUT_MS). Dadurch werden die Frames so schnell gesendet, wie es
+ * der Bus zulässt. Optional kann eine Pause zwischen den Frames eingestellt werden. */
 void sendCanMsg(uint32_t identifier, uint8_t *buffer, uint8_t length)
 {
-  esp_err_t err = CAN.write(can::FrameType::STD_FRAME,identifier,length,buffer);
+  twai_message_t canMessage = {};
+  canMessage.identifier = identifier;
+  canMessage.data_length_code = length;
+  memcpy(canMessage.data, buffer, length);
+
+  bool bo_lQueueFull = (CAN.getStatus().msgs_to_tx>=canStatistics.txQueueLength);
+  uint32_t u32_lStartUs = micros();
+  esp_err_t err = twai_transmit(&canMessage, pdMS_TO_TICKS(CAN_TX_TIMEOUT_MS));
+  uint32_t u32_lLatencyUs = micros()-u32_lStartUs;
   if(err!=ESP_OK) BSC_LOGI(TAG, "%s", CAN.getErrorText(err).c_str());
 
+  xSemaphoreTake(mCanStatisticsMutex, portMAX_DELAY);
+  if(err==ESP_OK) canStatistics.txFrames++;
+  else canStatistics.txFailed++;
+  if(bo_lQueueFull) canStatistics.txQueueFull++;
+  canStatistics.txLatencyLastUs = u32_lLatencyUs;
+  if(u32_lLatencyUs>canStatistics.txLatencyMaxUs) canStatistics.txLatencyMaxUs=u32_lLatencyUs;
+  xSemaphoreGive(mCanStatisticsMutex);
+
   #ifdef CAN_DEBUG_STATUS
   twai_status_info_t canStatus = CAN.getStatus();
 
@@ -335,7 +432,7 @@ void sendCanMsg(uint32_t identifier, uint8_t *buffer, uint8_t length)
   BSC_LOGI(TAG,"Alert=%i", CAN.getAlert());
   #endif
 
-  vTaskDelay(pdMS_TO_TICKS(5));
+  if(u8_mCanTxFrameGap>0) vTaskDelay(pdMS_TO_TICKS(u8_mCanTxFrameGap));
 }
 
 void sendBmsCanMessages()
@@ -367,7 +464,7 @@ void sendBmsCanMessages()
       sendCanMsg_373_376_377();
 
       //Send extended data
-      if(WebSettings::getBool(ID_PARAM_BMS_CAN_EXTENDED_DATA_ENABLE,0)==true)
+      if(SettingsViewRef()->canExtendedDataEnable==true)
       {
         sendCanMsgTemp();
         sendCanMsgBmsData();
@@ -651,16 +748,17 @@ void calcMaximalenLadestromSprung(int16_t i16_pNewChargeCurrent)
 /* Berechnet der Maximalzulässigen Ladestrom anhand der eigestellten Zellspannungsparameter */
 int16_t calcLadestromZellspanung(int16_t i16_pMaxChargeCurrent)
 {
-  if(WebSettings::getBool(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_EN,0)==true) //wenn enabled
+  SettingsViewRef settings;
+  if(settings->chargeCellVoltageEn==true) //wenn enabled
   {
     //Maximale Zellspannung von den aktiven BMSen ermitteln
     uint16_t u16_lAktuelleMaxZellspg = getMaxCellSpannungFromBms();
 
-    uint16_t u16_lStartSpg = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_STARTSPG,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_STARTSPG);
+    uint16_t u16_lStartSpg = settings->chargeCellVoltageStart;
     if(u16_lStartSpg<=u16_lAktuelleMaxZellspg)
     {
-      uint16_t u16_lEndSpg = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_ENDSPG,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_ENDSPG);
-      int16_t i16_lMindestChargeCurrent = (WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_MINDEST_STROM,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_MINDEST_STROM));
+      uint16_t u16_lEndSpg = settings->chargeCellVoltageEnd;
+      int16_t i16_lMindestChargeCurrent = settings->chargeCellVoltageMinCurrent;
 
       if(u16_lStartSpg>u16_lEndSpg) return i16_pMaxChargeCurrent; //Startspannung > Endspannung => Fehler
       if(i16_pMaxChargeCurrent<=i16_lMindestChargeCurrent) return i16_pMaxChargeCurrent; //Maximaler Ladestrom < Mindest-Ladestrom => Fehler
@@ -696,19 +794,20 @@ int16_t calcLadestromZellspanung(int16_t i16_pMaxChargeCurrent)
 int16_t calcLadestromBeiZelldrift(int16_t i16_pMaxChargeCurrent)
 {
   int16_t i16_lMaxChargeCurrent = i16_pMaxChargeCurrent;
+  SettingsViewRef settings;
 
-  if(WebSettings::getBool(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLDRIFT_EN,0)==true) //wenn enabled
+  if(settings->chargeCellDriftEn==true) //wenn enabled
   {
     //Maximalen Ladestrom berechnen
     uint16_t u32_lMaxCellDrift = getMaxCellDifferenceFromBms();
-    uint16_t u16_lstartDrift = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_STARTABWEICHUNG,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_STARTABWEICHUNG);
+    uint16_t u16_lstartDrift = settings->chargeCellDriftStart;
     if(u32_lMaxCellDrift>0)
     {
       if(u32_lMaxCellDrift>u16_lstartDrift) //Wenn Drift groß genug ist
       {
-        if(getMaxCellSpannungFromBms()>=WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_STARTSPG_ZELLE,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_STARTSPG_ZELLE)) //Wenn höchste Zellspannung groß genug ist
+        if(getMaxCellSpannungFromBms()>=settings->chargeCellDriftStartCellVoltage) //Wenn höchste Zellspannung groß genug ist
         {
-          i16_lMaxChargeCurrent = i16_lMaxChargeCurrent-((u32_lMaxCellDrift-u16_lstartDrift)*WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_A_PRO_MV,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_A_PRO_MV));
+          i16_lMaxChargeCurrent = i16_lMaxChargeCurrent-((u32_lMaxCellDrift-u16_lstartDrift)*settings->chargeCellDriftAPerMv);
           if(i16_lMaxChargeCurrent<0) i16_lMaxChargeCurrent=0;
         }
       }
@@ -722,12 +821,13 @@ int16_t calcLadestromBeiZelldrift(int16_t i16_pMaxChargeCurrent)
 /* */
 int16_t calcLadestromSocAbhaengig(int16_t i16_lMaxChargeCurrent, uint8_t u8_lSoc)
 {
-  if(WebSettings::getBool(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_SOC_EN,0)==true) //wenn enabled
+  SettingsViewRef settings;
+  if(settings->chargeSocEn==true) //wenn enabled
   {
-    uint8_t u8_lReduzierenAbSoc = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_AB_SOC,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_AB_SOC);
+    uint8_t u8_lReduzierenAbSoc = settings->chargeSocStart;
     if(u8_lSoc>=u8_lReduzierenAbSoc)
     {
-      uint8_t u8_lReduzierenUmA = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_A_PRO_PERCENT_SOC,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_A_PRO_PERCENT_SOC);
+      uint8_t u8_lReduzierenUmA = settings->chargeSocAPerPercent;
 
       if(i16_lMaxChargeCurrent-((u8_lSoc-u8_lReduzierenAbSoc+1)*u8_lReduzierenUmA)>=0)
       {
@@ -751,7 +851,8 @@ int16_t calcLadestromSocAbhaengig(int16_t i16_lMaxChargeCurrent, uint8_t u8_lSoc
  *******************************************************************************************************/
 int16_t calcEntladestromZellspanung(int16_t i16_pMaxDischargeCurrent)
 {
-  uint16_t u16_lStartSpg = WebSettings::getInt(ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_STARTSPG,0,DT_ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_STARTSPG);
+  SettingsViewRef settings;
+  uint16_t u16_lStartSpg = settings->dischargeCellVoltageStart;
 
   if(u16_lStartSpg>0) //wenn enabled
   {
@@ -760,8 +861,8 @@ int16_t calcEntladestromZellspanung(int16_t i16_pMaxDischargeCurrent)
 
     if(u16_lStartSpg>=u16_lAktuelleMinZellspg)
     {
-      uint16_t u16_lEndSpg = WebSettings::getInt(ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_ENDSPG,0,DT_ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_ENDSPG);
-      int16_t i16_lMindestChargeCurrent = (WebSettings::getInt(ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_MINDEST_STROM,0,DT_ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_MINDEST_STROM));
+      uint16_t u16_lEndSpg = settings->dischargeCellVoltageEnd;
+      int16_t i16_lMindestChargeCurrent = settings->dischargeCellVoltageMinCurrent;
 
       if(u16_lStartSpg<=u16_lEndSpg) return i16_pMaxDischargeCurrent; //Startspannung <= Endspannung => Fehler
       if(i16_pMaxDischargeCurrent<=i16_lMindestChargeCurrent) return i16_pMaxDischargeCurrent; //Maximaler Entladestrom < Mindest-Entladestrom => Fehler
@@ -800,6 +901,7 @@ int16_t calcChargecurrent_MaxCurrentPerPackToHigh(int16_t i16_pMaxChargeCurrent)
 {
   if(u8_mBmsDatasourceAdd>0)
   {
+    SettingsViewRef settings;
     //uint16_t u16_lMaxCellDiff=0;
     for(uint8_t i=0;i<SERIAL_BMS_DEVICES_COUNT;i++)
     {
@@ -808,7 +910,7 @@ int16_t calcChargecurrent_MaxCurrentPerPackToHigh(int16_t i16_pMaxChargeCurrent)
         if((millis()-getBmsLastDataMillis(BMSDATA_FIRST_DEV_SERIAL+i))<CAN_BMS_COMMUNICATION_TIMEOUT) //So lang die letzten 5000ms Daten kamen ist alles gut
         {
           float fl_lTotalCurrent=getBmsTotalCurrent(BMSDATA_FIRST_DEV_SERIAL+i);
-          if(fl_lTotalCurrent>(float)WebSettings::getInt(ID_PARAM_BATTERY_PACK_CHARGE_CURRENT,i,DT_ID_PARAM_BATTERY_PACK_CHARGE_CURRENT))
+          if(fl_lTotalCurrent>(float)settings->packChargeCurrent[i])
           {
             //Ladestrom für einen Pack (BMS) wird zu groß -> Ladestrom herunterregeln
             #ifdef CAN_DEBUG
@@ -835,11 +937,12 @@ int16_t calcChargeCurrentCutOff(int16_t u16_lChargeCurrent)
   static uint16_t u16_mChargeCurrentCutOfTimer=0;
   float fl_lTotalCurrent=0;
 
-  uint16_t u16_lCutOffTime = (uint16_t)WebSettings::getInt(ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_TIME,0,DT_ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_TIME);
+  SettingsViewRef settings;
+  uint16_t u16_lCutOffTime = settings->chargeCutOffTime;
   if(u16_lCutOffTime==0) return u16_lChargeCurrent;
 
-  float fl_lCutOffCurrent = WebSettings::getFloat(ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_CURRENT,0);
-  uint8_t u16_lCutOffSoc = (uint8_t)WebSettings::getInt(ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_SOC,0,DT_ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_SOC);
+  float fl_lCutOffCurrent = settings->chargeCutOffCurrent;
+  uint8_t u16_lCutOffSoc = settings->chargeCutOffSoc;
 
   xSemaphoreTake(mInverterDataMutex, portMAX_DELAY);
   uint8_t u8_lSoc = (uint8_t)inverterData.inverterSoc;
@@ -882,10 +985,11 @@ uint16_t calcDynamicReduzeChargeVolltage(uint16_t u16_lChargeVoltage)
 {
   static uint16_t u16_lDynamicChargeVoltage = u16_lChargeVoltage;
 
-  if(WebSettings::getBool(ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_EN,0)==true) //wenn enabled
+  SettingsViewRef settings;
+  if(settings->chargeVoltageDynamicEn==true) //wenn enabled
   {
-    uint16_t u16_lStartZellVoltage = WebSettings::getInt(ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_ZELLSPG,0,DT_ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_ZELLSPG);
-    uint16_t u16_lDeltaCellVoltage= WebSettings::getInt(ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_DELTA,0,DT_ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_DELTA);
+    uint16_t u16_lStartZellVoltage = settings->chargeVoltageDynamicCellVoltage;
+    uint16_t u16_lDeltaCellVoltage= settings->chargeVoltageDynamicDelta;
 
     if(getMaxCellSpannungFromBms()>u16_lStartZellVoltage)
     {
@@ -915,12 +1019,13 @@ uint16_t calcDynamicReduzeChargeVolltage(uint16_t u16_lChargeVoltage)
  * *******************************************************************************************/
 uint8_t getNewSocByMinCellVoltage(uint8_t u8_lSoc)
 {
+  SettingsViewRef settings;
   //Wenn Zellspannung unterschritten wird, dann SoC x% an Inverter senden
   switch(u8_mSocZellspannungState)
   {
     //Warte bis Zellspannung kleiner Mindestspannung
     case STATE_MINCELLSPG_SOC_WAIT_OF_MIN:
-      if(getMinCellSpannungFromBms()<=WebSettings::getInt(ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG,0,DT_ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG))
+      if(getMinCellSpannungFromBms()<=settings->socBelowCellVoltage)
       {
         u8_mSocZellspannungState=STATE_MINCELLSPG_SOC_BELOW_MIN;
       }
@@ -929,19 +1034,19 @@ uint8_t getNewSocByMinCellVoltage(uint8_t u8_lSoc)
     //Spannung war kleiner als Mindestspannung
     case STATE_MINCELLSPG_SOC_BELOW_MIN:
       uint16_t u16_lZellspgChargeEnd;
-      u16_lZellspgChargeEnd = WebSettings::getInt(ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG_END,0,DT_ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG_END);
+      u16_lZellspgChargeEnd = settings->socBelowCellVoltageEnd;
       //Wenn Parameter ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG_END 0 ist, dann Ladestartspannung nehmen
       if(u16_lZellspgChargeEnd==0)
       {
-        u16_lZellspgChargeEnd=WebSettings::getInt(ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG,0,DT_ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG);
+        u16_lZellspgChargeEnd=settings->socBelowCellVoltage;
       }
 
       if(getMinCellSpannungFromBms()>u16_lZellspgChargeEnd)
       {
-        u16_mSocZellspannungSperrzeitTimer=WebSettings::getInt(ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_TIME,0,DT_ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_TIME);
+        u16_mSocZellspannungSperrzeitTimer=settings->socBelowCellVoltageTime;
         u8_mSocZellspannungState=STATE_MINCELLSPG_SOC_LOCKTIMER;
       }
-      u8_lSoc=WebSettings::getInt(ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SOC,0,DT_ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SOC);
+      u8_lSoc=settings->socBelowCellVoltageSoc;
       break;
 
     //Sperrzeit läuft, warte auf ablauf der Sperrezit
@@ -996,12 +1101,13 @@ void sendCanMsg_351()
   uint8_t errors = 0;
   int16_t i16_lMaxChargeCurrentList[4] = {0};
   int16_t i16_lMaxDischargeCurrentList[1] = {0};
+  SettingsViewRef settings;
 
   //@ToDo: Fehler feststellen
 
   if (errors!=0) //wenn Fehler
   {
-    msgData.chargevoltagelimit  = (uint16_t)(WebSettings::getFloat(ID_PARAM_BMS_MAX_CHARGE_SPG,0)*10.0);
+    msgData.chargevoltagelimit  = (uint16_t)(settings->maxChargeVoltage*10.0);
     msgData.maxchargecurrent    = 0;
     msgData.maxdischargecurrent = 0;
     msgData.dischargevoltage    = 0; //not use
@@ -1013,7 +1119,7 @@ void sendCanMsg_351()
     /*******************************
      * Ladespannung
      *******************************/
-    uint16_t u16_lChargeVoltage = (uint16_t)(WebSettings::getFloat(ID_PARAM_BMS_MAX_CHARGE_SPG,0)*10.0);
+    uint16_t u16_lChargeVoltage = (uint16_t)(settings->maxChargeVoltage*10.0);
     u16_lChargeVoltage = calcDynamicReduzeChargeVolltage(u16_lChargeVoltage);
     msgData.chargevoltagelimit = u16_lChargeVoltage;
     if(u8_mMqttTxTimer==15)
@@ -1031,7 +1137,7 @@ void sendCanMsg_351()
     else
     {
       int16_t i16_lMaxChargeCurrentOld=i16_mMaxChargeCurrent;
-      int16_t i16_lMaxChargeCurrent = (int16_t)(WebSettings::getInt(ID_PARAM_BMS_MAX_CHARGE_CURRENT,0,DT_ID_PARAM_BMS_MAX_CHARGE_CURRENT));
+      int16_t i16_lMaxChargeCurrent = (int16_t)settings->maxChargeCurrent;
       //u8_mModulesCntCharge=1;
 
       //Maximalen Ladestrom aus den einzelnen Packs errechnen
@@ -1045,7 +1151,7 @@ void sendCanMsg_351()
             if(getBmsErrors(BMSDATA_FIRST_DEV_SERIAL+i)==0 && (millis()-getBmsLastDataMillis(BMSDATA_FIRST_DEV_SERIAL+i)<CAN_BMS_COMMUNICATION_TIMEOUT) &&
               getBmsStateFETsCharge(BMSDATA_FIRST_DEV_SERIAL+i))
             {
-              u16_lMaxCurrent+=WebSettings::getInt(ID_PARAM_BATTERY_PACK_CHARGE_CURRENT,i,DT_ID_PARAM_BATTERY_PACK_CHARGE_CURRENT);
+              u16_lMaxCurrent+=settings->packChargeCurrent[i];
               //u8_mModulesCntCharge++;
             }
           }
@@ -1101,7 +1207,7 @@ void sendCanMsg_351()
     }
     else
     {
-      int16_t i16_lMaxDischargeCurrent = (int16_t)WebSettings::getInt(ID_PARAM_BMS_MAX_DISCHARGE_CURRENT,0,DT_ID_PARAM_BMS_MAX_DISCHARGE_CURRENT);
+      int16_t i16_lMaxDischargeCurrent = (int16_t)settings->maxDischargeCurrent;
       //u8_mModulesCntDischarge=1;
 
       //Maximalen Entladestrom aus den einzelnen Packs errechnen
@@ -1120,7 +1226,7 @@ void sendCanMsg_351()
             if(getBmsErrors(BMSDATA_FIRST_DEV_SERIAL+i)==0 && (millis()-getBmsLastDataMillis(BMSDATA_FIRST_DEV_SERIAL+i)<CAN_BMS_COMMUNICATION_TIMEOUT) &&
               getBmsStateFETsDischarge(BMSDATA_FIRST_DEV_SERIAL+i))
             {
-              i16_lMaxCurrent+=WebSettings::getInt(ID_PARAM_BATTERY_PACK_DISCHARGE_CURRENT,i,DT_ID_PARAM_BATTERY_PACK_DISCHARGE_CURRENT);
+              i16_lMaxCurrent+=settings->packDischargeCurrent[i];
               //u8_mModulesCntDischarge++;
             }
           }
@@ -1240,7 +1346,7 @@ void sendCanMsg_355()
       }
     }
 
-    if(WebSettings::getBool(ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_EN,0)==true)
+    if(SettingsViewRef()->socBelowCellVoltageEn==true)
     {
       //Wenn Zellspannung unterschritten wird, dann SoC x an Inverter senden
       msgData.soc = getNewSocByMinCellVoltage(msgData.soc);
@@ -1764,55 +1870,27 @@ void sendCanMsgTemp()
   }
 }
 
+/* Sendet die erweiterten BMS-Daten (Zellspannungen 1-24, FET-Status, Balancing-Strom).
+ * Aufbau der Frames siehe CanBmsData.hpp. Der Scheduler verteilt die Frames aller BMS auf die Zyklen. */
 void sendCanMsgBmsData()
 {
-  uint32_t u16_lBaseCanId = 0x400;
-  uint32_t u16_lCanId=u16_lBaseCanId;
-  static uint8_t u8_mCanSendDataBmsNumber=0;
+  static canbmsdata::Scheduler bmsDataScheduler;
+  static BmsDataSnapshot bmsSnapshot;
+  static uint8_t u8_lSnapshotBmsNr=0xFF;
 
-  struct dataCellVoltage
+  bmsDataScheduler.run(BMSDATA_NUMBER_ALLDEVICES, SettingsViewRef()->canExtendedDataFrames, [](uint8_t u8_lBmsNr, uint8_t u8_lFrame)
   {
-    uint16_t cellVoltage[4];
-  };
-  dataCellVoltage msgData;
-
-  struct dataBms1
-  {
-    bool stateFETCharge;
-    bool stateFETDischarge;
-    bool stateBalancingActive;
-  };
-  dataBms1 msgDataBms1;
-
-  struct dataBms2
-  {
-    int16_t value1;
-  };
-  dataBms2 msgDataBms2;
-
-
-  u16_lCanId=u16_lBaseCanId+(0x32*u8_mCanSendDataBmsNumber);
-
-  //Cellvoltage
-  for(uint8_t n=0;n<16;n+=4)
-  {
-    for(uint8_t x=0;x<4;x++) msgData.cellVoltage[x] = getBmsCellVoltage(u8_mCanSendDataBmsNumber,n+x);
-    sendCanMsg(u16_lCanId, (uint8_t *)&msgData, sizeof(dataCellVoltage));
-    u16_lCanId++;
-  }
-
-  msgDataBms1.stateFETCharge = getBmsStateFETsCharge(u8_mCanSendDataBmsNumber);
-  msgDataBms1.stateFETDischarge = getBmsStateFETsDischarge(u8_mCanSendDataBmsNumber);
-  msgDataBms1.stateBalancingActive = getBmsIsBalancingActive(u8_mCanSendDataBmsNumber);
-  sendCanMsg(u16_lCanId, (uint8_t *)&msgDataBms1, sizeof(dataBms1));
-  u16_lCanId++;
-
-  msgDataBms2.value1 = (int16_t)(getBmsBalancingCurrent(u8_mCanSendDataBmsNumber)*100);
-  sendCanMsg(u16_lCanId, (uint8_t *)&msgDataBms2, sizeof(dataBms2));
-  u16_lCanId++;
+    // Snapshot einmal pro BMS holen, damit alle Frames eines BMS zusammenpassen
+    if(u8_lFrame==0 || u8_lBmsNr!=u8_lSnapshotBmsNr)
+    {
+      getBmsDataSnapshot(u8_lBmsNr, bmsSnapshot);
+      u8_lSnapshotBmsNr=u8_lBmsNr;
+    }
 
-  u8_mCanSendDataBmsNumber++;
-  if(u8_mCanSendDataBmsNumber==BMSDATA_NUMBER_ALLDEVICES)u8_mCanSendDataBmsNumber=0;
+    uint8_t u8_lData[canbmsdata::FRAME_LEN_MAX];
+    uint8_t u8_lLen = canbmsdata::encodeFrame(bmsSnapshot, u8_lFrame, u8_lData);
+    if(u8_lLen>0) sendCanMsg(canbmsdata::canId(u8_lBmsNr, u8_lFrame), u8_lData, u8_lLen);
+  });
 }
 
 
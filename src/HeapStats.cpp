@@ -0,0 +1,46 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include "HeapStats.h"
+#include <esp_heap_caps.h>
+
+static struct heapStatistics_s heapStatistics = {};
+static uint32_t u32_mFreeBefore = 0;
+
+
+void heapStatsRequestBegin()
+{
+  u32_mFreeBefore = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  heapStatistics.largestBeforeLast = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+}
+
+
+void heapStatsRequestEnd(uint16_t u16_lResponseLen, bool bo_lOverflow)
+{
+  uint32_t u32_lLargestAfter = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  uint32_t u32_lFreeAfter = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+
+  heapStatistics.requests++;
+  heapStatistics.largestAfterLast = u32_lLargestAfter;
+  heapStatistics.freeDeltaLast = (int32_t)u32_lFreeAfter - (int32_t)u32_mFreeBefore;
+  if(u32_lLargestAfter<heapStatistics.largestBeforeLast) heapStatistics.shrinks++;
+
+  uint32_t u32_lLargestMin = min(heapStatistics.largestBeforeLast, u32_lLargestAfter);
+  if(heapStatistics.requests==1 || u32_lLargestMin<heapStatistics.largestMin) heapStatistics.largestMin=u32_lLargestMin;
+
+  if(u16_lResponseLen>heapStatistics.responseMaxLen) heapStatistics.responseMaxLen=u16_lResponseLen;
+  if(bo_lOverflow) heapStatistics.responseOverflows++;
+}
+
+
+void heapStatsGetStatistics(struct heapStatistics_s &stats)
+{
+  stats = heapStatistics;
+  stats.freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  stats.minFreeHeap = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+  stats.largestFreeBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  stats.fragmentationPermille = 0;
+  if(stats.freeHeap>0) stats.fragmentationPermille = 1000 - (uint16_t)(((uint64_t)stats.largestFreeBlock*1000)/stats.freeHeap);
+}
@@ -10,19 +10,6 @@ Json::Json()
 };
 
 
-int arrSize(const char *a)
-{
-    int it = 0;
-    int size = 0;
-    while(a[it] != '\0')
-    {
-        ++size;
-        ++it;
-    }
-    return size;
-}
-
-
 bool Json::jsonIndexPos_Array(const char *json, int idx, long &startPos, long& endPos)
 {
     int32_t  posArrayFirstOpen = -1;
@@ -33,7 +20,7 @@ bool Json::jsonIndexPos_Array(const char *json, int idx, long &startPos, long& e
 
     uint8_t arrayNr = 0;
 
-    for (uint32_t i = startPos; i < arrSize(json); i++)
+    for (uint32_t i = startPos; json[i] != '\0'; i++)
     {
         char c = json[i];
         if (c == '{')
@@ -80,7 +67,7 @@ uint16_t Json::getArraySize(const char *json, long startPos)
     uint16_t arrayCnt = 0;
     uint8_t  arrayCntMerker = 1;
 
-    for (uint32_t i = startPos; i < arrSize(json); i++)
+    for (uint32_t i = startPos; json[i] != '\0'; i++)
     {
         char c = json[i];
         if (c == '[')
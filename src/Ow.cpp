@@ -5,10 +5,12 @@
 
 #include "Ow.h"
 #include "WebSettings.h"
+#include "SettingsView.h"
 #include "defines.h"
 #include <OneWire.h>
 #include <DallasTemperature.h>
 #include "log.h"
+#include "OwScheduler.hpp"
 
 static const char *TAG = "OW";
 
@@ -21,9 +23,9 @@ int16_t owTempsC[MAX_ANZAHL_OW_SENSOREN];
 int16_t owTempsC_AvgCalc[MAX_ANZAHL_OW_SENSOREN];
 //uint8_t owSensorState[MAX_ANZAHL_OW_SENSOREN]; //0=ok
 
-uint8_t cycleCounter;
-bool firstMeasurement;
+bool firstMeasurement[MAX_ANZAHL_OW_SENSOREN];
 uint32_t owReadErrorTimer;
+uint32_t owSettingsGeneration;
 
 // Setup a oneWire instance to communicate with any OneWire devices (not just Maxim/Dallas temperature ICs)
 OneWire oneWire(OW_PIN);
@@ -32,8 +34,33 @@ OneWire oneWire(OW_PIN);
 DallasTemperature sensors(&oneWire);
 
 
+/* Zugriff auf den Bus für den Scheduler */
+class OwBus
+{
+  public:
+  void startConversion()
+  {
+    sensors.requestTemperatures(); //Kehrt wegen setWaitForConversion(false) sofort zurück
+  }
+
+  owscheduler::ReadResult read(uint8_t sensNr, int16_t &tempC100)
+  {
+    uint8_t scratchPad[9];
+    if(!sensors.readScratchPad(owAddr[sensNr], scratchPad)) return owscheduler::ReadResult::NO_RESPONSE;
+    return owscheduler::decodeScratchPad(owAddr[sensNr][0], scratchPad, tempC100);
+  }
+
+  void onTemperature(uint8_t sensNr, int16_t tempC100);
+
+  const settingsView_s *settings = nullptr;
+};
+
+static OwBus owBus;
+static owscheduler::Scheduler<MAX_ANZAHL_OW_SENSOREN> owScheduler(OW_MAX_READS_PER_CYCLE);
+
+
 String findDevices();
-void getTempC_allDevices(bool);
+void owConfigureSensors(bool writeResolution);
 
 
 uint8_t getSensorAdrFromParams()
@@ -79,8 +106,6 @@ precision | time
 void owSetup()
 {
   owReadErrorTimer=0;
-  cycleCounter=0;
-  firstMeasurement=true;
   owMutex = xSemaphoreCreateMutex();
 
   takeOwSensorAddress();
@@ -90,14 +115,35 @@ void owSetup()
 //Immer aufrufen , wenn sich Adressen geändert haben
 void takeOwSensorAddress()
 {
-  firstMeasurement=true;
   xSemaphoreTake(owMutex, portMAX_DELAY);
+  for(uint8_t i=0;i<MAX_ANZAHL_OW_SENSOREN;i++) firstMeasurement[i]=true;
   sensors.begin();
+  sensors.setWaitForConversion(false);
   getSensorAdrFromParams();
-  sensors.setResolution(12);
+  owConfigureSensors(true);
   xSemaphoreGive(owMutex);
 }
 
+
+/* Übernimmt Auflösung und Messintervall der Sensoren aus den Einstellungen.
+ * Die Auflösung wird nur in den Sensor geschrieben, wenn sie sich geändert hat. Aufruf nur mit owMutex. */
+void owConfigureSensors(bool writeResolution)
+{
+  owSettingsGeneration=getSettingsViewGeneration();
+  SettingsViewRef settings;
+  for(uint8_t i=0;i<MAX_ANZAHL_OW_SENSOREN;i++)
+  {
+    bool bo_lPresent = (owAddr[i][0]>0);
+    uint8_t u8_lResolution = owscheduler::clampResolution(settings->owResolution[i]);
+    if(bo_lPresent && (writeResolution || u8_lResolution!=owScheduler.resolution(i)))
+    {
+      if(!sensors.setResolution(owAddr[i], u8_lResolution, true)) BSC_LOGI(TAG,"Set resolution failed: sensor=%i",i);
+    }
+    owScheduler.configure(i, bo_lPresent, u8_lResolution, (uint32_t)settings->owRefreshInterval[i]*1000);
+  }
+  owScheduler.reset();
+}
+
 void addErrorCounter()
 {
   if(owReadErrorTimer==0)
@@ -119,34 +165,28 @@ uint8_t getErrorCounter()
 }
 
 
-//Wird vom Task aus der main.c zyklisch aufgerufen
+//Wird vom Task aus der main.c zyklisch aufgerufen (OW_CYCLE_TIME); wartet nie auf eine Wandlung
 void owCyclicRun()
 {
   //Wenn onewire aktiviert wurde
   if(WebSettings::getBool(ID_PARAM_ONWIRE_ENABLE,0))
   {
     xSemaphoreTake(owMutex, portMAX_DELAY);
-    if(cycleCounter==0)
-    {
-      sensors.requestTemperatures();
-    }
-    else if(cycleCounter>0 && cycleCounter<OW_TEMP_AVG_CYCELS)
-    {
-      getTempC_allDevices(false);
-      sensors.requestTemperatures();
-    }
-    else if(cycleCounter==OW_TEMP_AVG_CYCELS)
-    {
-      getTempC_allDevices(true);
-    }
-    else if(cycleCounter==(OW_TEMP_AVG_CYCELS+3))
+    if(owSettingsGeneration!=getSettingsViewGeneration()) owConfigureSensors(false);
+
+    SettingsViewRef lView;
+    owBus.settings = lView.get();
+    uint8_t u8_lReads = owScheduler.run(millis(), owBus);
+    owBus.settings = nullptr;
+
+    //Nach jedem vollständigen Durchlauf
+    if(u8_lReads>0 && owScheduler.idle())
     {
-      cycleCounter=-1;
+      if(owScheduler.anyFailed()) addErrorCounter();
+      else resetErrorCounter();
     }
     xSemaphoreGive(owMutex);
   }
-
-  cycleCounter++;
 }
 
 
@@ -160,51 +200,23 @@ void filter(uint8_t sensNr, float fNew) //fCurrent
 #endif
 
 
-void getTempC_allDevices(bool tempToOutBuffer)
+void OwBus::onTemperature(uint8_t sensNr, int16_t tempC100)
 {
-  float tempC;
-  bool bo_lsensorHasError=false;
-  for(uint8_t i=0;i<MAX_ANZAHL_OW_SENSOREN;i++)
+  //Offset abziehen
+  int16_t tempC = tempC100 + (int16_t)(settings->owTempOffset[sensNr]*100);
+
+  if(firstMeasurement[sensNr])
   {
-    if(owAddr[i][0]>0)
-    {
-      for(uint8_t r=0;r<3;r++) //Drei Versuche den Sensor auszulesen
-      {
-        tempC = (int16_t)(sensors.getTempC(&owAddr[i][0])*100);
-        if (tempC == DEVICE_DISCONNECTED_C_U16)
-        {
-          //BSC_LOGI(TAG, "Error read temp: seonsor=%i, r=%i",i,r);
-          if(r==2)
-          {
-            bo_lsensorHasError=true;
-            //BSC_LOGI(TAG, "Error sensor %i nicht lesbar",i); //ToDo Fehlerzähler addieren
-          }
-        }
-        else
-        {
-          //Offset abziehen
-          tempC += (int16_t)(WebSettings::getFloat(ID_PARAM_ONWIRE_TEMP_OFFSET,i)*100);
-
-          if(firstMeasurement) owTempsC_AvgCalc[i] = tempC;
-          else owTempsC_AvgCalc[i] = (owTempsC_AvgCalc[i]+tempC)/2;
-
-          if(tempToOutBuffer==true)
-          {
-            if( (owTempsC_AvgCalc[i]>=owTempsC[i]+8) || (owTempsC_AvgCalc[i]<=owTempsC[i]-8) ) //0.08
-            {
-              owTempsC[i]=owTempsC_AvgCalc[i];
-            }
-          }
-          break;
-        }
-      }
-    }
+    owTempsC_AvgCalc[sensNr] = tempC;
+    owTempsC[sensNr] = tempC;
+    firstMeasurement[sensNr] = false;
   }
+  else owTempsC_AvgCalc[sensNr] = (owTempsC_AvgCalc[sensNr]+tempC)/2;
 
-  if(bo_lsensorHasError) addErrorCounter();
-  else resetErrorCounter();
-
-  if(firstMeasurement){firstMeasurement=false;}
+  if( (owTempsC_AvgCalc[sensNr]>=owTempsC[sensNr]+8) || (owTempsC_AvgCalc[sensNr]<=owTempsC[sensNr]-8) ) //0.08
+  {
+    owTempsC[sensNr]=owTempsC_AvgCalc[sensNr];
+  }
 }
 
 
@@ -220,6 +232,30 @@ uint8_t owGetAllSensorError()
 }
 
 
+bool owGetSensorStatistics(uint8_t sensNr, struct owSensorStatistics_s &stats)
+{
+  memset(&stats, 0, sizeof(stats));
+  if(owMutex==NULL || sensNr>=MAX_ANZAHL_OW_SENSOREN) return false;
+
+  xSemaphoreTake(owMutex, portMAX_DELAY);
+  bool bo_lPresent = owScheduler.present(sensNr);
+  if(bo_lPresent)
+  {
+    const owscheduler::SensorStatistics &sensorStats = owScheduler.statistics(sensNr);
+    stats.resolution = owScheduler.resolution(sensNr);
+    stats.intervalMs = owScheduler.intervalMs(sensNr);
+    stats.reads = sensorStats.reads;
+    stats.crcErrors = sensorStats.crcErrors;
+    stats.noResponse = sensorStats.noResponse;
+    stats.retries = sensorStats.retries;
+    stats.failures = sensorStats.failures;
+    stats.failed = owScheduler.failed(sensNr);
+  }
+  xSemaphoreGive(owMutex);
+  return bo_lPresent;
+}
+
+
 String getSensorAdr() {
   return findDevices();
 }
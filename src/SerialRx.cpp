@@ -0,0 +1,244 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include "SerialRx.h"
+
+struct serialRxPort_s
+{
+  Stream            *port;
+  SemaphoreHandle_t rxEvent;   // Wird vom UART-Event (onReceive) gegeben; NULL = Port wird abgefragt
+  uint8_t           u8_buffer[SERIAL_RX_BUFFER_SIZE];
+  uint8_t           u8_len;
+  uint8_t           u8_readPos;
+};
+
+static struct serialRxPort_s serialRxPorts[SERIAL_RX_PORT_COUNT];
+static SemaphoreHandle_t mSerialRxStatisticsMutex = NULL;
+static commstats::Recorder serialRxStatistics[SERIAL_BMS_DEVICES_COUNT]; // Geschützt durch mSerialRxStatisticsMutex
+
+
+void serialRxInit()
+{
+  for(uint8_t i=0;i<SERIAL_RX_PORT_COUNT;i++)
+  {
+    serialRxPorts[i].port=NULL;
+    serialRxPorts[i].rxEvent=NULL;
+    serialRxPorts[i].u8_len=0;
+    serialRxPorts[i].u8_readPos=0;
+  }
+  if(mSerialRxStatisticsMutex==NULL) mSerialRxStatisticsMutex = xSemaphoreCreateMutex();
+  xSemaphoreTake(mSerialRxStatisticsMutex, portMAX_DELAY);
+  for(uint8_t i=0;i<SERIAL_BMS_DEVICES_COUNT;i++) serialRxStatistics[i].reset();
+  xSemaphoreGive(mSerialRxStatisticsMutex);
+}
+
+
+static struct serialRxPort_s *findPort(Stream *port)
+{
+  for(uint8_t i=0;i<SERIAL_RX_PORT_COUNT;i++)
+  {
+    if(serialRxPorts[i].port==port) return &serialRxPorts[i];
+  }
+  return NULL;
+}
+
+
+/* Registriert einen Port. Ist bo_lEvents gesetzt, muss für den Port serialRxNotify() aufgerufen werden,
+ * sobald Daten empfangen wurden (HardwareSerial::onReceive).
+ * Die Ports werden nur bei der Initialisierung bzw. beim Wechsel der Baudrate registriert. Ein bereits
+ * registrierter Port behält seinen Eintrag, so dass die Tasks der anderen Port-Gruppen ungestört weiterlesen. */
+bool serialRxRegisterPort(Stream *port, bool bo_lEvents)
+{
+  if(port==NULL) return false;
+
+  struct serialRxPort_s *p_lPort = findPort(port);
+  if(p_lPort==NULL)
+  {
+    p_lPort = findPort(NULL);
+    if(p_lPort==NULL) return false;
+    p_lPort->u8_len=0;
+    p_lPort->u8_readPos=0;
+    p_lPort->rxEvent=NULL;
+    p_lPort->port=port;
+  }
+
+  if(bo_lEvents && p_lPort->rxEvent==NULL) p_lPort->rxEvent=xSemaphoreCreateBinary();
+  return (!bo_lEvents || p_lPort->rxEvent!=NULL);
+}
+
+
+/* Wird aus dem Event-Task der UART aufgerufen */
+void serialRxNotify(Stream *port)
+{
+  struct serialRxPort_s *p_lPort = findPort(port);
+  if(p_lPort!=NULL && p_lPort->rxEvent!=NULL) xSemaphoreGive(p_lPort->rxEvent);
+}
+
+
+/* Liefert das nächste empfangene Byte, oder -1 wenn seit u32_lStartUs (micros()) mehr als u32_lTimeoutMs vergangen sind.
+ * Ist der Puffer des Ports leer, wird auf das RX-Event gewartet und dann alles Vorhandene auf einmal gelesen. */
+int16_t serialRxReadByte(Stream *port, uint32_t u32_lStartUs, uint32_t u32_lTimeoutMs)
+{
+  struct serialRxPort_s *p_lPort = findPort(port);
+
+  for(;;)
+  {
+    if(p_lPort!=NULL)
+    {
+      if(p_lPort->u8_readPos<p_lPort->u8_len) return p_lPort->u8_buffer[p_lPort->u8_readPos++];
+
+      int i_lAvailable = port->available();
+      if(i_lAvailable>0)
+      {
+        if(i_lAvailable>SERIAL_RX_BUFFER_SIZE) i_lAvailable=SERIAL_RX_BUFFER_SIZE;
+        p_lPort->u8_len = (uint8_t)port->readBytes(p_lPort->u8_buffer, i_lAvailable);
+        p_lPort->u8_readPos = 0;
+        continue;
+      }
+    }
+    else if(port->available()>0) return port->read(); //Nicht registrierter Port
+
+    uint32_t u32_lElapsedMs = (micros()-u32_lStartUs)/1000;
+    if(u32_lElapsedMs>u32_lTimeoutMs) return -1;
+
+    if(p_lPort!=NULL && p_lPort->rxEvent!=NULL)
+    {
+      //Ein Event von bereits gelesenen Daten lässt das Warten sofort zurückkehren, danach wird erneut gewartet
+      xSemaphoreTake(p_lPort->rxEvent, pdMS_TO_TICKS(u32_lTimeoutMs-u32_lElapsedMs)+1);
+    }
+    else vTaskDelay(pdMS_TO_TICKS(1));
+  }
+}
+
+
+/* Verwirft alle empfangenen Bytes des Ports (vor dem Senden einer Anfrage) */
+void serialRxClear(Stream *port)
+{
+  struct serialRxPort_s *p_lPort = findPort(port);
+  if(p_lPort!=NULL)
+  {
+    p_lPort->u8_len=0;
+    p_lPort->u8_readPos=0;
+    if(p_lPort->rxEvent!=NULL) xSemaphoreTake(p_lPort->rxEvent, 0);
+  }
+
+  for(uint16_t i=0;i<512;i++)
+  {
+    if(port->available()==0) break;
+    port->read();
+  }
+}
+
+
+/* Liest Bytes in den Decoder, bis ein gültiger Frame vollständig ist (Status Frame).
+ * Timeout: u32_lTimeoutMs bis zum ersten Byte eines Frames, danach u32_lFrameTimeoutMs (0 = gleicher Timeout).
+ * Bei einem Timeout wird Incomplete zurückgegeben; vorher wird noch nach einem Frame gesucht, dessen Anfang in einem
+ * ungültigen Frame lag. Ein fehlerhafter Frame (Checksumme, Länge) beendet den Empfang nur, wenn danach keine Bytes
+ * mehr ausstehen, sonst wird im Rest weitergesucht.
+ * Anfrage, Antwortzeit, Timeouts und die Fehler des Decoders werden für u8_devNr aufgezeichnet. */
+utils::FrameDecoder::Status serialRxReadFrame(Stream *port, uint8_t u8_devNr, utils::FrameDecoder &decoder,
+  uint32_t u32_lStartUs, uint32_t u32_lTimeoutMs, uint32_t u32_lFrameTimeoutMs)
+{
+  if(u32_lFrameTimeoutMs==0) u32_lFrameTimeoutMs=u32_lTimeoutMs;
+  serialRxRecordRequest(u8_devNr);
+
+  utils::FrameDecoder::Status status;
+  for(;;)
+  {
+    int16_t i16_lRecvByte=serialRxReadByte(port, u32_lStartUs, (decoder.pending()==0) ? u32_lTimeoutMs : u32_lFrameTimeoutMs);
+    if(i16_lRecvByte<0) //Timeout
+    {
+      status=decoder.flush();
+      if(status==utils::FrameDecoder::Status::Frame) break;
+      serialRxRecordDecoder(u8_devNr, decoder.statistics());
+      serialRxRecordTimeout(u8_devNr);
+      return utils::FrameDecoder::Status::Incomplete;
+    }
+
+    status=decoder.push((uint8_t)i16_lRecvByte);
+    if(status==utils::FrameDecoder::Status::Frame) break;
+    if(status!=utils::FrameDecoder::Status::Incomplete && decoder.pending()==0)
+    {
+      serialRxRecordDecoder(u8_devNr, decoder.statistics());
+      return status;
+    }
+  }
+
+  serialRxRecordDecoder(u8_devNr, decoder.statistics());
+  serialRxRecordResponse(u8_devNr, u32_lStartUs);
+  return utils::FrameDecoder::Status::Frame;
+}
+
+
+/* Zählt eine Anfrage, auf die eine Antwort erwartet wird */
+void serialRxRecordRequest(uint8_t u8_devNr)
+{
+  if(u8_devNr>=SERIAL_BMS_DEVICES_COUNT) return;
+  xSemaphoreTake(mSerialRxStatisticsMutex, portMAX_DELAY);
+  serialRxStatistics[u8_devNr].request();
+  xSemaphoreGive(mSerialRxStatisticsMutex);
+}
+
+
+void serialRxRecordResponse(uint8_t u8_devNr, uint32_t u32_lStartUs)
+{
+  if(u8_devNr>=SERIAL_BMS_DEVICES_COUNT) return;
+  xSemaphoreTake(mSerialRxStatisticsMutex, portMAX_DELAY);
+  serialRxStatistics[u8_devNr].response(micros()-u32_lStartUs);
+  xSemaphoreGive(mSerialRxStatisticsMutex);
+}
+
+
+void serialRxRecordTimeout(uint8_t u8_devNr)
+{
+  if(u8_devNr>=SERIAL_BMS_DEVICES_COUNT) return;
+  xSemaphoreTake(mSerialRxStatisticsMutex, portMAX_DELAY);
+  serialRxStatistics[u8_devNr].timeout();
+  xSemaphoreGive(mSerialRxStatisticsMutex);
+}
+
+
+void serialRxRecordChecksumError(uint8_t u8_devNr)
+{
+  if(u8_devNr>=SERIAL_BMS_DEVICES_COUNT) return;
+  xSemaphoreTake(mSerialRxStatisticsMutex, portMAX_DELAY);
+  serialRxStatistics[u8_devNr].checksumError();
+  xSemaphoreGive(mSerialRxStatisticsMutex);
+}
+
+
+/* Übernimmt die Fehler eines Decoders (ein Decoder je Antwort).
+ * Resync: Der Anfang eines Frames musste nach einem ungültigen Frame oder nach Störbytes neu gesucht werden. */
+void serialRxRecordDecoder(uint8_t u8_devNr, const utils::FrameDecoderStatistics &decoderStats)
+{
+  if(u8_devNr>=SERIAL_BMS_DEVICES_COUNT) return;
+  xSemaphoreTake(mSerialRxStatisticsMutex, portMAX_DELAY);
+  serialRxStatistics[u8_devNr].checksumError(decoderStats.checksumErrors);
+  serialRxStatistics[u8_devNr].resync(decoderStats.formatErrors + (decoderStats.skippedBytes>0 ? 1 : 0));
+  xSemaphoreGive(mSerialRxStatisticsMutex);
+}
+
+
+/* Die Zellspannungen des BMS haben sich über mehrere Abfragen nicht geändert (Plausibilitätsprüfung) */
+void serialRxRecordPlausibilityTrip(uint8_t u8_devNr)
+{
+  if(u8_devNr>=SERIAL_BMS_DEVICES_COUNT) return;
+  xSemaphoreTake(mSerialRxStatisticsMutex, portMAX_DELAY);
+  serialRxStatistics[u8_devNr].plausibilityTrip();
+  xSemaphoreGive(mSerialRxStatisticsMutex);
+}
+
+
+void serialRxGetCommStatistics(uint8_t u8_devNr, commstats::Statistics &stats)
+{
+  if(mSerialRxStatisticsMutex==NULL || u8_devNr>=SERIAL_BMS_DEVICES_COUNT)
+  {
+    stats = commstats::Statistics {};
+    return;
+  }
+  xSemaphoreTake(mSerialRxStatisticsMutex, portMAX_DELAY);
+  stats = serialRxStatistics[u8_devNr].statistics();
+  xSemaphoreGive(mSerialRxStatisticsMutex);
+}
@@ -0,0 +1,253 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include "SettingsView.h"
+#include "WebSettings.h"
+#include "log.h"
+#include <utils/AtomicSwapBuffer.hpp>
+
+static const char *TAG = "SETTINGS_VIEW";
+
+static SemaphoreHandle_t mSettingsViewMutex = NULL;
+static utils::AtomicSwapBuffer<settingsView_s> settingsView;
+
+
+/* Ist für die Alarmregel ein BMS parametriert? */
+static bool isAlarmRuleBmsConfigured(const settingsView_s &view, uint8_t bmsNr)
+{
+  uint8_t u8_lBmsSerial2 = view.serialConnectDevice[2];
+  return (bmsNr<BT_DEVICES_COUNT && view.btDeviceConfigured[bmsNr]) ||
+    (bmsNr>=BT_DEVICES_COUNT && bmsNr<BT_DEVICES_COUNT+SERIAL_BMS_DEVICES_COUNT && view.serialConnectDevice[bmsNr-BT_DEVICES_COUNT]!=0) ||
+    (bmsNr>(BT_DEVICES_COUNT+2) && bmsNr<(view.serial2NumberOfBms+BT_DEVICES_COUNT+2) && (u8_lBmsSerial2==ID_SERIAL_DEVICE_SEPLOSBMS ||
+    u8_lBmsSerial2==ID_SERIAL_DEVICE_SYLCINBMS || u8_lBmsSerial2==ID_SERIAL_DEVICE_GOBELBMS || u8_lBmsSerial2==ID_SERIAL_DEVICE_GOBEL_PC200));
+}
+
+
+/* Übersetzt die Alarmregeln in die Tabelle der aktiven Regeln.
+ * Regeln ohne Trigger, ohne parametriertes Gerät oder ohne Funktion werden nicht übernommen. */
+static void compileAlarmRules(settingsView_s &view)
+{
+  using namespace alarmrules;
+  RuleTable<SETTINGS_VIEW_MAX_ALARM_RULES> &table = view.alarmRules;
+  table.clear();
+
+  // BMS
+  for(uint8_t i=0; i<CNT_BT_ALARMS_RULES; i++)
+  {
+    uint8_t u8_lBmsNr = WebSettings::getInt(ID_PARAM_ALARM_BTDEV_BMS_SELECT,i,DT_ID_PARAM_ALARM_BTDEV_BMS_SELECT);
+    if(u8_lBmsNr==127 || !isAlarmRuleBmsConfigured(view, u8_lBmsNr)) continue; //127='AUS'
+
+    Rule rule = {};
+    rule.source = u8_lBmsNr;
+
+    rule.trigger = WebSettings::getInt(ID_PARAM_ALARM_BTDEV_ALARM_AKTION,i,DT_ID_PARAM_ALARM_BTDEV_ALARM_AKTION);
+    if(rule.trigger>0)
+    {
+      rule.type = RuleType::BMS_NO_DATA;
+      rule.limit = WebSettings::getInt(ID_PARAM_ALARM_BTDEV_ALARM_TIME_OUT,i,DT_ID_PARAM_ALARM_BTDEV_ALARM_TIME_OUT);
+      table.add(rule);
+    }
+
+    rule.trigger = WebSettings::getInt(ID_PARAM_ALARM_BT_CELL_SPG_ALARM_AKTION,i,DT_ID_PARAM_ALARM_BT_CELL_SPG_ALARM_AKTION);
+    uint8_t u8_lCellCount = WebSettings::getInt(ID_PARAM_ALARM_BT_CNT_CELL_CTRL,i,DT_ID_PARAM_ALARM_BT_CNT_CELL_CTRL);
+    if(rule.trigger>0 && u8_lCellCount>0)
+    {
+      rule.type = RuleType::BMS_CELL_VOLTAGE_RANGE;
+      rule.first = 0;
+      rule.last = min(u8_lCellCount, (uint8_t)BMSDATA_MAX_CELLS)-1;
+      rule.low = WebSettings::getInt(ID_PARAM_ALARM_BT_CELL_SPG_MIN,i,DT_ID_PARAM_ALARM_BT_CELL_SPG_MIN);
+      rule.high = WebSettings::getInt(ID_PARAM_ALARM_BT_CELL_SPG_MAX,i,DT_ID_PARAM_ALARM_BT_CELL_SPG_MAX);
+      table.add(rule);
+    }
+
+    rule.trigger = WebSettings::getInt(ID_PARAM_ALARM_BT_GESAMT_SPG_ALARM_AKTION,i,DT_ID_PARAM_ALARM_BT_GESAMT_SPG_ALARM_AKTION);
+    if(rule.trigger>0)
+    {
+      rule.type = RuleType::BMS_TOTAL_VOLTAGE_RANGE;
+      rule.low = WebSettings::getFloat(ID_PARAM_ALARM_BT_GESAMT_SPG_MIN,i);
+      rule.high = WebSettings::getFloat(ID_PARAM_ALARM_BT_GESAMT_SPG_MAX,i);
+      rule.hysteresis = WebSettings::getFloat(ID_PARAM_ALARM_BT_GESAMT_SPG_HYSTERESE,i);
+      table.add(rule);
+    }
+  }
+
+  // Temperatur
+  for(uint8_t i=0; i<COUNT_TEMP_RULES; i++)
+  {
+    Rule rule = {};
+    rule.trigger = WebSettings::getInt(ID_PARAM_TEMP_ALARM_AKTION,i,DT_ID_PARAM_TEMP_ALARM_AKTION);
+    rule.first = WebSettings::getInt(ID_PARAM_TEMP_ALARM_SENSOR_VON,i,DT_ID_PARAM_TEMP_ALARM_SENSOR_VON);
+    rule.last = WebSettings::getInt(ID_PARAM_TEMP_ALARM_SENSOR_BIS,i,DT_ID_PARAM_TEMP_ALARM_SENSOR_BIS);
+    rule.source = WebSettings::getInt(ID_PARAM_TEMP_ALARM_TEMP_QUELLE,i,DT_ID_PARAM_TEMP_ALARM_TEMP_QUELLE);
+    rule.bms = WebSettings::getInt(ID_PARAM_TEMP_ALARM_BMS_QUELLE,i,DT_ID_PARAM_TEMP_ALARM_BMS_QUELLE);
+    rule.limit = WebSettings::getInt(ID_PARAM_TEMP_ALARM_SENSOR_VERGLEICH,i,DT_ID_PARAM_TEMP_ALARM_SENSOR_VERGLEICH);
+    rule.high = WebSettings::getFloat(ID_PARAM_TEMP_ALARM_WERT1,i);
+    rule.hysteresis = WebSettings::getFloat(ID_PARAM_TEMP_ALARM_WERT2,i);
+    if(rule.trigger==0 || rule.last<rule.first) continue;
+    if(rule.last>=MAX_ANZAHL_OW_SENSOREN || rule.limit>=MAX_ANZAHL_OW_SENSOREN || rule.bms>=BMSDATA_NUMBER_ALLDEVICES)
+    {
+      BSC_LOGE(TAG,"Temperature rule %i: invalid sensor",i);
+      continue;
+    }
+
+    switch(WebSettings::getInt(ID_PARAM_TEMP_ALARM_UEBERWACH_FUNKTION,i,DT_ID_PARAM_TEMP_ALARM_UEBERWACH_FUNKTION))
+    {
+      case ID_TEMP_ALARM_FUNKTION_MAXWERT:          rule.type = RuleType::TEMP_MAX; break;
+      case ID_TEMP_ALARM_FUNKTION_MAXWERT_REFERENZ: rule.type = RuleType::TEMP_MAX_REFERENCE; break;
+      case ID_TEMP_ALARM_FUNKTION_DIFFERENZ:        rule.type = RuleType::TEMP_DIFFERENCE; break;
+      default: continue;
+    }
+    table.add(rule);
+  }
+
+  // Onewire Sensorfehler
+  Rule owErrorRule = {};
+  owErrorRule.type = RuleType::OW_SENSOR_ERROR;
+  owErrorRule.trigger = WebSettings::getInt(ID_PARAM_TEMP_SENSOR_TIMEOUT_TRIGGER,0,DT_ID_PARAM_TEMP_SENSOR_TIMEOUT_TRIGGER);
+  owErrorRule.limit = WebSettings::getInt(ID_PARAM_TEMP_SENSOR_TIMEOUT_TIME,0,DT_ID_PARAM_TEMP_SENSOR_TIMEOUT_TIME); //Time in secounds
+  if(owErrorRule.trigger>0) table.add(owErrorRule);
+
+  // Plausibilität der Zellspannungen (serielle BMS)
+  Rule plausibilityRule = {};
+  plausibilityRule.type = RuleType::CELL_VOLTAGE_PLAUSIBILITY;
+  plausibilityRule.trigger = WebSettings::getInt(ID_PARAM_BMS_PLAUSIBILITY_CHECK_CELLVOLTAGE,0,DT_ID_PARAM_BMS_PLAUSIBILITY_CHECK_CELLVOLTAGE);
+  plausibilityRule.first = BT_DEVICES_COUNT;
+  plausibilityRule.last = BT_DEVICES_COUNT+SERIAL_BMS_DEVICES_COUNT-1;
+  plausibilityRule.limit = CYCLES_BMS_VALUES_PLAUSIBILITY_CHECK;
+  if(plausibilityRule.trigger>0) table.add(plausibilityRule);
+
+  // Digitaleingänge
+  for(uint8_t i=0; i<CNT_DIGITALIN; i++)
+  {
+    Rule rule = {};
+    rule.type = RuleType::DIGITAL_INPUT;
+    rule.trigger = WebSettings::getInt(ID_PARAM_DI_ALARM_NR,i,DT_ID_PARAM_DI_ALARM_NR);
+    rule.source = i;
+    if(WebSettings::getBool(ID_PARAM_DI_INVERTIERT,i)) rule.flags |= FLAG_INVERT;
+    if(rule.trigger>0) table.add(rule);
+  }
+
+  // SoC
+  for(uint8_t i=0; i<ANZAHL_RULES_TRIGGER_SOC; i++)
+  {
+    Rule rule = {};
+    rule.type = RuleType::SOC;
+    rule.trigger = WebSettings::getInt(ID_PARAM_TRIGGER_AT_SOC,i,DT_ID_PARAM_TRIGGER_AT_SOC);
+    rule.high = WebSettings::getInt(ID_PARAM_TRIGGER_AT_SOC_ON,i,DT_ID_PARAM_TRIGGER_AT_SOC_ON);
+    rule.low = WebSettings::getInt(ID_PARAM_TRIGGER_AT_SOC_OFF,i,DT_ID_PARAM_TRIGGER_AT_SOC_OFF);
+    if(rule.trigger>0 && rule.high!=rule.low) table.add(rule);
+  }
+}
+
+
+/* Baut die Sicht aus den aktuellen Parametern neu auf und veröffentlicht sie.
+ * Wird nach dem Laden und nach jedem Speichern der Parameter aufgerufen. */
+void settingsViewRebuild()
+{
+  if(mSettingsViewMutex==NULL) mSettingsViewMutex = xSemaphoreCreateMutex();
+
+  // Nur ein Schreiber zur Zeit
+  xSemaphoreTake(mSettingsViewMutex, portMAX_DELAY);
+  uint32_t u32_lStartTime = micros();
+  // Warten, bis ein Puffer von keinem Leser mehr gehalten wird
+  settingsView_s *p_lView;
+  while((p_lView=settingsView.tryWriteBuffer())==NULL) vTaskDelay(pdMS_TO_TICKS(1));
+  settingsView_s &view = *p_lView;
+
+  for(uint8_t i=0; i<BT_DEVICES_COUNT; i++)
+  {
+    view.btDeviceConfigured[i] = (WebSettings::getInt(ID_PARAM_SS_BTDEV,i,DT_ID_PARAM_SS_BTDEV)>0 &&
+      !WebSettings::getString(ID_PARAM_SS_BTDEVMAC,i).equals(""));
+  }
+
+  for(uint8_t i=0; i<SERIAL_BMS_DEVICES_COUNT; i++)
+  {
+    view.serialConnectDevice[i] = WebSettings::getInt(ID_PARAM_SERIAL_CONNECT_DEVICE,i,DT_ID_PARAM_SERIAL_CONNECT_DEVICE);
+    view.packChargeCurrent[i] = WebSettings::getInt(ID_PARAM_BATTERY_PACK_CHARGE_CURRENT,i,DT_ID_PARAM_BATTERY_PACK_CHARGE_CURRENT);
+    view.packDischargeCurrent[i] = WebSettings::getInt(ID_PARAM_BATTERY_PACK_DISCHARGE_CURRENT,i,DT_ID_PARAM_BATTERY_PACK_DISCHARGE_CURRENT);
+  }
+  view.serial2NumberOfBms = WebSettings::getInt(ID_PARAM_SERIAL2_CONNECT_TO_ID,0,DT_ID_PARAM_SERIAL2_CONNECT_TO_ID);
+  view.bmsPollIntervalMin = WebSettings::getInt(ID_PARAM_BMS_POLL_INTERVAL_MIN,0,DT_ID_PARAM_BMS_POLL_INTERVAL_MIN);
+  view.bmsPollIntervalMax = WebSettings::getInt(ID_PARAM_BMS_POLL_INTERVAL_MAX,0,DT_ID_PARAM_BMS_POLL_INTERVAL_MAX);
+  view.plausibilityCheckCellVoltage = WebSettings::getInt(ID_PARAM_BMS_PLAUSIBILITY_CHECK_CELLVOLTAGE,0,DT_ID_PARAM_BMS_PLAUSIBILITY_CHECK_CELLVOLTAGE);
+  view.displayBulkData = WebSettings::getBool(ID_PARAM_DISPLAY_BULK_DATA,0);
+
+  compileAlarmRules(view);
+
+  view.canEnable = WebSettings::getBool(ID_PARAM_BMS_CAN_ENABLE,0);
+  view.canExtendedDataEnable = WebSettings::getBool(ID_PARAM_BMS_CAN_EXTENDED_DATA_ENABLE,0);
+  view.canExtendedDataFrames = WebSettings::getInt(ID_PARAM_BMS_CAN_EXTENDED_DATA_FRAMES,0,DT_ID_PARAM_BMS_CAN_EXTENDED_DATA_FRAMES);
+  view.canBmsDatasource = WebSettings::getInt(ID_PARAM_BMS_CAN_DATASOURCE,0,DT_ID_PARAM_BMS_CAN_DATASOURCE);
+
+  view.maxChargeVoltage = WebSettings::getFloat(ID_PARAM_BMS_MAX_CHARGE_SPG,0);
+  view.maxChargeCurrent = WebSettings::getInt(ID_PARAM_BMS_MAX_CHARGE_CURRENT,0,DT_ID_PARAM_BMS_MAX_CHARGE_CURRENT);
+  view.maxDischargeCurrent = WebSettings::getInt(ID_PARAM_BMS_MAX_DISCHARGE_CURRENT,0,DT_ID_PARAM_BMS_MAX_DISCHARGE_CURRENT);
+
+  view.socBelowCellVoltageEn = WebSettings::getBool(ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_EN,0);
+  view.socBelowCellVoltage = WebSettings::getInt(ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG,0,DT_ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG);
+  view.socBelowCellVoltageEnd = WebSettings::getInt(ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG_END,0,DT_ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SPG_END);
+  view.socBelowCellVoltageTime = WebSettings::getInt(ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_TIME,0,DT_ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_TIME);
+  view.socBelowCellVoltageSoc = WebSettings::getInt(ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SOC,0,DT_ID_PARAM_INVERTER_SOC_BELOW_ZELLSPANNUNG_SOC);
+
+  view.chargeCellVoltageEn = WebSettings::getBool(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_EN,0);
+  view.chargeCellVoltageStart = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_STARTSPG,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_STARTSPG);
+  view.chargeCellVoltageEnd = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_ENDSPG,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_ENDSPG);
+  view.chargeCellVoltageMinCurrent = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_MINDEST_STROM,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLSPG_MINDEST_STROM);
+
+  view.chargeCellDriftEn = WebSettings::getBool(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_ZELLDRIFT_EN,0);
+  view.chargeCellDriftStart = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_STARTABWEICHUNG,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_STARTABWEICHUNG);
+  view.chargeCellDriftStartCellVoltage = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_STARTSPG_ZELLE,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_STARTSPG_ZELLE);
+  view.chargeCellDriftAPerMv = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_A_PRO_MV,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_A_PRO_MV);
+
+  view.chargeSocEn = WebSettings::getBool(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_SOC_EN,0);
+  view.chargeSocStart = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_AB_SOC,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_AB_SOC);
+  view.chargeSocAPerPercent = WebSettings::getInt(ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_A_PRO_PERCENT_SOC,0,DT_ID_PARAM_INVERTER_LADESTROM_REDUZIEREN_A_PRO_PERCENT_SOC);
+
+  view.dischargeCellVoltageStart = WebSettings::getInt(ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_STARTSPG,0,DT_ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_STARTSPG);
+  view.dischargeCellVoltageEnd = WebSettings::getInt(ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_ENDSPG,0,DT_ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_ENDSPG);
+  view.dischargeCellVoltageMinCurrent = WebSettings::getInt(ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_MINDEST_STROM,0,DT_ID_PARAM_INVERTER_ENTLADESTROM_REDUZIEREN_ZELLSPG_MINDEST_STROM);
+
+  view.chargeCutOffTime = WebSettings::getInt(ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_TIME,0,DT_ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_TIME);
+  view.chargeCutOffCurrent = WebSettings::getFloat(ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_CURRENT,0);
+  view.chargeCutOffSoc = WebSettings::getInt(ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_SOC,0,DT_ID_PARAM_INVERTER_CHARGE_CURRENT_CUT_OFF_SOC);
+
+  view.chargeVoltageDynamicEn = WebSettings::getBool(ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_EN,0);
+  view.chargeVoltageDynamicCellVoltage = WebSettings::getInt(ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_ZELLSPG,0,DT_ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_ZELLSPG);
+  view.chargeVoltageDynamicDelta = WebSettings::getInt(ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_DELTA,0,DT_ID_PARAM_INVERTER_CHARGE_VOLTAGE_DYNAMIC_REDUCE_DELTA);
+
+  for(uint8_t i=0; i<MAX_ANZAHL_OW_SENSOREN; i++)
+  {
+    view.owTempOffset[i] = WebSettings::getFloat(ID_PARAM_ONWIRE_TEMP_OFFSET,i);
+    view.owResolution[i] = WebSettings::getInt(ID_PARAM_ONWIRE_RESOLUTION,i,DT_ID_PARAM_ONWIRE_RESOLUTION);
+    view.owRefreshInterval[i] = WebSettings::getInt(ID_PARAM_ONWIRE_REFRESH_INTERVAL,i,DT_ID_PARAM_ONWIRE_REFRESH_INTERVAL);
+  }
+
+  view.recordValuesEn = (WebSettings::getInt(ID_PARAM_SYSTEM_RECORD_VALUES_PERIODE,0,DT_ID_PARAM_SYSTEM_RECORD_VALUES_PERIODE)>0);
+  view.recordValuesTierPeriod[0] = WebSettings::getInt(ID_PARAM_SYSTEM_RECORD_VALUES_TIER0_PERIODE,0,DT_ID_PARAM_SYSTEM_RECORD_VALUES_TIER0_PERIODE);
+  view.recordValuesTierPeriod[1] = WebSettings::getInt(ID_PARAM_SYSTEM_RECORD_VALUES_TIER1_PERIODE,0,DT_ID_PARAM_SYSTEM_RECORD_VALUES_TIER1_PERIODE);
+  view.recordValuesTierPeriod[2] = WebSettings::getInt(ID_PARAM_SYSTEM_RECORD_VALUES_TIER2_PERIODE,0,DT_ID_PARAM_SYSTEM_RECORD_VALUES_TIER2_PERIODE);
+
+  settingsView.publish();
+  BSC_LOGI(TAG,"Rebuild: generation=%i, alarm rules=%i, time=%ius", settingsView.generation(), view.alarmRules.size(), micros()-u32_lStartTime);
+  xSemaphoreGive(mSettingsViewMutex);
+}
+
+
+const settingsView_s* settingsViewAcquire()
+{
+  return settingsView.acquire();
+}
+
+
+void settingsViewRelease(const settingsView_s *p_view)
+{
+  settingsView.release(p_view);
+}
+
+
+uint32_t getSettingsViewGeneration()
+{
+  return settingsView.generation();
+}
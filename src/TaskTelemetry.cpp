@@ -0,0 +1,74 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include "TaskTelemetry.h"
+#include "BscSerial.h"
+
+static_assert(TASK_ID_I2C-TASK_ID_SERIAL==SERIAL_PORT_GROUP_COUNT, "One task id per serial port group");
+
+static SemaphoreHandle_t mTaskTelemetryMutex = NULL;
+
+struct taskTelemetry_s
+{
+  TaskHandle_t handle = NULL;
+  bool measured = false;
+  utils::TaskMonitor monitor{utils::TaskMonitor::DEFAULT_WINDOW_US};
+};
+static taskTelemetry_s taskTelemetry[TASK_TELEMETRY_COUNT];
+
+
+void taskTelemetryInit()
+{
+  mTaskTelemetryMutex = xSemaphoreCreateMutex();
+}
+
+
+/* Wird vom Task selbst aufgerufen */
+void taskTelemetryRegister(uint8_t taskId)
+{
+  if(taskId>=TASK_TELEMETRY_COUNT) return;
+  taskTelemetry[taskId].handle = xTaskGetCurrentTaskHandle();
+}
+
+
+void taskTelemetryBegin(uint8_t taskId)
+{
+  if(taskId>=TASK_TELEMETRY_COUNT || mTaskTelemetryMutex==NULL) return;
+  uint32_t u32_lNowUs = micros();
+  xSemaphoreTake(mTaskTelemetryMutex, portMAX_DELAY);
+  taskTelemetry[taskId].measured = true;
+  taskTelemetry[taskId].monitor.begin(u32_lNowUs);
+  xSemaphoreGive(mTaskTelemetryMutex);
+}
+
+
+void taskTelemetryEnd(uint8_t taskId)
+{
+  if(taskId>=TASK_TELEMETRY_COUNT || mTaskTelemetryMutex==NULL) return;
+  uint32_t u32_lNowUs = micros();
+  xSemaphoreTake(mTaskTelemetryMutex, portMAX_DELAY);
+  taskTelemetry[taskId].monitor.end(u32_lNowUs);
+  xSemaphoreGive(mTaskTelemetryMutex);
+}
+
+
+/* Liefert false, wenn der Task (noch) nicht läuft */
+bool taskTelemetryGetStatistics(uint8_t taskId, struct taskStatistics_s &stats)
+{
+  memset(&stats, 0, sizeof(stats));
+  if(taskId>=TASK_TELEMETRY_COUNT || mTaskTelemetryMutex==NULL) return false;
+
+  TaskHandle_t handle = taskTelemetry[taskId].handle;
+  if(handle==NULL) return false;
+
+  stats.name = pcTaskGetName(handle);
+  stats.stackFree = uxTaskGetStackHighWaterMark(handle); //ESP32: in Byte
+
+  xSemaphoreTake(mTaskTelemetryMutex, portMAX_DELAY);
+  stats.measured = taskTelemetry[taskId].measured;
+  stats.runtime = taskTelemetry[taskId].monitor.statistics();
+  xSemaphoreGive(mTaskTelemetryMutex);
+  return true;
+}
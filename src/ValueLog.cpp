@@ -0,0 +1,345 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include "ValueLog.h"
+#include "defines.h"
+#include <FS.h>
+#ifdef USE_LittleFS
+  #define SPIFFS LittleFS
+  #include <LittleFS.h>
+#else
+  #include <SPIFFS.h>
+#endif
+#include "log.h"
+#include "bscTime.h"
+#include "BmsData.h"
+#include "Canbus.h"
+#include "Ow.h"
+#include "SettingsView.h"
+#include "webUtility.h"
+#include <utils/TimeSeries.hpp>
+
+static const char *TAG = "VALUELOG";
+
+#define VALUE_LOG_MIN_EPOCH       1700000000 // Vorher ist die Uhrzeit noch nicht per NTP gesetzt
+#define VALUE_LOG_HTTP_CHUNK_SIZE 512
+#define VALUE_LOG_HTTP_MAX        10000      // Max. Anzahl Datensätze pro Abruf
+#define VALUE_LOG_LEGACY_FILE     "/values"  // Bisheriges Format (1 Datensatz pro Minute des Tages)
+#define VALUE_LOG_LEGACY_FILE1    "/values1" // Bisheriges Format, Vortag
+
+/* Zugriff auf eine Datei über Offsets; wird vom TimeSeriesStore genutzt. Aufruf nur mit fsLock(). */
+class ValueLogFile
+{
+  public:
+  void open(const char *path)
+  {
+    _file = SPIFFS.open(path, SPIFFS.exists(path) ? "r+" : "w+");
+    if(!_file) BSC_LOGE(TAG,"open failed: %s",path);
+  }
+
+  void close()
+  {
+    if(_file) _file.close();
+  }
+
+  bool read(uint32_t offset, void *data, size_t len)
+  {
+    if(!_file || !_file.seek(offset, SeekSet)) return false;
+    return _file.read((uint8_t*)data, len)==len;
+  }
+
+  bool write(uint32_t offset, const void *data, size_t len)
+  {
+    if(!_file || !_file.seek(offset, SeekSet)) return false;
+    bool ok = (_file.write((const uint8_t*)data, len)==len);
+    _file.flush();
+    return ok;
+  }
+
+  private:
+  File _file;
+};
+
+using valueLogRecord_t = utils::TimeSeriesRecord<VALUE_LOG_CHANNELS>;
+using valueLogAggregator_t = utils::TimeSeriesAggregator<VALUE_LOG_CHANNELS>;
+
+/* Kanäle der Aufzeichnung; die ersten 9 entsprechen der bisherigen Aufzeichnung */
+static const valueLogChannel_s valueLogChannels[] = {
+  {VALUE_LOG_INVERTER_CURRENT, 0},
+  {VALUE_LOG_INVERTER_VOLTAGE, 0},
+  {VALUE_LOG_INVERTER_SOC, 0},
+  {VALUE_LOG_INVERTER_CHARGE_CURRENT, 0},
+  {VALUE_LOG_INVERTER_DISCHARGE_CURRENT, 0},
+  {VALUE_LOG_CALC_CHARGE_CURRENT_CELLVOLTAGE, 0},
+  {VALUE_LOG_CALC_CHARGE_CURRENT_SOC, 0},
+  {VALUE_LOG_CALC_CHARGE_CURRENT_CELLDRIFT, 0},
+  {VALUE_LOG_CALC_CHARGE_CURRENT_CUTOFF, 0},
+  {VALUE_LOG_BMS_TOTAL_VOLTAGE, VALUE_LOG_BMS_DATASOURCE},
+  {VALUE_LOG_BMS_TOTAL_CURRENT, VALUE_LOG_BMS_DATASOURCE},
+  {VALUE_LOG_BMS_SOC, VALUE_LOG_BMS_DATASOURCE},
+  {VALUE_LOG_BMS_MAX_CELL_VOLTAGE, VALUE_LOG_BMS_DATASOURCE},
+  {VALUE_LOG_BMS_MIN_CELL_VOLTAGE, VALUE_LOG_BMS_DATASOURCE},
+  {VALUE_LOG_OW_TEMPERATURE, 0},
+};
+static_assert(sizeof(valueLogChannels)/sizeof(valueLogChannels[0])==VALUE_LOG_CHANNELS, "VALUE_LOG_CHANNELS does not match the channel table");
+
+/* Stufen: Dauer, Standard-Intervall, Anzahl Datensätze, die im RAM gesammelt werden.
+ * Die Anzahl Datensätze in der Datei ergibt sich aus Dauer/Intervall. */
+template<size_t BATCH>
+struct valueLogTier_s
+{
+  valueLogTier_s(const char *path, uint32_t durationS, uint32_t defaultPeriodS) : path(path), durationS(durationS),
+    defaultPeriodS(defaultPeriodS), aggregator(defaultPeriodS), store(file, durationS/defaultPeriodS) {}
+
+  const char *path;
+  const uint32_t durationS;
+  const uint32_t defaultPeriodS;
+  bool open {false};
+  ValueLogFile file;
+  valueLogAggregator_t aggregator;
+  utils::TimeSeriesStore<valueLogRecord_t, ValueLogFile, BATCH> store;
+};
+
+static valueLogTier_s<60> valueLogTier0("/values_1s", 600, 1);       // 10 Minuten, bei 1s alle 60s schreiben
+static valueLogTier_s<10> valueLogTier1("/values_1m", 86400, 60);    // 24 Stunden, bei 1min alle 10min schreiben
+static valueLogTier_s<4>  valueLogTier2("/values_15m", 604800, 900); // 7 Tage, bei 15min jede Stunde schreiben
+
+static SemaphoreHandle_t mValueLogMutex = NULL;
+static bool bo_mValueLogInitialized = false;
+static bool bo_mValueLogLegacyPresent = false;
+static uint32_t u32_mLastEpoch = 0;
+
+
+/* Aufruf der Funktion für alle Stufen */
+template<typename FUNC>
+static void forEachTier(FUNC func)
+{
+  func(0, valueLogTier0);
+  func(1, valueLogTier1);
+  func(2, valueLogTier2);
+}
+
+
+/* Liest die Werte aller Kanäle; die BMS-Kanäle vom BMS der CAN Datenquelle */
+static void getChannelValues(int16_t (&values)[VALUE_LOG_CHANNELS], uint8_t u8_bmsDatasource)
+{
+  BmsDataSnapshot bmsSnapshot;
+  getBmsDataSnapshot(u8_bmsDatasource, bmsSnapshot);
+
+  inverterDataSemaphoreTake();
+  inverterData_s *inverterData = getInverterData();
+  for(uint8_t i=0;i<VALUE_LOG_CHANNELS;i++)
+  {
+    const valueLogChannel_s &channel = valueLogChannels[i];
+    switch(channel.value)
+    {
+      case VALUE_LOG_INVERTER_CURRENT: values[i] = inverterData->inverterCurrent; break;
+      case VALUE_LOG_INVERTER_VOLTAGE: values[i] = inverterData->inverterVoltage; break;
+      case VALUE_LOG_INVERTER_SOC: values[i] = inverterData->inverterSoc; break;
+      case VALUE_LOG_INVERTER_CHARGE_CURRENT: values[i] = inverterData->inverterChargeCurrent; break;
+      case VALUE_LOG_INVERTER_DISCHARGE_CURRENT: values[i] = inverterData->inverterDischargeCurrent; break;
+      case VALUE_LOG_CALC_CHARGE_CURRENT_CELLVOLTAGE: values[i] = inverterData->calcChargeCurrentCellVoltage; break;
+      case VALUE_LOG_CALC_CHARGE_CURRENT_SOC: values[i] = inverterData->calcChargeCurrentSoc; break;
+      case VALUE_LOG_CALC_CHARGE_CURRENT_CELLDRIFT: values[i] = inverterData->calcChargeCurrentCelldrift; break;
+      case VALUE_LOG_CALC_CHARGE_CURRENT_CUTOFF: values[i] = inverterData->calcChargeCurrentCutOff; break;
+      case VALUE_LOG_BMS_TOTAL_VOLTAGE: values[i] = bmsSnapshot.totalVoltage; break;
+      case VALUE_LOG_BMS_TOTAL_CURRENT: values[i] = bmsSnapshot.totalCurrent; break;
+      case VALUE_LOG_BMS_SOC: values[i] = bmsSnapshot.chargePercentage; break;
+      case VALUE_LOG_BMS_MAX_CELL_VOLTAGE: values[i] = bmsSnapshot.maxCellVoltage; break;
+      case VALUE_LOG_BMS_MIN_CELL_VOLTAGE: values[i] = bmsSnapshot.minCellVoltage; break;
+      case VALUE_LOG_OW_TEMPERATURE: values[i] = (int16_t)(owGetTemp(channel.index)*10); break; // 0.1°C
+    }
+  }
+  inverterDataSemaphoreGive();
+}
+
+
+/* Öffnet die Datei der Stufe mit dem eingestellten Intervall und liest den Header.
+ * Wurde das Intervall geändert, wird die Datei neu angelegt. Neue Dateien werden nur angelegt,
+ * wenn bo_create gesetzt ist. Aufruf nur mit fsLock(). */
+template<typename TIER>
+static void openTier(uint8_t tier, TIER &t, const settingsView_s &settings, bool bo_create)
+{
+  uint32_t u32_lPeriodS = settings.recordValuesTierPeriod[tier];
+  if(u32_lPeriodS==0 || u32_lPeriodS>t.durationS) u32_lPeriodS = t.defaultPeriodS;
+  if(t.open && t.aggregator.periodS()==u32_lPeriodS) return;
+
+  if(t.open)
+  {
+    // Intervall geändert; die bisherigen Datensätze passen nicht mehr zur Stufe
+    t.file.close();
+    SPIFFS.remove(t.path);
+    t.open = false;
+  }
+  if(!bo_create && !SPIFFS.exists(t.path)) return;
+
+  t.aggregator.setPeriod(u32_lPeriodS);
+  t.store.setCapacity(t.durationS/u32_lPeriodS);
+  t.file.open(t.path);
+  const uint32_t u32_lLayout = ((uint32_t)VALUE_LOG_VERSION<<24) | u32_lPeriodS;
+  bool restored = t.store.begin(u32_lLayout);
+  t.open = true;
+  BSC_LOGI(TAG,"Tier %i: %s, period=%is, records=%i/%i (%s)", tier, t.path, u32_lPeriodS, t.store.size(), t.store.capacity(), restored ? "restored" : "new");
+}
+
+
+/* Die Dateien werden beim ersten Zugriff geöffnet, da das Intervall der Stufen aus der Settings-Sicht kommt.
+ * Neue Dateien werden erst angelegt, wenn die Aufzeichnung aktiviert ist.
+ * Die Dateien des bisherigen Formats bleiben unter /valueslog_legacy abrufbar, bis die neue Aufzeichnung
+ * einen ganzen Tag enthält. */
+void valueLogInit()
+{
+  mValueLogMutex = xSemaphoreCreateMutex();
+
+  fsLock();
+  bo_mValueLogLegacyPresent = SPIFFS.exists(VALUE_LOG_LEGACY_FILE) || SPIFFS.exists(VALUE_LOG_LEGACY_FILE1);
+  fsUnlock();
+
+  bo_mValueLogInitialized = true;
+}
+
+
+/* Löscht die Dateien des bisherigen Formats, sobald die Stufe 24 Stunden einen ganzen Tag enthält. Aufruf nur mit fsLock(). */
+static void removeLegacyFiles()
+{
+  if(!bo_mValueLogLegacyPresent || valueLogTier1.store.size()<valueLogTier1.store.capacity()) return;
+
+  if(SPIFFS.exists(VALUE_LOG_LEGACY_FILE)) SPIFFS.remove(VALUE_LOG_LEGACY_FILE);
+  if(SPIFFS.exists(VALUE_LOG_LEGACY_FILE1)) SPIFFS.remove(VALUE_LOG_LEGACY_FILE1);
+  bo_mValueLogLegacyPresent = false;
+  BSC_LOGI(TAG,"Legacy value log removed");
+}
+
+
+/* Sendet die Datei des bisherigen Formats (heute), solange sie vorhanden ist */
+void valueLogHandleLegacyRequest(WebServer * server)
+{
+  if(!bo_mValueLogLegacyPresent || !handleFileRead(SPIFFS, *server, true, VALUE_LOG_LEGACY_FILE))
+  {
+    server->send(404, "text/plain", "FileNotFound");
+  }
+}
+
+
+/* Wird aus dem loop() aufgerufen; nimmt einmal pro Sekunde die Werte auf */
+void valueLogCyclicRun()
+{
+  if(!bo_mValueLogInitialized) return;
+
+  uint32_t u32_lEpoch = getEpoch();
+  if(u32_lEpoch==u32_mLastEpoch || u32_lEpoch<VALUE_LOG_MIN_EPOCH) return;
+  u32_mLastEpoch=u32_lEpoch;
+
+  SettingsViewRef settings;
+  if(!settings->recordValuesEn) return;
+
+  int16_t values[VALUE_LOG_CHANNELS];
+  getChannelValues(values, settings->canBmsDatasource);
+
+  xSemaphoreTake(mValueLogMutex, portMAX_DELAY);
+  fsLock();
+  forEachTier([&](uint8_t tier, auto &t)
+  {
+    openTier(tier, t, *settings, true);
+    valueLogRecord_t record;
+    if(t.aggregator.add(u32_lEpoch, values, record)) t.store.append(record); // Schreibt, wenn der Batch voll ist
+  });
+  removeLegacyFiles();
+  fsUnlock();
+  xSemaphoreGive(mValueLogMutex);
+}
+
+
+/* Schreibt die im RAM gesammelten Datensätze (z.B. vor einem Neustart) */
+void valueLogFlush()
+{
+  if(!bo_mValueLogInitialized) return;
+
+  xSemaphoreTake(mValueLogMutex, portMAX_DELAY);
+  fsLock();
+  forEachTier([](uint8_t tier, auto &t) { t.store.flush(); });
+  fsUnlock();
+  xSemaphoreGive(mValueLogMutex);
+}
+
+
+void valueLogGetStatistics(struct valueLogStatistics_s &stats)
+{
+  memset(&stats, 0, sizeof(stats));
+  if(!bo_mValueLogInitialized) return;
+
+  xSemaphoreTake(mValueLogMutex, portMAX_DELAY);
+  forEachTier([&](uint8_t tier, auto &t)
+  {
+    stats.records[tier] = t.store.size();
+    stats.writes[tier] = t.store.writes();
+    stats.bytesWritten[tier] = t.store.bytesWritten();
+    stats.dropped[tier] = t.store.dropped();
+  });
+  xSemaphoreGive(mValueLogMutex);
+}
+
+
+/* Sendet die Datensätze einer Stufe im angefragten Zeitbereich.
+ * Es werden immer nur so viele Datensätze gelesen, wie in den Puffer passen; Datei und Mutex sind
+ * während des Sendens nicht gesperrt. */
+void valueLogHandleRequest(WebServer * server)
+{
+  uint8_t u8_lTier = server->hasArg("tier") ? server->arg("tier").toInt() : 1;
+  uint32_t u32_lFrom = server->hasArg("from") ? strtoul(server->arg("from").c_str(), NULL, 10) : 0;
+  uint32_t u32_lTo = server->hasArg("to") ? strtoul(server->arg("to").c_str(), NULL, 10) : UINT32_MAX;
+  uint32_t u32_lMax = server->hasArg("max") ? strtoul(server->arg("max").c_str(), NULL, 10) : VALUE_LOG_HTTP_MAX;
+  if(u32_lMax==0 || u32_lMax>VALUE_LOG_HTTP_MAX) u32_lMax=VALUE_LOG_HTTP_MAX;
+
+  if(!bo_mValueLogInitialized || u8_lTier>=VALUE_LOG_TIERS)
+  {
+    server->send(404, "text/plain", "FileNotFound");
+    return;
+  }
+
+  server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server->send(200, "application/octet-stream", "");
+
+  forEachTier([&](uint8_t tier, auto &t)
+  {
+    if(tier!=u8_lTier) return;
+
+    xSemaphoreTake(mValueLogMutex, portMAX_DELAY);
+    fsLock();
+    openTier(tier, t, *SettingsViewRef(), false);
+    fsUnlock();
+    xSemaphoreGive(mValueLogMutex);
+
+    const uint16_t header[4] = {VALUE_LOG_VERSION, VALUE_LOG_CHANNELS, (uint16_t)sizeof(valueLogRecord_t), (uint16_t)t.aggregator.periodS()};
+    server->sendContent((const char*)header, sizeof(header));
+    server->sendContent((const char*)valueLogChannels, sizeof(valueLogChannels));
+
+    constexpr uint32_t RECORDS_PER_CHUNK = VALUE_LOG_HTTP_CHUNK_SIZE/sizeof(valueLogRecord_t);
+    static_assert(RECORDS_PER_CHUNK>0, "VALUE_LOG_HTTP_CHUNK_SIZE too small");
+    valueLogRecord_t chunk[RECORDS_PER_CHUNK];
+    uint32_t u32_lSent = 0;
+
+    while(u32_lSent<u32_lMax && u32_lFrom<=u32_lTo)
+    {
+      uint32_t u32_lMaxChunk = u32_lMax-u32_lSent;
+      if(u32_lMaxChunk>RECORDS_PER_CHUNK) u32_lMaxChunk=RECORDS_PER_CHUNK;
+
+      uint32_t n=0;
+      xSemaphoreTake(mValueLogMutex, portMAX_DELAY);
+      fsLock();
+      t.store.readRange(u32_lFrom, u32_lTo, [&](const valueLogRecord_t &record) { chunk[n++] = record; }, u32_lMaxChunk);
+      fsUnlock();
+      xSemaphoreGive(mValueLogMutex);
+
+      if(n==0) break;
+      server->sendContent((const char*)chunk, n*sizeof(valueLogRecord_t));
+      u32_lSent+=n;
+      if(chunk[n-1].time==UINT32_MAX) break;
+      u32_lFrom=chunk[n-1].time+1;
+    }
+  });
+
+  server->sendContent("");
+}
@@ -39,15 +39,15 @@ static sparse_hash_map<uint16_t, std::string> settingValues_str;
 static char _buf[2000];
 static String st_mSendBuf = "";
 static String str_lTmpGetString;
-std::vector<String> mOptions;
-std::vector<String> mOptionLabels;
 bool bo_hasNewKeys=false;
 
 uint8_t u8_mAktOptionGroupNr;
-static Json json;
 
 static Preferences prefs;
 
+//Wird aufgerufen, wenn Parameter gespeichert oder über setParameter() geändert wurden
+static void (*fn_mOnParameterChanged)() = NULL;
+
 //HTML templates
 const char HTML_START[] PROGMEM = R"rawliteral(
 <!DOCTYPE HTML>
@@ -177,7 +177,7 @@ WebSettings::WebSettings() {
 };
 
 
-void WebSettings::initWebSettings(const char *parameter, String confName, String configfile)
+void WebSettings::initWebSettings(const char *parameter, const paramIdx_s &paramIdx, String confName, String configfile)
 {
   static bool paramFileRead=false;
   u8_mJsonArraySize = 0;
@@ -185,6 +185,7 @@ void WebSettings::initWebSettings(const char *parameter, String confName, String
   str_mConfigfile = configfile.c_str();
 
   parameterFile = parameter;
+  mParamIdx = &paramIdx;
 
   if (!SPIFFS.begin())
   {
@@ -209,7 +210,7 @@ void WebSettings::initWebSettings(const char *parameter, String confName, String
     paramFileRead=true;
     readConfig();
   }
-  getDefaultValuesFromNewKeys(parameterFile, 8);
+  getDefaultValuesFromNewKeys(0, mParamIdx->pageCnt);
 
   if(bo_hasNewKeys) 
   {
@@ -261,7 +262,7 @@ void WebSettings::handleHtmlFormRequest(WebServer * server)
   std::vector<String> options;
   std::vector<String> optionLabels;
 
-  if(json.getArraySize(parameterFile, 8)==0)
+  if(mParamIdx->pageCnt==0)
   {
     BSC_LOGI(TAG,"Error read json");
   }
@@ -383,7 +384,7 @@ void WebSettings::handleHtmlFormRequest(WebServer * server)
       sprintf(_buf,HTML_START_2,str_mConfName.c_str());
       sendContentHtml(server,_buf,false);
 
-      buildSendHtml(server, parameterFile, 8);
+      buildSendHtml(server, 0, mParamIdx->pageCnt);
 
       sendContentHtml(server,HTML_END_1,false);
 
@@ -472,10 +473,10 @@ void WebSettings::readWebValues(WebServer * server, const String *parameter, uin
 }
 #endif
 
-void WebSettings::buildSendHtml(WebServer * server, const char *parameter, uint32_t jsonStartPos)
+void WebSettings::buildSendHtml(WebServer * server, uint16_t u16_first, uint16_t u16_cnt)
 {
-  uint8_t g, optionsCnt, optionGroupSize, jsonSize, u8_dataType, u8_jsonLabelOffset;
-  uint16_t u32_jsonName, jsonNameBase;
+  uint8_t g, optionGroupSize, u8_dataType;
+  uint16_t u32_jsonName;
   uint64_t u64_jsonName;
   String jsonLabel, st_jsonLabelEntry, strlHelp;
   boolean bo_lIsGroup, bo_loadFromFlash;
@@ -484,40 +485,34 @@ void WebSettings::buildSendHtml(WebServer * server, const char *parameter, uint3
   bo_loadFromFlash=false;
   u8_dataType=0;
 
-  for (uint8_t a=0; a<json.getArraySize(parameter, jsonStartPos); a++)
+  for (uint16_t a=u16_first; a<u16_first+u16_cnt; a++)
   {
+    const paramIdxEntry_s &entry = mParamIdx->entries[a];
     u64_jsonName = 0;
-    jsonLabel = getJsonLabel(parameter, a, jsonStartPos);
-    jsonNameBase = getJsonName(parameter, a, jsonStartPos);
+    jsonLabel = getIdxString(entry.label, "");
 
     bo_loadFromFlash=false;
     u8_dataType=0;
-    u32_jsonName = getParmId(jsonNameBase,u8_mAktOptionGroupNr);
+    u32_jsonName = getParmId(entry.name,u8_mAktOptionGroupNr);
     u64_jsonName = u32_jsonName;
 
     //Load from RAM or Flash
-    u8_dataType = (uint8_t)getJson_Key(parameter, "dt", a, jsonStartPos, "").toInt();
+    u8_dataType = entry.dt;
     u64_jsonName = u64_jsonName | ((uint64_t)u8_dataType<<32); // | (1ULL<<40);
-    if(getJson_Key(parameter, "flash", a, jsonStartPos, "").equals("1"))
+    if(entry.flash==1)
     {
       u64_jsonName |= (1ULL<<40);
       bo_loadFromFlash=true;
     }
 
-    uint8_t u8_lJsonType = getJsonType(parameter, a, jsonStartPos);
-    uint16_t u16_lDepId;
-    uint8_t u8_lDepVal, u8_lDepDt;
+    uint8_t u8_lJsonType = entry.type;
     switch(u8_lJsonType)
     {
       case HTML_OPTIONGROUP:
       case HTML_OPTIONGROUP_COLLAPSIBLE:
         //bo_lIsGroup=true;
-        st_jsonLabelEntry = getJsonLabelEntry(parameter, a, jsonStartPos);
-        u8_jsonLabelOffset = getJson_Key(parameter, "label_offset", a, jsonStartPos, "0").toInt();
-        optionGroupSize = getJsonGroupsize(parameter, a, jsonStartPos);
-        u16_lDepId = (uint16_t)getJson_Key(parameter, "depId", a, jsonStartPos, "0").toInt(); //depence
-        u8_lDepVal = (uint8_t)getJson_Key(parameter, "depVal", a, jsonStartPos, "0").toInt();
-        u8_lDepDt = (uint8_t)getJson_Key(parameter, "depDt", a, jsonStartPos, "1").toInt();
+        st_jsonLabelEntry = getIdxString(entry.labelEntry, "");
+        optionGroupSize = entry.groupsize;
         if(optionGroupSize>1 && !jsonLabel.equals(""))
         {
           if(u8_lJsonType==HTML_OPTIONGROUP_COLLAPSIBLE) sprintf(_buf,HTML_GROUP_START_DETAILS,jsonLabel.c_str());
@@ -527,17 +522,14 @@ void WebSettings::buildSendHtml(WebServer * server, const char *parameter, uint3
         for(g=0; g<optionGroupSize; g++)
         {
           u8_mAktOptionGroupNr=g;
-          //BSC_LOGI(TAG,"u16_lDepId=%i, u8_lDepVal=%i, u8_lDepDt=%i, g=%i, val=%i",u16_lDepId,u8_lDepVal,u8_lDepDt,g,getInt(u16_lDepId,g,u8_lDepDt));
-          if(getInt(u16_lDepId,g,u8_lDepDt)!=u8_lDepVal) continue; //depence
+          //BSC_LOGI(TAG,"depId=%i, depVal=%i, depDt=%i, g=%i, val=%i",entry.depId,entry.depVal,entry.depDt,g,getInt(entry.depId,g,entry.depDt));
+          if(getInt(entry.depId,g,entry.depDt)!=entry.depVal) continue; //depence
           //BSC_LOGI(TAG,"DEP OK");
 
-          sprintf(_buf,"<tr><td colspan='3'><b>%s %i</b></td></tr>",st_jsonLabelEntry.c_str(), g+u8_jsonLabelOffset);
+          sprintf(_buf,"<tr><td colspan='3'><b>%s %i</b></td></tr>",st_jsonLabelEntry.c_str(), g+entry.labelOffset);
           sendContentHtml(server,_buf,false);
 
-          String retStr;
-          uint32_t jsonArrayGroupStart = 0;
-          bool ret = json.getValue(parameter, a, "group", jsonStartPos, retStr, jsonArrayGroupStart);
-          buildSendHtml(server, parameter, jsonArrayGroupStart);
+          buildSendHtml(server, entry.childFirst, entry.childCnt);
 
           sprintf(_buf,"<tr><td colspan='3'><hr style='border:none; border-top:1px dashed black; height:1px; color:#000000; background:transparent'></td></tr>");
           sendContentHtml(server,_buf,false);
@@ -550,70 +542,77 @@ void WebSettings::buildSendHtml(WebServer * server, const char *parameter, uint3
         u8_mAktOptionGroupNr = 0;
         break;
       case HTML_INPUTTEXT:
-        createHtmlTextfield(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,parameter,a,jsonStartPos,"text",getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
+        createHtmlTextfield(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,entry,"text",getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
         break;
       case HTML_INPUTTEXTAREA:
-        createHtmlTextarea(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,parameter,a,jsonStartPos,getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
+        createHtmlTextarea(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,entry,getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
           break;
       case HTML_INPUTPASSWORD:
-        createHtmlTextfield(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,parameter,a,jsonStartPos,"password",getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
+        createHtmlTextfield(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,entry,"password",getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
         break;
       case HTML_INPUTDATE:
-        createHtmlTextfield(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,parameter,a,jsonStartPos,"date",getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
+        createHtmlTextfield(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,entry,"date",getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
         break;
       case HTML_INPUTTIME:
-        createHtmlTextfield(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,parameter,a,jsonStartPos,"time",getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
+        createHtmlTextfield(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,entry,"time",getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
         break;
       case HTML_INPUTCOLOR:
-        createHtmlTextfield(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,parameter,a,jsonStartPos,"color",getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
+        createHtmlTextfield(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,entry,"color",getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
         break;
       case HTML_INPUTFLOAT:
-        createHtmlFloat(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,parameter,a,jsonStartPos,getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
+        createHtmlFloat(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,entry,getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
         break;
       case HTML_INPUTNUMBER:
-        createHtmlNumber(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,parameter,a,jsonStartPos,getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
+        createHtmlNumber(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,entry,getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
         break;
       case HTML_INPUTRANGE:
-        createHtmlRange(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,parameter,a,jsonStartPos,getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
+        createHtmlRange(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,entry,getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
         break;
       case HTML_INPUTCHECKBOX:
-        createHtmlCheckbox(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,parameter,a,jsonStartPos,getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
+        createHtmlCheckbox(_buf,&u32_jsonName,&u64_jsonName,&jsonLabel,entry,getString(u64_jsonName,bo_loadFromFlash,u8_dataType));
         break;
       case HTML_INPUTSELECT:
-        createHtmlStartSelect(_buf,&u64_jsonName,&jsonLabel,parameter,a,jsonStartPos);
-        optionsCnt = getJsonOptionsCnt(parameter,a,jsonStartPos);
-        mOptions = getJsonOptionValues(parameter,a,jsonStartPos);
-        mOptionLabels = getJsonOptionLabels(parameter,a,jsonStartPos);
-        for (uint8_t j = 0 ; j<optionsCnt; j++)
+      {
+        createHtmlStartSelect(_buf,&u64_jsonName,&jsonLabel);
+        String str_lValue = getString(u32_jsonName,bo_loadFromFlash,u8_dataType);
+        for (uint8_t j = 0 ; j<entry.optionsCnt; j++)
         {
+          const paramIdxOption_s &option = mParamIdx->options[entry.optionsFirst+j];
           sendContentHtml(server,_buf,false);
-          String str_lNewLabel = mOptionLabels[j];
-          String str_lDes = getStringFlash(getJsonArrValue(parameter, "options", "d", j, a, jsonStartPos));
-          if(str_lDes.length()>0) str_lNewLabel += " ("+str_lDes+")";
-          createHtmlAddSelectOption(_buf,mOptions.at(j),str_lNewLabel,getString(u32_jsonName,bo_loadFromFlash,u8_dataType));
+          String str_lNewLabel = getIdxString(option.l, "");
+          if(option.d>0)
+          {
+            String str_lDes = getStringFlash(option.d);
+            if(str_lDes.length()>0) str_lNewLabel += " ("+str_lDes+")";
+          }
+          createHtmlAddSelectOption(_buf,getIdxString(option.v, ""),str_lNewLabel,str_lValue);
         }
-        mOptions.clear();
-        mOptionLabels.clear();
         sendContentHtml(server,_buf,false);
         sprintf(_buf,HTML_ENTRY_SELECT_END,String(u32_jsonName));
         break;
+      }
       case HTML_INPUTMULTICHECK:
       case HTML_INPUTMULTICHECK_COLLAPSIBLE:
-        createHtmlStartMulti(_buf,&jsonLabel,parameter,a,jsonStartPos, u8_lJsonType);
-        optionsCnt = getJsonOptionsCnt(parameter,a,jsonStartPos);
-        mOptionLabels = getJsonOptionLabels(parameter,a,jsonStartPos);
-        for (uint8_t j = 0 ; j<optionsCnt; j++)
+      {
+        createHtmlStartMulti(_buf,&jsonLabel,u8_lJsonType);
+        uint32_t u32_lValue = (uint32_t)getInt(u32_jsonName,u8_dataType);
+        for (uint8_t j = 0 ; j<entry.optionsCnt; j++)
         {
+          const paramIdxOption_s &option = mParamIdx->options[entry.optionsFirst+j];
           sendContentHtml(server,_buf,false);
-          String str_lNewLabel = mOptionLabels[j];
-          String str_lDes = getStringFlash(getJsonArrValue(parameter, "options", "d", j, a, jsonStartPos));
-          if(str_lDes.length()>0) str_lNewLabel += " ("+str_lDes+")";
-          createHtmlAddMultiOption(_buf,&u32_jsonName,&u64_jsonName,parameter,a,jsonStartPos,j,str_lNewLabel,(uint32_t)getInt(u32_jsonName,u8_dataType),u8_dataType);
+          String str_lNewLabel = getIdxString(option.l, "");
+          if(option.d>0)
+          {
+            String str_lDes = getStringFlash(option.d);
+            if(str_lDes.length()>0) str_lNewLabel += " ("+str_lDes+")";
+          }
+          createHtmlAddMultiOption(_buf,&u32_jsonName,&u64_jsonName,entry,j,str_lNewLabel,u32_lValue,u8_dataType);
         }
         sendContentHtml(server,_buf,false);
         if(u8_lJsonType==HTML_INPUTMULTICHECK_COLLAPSIBLE) strcpy_P(_buf,HTML_ENTRY_MULTI_COLLAPSIBLE_END);
         else strcpy_P(_buf,HTML_ENTRY_MULTI_END);;
         break;
+      }
       case HTML_SEPARATION:
         sprintf(_buf,HTML_ENTRY_SEPARATION,jsonLabel.c_str());
         break;
@@ -622,8 +621,7 @@ void WebSettings::buildSendHtml(WebServer * server, const char *parameter, uint3
         break;
     }
 
-    uint8_t u8_lType=getJsonType(parameter, a, jsonStartPos);
-    if(u8_lType!=HTML_OPTIONGROUP && u8_lType!=HTML_OPTIONGROUP_COLLAPSIBLE)
+    if(u8_lJsonType!=HTML_OPTIONGROUP && u8_lJsonType!=HTML_OPTIONGROUP_COLLAPSIBLE)
     {
       sendContentHtml(server,_buf,false);
     }
@@ -631,7 +629,7 @@ void WebSettings::buildSendHtml(WebServer * server, const char *parameter, uint3
     //Help einfügen
     if(!bo_lIsGroup)
     {
-      strlHelp = getJsonHelp(parameter, a, jsonStartPos);
+      strlHelp = getIdxString(entry.help, "");
       if(!strlHelp.equals(""))
       {
         strlHelp.replace("\n","<br>");
@@ -642,39 +640,32 @@ void WebSettings::buildSendHtml(WebServer * server, const char *parameter, uint3
   }
 }
 
-void WebSettings::getDefaultValuesFromNewKeys(const char *parameter, uint32_t jsonStartPos)
+void WebSettings::getDefaultValuesFromNewKeys(uint16_t u16_first, uint16_t u16_cnt)
 {
   uint8_t  g, optionGroupSize, u8_dataType;
-  uint32_t u32_tmp;
   String   retStr_default = "";
 
   #ifdef WEBSET_DEBUG
-  BSC_LOGI(TAG,"getDefaultValuesFromNewKeys: str_mConfName=%s, arraySize=%i",str_mConfName.c_str(), json.getArraySize(parameter, jsonStartPos));
+  BSC_LOGI(TAG,"getDefaultValuesFromNewKeys: str_mConfName=%s, first=%i, cnt=%i",str_mConfName.c_str(), u16_first, u16_cnt);
   #endif
-  for (uint8_t a=0; a<json.getArraySize(parameter, jsonStartPos); a++)
+  for (uint16_t a=u16_first; a<u16_first+u16_cnt; a++)
   {
-    uint8_t type, optionCnt; //, jsonSize;
+    const paramIdxEntry_s &entry = mParamIdx->entries[a];
+    uint8_t type;
     uint16_t jsonName, jsonNameBase;
 
-    type = getJsonType(parameter, a, jsonStartPos);
-    optionCnt = getJsonOptionsCnt(parameter, a, jsonStartPos);
-    jsonNameBase = getJsonName(parameter, a, jsonStartPos);
+    type = entry.type;
+    jsonNameBase = entry.name;
     jsonName = getParmId(jsonNameBase,u8_mAktOptionGroupNr);
-
-    retStr_default="";
-    json.getValue(parameter, a, "dt", jsonStartPos, retStr_default, u32_tmp);
-    u8_dataType = retStr_default.toInt();
+    u8_dataType = entry.dt;
 
     if (type==HTML_OPTIONGROUP || type==HTML_OPTIONGROUP_COLLAPSIBLE)
     {
-      optionGroupSize = getJsonGroupsize(parameter,a,jsonStartPos);
+      optionGroupSize = entry.groupsize;
       for(g=0; g<optionGroupSize; g++)
       {
         u8_mAktOptionGroupNr=g;
-        String retStr;
-        uint32_t jsonArrayGroupStart = 0;
-        json.getValue(parameter, a, "group", jsonStartPos, retStr, jsonArrayGroupStart);
-        getDefaultValuesFromNewKeys(parameter, jsonArrayGroupStart);
+        getDefaultValuesFromNewKeys(entry.childFirst, entry.childCnt);
       }
       u8_mAktOptionGroupNr = 0;
       //break;
@@ -682,14 +673,12 @@ void WebSettings::getDefaultValuesFromNewKeys(const char *parameter, uint32_t js
     else
     {
       //Store in RAM
-      if(getJson_Key(parameter, "flash", a, jsonStartPos, "").equals("1")==false)
+      if(entry.flash==0)
       {
-        retStr_default="";
-        json.getValue(parameter, a, "default", jsonStartPos, retStr_default, u32_tmp);
-
         if((jsonNameBase!= 0) && (isKeyExist(jsonName, u8_dataType)==false))
         {
           bo_hasNewKeys=true;
+          retStr_default = getIdxString(entry.def, "");
           uint16_t id=0;
           uint8_t group=0;
           getIdFromParamId(jsonName,id,group);
@@ -702,8 +691,7 @@ void WebSettings::getDefaultValuesFromNewKeys(const char *parameter, uint32_t js
         if((jsonNameBase != 0) && (prefs.isKey(String(jsonName).c_str())==false))
         {
           bo_hasNewKeys=true;
-          retStr_default="";
-          json.getValue(parameter, a, "default", jsonStartPos, retStr_default, u32_tmp);
+          retStr_default = getIdxString(entry.def, "");
           uint16_t id=0;
           uint8_t group=0;
           getIdFromParamId(jsonName,id,group);
@@ -748,47 +736,47 @@ void WebSettings::getDefaultValuesFromNewKeys(const char *parameter, uint32_t js
 }
 
 
-void WebSettings::createHtmlTextfield(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos, const char * type, String value)
+void WebSettings::createHtmlTextfield(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const paramIdxEntry_s &entry, const char * type, String value)
 {
-  if(value.equals("")){value = getJsonDefault(parameter, idx, startPos);}
-  sprintf(buf,HTML_ENTRY_TEXTFIELD,label->c_str(),type,value.c_str(),String(*nameExt).c_str(),getJson_Key(parameter, "unit", idx, startPos, "").c_str(),String(*name));
+  if(value.equals("")){value = getIdxString(entry.def, "0");}
+  sprintf(buf,HTML_ENTRY_TEXTFIELD,label->c_str(),type,value.c_str(),String(*nameExt).c_str(),getIdxString(entry.unit, "").c_str(),String(*name));
 }
 
-void WebSettings::createHtmlTextarea(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos, String value)
+void WebSettings::createHtmlTextarea(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const paramIdxEntry_s &entry, String value)
 {
-  if(value.equals("")){value = getJsonDefault(parameter, idx, startPos);}
-  sprintf(buf,HTML_ENTRY_AREA,label->c_str(),getJsonOptionsMax(parameter, idx, startPos),getJsonOptionsMin(parameter, idx, startPos),String(*nameExt).c_str(), value.c_str(), String(*name));
+  if(value.equals("")){value = getIdxString(entry.def, "0");}
+  sprintf(buf,HTML_ENTRY_AREA,label->c_str(),entry.max,entry.min,String(*nameExt).c_str(), value.c_str(), String(*name));
 }
 
-void WebSettings::createHtmlNumber(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos, String value)
+void WebSettings::createHtmlNumber(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const paramIdxEntry_s &entry, String value)
 {
-  if(value.equals("")){value = getJsonDefault(parameter, idx, startPos);}
-  sprintf(buf,HTML_ENTRY_NUMBER,label->c_str(),getJsonOptionsMin(parameter, idx, startPos),
-    getJsonOptionsMax(parameter, idx, startPos), value.c_str(),String(*nameExt).c_str(),
-    getJson_Key(parameter, "unit", idx, startPos, "").c_str(),String(*name));
+  if(value.equals("")){value = getIdxString(entry.def, "0");}
+  sprintf(buf,HTML_ENTRY_NUMBER,label->c_str(),entry.min,
+    entry.max, value.c_str(),String(*nameExt).c_str(),
+    getIdxString(entry.unit, "").c_str(),String(*name));
 }
 
-void WebSettings::createHtmlFloat(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos, String value)
+void WebSettings::createHtmlFloat(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const paramIdxEntry_s &entry, String value)
 {
-  if(value.equals("")){value = getJsonDefault(parameter, idx, startPos);}
+  if(value.equals("")){value = getIdxString(entry.def, "0");}
   sprintf(buf,HTML_ENTRY_FLOAT,label->c_str(),
-    getJson_Key(parameter, "step", idx, startPos, "0.01").c_str(),
-    getJsonOptionsMin(parameter, idx, startPos),
-    getJsonOptionsMax(parameter, idx, startPos), value.c_str(),String(*nameExt).c_str(),
-    getJson_Key(parameter, "unit", idx, startPos, "").c_str(),String(*name));
+    getIdxString(entry.step, "0.01").c_str(),
+    entry.min,
+    entry.max, value.c_str(),String(*nameExt).c_str(),
+    getIdxString(entry.unit, "").c_str(),String(*name));
 }
 
-void WebSettings::createHtmlRange(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos, String value)
+void WebSettings::createHtmlRange(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const paramIdxEntry_s &entry, String value)
 {
-  if(value.equals("")){value = getJsonDefault(parameter, idx, startPos);}
-  sprintf(buf,HTML_ENTRY_RANGE, label->c_str(), getJsonOptionsMin(parameter, idx, startPos),
-    getJsonOptionsMin(parameter, idx, startPos), getJsonOptionsMax(parameter, idx, startPos),
-    value.c_str(), nameExt,  getJsonOptionsMax(parameter, idx, startPos),String(*name));
+  if(value.equals("")){value = getIdxString(entry.def, "0");}
+  sprintf(buf,HTML_ENTRY_RANGE, label->c_str(), entry.min,
+    entry.min, entry.max,
+    value.c_str(), nameExt,  entry.max,String(*name));
 }
 
-void WebSettings::createHtmlCheckbox(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos, String value)
+void WebSettings::createHtmlCheckbox(char * buf, uint16_t *name, uint64_t *nameExt, String *label, const paramIdxEntry_s &entry, String value)
 {
-  if(value.equals("")){value = getJsonDefault(parameter, idx, startPos);}
+  if(value.equals("")){value = getIdxString(entry.def, "0");}
   String sValue = String(*name);
   if (!value.equals("0")) {
     sprintf(buf,HTML_ENTRY_CHECKBOX,label->c_str(),"checked",String(*nameExt).c_str(),String(*name));
@@ -797,7 +785,7 @@ void WebSettings::createHtmlCheckbox(char * buf, uint16_t *name, uint64_t *nameE
   }
 }
 
-void WebSettings::createHtmlStartSelect(char * buf, uint64_t *nameExt, String *label, const char *parameter, uint8_t idx, uint32_t startPos)
+void WebSettings::createHtmlStartSelect(char * buf, uint64_t *nameExt, String *label)
 {
   sprintf(buf,HTML_ENTRY_SELECT_START,label->c_str(),String(*nameExt).c_str());
 }
@@ -812,7 +800,7 @@ void WebSettings::createHtmlAddSelectOption(char * buf, String option, String la
   }
 }
 
-void WebSettings::createHtmlStartMulti(char * buf, String *label, const char *parameter, uint8_t idx, uint32_t startPos, uint8_t u8_jsonType)
+void WebSettings::createHtmlStartMulti(char * buf, String *label, uint8_t u8_jsonType)
 {
   if(u8_jsonType==HTML_INPUTMULTICHECK_COLLAPSIBLE)
   {
@@ -825,13 +813,13 @@ void WebSettings::createHtmlStartMulti(char * buf, String *label, const char *pa
   }
 }
 
-void WebSettings::createHtmlAddMultiOption(char * buf, uint16_t *name, uint64_t *nameExt, const char *parameter, uint8_t idx, uint32_t startPos, uint8_t option, String label, uint32_t value, uint8_t u8_dataType)
+void WebSettings::createHtmlAddMultiOption(char * buf, uint16_t *name, uint64_t *nameExt, const paramIdxEntry_s &entry, uint8_t option, String label, uint32_t value, uint8_t u8_dataType)
 {
   #ifdef WEBSET_DEBUG
   BSC_LOGD(TAG,"createHtmlAddMultiOption: option=%i, value=%i",option,value);
   #endif
 
-  if(!isKeyExist(*name,u8_dataType)) value = getJsonDefault(parameter, idx, startPos).toInt();
+  if(!isKeyExist(*name,u8_dataType)) value = getIdxString(entry.def, "0").toInt();
 
   if((value&(1<<option))==(1<<option))
   {
@@ -842,249 +830,10 @@ void WebSettings::createHtmlAddMultiOption(char * buf, uint16_t *name, uint64_t
 }
 
 
-uint8_t WebSettings::getJsonSize(const char *parameter, uint8_t idx, uint32_t startPos)
-{
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-  bool ret = json.getValue(parameter, idx, "size", startPos, retStr, retArrayStart);
-
-  if(ret==true)
-  {
-    if (isNumber(retStr))
-    {
-      return atoi(retStr.c_str());
-    }
-    else
-    {
-      //Error; Sollte nicht vorkommen
-      return 1;
-    }
-  }
-  else
-  {
-    return 1;
-  }
-}
-
-uint8_t WebSettings::getJsonGroupsize(const char *parameter, uint8_t idx, uint32_t startPos)
-{
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-
-  bool ret = json.getValue(parameter, idx, "groupsize", startPos, retStr, retArrayStart);
-
-  if (ret==true)
-  {
-    if (isNumber(retStr))
-    {
-      return atoi(retStr.c_str());
-    }
-    else
-    { //Error; Sollte nicht vorkommen
-      return 0;
-    }
-  }
-  else
-  {
-    return 0;
-  }
-}
-
-uint32_t WebSettings::getJsonName(const char *parameter, uint8_t idx, uint32_t startPos)
-{
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-  uint32_t id = 0;
-  bool ret = json.getValue(parameter, idx, "name", startPos, retStr, retArrayStart);
-  if(ret==true){return retStr.toInt();}
-  return 0;
-}
-
-String WebSettings::getJsonLabel(const char *parameter, uint8_t idx, uint32_t startPos)
-{
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-  bool ret = json.getValue(parameter, idx, "label", startPos, retStr, retArrayStart);
-  if(ret==true){return retStr;}
-  return "";
-}
-
-String WebSettings::getJsonLabelEntry(const char *parameter, uint8_t idx, uint32_t startPos)
-{
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-  bool ret = json.getValue(parameter, idx, "label_entry", startPos, retStr, retArrayStart);
-  if(ret==true){return retStr;}
-  return "";
-}
-
-String WebSettings::getJsonHelp(const char *parameter, uint8_t idx, uint32_t startPos)
-{
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-  bool ret = json.getValue(parameter, idx, "help", startPos, retStr, retArrayStart);
-  if(ret==true){return retStr;}
-  return "";
-}
-
-uint8_t WebSettings::getJsonType(const char *parameter, uint8_t idx, uint32_t startPos)
-{
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-
-  bool ret = json.getValue(parameter, idx, "type", startPos, retStr, retArrayStart);
-  if (ret==true)
-  {
-    if (isNumber(retStr))
-    {
-      return atoi(retStr.c_str());
-    }
-    else
-    { //Error; Sollte nicht vorkommen
-      return HTML_INPUTTEXT;
-    }
-  }
-  else
-  {
-    return HTML_INPUTTEXT;
-  }
-}
-
-String WebSettings::getJsonDefault(const char *parameter, uint8_t idx, uint32_t startPos)
-{
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-  bool ret = json.getValue(parameter, idx, "default", startPos, retStr, retArrayStart);
-  if(ret==true){return retStr;}
-  return "0";
-}
-
-std::vector<String> WebSettings::getJsonOptionValues(const char *parameter, uint8_t idx, uint32_t startPos)
+/* Liefert einen String aus dem JSON der Seite anhand der Position im Index */
+String WebSettings::getIdxString(const paramIdxStr_s &str, const char *defaultValue)
 {
-  std::vector<String> options;
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-  uint32_t retArrayStart2 = 0;
-  bool ret = json.getValue(parameter, idx, "options", startPos, retStr, retArrayStart);
-
-  if(ret==true)
-  {
-    for (uint8_t i=0; i< json.getArraySize(parameter, retArrayStart); i++)
-    {
-      retStr = "";
-      retArrayStart2 = 0;
-      ret = json.getValue(parameter, i, "v", retArrayStart, retStr, retArrayStart2);
-      if(ret==true){options.push_back(retStr);}
-    }
-  }
-  return options;
-}
-
-std::vector<String> WebSettings::getJsonOptionLabels(const char *parameter, uint8_t idx, uint32_t startPos)
-{
-  std::vector<String> labels;
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-  uint32_t retArrayStart2 = 0;
-  bool ret = json.getValue(parameter, idx, "options", startPos, retStr, retArrayStart);
-
-  if(ret==true)
-  {
-    for (uint8_t i=0; i< json.getArraySize(parameter, retArrayStart); i++)
-    {
-      retStr = "";
-      retArrayStart2 = 0;
-      ret = json.getValue(parameter, i, "l", retArrayStart, retStr, retArrayStart2);
-      if(ret==true){labels.push_back(retStr);}
-    }
-  }
-  return labels;
-}
-
-String WebSettings::getJsonArrValue(const char *parameter, String str_key1, String str_key2, uint8_t u8_eCnt, uint8_t idx, uint32_t startPos)
-{
-  std::vector<String> options;
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-  uint32_t retArrayStart2 = 0;
-  bool ret = json.getValue(parameter, idx, str_key1, startPos, retStr, retArrayStart);
-
-  if(ret==true)
-  {
-    for (uint8_t i=0; i< json.getArraySize(parameter, retArrayStart); i++)
-    {
-      retStr = "";
-      retArrayStart2 = 0;
-      ret = json.getValue(parameter, i, str_key2, retArrayStart, retStr, retArrayStart2);
-      if(i==u8_eCnt)return retStr;
-    }
-  }
-  return retStr;
-}
-
-uint8_t WebSettings::getJsonOptionsCnt(const char *parameter, uint8_t idx, uint32_t startPos)
-{
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-  bool ret = json.getValue(parameter, idx, "options", startPos, retStr, retArrayStart);
-  if(ret==true){return json.getArraySize(parameter, retArrayStart);}
-  return 0;
-}
-
-uint32_t WebSettings::getJsonOptionsMin(const char *parameter, uint8_t idx, uint32_t startPos)
-{
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-
-  bool ret = json.getValue(parameter, idx, "min", startPos, retStr, retArrayStart);
-
-  if (ret==true) {
-    if (isNumber(retStr))
-    {
-      return atoi(retStr.c_str());
-    }
-    else
-    { //Error; Sollte nicht vorkommen
-      return 0;
-    }
-  }
-  else
-  {
-    return 0;
-  }
-}
-
-uint32_t WebSettings::getJsonOptionsMax(const char *parameter, uint8_t idx, uint32_t startPos)
-{
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-
-  bool ret = json.getValue(parameter, idx, "max", startPos, retStr, retArrayStart);
-  if (ret==true)
-  {
-    if (isNumber(retStr))
-    {
-      return atoi(retStr.c_str());
-    }
-    else //Error; Sollte nicht vorkommen
-    {
-      return 100;
-    }
-  }
-  else
-  {
-    return 100;
-  }
-}
-
-//Universal
-String WebSettings::getJson_Key(const char *parameter, String key, uint8_t idx, uint32_t startPos, String defaultValue)
-{
-  String retStr = "";
-  uint32_t retArrayStart = 0;
-  bool ret = json.getValue(parameter, idx, key, startPos, retStr, retArrayStart);
-  if(ret==true){return retStr;}
-  return defaultValue;
+  return getIdxString(parameterFile, str, defaultValue);
 }
 
 
@@ -1131,6 +880,7 @@ bool WebSettings::isKeyExist(uint16_t key, uint8_t u8_dataType)
 void WebSettings::setParameter(uint16_t name, uint8_t group, String value, uint8_t u8_dataType)
 {
   setString(getParmId(name, group), value, u8_dataType);
+  if(fn_mOnParameterChanged) fn_mOnParameterChanged();
 }
 
 
@@ -1383,12 +1133,6 @@ String WebSettings::getStringFlash(uint16_t name)
 
 
 
-uint16_t WebSettings::getParmId(uint16_t id, uint8_t groupIdx)
-{
-  return (id<<6) | (groupIdx&0x3F);
-}
-
-
 void WebSettings::getIdFromParamId(uint16_t paramId, uint16_t &id, uint8_t &groupIdx)
 {
   id = ((paramId>>6)&0x3FF);
@@ -1600,6 +1344,7 @@ boolean WebSettings::writeConfig()
       SPIFFS.remove("/WebSettings.sich");
     }
 
+    if(fn_mOnParameterChanged) fn_mOnParameterChanged();
     return true;
   }
   else
@@ -1693,6 +1438,12 @@ void WebSettings::registerOnButton3(void (*callback)())
   fn_mOnButton3 = callback;
 }
 
+//register callback for parameter changes (for all instances)
+void WebSettings::registerOnParameterChanged(void (*callback)())
+{
+  fn_mOnParameterChanged = callback;
+}
+
 
 
 
@@ -7,19 +7,54 @@
 #include "BmsData.h"
 #include "mqtt_t.h"
 #include "log.h"
+#include "SerialRx.h"
 
 static const char *TAG = "DALY_BMS";
 
-#define DALAY_SEND_DELAY 20
+#define DALY_SEND_DELAY_MIN        2   // Min. Pause zwischen zwei Anfragen [ms]
+#define DALY_SEND_DELAY_MAX       20   // Max. Pause zwischen zwei Anfragen [ms]; wird nach einem Fehler verwendet
+#define DALY_SLOW_REQUEST_CYCLES   5   // Status, Balancer und Fehler werden nur jeden n-ten Zyklus abgefragt
+#define DALY_MAX_TIMEOUTS          2   // Nach n Timeouts in einem Zyklus werden die restlichen Anfragen übersprungen
+#define DALY_RECV_TIMEOUT        200   // Timeout je Paket [ms]
 
 static Stream *mPort;
 static uint8_t u8_mDevNr;
 
-enum SM_readData {SEARCH_START, SEARCH_END};
+// 0xA5, Adresse, Kommando, Länge (8), 8 Datenbytes, Checksumme (8 Bit Summe)
+static constexpr utils::FrameFormat dalyFrameFormat {
+  .soi = {DALAY_START_BYTE}, .soiLen = 1, .storeSoi = true,
+  .length = utils::FrameFormat::Length::Fixed, .fixedLen = DALY_FRAME_SIZE,
+  .checksum = utils::FrameFormat::Checksum::Sum8, .checksumSize = 1};
 
-//
-static uint8_t u8_mNumberOfCells=0;
-static uint8_t u8_mNumOfTempSensors=0;
+//Anfragen eines Zyklus
+enum dalyRequestGroup_e {DALY_GROUP_FAST, DALY_GROUP_SLOW};
+
+struct dalyRequest_s
+{
+  uint8_t u8_function;
+  uint8_t u8_group;  // DALY_GROUP_FAST: jeden Zyklus; DALY_GROUP_SLOW: jeden DALY_SLOW_REQUEST_CYCLES-ten Zyklus
+};
+
+static const struct dalyRequest_s dalyRequests[] = {
+  {DALY_REQUEST_BATTERY_SOC,     DALY_GROUP_FAST},
+  {DALY_REQUEST_MIN_MAX_VOLTAGE, DALY_GROUP_FAST},
+  //{DALY_REQUEST_MIN_MAX_TEMPERATURE, DALY_GROUP_FAST}, //not use
+  {DALY_REQUEST_MOS,             DALY_GROUP_FAST},
+  {DALY_REQUEST_STATUS,          DALY_GROUP_SLOW}, //Cellnumbers; muss vor den Zellspannungen abgefragt werden
+  {DALY_REQUEST_CELL_VOLTAGE,    DALY_GROUP_FAST},
+  {DALY_REQUEST_TEMPERATURE,     DALY_GROUP_FAST},
+  {DALY_REQUEST_BALLANCER,       DALY_GROUP_SLOW},
+  {DALY_REQUEST_FAILURE,         DALY_GROUP_SLOW}, //Wird jeden Zyklus abgefragt, solange Fehler anstehen
+};
+
+//Je Gerät
+static uint8_t u8_mNumberOfCells[SERIAL_BMS_DEVICES_COUNT];
+static uint8_t u8_mNumOfTempSensors[SERIAL_BMS_DEVICES_COUNT];
+static uint8_t u8_mSlowCycleCnt[SERIAL_BMS_DEVICES_COUNT];  // Zyklen bis zur nächsten Abfrage der langsamen Gruppe
+static uint8_t u8_mSendDelay[SERIAL_BMS_DEVICES_COUNT];     // Aktuelle Pause zwischen zwei Anfragen [ms]; 0=noch nicht gemessen
+
+static uint32_t u32_mResponseLatencyUs;  // Zeit von der Anfrage bis zum ersten Byte der letzten Antwort
+static bool     bo_mTimeout;             // Letzte Anfrage ohne (vollständige) Antwort
 
 static float    f_mTotalVoltageOld=0xFFFF;
 //static uint32_t mqttSendeTimer=0;
@@ -28,6 +63,8 @@ static float    f_mTotalVoltageOld=0xFFFF;
 static void      getDataFromBms(uint8_t address, uint8_t function);
 static bool      recvAnswer(uint8_t * t_outMessage, uint8_t packets);
 static void      parseMessage(uint8_t * t_message);
+static uint8_t   getCellVoltagePackets();
+static void      waitBeforeNextRequest(bool bo_lLastRequestOk);
 
 static void (*callbackSetTxRxEn)(uint8_t, uint8_t) = NULL;
 static serialDevData_s *mDevData;
@@ -45,61 +82,101 @@ bool DalyBms_readBmsData(Stream *port, uint8_t devNr, void (*callback)(uint8_t,
   BSC_LOGI(TAG,"DalyBms_readBmsData()");
   #endif
 
-  getDataFromBms(DALAY_BMS_ADRESS, DALY_REQUEST_BATTERY_SOC);
-  if(recvAnswer(response, 1))
+  if(u8_mDevNr>=SERIAL_BMS_DEVICES_COUNT) return false;
+
+  //Die langsame Gruppe wird auch abgefragt, solange die Zellanzahl noch unbekannt ist
+  bool bo_lSlowCycle = (u8_mSlowCycleCnt[u8_mDevNr]==0 || u8_mNumberOfCells[u8_mDevNr]==0);
+  bool bo_lSlowOk=true;
+  bool bo_lLastRequestOk=true;
+  uint8_t u8_lRequests=0;
+  uint8_t u8_lTimeouts=0;
+
+  for(uint8_t i=0;i<sizeof(dalyRequests)/sizeof(dalyRequests[0]);i++)
   {
-    parseMessage(response);
+    const struct dalyRequest_s &request = dalyRequests[i];
+    bool bo_lDue = (request.u8_group==DALY_GROUP_FAST || bo_lSlowCycle);
+    if(request.u8_function==DALY_REQUEST_FAILURE && getBmsErrors(BT_DEVICES_COUNT+u8_mDevNr)!=0) bo_lDue=true;
+    if(!bo_lDue) continue;
+
+    uint8_t u8_lPackets=1;
+    if(request.u8_function==DALY_REQUEST_CELL_VOLTAGE) u8_lPackets=getCellVoltagePackets();
 
-    mqttPublish(MQTT_TOPIC_BMS_BT, BT_DEVICES_COUNT+u8_mDevNr, MQTT_TOPIC2_TOTAL_VOLTAGE, -1, getBmsTotalVoltage(BT_DEVICES_COUNT+u8_mDevNr));
-    mqttPublish(MQTT_TOPIC_BMS_BT, BT_DEVICES_COUNT+u8_mDevNr, MQTT_TOPIC2_TOTAL_CURRENT, -1, getBmsTotalCurrent(BT_DEVICES_COUNT+u8_mDevNr));
+    //BMS antwortet nicht oder Zellanzahl unbekannt: Anfrage überspringen
+    if(u8_lTimeouts>=DALY_MAX_TIMEOUTS || u8_lPackets==0)
+    {
+      bo_ret=false;
+      if(request.u8_group==DALY_GROUP_SLOW) bo_lSlowOk=false;
+      continue;
+    }
+
+    if(u8_lRequests>0) waitBeforeNextRequest(bo_lLastRequestOk);
+    u8_lRequests++;
+
+    getDataFromBms(DALAY_BMS_ADRESS, request.u8_function);
+    bo_lLastRequestOk=recvAnswer(response, u8_lPackets);
+    if(bo_lLastRequestOk)
+    {
+      parseMessage(response);
+
+      if(request.u8_function==DALY_REQUEST_BATTERY_SOC)
+      {
+        mqttPublish(MQTT_TOPIC_BMS_BT, BT_DEVICES_COUNT+u8_mDevNr, MQTT_TOPIC2_TOTAL_VOLTAGE, -1, getBmsTotalVoltage(BT_DEVICES_COUNT+u8_mDevNr));
+        mqttPublish(MQTT_TOPIC_BMS_BT, BT_DEVICES_COUNT+u8_mDevNr, MQTT_TOPIC2_TOTAL_CURRENT, -1, getBmsTotalCurrent(BT_DEVICES_COUNT+u8_mDevNr));
+      }
+    }
+    else
+    {
+      bo_ret=false;
+      if(request.u8_group==DALY_GROUP_SLOW) bo_lSlowOk=false;
+      if(bo_mTimeout) u8_lTimeouts++;
+    }
   }
-  else bo_ret=false;
-  vTaskDelay(pdMS_TO_TICKS(DALAY_SEND_DELAY));
-
-  getDataFromBms(DALAY_BMS_ADRESS, DALY_REQUEST_MIN_MAX_VOLTAGE);
-  if(recvAnswer(response,1)) parseMessage(response);
-  else bo_ret=false;
-  vTaskDelay(pdMS_TO_TICKS(DALAY_SEND_DELAY));
-
-  //getDataFromBms(DALAY_BMS_ADRESS, DALY_REQUEST_MIN_MAX_TEMPERATURE); //not use
-  //if(recvAnswer(response,1)) parseMessage(response);
-  //else bo_ret=false;
-  //vTaskDelay(pdMS_TO_TICKS(DALAY_SEND_DELAY));
-
-  getDataFromBms(DALAY_BMS_ADRESS, DALY_REQUEST_MOS);
-  if(recvAnswer(response,1)) parseMessage(response);
-  else bo_ret=false;
-  vTaskDelay(pdMS_TO_TICKS(DALAY_SEND_DELAY));
-
-  getDataFromBms(DALAY_BMS_ADRESS, DALY_REQUEST_STATUS); //Cellnumbers
-  if(recvAnswer(response,1)) parseMessage(response);
-  else bo_ret=false;
-  vTaskDelay(pdMS_TO_TICKS(DALAY_SEND_DELAY));
-
-  getDataFromBms(DALAY_BMS_ADRESS, DALY_REQUEST_CELL_VOLTAGE);
-  if(recvAnswer(response,u8_mNumberOfCells/3+u8_mNumberOfCells%3)) parseMessage(response);
-  else bo_ret=false;
-  vTaskDelay(pdMS_TO_TICKS(DALAY_SEND_DELAY));
-
-  getDataFromBms(DALAY_BMS_ADRESS, DALY_REQUEST_TEMPERATURE);
-  if(recvAnswer(response,1)) parseMessage(response);
-  else bo_ret=false;
-  vTaskDelay(pdMS_TO_TICKS(DALAY_SEND_DELAY));
-
-  getDataFromBms(DALAY_BMS_ADRESS, DALY_REQUEST_BALLANCER);
-  if(recvAnswer(response,1)) parseMessage(response);
-  else bo_ret=false;
-  vTaskDelay(pdMS_TO_TICKS(DALAY_SEND_DELAY));
-
-  getDataFromBms(DALAY_BMS_ADRESS, DALY_REQUEST_FAILURE);
-  if(recvAnswer(response,1)) parseMessage(response);
-  else bo_ret=false;
-  //vTaskDelay(pdMS_TO_TICKS(DALAY_SEND_DELAY));
+
+  //Schlägt eine Anfrage der langsamen Gruppe fehl, wird sie im nächsten Zyklus wiederholt
+  if(bo_lSlowCycle) u8_mSlowCycleCnt[u8_mDevNr] = bo_lSlowOk ? DALY_SLOW_REQUEST_CYCLES-1 : 0;
+  else u8_mSlowCycleCnt[u8_mDevNr]--;
 
   if(devNr>=2) callbackSetTxRxEn(u8_mDevNr,serialRxTx_RxTxDisable);
   return bo_ret;
 }
 
+
+/* Anzahl der Pakete der Zellspannungen (3 Zellen je Paket, max. 16 Pakete); 0 wenn die Zellanzahl noch unbekannt ist */
+static uint8_t getCellVoltagePackets()
+{
+  uint8_t u8_lPackets = (u8_mNumberOfCells[u8_mDevNr]+2)/3;
+  if(u8_lPackets>16) u8_lPackets=16;
+  return u8_lPackets;
+}
+
+
+/* Pause vor der nächsten Anfrage.
+ * Das BMS benötigt nach einer Antwort etwas Zeit, bis es die nächste Anfrage annimmt. Statt der festen 20ms wird als
+ * Pause die Zeit verwendet, die das BMS für die letzte Antwort benötigt hat (Anfrage bis zum ersten Byte).
+ * Wird das BMS langsamer, wird die Pause sofort verlängert, wird es schneller, wird sie schrittweise verkürzt.
+ * Nach einem Fehler wird wieder mit der max. Pause begonnen. */
+static void waitBeforeNextRequest(bool bo_lLastRequestOk)
+{
+  uint8_t &u8_lSendDelay = u8_mSendDelay[u8_mDevNr];
+
+  if(!bo_lLastRequestOk || u8_lSendDelay==0) u8_lSendDelay=DALY_SEND_DELAY_MAX;
+  else
+  {
+    uint32_t u32_lTargetMs = (u32_mResponseLatencyUs+999)/1000;
+    if(u32_lTargetMs<DALY_SEND_DELAY_MIN) u32_lTargetMs=DALY_SEND_DELAY_MIN;
+    else if(u32_lTargetMs>DALY_SEND_DELAY_MAX) u32_lTargetMs=DALY_SEND_DELAY_MAX;
+
+    if(u32_lTargetMs>=u8_lSendDelay) u8_lSendDelay=(uint8_t)u32_lTargetMs;
+    else u8_lSendDelay-=(uint8_t)((u8_lSendDelay-u32_lTargetMs+1)/2);
+  }
+
+  #ifdef DALY_DEBUG
+  BSC_LOGD(TAG,"Send delay=%i ms, latency=%i us",u8_lSendDelay,u32_mResponseLatencyUs);
+  #endif
+  vTaskDelay(pdMS_TO_TICKS(u8_lSendDelay));
+}
+
+
 static void getDataFromBms(uint8_t address, uint8_t function)
 {
   uint8_t u8_lData[DALY_FRAME_SIZE];
@@ -128,10 +205,7 @@ static void getDataFromBms(uint8_t address, uint8_t function)
   #endif
 
   //Empfangsbuffer leeren wenn da noch etwas drin sein sollte
-  for(uint8_t i=0;i<200;i++)
-  {
-    if (mPort->available() == 0) break;
-  }
+  serialRxClear(mPort);
 
   //TX
   callbackSetTxRxEn(u8_mDevNr,serialRxTx_TxEn);
@@ -144,88 +218,57 @@ static void getDataFromBms(uint8_t address, uint8_t function)
 
 static bool recvAnswer(uint8_t *p_lRecvBytes, uint8_t packets)
 {
-  uint8_t SMrecvState, u8_lRecvByte, u8_lRecvBytesCnt, u8_lRecvBytesCntPacket, u8_checlSum, u8_CyclesWithoutData;
-  uint32_t u32_lStartTime=millis();
-  SMrecvState=SEARCH_START;
-  u8_lRecvBytesCnt=0;
-  u8_lRecvBytesCntPacket=0;
-  u8_checlSum=0;
-  u8_CyclesWithoutData=0;
-
-  for(;;)
+  int16_t i16_lRecvByte;
+  utils::FrameDecoder::Status status;
+  uint8_t u8_lFrame[DALY_FRAME_SIZE*2]; //Platz für Bytes hinter einem Paket, die zum nächsten Paket gehören
+  utils::FrameDecoder decoder(dalyFrameFormat, u8_lFrame, sizeof(u8_lFrame));
+  uint8_t u8_lRecvPackets=0;
+  uint32_t u32_lRequestTime=micros();
+  uint32_t u32_lStartTime=u32_lRequestTime;
+  bool bo_lFirstByte=true;
+  u32_mResponseLatencyUs=0;
+  bo_mTimeout=false;
+  serialRxRecordRequest(u8_mDevNr);
+
+  while(u8_lRecvPackets<packets)
   {
-    //Timeout
-    if((millis()-u32_lStartTime)>200)
+    //Wartet auf das nächste Zeichen
+    i16_lRecvByte=serialRxReadByte(mPort, u32_lStartTime, DALY_RECV_TIMEOUT);
+    if(i16_lRecvByte<0) status=decoder.flush(); //Ein Paket, dessen Anfang in einem ungültigen Paket lag
+    else
     {
-      BSC_LOGE(TAG,"Timeout: Serial=%i, u8_lRecvBytesCnt=%i", u8_mDevNr, u8_lRecvBytesCnt);
-      #ifdef DALY_DEBUG
-      String recvBytes="";
-      for(uint8_t x=0;x<u8_lRecvBytesCnt;x++)
-      {
-        recvBytes+=String(p_lRecvBytes[x],16);
-        recvBytes+=" ";
-      }
-      BSC_LOGD(TAG,"Timeout: RecvBytes=%i: %s",u8_lRecvBytesCnt, recvBytes.c_str());
-      #endif
-      return false;
+      if(bo_lFirstByte) u32_mResponseLatencyUs=micros()-u32_lRequestTime;
+      bo_lFirstByte=false;
+      status=decoder.push((uint8_t)i16_lRecvByte);
     }
 
-    //Überprüfen ob Zeichen verfügbar
-    if(mPort->available() > 0)
+    if(status==utils::FrameDecoder::Status::Frame)
     {
-      u8_lRecvByte = mPort->read();
-
-      switch (SMrecvState)
-      {
-        case SEARCH_START:
-          if (u8_lRecvByte == DALAY_START_BYTE)
-          {
-            u32_lStartTime=millis();
-            p_lRecvBytes[u8_lRecvBytesCnt]=u8_lRecvByte;
-            u8_lRecvBytesCnt++;
-            u8_checlSum=u8_lRecvByte;
-            u8_lRecvBytesCntPacket=1;
-            SMrecvState=SEARCH_END;
-          }
-          break;
-
-        case SEARCH_END:
-          p_lRecvBytes[u8_lRecvBytesCnt]=u8_lRecvByte;
-          u8_lRecvBytesCnt++;
-          u8_lRecvBytesCntPacket++;
-
-          if(u8_lRecvBytesCntPacket==DALY_FRAME_SIZE)
-          {
-            //BSC_LOGI(TAG,"Last byte; cnt=%i, cntPacket=%i, recvByte=%i, chkSum=%i",u8_lRecvBytesCnt, u8_lRecvBytesCntPacket, u8_lRecvByte, u8_checlSum);
-            SMrecvState=SEARCH_START;
-
-            //Überprüfe Cheksum
-            if(u8_checlSum!=p_lRecvBytes[u8_lRecvBytesCnt-1]) return false;
-          }
-          else u8_checlSum+=u8_lRecvByte;
-          break;
-
-        default:
-          break;
-        }
-      u8_CyclesWithoutData=0;
+      memcpy(&p_lRecvBytes[u8_lRecvPackets*DALY_FRAME_SIZE], decoder.frame(), DALY_FRAME_SIZE);
+      u8_lRecvPackets++;
+      u32_lStartTime=micros(); //Timeout je Paket
     }
-    else if (u8_lRecvBytesCnt==0) vTaskDelay(pdMS_TO_TICKS(10)); // Wenn noch keine Daten empfangen wurden, dann setze den Task 10ms aus
-    else if (u8_lRecvBytesCnt>0 && u8_CyclesWithoutData>10) vTaskDelay(pdMS_TO_TICKS(10)); // Wenn trotz empfangenen Daten 10ms wieder nichts empfangen wurde, dann setze den Task 10ms aus
-    else // Wenn in diesem Zyklus keine Daten Empfangen wurde, dann setze den Task 1ms aus
+    else if(i16_lRecvByte<0) //Timeout
     {
-      u8_CyclesWithoutData++;
-    vTaskDelay(pdMS_TO_TICKS(1));
+      BSC_LOGE(TAG,"Timeout: Serial=%i, u8_lRecvPackets=%i, pending=%i", u8_mDevNr, u8_lRecvPackets, decoder.pending());
+      serialRxRecordDecoder(u8_mDevNr, decoder.statistics());
+      serialRxRecordTimeout(u8_mDevNr);
+      bo_mTimeout=true;
+      return false;
+    }
+    else if(status!=utils::FrameDecoder::Status::Incomplete && decoder.pending()==0) //Checksumme falsch
+    {
+      serialRxRecordDecoder(u8_mDevNr, decoder.statistics());
+      return false;
     }
-
-    if(u8_lRecvBytesCnt==(DALY_FRAME_SIZE*packets)) break; //Recv Pakage complete
-    if(u8_lRecvBytesCnt>=(DALY_FRAME_SIZE*16)) return false; //Answer too long!
   }
+  serialRxRecordDecoder(u8_mDevNr, decoder.statistics());
+  serialRxRecordResponse(u8_mDevNr, u32_lRequestTime);
 
   /*#ifdef DALY_DEBUG
   String recvBytes="";
   uint8_t logBytCnt=0;
-  for(uint8_t x=0;x<u8_lRecvBytesCnt;x++)
+  for(uint8_t x=0;x<packets*DALY_FRAME_SIZE;x++)
   {
     recvBytes+=String(p_lRecvBytes[x]);
     recvBytes+=" ";
@@ -290,10 +333,10 @@ static void parseMessage(uint8_t * t_message)
       break;
 
     case DALY_REQUEST_STATUS:
-      u8_mNumberOfCells = t_message[4];
-      u8_mNumOfTempSensors = t_message[5];
+      u8_mNumberOfCells[u8_mDevNr] = t_message[4];
+      u8_mNumOfTempSensors[u8_mDevNr] = t_message[5];
       #ifdef DALY_DEBUG
-      BSC_LOGI(TAG,"NumberOfCells=%i, NumOfTempSensor=%i",u8_mNumberOfCells,u8_mNumOfTempSensors);
+      BSC_LOGI(TAG,"NumberOfCells=%i, NumOfTempSensor=%i",u8_mNumberOfCells[u8_mDevNr],u8_mNumOfTempSensors[u8_mDevNr]);
       #endif
       break;
 
@@ -301,7 +344,7 @@ static void parseMessage(uint8_t * t_message)
       u8_lValue=0;
       u16_lValue1=0;
       u32_lValue=0;
-      for (size_t n = 0; n <= (u8_mNumberOfCells/3+u8_mNumberOfCells%3); n++)
+      for (size_t n = 0; n < getCellVoltagePackets(); n++)
       {
         for (size_t i = 0; i < 3; i++)
         {
@@ -309,9 +352,9 @@ static void parseMessage(uint8_t * t_message)
           u32_lValue+=u16_lValue1;
           setBmsCellVoltage(BT_DEVICES_COUNT+u8_mDevNr, u8_lValue, u16_lValue1);
           u8_lValue++;
-          if (u8_lValue == u8_mNumberOfCells)
+          if (u8_lValue == u8_mNumberOfCells[u8_mDevNr])
           {
-            setBmsAvgVoltage(BT_DEVICES_COUNT+u8_mDevNr, u32_lValue/u8_mNumberOfCells);
+            setBmsAvgVoltage(BT_DEVICES_COUNT+u8_mDevNr, u32_lValue/u8_mNumberOfCells[u8_mDevNr]);
             return;
           }
         }
@@ -324,7 +367,7 @@ static void parseMessage(uint8_t * t_message)
       {
         setBmsTempature(BT_DEVICES_COUNT+u8_mDevNr, u8_lValue, (t_message[5+i]-40));
         u8_lValue++;
-        if (u8_lValue == u8_mNumOfTempSensors) break;
+        if (u8_lValue == u8_mNumOfTempSensors[u8_mDevNr]) break;
       }
       break;
 
@@ -361,6 +404,7 @@ static void parseMessage(uint8_t * t_message)
       #define BMS_ERR_STATUS_AFE_ERROR      2048   //bit11 Front-end detection IC error
       #define BMS_ERR_STATUS_SOFT_LOCK      4096   //bit12 software lock MOS */
 
+      u16_lValue2 = 0;
       u16_lValue1 = t_message[4];
       if(u16_lValue1&0x1) u16_lValue2|=1;         //Bit 0: Cell volt high level 1
       if((u16_lValue1>>1)&0x1) u16_lValue2|=1;    //Bit 1: Cell volt high level 2
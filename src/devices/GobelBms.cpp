@@ -8,6 +8,7 @@
 #include "BmsData.h"
 #include "mqtt_t.h"
 #include "log.h"
+#include "SerialRx.h"
 
 #define ARRAY_SIZE(x) (sizeof(x) / sizeof(x[0]))
 
@@ -140,13 +141,12 @@ protected:
 static uint8_t u8_mDevNr, u8_mConnToId, u8_mCountOfPacks;
 static uint16_t u16_mLastRecvBytesCnt;
 
-enum SM_readData
-{
-  SEARCH_START_BYTE1,
-  SEARCH_START_BYTE2,
-  DATA,
-  SEARCH_END
-};
+// 0x37 0x45, Header (4 Bytes), Länge (12 Bit), Daten, Checksumme (2 Bytes, ohne 0x37 0x45), 0x0D
+static constexpr utils::FrameFormat gobelFrameFormat {
+  .soi = {0x37, 0x45}, .soiLen = 2, .storeSoi = false, .eoi = 0x0D,
+  .length = utils::FrameFormat::Length::Field, .lenPos = 6, .lenSize = 2, .lenMask = 0x0FFF, .lenAdd = 2 + 6 + 3,
+  .maxLen = GOBELBMS_MAX_ANSWER_LEN + 2,
+  .checksum = utils::FrameFormat::Checksum::NegSum16, .checksumSize = 2, .checksumTail = 1, .checksumStart = 2};
 
 static uint8_t getDataMsg[] = {0x11, 0x01, 0x46, 0xB0, 0x00, 0x00};
 static uint8_t getWarnMsg[] = {0x11, 0x01, 0x46, 0xB1, 0x00, 0x00};
@@ -198,7 +198,7 @@ bool GobelBms_readBmsData(Stream *port, uint8_t devNr, void (*callback)(uint8_t,
         parseWarnData(response, u8_addr);
       }
 
-      setBmsLastDataMillis(BT_DEVICES_COUNT + u8_mDevNr + u8_addr, millis());
+      bmsDataUpdateComplete(BT_DEVICES_COUNT + u8_mDevNr + u8_addr, millis());
     }
     else
     {
@@ -240,85 +240,18 @@ static void sendMessage(uint8_t *sendMsg, size_t len)
 
 static bool recvAnswer(uint8_t *p_lRecvBytes)
 {
-  uint8_t SMrecvState, u8_lRecvByte, u8_CyclesWithoutData;
-  uint16_t u16_lRecvDataLen;
-  uint32_t u32_lStartTime = millis();
-  SMrecvState = SEARCH_START_BYTE1;
-  u16_mLastRecvBytesCnt = 0;
-  u16_lRecvDataLen = 0xFFFF;
-  uint16_t cksum = 0;
-  u8_CyclesWithoutData = 0;
-
-  for (;;)
+  //  wenn innerhalb von 500ms das Telegram noch nicht begonnen hat, dann Timeout
+  //  oder wenn es begonnen hat, dann 700ms
+  utils::FrameDecoder decoder(gobelFrameFormat, p_lRecvBytes, GOBELBMS_MAX_ANSWER_LEN);
+  utils::FrameDecoder::Status status = serialRxReadFrame(mPort, u8_mDevNr, decoder, micros(), 500, 700);
+  u16_mLastRecvBytesCnt = decoder.length();
+  if (status == utils::FrameDecoder::Status::Incomplete)
   {
-    // Timeout
-    //  wenn innerhalb von 500ms das Telegram noch nicht begonnen hat, dann Timeout
-    //  oder wenn es begonnen hat, dann 700ms
-    if (((millis() - u32_lStartTime) > 500 && u16_mLastRecvBytesCnt == 0) || ((millis() - u32_lStartTime) > 700 && u16_mLastRecvBytesCnt > 0))
-    {
-      BSC_LOGD(TAG, "Timeout: Serial=%i, u8_lRecvDataLen=%i, u8_lRecvBytesCnt=%i", u8_mDevNr, u16_lRecvDataLen, u16_mLastRecvBytesCnt);
-      return false;
-    }
-
-    // Überprüfen ob Zeichen verfügbar
-    if (mPort->available() > 0)
-    {
-      u8_lRecvByte = mPort->read();
-      switch (SMrecvState)
-      {
-      case SEARCH_START_BYTE1:
-        if (u8_lRecvByte == 0x37)
-        {
-          SMrecvState = SEARCH_START_BYTE2;
-        }
-        break;
-
-      case SEARCH_START_BYTE2:
-        if (u8_lRecvByte == 0x45)
-        {
-          SMrecvState = DATA;
-        }
-        break;
-
-      case DATA:
-        cksum += u8_lRecvByte;
-        p_lRecvBytes[u16_mLastRecvBytesCnt] = u8_lRecvByte;
-        u16_mLastRecvBytesCnt++;
-        if (u16_mLastRecvBytesCnt == 6)
-        {
-          SMrecvState = SEARCH_END;
-          // TODO: Check length
-          u16_lRecvDataLen = 6 + ((p_lRecvBytes[4] & 0x0f) << 8) + p_lRecvBytes[5] + 3;
-        }
-        break;
-
-      case SEARCH_END:
-        if (u16_mLastRecvBytesCnt < u16_lRecvDataLen - 3)
-        {
-          cksum += u8_lRecvByte;
-        }
-        p_lRecvBytes[u16_mLastRecvBytesCnt] = u8_lRecvByte;
-        u16_mLastRecvBytesCnt++;
-        break;
-
-      default:
-        break;
-      }
-      u8_CyclesWithoutData = 0;
-    }
-    else if (u16_mLastRecvBytesCnt == 0)
-      vTaskDelay(pdMS_TO_TICKS(10)); // Wenn noch keine Daten empfangen wurden, dann setze den Task 10ms aus
-    else if (u16_mLastRecvBytesCnt > 0 && u8_CyclesWithoutData > 10)
-      vTaskDelay(pdMS_TO_TICKS(10)); // Wenn trotz empfangenen Daten 10ms wieder nichts empfangen wurde, dann setze den Task 10ms aus
-    else                             // Wenn in diesem Zyklus keine Daten Empfangen wurde, dann setze den Task 1ms aus
-    {
-      u8_CyclesWithoutData++;
-      vTaskDelay(pdMS_TO_TICKS(1));
-    }
-
-    if (u16_mLastRecvBytesCnt == u16_lRecvDataLen) break; // Recv Pakage complete
-    if(u16_mLastRecvBytesCnt>=GOBELBMS_MAX_ANSWER_LEN) return false; //Answer too long!
+    BSC_LOGD(TAG, "Timeout: Serial=%i, u8_lRecvBytesCnt=%i", u8_mDevNr, decoder.pending());
+    return false;
   }
+  if (status != utils::FrameDecoder::Status::Frame)
+    return false; // Checksumme, Länge oder Endbyte falsch
 
 #ifdef GOBEL_DEBUG
   if (u16_mLastRecvBytesCnt > 5)
@@ -328,20 +261,6 @@ static bool recvAnswer(uint8_t *p_lRecvBytes)
   }
 #endif
 
-  if (p_lRecvBytes[u16_mLastRecvBytesCnt - 1] != 0x0d)
-    return false; // letztes Byte vor der crc muss 0x68 sein
-
-  cksum = 1 + ~cksum;
-  // Überprüfe Cheksum
-  uint8_t cksumH = (cksum >> 8) & 0xFF;
-  uint8_t cksumL = cksum & 0xFF;
-
-#ifdef GOBEL_DEBUG
-  BSC_LOGD(TAG, "ckhsum=%2.2x %2.2x", cksumH, cksumL);
-#endif
-  if (p_lRecvBytes[u16_mLastRecvBytesCnt - 3] != cksumH && p_lRecvBytes[u16_mLastRecvBytesCnt - 2] != cksumL)
-    return false;
-
   return true;
 }
 
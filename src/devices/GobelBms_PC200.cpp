@@ -7,6 +7,8 @@
 #include "BmsData.h"
 #include "mqtt_t.h"
 #include "log.h"
+#include "SerialRx.h"
+#include <utils/Crc.hpp>
 
 /*
 Getting pack analog information:
@@ -182,7 +184,7 @@ bool GobelBmsPC200_readBmsData(Stream *port, uint8_t devNr, void (*callback)(uin
       }
 
       if (ret == true)
-        setBmsLastDataMillis(BT_DEVICES_COUNT + u8_mDevNr + u8_lGobelAdrBmsData, millis());
+        bmsDataUpdateComplete(BT_DEVICES_COUNT + u8_mDevNr + u8_lGobelAdrBmsData, millis());
     }
 
     u8_lGobelAdrBmsData++;
@@ -238,69 +240,59 @@ static void getDataFromBms(uint8_t address, uint8_t function)
 
 static bool recvAnswer(uint8_t *p_lRecvBytes)
 {
-  uint8_t SMrecvState, u8_lRecvByte, u8_lRecvBytesCnt, u8_lRecvDataLen, u8_CyclesWithoutData;
-  uint32_t u32_lStartTime = millis();
+  int16_t i16_lRecvByte;
+  uint8_t SMrecvState, u8_lRecvByte, u8_lRecvBytesCnt, u8_lRecvDataLen;
+  uint32_t u32_lStartTime = micros();
+  serialRxRecordRequest(u8_mDevNr);
   SMrecvState = SEARCH_START;
   u8_lRecvBytesCnt = 0;
   u8_lRecvDataLen = 0xFF;
-  u8_CyclesWithoutData = 0;
   bool bo_lDataComplete = false;
 
   for (;;)
   {
-    // Timeout
-    if ((millis() - u32_lStartTime) > 500)
+    // Wartet auf das nächste Zeichen
+    i16_lRecvByte = serialRxReadByte(mPort, u32_lStartTime, 500);
+    if (i16_lRecvByte < 0) // Timeout
     {
       BSC_LOGE(TAG, "Timeout: Serial=%i, u8_lRecvDataLen=%i, u8_lRecvBytesCnt=%i", u8_mDevNr, u8_lRecvDataLen, u8_lRecvBytesCnt);
 #ifdef GOBELPC200_DEBUG
   BSC_Dump_MSGD(TAG, "Timeout: RecvBytes=", p_lRecvBytes, u8_lRecvBytesCnt);
 #endif
+      serialRxRecordTimeout(u8_mDevNr);
       return false;
     }
 
-    // Überprüfen ob Zeichen verfügbar
-    if (mPort->available() > 0)
+    u8_lRecvByte = (uint8_t)i16_lRecvByte;
+
+    switch (SMrecvState)
     {
-      u8_lRecvByte = mPort->read();
+    case SEARCH_START:
+      if (u8_lRecvByte == 0x7E)
+      {
+        SMrecvState = SEARCH_END;
+      }
+      break;
 
-      switch (SMrecvState)
+    case SEARCH_END:
+      p_lRecvBytes[u8_lRecvBytesCnt] = u8_lRecvByte;
+      if (u8_lRecvByte == 0x0D)
       {
-      case SEARCH_START:
-        if (u8_lRecvByte == 0x7E)
-        {
-          SMrecvState = SEARCH_END;
-        }
+        bo_lDataComplete = true;
         break;
+      }
 
-      case SEARCH_END:
-        p_lRecvBytes[u8_lRecvBytesCnt] = u8_lRecvByte;
-        if (u8_lRecvByte == 0x0D)
-        {
-          bo_lDataComplete = true;
-          break;
-        }
-
-        u8_lRecvBytesCnt++;
-        break;
+      u8_lRecvBytesCnt++;
+      break;
 
-      default:
-        break;
-      }
-      u8_CyclesWithoutData = 0;
-    }
-    else if (u8_lRecvBytesCnt == 0)
-      vTaskDelay(pdMS_TO_TICKS(10)); // Wenn noch keine Daten empfangen wurden, dann setze den Task 10ms aus
-    else if (u8_lRecvBytesCnt > 0 && u8_CyclesWithoutData > 10)
-      vTaskDelay(pdMS_TO_TICKS(10)); // Wenn trotz empfangenen Daten 10ms wieder nichts empfangen wurde, dann setze den Task 10ms aus
-    else                             // Wenn in diesem Zyklus keine Daten Empfangen wurde, dann setze den Task 1ms aus
-    {
-      u8_CyclesWithoutData++;
-      vTaskDelay(pdMS_TO_TICKS(1));
+    default:
+      break;
     }
 
     if (bo_lDataComplete)
       break; // Recv Pakage complete
   }
+  serialRxRecordResponse(u8_mDevNr, u32_lStartTime);
 
 #ifdef GOBELPC200_DEBUG
   BSC_Dump_MSGD(TAG, "RecvBytes=", p_lRecvBytes, u8_lRecvBytesCnt);
@@ -308,7 +300,10 @@ static bool recvAnswer(uint8_t *p_lRecvBytes)
 
   // Überprüfe Checksum
   if (!checkCrc(p_lRecvBytes, u8_lRecvBytesCnt))
+  {
+    serialRxRecordChecksumError(u8_mDevNr);
     return false;
+  }
 
   return true;
 }
@@ -771,12 +766,5 @@ static bool checkCrc(uint8_t *recvMsg, uint8_t u8_lRecvBytesCnt)
 
 static uint16_t calcCrc(uint8_t *data, const uint16_t i16_lLen)
 {
-  uint16_t u16_lSum = 0x00;
-  for (uint16_t i = 0; i < i16_lLen; i++)
-  {
-    u16_lSum = u16_lSum + data[i];
-  }
-  u16_lSum = ~u16_lSum;
-  u16_lSum++;
-  return u16_lSum;
+  return utils::checksum::negSum16(data, i16_lLen);
 }
\ No newline at end of file
@@ -8,13 +8,19 @@
 #include "mqtt_t.h"
 #include "log.h"
 #include "WebSettings.h"
+#include "SerialRx.h"
+#include <utils/Crc.hpp>
 
 static const char *TAG = "JBD_BMS";
 
 static Stream *mPort;
 static uint8_t u8_mDevNr;
 
-enum SM_readData {SEARCH_START, SEARCH_END};
+// 0xDD, Register, Status, Länge, Daten, Checksumme (2 Bytes), 0x77
+static constexpr utils::FrameFormat jbdFrameFormat {
+  .soi = {0xDD}, .soiLen = 1, .storeSoi = true, .eoi = 0x77,
+  .length = utils::FrameFormat::Length::Field, .lenPos = 3, .lenSize = 1, .lenAdd = 7, .maxLen = JBDBMS_MAX_ANSWER_LEN,
+  .checksum = utils::FrameFormat::Checksum::NegSum16, .checksumSize = 2, .checksumTail = 1, .checksumStart = 2};
 
 static uint8_t basicMsg[] = { 0xDD, 0xA5, 0x03, 0x00, 0xFF, 0xFD, 0x77 };
 static uint8_t cellMsg[]  = { 0xDD, 0xA5, 0x04, 0x00, 0xFF, 0xFC, 0x77 };
@@ -35,7 +41,6 @@ static void      parseCellVoltageMessage(uint8_t * t_message);
 static uint16_t  convertToUint16(int highbyte, int lowbyte);
 static int16_t   convertToInt16(int highbyte, int lowbyte);
 
-static bool      checkCrc(uint8_t *recvMsg);
 static uint16_t  calcCrc(uint8_t *recvMsg);
 
 static void (*callbackSetTxRxEn)(uint8_t, uint8_t) = NULL;
@@ -126,70 +131,16 @@ static void sendMessage(uint8_t *sendMsg, uint8_t len)
 
 static bool recvAnswer(uint8_t *p_lRecvBytes)
 {
-  uint8_t SMrecvState, u8_lRecvByte, u8_lRecvBytesCnt, u8_lRecvDataLen, u8_CyclesWithoutData;
-  uint32_t u32_lStartTime=millis();
-  SMrecvState=SEARCH_START;
-  u8_lRecvBytesCnt=0;
-  u8_lRecvDataLen=0xFF;
-  u8_CyclesWithoutData=0;
-
-  for(;;)
+  utils::FrameDecoder decoder(jbdFrameFormat, p_lRecvBytes, JBDBMS_MAX_ANSWER_LEN);
+  utils::FrameDecoder::Status status=serialRxReadFrame(mPort, u8_mDevNr, decoder, micros(), 200);
+  if(status==utils::FrameDecoder::Status::Incomplete)
   {
-    //Timeout
-    if((millis()-u32_lStartTime)>200)
-    {
-      BSC_LOGI(TAG,"Timeout: Serial=%i, u8_lRecvDataLen=%i, u8_lRecvBytesCnt=%i", u8_mDevNr, u8_lRecvDataLen, u8_lRecvBytesCnt);
-      /*for(uint8_t x=0;x<u8_lRecvBytesCnt;x++)
-      {
-        BSC_LOGD(TAG,"Byte=%i: %i",x, String(p_lRecvBytes[x]));
-      }*/
-      return false;
-    }
-
-    //Überprüfen ob Zeichen verfügbar
-    if (mPort->available() > 0)
-    {
-      u8_lRecvByte = mPort->read();
-
-      switch (SMrecvState)  {
-        case SEARCH_START:
-          if (u8_lRecvByte == 0xDD)
-          {
-            p_lRecvBytes[u8_lRecvBytesCnt]=u8_lRecvByte;
-            u8_lRecvBytesCnt++;
-            SMrecvState=SEARCH_END;
-          }
-          break;
-
-        case SEARCH_END:
-          p_lRecvBytes[u8_lRecvBytesCnt]=u8_lRecvByte;
-          if(u8_lRecvBytesCnt==3) u8_lRecvDataLen=p_lRecvBytes[u8_lRecvBytesCnt]; //Länge des zu empfangenden Pakets
-          u8_lRecvBytesCnt++;
-          break;
-
-        default:
-          break;
-        }
-      u8_CyclesWithoutData=0;
-    }
-    else if (u8_lRecvBytesCnt==0) vTaskDelay(pdMS_TO_TICKS(10)); // Wenn noch keine Daten empfangen wurden, dann setze den Task 10ms aus
-    else if (u8_lRecvBytesCnt>0 && u8_CyclesWithoutData>10) vTaskDelay(pdMS_TO_TICKS(10)); // Wenn trotz empfangenen Daten 10ms wieder nichts empfangen wurde, dann setze den Task 10ms aus
-    else // Wenn in diesem Zyklus keine Daten Empfangen wurde, dann setze den Task 1ms aus
-    {
-      u8_CyclesWithoutData++;
-      vTaskDelay(pdMS_TO_TICKS(1));
-    }
-
-    if(u8_lRecvBytesCnt==4+u8_lRecvDataLen+3) break; //Recv Pakage complete
-    if(u8_lRecvBytesCnt>=JBDBMS_MAX_ANSWER_LEN) return false; //Answer too long!
+    BSC_LOGI(TAG,"Timeout: Serial=%i, u8_lRecvBytesCnt=%i", u8_mDevNr, decoder.pending());
+    return false;
   }
+  if(status!=utils::FrameDecoder::Status::Frame) return false; //Checksumme oder Länge falsch
 
   if(p_lRecvBytes[2]!=0x0) return false; //0x0 ok; 0x80 Fehler
-  if(p_lRecvBytes[u8_lRecvBytesCnt-1]!=0x77) return false; //letztes Byte muss 0x77 sein
-
-  //Überprüfe Cheksum
-  if(checkCrc(p_lRecvBytes)==false) return false;
-
   return true;
 }
 
@@ -336,27 +287,11 @@ static int16_t convertToInt16(int highbyte, int lowbyte)
 }
 
 
-static bool checkCrc(uint8_t *recvMsg)
-{
-  uint8_t u8_lDataLen = recvMsg[3];
-  calcCrc(recvMsg);
-  uint16_t checkSumRecv = (recvMsg[4+u8_lDataLen]<<8) | (recvMsg[4+u8_lDataLen+1]);
-
-  if (checkSumRecv != calcCrc(recvMsg)) return false;
-  return true;
-}
-
-
 static uint16_t calcCrc(uint8_t *recvMsg)
 {
 	uint8_t u8_lDataLen = recvMsg[3];
-	uint16_t u8_lSum = 0;
-
-	for (int i=4; i<u8_lDataLen+4; i++)
-	{
-		u8_lSum = u8_lSum + recvMsg[i];
-	}
-	return (u8_lSum+u8_lDataLen-1) ^ 0xFFFF;
+	uint16_t u16_lSum = utils::checksum::sum16(&recvMsg[4], u8_lDataLen);
+	return (u16_lSum+u8_lDataLen-1) ^ 0xFFFF;
 }
 
 
@@ -7,6 +7,7 @@
 #include "BmsData.h"
 #include "mqtt_t.h"
 #include "log.h"
+#include "SerialRx.h"
 #include <devices/jkbms/JkBmsTypes.hpp>
 
 static const char *TAG = "JK_BMS";
@@ -15,7 +16,11 @@ static Stream *mPort;
 static uint8_t u8_mDevNr;
 static uint16_t u16_mLastRecvBytesCnt;
 
-enum SM_readData {SEARCH_START_BYTE1, SEARCH_START_BYTE2, LEN1, LEN2, SEARCH_END};
+// 0x4E 0x57, Länge (2 Bytes, ab dem Längenfeld), Daten, 0x68, Checksumme (4 Bytes, Summe inkl. 0x4E 0x57)
+static constexpr utils::FrameFormat jkFrameFormat {
+  .soi = {0x4E, 0x57}, .soiLen = 2, .storeSoi = false,
+  .length = utils::FrameFormat::Length::Field, .lenPos = 2, .lenSize = 2, .lenAdd = 2, .maxLen = JKBMS_MAX_ANSWER_LEN+2,
+  .checksum = utils::FrameFormat::Checksum::Sum16, .checksumSize = 4};
 
 static uint8_t getDataMsg[] = {0x4E, 0x57, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x01, 0x29};
 
@@ -68,78 +73,15 @@ static void sendMessage(uint8_t *sendMsg)
 
 static bool recvAnswer(uint8_t *p_lRecvBytes)
 {
-  uint8_t SMrecvState, u8_lRecvByte, u8_CyclesWithoutData;
-  uint16_t u16_lRecvDataLen;
-  uint32_t u32_lStartTime=millis();
-  SMrecvState=SEARCH_START_BYTE1;
-  u16_mLastRecvBytesCnt=0;
-  u16_lRecvDataLen=0xFFFF;
-  u8_CyclesWithoutData=0;
-  uint16_t crc=0;
-
-  for(;;)
+  utils::FrameDecoder decoder(jkFrameFormat, p_lRecvBytes, JKBMS_MAX_ANSWER_LEN);
+  utils::FrameDecoder::Status status=serialRxReadFrame(mPort, u8_mDevNr, decoder, micros(), 200);
+  u16_mLastRecvBytesCnt=decoder.length();
+  if(status==utils::FrameDecoder::Status::Incomplete)
   {
-    //Timeout
-    if((millis()-u32_lStartTime)>200)
-    {
-      BSC_LOGI(TAG,"Timeout: Serial=%i, u8_lRecvDataLen=%i, u8_lRecvBytesCnt=%i",u8_mDevNr, u16_lRecvDataLen, u16_mLastRecvBytesCnt);
-      /*for(uint16_t x=0;x<u16_mLastRecvBytesCnt;x++)
-      {
-        BSC_LOGD(TAG,"Byte=%i: %i",x, String(p_lRecvBytes[x]));
-      }*/
-      return false;
-    }
-
-    //Überprüfen ob Zeichen verfügbar
-    if (mPort->available() > 0)
-    {
-      u8_lRecvByte = mPort->read();
-      if(u16_mLastRecvBytesCnt<u16_lRecvDataLen-4){crc += u8_lRecvByte;}
-
-      switch (SMrecvState)  {
-        case SEARCH_START_BYTE1:
-          if (u8_lRecvByte == 0x4E){SMrecvState=SEARCH_START_BYTE2;}
-          break;
-
-        case SEARCH_START_BYTE2:
-          if (u8_lRecvByte == 0x57){SMrecvState=LEN1;}
-          break;
-
-        case LEN1:
-          p_lRecvBytes[u16_mLastRecvBytesCnt]=u8_lRecvByte;
-          u16_mLastRecvBytesCnt++;
-          u16_lRecvDataLen=(u8_lRecvByte<<8);
-          SMrecvState=LEN2;
-          break;
-
-        case LEN2:
-          p_lRecvBytes[u16_mLastRecvBytesCnt]=u8_lRecvByte;
-          u16_mLastRecvBytesCnt++;
-          u16_lRecvDataLen|=u8_lRecvByte;
-          SMrecvState=SEARCH_END;
-          break;
-
-        case SEARCH_END:
-          p_lRecvBytes[u16_mLastRecvBytesCnt]=u8_lRecvByte;
-          u16_mLastRecvBytesCnt++;
-          break;
-
-        default:
-          break;
-        }
-      u8_CyclesWithoutData=0;
-    }
-    else if (u16_mLastRecvBytesCnt==0) vTaskDelay(pdMS_TO_TICKS(10)); // Wenn noch keine Daten empfangen wurden, dann setze den Task 10ms aus
-    else if (u16_mLastRecvBytesCnt>0 && u8_CyclesWithoutData>10) vTaskDelay(pdMS_TO_TICKS(10)); // Wenn trotz empfangenen Daten 10ms wieder nichts empfangen wurde, dann setze den Task 10ms aus
-    else // Wenn in diesem Zyklus keine Daten Empfangen wurden, dann setze den Task 1ms aus
-    {
-      u8_CyclesWithoutData++;
-    vTaskDelay(pdMS_TO_TICKS(1));
-    }
-
-    if(u16_mLastRecvBytesCnt==u16_lRecvDataLen) break; //Recv Pakage complete
-    if(u16_mLastRecvBytesCnt>=JKBMS_MAX_ANSWER_LEN) return false; //Answer too long!
+    BSC_LOGI(TAG,"Timeout: Serial=%i, u8_lRecvBytesCnt=%i",u8_mDevNr, decoder.pending());
+    return false;
   }
+  if(status!=utils::FrameDecoder::Status::Frame) return false; //Checksumme oder Länge falsch
 
 
   #ifdef JK_DEBUG
@@ -152,15 +94,6 @@ static bool recvAnswer(uint8_t *p_lRecvBytes)
 
   if(p_lRecvBytes[u16_mLastRecvBytesCnt-5]!=0x68) return false; //letztes Byte vor der crc muss 0x68 sein
 
-  //Überprüfe Cheksum
-	uint8_t crcB3 = (crc >> 8) & 0xFF;  // Byte 3
-  uint8_t crcB4 = crc & 0xFF;         // Byte 4
-
-  #ifdef JK_DEBUG
-  BSC_LOGD(TAG,"crc=%i %i", crcB3, crcB4);
-  #endif
-  if(p_lRecvBytes[u16_mLastRecvBytesCnt-2]!=crcB3 && p_lRecvBytes[u16_mLastRecvBytesCnt-1]!=crcB4) return false;
-
   return true;
 }
 
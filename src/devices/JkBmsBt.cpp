@@ -7,6 +7,7 @@
 #include "devices/JkBmsBt.h"
 #include "BmsData.h"
 #include "mqtt_t.h"
+#include <utils/Crc.hpp>
 
 static const char *TAG = "JKBT";
 
@@ -20,7 +21,8 @@ void jkBmsBtDevInit(uint8_t devNr)
   bo_mStartSeyOk[devNr]=false;
 }
 
-void jkBmsBtCopyData(uint8_t devNr, uint8_t frameVersion, uint8_t* pData, size_t length)
+//Gibt false zurück, wenn die Daten nicht in die erwartete Framefolge passen
+bool jkBmsBtCopyData(uint8_t devNr, uint8_t frameVersion, uint8_t* pData, size_t length)
 {
   if(length>=20)
   {
@@ -36,11 +38,11 @@ void jkBmsBtCopyData(uint8_t devNr, uint8_t frameVersion, uint8_t* pData, size_t
     }
 
     //Fehlerauswertung Framelänge  (128,22,128,22,20?)
-    if(u8_mRecvFrameNr[devNr]==1 && length!=128){u8_mRecvFrameNr[devNr]=0; return;}
-    else if(u8_mRecvFrameNr[devNr]==2 && length!=22){u8_mRecvFrameNr[devNr]=0; return;}
-    else if(u8_mRecvFrameNr[devNr]==3 && length!=128){u8_mRecvFrameNr[devNr]=0; return;}
-    else if(u8_mRecvFrameNr[devNr]==4 && length!=22){u8_mRecvFrameNr[devNr]=0; return;}
-    else if(u8_mRecvFrameNr[devNr]==5 && length!=20){u8_mRecvFrameNr[devNr]=0; return;}
+    if(u8_mRecvFrameNr[devNr]==1 && length!=128){u8_mRecvFrameNr[devNr]=0; return false;}
+    else if(u8_mRecvFrameNr[devNr]==2 && length!=22){u8_mRecvFrameNr[devNr]=0; return false;}
+    else if(u8_mRecvFrameNr[devNr]==3 && length!=128){u8_mRecvFrameNr[devNr]=0; return false;}
+    else if(u8_mRecvFrameNr[devNr]==4 && length!=22){u8_mRecvFrameNr[devNr]=0; return false;}
+    else if(u8_mRecvFrameNr[devNr]==5 && length!=20){u8_mRecvFrameNr[devNr]=0; return false;}
 
     #if 0
     //Beispiel-Daten
@@ -85,23 +87,19 @@ void jkBmsBtCopyData(uint8_t devNr, uint8_t frameVersion, uint8_t* pData, size_t
       }
       if(u8_mRecvFrameNr[devNr]==4 || u8_mRecvFrameNr[devNr]==5)
       {
-        setBmsLastDataMillis(devNr,millis());
+        bmsDataUpdateComplete(devNr,millis());
         bo_mStartSeyOk[devNr]=false;
       }
     }
     #endif
   }
+  return true;
 }
 
 
 uint8_t jkBmsBtCrc(uint8_t *data, uint16_t len)
 {
-  uint8_t crc = 0;
-  for (uint16_t i = 0; i < len; i++)
-  {
-    crc = crc + data[i];
-  }
-  return crc;
+  return utils::checksum::sum8(data, len);
 }
 
 
@@ -7,6 +7,7 @@
 #include "BmsData.h"
 #include "mqtt_t.h"
 #include "log.h"
+#include "SerialRx.h"
 
 const char *TAG_V13 = "JK_BMS_V13";
 
@@ -22,7 +23,11 @@ uint16_t u16_mLastRecvBytesCntJkV13;
 static void (*callbackSetTxRxEn)(uint8_t, uint8_t) = NULL;
 static serialDevData_s *mDevData;
 
-enum SM_readDataV13 {SEARCH_START_BYTE1, SEARCH_START_BYTE2, SLAVE_ADDR, CMD_CODE, RECV_DATA};
+// 0xEB 0x90, Slave-Adresse, 0xFF, Daten, Checksumme (Summe aller Bytes inkl. Header)
+static constexpr utils::FrameFormat jkV13FrameFormat {
+  .soi = {0xEB, 0x90, JK_V13_SLAVE_ADDR, 0xFF}, .soiLen = headerLen, .storeSoi = false,
+  .length = utils::FrameFormat::Length::Fixed, .fixedLen = headerLen+JKBMSV13_MAX_ANSWER_LEN,
+  .checksum = utils::FrameFormat::Checksum::Sum8, .checksumSize = 1};
 
 void      JkBmsV13_sendMessage(uint8_t *sendMsg, uint32_t size);
 bool      JkBmsV13_recvAnswer(uint8_t * t_outMessage);
@@ -81,75 +86,19 @@ void JkBmsV13_sendMessage(uint8_t *sendMsg , uint32_t size)
 
 bool JkBmsV13_recvAnswer(uint8_t *p_lRecvBytes)
 {
-  uint8_t SMrecvState, u8_lRecvByte;
-  uint16_t u16_lRecvDataLen;
-  uint32_t u32_lStartTime=millis();
-  SMrecvState=SEARCH_START_BYTE1;
-  u16_mLastRecvBytesCntJkV13=0;
-  uint8_t crc=0;
-  char strTmp[1024];
-  char *sptr = strTmp;
-
-  for(;;)
+  utils::FrameDecoder decoder(jkV13FrameFormat, p_lRecvBytes, JKBMSV13_MAX_ANSWER_LEN);
+  utils::FrameDecoder::Status status=serialRxReadFrame(mPortJkV13, u8_mDevNrJkV13, decoder, micros(), 500);
+  u16_mLastRecvBytesCntJkV13=decoder.length();
+  if(status==utils::FrameDecoder::Status::Incomplete)
   {
-    //Timeout
-    if(millis()-u32_lStartTime > 500)
-    {
-      BSC_LOGD(TAG_V13,"Timeout: Serial=%i, u8_lRecvDataLen=%i, u8_lRecvBytesCnt=%i\n",u8_mDevNrJkV13, u16_lRecvDataLen, u16_mLastRecvBytesCntJkV13);
-      //for(uint16_t x=0;x<u16_lRecvDataLen;x++)
-      //{
-      //  BSC_LOGD(TAG_V13,"%02x ",p_lRecvBytes[x]);
-      //}
-      //if(u16_lRecvDataLen != 0){
-      //  BSC_LOGI(TAG_V13,"%s",strTmp);
-      //}
-      return false;
-    }
-
-    //Überprüfen ob Zeichen verfügbar
-    if (mPortJkV13->available() > 0)
-    {
-      u16_lRecvDataLen++;
-      u8_lRecvByte = mPortJkV13->read();
-
-      if(u16_mLastRecvBytesCntJkV13<JKBMSV13_MAX_ANSWER_LEN-1){crc += u8_lRecvByte;}
-
-      switch (SMrecvState)  {
-        case SEARCH_START_BYTE1:
-          if (u8_lRecvByte == 0xEB){SMrecvState=SEARCH_START_BYTE2;}
-          break;
-        case SEARCH_START_BYTE2:
-          if (u8_lRecvByte == 0x90){SMrecvState=SLAVE_ADDR;}
-          break;
-        case SLAVE_ADDR:
-          if (u8_lRecvByte == JK_V13_SLAVE_ADDR){SMrecvState=CMD_CODE;}
-          break;
-        case CMD_CODE:
-          if (u8_lRecvByte == 0xFF){SMrecvState=RECV_DATA;}
-          break;
-        case RECV_DATA:
-          p_lRecvBytes[u16_mLastRecvBytesCntJkV13]=u8_lRecvByte;
-          u16_mLastRecvBytesCntJkV13++;
-          break;
-        default:
-          SMrecvState=SEARCH_START_BYTE1;
-          crc = 0;
-          break;
-        }
-
-    }
-
-    if(u16_mLastRecvBytesCntJkV13==JKBMSV13_MAX_ANSWER_LEN) break; //Recv Pakage complete
+    BSC_LOGD(TAG_V13,"Timeout: Serial=%i, u8_lRecvBytesCnt=%i\n",u8_mDevNrJkV13, decoder.pending());
+    return false;
   }
 
 #ifdef JKV13_DEBUG
   BSC_LOGD(TAG_V13,"recv cnt: %i",u16_mLastRecvBytesCntJkV13);
 #endif
-  //Überprüfe Cheksum
-  //debugPrintf("crc=%i %i\n", crcB3, crcB4);
-  if(p_lRecvBytes[u16_mLastRecvBytesCntJkV13-1]!=crc) return false;
-
-  return true;
+  return (status==utils::FrameDecoder::Status::Frame); //Checksumme
 }
 
 
@@ -263,7 +212,7 @@ void JkBmsV13_parseData(uint8_t * t_message)
   #endif
 
 
-  setBmsLastDataMillis(BT_DEVICES_COUNT+u8_mDevNrJkV13,millis());
+  bmsDataUpdateComplete(BT_DEVICES_COUNT+u8_mDevNrJkV13,millis());
 
   /*if(millis()>(mqttSendeTimer_jk_v13+10000))
   {
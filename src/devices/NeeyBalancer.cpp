@@ -7,6 +7,7 @@
 #include "devices/NeeyBalancer.h"
 #include "BmsData.h"
 #include "WebSettings.h"
+#include <utils/Crc.hpp>
 
 static const char* TAG = "NEEY";
 
@@ -151,7 +152,7 @@ void NeeyBalancer::neeyBalancerCopyData(uint8_t devNr, uint8_t* pData, size_t le
     setBmsMinCellVoltage(devNr, f_lMinZellVoltage);
 
     //BSC_LOGI(TAG,"setBmsLastDataMillis");
-    setBmsLastDataMillis(devNr,millis());
+    bmsDataUpdateComplete(devNr,millis());
   }
   else if(length==59)
   {
@@ -173,12 +174,7 @@ void NeeyBalancer::neeyBalancerCopyData(uint8_t devNr, uint8_t* pData, size_t le
 
 uint8_t NeeyBalancer::neeyBtCrc(uint8_t* data, uint16_t len)
 {
-    uint8_t crc = 0;
-    for (uint16_t i = 0; i < len; i++)
-    {
-        crc = crc ^ data[i];
-    }
-    return crc;
+    return utils::checksum::xor8(data, len);
 }
 
 
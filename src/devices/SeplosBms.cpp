@@ -7,13 +7,20 @@
 #include "BmsData.h"
 #include "mqtt_t.h"
 #include "log.h"
+#include "SerialRx.h"
+#include <utils/Crc.hpp>
 
 static const char *TAG = "SEPLOS_BMS";
 
 static Stream *mPort;
 static uint8_t u8_mTxEnRS485pin, u8_mCountOfPacks, u8_mDevNr;
 
-enum SM_readData {SEARCH_START, SEARCH_END};
+// '~', Daten als ASCII-Hex, Checksumme (4 Zeichen), CR
+static constexpr utils::FrameFormat seplosFrameFormat {
+  .soi = {0x7E}, .soiLen = 1, .storeSoi = false, .eoi = 0x0D,
+  .length = utils::FrameFormat::Length::Eoi, .maxLen = SEPLOSBMS_MAX_ANSWER_LEN+1,
+  .encoding = utils::FrameFormat::Encoding::AsciiHex,
+  .checksum = utils::FrameFormat::Checksum::NegSum16, .checksumSize = 4, .checksumTail = 1, .checksumStart = 1};
 
 //
 static float    f_mTotalVoltageOld=0xFFFF;
@@ -32,7 +39,6 @@ uint8_t         convertAsciiHexToByte(char a, char b);
 static char     convertByteToAsciiHex(uint8_t v);
 void            convertByteToAsciiHex(uint8_t *dest, uint8_t *data, size_t length);
 uint16_t        lCrc(const uint16_t len);
-static bool     checkCrc(uint8_t *recvMsg, uint8_t u8_lRecvBytesCnt);
 static uint16_t calcCrc(uint8_t *data, const uint16_t i16_lLen);
 
 static void (*callbackSetTxRxEn)(uint8_t, uint8_t) = NULL;
@@ -150,74 +156,17 @@ static void getDataFromBms(uint8_t address, uint8_t function)
 
 static bool recvAnswer(uint8_t *p_lRecvBytes)
 {
-  uint8_t SMrecvState, u8_lRecvByte, u8_lRecvBytesCnt, u8_lRecvDataLen, u8_CyclesWithoutData;
-  uint32_t u32_lStartTime=millis();
-  SMrecvState=SEARCH_START;
-  u8_lRecvBytesCnt=0;
-  u8_lRecvDataLen=0xFF;
-  u8_CyclesWithoutData=0;
-  bool bo_lDataComplete=false;
-
-  for(;;)
+  utils::FrameDecoder decoder(seplosFrameFormat, p_lRecvBytes, SEPLOSBMS_MAX_ANSWER_LEN);
+  utils::FrameDecoder::Status status=serialRxReadFrame(mPort, u8_mDevNr, decoder, micros(), 200);
+  if(status==utils::FrameDecoder::Status::Incomplete)
   {
-    //Timeout
-    if((millis()-u32_lStartTime)>200)
-    {
-      BSC_LOGE(TAG,"Timeout: Serial=%i, u8_lRecvDataLen=%i, u8_lRecvBytesCnt=%i", u8_mDevNr, u8_lRecvDataLen, u8_lRecvBytesCnt);
-      #ifdef SEPLOS_DEBUG
-      String recvBytes="";
-      for(uint8_t x=0;x<u8_lRecvBytesCnt;x++)
-      {
-        recvBytes+="0x";
-        recvBytes+=String(p_lRecvBytes[x],16);
-        recvBytes+=" ";
-      }
-      BSC_LOGD(TAG,"Timeout: RecvBytes=%i: %s",u8_lRecvBytesCnt, recvBytes.c_str());
-      #endif
-      return false;
-    }
-
-    //Überprüfen ob Zeichen verfügbar
-    if (mPort->available() > 0)
-    {
-      u8_lRecvByte = mPort->read();
-
-      switch (SMrecvState)
-      {
-        case SEARCH_START:
-          if (u8_lRecvByte == 0x7E)
-          {
-            SMrecvState=SEARCH_END;
-          }
-          break;
-
-        case SEARCH_END:
-          p_lRecvBytes[u8_lRecvBytesCnt]=u8_lRecvByte;
-          if(u8_lRecvByte == 0x0D)
-          {
-            bo_lDataComplete=true;
-            break;
-          }
-
-          u8_lRecvBytesCnt++;
-          break;
-
-        default:
-          break;
-      }
-      u8_CyclesWithoutData=0;
-    }
-    else if (u8_lRecvBytesCnt==0) vTaskDelay(pdMS_TO_TICKS(10)); // Wenn noch keine Daten empfangen wurden, dann setze den Task 10ms aus
-    else if (u8_lRecvBytesCnt>0 && u8_CyclesWithoutData>10) vTaskDelay(pdMS_TO_TICKS(10)); // Wenn trotz empfangenen Daten 10ms wieder nichts empfangen wurde, dann setze den Task 10ms aus
-    else // Wenn in diesem Zyklus keine Daten Empfangen wurde, dann setze den Task 1ms aus
-    {
-      u8_CyclesWithoutData++;
-      vTaskDelay(pdMS_TO_TICKS(1));
-    }
-
-    if(bo_lDataComplete) break; //Recv Pakage complete
-    if(u8_lRecvBytesCnt>=SEPLOSBMS_MAX_ANSWER_LEN) return false; //Answer too long!
+    BSC_LOGE(TAG,"Timeout: Serial=%i, u8_lRecvBytesCnt=%i", u8_mDevNr, decoder.pending());
+    return false;
   }
+  if(status==utils::FrameDecoder::Status::ChecksumError) BSC_LOGE(TAG, "CRC failed");
+  if(status!=utils::FrameDecoder::Status::Frame) return false;
+
+  uint8_t u8_lRecvBytesCnt=decoder.length()-1; //ohne CR
   u16_mRecvBytesLastMsg=u8_lRecvBytesCnt; //for debug
 
   #ifdef SEPLOS_DEBUG
@@ -241,9 +190,6 @@ static bool recvAnswer(uint8_t *p_lRecvBytes)
   //log_print_buf(p_lRecvBytes, u8_lRecvBytesCnt);
   #endif
 
-  //Überprüfe Cheksum
-  if(!checkCrc(p_lRecvBytes,u8_lRecvBytesCnt))return false;
-
   return true;
 }
 
@@ -807,32 +753,9 @@ uint16_t lCrc(const uint16_t len)
 }
 
 
-static bool checkCrc(uint8_t *recvMsg, uint8_t u8_lRecvBytesCnt)
-{
-  uint16_t u16_lCrc = calcCrc(recvMsg, u8_lRecvBytesCnt-4);
- 	uint16_t u16_lRemoteCrc = (uint16_t)convertAsciiHexToByte(recvMsg[u8_lRecvBytesCnt-2], recvMsg[u8_lRecvBytesCnt-1]) |
-    (uint16_t)(convertAsciiHexToByte(recvMsg[u8_lRecvBytesCnt-4], recvMsg[u8_lRecvBytesCnt-3]))<<8;
-
-  if (u16_lCrc != u16_lRemoteCrc)
-  {
-    BSC_LOGE(TAG, "CRC failed: %04X != %04X", u16_lCrc, u16_lRemoteCrc);
-    return false;
-  }
-
-  return true;
-}
-
-
 static uint16_t calcCrc(uint8_t *data, const uint16_t i16_lLen)
 {
-  uint16_t u16_lSum = 0x00;
-  for (uint16_t i=0; i<i16_lLen; i++)
-  {
-    u16_lSum=u16_lSum+data[i];
-  }
-  u16_lSum=~u16_lSum;
-  u16_lSum++;
-  return u16_lSum;
+  return utils::checksum::negSum16(data, i16_lLen);
 }
 
 
@@ -7,6 +7,7 @@
 #include "BmsData.h"
 #include "mqtt_t.h"
 #include "log.h"
+#include "SerialRx.h"
 #include "WebSettings.h"
 
 static const char *TAG = "SMARTSHUNT";
@@ -178,151 +179,139 @@ bool SmartShunt_readBmsData(Stream *port, uint8_t devNr, void (*callback)(uint8_
   uint8_t inbyte=0;
   uint8_t inbyteOrg=0;
   uint16_t	mChecksum; 
-  uint32_t u32_lStartTime=millis();
+  uint32_t u32_lStartTime=micros();
   rxValues=0;
 
   callbackSetTxRxEn(u8_mDevNr,serialRxTx_RxEn);
+  serialRxRecordRequest(u8_mDevNr); //Der SmartShunt sendet von sich aus; gezählt wird das Warten auf einen Block
 
   uint16_t byteReadCntGes=0;
   uint16_t byteReadCnt=0;
   for(;;)
   {
-    //Timeout
-    if((millis()-u32_lStartTime)>300) 
+    //Wartet auf das nächste Zeichen
+    int16_t i16_lRecvByte=serialRxReadByte(port, u32_lStartTime, 300);
+    if(i16_lRecvByte<0) //Timeout
     {
       BSC_LOGI(TAG,"Timeout: Serial=%i", u8_mDevNr);
+      serialRxRecordTimeout(u8_mDevNr);
       bo_ret = false;
-      bo_break = true;
+      break;
     }
-    
-    if(port->available())
-    {
-      byteReadCntGes++;
-			inbyteOrg = inbyte = port->read();
 
-      if((inbyte == ':') && (mState != CHECKSUM)) mState = RECORD_HEX;
-      if(mState != RECORD_HEX) mChecksum = ((mChecksum+inbyte)&255);
-      if(mState != RECORD_HEX) byteReadCnt++;
-      inbyte = toupper(inbyte);
+    byteReadCntGes++;
+    inbyteOrg = inbyte = (uint8_t)i16_lRecvByte;
 
-      switch(mState)
-      {
-        case IDLE:
-          /* wait for \n of the start of an record */
-          switch(inbyte)
-          {
-            case '\n': //0xa
-              mState = RECORD_BEGIN;
-              break;
-            case '\r': //0xd //Frame start
-              mChecksum = inbyteOrg;
-              byteReadCnt=1;
-            default:
-              break;
-          }
-          break;
-        case RECORD_BEGIN:
-          mTextPointer = mName;
-          *mTextPointer++ = inbyte;
-          mState = RECORD_NAME;
-          break;
-        case RECORD_NAME:
-          // The record name is being received, terminated by a \t
-          switch(inbyte)
-          {
-            case '\t': //0x9
-              // the Checksum record indicates a EOR
-              if(mTextPointer < (mName + sizeof(mName)))
-              {
-                *mTextPointer = 0;
-                if (strcmp(mName, checksumTagName) == 0) {
-                  mState = CHECKSUM;
-                  break;
-                }
-              }
-              mTextPointer = mValue; /* Reset value pointer */
-              mState = RECORD_VALUE;
-              break;
-            default:
-              // add byte to name, but do no overflow
-              if(mTextPointer < (mName + sizeof(mName))) *mTextPointer++ = inbyte;
-              break;
-          }
-          break;
-        case RECORD_VALUE:
-          // The record value is being received.  The \r indicates a new record.
-          switch(inbyte)
-          {
-            case '\n':
-              // forward record, only if it could be stored completely
-              if(mTextPointer < (mValue + sizeof(mValue)))
-              {
-                *mTextPointer = 0; // make zero ended
-                newLabelRecv(mName, mValue);
+    if((inbyte == ':') && (mState != CHECKSUM)) mState = RECORD_HEX;
+    if(mState != RECORD_HEX) mChecksum = ((mChecksum+inbyte)&255);
+    if(mState != RECORD_HEX) byteReadCnt++;
+    inbyte = toupper(inbyte);
+
+    switch(mState)
+    {
+      case IDLE:
+        /* wait for \n of the start of an record */
+        switch(inbyte)
+        {
+          case '\n': //0xa
+            mState = RECORD_BEGIN;
+            break;
+          case '\r': //0xd //Frame start
+            mChecksum = inbyteOrg;
+            byteReadCnt=1;
+          default:
+            break;
+        }
+        break;
+      case RECORD_BEGIN:
+        mTextPointer = mName;
+        *mTextPointer++ = inbyte;
+        mState = RECORD_NAME;
+        break;
+      case RECORD_NAME:
+        // The record name is being received, terminated by a \t
+        switch(inbyte)
+        {
+          case '\t': //0x9
+            // the Checksum record indicates a EOR
+            if(mTextPointer < (mName + sizeof(mName)))
+            {
+              *mTextPointer = 0;
+              if (strcmp(mName, checksumTagName) == 0) {
+                mState = CHECKSUM;
+                break;
               }
-              mState = RECORD_BEGIN;
-              break;
-            case '\r': /* Skip */
-              break;
-            default:
-              // add byte to value, but do no overflow
-              if(mTextPointer < (mValue + sizeof(mValue))) *mTextPointer++ = inbyte;
-              break;
-          }
-          break;
-        case CHECKSUM:
+            }
+            mTextPointer = mValue; /* Reset value pointer */
+            mState = RECORD_VALUE;
+            break;
+          default:
+            // add byte to name, but do no overflow
+            if(mTextPointer < (mName + sizeof(mName))) *mTextPointer++ = inbyte;
+            break;
+        }
+        break;
+      case RECORD_VALUE:
+        // The record value is being received.  The \r indicates a new record.
+        switch(inbyte)
         {
-          if(mChecksum==0) 
-          {
-            if(rxValues==RX_VAL_OK) 
+          case '\n':
+            // forward record, only if it could be stored completely
+            if(mTextPointer < (mValue + sizeof(mValue)))
             {
-              frameEnd();
-              bo_break=true;
+              *mTextPointer = 0; // make zero ended
+              newLabelRecv(mName, mValue);
             }
-          }
-          else
+            mState = RECORD_BEGIN;
+            break;
+          case '\r': /* Skip */
+            break;
+          default:
+            // add byte to value, but do no overflow
+            if(mTextPointer < (mValue + sizeof(mValue))) *mTextPointer++ = inbyte;
+            break;
+        }
+        break;
+      case CHECKSUM:
+      {
+        if(mChecksum==0) 
+        {
+          if(rxValues==RX_VAL_OK) 
           {
-            errCntSmartShunt++;
-            BSC_LOGE(TAG,"Invalid frame (%i)",mChecksum);
-            bo_ret=false;
+            frameEnd();
+            serialRxRecordResponse(u8_mDevNr, u32_lStartTime);
             bo_break=true;
           }
+        }
+        else
+        {
+          errCntSmartShunt++;
+          serialRxRecordChecksumError(u8_mDevNr);
+          BSC_LOGE(TAG,"Invalid frame (%i)",mChecksum);
+          bo_ret=false;
+          bo_break=true;
+        }
+        mChecksum = 0;
+        mState = IDLE;
+        break;
+      }
+      case RECORD_HEX:
+        if(hexRx(inbyte))
+        {
           mChecksum = 0;
           mState = IDLE;
-          break;
         }
-        case RECORD_HEX:
-          if(hexRx(inbyte))
-          {
-            mChecksum = 0;
-            mState = IDLE;
-          }
-          break;
-      }
-    }
-    else
-    {
-      //When not a new char available
-      vTaskDelay(pdMS_TO_TICKS(1));
+        break;
     }
 
     if(bo_break) break;
   }
 
   //Buffer leeren
-  uint16_t byteDelCnt=0;
-  for (unsigned long clearRxBufTime = millis(); millis()-clearRxBufTime<100;)
-  {
-    if(port->available()) 
-    {
-      port->read();
-      byteDelCnt++;
-    }
-    else break;
-  }
+  serialRxClear(port);
 
 
   if(devNr>=2) callbackSetTxRxEn(u8_mDevNr,serialRxTx_RxTxDisable);
-  //BSC_LOGI(TAG,"ret=%d, rxVal=%i, delCnt=%i, readCntGes=%i, errCnt=%i",bo_ret, rxValues, byteDelCnt, byteReadCntGes, errCntSmartShunt);
+  //BSC_LOGI(TAG,"ret=%d, rxVal=%i, readCntGes=%i, errCnt=%i",bo_ret, rxValues, byteReadCntGes, errCntSmartShunt);
   return bo_ret; 
 }
@@ -13,6 +13,8 @@
 #include "BmsData.h"
 #include "mcp23017.h"
 #include "dio.h"
+#include "I2cBulkFrame.hpp"
+#include "SettingsView.h"
 
 static const char *TAG = "I2C";
 
@@ -29,6 +31,13 @@ uint8_t u8_mI2cRxBuf[4];
 boolean bo_mI2cRxOk=false;
 SemaphoreHandle_t mutexI2cRx = NULL;
 
+#define I2C_SLAVE_BMS_COUNT 3 //Anzahl der seriellen BMS, die von einem Slave abgefragt werden
+
+static SemaphoreHandle_t mI2cStatisticsMutex = NULL;
+static struct i2cStatistics_s i2cStatistics;
+static i2cbulk::SequenceTracker slaveSequence[I2C_CNT_SLAVES]; //Die Sequenznummer zählt pro Slave (alle BMS)
+static uint8_t u8_mBulkSequence=0;
+
 
 void isI2CdeviceConn();
 void displaySendData_bms();
@@ -37,6 +46,7 @@ void getBscSlaveData(uint8_t u8_slaveNr);
 void i2cSendDataToMaster();
 void i2cInitExtSerial();
 void i2cExtSerialSetEnable(uint8_t u8_serialDevNr, serialRxTxEn_e serialRxTxEn);
+void i2cSendBmsBulkData(uint8_t i2cAdr, uint8_t u8_bmsNr, uint8_t u8_dispBmsNr);
 
 /*
  * Slave
@@ -78,6 +88,8 @@ void i2cWriteRegister(uint8_t u8_i2cDevAdr, uint8_t u8_reg, uint8_t u8_data)
 void i2cInit()
 {
   mutexI2cRx = xSemaphoreCreateMutex();
+  mI2cStatisticsMutex = xSemaphoreCreateMutex();
+  memset(&i2cStatistics, 0, sizeof(i2cStatistics));
 
   for(uint8_t i=0; i<I2C_CNT_SLAVES; i++)
   {
@@ -174,10 +186,25 @@ bool isSerialExtEnabled()
 }
 
 
+void i2cGetStatistics(struct i2cStatistics_s &stats)
+{
+  if(mI2cStatisticsMutex==NULL)
+  {
+    memset(&stats, 0, sizeof(stats));
+    return;
+  }
+  xSemaphoreTake(mI2cStatisticsMutex, portMAX_DELAY);
+  stats = i2cStatistics;
+  xSemaphoreGive(mI2cStatisticsMutex);
+}
+
+
 void i2cCyclicRun()
 {
   if(u8_mMasterSlaveId==ID_I2C_MASTER)
   {
+    uint32_t u32_lStartUs = micros();
+
     //Display
     if(bo_mDisplayEnabled)
     {
@@ -189,7 +216,34 @@ void i2cCyclicRun()
     {
       if(bo_mSlaveEnabled[i]) getBscSlaveData(i);
     }
+
+    uint32_t u32_lCycleTimeUs = micros()-u32_lStartUs;
+    xSemaphoreTake(mI2cStatisticsMutex, portMAX_DELAY);
+    i2cStatistics.cycleTimeLastUs = u32_lCycleTimeUs;
+    if(u32_lCycleTimeUs>i2cStatistics.cycleTimeMaxUs) i2cStatistics.cycleTimeMaxUs=u32_lCycleTimeUs;
+    xSemaphoreGive(mI2cStatisticsMutex);
+  }
+}
+
+
+/* Sendet den Puffer in einer Transaktion und zählt die Statistik */
+static uint8_t i2cWrite(uint8_t i2cAdr, const uint8_t *buf, uint8_t len)
+{
+  xSemaphoreTake(mutexI2cRx, portMAX_DELAY);
+  Wire.beginTransmission(i2cAdr);
+  Wire.write(buf,len);
+  uint8_t error = Wire.endTransmission();
+  xSemaphoreGive(mutexI2cRx);
+
+  xSemaphoreTake(mI2cStatisticsMutex, portMAX_DELAY);
+  if(error==0)
+  {
+    i2cStatistics.txFrames++;
+    i2cStatistics.txBytes+=len;
   }
+  else i2cStatistics.txFailed++;
+  xSemaphoreGive(mI2cStatisticsMutex);
+  return error;
 }
 
 
@@ -209,114 +263,86 @@ void i2cSendData(uint8_t i2cAdr, uint8_t data1, uint8_t data2, uint8_t data3, co
   if(data1==BMS_DATA){bmsDataSemaphoreGive();}
   else if(data1==INVERTER_DATA){inverterDataSemaphoreGive();}
 
-  xSemaphoreTake(mutexI2cRx, portMAX_DELAY);
-  Wire.beginTransmission(i2cAdr);
-  uint8_t quant = Wire.write(txBuf,TXBUFF_OFFSET+dataLen);
-  uint8_t error = Wire.endTransmission();
-  xSemaphoreGive(mutexI2cRx);
+  i2cWrite(i2cAdr, txBuf, TXBUFF_OFFSET+dataLen);
 
   //vTaskDelay(pdMS_TO_TICKS(10));
 }
 
 
+/* Sendet alle Daten eines BMS in einem Bulk-Frame (BMS_BULK_DATA).
+ * u8_bmsNr: Nr. in den BmsData; u8_dispBmsNr: Nr. beim Empfänger */
+void i2cSendBmsBulkData(uint8_t i2cAdr, uint8_t u8_bmsNr, uint8_t u8_dispBmsNr)
+{
+  uint8_t txBuf[TXBUFF_OFFSET+i2cbulk::BMS_FRAME_LEN];
+  txBuf[0]=BMS_DATA;
+  txBuf[1]=BMS_BULK_DATA;
+  txBuf[2]=u8_dispBmsNr;
+  txBuf[3]=0x00;
+
+  BmsDataSnapshot bmsSnapshot;
+  getBmsDataSnapshot(u8_bmsNr, bmsSnapshot);
+  uint8_t u8_lFlags = ((millis()-bmsSnapshot.lastDataMillis)<5000) ? i2cbulk::FLAG_DATA_VALID : 0;
+  size_t frameLen = i2cbulk::encodeBms(bmsSnapshot, u8_dispBmsNr, u8_mBulkSequence++, u8_lFlags, &txBuf[TXBUFF_OFFSET]);
+
+  i2cWrite(i2cAdr, txBuf, TXBUFF_OFFSET+frameLen);
+}
+
+
 void i2cSendData(uint8_t i2cAdr, uint8_t data1, uint8_t data2, uint8_t data3, String data, uint8_t dataLen)
 {
   i2cSendData(i2cAdr, data1, data2, data3, data.c_str(), dataLen);
 }
 
 
-//Anfordern der Daten vom Slave
+/* Anfordern der Daten vom Slave.
+ * Pro BMS wird ein Bulk-Frame mit allen Daten in einer Transaktion geholt. */
 void getBscSlaveData(uint8_t u8_slaveNr)
 {
   uint8_t u8_slaveAdr=I2C_DEV_ADDR_SLAVE1;
   if(u8_slaveNr==0)u8_slaveAdr=I2C_DEV_ADDR_SLAVE1;
   else if(u8_slaveNr==1)u8_slaveAdr=I2C_DEV_ADDR_SLAVE2;
 
-  uint8_t u8_lBytesReceived=0;
-
-  for(uint8_t u8_lBmsNr=BMSDATA_FIRST_DEV_SERIAL;u8_lBmsNr<BMSDATA_LAST_DEV_SERIAL+1;u8_lBmsNr++)
+  for(uint8_t n=0;n<I2C_SLAVE_BMS_COUNT;n++)
   {
-    for(uint8_t u8_BmsDataTyp=(uint8_t)BMS_CELL_VOLTAGE; u8_BmsDataTyp<(uint8_t)BMS_LAST_DATA_MILLIS+1; u8_BmsDataTyp++)
+    uint8_t u8_lBmsNr=BMSDATA_FIRST_DEV_SERIAL+n;
+    uint8_t u8_lBmsNrNew=BMSDATA_FIRST_DEV_EXT+(u8_slaveNr*I2C_SLAVE_BMS_COUNT)+n;
+
+    uint8_t txBuf[TXBUFF_OFFSET]={BSC_GET_SLAVE_DATA, BMS_BULK_DATA, u8_lBmsNr, 0};
+    if(i2cWrite(u8_slaveAdr, txBuf, TXBUFF_OFFSET)!=0) continue;
+
+    uint8_t rxBuf[i2cbulk::BMS_FRAME_LEN];
+    xSemaphoreTake(mutexI2cRx, portMAX_DELAY);
+    uint8_t u8_lBytesReceived = Wire.requestFrom(u8_slaveAdr, (uint8_t)i2cbulk::BMS_FRAME_LEN);
+    if(u8_lBytesReceived>sizeof(rxBuf)) u8_lBytesReceived=sizeof(rxBuf);
+    Wire.readBytes(rxBuf, u8_lBytesReceived);
+    xSemaphoreGive(mutexI2cRx);
+
+    i2cbulk::FrameHeader header;
+    BmsDataSnapshot bmsSnapshot;
+    i2cbulk::DecodeResult result = i2cbulk::DecodeResult::TOO_SHORT;
+    if(u8_lBytesReceived>0) result = i2cbulk::decodeBms(rxBuf, u8_lBytesReceived, header, bmsSnapshot);
+    if(result==i2cbulk::DecodeResult::OK && header.bmsNr!=u8_lBmsNr) result=i2cbulk::DecodeResult::WRONG_VERSION;
+
+    xSemaphoreTake(mI2cStatisticsMutex, portMAX_DELAY);
+    i2cStatistics.rxBytes+=u8_lBytesReceived;
+    if(u8_lBytesReceived==0) i2cStatistics.rxTimeout++;
+    else if(result==i2cbulk::DecodeResult::OK)
     {
-      //vTaskDelay(pdMS_TO_TICKS(10));
-      Wire.beginTransmission(u8_slaveAdr);
-      Wire.flush();
-      Wire.write((uint8_t)BSC_GET_SLAVE_DATA);
-      Wire.write(u8_BmsDataTyp);
-      Wire.write(2); //u8_lBmsNr
-      Wire.write(0);
-      Wire.endTransmission();
-
-      u8_lBytesReceived = Wire.requestFrom(u8_slaveAdr, (uint8_t)50); //len: getBmsDataBytes(u8_BmsDataTyp)+2
-      if(u8_lBytesReceived>0)
-      {
-        uint8_t u8_lBmsNrNew, u8_BmsDataTypRet;
-        //if(u8_slaveNr==0)u8_lBmsNrNew=BMSDATA_FIRST_DEV_SLAVE1+u8_lBmsNr-BMSDATA_FIRST_DEV_SERIAL;
-        //else if(u8_slaveNr==1)u8_lBmsNrNew=BMSDATA_FIRST_DEV_SLAVE2+u8_lBmsNr-BMSDATA_FIRST_DEV_SERIAL;
-
-        uint8_t rxBuf[u8_lBytesReceived];
-        Wire.readBytes(rxBuf, u8_lBytesReceived);
-
-        u8_BmsDataTypRet=rxBuf[0];
-        //u8_lBmsNrNew=rxBuf[1];
-        if(u8_slaveNr==0)u8_lBmsNrNew=BMSDATA_FIRST_DEV_EXT+rxBuf[1]-BMSDATA_FIRST_DEV_SERIAL;
-        else if(u8_slaveNr==1)u8_lBmsNrNew=BMSDATA_FIRST_DEV_EXT+3+rxBuf[1]-BMSDATA_FIRST_DEV_SERIAL;
-
-        u8_lBmsNrNew=BMSDATA_FIRST_DEV_EXT; //zum Test
-
-        switch(u8_BmsDataTypRet)
-        {
-          case BMS_CELL_VOLTAGE:
-            memcpy(&p_lBmsData->bmsCellVoltage[u8_lBmsNrNew], &rxBuf[2], 48);
-            break;
-          case BMS_TOTAL_VOLTAGE:
-            memcpy(&p_lBmsData->bmsTotalVoltage[u8_lBmsNrNew], &rxBuf[2], 4);
-            break;
-          case BMS_MAX_CELL_DIFFERENCE_VOLTAGE:
-            memcpy(&p_lBmsData->bmsMaxCellDifferenceVoltage[u8_lBmsNrNew], &rxBuf[2], 2);
-            break;
-          case BMS_AVG_VOLTAGE:
-            memcpy(&p_lBmsData->bmsAvgVoltage[u8_lBmsNrNew], &rxBuf[2], 2);
-            break;
-          case BMS_TOTAL_CURRENT:
-            memcpy(&p_lBmsData->bmsTotalCurrent[u8_lBmsNrNew], &rxBuf[2], 2);
-            break;
-          case BMS_MAX_CELL_VOLTAGE:
-            memcpy(&p_lBmsData->bmsMaxCellVoltage[u8_lBmsNrNew], &rxBuf[2], 2);
-            break;
-          case BMS_MIN_CELL_VOLTAGE:
-            memcpy(&p_lBmsData->bmsMinCellVoltage[u8_lBmsNrNew], &rxBuf[2], 2);
-            break;
-          case BMS_MAX_VOLTAGE_CELL_NUMBER:
-            memcpy(&p_lBmsData->bmsMaxVoltageCellNumber[u8_lBmsNrNew], &rxBuf[2], 1);
-            break;
-          case BMS_MIN_VOLTAGE_CELL_NUMBER:
-            memcpy(&p_lBmsData->bmsMinVoltageCellNumber[u8_lBmsNrNew], &rxBuf[2], 1);
-            break;
-          case BMS_IS_BALANCING_ACTIVE:
-            memcpy(&p_lBmsData->bmsIsBalancingActive[u8_lBmsNrNew], &rxBuf[2], 1);
-            break;
-          case BMS_BALANCING_CURRENT:
-            memcpy(&p_lBmsData->bmsBalancingCurrent[u8_lBmsNrNew], &rxBuf[2], 4);
-            break;
-          case BMS_TEMPERATURE:
-            memcpy(&p_lBmsData->bmsTempature[u8_lBmsNrNew], &rxBuf[2], 12);
-            break;
-          case BMS_CHARGE_PERCENT:
-            memcpy(&p_lBmsData->bmsChargePercentage[u8_lBmsNrNew], &rxBuf[2], 1);
-            break;
-          case BMS_ERRORS:
-            memcpy(&p_lBmsData->bmsErrors[u8_lBmsNrNew], &rxBuf[2], 4);
-            break;
-          case BMS_LAST_DATA_MILLIS:
-            if(rxBuf[2]==true) p_lBmsData->bmsLastDataMillis[u8_lBmsNrNew]=millis();
-            //memcpy(&p_lBmsData->bmsLastDataMillis[u8_lBmsNrNew], &rxBuf[2], 4);
-            break;
-          default:
-            break;
-        }
-      }
+      i2cStatistics.rxFrames++;
+      i2cStatistics.rxLost+=slaveSequence[u8_slaveNr].update(header.sequence);
     }
+    else if(result==i2cbulk::DecodeResult::WRONG_CRC || result==i2cbulk::DecodeResult::TOO_SHORT) i2cStatistics.rxCrcError++;
+    else i2cStatistics.rxInvalid++;
+    xSemaphoreGive(mI2cStatisticsMutex);
+
+    if(result!=i2cbulk::DecodeResult::OK) continue;
+
+    // Die BmsData haben noch keine Plätze für die Slave-BMS (BMSDATA_NUMBER_ALLDEVICES ohne SERIAL_BMS_EXT_COUNT)
+    if(u8_lBmsNrNew>=BMSDATA_NUMBER_ALLDEVICES) continue;
+
+    if((header.flags&i2cbulk::FLAG_DATA_VALID)==i2cbulk::FLAG_DATA_VALID) bmsSnapshot.lastDataMillis=millis();
+    else bmsSnapshot.lastDataMillis=getBmsLastDataMillis(u8_lBmsNrNew);
+    setBmsDataSnapshot(u8_lBmsNrNew, bmsSnapshot);
   }
 }
 
@@ -327,6 +353,31 @@ void getBscSlaveData(uint8_t u8_slaveNr)
  ******************************************************/
 void i2cSendDataToMaster()
 {
+  xSemaphoreTake(mI2cStatisticsMutex, portMAX_DELAY);
+  i2cStatistics.slaveRequests++;
+  xSemaphoreGive(mI2cStatisticsMutex);
+
+  //Alle Daten eines BMS als Bulk-Frame
+  if(u8_mI2cRxBuf[0]==BSC_GET_SLAVE_DATA && u8_mI2cRxBuf[1]==BMS_BULK_DATA)
+  {
+    u8_mI2cRxBuf[0]=0;
+    uint8_t u8_bmsNr = u8_mI2cRxBuf[2];
+    if(u8_bmsNr>=BMSDATA_NUMBER_ALLDEVICES) return;
+
+    BmsDataSnapshot bmsSnapshot;
+    getBmsDataSnapshot(u8_bmsNr, bmsSnapshot);
+    uint8_t u8_lFlags = ((millis()-bmsSnapshot.lastDataMillis)<5000) ? i2cbulk::FLAG_DATA_VALID : 0;
+    uint8_t txBuf[i2cbulk::BMS_FRAME_LEN];
+    size_t frameLen = i2cbulk::encodeBms(bmsSnapshot, u8_bmsNr, u8_mBulkSequence++, u8_lFlags, txBuf);
+    Wire.write(txBuf, frameLen);
+
+    xSemaphoreTake(mI2cStatisticsMutex, portMAX_DELAY);
+    i2cStatistics.slaveTxFrames++;
+    i2cStatistics.slaveTxBytes+=frameLen;
+    xSemaphoreGive(mI2cStatisticsMutex);
+    return;
+  }
+
   Wire.write(u8_mI2cRxBuf[1]);
   Wire.write(u8_mI2cRxBuf[2]);
 
@@ -395,43 +446,48 @@ void i2cSendDataToMaster()
 /******************************************************
  * Display
  ******************************************************/
+/* Sendet die Daten eines BMS an das Display.
+ * Mit ID_PARAM_DISPLAY_BULK_DATA in einem Bulk-Frame, sonst (ältere Display-Firmware) jeden Wert einzeln.
+ * u8_bmsNr: Nr. in den BmsData; u8_dispBmsNr: Nr. beim Display */
+static void displaySendBms(uint8_t u8_bmsNr, uint8_t u8_dispBmsNr, bool bo_bulkData)
+{
+  if(bo_bulkData)
+  {
+    i2cSendBmsBulkData(I2C_DEV_ADDR_DISPLAY, u8_bmsNr, u8_dispBmsNr);
+    return;
+  }
+
+  uint8_t n=u8_bmsNr;
+  uint8_t i=u8_dispBmsNr;
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_CELL_VOLTAGE, i, &p_lBmsData->bmsCellVoltage[n], 48);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_TOTAL_VOLTAGE, i, &p_lBmsData->bmsTotalVoltage[n], 2);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MAX_CELL_DIFFERENCE_VOLTAGE, i, &p_lBmsData->bmsMaxCellDifferenceVoltage[n], 2);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_AVG_VOLTAGE, i, &p_lBmsData->bmsAvgVoltage[n], 2);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_TOTAL_CURRENT, i, &p_lBmsData->bmsTotalCurrent[n], 2);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MAX_CELL_VOLTAGE, i, &p_lBmsData->bmsMaxCellVoltage[n], 2);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MIN_CELL_VOLTAGE, i, &p_lBmsData->bmsMinCellVoltage[n], 2);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MAX_VOLTAGE_CELL_NUMBER, i, &p_lBmsData->bmsMaxVoltageCellNumber[n], 1);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MIN_VOLTAGE_CELL_NUMBER, i, &p_lBmsData->bmsMinVoltageCellNumber[n], 1);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_IS_BALANCING_ACTIVE, i, &p_lBmsData->bmsIsBalancingActive[n], 1);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_BALANCING_CURRENT, i, &p_lBmsData->bmsBalancingCurrent[n], 2);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_TEMPERATURE, i, &p_lBmsData->bmsTempature[n], 6);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_CHARGE_PERCENT, i, &p_lBmsData->bmsChargePercentage[n], 1);
+  i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_ERRORS, i, &p_lBmsData->bmsErrors[n], 4);
+}
+
+
 void displaySendData_bms()
 {
+  bool bo_lBulkData = SettingsViewRef()->displayBulkData;
   for(uint8_t i=0;i<BT_DEVICES_COUNT-2;i++) //ToDo: Erweitern auf 7 Devices. Dazu muss aber auch das Display angepasst werden
   {
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_CELL_VOLTAGE, i, &p_lBmsData->bmsCellVoltage[i], 48);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_TOTAL_VOLTAGE, i, &p_lBmsData->bmsTotalVoltage[i], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MAX_CELL_DIFFERENCE_VOLTAGE, i, &p_lBmsData->bmsMaxCellDifferenceVoltage[i], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_AVG_VOLTAGE, i, &p_lBmsData->bmsAvgVoltage[i], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_TOTAL_CURRENT, i, &p_lBmsData->bmsTotalCurrent[i], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MAX_CELL_VOLTAGE, i, &p_lBmsData->bmsMaxCellVoltage[i], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MIN_CELL_VOLTAGE, i, &p_lBmsData->bmsMinCellVoltage[i], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MAX_VOLTAGE_CELL_NUMBER, i, &p_lBmsData->bmsMaxVoltageCellNumber[i], 1);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MIN_VOLTAGE_CELL_NUMBER, i, &p_lBmsData->bmsMinVoltageCellNumber[i], 1);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_IS_BALANCING_ACTIVE, i, &p_lBmsData->bmsIsBalancingActive[i], 1);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_BALANCING_CURRENT, i, &p_lBmsData->bmsBalancingCurrent[i], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_TEMPERATURE, i, &p_lBmsData->bmsTempature[i], 6);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_CHARGE_PERCENT, i, &p_lBmsData->bmsChargePercentage[i], 1);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_ERRORS, i, &p_lBmsData->bmsErrors[i], 4);
+    displaySendBms(i, i, bo_lBulkData);
   }
 
   uint i=5;
   for(uint8_t n=BT_DEVICES_COUNT;n<(BT_DEVICES_COUNT+3);n++)
   {
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_CELL_VOLTAGE, i, &p_lBmsData->bmsCellVoltage[n], 48);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_TOTAL_VOLTAGE, i, &p_lBmsData->bmsTotalVoltage[n], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MAX_CELL_DIFFERENCE_VOLTAGE, i, &p_lBmsData->bmsMaxCellDifferenceVoltage[n], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_AVG_VOLTAGE, i, &p_lBmsData->bmsAvgVoltage[n], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_TOTAL_CURRENT, i, &p_lBmsData->bmsTotalCurrent[n], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MAX_CELL_VOLTAGE, i, &p_lBmsData->bmsMaxCellVoltage[n], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MIN_CELL_VOLTAGE, i, &p_lBmsData->bmsMinCellVoltage[n], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MAX_VOLTAGE_CELL_NUMBER, i, &p_lBmsData->bmsMaxVoltageCellNumber[n], 1);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_MIN_VOLTAGE_CELL_NUMBER, i, &p_lBmsData->bmsMinVoltageCellNumber[n], 1);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_IS_BALANCING_ACTIVE, i, &p_lBmsData->bmsIsBalancingActive[n], 1);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_BALANCING_CURRENT, i, &p_lBmsData->bmsBalancingCurrent[n], 2);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_TEMPERATURE, i, &p_lBmsData->bmsTempature[n], 6);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_CHARGE_PERCENT, i, &p_lBmsData->bmsChargePercentage[n], 1);
-    i2cSendData(I2C_DEV_ADDR_DISPLAY, BMS_DATA, BMS_ERRORS, i, &p_lBmsData->bmsErrors[n], 4);
+    displaySendBms(n, i, bo_lBulkData);
     i++;
   }
 
@@ -26,7 +26,6 @@ static SemaphoreHandle_t deleteLogMutex = NULL;
 static SemaphoreHandle_t fsMutex = NULL;
 
 static File spiffsTriggerLogFile;
-static File spiffsValueLogFile;
 
 #ifdef DEBUG_ON_FS
 static File spiffsLogFile;
@@ -35,9 +34,6 @@ int vprintf_into_spiffs(const char* szFormat, va_list args);
 #endif
 
 
-#define VALUE_LOG_DATASET_SIZE 30
-
-
 //fsMutex
 void fsLock()
 {
@@ -84,19 +80,6 @@ void debugInit()
     else spiffsTriggerLogFile=SPIFFS.open("/trigger.txt", FILE_WRITE);
   }
 
-  if(SPIFFS.begin())
-  {
-    if(SPIFFS.exists("/values"))
-    {
-      spiffsValueLogFile=SPIFFS.open("/values", "r+");
-    }
-    else
-    {
-      spiffsValueLogFile=SPIFFS.open("/values", FILE_WRITE);
-      for(uint32_t i=0;i<(1440*VALUE_LOG_DATASET_SIZE);i++) spiffsValueLogFile.write(0x0);
-    }
-  }
-
   #ifdef DEBUG_ON_FS
   if (SPIFFS.begin())
   {
@@ -304,61 +287,3 @@ void logTrigger(uint8_t triggerNr, uint8_t cause, bool trigger)
   spiffsTriggerLogFile.flush();
   fsUnlock();
 }
-
-
-uint8_t u8_lGetMinutesOld;
-void logValues()
-{
-  uint8_t u8_lGetMinutes = getMinutes();
-  if(u8_lGetMinutes==u8_lGetMinutesOld) return;
-  u8_lGetMinutesOld=u8_lGetMinutes;
-
-  if(WebSettings::getInt(ID_PARAM_SYSTEM_RECORD_VALUES_PERIODE,0,DT_ID_PARAM_SYSTEM_RECORD_VALUES_PERIODE)==0) return;
-
-  uint32_t timeMinutes = getDayMinutes();
-  //BSC_LOGI(TAG,"logValues: New Entry, time=%i, u8_lGetMinutes=%i, getMinutesOld=%i",timeMinutes, u8_lGetMinutes, u8_lGetMinutesOld);
-
-  if(timeMinutes==0)
-  {
-    spiffsValueLogFile.close();
-    SPIFFS.remove("/values1");
-    SPIFFS.rename("/values","/values1");
-    spiffsValueLogFile = SPIFFS.open("/values", FILE_WRITE);
-    for(uint32_t i=0;i<(1440*VALUE_LOG_DATASET_SIZE);i++) spiffsValueLogFile.write(0x0);
-  }
-
-
-  inverterDataSemaphoreTake();
-  inverterData_s *inverterData = getInverterData();
-  int16_t inverterCurrent = inverterData->inverterCurrent;
-  int16_t inverterVoltage = inverterData->inverterVoltage;
-  uint16_t inverterSoc = inverterData->inverterSoc;
-  int16_t inverterChargeCurrent = inverterData->inverterChargeCurrent;
-  int16_t inverterDischargeCurrent = inverterData->inverterDischargeCurrent;
-
-  int16_t calcChargeCurrentCellVoltage = inverterData->calcChargeCurrentCellVoltage;
-  int16_t calcChargeCurrentSoc = inverterData->calcChargeCurrentSoc;
-  int16_t calcChargeCurrentCelldrift = inverterData->calcChargeCurrentCelldrift;
-  int16_t calcChargeCurrentCutOff = inverterData->calcChargeCurrentCutOff;
-  inverterDataSemaphoreGive();
-
-  /*bmsDataSemaphoreTake();
-  bmsData_s *bmsData = getBmsData();
-  uint16_t bmsMinCellVoltage = bmsData->bmsMaxCellVoltage;
-  uint16_t bmsMinCellVoltage = bmsData->bmsMinCellVoltage;
-  bmsDataSemaphoreGive();*/
-
-  fsLock();
-  spiffsValueLogFile.seek(timeMinutes*VALUE_LOG_DATASET_SIZE,SeekSet);
-  spiffsValueLogFile.write((uint8_t*)&inverterCurrent,2);
-  spiffsValueLogFile.write((uint8_t*)&inverterVoltage,2);
-  spiffsValueLogFile.write((uint8_t*)&inverterSoc,2);
-  spiffsValueLogFile.write((uint8_t*)&inverterChargeCurrent,2);
-  spiffsValueLogFile.write((uint8_t*)&inverterDischargeCurrent,2);
-  spiffsValueLogFile.write((uint8_t*)&calcChargeCurrentCellVoltage,2);
-  spiffsValueLogFile.write((uint8_t*)&calcChargeCurrentSoc,2);
-  spiffsValueLogFile.write((uint8_t*)&calcChargeCurrentCelldrift,2);
-  spiffsValueLogFile.write((uint8_t*)&calcChargeCurrentCutOff,2);
-  spiffsValueLogFile.flush();
-  fsUnlock();
-}
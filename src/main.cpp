@@ -40,19 +40,25 @@
 #include "WebSettings.h"
 #include "BleHandler.h"
 #include "params.h"
-#include "webpages.h"
+#include "params_idx.h"
+#include "webpages_gz.h"
 #include "AlarmRules.h"
 #include "dio.h"
 #include "Ow.h"
 #include "Canbus.h"
 #include "BscSerial.h"
 #include "BmsData.h"
+#include "SettingsView.h"
 #include "mqtt_t.h"
 #include "log.h"
+#include "ValueLog.h"
 #include "i2c.h"
 #include "webUtility.h"
 #include "bscTime.h"
 #include "restapi.h"
+#include "TaskTelemetry.h"
+#include "HeapStats.h"
+#include <utils/TextBuffer.hpp>
 #include "devices/NeeyBalancer.h"
 #ifdef BPN
 #include "devices/bpnWebHandler.h"
@@ -92,7 +98,8 @@ TaskHandle_t task_handle_ble = NULL;
 TaskHandle_t task_handle_alarmrules = NULL;
 TaskHandle_t task_handle_onewire = NULL;
 TaskHandle_t task_handle_canbusTx = NULL;
-TaskHandle_t task_handle_bscSerial = NULL;
+TaskHandle_t task_handle_canbusRx = NULL;
+TaskHandle_t task_handle_bscSerial[SERIAL_PORT_GROUP_COUNT] = {NULL};
 TaskHandle_t task_handle_i2c = NULL;
 TaskHandle_t task_handle_wifiConn = NULL;
 
@@ -110,7 +117,7 @@ uint32_t lastTaskRun_ble = 0;
 uint32_t lastTaskRun_alarmrules = 0;
 uint32_t lastTaskRun_onewire = 0;
 uint32_t lastTaskRuncanbusTx = 0;
-uint32_t lastTaskRun_bscSerial = 0;
+uint32_t lastTaskRun_bscSerial[SERIAL_PORT_GROUP_COUNT] = {0};
 uint32_t lastTaskRun_i2c = 0;
 uint32_t lastTaskRun_wifiConn = 0;
 
@@ -483,9 +490,11 @@ void task_ConnectWiFi(void *param)
 
   BSC_LOGD(TAG, "-> 'task_ConnectWiFi' runs on core %d", xPortGetCoreID());
   BSC_LOGD(TAG, "mConnectState=%i", mConnectStateEnums);
+  taskTelemetryRegister(TASK_ID_WIFICONN);
 
   for(;;)
   {
+    taskTelemetryBegin(TASK_ID_WIFICONN);
     switch(mConnectStateEnums)
     {
       case ConnState_wifiDisconnected:
@@ -662,6 +671,8 @@ void task_ConnectWiFi(void *param)
       }
     }
 
+    taskTelemetryEnd(TASK_ID_WIFICONN);
+
     //Wenn nicht im Idle, dann 1000ms warten
     if(mConnectStateEnums!=ConnState_idle) vTaskDelay(pdMS_TO_TICKS(1000));
   }
@@ -670,6 +681,7 @@ void task_ConnectWiFi(void *param)
 void task_ble(void *param)
 {
   BSC_LOGD(TAG, "-> 'task_ble' runs on core %d", xPortGetCoreID());
+  taskTelemetryRegister(TASK_ID_BLE);
 
   //init Bluetooth
   BSC_LOGI(TAG, "Init BLE...");
@@ -688,7 +700,9 @@ void task_ble(void *param)
   {
     vTaskDelay(pdMS_TO_TICKS(1000));
 
+    taskTelemetryBegin(TASK_ID_BLE);
     if(WlanStaApOk!=WIFI_OFF) bleHandler.run();
+    taskTelemetryEnd(TASK_ID_BLE);
 
     xSemaphoreTake(mutexTaskRunTime_ble, portMAX_DELAY);
     lastTaskRun_ble=millis();
@@ -699,6 +713,7 @@ void task_ble(void *param)
 void task_alarmRules(void *param)
 {
   BSC_LOGD(TAG, "-> 'task_alarmRules' runs on core %d", xPortGetCoreID());
+  taskTelemetryRegister(TASK_ID_ALARMRULES);
 
   vTaskDelay(pdMS_TO_TICKS(15000));
   initAlarmRules();
@@ -706,7 +721,9 @@ void task_alarmRules(void *param)
   for (;;)
   {
     vTaskDelay(pdMS_TO_TICKS(1000));
+    taskTelemetryBegin(TASK_ID_ALARMRULES);
     runAlarmRules();
+    taskTelemetryEnd(TASK_ID_ALARMRULES);
     xSemaphoreTake(mutexTaskRunTime_alarmrules, portMAX_DELAY);
     lastTaskRun_alarmrules=millis();
     xSemaphoreGive(mutexTaskRunTime_alarmrules);
@@ -716,14 +733,17 @@ void task_alarmRules(void *param)
 void task_onewire(void *param)
 {
   BSC_LOGD(TAG, "-> 'task_onewire' runs on core %d", xPortGetCoreID());
+  taskTelemetryRegister(TASK_ID_ONEWIRE);
 
   //init Onewire
   owSetup();
 
   for (;;)
   {
-    vTaskDelay(pdMS_TO_TICKS(1200));
+    vTaskDelay(pdMS_TO_TICKS(OW_CYCLE_TIME));
+    taskTelemetryBegin(TASK_ID_ONEWIRE);
     owCyclicRun();
+    taskTelemetryEnd(TASK_ID_ONEWIRE);
     xSemaphoreTake(mutexTaskRunTime_ow, portMAX_DELAY);
     lastTaskRun_onewire=millis();
     xSemaphoreGive(mutexTaskRunTime_ow);
@@ -733,13 +753,16 @@ void task_onewire(void *param)
 void task_canbusTx(void *param)
 {
   BSC_LOGD(TAG, "-> 'task_canbusTx' runs on core %d", xPortGetCoreID());
+  taskTelemetryRegister(TASK_ID_CANBUS_TX);
 
   canSetup();
 
   for (;;)
   {
     vTaskDelay(pdMS_TO_TICKS(1000));
+    taskTelemetryBegin(TASK_ID_CANBUS_TX);
     canTxCyclicRun();
+    taskTelemetryEnd(TASK_ID_CANBUS_TX);
     if(xSemaphoreTake(mutexTaskRunTime_can, 100))
     {
       lastTaskRuncanbusTx=millis();
@@ -748,19 +771,35 @@ void task_canbusTx(void *param)
   }
 }
 
-void task_bscSerial(void *param)
+void task_canbusRx(void *param)
 {
-  BSC_LOGD(TAG, "-> 'task_bscSerial' runs on core %d", xPortGetCoreID());
+  BSC_LOGD(TAG, "-> 'task_canbusRx' runs on core %d", xPortGetCoreID());
+  taskTelemetryRegister(TASK_ID_CANBUS_RX);
 
-  //init Serial
-  bscSerial.initSerial();
+  for (;;)
+  {
+    canRxCyclicRun(); //Wartet blockierend auf empfangene Frames
+  }
+}
+
+//Je Gruppe von seriellen Schnittstellen läuft ein eigener Task (param = Gruppe)
+void task_bscSerial(void *param)
+{
+  uint8_t u8_lPortGroup = (uint8_t)(uintptr_t)param;
+  BSC_LOGD(TAG, "-> 'task_bscSerial' group %d runs on core %d", u8_lPortGroup, xPortGetCoreID());
+  taskTelemetryRegister(TASK_ID_SERIAL+u8_lPortGroup);
 
+  uint32_t u32_lDelayMs=1000;
   for (;;)
   {
-    vTaskDelay(pdMS_TO_TICKS(1000));
-    bscSerial.cyclicRun();
+    //Warten bis das nächste Gerät der Gruppe fällig ist (max. 1s, damit die Task-Überwachung nicht auslöst)
+    vTaskDelay(pdMS_TO_TICKS(u32_lDelayMs));
+    taskTelemetryBegin(TASK_ID_SERIAL+u8_lPortGroup);
+    u32_lDelayMs=bscSerial.cyclicRun(u8_lPortGroup);
+    taskTelemetryEnd(TASK_ID_SERIAL+u8_lPortGroup);
+    u32_lDelayMs=constrain(u32_lDelayMs,(uint32_t)20,(uint32_t)1000);
     xSemaphoreTake(mutexTaskRunTime_serial, portMAX_DELAY);
-    lastTaskRun_bscSerial=millis();
+    lastTaskRun_bscSerial[u8_lPortGroup]=millis();
     xSemaphoreGive(mutexTaskRunTime_serial);
   }
 }
@@ -768,12 +807,14 @@ void task_bscSerial(void *param)
 void task_i2c(void *param)
 {
   BSC_LOGD(TAG, "-> 'task_i2c' runs on core %d", xPortGetCoreID());
+  taskTelemetryRegister(TASK_ID_I2C);
 
   i2cInit();
 
   for (;;)
   {
     vTaskDelay(pdMS_TO_TICKS(2000));
+    taskTelemetryBegin(TASK_ID_I2C);
     i2cCyclicRun(); //Sende Daten zum Display
 
     if(changeWlanDataForI2C)
@@ -784,6 +825,7 @@ void task_i2c(void *param)
       else ipAddr = WiFi.localIP().toString();
       i2cSendData(I2C_DEV_ADDR_DISPLAY, BSC_DATA, BSC_IP_ADDR, 0, ipAddr, 16);
     }
+    taskTelemetryEnd(TASK_ID_I2C);
 
     xSemaphoreTake(mutexTaskRunTime_i2c, portMAX_DELAY);
     lastTaskRun_i2c=millis();
@@ -835,15 +877,15 @@ void task_fsTest3(void *param)
 /*
   Handle WebPages
 */
-void handlePage_root(){server.send(200, "text/html", htmlPageRoot);}
-void handlePage_settings(){server.send(200, "text/html", htmlPageSettings);}
-void handlePage_alarm(){server.send(200, "text/html", htmlPageAlarm);}
-void handlePage_schnittstellen(){server.send(200, "text/html", htmlPageSchnittstellen);}
-void handle_htmlPageBmsSpg(){server.send(200, "text/html", htmlPageBmsSpg);}
-void handlePage_status(){server.send(200, "text/html", htmlPageStatus);}
-void handlePage_htmlPageMenuLivedata(){server.send(200, "text/html", htmlPageMenuLivedata);}
-void handlePage_htmlPageOwTempLive(){server.send(200, "text/html", htmlPageOwTempLive);}
-void handlePage_htmlPageBscDataLive(){server.send(200, "text/html", htmlPageBscDataLive);}
+void handlePage_root(){sendWebAsset(server, htmlPageRootAsset);}
+void handlePage_settings(){sendWebAsset(server, htmlPageSettingsAsset);}
+void handlePage_alarm(){sendWebAsset(server, htmlPageAlarmAsset);}
+void handlePage_schnittstellen(){sendWebAsset(server, htmlPageSchnittstellenAsset);}
+void handle_htmlPageBmsSpg(){sendWebAsset(server, htmlPageBmsSpgAsset);}
+void handlePage_status(){sendWebAsset(server, htmlPageStatusAsset);}
+void handlePage_htmlPageMenuLivedata(){sendWebAsset(server, htmlPageMenuLivedataAsset);}
+void handlePage_htmlPageOwTempLive(){sendWebAsset(server, htmlPageOwTempLiveAsset);}
+void handlePage_htmlPageBscDataLive(){sendWebAsset(server, htmlPageBscDataLiveAsset);}
 
 /*#ifdef BPN
 void handlePage_htmlPageBpnSettings()
@@ -971,100 +1013,143 @@ void handle_getData()
   server.send(200, "text/html", "Testdata");
 }
 
+/* Scratch-Buffer für die Antworten der Live-Daten. Die Handler werden nur aus loop() (server.handleClient())
+ * aufgerufen, daher reicht ein statischer Buffer; die Antworten benötigen keinen Heap. */
+static utils::TextBuffer<WEB_SCRATCH_BUFFER_SIZE> webScratch;
+
+static void sendWebScratch()
+{
+  if(webScratch.overflow())
+  {
+    BSC_LOGE(TAG,"Web scratch buffer overflow: uri=%s",server.uri().c_str());
+    server.send(500, "text/plain", "Overflow");
+    return;
+  }
+  server.send_P(200, "text/html", webScratch.data(), webScratch.length());
+}
+
 void handle_getDashboardData()
 {
+  heapStatsRequestBegin();
+  webScratch.reset();
+
   //1. Free Heap
-  String tmp = String(xPortGetFreeHeapSize());
-  tmp += " / ";
-  tmp += String(xPortGetMinimumEverFreeHeapSize());
+  webScratch.appendf("%u / %u", (unsigned int)xPortGetFreeHeapSize(), (unsigned int)xPortGetMinimumEverFreeHeapSize());
 
   //2. Alarme
-  tmp += "|";
+  webScratch.append("|");
   for(uint8_t i=0;i<CNT_ALARMS;i++)
   {
-    tmp += getAlarm(i);
-    if(i<CNT_ALARMS) tmp += "&nbsp;";
-    if(i==4) tmp += "|";
+    webScratch.append(getAlarm(i)?"1&nbsp;":"0&nbsp;");
+    if(i==4) webScratch.append("|");
   }
 
   //3. mqtt state
-  tmp += "|";
-  tmp += mqttConnected();
+  webScratch.append(mqttConnected()?"|1":"|0");
 
   //4. Task status
-  tmp += "|";
-  tmp += String(u8_mTaskRunSate);
+  webScratch.appendf("|%u", u8_mTaskRunSate);
 
   //5. + 6. BT-Devices
-  tmp += "|";
+  webScratch.append("|");
   for(uint8_t i=0;i<BT_DEVICES_COUNT;i++)
   {
     uint8_t u8_lBtDevConnState=bleHandler.bmsIsConnect(i);
-    if(u8_lBtDevConnState==0) tmp += "&ndash;";
-    else if(u8_lBtDevConnState==1) tmp += "n";
-    else if(u8_lBtDevConnState==2) tmp += "c";
+    if(u8_lBtDevConnState==0) webScratch.append("&ndash;");
+    else if(u8_lBtDevConnState==1) webScratch.append("n");
+    else if(u8_lBtDevConnState==2) webScratch.append("c");
 
-    if(i<BT_DEVICES_COUNT) tmp += "&nbsp;";
-    if(i==4) tmp += "|";
+    webScratch.append("&nbsp;");
+    if(i==4) webScratch.append("|");
   }
 
   //7. WLAN RSSI
-  tmp += "|";
-  tmp += String(WiFi.RSSI()+100); //0...100 => bad...good
+  webScratch.appendf("|%i", WiFi.RSSI()+100); //0...100 => bad...good
 
   //8. Boot Time
-  tmp += "|";
-  tmp += str_BootTimeStamp.c_str();
+  webScratch.append("|");
+  webScratch.append(str_BootTimeStamp.c_str());
 
   //9-11. BMS data (serial 0-2)
   for(uint8_t i=0;i<3;i++)
   {
-    tmp += "|";
     if(millis()-getBmsLastDataMillis(BT_DEVICES_COUNT+i)<5000)
     {
       float fl_lBmsTotalVolage = getBmsTotalVoltage(BT_DEVICES_COUNT+i);
       float fl_lBmsTotalCurrent = getBmsTotalCurrent(BT_DEVICES_COUNT+i);
       uint8_t u8_lBmsSoc = getBmsChargePercentage(BT_DEVICES_COUNT+i);
-      tmp += String(fl_lBmsTotalVolage) + ";" + String(fl_lBmsTotalCurrent) + ";" + String(u8_lBmsSoc);
+      webScratch.appendf("|%.2f;%.2f;%u", fl_lBmsTotalVolage, fl_lBmsTotalCurrent, u8_lBmsSoc);
     }
     else
     {
-      tmp += "--;--;--";
+      webScratch.append("|--;--;--");
     }
   }
 
   //12. Hostname
-  tmp += "|";
-  tmp += WebSettings::getString(ID_PARAM_MQTT_DEVICE_NAME,0);
+  webScratch.append("|");
+  webScratch.append(WebSettings::getString(ID_PARAM_MQTT_DEVICE_NAME,0).c_str());
 
-  server.send(200, "text/html", tmp.c_str());
+  sendWebScratch();
+  heapStatsRequestEnd(webScratch.length(), webScratch.overflow());
 }
 
+/* Zellspannungen eines BMS: <Balken in %>;<Spannung in mV>; je Zelle
+ * Das BMS wird mit ?bms=<nr> gewählt (0...BMSDATA_NUMBER_ALLDEVICES-1); ohne Angabe das erste BMS mit aktuellen Daten.
+ * Nicht vorhandene Zellen am Ende (0 oder 0xFFFF) werden nicht gesendet. */
 void handle_getBmsSpgData()
 {
-  String sendData = "";
-  float onePer = (4-0.5)/100;
-  for(uint8_t i=0;i<16;i++)
+  heapStatsRequestBegin();
+  webScratch.reset();
+
+  uint8_t u8_lBmsNr=0;
+  if(server.hasArg("bms"))
+  {
+    long l_lBmsNr = server.arg("bms").toInt();
+    if(l_lBmsNr>=0 && l_lBmsNr<BMSDATA_NUMBER_ALLDEVICES) u8_lBmsNr=(uint8_t)l_lBmsNr;
+  }
+  else
+  {
+    for(uint8_t i=0;i<BMSDATA_NUMBER_ALLDEVICES;i++)
+    {
+      if(millis()-getBmsLastDataMillis(i)<5000)
+      {
+        u8_lBmsNr=i;
+        break;
+      }
+    }
+  }
+
+  BmsDataSnapshot bmsSnapshot;
+  getBmsDataSnapshot(u8_lBmsNr, bmsSnapshot);
+
+  uint8_t u8_lCellCnt=BMSDATA_MAX_CELLS;
+  while(u8_lCellCnt>0 && (bmsSnapshot.cellVoltage[u8_lCellCnt-1]==0 || bmsSnapshot.cellVoltage[u8_lCellCnt-1]==0xFFFF)) u8_lCellCnt--;
+
+  for(uint8_t i=0;i<u8_lCellCnt;i++)
   {
-    int8_t spg = (getBmsCellVoltage(1,i)-0.5)/onePer;
-    if(spg<0){spg=0;}
-    sendData += String(spg);
-    sendData += ";";
-    sendData += String(getBmsCellVoltage(1,i));
-    sendData += ";";
+    // Skala der Seite: 2,5 V ... 4,0 V
+    uint16_t u16_lCellVoltage = bmsSnapshot.cellVoltage[i];
+    int32_t i32_lPercent = ((int32_t)u16_lCellVoltage-2500)/15;
+    if(i32_lPercent<0) i32_lPercent=0;
+    else if(i32_lPercent>100) i32_lPercent=100;
+    webScratch.appendf("%i;%u;", (int)i32_lPercent, u16_lCellVoltage);
   }
-  server.send(200, "text/html", sendData.c_str());
+
+  sendWebScratch();
+  heapStatsRequestEnd(webScratch.length(), webScratch.overflow());
 }
 
 void handle_getOwTempData()
 {
-  String sendData = "";
+  heapStatsRequestBegin();
+  webScratch.reset();
   for(uint8_t i=0;i<MAX_ANZAHL_OW_SENSOREN;i++)
   {
-    sendData += String(owGetTemp(i));
-    sendData += ";";
+    webScratch.appendf("%.2f;", owGetTemp(i));
   }
-  server.send(200, "text/html", sendData.c_str());
+  sendWebScratch();
+  heapStatsRequestEnd(webScratch.length(), webScratch.overflow());
 }
 
 void handle_getBscLiveData()
@@ -1150,7 +1235,14 @@ uint8_t checkTaskRun()
 
   if(xSemaphoreTake( mutexTaskRunTime_serial,(TickType_t)10)==pdTRUE)
   {
-    if(millis()-lastTaskRun_bscSerial>3000) ret+=16;
+    for(uint8_t i=0;i<SERIAL_PORT_GROUP_COUNT;i++)
+    {
+      if(millis()-lastTaskRun_bscSerial[i]>3000)
+      {
+        ret+=16;
+        break;
+      }
+    }
     xSemaphoreGive(mutexTaskRunTime_serial);
   }
 
@@ -1196,6 +1288,8 @@ void setup()
   mutexTaskRunTime_serial = xSemaphoreCreateMutex();
   mutexTaskRunTime_i2c = xSemaphoreCreateMutex();
   mutexTaskRunTime_wifiConn = xSemaphoreCreateMutex();
+  taskTelemetryInit();
+  taskTelemetryRegister(TASK_ID_LOOP);
 
   if(bootCounter!=0xFF) bootCounter++;
   isBoot = true;
@@ -1213,24 +1307,29 @@ void setup()
   BSC_LOGI(TAG, "HW: %i", getHwVersion());
 
   bmsDataInit();
+  valueLogInit();
 
   //init WebSettings
   free_dump();
-  webSettingsSystem.initWebSettings(paramSystem, "System", "/WebSettings.conf");
-  webSettingsBluetooth.initWebSettings(paramBluetooth, "Bluetooth", "/WebSettings.conf");
+  webSettingsSystem.initWebSettings(paramSystem, paramSystemIdx, "System", "/WebSettings.conf");
+  webSettingsBluetooth.initWebSettings(paramBluetooth, paramBluetoothIdx, "Bluetooth", "/WebSettings.conf");
   webSettingsBluetooth.setTimerHandlerName("getBtDevices");
-  webSettingsSerial.initWebSettings(paramSerial, "Serial", "/WebSettings.conf");
-  webSettingsAlarmBt.initWebSettings(paramAlarmBms, "Alarm BMS (BT + Serial)", "/WebSettings.conf");
-  webSettingsAlarmTemp.initWebSettings(paramAlarmTemp, "Alarm Temperatur", "/WebSettings.conf");
-  webSettingsDitialOut.initWebSettings(paramDigitalOut, "Digitalausg&auml;nge", "/WebSettings.conf");
-  webSettingsDitialIn.initWebSettings(paramDigitalIn, "Digitaleing&auml;nge", "/WebSettings.conf");
-  webSettingsOnewire.initWebSettings(paramOnewireAdr, "Onewire", "/WebSettings.conf");
+  webSettingsSerial.initWebSettings(paramSerial, paramSerialIdx, "Serial", "/WebSettings.conf");
+  webSettingsAlarmBt.initWebSettings(paramAlarmBms, paramAlarmBmsIdx, "Alarm BMS (BT + Serial)", "/WebSettings.conf");
+  webSettingsAlarmTemp.initWebSettings(paramAlarmTemp, paramAlarmTempIdx, "Alarm Temperatur", "/WebSettings.conf");
+  webSettingsDitialOut.initWebSettings(paramDigitalOut, paramDigitalOutIdx, "Digitalausg&auml;nge", "/WebSettings.conf");
+  webSettingsDitialIn.initWebSettings(paramDigitalIn, paramDigitalInIdx, "Digitaleing&auml;nge", "/WebSettings.conf");
+  webSettingsOnewire.initWebSettings(paramOnewireAdr, paramOnewireAdrIdx, "Onewire", "/WebSettings.conf");
   webSettingsOnewire.setTimerHandlerName("getOwDevices",2000);
-  webSettingsOnewire2.initWebSettings(paramOnewire2, "Onewire II", "/WebSettings.conf");
-  webSettingsBmsToInverter.initWebSettings(paramBmsToInverter, "Wechselrichter & Laderegelung", "/WebSettings.conf");
-  webSettingsDeviceNeeyBalancer.initWebSettings(paramDeviceNeeyBalancer, "NEEY Balancer", "/WebSettings.conf");
+  webSettingsOnewire2.initWebSettings(paramOnewire2, paramOnewire2Idx, "Onewire II", "/WebSettings.conf");
+  webSettingsBmsToInverter.initWebSettings(paramBmsToInverter, paramBmsToInverterIdx, "Wechselrichter & Laderegelung", "/WebSettings.conf");
+  webSettingsDeviceNeeyBalancer.initWebSettings(paramDeviceNeeyBalancer, paramDeviceNeeyBalancerIdx, "NEEY Balancer", "/WebSettings.conf");
   webSettingsDeviceNeeyBalancer.setTimerHandlerName("getNeeySettingsReadback",2000);
-  webSettingsDeviceJbdBms.initWebSettings(paramDeviceJbdBms, "JBD BMS", "/WebSettings.conf");
+  webSettingsDeviceJbdBms.initWebSettings(paramDeviceJbdBms, paramDeviceJbdBmsIdx, "JBD BMS", "/WebSettings.conf");
+
+  //Vorkompilierte Parameter für die zyklischen Tasks
+  settingsViewRebuild();
+  WebSettings::registerOnParameterChanged(&settingsViewRebuild);
 
   //Buttons
   webSettingsSystem.setButtons(BUTTON_1,"Delete Log");
@@ -1264,6 +1363,7 @@ void setup()
   }
 
   //ini WebPages
+  webUtilityCollectHeaders(server);
   #ifdef INSIDER_V1
   //if(webSettingsSystem.getBoolFlash(ID_PARAM_I_AM_A_SUPPORTER,0)==true)
   //{
@@ -1287,20 +1387,20 @@ void setup()
   else
   {
     server.on("/",handlePage_root);
-    server.on("/support/", HTTP_GET, []() {server.send(200, "text/html", htmlPageSupport);});
+    server.on("/support/", HTTP_GET, []() {sendWebAsset(server, htmlPageSupportAsset);});
   }*/
   #else
   server.on("/",handlePage_root);
-  server.on("/support/", HTTP_GET, []() {server.send(200, "text/html", htmlPageSupport);});
+  server.on("/support/", HTTP_GET, []() {sendWebAsset(server, htmlPageSupportAsset);});
   #endif
-  server.on("/favicon.svg", HTTP_GET, []() {server.send(200, "image/svg+xml", htmlFavicon);});
+  server.on("/favicon.svg", HTTP_GET, []() {sendWebAsset(server, htmlFaviconAsset);});
 
   server.on("/htmlPageStatus/",handlePage_status);
   server.on("/settings/",handlePage_settings);
   server.on("/settings/alarm/",handlePage_alarm);
   server.on("/settings/schnittstellen/",handlePage_schnittstellen);
   server.on("/bmsSpg/",handle_htmlPageBmsSpg);
-  server.on("/settings/devices/", HTTP_GET, []() {server.send(200, "text/html", htmlPageDevices);});
+  server.on("/settings/devices/", HTTP_GET, []() {sendWebAsset(server, htmlPageDevicesAsset);});
   server.on("/restapi", HTTP_GET, []() {buildJsonRest(&server);});
   //server.on("/setParameter", HTTP_POST, []() {handle_setParameter(&server);});
 
@@ -1335,14 +1435,15 @@ void setup()
   #ifdef BPN
   //server.on("/bpn",handlePage_htmlPageBpnSettings);
   //server.on("/getBpnData",[]() {handle_getBpnData(&server);});
-  server.on("/upload", HTTP_GET, []() {server.send(200, "text/html", htmlPageUpload);});
+  server.on("/upload", HTTP_GET, []() {sendWebAsset(server, htmlPageUploadAsset);});
   server.on("/uploadPbnFw", HTTP_POST, sendResponceUpdateBpnFw, [](){handleFileUpload(&server, true, "bpnFw.bin");});
   #endif
 
   server.on("/log", HTTP_GET, []() {if(!handleFileRead(SPIFFS, server, true, "/log.txt")){server.send(404, "text/plain", "FileNotFound");}});
   server.on("/log1", HTTP_GET, []() {if(!handleFileRead(SPIFFS, server, true, "/log1.txt")){server.send(404, "text/plain", "FileNotFound");}});
   server.on("/trigger", HTTP_GET, []() {if(!handleFileRead(SPIFFS, server, true, "/trigger.txt")){server.send(404, "text/plain", "FileNotFound");}});
-  server.on("/valueslog", HTTP_GET, []() {if(!handleFileRead(SPIFFS, server, true, "/values")){server.send(404, "text/plain", "FileNotFound");}});
+  server.on("/valueslog", HTTP_GET, []() {valueLogHandleRequest(&server);});
+  server.on("/valueslog_legacy", HTTP_GET, []() {valueLogHandleLegacyRequest(&server);});
   //server.on("/param", HTTP_GET, []() {if(!handleFileRead(SPIFFS, server, false, "/WebSettings.conf")){server.send(404, "text/plain", "FileNotFound");}});
 
   otaUpdater.init(&server, "/settings/webota/", true);
@@ -1350,6 +1451,7 @@ void setup()
   server.on("/restart/", []() {
     server.sendHeader("Connection", "close");
     server.send(200, "text/html", "<HTML><BODY>Reboot ok<br><a href='../'>Home</a></BODY></HTML>");
+    valueLogFlush();
     sleep(2);
     ESP.restart();
   });
@@ -1363,9 +1465,13 @@ void setup()
 
   //Erstelle Tasks
   xTaskCreatePinnedToCore(task_onewire, "ow", 2500, nullptr, 5, &task_handle_onewire, 1);
-  xTaskCreatePinnedToCore(task_bscSerial, "serial", 2500, nullptr, 5, &task_handle_bscSerial, 1);
+  bscSerial.initSerial();
+  xTaskCreatePinnedToCore(task_bscSerial, "serial0", 2500, (void*)0, 5, &task_handle_bscSerial[0], 1);
+  xTaskCreatePinnedToCore(task_bscSerial, "serial1", 2500, (void*)1, 5, &task_handle_bscSerial[1], 1);
+  xTaskCreatePinnedToCore(task_bscSerial, "serial2", 2500, (void*)2, 5, &task_handle_bscSerial[2], 1);
   xTaskCreatePinnedToCore(task_alarmRules, "alarmrules", 2500, nullptr, configMAX_PRIORITIES - 5, &task_handle_alarmrules, 1);
   xTaskCreatePinnedToCore(task_canbusTx, "can", 2700, nullptr, 5, &task_handle_canbusTx, 1);
+  xTaskCreatePinnedToCore(task_canbusRx, "canRx", 2500, nullptr, 6, &task_handle_canbusRx, 1);
   xTaskCreatePinnedToCore(task_i2c, "i2c", 2500, nullptr, 5, &task_handle_i2c, 1);
   #ifdef UTEST_FS
   xTaskCreatePinnedToCore(task_fsTest1, "fstest1", 2500, nullptr, 5, &task_handle_i2c, 1);
@@ -1394,6 +1500,7 @@ void loop()
 {
   //loopDuration=millis()-loopRunTime;
   //loopRunTime=millis();
+  taskTelemetryBegin(TASK_ID_LOOP);
   #ifdef DEBUG_ON_FS
   writeLogToFS();
   #endif
@@ -1413,7 +1520,7 @@ void loop()
     u8_mTaskRunSate=u8_lTaskRunSate;
   }
 
-  logValues();
+  valueLogCyclicRun();
 
   #ifdef LOG_BMS_DATA
   if(millis()-debugLogTimer>=10000)
@@ -1422,4 +1529,5 @@ void loop()
     logBmsData(10); //0-6 BT; 7-9 serial 0-2; 10-17 serial ext.
   }
   #endif
+  taskTelemetryEnd(TASK_ID_LOOP);
 }
@@ -6,6 +6,7 @@
 #include "mqtt_t.h"
 
 #include <deque>
+#include <stdarg.h>
 #include <PubSubClient.h>
 #include <WiFi.h>
 #include <WiFiClient.h>
@@ -15,12 +16,23 @@
 #include "Ow.h"
 #include "log.h"
 #include "BleHandler.h"
+#include "BscSerial.h"
 #include "AlarmRules.h"
+#include "TaskTelemetry.h"
+#include "MqttPayload.hpp"
 
 
 static const char* TAG = "MQTT";
 
+#define MQTT_TX_BUFFER_SIZE          300   // Max. Anzahl Nachrichten im Sendebuffer
+#define MQTT_VALUE_SIZE              20    // Max. Länge eines Wertes im Sendebuffer (inkl. '\0')
+#define MQTT_TOPIC_PREFIX_SIZE       64    // <Topic Name>/<t1>
+#define MQTT_TOPIC_SIZE              128
+#define MQTT_PAYLOAD_SIZE            1024  // JSON-Dokument im aggregierten Modus
+#define MQTT_AGGREGATED_SEND_DELAY   20    // ms zwischen zwei JSON-Dokumenten
+
 static SemaphoreHandle_t mMqttMutex = NULL;
+static struct mqttStatistics_s mqttStatistics;
 
 WiFiClient   wifiClient;
 PubSubClient mqttClient(wifiClient);
@@ -29,6 +41,15 @@ IPAddress    mqttIpAdr;
 static String str_mMqttDeviceName;
 static String str_mMqttTopicName;
 
+//Vorberechnete Topics "<Topic Name>/<t1>"; werden beim Verbinden aufgebaut
+static char    mTopicPrefix[MQTT_TOPIC_BMS_SERIAL+1][MQTT_TOPIC_PREFIX_SIZE];
+static uint8_t mTopicPrefixLen[MQTT_TOPIC_BMS_SERIAL+1];
+static char    mTopic[MQTT_TOPIC_SIZE];
+
+//Aggregierter Modus: Ein JSON-Dokument pro Gerät und Sendeintervall
+static bool     bo_mMqttAggregated=false;
+static mqttpayload::Payload<MQTT_PAYLOAD_SIZE> mPayload;
+
 uint32_t u32_mMqttPublishLoopTimmer=0;
 
 bool     bo_mMqttEnable=false;
@@ -41,6 +62,12 @@ uint8_t  sendBmsData_mqtt_sendeCounter=0;
 bool     bmsDataSendFinsh=false;
 uint8_t  sendOwTemperatur_mqtt_sendeCounter=0;
 bool     owDataSendFinsh=false;
+uint32_t sendeDelayTimerTask;
+uint8_t  sendTask_mqtt_sendeCounter=0;
+bool     taskDataSendFinsh=false;
+uint32_t sendeDelayTimerComm;
+uint8_t  sendComm_mqtt_sendeCounter=0;
+bool     commDataSendFinsh=false;
 
 //bool     bo_mSendPrioMessages=false;
 
@@ -49,7 +76,8 @@ struct mqttEntry_s {
   int8_t t2;
   int8_t t3;
   int8_t t4;
-  String value;
+  uint32_t u32_queuedMillis;
+  char value[MQTT_VALUE_SIZE];
 };
 std::deque<mqttEntry_s> txBuffer;
 
@@ -61,6 +89,12 @@ bool mqttPublishLoopFromTxBuffer();
 void mqttDataToTxBuffer();
 void mqttPublishBmsData(uint8_t);
 void mqttPublishOwTemperatur(uint8_t);
+void mqttBuildTopicPrefixes();
+bool mqttPublishPayload(const char *topic);
+void mqttPublishBmsDataAggregated(uint8_t);
+void mqttPublishOwTemperaturAggregated();
+void mqttPublishTaskStatistics(uint8_t);
+void mqttPublishCommStatistics(uint8_t);
 //void mqttPublishTrigger();
 void mqttCallback(char* topic, uint8_t* payload, unsigned int length);
 
@@ -68,6 +102,7 @@ void mqttCallback(char* topic, uint8_t* payload, unsigned int length);
 void initMqtt()
 {
   mMqttMutex = xSemaphoreCreateMutex();
+  memset(&mqttStatistics, 0, sizeof(mqttStatistics));
 
   smMqttConnectState=SM_MQTT_DISCONNECTED;
   smMqttConnectStateOld=SM_MQTT_DISCONNECTED;
@@ -76,6 +111,9 @@ void initMqtt()
   bo_mMqttEnable = WebSettings::getBool(ID_PARAM_MQTT_SERVER_ENABLE,0);
   if(!bo_mMqttEnable) return;
 
+  bo_mMqttAggregated = WebSettings::getBool(ID_PARAM_MQTT_AGGREGATED,0);
+  BSC_LOGI(TAG,"MQTT: aggregated=%i", bo_mMqttAggregated);
+
   if(!WebSettings::getString(ID_PARAM_MQTT_SERVER_IP,0).equals(""))
   {
     mqttIpAdr.fromString(WebSettings::getString(ID_PARAM_MQTT_SERVER_IP,0).c_str());
@@ -221,6 +259,7 @@ bool mqttConnect()
 
   str_mMqttDeviceName = WebSettings::getString(ID_PARAM_MQTT_DEVICE_NAME,0);
   str_mMqttTopicName = WebSettings::getString(ID_PARAM_MQTT_TOPIC_NAME,0);
+  mqttBuildTopicPrefixes();
   String mqttUser = WebSettings::getString(ID_PARAM_MQTT_USERNAME,0);
   String mqttPwd = WebSettings::getString(ID_PARAM_MQTT_PWD,0);
 
@@ -294,6 +333,53 @@ uint16_t getTxBufferSize()
   return txBuffer.size();
 }
 
+void mqttGetStatistics(struct mqttStatistics_s &stats)
+{
+  if(mMqttMutex==NULL)
+  {
+    memset(&stats, 0, sizeof(stats));
+    return;
+  }
+
+  xSemaphoreTake(mMqttMutex, portMAX_DELAY);
+  stats = mqttStatistics;
+  stats.txBufferSize = txBuffer.size();
+  xSemaphoreGive(mMqttMutex);
+}
+
+
+/* Baut die Topic-Anfänge "<Topic Name>/<t1>" einmalig auf,
+ * damit beim Senden keine Strings mehr zusammengesetzt werden müssen. */
+void mqttBuildTopicPrefixes()
+{
+  for(uint8_t i=0;i<=MQTT_TOPIC_BMS_SERIAL;i++)
+  {
+    int len = snprintf(mTopicPrefix[i], MQTT_TOPIC_PREFIX_SIZE, "%s/%s", str_mMqttTopicName.c_str(), mqttTopics[i]);
+    if(len<0) len=0;
+    else if(len>=MQTT_TOPIC_PREFIX_SIZE) len=MQTT_TOPIC_PREFIX_SIZE-1;
+    mTopicPrefixLen[i]=len;
+  }
+}
+
+
+/* Setzt das Topic <Topic Name>/<t1>[/<t2>][/<t3>][/<t4>] in mTopic zusammen */
+static const char* mqttBuildTopic(int8_t t1, int8_t t2, int8_t t3, int8_t t4)
+{
+  if(t1<0 || t1>MQTT_TOPIC_BMS_SERIAL) t1=0;
+  memcpy(mTopic, mTopicPrefix[t1], mTopicPrefixLen[t1]);
+
+  size_t pos = mTopicPrefixLen[t1];
+  int len=0;
+  if(t2!=-1){len=snprintf(&mTopic[pos], MQTT_TOPIC_SIZE-pos, "/%i", t2); if(len>0) pos+=len;}
+  if(t3!=-1 && pos<MQTT_TOPIC_SIZE){len=snprintf(&mTopic[pos], MQTT_TOPIC_SIZE-pos, "/%s", mqttTopics[t3]); if(len>0) pos+=len;}
+  if(t4!=-1 && pos<MQTT_TOPIC_SIZE){len=snprintf(&mTopic[pos], MQTT_TOPIC_SIZE-pos, "/%i", t4); if(len>0) pos+=len;}
+  if(pos>=MQTT_TOPIC_SIZE) pos=MQTT_TOPIC_SIZE-1;
+  mTopic[pos]=0;
+
+  return mTopic;
+}
+
+
 bool mqttPublishLoopFromTxBuffer()
 {
   if(millis()>(u32_mMqttPublishLoopTimmer+15))
@@ -303,14 +389,16 @@ bool mqttPublishLoopFromTxBuffer()
 
     if(txBuffer.size()>0)
     {
-      struct mqttEntry_s mqttEntry = txBuffer.at(0);
+      const struct mqttEntry_s &mqttEntry = txBuffer.front();
 
-      String topic = str_mMqttTopicName + "/" + mqttTopics[mqttEntry.t1];
-      if(mqttEntry.t2!=-1){topic+="/"; topic+=String(mqttEntry.t2);}
-      if(mqttEntry.t3!=-1){topic+="/"; topic+=mqttTopics[mqttEntry.t3];}
-      if(mqttEntry.t4!=-1){topic+="/"; topic+=String(mqttEntry.t4);}
+      const char *topic = mqttBuildTopic(mqttEntry.t1, mqttEntry.t2, mqttEntry.t3, mqttEntry.t4);
+      if(mqttClient.publish(topic, mqttEntry.value)) mqttStatistics.published++;
+      else mqttStatistics.publishFailed++;
+
+      uint32_t u32_lLatency = millis()-mqttEntry.u32_queuedMillis;
+      mqttStatistics.latencyLastMs = u32_lLatency;
+      if(u32_lLatency>mqttStatistics.latencyMaxMs) mqttStatistics.latencyMaxMs=u32_lLatency;
 
-      mqttClient.publish(topic.c_str(), mqttEntry.value.c_str());
       txBuffer.pop_front();
     }
 
@@ -323,7 +411,7 @@ bool mqttPublishLoopFromTxBuffer()
 }
 
 
-void mqttPublish(int8_t t1, int8_t t2, int8_t t3, int8_t t4, String value)
+static void mqttPublishToTxBuffer(int8_t t1, int8_t t2, int8_t t3, int8_t t4, const char *value)
 {
   if(smMqttConnectState==SM_MQTT_DISCONNECTED) return; //Wenn nicht verbunden, dann Nachricht nicht annehmen
   if(WiFi.status()!=WL_CONNECTED) return; //Wenn Wifi nicht verbunden
@@ -340,8 +428,6 @@ void mqttPublish(int8_t t1, int8_t t2, int8_t t3, int8_t t4, String value)
      }*/
      return;
   }
-  if(txBuffer.size()>300)return; //Wenn zu viele Nachrichten im Sendebuffer sind, neue Nachrichten ablehnen
-
   //Wenn BMS msg, dann msg anpassen
   if(t1==MQTT_TOPIC_BMS_BT)
   {
@@ -357,32 +443,53 @@ void mqttPublish(int8_t t1, int8_t t2, int8_t t3, int8_t t4, String value)
   mqttEntry.t2=t2;
   mqttEntry.t3=t3;
   mqttEntry.t4=t4;
-  mqttEntry.value=value;
+  mqttEntry.u32_queuedMillis=millis();
+  strncpy(mqttEntry.value, value, MQTT_VALUE_SIZE-1);
+  mqttEntry.value[MQTT_VALUE_SIZE-1]=0;
 
   xSemaphoreTake(mMqttMutex, portMAX_DELAY);
-  txBuffer.push_back(mqttEntry);
+  if(txBuffer.size()>=MQTT_TX_BUFFER_SIZE) //Wenn zu viele Nachrichten im Sendebuffer sind, neue Nachrichten ablehnen
+  {
+    mqttStatistics.dropped++;
+  }
+  else
+  {
+    txBuffer.push_back(mqttEntry);
+    if(txBuffer.size()>mqttStatistics.txBufferHighWater) mqttStatistics.txBufferHighWater=txBuffer.size();
+  }
   xSemaphoreGive(mMqttMutex);
 }
 
 
+void mqttPublish(int8_t t1, int8_t t2, int8_t t3, int8_t t4, String value)
+{
+  mqttPublishToTxBuffer(t1, t2, t3, t4, value.c_str());
+}
+
 void mqttPublish(int8_t t1, int8_t t2, int8_t t3, int8_t t4, uint32_t value)
 {
-  mqttPublish(t1, t2, t3, t4, String(value));
+  char buf[MQTT_VALUE_SIZE];
+  snprintf(buf, MQTT_VALUE_SIZE, "%u", (unsigned int)value);
+  mqttPublishToTxBuffer(t1, t2, t3, t4, buf);
 }
 
 void mqttPublish(int8_t t1, int8_t t2, int8_t t3, int8_t t4, int32_t value)
 {
-  mqttPublish(t1, t2, t3, t4, String(value));
+  char buf[MQTT_VALUE_SIZE];
+  snprintf(buf, MQTT_VALUE_SIZE, "%i", (int)value);
+  mqttPublishToTxBuffer(t1, t2, t3, t4, buf);
 }
 
 void mqttPublish(int8_t t1, int8_t t2, int8_t t3, int8_t t4, float value)
 {
-  mqttPublish(t1, t2, t3, t4, String(value));
+  char buf[MQTT_VALUE_SIZE];
+  snprintf(buf, MQTT_VALUE_SIZE, "%.2f", value); //Wie String(float)
+  mqttPublishToTxBuffer(t1, t2, t3, t4, buf);
 }
 
 void mqttPublish(int8_t t1, int8_t t2, int8_t t3, int8_t t4, bool value)
 {
-  mqttPublish(t1, t2, t3, t4, String(value));
+  mqttPublishToTxBuffer(t1, t2, t3, t4, value ? "1" : "0");
 }
 
 
@@ -404,6 +511,50 @@ void mqttDataToTxBuffer()
       sendBmsData_mqtt_sendeCounter=0;
       owDataSendFinsh=false;
       sendOwTemperatur_mqtt_sendeCounter=0;
+      taskDataSendFinsh=false;
+      sendTask_mqtt_sendeCounter=0;
+      commDataSendFinsh=false;
+      sendComm_mqtt_sendeCounter=0;
+    }
+
+    //Laufzeit der Tasks; ein JSON-Dokument pro Task (in beiden Modi), nachdem die BMS- und Temperaturdaten gesendet sind
+    if(bmsDataSendFinsh && owDataSendFinsh && !taskDataSendFinsh && millis()-sendeDelayTimerTask>=MQTT_AGGREGATED_SEND_DELAY)
+    {
+      sendeDelayTimerTask = millis();
+      mqttPublishTaskStatistics(sendTask_mqtt_sendeCounter);
+      sendTask_mqtt_sendeCounter++;
+      if(sendTask_mqtt_sendeCounter==TASK_TELEMETRY_COUNT)taskDataSendFinsh=true;
+    }
+
+    //Kommunikationsqualität der BMS; ein JSON-Dokument pro BMS (in beiden Modi), nach der Laufzeit der Tasks
+    if(taskDataSendFinsh && !commDataSendFinsh && millis()-sendeDelayTimerComm>=MQTT_AGGREGATED_SEND_DELAY)
+    {
+      sendeDelayTimerComm = millis();
+      mqttPublishCommStatistics(sendComm_mqtt_sendeCounter);
+      sendComm_mqtt_sendeCounter++;
+      if(sendComm_mqtt_sendeCounter==BMSDATA_NUMBER_ALLDEVICES)commDataSendFinsh=true;
+    }
+
+    if(bo_mMqttAggregated)
+    {
+      //Ein JSON-Dokument pro Gerät; die Dokumente werden direkt gesendet (ohne Sendebuffer)
+      if(millis()-sendeDelayTimer10ms>=MQTT_AGGREGATED_SEND_DELAY)
+      {
+        sendeDelayTimer10ms = millis();
+
+        if(!bmsDataSendFinsh)
+        {
+          mqttPublishBmsDataAggregated(sendBmsData_mqtt_sendeCounter);
+          sendBmsData_mqtt_sendeCounter++;
+          if(sendBmsData_mqtt_sendeCounter==BMSDATA_NUMBER_ALLDEVICES)bmsDataSendFinsh=true;
+        }
+        else if(!owDataSendFinsh)
+        {
+          mqttPublishOwTemperaturAggregated();
+          owDataSendFinsh=true;
+        }
+      }
+      return;
     }
 
     if(millis()-sendeDelayTimer500ms>=500) //Sende alle 500ms eine Nachricht
@@ -516,6 +667,127 @@ void mqttPublishOwTemperatur(uint8_t i)
 }
 
 
+/* Sendet das JSON-Dokument aus dem Payload-Buffer direkt aus dem Buffer (ohne Kopie in den Buffer des Clients) */
+bool mqttPublishPayload(const char *topic)
+{
+  bool ret=false;
+
+  if(mPayload.overflow())
+  {
+    xSemaphoreTake(mMqttMutex, portMAX_DELAY);
+    mqttStatistics.aggregatedOverflow++;
+    xSemaphoreGive(mMqttMutex);
+    BSC_LOGE(TAG,"Payload overflow: topic=%s", topic);
+    return false;
+  }
+
+  uint16_t u16_lPayloadLen = mPayload.length();
+  if(mqttClient.beginPublish(topic, u16_lPayloadLen, false))
+  {
+    if(mqttClient.write((const uint8_t*)mPayload.data(), u16_lPayloadLen)==u16_lPayloadLen) ret=(mqttClient.endPublish()==1);
+    else mqttClient.endPublish();
+  }
+
+  xSemaphoreTake(mMqttMutex, portMAX_DELAY);
+  if(ret)
+  {
+    mqttStatistics.published++;
+    mqttStatistics.aggregatedDocs++;
+    if(u16_lPayloadLen>mqttStatistics.aggregatedMaxLen) mqttStatistics.aggregatedMaxLen=u16_lPayloadLen;
+  }
+  else mqttStatistics.publishFailed++;
+  xSemaphoreGive(mMqttMutex);
+
+  return ret;
+}
+
+
+/* Sendet alle Daten eines BMS als ein JSON-Dokument an <Topic Name>/bms/bt/<nr> bzw. <Topic Name>/bms/serial/<nr>.
+ * Die Keys entsprechen den Topics der Einzelnachrichten. */
+void mqttPublishBmsDataAggregated(uint8_t i)
+{
+  if(smMqttConnectState==SM_MQTT_DISCONNECTED) return; //Wenn nicht verbunden, dann zurück
+
+  BmsDataSnapshot bmsSnapshot;
+  getBmsDataSnapshot(i, bmsSnapshot);
+
+  bool bo_lValid = ((bmsSnapshot.lastDataMillis+5000)>millis()); //Nur senden wenn die Daten nicht älter als 5 sec. sind
+  mqttpayload::writeBmsData(mPayload, bmsSnapshot, bo_lValid);
+
+  if(i<BT_DEVICES_COUNT) mqttPublishPayload(mqttBuildTopic(MQTT_TOPIC_BMS_BT, i, -1, -1));
+  else mqttPublishPayload(mqttBuildTopic(MQTT_TOPIC_BMS_SERIAL, i-BT_DEVICES_COUNT, -1, -1));
+}
+
+
+/* Sendet die Temperaturen aller konfigurierten Onewire-Sensoren als ein JSON-Dokument an <Topic Name>/temperatur.
+ * Key ist die Sensornummer. */
+void mqttPublishOwTemperaturAggregated()
+{
+  if(smMqttConnectState==SM_MQTT_DISCONNECTED) return; //Wenn nicht verbunden, dann zurück
+
+  bool bo_lFirst=true;
+  mPayload.reset();
+  mPayload.append("{");
+  for(uint8_t i=0;i<MAX_ANZAHL_OW_SENSOREN;i++)
+  {
+    if(WebSettings::getStringFlash(ID_PARAM_ONEWIRE_ADR,i).equals("")) continue;
+
+    float f_lOwTemp=owGetTemp(i);
+    if(f_lOwTemp==TEMP_IF_SENSOR_READ_ERROR) continue;
+
+    mPayload.appendf(bo_lFirst?"\"%u\":%.2f":",\"%u\":%.2f", i, f_lOwTemp);
+    bo_lFirst=false;
+  }
+  mPayload.append("}");
+
+  mqttPublishPayload(mqttBuildTopic(MQTT_TOPIC_TEMPERATUR, -1, -1, -1));
+}
+
+
+/* Sendet die Laufzeit eines Tasks als JSON-Dokument an <Topic Name>/sys/task/<taskId> */
+void mqttPublishTaskStatistics(uint8_t taskId)
+{
+  if(smMqttConnectState==SM_MQTT_DISCONNECTED) return; //Wenn nicht verbunden, dann zurück
+
+  taskStatistics_s taskStatistics;
+  if(!taskTelemetryGetStatistics(taskId, taskStatistics)) return;
+
+  mPayload.reset();
+  mPayload.appendf("{\"name\":\"%s\",\"stack_free\":%u", taskStatistics.name, (unsigned int)taskStatistics.stackFree);
+  if(taskStatistics.measured)
+  {
+    const utils::TaskStatistics &runtime = taskStatistics.runtime;
+    mPayload.appendf(",\"cycles\":%u,\"duration_avg_us\":%u,\"duration_max_us\":%u,\"jitter_us\":%u,\"jitter_max_us\":%u,\"cpu_permille\":%u,\"histogram\":[",
+      (unsigned int)runtime.cycles, (unsigned int)runtime.durationAvgUs, (unsigned int)runtime.durationMaxUs,
+      (unsigned int)runtime.jitterUs, (unsigned int)runtime.jitterMaxUs, (unsigned int)runtime.cpuPermille);
+    for(size_t i=0;i<utils::TASK_MONITOR_BUCKETS;i++) mPayload.appendf(i==0?"%u":",%u", (unsigned int)runtime.histogram[i]);
+    mPayload.append("]");
+  }
+  mPayload.append("}");
+
+  mqttPublishPayload(mqttBuildTopic(MQTT_TOPIC_SYS, -1, MQTT_TOPIC2_TASK, taskId));
+}
+
+
+/* Sendet die Kommunikationsstatistik eines BMS als JSON-Dokument an <Topic Name>/bms/bt/<nr>/comm
+ * bzw. <Topic Name>/bms/serial/<nr>/comm. BMS ohne Kommunikation werden übersprungen. */
+void mqttPublishCommStatistics(uint8_t bmsDevNr)
+{
+  if(smMqttConnectState==SM_MQTT_DISCONNECTED) return; //Wenn nicht verbunden, dann zurück
+
+  commstats::Statistics commStatistics;
+  commstats::Source source = commstats::Source::BT_BMS;
+  if(bmsDevNr<BT_DEVICES_COUNT) BleHandler::getCommStatistics(bmsDevNr, commStatistics);
+  else source = serialGetCommStatistics(bmsDevNr-BT_DEVICES_COUNT, commStatistics);
+  if(!commstats::hasTraffic(commStatistics)) return;
+
+  mqttpayload::writeCommStatistics(mPayload, source, commStatistics);
+
+  if(bmsDevNr<BT_DEVICES_COUNT) mqttPublishPayload(mqttBuildTopic(MQTT_TOPIC_BMS_BT, bmsDevNr, MQTT_TOPIC2_COMM, -1));
+  else mqttPublishPayload(mqttBuildTopic(MQTT_TOPIC_BMS_SERIAL, bmsDevNr-BT_DEVICES_COUNT, MQTT_TOPIC2_COMM, -1));
+}
+
+
 /*void mqttPublishTrigger()
 {
   if(smMqttConnectState==SM_MQTT_DISCONNECTED) return; //Wenn nicht verbunden, dann zurück
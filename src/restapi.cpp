@@ -1,96 +1,30 @@
 #include <Arduino.h>
 #include "restapi.h"
 #include "BmsData.h"
+#include "BleHandler.h"
 #include "Ow.h"
 #include "Json.h"
 #include "WebSettings.h"
 #include "dio.h"
 #include "Canbus.h"
+#include "BscSerial.h"
+#include "mqtt_t.h"
+#include "i2c.h"
+#include "ValueLog.h"
+#include "SettingsView.h"
+#include "TaskTelemetry.h"
+#include "HeapStats.h"
+#include "SerialRx.h"
+#include "RestApiJson.hpp"
+#include <utils/JsonWriter.hpp>
 
 static const char* TAG = "REST";
 
-enum genJsonTypes{arrStart,arrEnd,entrySingle,arrStart2,arrStart3,arrStart4,arrEnd2,entrySingle2};
+#define REST_JSON_CHUNK_SIZE 512 // Größe des Buffers; ist er voll, wird er an den Client gesendet
 
 bool handleRestArgs(WebServer * server);
 
 
-void genJsonEntrySingle(String key, String value, String &str_retStr)
-{
-  //\"cells\":16,
-  str_retStr += "\"";
-  str_retStr += String(key);
-  str_retStr += "\":\"";
-  str_retStr += value;
-  str_retStr += "\"";
-}
-
-void genJsonEntrySingle(String key, int32_t value, String &str_retStr)
-{
-  genJsonEntrySingle(key, String(value), str_retStr);
-}
-
-void genJsonEntryArray(genJsonTypes type, String key, String value, String &str_retStr, boolean lastEntry)
-{
-  switch(type)
-  {
-    case arrStart: //Start
-      str_retStr += "\"";
-      str_retStr += String(key);
-      str_retStr += "\":[{";
-      break;
-
-    case arrStart2: //Start2
-      str_retStr += "\"";
-      str_retStr += String(key);
-      str_retStr += "\":[";
-      break;
-
-    case arrStart3: //Start3
-      str_retStr += "{";
-      if(!lastEntry)str_retStr += ",";
-      break;
-
-    case arrStart4: //Start4
-      str_retStr += "\"";
-      str_retStr += String(key);
-      str_retStr += "\":{";
-      break;
-
-    case entrySingle: //Entry
-      genJsonEntrySingle(key, value, str_retStr);
-      if(!lastEntry)str_retStr += ",";
-      break;
-
-    case entrySingle2: //Entry 2
-      str_retStr += value;
-      if(!lastEntry)str_retStr += ",";
-      break;
-
-    case arrEnd: //End
-      str_retStr += "}";
-      if(!lastEntry)str_retStr += ",";
-      str_retStr += "\n";
-      break;
-
-    case arrEnd2: //End 2
-      str_retStr += "]";
-      if(!lastEntry)str_retStr += ",";
-      str_retStr += "\n";
-      break;
-  }
-}
-
-void genJsonEntryArray(genJsonTypes type, String key, int32_t value, String &str_retStr, boolean lastEntry)
-{
-  genJsonEntryArray(type, key, String(value), str_retStr, lastEntry);
-}
-
-
-
-const char JSON_BMS_BT_1[] PROGMEM ="\"bms_bt\":[%s]";
-const char JSON_BMS_BT_2[] PROGMEM ="\"{\"nr\":%i,\"cells\":%i,\"cell_voltage\":[%s],\"temperature\":[%s]}";
-
-
 void buildJsonRest(WebServer * server)
 {
   if(server->args()>0)
@@ -100,199 +34,282 @@ void buildJsonRest(WebServer * server)
   }
   else
   {
-    String str_htmlOut="";
-    uint8_t u8_val=0;
+    BmsDataSnapshot bmsSnapshot;
+    SettingsViewRef settings;
 
     uint8_t u8_nrOfCells=WebSettings::getInt(ID_PARAM_SERIAL_NUMBER_OF_CELLS,0,DT_ID_PARAM_SERIAL_NUMBER_OF_CELLS);
 
     server->setContentLength(CONTENT_LENGTH_UNKNOWN);
     server->send(200, "application/json", "");
 
+    //Das JSON-Dokument wird in Stücken von REST_JSON_CHUNK_SIZE direkt an den Client gestreamt
+    auto sink = [server](const char *data, size_t len) { server->sendContent(data, len); };
+    utils::JsonWriter<REST_JSON_CHUNK_SIZE, decltype(sink)> json(sink);
+
     //Start
-    genJsonEntryArray(arrStart3, "", "", str_htmlOut, true);
+    json.beginObject();
 
     // System
-    //"bms_bt":{"en":"1","valid":"0","nr":"0","cells":"16"}
-    genJsonEntryArray(arrStart4, F("system"), "", str_htmlOut, true);
-
-    genJsonEntryArray(entrySingle, F("fw_version"), BSC_SW_VERSION, str_htmlOut, false);
-    genJsonEntryArray(entrySingle, F("fw_add"), BSC_SW_SPEZIAL, str_htmlOut, false);
-    genJsonEntryArray(entrySingle, F("hw_version"), getHwVersion(), str_htmlOut, false);
-    genJsonEntryArray(entrySingle, F("name"), WebSettings::getString(ID_PARAM_MQTT_DEVICE_NAME,0), str_htmlOut, true);
-
-    genJsonEntryArray(arrEnd, "", "", str_htmlOut, false);
-    server->sendContent(str_htmlOut);
-    str_htmlOut="";
+    json.beginObject("system");
+    json.add("fw_version", BSC_SW_VERSION);
+    json.add("fw_add", BSC_SW_SPEZIAL);
+    json.add("hw_version", getHwVersion());
+    json.add("name", WebSettings::getString(ID_PARAM_MQTT_DEVICE_NAME,0).c_str());
+    json.endObject();
 
     // Inverter
-    genJsonEntryArray(arrStart4, F("inverter"), "", str_htmlOut, true);
-
     inverterDataSemaphoreTake();
-    inverterData_s *inverterData = getInverterData();
-    int16_t inverterChargeCurrent = inverterData->inverterChargeCurrent;
-    int16_t inverterDischargeCurrent = inverterData->inverterDischargeCurrent;
-    int16_t inverterCurrent = inverterData->inverterCurrent;
-    int16_t inverterVoltage = inverterData->inverterVoltage;
-    uint16_t inverterSoc = inverterData->inverterSoc;
-
-    int16_t calcChargeCurrentCellVoltage = inverterData->calcChargeCurrentCellVoltage;
-    int16_t calcChargeCurrentSoc = inverterData->calcChargeCurrentSoc;
-    int16_t calcChargeCurrentCelldrift = inverterData->calcChargeCurrentCelldrift;
-    int16_t calcChargeCurrentCutOff = inverterData->calcChargeCurrentCutOff;
-
-    int16_t calcDischargeCurrentCellVoltage = inverterData->calcDischargeCurrentCellVoltage;
+    inverterData_s inverterData = *getInverterData();
     inverterDataSemaphoreGive();
-    genJsonEntryArray(entrySingle, F("current"), inverterCurrent, str_htmlOut, false);
-    genJsonEntryArray(entrySingle, F("voltage"), inverterVoltage, str_htmlOut, false);
-    genJsonEntryArray(entrySingle, F("soc"), inverterSoc, str_htmlOut, false);
-
-    genJsonEntryArray(entrySingle, F("setpoint_cc"), inverterChargeCurrent, str_htmlOut, false);
-    genJsonEntryArray(entrySingle, F("setpoint_dcc"), inverterDischargeCurrent, str_htmlOut, false);
 
-    genJsonEntryArray(entrySingle, F("cc_cellVoltage"), calcChargeCurrentCellVoltage, str_htmlOut, false);
-    genJsonEntryArray(entrySingle, F("cc_soc"), calcChargeCurrentSoc, str_htmlOut, false);
-    genJsonEntryArray(entrySingle, F("cc_cellDrift"), calcChargeCurrentCelldrift, str_htmlOut, false);
-    genJsonEntryArray(entrySingle, F("cc_cutOff"), calcChargeCurrentCutOff, str_htmlOut, false);
-
-    genJsonEntryArray(entrySingle, F("dcc_cellVoltage"), calcDischargeCurrentCellVoltage, str_htmlOut, true);
-
-    genJsonEntryArray(arrEnd, "", "", str_htmlOut, false);
-    server->sendContent(str_htmlOut);
-    str_htmlOut="";
+    json.beginObject("inverter");
+    json.add("current", inverterData.inverterCurrent);
+    json.add("voltage", inverterData.inverterVoltage);
+    json.add("soc", inverterData.inverterSoc);
+
+    json.add("setpoint_cc", inverterData.inverterChargeCurrent);
+    json.add("setpoint_dcc", inverterData.inverterDischargeCurrent);
+
+    json.add("cc_cellVoltage", inverterData.calcChargeCurrentCellVoltage);
+    json.add("cc_soc", inverterData.calcChargeCurrentSoc);
+    json.add("cc_cellDrift", inverterData.calcChargeCurrentCelldrift);
+    json.add("cc_cutOff", inverterData.calcChargeCurrentCutOff);
+
+    json.add("dcc_cellVoltage", inverterData.calcDischargeCurrentCellVoltage);
+    json.endObject();
+
+    // Canbus
+    canStatistics_s canStatistics;
+    canGetStatistics(canStatistics);
+    json.beginObject("can");
+    json.add("rx_frames", canStatistics.rxFrames);
+    json.add("rx_dropped", canStatistics.rxDropped);
+    json.add("rx_overrun", canStatistics.rxOverrun);
+    json.add("rx_queue_hwm", canStatistics.rxQueueHighWater);
+    json.add("rx_queue_len", canStatistics.rxQueueLength);
+    json.add("tx_frames", canStatistics.txFrames);
+    json.add("tx_failed", canStatistics.txFailed);
+    json.add("tx_queue_full", canStatistics.txQueueFull);
+    json.add("tx_queue_len", canStatistics.txQueueLength);
+    json.add("tx_latency_us", canStatistics.txLatencyLastUs);
+    json.add("tx_latency_max_us", canStatistics.txLatencyMaxUs);
+    json.endObject();
+
+    // MQTT
+    mqttStatistics_s mqttStatistics;
+    mqttGetStatistics(mqttStatistics);
+    json.beginObject("mqtt");
+    json.add("published", mqttStatistics.published);
+    json.add("failed", mqttStatistics.publishFailed);
+    json.add("dropped", mqttStatistics.dropped);
+    json.add("tx_buffer", mqttStatistics.txBufferSize);
+    json.add("tx_buffer_hwm", mqttStatistics.txBufferHighWater);
+    json.add("latency_ms", mqttStatistics.latencyLastMs);
+    json.add("latency_max_ms", mqttStatistics.latencyMaxMs);
+    json.add("json_docs", mqttStatistics.aggregatedDocs);
+    json.add("json_max_len", mqttStatistics.aggregatedMaxLen);
+    json.add("json_overflow", mqttStatistics.aggregatedOverflow);
+    json.endObject();
+
+    i2cStatistics_s i2cStatistics;
+    i2cGetStatistics(i2cStatistics);
+    json.beginObject("i2c");
+    json.add("tx_frames", i2cStatistics.txFrames);
+    json.add("tx_bytes", i2cStatistics.txBytes);
+    json.add("tx_failed", i2cStatistics.txFailed);
+    json.add("rx_frames", i2cStatistics.rxFrames);
+    json.add("rx_bytes", i2cStatistics.rxBytes);
+    json.add("rx_timeout", i2cStatistics.rxTimeout);
+    json.add("rx_crc_error", i2cStatistics.rxCrcError);
+    json.add("rx_invalid", i2cStatistics.rxInvalid);
+    json.add("rx_lost", i2cStatistics.rxLost);
+    json.add("cycle_us", i2cStatistics.cycleTimeLastUs);
+    json.add("cycle_max_us", i2cStatistics.cycleTimeMaxUs);
+    json.add("slave_requests", i2cStatistics.slaveRequests);
+    json.add("slave_tx_frames", i2cStatistics.slaveTxFrames);
+    json.add("slave_tx_bytes", i2cStatistics.slaveTxBytes);
+    json.endObject();
+
+    // Aufzeichnung der Werte (1s, 1min, 15min)
+    valueLogStatistics_s valueLogStatistics;
+    valueLogGetStatistics(valueLogStatistics);
+    json.beginArray("valuelog");
+    for(uint8_t u8_lTier=0;u8_lTier<VALUE_LOG_TIERS;u8_lTier++)
+    {
+      json.beginObject();
+      json.add("records", valueLogStatistics.records[u8_lTier]);
+      json.add("writes", valueLogStatistics.writes[u8_lTier]);
+      json.add("bytes_written", valueLogStatistics.bytesWritten[u8_lTier]);
+      json.add("dropped", valueLogStatistics.dropped[u8_lTier]);
+      json.endObject();
+    }
+    json.endArray();
 
     // BMS Bluetooth
-    genJsonEntryArray(arrStart, F("bms_bt"), "", str_htmlOut, false);
+    json.beginArray("bms_bt");
     for(uint8_t bmsDevNr=0;bmsDevNr<BT_DEVICES_COUNT;bmsDevNr++)
     {
-      if(WebSettings::getInt(ID_PARAM_SS_BTDEV,bmsDevNr,DT_ID_PARAM_SS_BTDEV)!=0)
-        genJsonEntryArray(entrySingle, F("en"), 1, str_htmlOut, false);
-      else genJsonEntryArray(entrySingle, F("en"), 0, str_htmlOut, false);
-
-      if((millis()-getBmsLastDataMillis(bmsDevNr)<5000)) u8_val=1;
-      else u8_val=0;
-      genJsonEntryArray(entrySingle, F("valid"), u8_val, str_htmlOut, false);
-
-      genJsonEntryArray(entrySingle, F("nr"), bmsDevNr, str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("cells"), u8_nrOfCells, str_htmlOut, false);
-
-      genJsonEntryArray(entrySingle, F("totalVolt"), String(getBmsTotalVoltage(bmsDevNr)), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("totalCurr"), String(getBmsTotalCurrent(bmsDevNr)), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("soc"), getBmsChargePercentage(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("maxZellDiff"), getBmsMaxCellDifferenceVoltage(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("maxCellVolt"), getBmsMaxCellVoltage(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("minCellVolt"), getBmsMinCellVoltage(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("maxCellVoltNr"), getBmsMaxVoltageCellNumber(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("minCellVoltNr"), getBmsMinVoltageCellNumber(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("balOn"), getBmsIsBalancingActive(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("FetState"), getBmsStateFETs(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("bmsErr"), getBmsErrors(bmsDevNr), str_htmlOut, false);
-
-      genJsonEntryArray(arrStart2, F("cell_voltage"), "", str_htmlOut, false);
-      for(uint8_t i=0;i<(u8_nrOfCells-1);i++)
-      {
-        genJsonEntryArray(entrySingle2, "", getBmsCellVoltage(bmsDevNr,i), str_htmlOut, false);
-      }
-      genJsonEntryArray(entrySingle2, "", getBmsCellVoltage(bmsDevNr,u8_nrOfCells-1), str_htmlOut, true);
-      genJsonEntryArray(arrEnd2, "", "", str_htmlOut, false);
+      bool bo_lEnabled = (WebSettings::getInt(ID_PARAM_SS_BTDEV,bmsDevNr,DT_ID_PARAM_SS_BTDEV)!=0);
 
-      genJsonEntryArray(arrStart2, F("temperature"), "", str_htmlOut, false);
-      genJsonEntryArray(entrySingle2, "", getBmsTempature(bmsDevNr,0), str_htmlOut, false);
-      genJsonEntryArray(entrySingle2, "", getBmsTempature(bmsDevNr,1), str_htmlOut, false);
-      genJsonEntryArray(entrySingle2, "", getBmsTempature(bmsDevNr,2), str_htmlOut, true);
-      genJsonEntryArray(arrEnd2, "", "", str_htmlOut, true);
+      getBmsDataSnapshot(bmsDevNr, bmsSnapshot);
+      bool bo_lValid = (millis()-bmsSnapshot.lastDataMillis<5000);
 
-      if(bmsDevNr<BT_DEVICES_COUNT-1)
-      {
-        genJsonEntryArray(arrEnd, "", "", str_htmlOut, false);
-        genJsonEntryArray(arrStart3, "", "", str_htmlOut, true);
-      }
-      else genJsonEntryArray(arrEnd, "", "", str_htmlOut, true);
+      restapi::writeBmsEntry(json, bmsSnapshot, bo_lEnabled, bo_lValid, bmsDevNr, restapi::NO_CYCLE_TIME, u8_nrOfCells, false);
+    }
+    json.endArray();
+
+    // Bluetooth Notifications
+    json.beginArray("bt");
+    for(uint8_t bmsDevNr=0;bmsDevNr<BT_DEVICES_COUNT;bmsDevNr++)
+    {
+      ble::NotifyStatistics btStatistics;
+      BleHandler::getStatistics(bmsDevNr, btStatistics);
+      json.beginObject();
+      json.add("connects", btStatistics.connects);
+      json.add("disconnects", btStatistics.disconnects);
+      json.add("notifications", btStatistics.notifications);
+      json.add("bytes", btStatistics.bytes);
+      json.add("notify_rate", btStatistics.notifyRate);
+      json.add("reassembly_errors", btStatistics.reassemblyErrors);
+      json.add("stale_gaps", btStatistics.staleGaps);
+      json.add("max_gap_ms", btStatistics.maxGapMs);
+      json.add("last_notify_ms", btStatistics.lastNotifyAgeMs);
+      json.endObject();
     }
-    genJsonEntryArray(arrEnd2, "", "", str_htmlOut, false);
-    server->sendContent(str_htmlOut);
-    str_htmlOut="";
+    json.endArray();
 
 
     // BMS serial
-    uint8_t u8_device, u8_deviceSerial2, u8_deviceSerial2NrOfBms;
-    u8_deviceSerial2=WebSettings::getInt(ID_PARAM_SERIAL_CONNECT_DEVICE,2,DT_ID_PARAM_SERIAL_CONNECT_DEVICE);
-    u8_deviceSerial2NrOfBms=WebSettings::getInt(ID_PARAM_SERIAL2_CONNECT_TO_ID,0,DT_ID_PARAM_SERIAL2_CONNECT_TO_ID);
+    uint8_t u8_deviceSerial2=settings->serialConnectDevice[2];
+    uint8_t u8_deviceSerial2NrOfBms=settings->serial2NumberOfBms;
 
-    genJsonEntryArray(arrStart, F("bms_serial"), "", str_htmlOut, false);
+    json.beginArray("bms_serial");
     for(uint8_t bmsDevNr=BT_DEVICES_COUNT;bmsDevNr<BT_DEVICES_COUNT+SERIAL_BMS_DEVICES_COUNT;bmsDevNr++)
     {
-      u8_device = WebSettings::getInt(ID_PARAM_SERIAL_CONNECT_DEVICE,bmsDevNr-BT_DEVICES_COUNT,DT_ID_PARAM_SERIAL_CONNECT_DEVICE);
-      //BSC_LOGI(TAG,"Restapi: u8_device=%i, u8_deviceSerial2=%i, bmsDevNr=%i, u8_deviceSerial2NrOfBms=%i",u8_device, u8_deviceSerial2, bmsDevNr, u8_deviceSerial2NrOfBms);
-      if(u8_device!=0) genJsonEntryArray(entrySingle, F("en"), 1, str_htmlOut, false);
-      else if(isMultiple485bms(u8_deviceSerial2) && bmsDevNr>BT_DEVICES_COUNT+2 && bmsDevNr<BT_DEVICES_COUNT+2+u8_deviceSerial2NrOfBms)
-        genJsonEntryArray(entrySingle, F("en"), 1, str_htmlOut, false);
-      else genJsonEntryArray(entrySingle, F("en"), 0, str_htmlOut, false);
-
-      if((millis()-getBmsLastDataMillis(bmsDevNr)<5000)) u8_val=1;
-      else u8_val=0;
-      genJsonEntryArray(entrySingle, F("valid"), u8_val, str_htmlOut, false);
-
-      genJsonEntryArray(entrySingle, F("nr"), bmsDevNr-BT_DEVICES_COUNT, str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("cells"), u8_nrOfCells, str_htmlOut, false);
-
-      genJsonEntryArray(entrySingle, F("totalVolt"), String(getBmsTotalVoltage(bmsDevNr)), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("totalCurr"), String(getBmsTotalCurrent(bmsDevNr)), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("soc"), getBmsChargePercentage(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("maxZellDiff"), getBmsMaxCellDifferenceVoltage(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("maxCellVolt"), getBmsMaxCellVoltage(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("minCellVolt"), getBmsMinCellVoltage(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("maxCellVoltNr"), getBmsMaxVoltageCellNumber(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("minCellVoltNr"), getBmsMinVoltageCellNumber(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("balOn"), getBmsIsBalancingActive(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("FetState"), getBmsStateFETs(bmsDevNr), str_htmlOut, false);
-      genJsonEntryArray(entrySingle, F("bmsErr"), getBmsErrors(bmsDevNr), str_htmlOut, false);
-
-      genJsonEntryArray(arrStart2, F("cell_voltage"), "", str_htmlOut, false);
-      uint16_t u16_lZellVoltage=0;
-      for(uint8_t i=0;i<(u8_nrOfCells-1);i++)
-      {
-        u16_lZellVoltage = getBmsCellVoltage(bmsDevNr,i);
-        if(u16_lZellVoltage==0xFFFF)u16_lZellVoltage=0;
-        genJsonEntryArray(entrySingle2, "", u16_lZellVoltage, str_htmlOut, false);
-      }
-      u16_lZellVoltage = getBmsCellVoltage(bmsDevNr,u8_nrOfCells-1);
-      if(u16_lZellVoltage==0xFFFF)u16_lZellVoltage=0;
-      genJsonEntryArray(entrySingle2, "", u16_lZellVoltage, str_htmlOut, true);
-      genJsonEntryArray(arrEnd2, "", "", str_htmlOut, false);
-
-      genJsonEntryArray(arrStart2, F("temperature"), "", str_htmlOut, false);
-      genJsonEntryArray(entrySingle2, "", getBmsTempature(bmsDevNr,0), str_htmlOut, false);
-      genJsonEntryArray(entrySingle2, "", getBmsTempature(bmsDevNr,1), str_htmlOut, false);
-      genJsonEntryArray(entrySingle2, "", getBmsTempature(bmsDevNr,2), str_htmlOut, true);
-      genJsonEntryArray(arrEnd2, "", "", str_htmlOut, true);
-
-      if(bmsDevNr<BT_DEVICES_COUNT+SERIAL_BMS_DEVICES_COUNT-1)
-      {
-        genJsonEntryArray(arrEnd, "", "", str_htmlOut, false);
-        genJsonEntryArray(arrStart3, "", "", str_htmlOut, true);
-      }
-      else genJsonEntryArray(arrEnd, "", "", str_htmlOut, true);
+      uint8_t u8_device = settings->serialConnectDevice[bmsDevNr-BT_DEVICES_COUNT];
+      bool bo_lEnabled = false;
+      if(u8_device!=0) bo_lEnabled=true;
+      else if(isMultiple485bms(u8_deviceSerial2) && bmsDevNr>BT_DEVICES_COUNT+2 && bmsDevNr<BT_DEVICES_COUNT+2+u8_deviceSerial2NrOfBms) bo_lEnabled=true;
+
+      getBmsDataSnapshot(bmsDevNr, bmsSnapshot);
+      bool bo_lValid = (millis()-bmsSnapshot.lastDataMillis<5000);
+
+      restapi::writeBmsEntry(json, bmsSnapshot, bo_lEnabled, bo_lValid, bmsDevNr-BT_DEVICES_COUNT,
+        serialGetCycleTime(bmsDevNr-BT_DEVICES_COUNT), u8_nrOfCells, true);
     }
-    genJsonEntryArray(arrEnd2, "", "", str_htmlOut, false);
-    server->sendContent(str_htmlOut);
-    str_htmlOut="";
+    json.endArray();
+
+    // Aktives Pollintervall der BMS (nur Geräte, die abgefragt werden)
+    json.beginObject("poll");
+    json.beginArray("bt");
+    for(uint8_t i=0;i<BT_DEVICES_COUNT;i++)
+    {
+      restapi::writePollEntry(json, i, BleHandler::getPollStatistics(i));
+    }
+    json.endArray();
+    json.beginArray("serial");
+    for(uint8_t i=0;i<SERIAL_BMS_DEVICES_COUNT;i++)
+    {
+      restapi::writePollEntry(json, i, serialGetPollStatistics(i));
+    }
+    json.endArray();
+    json.endObject();
+
+    // Kommunikationsqualität der BMS (nur Geräte mit Kommunikation)
+    json.beginArray("comm");
+    for(uint8_t i=0;i<BT_DEVICES_COUNT;i++)
+    {
+      commstats::Statistics commStatistics;
+      BleHandler::getCommStatistics(i, commStatistics);
+      restapi::writeCommEntry(json, commstats::Source::BT_BMS, i, commStatistics);
+    }
+    for(uint8_t i=0;i<SERIAL_BMS_DEVICES_COUNT;i++)
+    {
+      commstats::Statistics commStatistics;
+      commstats::Source source = serialGetCommStatistics(i, commStatistics);
+      restapi::writeCommEntry(json, source, i, commStatistics);
+    }
+    json.endArray();
 
 
     // onewire Temperature
-    genJsonEntryArray(arrStart2, F("temperature"), "", str_htmlOut, false);
-    for(uint8_t i=0;i<63;i++)
+    json.beginArray("temperature");
+    for(uint8_t i=0;i<MAX_ANZAHL_OW_SENSOREN;i++)
+    {
+      json.value(owGetTemp(i));
+    }
+    json.endArray();
+
+    // onewire Sensoren (nur konfigurierte)
+    json.beginArray("onewire");
+    for(uint8_t i=0;i<MAX_ANZAHL_OW_SENSOREN;i++)
     {
-      genJsonEntryArray(entrySingle2, "", String(owGetTemp(i)), str_htmlOut, false);
+      owSensorStatistics_s owStatistics;
+      if(!owGetSensorStatistics(i, owStatistics)) continue;
+      json.beginObject();
+      json.add("nr", i);
+      json.add("resolution", owStatistics.resolution);
+      json.add("interval_ms", owStatistics.intervalMs);
+      json.add("reads", owStatistics.reads);
+      json.add("crc_errors", owStatistics.crcErrors);
+      json.add("no_response", owStatistics.noResponse);
+      json.add("retries", owStatistics.retries);
+      json.add("failures", owStatistics.failures);
+      json.add("failed", owStatistics.failed);
+      json.endObject();
     }
-    genJsonEntryArray(entrySingle2, "", String(owGetTemp(63)), str_htmlOut, true);
-    genJsonEntryArray(arrEnd2, "", "", str_htmlOut, true);
+    json.endArray();
 
+    // Laufzeit der Tasks
+    json.beginArray("tasks");
+    for(uint8_t taskId=0;taskId<TASK_TELEMETRY_COUNT;taskId++)
+    {
+      taskStatistics_s taskStatistics;
+      if(!taskTelemetryGetStatistics(taskId, taskStatistics)) continue;
+      json.beginObject();
+      json.add("name", taskStatistics.name);
+      json.add("stack_free", taskStatistics.stackFree);
+      if(taskStatistics.measured)
+      {
+        const utils::TaskStatistics &runtime = taskStatistics.runtime;
+        json.add("cycles", runtime.cycles);
+        json.add("duration_us", runtime.durationLastUs);
+        json.add("duration_min_us", runtime.durationMinUs);
+        json.add("duration_avg_us", runtime.durationAvgUs);
+        json.add("duration_max_us", runtime.durationMaxUs);
+        json.add("period_us", runtime.periodLastUs);
+        json.add("jitter_us", runtime.jitterUs);
+        json.add("jitter_max_us", runtime.jitterMaxUs);
+        json.add("cpu_permille", runtime.cpuPermille);
+        json.beginArray("histogram");
+        for(uint32_t u32_lCount : runtime.histogram) json.value(u32_lCount);
+        json.endArray();
+      }
+      json.endObject();
+    }
+    json.endArray();
+
+    // Heap (Fragmentierung durch die Web-Requests)
+    heapStatistics_s heapStatistics;
+    heapStatsGetStatistics(heapStatistics);
+    json.beginObject("heap");
+    json.add("free", heapStatistics.freeHeap);
+    json.add("min_free", heapStatistics.minFreeHeap);
+    json.add("largest_block", heapStatistics.largestFreeBlock);
+    json.add("fragmentation_permille", heapStatistics.fragmentationPermille);
+    json.add("web_requests", heapStatistics.requests);
+    json.add("web_largest_before", heapStatistics.largestBeforeLast);
+    json.add("web_largest_after", heapStatistics.largestAfterLast);
+    json.add("web_largest_min", heapStatistics.largestMin);
+    json.add("web_free_delta", heapStatistics.freeDeltaLast);
+    json.add("web_shrinks", heapStatistics.shrinks);
+    json.add("web_response_max", heapStatistics.responseMaxLen);
+    json.add("web_response_overflows", heapStatistics.responseOverflows);
+    json.endObject();
 
     //Ende
-    genJsonEntryArray(arrEnd, "", "", str_htmlOut, true);
-
-    server->sendContent(str_htmlOut);
-    str_htmlOut="";
+    json.endObject();
+    json.flush();
   }
 }
 
@@ -319,7 +336,7 @@ bool handleRestArgs(WebServer * server)
 
     #ifdef UTEST_RESTAPI
     else if(argName==F("setBms")) {u8_activeBms=(uint8_t)argValue.toInt();}
-    else if(argName==F("soc")) {setBmsChargePercentage(u8_activeBms,argValue.toInt()); setBmsLastDataMillis(u8_activeBms,millis());}
+    else if(argName==F("soc")) {setBmsChargePercentage(u8_activeBms,argValue.toInt()); bmsDataUpdateComplete(u8_activeBms,millis());}
     #endif
     else ret=false;
   }
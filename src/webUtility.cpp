@@ -15,6 +15,7 @@
 #endif
 #include <fs/FileGuard.hpp>
 #include <WebServer.h>
+#include "WebAssets.hpp"
 
 namespace // anonymous namespace - methods, variables, and types in this namespace have file scope only
 {
@@ -54,23 +55,65 @@ auto getContentType(WebServer &server, const String &filename)
   }
   return "text/plain";
 }
+
+bool clientAcceptsGzip(WebServer &server)
+{
+  return webassets::acceptsGzip(server.header("Accept-Encoding").c_str());
+}
+
+/* Liefert true, wenn der Browser die aktuelle Version hat; dann wurde 304 gesendet */
+bool handleNotModified(WebServer &server, const char *etag)
+{
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Cache-Control", "no-cache"); // Immer mit dem ETag nachfragen (Update der Firmware)
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (webassets::etagMatches(server.header("If-None-Match").c_str(), etag))
+  {
+    server.send(304);
+    return true;
+  }
+  return false;
+}
 } // namespace anonymous
 
+void webUtilityCollectHeaders(WebServer &server)
+{
+  // Der WebServer speichert nur die hier angegebenen Header der Requests
+  static const char *headerKeys[] = {"Accept-Encoding", "If-None-Match"};
+  server.collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
+}
+
+void sendWebAsset(WebServer &server, const webassets::Asset &asset)
+{
+  if (handleNotModified(server, asset.etag)) return;
+
+  if (clientAcceptsGzip(server))
+  {
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, asset.contentType, reinterpret_cast<PGM_P>(asset.gz), asset.gzLen);
+  }
+  else
+  {
+    server.send_P(200, asset.contentType, asset.plain);
+  }
+}
+
 bool handleFileRead(fs::FS &fs, WebServer &server, [[maybe_unused]] bool fsIsSpiffs, const String &path)
 {
   const String basePath = (path.endsWith("/")) ? (path + "index.htm") : path;
-  [[maybe_unused]] const String pathWithGz = path + ".gz";
+  const String pathWithGz = basePath + ".gz";
+
+  // Vorkomprimierte Datei (scripts/prebuild_webassets.py); streamFile() setzt "Content-Encoding: gzip"
+  const bool useGz = clientAcceptsGzip(server) && !server.hasArg("download") && fs.exists(pathWithGz);
 
-  fs::FileGuard fileGuard(fs, basePath, "r"); // RAII: Dtor of the guard closes the file on scope exit (method return)
+  fs::FileGuard fileGuard(fs, useGz ? pathWithGz : basePath, "r"); // RAII: Dtor of the guard closes the file on scope exit (method return)
   if (fileGuard.isFile())
   {
-    // TODO MEJ: How shall we handle pathWithGz?
-    /*if (exists(fsIsSpiffs, pathWithGz))
-    {
-      path += ".gz";
-    }*/
+    char etag[24];
+    webassets::fileEtag(etag, sizeof(etag), fileGuard.getFile().size(), static_cast<uint32_t>(fileGuard.getFile().getLastWrite()));
+    if (handleNotModified(server, etag)) return true;
 
-    const String contentType {getContentType(server, fileGuard.getFile().name())};
+    const String contentType {getContentType(server, basePath)};
     server.streamFile(fileGuard.getFile(), contentType);
 
     return true;
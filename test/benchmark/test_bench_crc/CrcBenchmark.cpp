@@ -0,0 +1,97 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include <common/Benchmark.hpp>
+#include <OwScheduler.hpp>
+#include <utils/Crc.hpp>
+#include <crc.cpp>
+
+namespace test
+{
+
+class CrcBenchmark :
+  public ::testing::Test
+{
+  protected:
+  CrcBenchmark() {}
+  virtual ~CrcBenchmark() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    _data.resize(4096);
+    for (std::size_t i = 0; i < _data.size(); ++i) _data[i] = static_cast<uint8_t>(i * 31 + 7);
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  std::vector<uint8_t> _data;
+};
+
+/** Modbus CRC16 (serial BMS, I2C bulk frames): typical frame sizes */
+TEST_F(CrcBenchmark, Crc16)
+{
+  for (uint16_t len : {8, 64, 256, 1024})
+  {
+    const std::string name = "crc/crc16/" + std::to_string(len);
+    bench::run(name.c_str(), [&]() { bench::doNotOptimize(crc16(_data.data(), len)); }, len);
+  }
+}
+
+/** CRC32 (firmware update of the BPN) */
+TEST_F(CrcBenchmark, Crc32)
+{
+  for (uint32_t len : {256, 4096})
+  {
+    const std::string name = "crc/crc32/" + std::to_string(len);
+    bench::run(name.c_str(), [&]() { bench::doNotOptimize(calcCrc32(_data.data(), len)); }, len);
+  }
+}
+
+/** Strategies of utils/Crc.hpp (the firmware uses BSC_CRC_SLICES); 48 bytes: cell voltages of the plausibility check */
+TEST_F(CrcBenchmark, Strategies)
+{
+  for (std::size_t len : {48, 1024})
+  {
+    const std::string size = std::to_string(len);
+    bench::run(("crc/crc16_slice1/" + size).c_str(),
+      [&]() { bench::doNotOptimize(utils::Crc16Modbus::compute<1>(_data.data(), len)); }, len);
+    bench::run(("crc/crc16_slice4/" + size).c_str(),
+      [&]() { bench::doNotOptimize(utils::Crc16Modbus::compute<4>(_data.data(), len)); }, len);
+    bench::run(("crc/crc16_slice8/" + size).c_str(),
+      [&]() { bench::doNotOptimize(utils::Crc16Modbus::compute<8>(_data.data(), len)); }, len);
+  }
+
+  for (std::size_t len : {4096})
+  {
+    const std::string size = std::to_string(len);
+    bench::run(("crc/crc32_slice1/" + size).c_str(),
+      [&]() { bench::doNotOptimize(utils::Crc32Mpeg2::compute<1>(_data.data(), len)); }, len);
+    bench::run(("crc/crc32_slice4/" + size).c_str(),
+      [&]() { bench::doNotOptimize(utils::Crc32Mpeg2::compute<4>(_data.data(), len)); }, len);
+    bench::run(("crc/crc32_slice8/" + size).c_str(),
+      [&]() { bench::doNotOptimize(utils::Crc32Mpeg2::compute<8>(_data.data(), len)); }, len);
+  }
+}
+
+/** Dallas CRC8 of the OneWire scratchpad */
+TEST_F(CrcBenchmark, Crc8Dallas)
+{
+  bench::run("crc/crc8_dallas/8", [&]() { bench::doNotOptimize(owscheduler::crc8(_data.data(), 8)); }, 8);
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
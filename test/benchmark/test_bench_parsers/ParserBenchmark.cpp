@@ -0,0 +1,216 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include <common/Benchmark.hpp>
+#include <common/SerialBmsSimulator.hpp>
+#include <BscFakes.hpp>
+#include <I2cBulkFrame.hpp>
+#include <OwScheduler.hpp>
+
+// The modules under test are compiled together with the benchmark, see platformio.ini (-Isrc).
+// Every module has its own static TAG, so it is renamed while including the module.
+#define TAG TAG_BmsData
+#include <BmsData.cpp>
+#undef TAG
+#include <crc.cpp>
+#include <SerialRx.cpp>
+#include <devices/JbdBms.cpp>
+
+namespace test
+{
+
+using serialbms::test::SerialBmsSimulator;
+
+class ParserBenchmark :
+  public ::testing::Test
+{
+  protected:
+  ParserBenchmark() {}
+  virtual ~ParserBenchmark() {}
+
+  static constexpr uint8_t SERIAL_NR {0};
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    mocks::SimClock::reset(1000000);
+    mocks::FakeSettings::clear();
+    bmsDataInit();
+
+    _devData.u8_deviceNr = 0;
+    _devData.u8_NumberOfDevices = 1;
+    _devData.u8_BmsDataAdr = SERIAL_NR;
+    _devData.bo_sendMqttMsg = false;
+    _devData.bo_writeData = false;
+    _devData.rwDataLen = 0;
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static void callbackSetRxTxEn(uint8_t, uint8_t) {}
+
+  /** Builds a JBD answer frame: 0xDD, cmd, status, len, data, checksum, 0x77 */
+  static std::vector<uint8_t> makeJbdFrame(uint8_t cmd, const std::vector<uint8_t>& data)
+  {
+    std::vector<uint8_t> frame {0xDD, cmd, 0x00, static_cast<uint8_t>(data.size())};
+    frame.insert(frame.end(), data.begin(), data.end());
+
+    uint16_t sum = 0;
+    for (uint8_t b : data) sum += b;
+    const uint16_t checksum = (sum + data.size() - 1) ^ 0xFFFF;
+    frame.push_back(checksum >> 8);
+    frame.push_back(checksum & 0xFF);
+    frame.push_back(0x77);
+    return frame;
+  }
+
+  static void append16(std::vector<uint8_t>& data, uint16_t value)
+  {
+    data.push_back(value >> 8);
+    data.push_back(value & 0xFF);
+  }
+
+  /** Basic info and cell voltages of a 16s pack (same as in JbdBmsTest) */
+  static std::vector<uint8_t> jbdBasicInfoFrame()
+  {
+    std::vector<uint8_t> data;
+    for (uint16_t value : {5312, 500, 8700, 10000, 42, 0x2A21, 0x0001, 0x0000, 0x0000}) append16(data, value);
+    for (uint8_t value : {0x10, 87, 0x03, 16, 2}) data.push_back(value);
+    append16(data, 2731 + 250);
+    append16(data, 2731 + 265);
+    return makeJbdFrame(0x03, data);
+  }
+
+  static std::vector<uint8_t> jbdCellVoltageFrame()
+  {
+    std::vector<uint8_t> data;
+    for (uint16_t i = 0; i < 16; ++i) append16(data, 3300 + i);
+    return makeJbdFrame(0x04, data);
+  }
+
+  static BmsDataSnapshot makeSnapshot()
+  {
+    BmsDataSnapshot snapshot {};
+    for (std::size_t i = 0; i < BMSDATA_MAX_CELLS; ++i)
+      snapshot.cellVoltage[i] = static_cast<uint16_t>(3200 + i * 11);
+    snapshot.totalVoltage = 5312;
+    snapshot.totalCurrent = -15000;
+    snapshot.chargePercentage = 99;
+    snapshot.temperature[0] = 2512;
+    snapshot.errors = 0x80001234;
+    snapshot.stateFETs = 0x03;
+    return snapshot;
+  }
+
+  serialDevData_s _devData;
+};
+
+/**
+ * Host CPU time of one complete JBD poll (two requests, two answers) including the simulator. The simulated
+ * wire time is not part of the result, because the simulator advances the clock without waiting.
+*/
+TEST_F(ParserBenchmark, JbdBmsPoll)
+{
+  const std::vector<uint8_t> basicInfo = jbdBasicInfoFrame();
+  const std::vector<uint8_t> cellVoltages = jbdCellVoltageFrame();
+
+  bench::run("parser/jbdbms_poll/16s", [&]()
+  {
+    SerialBmsSimulator sim;
+    sim.addResponse(basicInfo);
+    sim.addResponse(cellVoltages);
+    bench::doNotOptimize(JbdBms_readBmsData(&sim, SERIAL_NR, &callbackSetRxTxEn, &_devData));
+  }, basicInfo.size() + cellVoltages.size());
+}
+
+/**
+ * Frame decoder of the serial BMS drivers: two JBD answers with line noise (incl. a false start byte) in front of
+ * each frame. Byte by byte as in the drivers and in chunks as read from the UART buffer.
+*/
+TEST_F(ParserBenchmark, FrameDecoder)
+{
+  std::vector<uint8_t> stream;
+  for (const std::vector<uint8_t>& frame : {jbdBasicInfoFrame(), jbdCellVoltageFrame()})
+  {
+    stream.insert(stream.end(), {0x00, 0xDD, 0x03, 0xFF, 0x13});
+    stream.insert(stream.end(), frame.begin(), frame.end());
+  }
+  uint8_t buf[JBDBMS_MAX_ANSWER_LEN];
+  utils::FrameDecoder decoder(jbdFrameFormat, buf, sizeof(buf));
+
+  bench::run("parser/framedecoder/jbd_bytewise", [&]()
+  {
+    uint8_t frames = 0;
+    for (uint8_t b : stream)
+    {
+      if (decoder.push(b) == utils::FrameDecoder::Status::Frame) ++frames;
+    }
+    while (decoder.flush() == utils::FrameDecoder::Status::Frame) ++frames;
+    bench::doNotOptimize(frames);
+  }, stream.size());
+  ASSERT_EQ(0u, decoder.statistics().checksumErrors);
+
+  bench::run("parser/framedecoder/jbd_chunk64", [&]()
+  {
+    uint8_t frames = 0;
+    for (std::size_t pos = 0; pos < stream.size();)
+    {
+      std::size_t consumed = 0;
+      if (decoder.feed(&stream[pos], std::min<std::size_t>(64, stream.size() - pos), consumed) == utils::FrameDecoder::Status::Frame) ++frames;
+      pos += consumed;
+    }
+    while (decoder.flush() == utils::FrameDecoder::Status::Frame) ++frames;
+    bench::doNotOptimize(frames);
+  }, stream.size());
+}
+
+/** Bulk frame of the I2C transfer to the display/extension (encode on the master, decode on the slave) */
+TEST_F(ParserBenchmark, I2cBulkFrame)
+{
+  const BmsDataSnapshot snapshot = makeSnapshot();
+  uint8_t frame[i2cbulk::BMS_FRAME_LEN];
+
+  bench::run("parser/i2cbulk_encode/bms", [&]()
+  {
+    bench::doNotOptimize(i2cbulk::encodeBms(snapshot, 3, 17, i2cbulk::FLAG_DATA_VALID, frame));
+  }, i2cbulk::BMS_FRAME_LEN);
+
+  i2cbulk::encodeBms(snapshot, 3, 17, i2cbulk::FLAG_DATA_VALID, frame);
+  i2cbulk::FrameHeader header;
+  BmsDataSnapshot decoded;
+  ASSERT_EQ(i2cbulk::DecodeResult::OK, i2cbulk::decodeBms(frame, sizeof(frame), header, decoded));
+
+  bench::run("parser/i2cbulk_decode/bms", [&]()
+  {
+    bench::doNotOptimize(i2cbulk::decodeBms(frame, sizeof(frame), header, decoded));
+  }, i2cbulk::BMS_FRAME_LEN);
+}
+
+/** OneWire scratchpad (CRC check and conversion) */
+TEST_F(ParserBenchmark, OneWireScratchPad)
+{
+  const uint8_t scratchPad[9] = {0x50, 0x05, 0x4B, 0x46, 0x7F, 0xFF, 0x0C, 0x10, 0x1C};
+  int16_t temp = 0;
+  ASSERT_EQ(owscheduler::ReadResult::OK, owscheduler::decodeScratchPad(0x28, scratchPad, temp));
+
+  bench::run("parser/ow_scratchpad/ds18b20", [&]()
+  {
+    bench::doNotOptimize(owscheduler::decodeScratchPad(0x28, scratchPad, temp));
+  }, sizeof(scratchPad));
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
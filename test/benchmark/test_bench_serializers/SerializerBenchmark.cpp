@@ -0,0 +1,113 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <common/Benchmark.hpp>
+#include <common/LegacyRestJson.hpp>
+#include <MqttPayload.hpp>
+#include <RestApiJson.hpp>
+#include <utils/JsonWriter.hpp>
+
+namespace test
+{
+
+class SerializerBenchmark :
+  public ::testing::Test
+{
+  protected:
+  SerializerBenchmark() {}
+  virtual ~SerializerBenchmark() {}
+
+  static constexpr uint8_t NUMBER_OF_BMS {11};
+  static constexpr uint8_t NUMBER_OF_CELLS {16};
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static BmsDataSnapshot makeSnapshot()
+  {
+    BmsDataSnapshot snapshot {};
+    for (std::size_t i = 0; i < BMSDATA_MAX_CELLS; ++i)
+      snapshot.cellVoltage[i] = i < NUMBER_OF_CELLS ? static_cast<uint16_t>(3300 + i) : 0xFFFF;
+    snapshot.totalVoltage = 5312;
+    snapshot.maxCellDifferenceVoltage = 15;
+    snapshot.totalCurrent = -15000;
+    snapshot.maxCellVoltage = 3315;
+    snapshot.minCellVoltage = 3300;
+    snapshot.isBalancingActive = 1;
+    snapshot.chargePercentage = 87;
+    snapshot.balancingCurrent = -42;
+    snapshot.temperature[0] = 2512;
+    snapshot.temperature[1] = 2650;
+    snapshot.errors = 0;
+    snapshot.stateFETs = 0x03;
+    return snapshot;
+  }
+};
+
+/** bms_serial array of the REST API (streamed in chunks of 512 bytes like in buildJsonRest()) */
+TEST_F(SerializerBenchmark, RestBmsSerial)
+{
+  const BmsDataSnapshot snapshot = makeSnapshot();
+  std::size_t bytes = 0;
+
+  const bench::Result result = bench::run("serializer/rest_bms_serial/11", [&]()
+  {
+    bytes = 0;
+    auto sink = [&bytes](const char*, std::size_t len) { bytes += len; };
+    utils::JsonWriter<512, decltype(sink)> json(sink);
+    json.beginArray("bms_serial");
+    for (uint8_t nr = 0; nr < NUMBER_OF_BMS; ++nr)
+      restapi::writeBmsEntry(json, snapshot, true, true, nr, 250, NUMBER_OF_CELLS, true);
+    json.endArray();
+    json.flush();
+  });
+  ASSERT_GT(bytes, 0u);
+  ASSERT_GT(result.nsPerOp, 0);
+}
+
+/** bms_serial array of the REST API built with String concatenation like before the JsonWriter (reference) */
+TEST_F(SerializerBenchmark, RestBmsSerialLegacy)
+{
+  const BmsDataSnapshot snapshot = makeSnapshot();
+  std::size_t bytes = 0;
+
+  const bench::Result result = bench::run("serializer/rest_bms_serial_legacy/11", [&]()
+  {
+    String out;
+    legacy::bmsSerialArray(snapshot, NUMBER_OF_BMS, NUMBER_OF_CELLS, out, false);
+    bytes = out.length();
+  });
+  ASSERT_GT(bytes, 0u);
+  ASSERT_GT(result.nsPerOp, 0);
+}
+
+/** JSON document of one BMS in the aggregated MQTT mode */
+TEST_F(SerializerBenchmark, MqttBmsData)
+{
+  const BmsDataSnapshot snapshot = makeSnapshot();
+  mqttpayload::Payload<1024> payload;
+
+  bench::run("serializer/mqtt_bms_data/16s", [&]()
+  {
+    mqttpayload::writeBmsData(payload, snapshot, true);
+    bench::doNotOptimize(payload.length());
+  });
+  ASSERT_FALSE(payload.overflow());
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
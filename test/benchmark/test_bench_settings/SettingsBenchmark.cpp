@@ -0,0 +1,106 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <mutex>
+#include <common/Benchmark.hpp>
+#include <params.h>
+#include <params_idx.h>
+#include <sparsepp/spp.h>
+#include <BscFakes.hpp>
+#include <Json.cpp>
+
+// The settings view is compiled together with the benchmark, see platformio.ini (-Isrc).
+#include <SettingsView.cpp>
+
+/**
+ * Lookup paths of the settings:
+ * - Reading a value: hash map + mutex (the storage of WebSettings::getInt()) and the settings view
+ *   (SettingsViewRef). The view is built by settingsViewRebuild() from the fake WebSettings (BscFakes.hpp).
+ * - Reading the definition of a parameter (default value): JSON scanner (Json::getValue()) and the
+ *   index generated by scripts/prebuild_parameter.py (params_idx.h, WebSettings::getIdxString()).
+*/
+
+namespace test
+{
+
+class SettingsBenchmark :
+  public ::testing::Test
+{
+  protected:
+  SettingsBenchmark() {}
+  virtual ~SettingsBenchmark() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+};
+
+TEST_F(SettingsBenchmark, ValueLookup)
+{
+  constexpr uint16_t NUMBER_OF_PARAMS {150};
+  constexpr uint8_t GROUPS {SERIAL_BMS_DEVICES_COUNT};
+
+  spp::sparse_hash_map<uint16_t, int16_t> settingValues;
+  std::mutex paramMutex;
+  for (uint16_t id = 0; id < NUMBER_OF_PARAMS; ++id)
+    for (uint8_t g = 0; g < GROUPS; ++g) settingValues[WebSettings::getParmId(id, g)] = static_cast<int16_t>(id + g);
+
+  for (uint8_t g = 0; g < GROUPS; ++g) mocks::FakeSettings::setInt(ID_PARAM_BATTERY_PACK_CHARGE_CURRENT, g, 100 + g);
+  settingsViewRebuild();
+
+  uint8_t group = 0;
+  bench::run("settings/hashmap_mutex/getInt", [&]()
+  {
+    std::lock_guard<std::mutex> lock(paramMutex);
+    bench::doNotOptimize(settingValues[WebSettings::getParmId(ID_PARAM_BATTERY_PACK_CHARGE_CURRENT, group)]);
+    group = (group + 1) % GROUPS;
+  });
+
+  bench::run("settings/view/field", [&]()
+  {
+    bench::doNotOptimize(SettingsViewRef()->packChargeCurrent[group]);
+    group = (group + 1) % GROUPS;
+  });
+
+  bench::run("settings/view/rebuild", []() { settingsViewRebuild(); });
+
+  EXPECT_EQ(100u + GROUPS - 1, SettingsViewRef()->packChargeCurrent[GROUPS - 1]);
+  mocks::FakeSettings::clear();
+}
+
+TEST_F(SettingsBenchmark, DefinitionLookup)
+{
+  // Last element of the page, so the scanner has to skip all other elements
+  Json json;
+  const uint16_t elementCount = json.getArraySize(paramSystem, 8);
+  ASSERT_GT(elementCount, 0);
+  const uint16_t element = elementCount - 1;
+
+  bench::run("settings/json_scan/label", [&]()
+  {
+    String value;
+    uint32_t arrayStart = 0;
+    bench::doNotOptimize(json.getValue(paramSystem, element, "label", 8, value, arrayStart));
+  });
+
+  bench::run("settings/index/label", [&]()
+  {
+    bench::doNotOptimize(WebSettings::getIdxString(paramSystem, paramSystemIdx.entries[element].label, ""));
+  });
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
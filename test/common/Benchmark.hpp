@@ -0,0 +1,138 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+/**
+ * @file
+ * Minimal benchmark runner for the native benchmark environment (pio test -e native_bench).
+ *
+ * A benchmark is a gtest test, which calls bench::run() for each measured operation:
+ * @code
+ *  TEST_F(CrcBenchmark, Crc16)
+ *  {
+ *    bench::run("crc/crc16/256", [&]() { bench::doNotOptimize(crc16(data, 256)); }, 256);
+ *  }
+ * @endcode
+ * The number of iterations is calibrated until one batch takes at least the minimum time. Then the batch is
+ * repeated and the median is reported, which is robust against single outliers (scheduler, frequency scaling).
+ *
+ * Every result is written as one JSON line with the prefix "BENCHMARK " to stdout and as property to the
+ * test report. If the environment variable BSC_BENCH_OUTPUT is set, the JSON lines are also appended to this
+ * file. Two files can be compared with scripts/benchmark_compare.py.
+ *
+ * BSC_BENCH_MIN_TIME_MS sets the minimum time of one batch (default 20 ms).
+*/
+
+namespace bench
+{
+
+constexpr uint32_t DEFAULT_MIN_TIME_MS {20};
+constexpr uint8_t REPETITIONS {5};
+
+struct Result
+{
+  std::string name;
+  uint64_t iterations;   //!< Iterations per batch
+  double nsPerOp;        //!< Median of the batches
+  double nsPerOpMin;
+  double nsPerOpMax;
+  std::size_t bytesPerOp;
+};
+
+/** @brief Prevents, that the compiler removes the calculation of a value, which is not used otherwise */
+template<typename T>
+inline void doNotOptimize(const T& value)
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline uint32_t minTimeMs()
+{
+  const char* env = std::getenv("BSC_BENCH_MIN_TIME_MS");
+  if (env == nullptr) return DEFAULT_MIN_TIME_MS;
+  const long value = std::strtol(env, nullptr, 10);
+  return value > 0 ? static_cast<uint32_t>(value) : DEFAULT_MIN_TIME_MS;
+}
+
+/** @brief Writes the result as JSON line */
+inline void report(const Result& result)
+{
+  char line[256];
+  const double mbPerS = (result.bytesPerOp > 0 && result.nsPerOp > 0) ? result.bytesPerOp * 1000.0 / result.nsPerOp : 0;
+  std::snprintf(line, sizeof(line),
+    "{\"name\":\"%s\",\"iterations\":%llu,\"ns_per_op\":%.2f,\"ns_per_op_min\":%.2f,\"ns_per_op_max\":%.2f,"
+    "\"bytes_per_op\":%zu,\"mb_per_s\":%.2f}",
+    result.name.c_str(), static_cast<unsigned long long>(result.iterations), result.nsPerOp, result.nsPerOpMin,
+    result.nsPerOpMax, result.bytesPerOp, mbPerS);
+
+  std::printf("BENCHMARK %s\n", line);
+  // The property is written as XML attribute by older gtest versions, so the name must not contain '/'
+  std::string property = result.name;
+  std::replace(property.begin(), property.end(), '/', '_');
+  ::testing::Test::RecordProperty(property + "_ns_per_op", std::to_string(result.nsPerOp));
+
+  const char* path = std::getenv("BSC_BENCH_OUTPUT");
+  if (path != nullptr && path[0] != 0)
+  {
+    FILE* file = std::fopen(path, "a");
+    if (file != nullptr)
+    {
+      std::fprintf(file, "%s\n", line);
+      std::fclose(file);
+    }
+  }
+}
+
+/**
+ * @brief Measures the time of one call of op and reports it.
+ * @param name Unique name of the benchmark ("<group>/<operation>/<parameter>").
+ * @param bytesPerOp Processed bytes per call for the throughput, or 0.
+*/
+template<typename OP>
+Result run(const char* name, OP&& op, std::size_t bytesPerOp = 0)
+{
+  using Clock = std::chrono::steady_clock;
+  auto batch = [&op](uint64_t iterations)
+  {
+    const auto start = Clock::now();
+    for (uint64_t i = 0; i < iterations; ++i) op();
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+  };
+
+  const double minTimeNs = minTimeMs() * 1e6;
+  uint64_t iterations = 1;
+  double timeNs = batch(iterations);
+  while (timeNs < minTimeNs && iterations < (1ULL << 40))
+  {
+    // Aim at the min. time, but grow at most by factor 10 per step
+    const double factor = timeNs > 0 ? std::min(10.0, minTimeNs * 1.2 / timeNs) : 10.0;
+    iterations = std::max(iterations + 1, static_cast<uint64_t>(iterations * factor));
+    timeNs = batch(iterations);
+  }
+
+  std::vector<double> samples;
+  for (uint8_t r = 0; r < REPETITIONS; ++r) samples.push_back(batch(iterations) / iterations);
+  std::sort(samples.begin(), samples.end());
+
+  Result result {name, iterations, samples[samples.size() / 2], samples.front(), samples.back(), bytesPerOp};
+  report(result);
+  return result;
+}
+
+} // namespace bench
+
+#endif // BENCHMARK_HPP
@@ -0,0 +1,112 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef LEGACYRESTJSON_H
+#define LEGACYRESTJSON_H
+
+#include <Arduino.h>
+#include <BmsData.h>
+
+/**
+ * The REST API document was built before with String concatenation (genJsonEntryArray()), which quoted every
+ * number. The functions below are a copy of this implementation and serve as reference for the schema
+ * (golden output) in test_restapi and for the comparison in test_bench_serializers.
+*/
+namespace legacy
+{
+
+enum genJsonTypes{arrStart,arrEnd,entrySingle,arrStart2,arrStart3,arrStart4,arrEnd2,entrySingle2};
+
+inline void genJsonEntrySingle(String key, String value, String &str_retStr)
+{
+  str_retStr += "\"";
+  str_retStr += String(key);
+  str_retStr += "\":\"";
+  str_retStr += value;
+  str_retStr += "\"";
+}
+
+inline void genJsonEntryArray(genJsonTypes type, String key, String value, String &str_retStr, bool lastEntry)
+{
+  switch(type)
+  {
+    case arrStart: str_retStr += "\""; str_retStr += String(key); str_retStr += "\":[{"; break;
+    case arrStart2: str_retStr += "\""; str_retStr += String(key); str_retStr += "\":["; break;
+    case arrStart3: str_retStr += "{"; if(!lastEntry)str_retStr += ","; break;
+    case arrStart4: str_retStr += "\""; str_retStr += String(key); str_retStr += "\":{"; break;
+    case entrySingle: genJsonEntrySingle(key, value, str_retStr); if(!lastEntry)str_retStr += ","; break;
+    case entrySingle2: str_retStr += value; if(!lastEntry)str_retStr += ","; break;
+    case arrEnd: str_retStr += "}"; if(!lastEntry)str_retStr += ","; str_retStr += "\n"; break;
+    case arrEnd2: str_retStr += "]"; if(!lastEntry)str_retStr += ","; str_retStr += "\n"; break;
+  }
+}
+
+inline void genJsonEntryArray(genJsonTypes type, String key, int32_t value, String &str_retStr, bool lastEntry)
+{
+  genJsonEntryArray(type, key, String(value), str_retStr, lastEntry);
+}
+
+/** One entry of bms_serial (without the leading "{", which was written by the previous entry) */
+inline void bmsSerialEntry(const BmsDataSnapshot& bmsSnapshot, bool en, bool valid, uint8_t nr, uint32_t cycleTime,
+  uint8_t u8_nrOfCells, String& str_htmlOut)
+{
+  genJsonEntryArray(entrySingle, "en", en, str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "valid", valid, str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "nr", nr, str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "cycleTime", cycleTime, str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "cells", u8_nrOfCells, str_htmlOut, false);
+
+  genJsonEntryArray(entrySingle, "totalVolt", String(bmsSnapshot.getTotalVoltage()), str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "totalCurr", String(bmsSnapshot.getTotalCurrent()), str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "soc", bmsSnapshot.chargePercentage, str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "maxZellDiff", bmsSnapshot.maxCellDifferenceVoltage, str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "maxCellVolt", bmsSnapshot.maxCellVoltage, str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "minCellVolt", bmsSnapshot.minCellVoltage, str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "maxCellVoltNr", bmsSnapshot.maxVoltageCellNumber, str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "minCellVoltNr", bmsSnapshot.minVoltageCellNumber, str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "balOn", bmsSnapshot.isBalancingActive, str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "FetState", bmsSnapshot.stateFETs, str_htmlOut, false);
+  genJsonEntryArray(entrySingle, "bmsErr", bmsSnapshot.errors, str_htmlOut, false);
+
+  genJsonEntryArray(arrStart2, "cell_voltage", "", str_htmlOut, false);
+  uint16_t u16_lZellVoltage=0;
+  for(uint8_t i=0;i<(u8_nrOfCells-1);i++)
+  {
+    u16_lZellVoltage = bmsSnapshot.cellVoltage[i];
+    if(u16_lZellVoltage==0xFFFF)u16_lZellVoltage=0;
+    genJsonEntryArray(entrySingle2, "", u16_lZellVoltage, str_htmlOut, false);
+  }
+  u16_lZellVoltage = bmsSnapshot.cellVoltage[u8_nrOfCells-1];
+  if(u16_lZellVoltage==0xFFFF)u16_lZellVoltage=0;
+  genJsonEntryArray(entrySingle2, "", u16_lZellVoltage, str_htmlOut, true);
+  genJsonEntryArray(arrEnd2, "", "", str_htmlOut, false);
+
+  genJsonEntryArray(arrStart2, "temperature", "", str_htmlOut, false);
+  genJsonEntryArray(entrySingle2, "", bmsSnapshot.getTempature(0), str_htmlOut, false);
+  genJsonEntryArray(entrySingle2, "", bmsSnapshot.getTempature(1), str_htmlOut, false);
+  genJsonEntryArray(entrySingle2, "", bmsSnapshot.getTempature(2), str_htmlOut, true);
+  genJsonEntryArray(arrEnd2, "", "", str_htmlOut, true);
+}
+
+/** The complete bms_serial array */
+inline void bmsSerialArray(const BmsDataSnapshot& bmsSnapshot, uint8_t count, uint8_t u8_nrOfCells, String& str_htmlOut, bool lastEntry)
+{
+  genJsonEntryArray(arrStart, "bms_serial", "", str_htmlOut, false);
+  for(uint8_t nr=0;nr<count;nr++)
+  {
+    bmsSerialEntry(bmsSnapshot, true, true, nr, 250, u8_nrOfCells, str_htmlOut);
+    if(nr<count-1)
+    {
+      genJsonEntryArray(arrEnd, "", "", str_htmlOut, false);
+      genJsonEntryArray(arrStart3, "", "", str_htmlOut, true);
+    }
+    else genJsonEntryArray(arrEnd, "", "", str_htmlOut, true);
+  }
+  genJsonEntryArray(arrEnd2, "", "", str_htmlOut, lastEntry);
+}
+
+} // namespace legacy
+
+#endif
@@ -0,0 +1,244 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef SERIALBMSSIMULATOR_H
+#define SERIALBMSSIMULATOR_H
+
+#include <Arduino.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <random>
+#include <vector>
+
+/**
+ * @file
+ * Scriptable serial BMS simulator for the native test environment.
+ *
+ * The SerialBmsSimulator is a Stream which can be passed to the readBms functions of the serial BMS drivers.
+ * Every time the driver finished a request (flush()), the next scripted response is scheduled on the
+ * simulated time base (see mocks::SimClock). The bytes of the response become available() at the time they
+ * would arrive on the wire. A FaultProfile adds response delay, jitter, byte splits, garbage and timeouts.
+ *
+ * Example:
+ * @code
+ *  serialbms::test::SerialBmsSimulator sim;
+ *  sim.addResponse(recordedFrame);                                   // clean answer
+ *  sim.addResponse(recordedFrame, {.garbage = {0x00, 0x13}});        // garbage before the frame
+ *  sim.addResponse({}, {.timeout = true});                           // no answer at all
+ *  JbdBms_readBmsData(&sim, 0, &callback, &devData);
+ * @endcode
+ *
+ * Drivers, which decide at runtime which requests they send, can be answered by a responder instead of a script.
+*/
+
+namespace serialbms
+{
+namespace test
+{
+
+/** Describes how a scripted response is delivered to the driver. */
+struct FaultProfile
+{
+  uint32_t responseDelayMs {5};      //!< Time between the end of the request and the first byte of the answer
+  uint32_t jitterMs {0};             //!< Random additional delay 0..jitterMs, applied to the answer and to every chunk gap
+  uint32_t byteTimeUs {1042};        //!< Wire time of one byte (1042us = 9600 baud 8N1)
+  std::size_t chunkSize {0};         //!< If > 0, the answer is split into chunks of this size ...
+  uint32_t chunkGapMs {0};           //!< ... with this pause between the chunks
+  std::vector<uint8_t> garbage {};   //!< Bytes sent in front of the answer
+  bool timeout {false};              //!< If true, the request is not answered
+};
+
+class SerialBmsSimulator : public Stream
+{
+  public:
+  /** Wire time of one byte for common baud rates */
+  static constexpr uint32_t BYTE_TIME_US_9600 {1042};
+  static constexpr uint32_t BYTE_TIME_US_19200 {521};
+  static constexpr uint32_t BYTE_TIME_US_115200 {87};
+
+  explicit SerialBmsSimulator(uint32_t seed = 1) : _random(seed) {}
+
+  /** Adds a response, which is sent after the next request of the driver (FIFO). */
+  void addResponse(const std::vector<uint8_t>& frame, const FaultProfile& profile = FaultProfile())
+  {
+    _responses.push_back({frame, profile});
+  }
+
+  /**
+   * Sets a responder, which builds the answer from the request. It is used, if there is no scripted response.
+   * An empty answer means, that the request is not answered.
+  */
+  void setResponder(std::function<std::vector<uint8_t>(const std::vector<uint8_t>&)> responder,
+                    const FaultProfile& profile = FaultProfile())
+  {
+    _responder = std::move(responder);
+    _responderProfile = profile;
+  }
+
+  /** Sends bytes without a request (e.g. for devices which send their data cyclically), starting at \a delayMs from now. */
+  void addUnsolicited(const std::vector<uint8_t>& bytes, uint32_t delayMs, const FaultProfile& profile = FaultProfile())
+  {
+    schedule(bytes, mocks::SimClock::nowUs() + (delayMs * 1000ULL), profile);
+  }
+
+  /** Returns random bytes, which can be used as garbage. Bytes contained in \a excluded are not used. */
+  std::vector<uint8_t> randomBytes(std::size_t count, const std::vector<uint8_t>& excluded = {})
+  {
+    std::vector<uint8_t> bytes;
+    std::uniform_int_distribution<int> dist(0, 255);
+    while (bytes.size() < count)
+    {
+      const uint8_t b = static_cast<uint8_t>(dist(_random));
+      if (std::find(excluded.begin(), excluded.end(), b) == excluded.end())
+        bytes.push_back(b);
+    }
+    return bytes;
+  }
+
+  /** Requests received from the driver, one entry per flush(). */
+  const std::vector<std::vector<uint8_t>>& getRequests() const { return _requests; }
+
+  /** Number of scripted responses not yet requested by the driver. */
+  std::size_t getPendingResponses() const { return _responses.size(); }
+
+  /** Number of scheduled bytes not yet read by the driver. */
+  std::size_t getUnreadBytes() const { return _rxBytes.size(); }
+
+  /** Simulated time in ms between the last request and the last byte of its answer. 0 on timeout. */
+  uint32_t getLastWireTimeMs() const { return _lastWireTimeMs; }
+
+  /** Discards all scheduled bytes, scripted responses and recorded requests. */
+  void reset()
+  {
+    _responses.clear();
+    _rxBytes.clear();
+    _requests.clear();
+    _currentRequest.clear();
+    _responder = nullptr;
+    _lastWireTimeMs = 0;
+  }
+
+  /* Stream */
+  int available() override
+  {
+    const uint64_t now = mocks::SimClock::nowUs();
+    int count = 0;
+    for (const auto& rxByte : _rxBytes)
+    {
+      if (rxByte.timeUs > now) break;
+      ++count;
+    }
+    return count;
+  }
+
+  int read() override
+  {
+    if (available() == 0) return -1;
+    const uint8_t b = _rxBytes.front().data;
+    _rxBytes.pop_front();
+    return b;
+  }
+
+  int peek() override
+  {
+    if (available() == 0) return -1;
+    return _rxBytes.front().data;
+  }
+
+  size_t write(uint8_t data) override
+  {
+    _currentRequest.push_back(data);
+    return 1;
+  }
+
+  size_t write(const uint8_t* buffer, size_t size) override
+  {
+    _currentRequest.insert(_currentRequest.end(), buffer, buffer + size);
+    return size;
+  }
+
+  /** End of request: the next scripted response is scheduled. */
+  void flush() override
+  {
+    if (_currentRequest.empty()) return;
+    _requests.push_back(_currentRequest);
+    _currentRequest.clear();
+
+    Response response;
+    if (!_responses.empty())
+    {
+      response = _responses.front();
+      _responses.pop_front();
+    }
+    else if (_responder)
+    {
+      response = {_responder(_requests.back()), _responderProfile};
+      if (response.frame.empty()) response.profile.timeout = true;
+    }
+    else return; // Not scripted: The device does not answer
+
+    _lastWireTimeMs = 0;
+    if (response.profile.timeout) return;
+
+    const uint64_t startUs = mocks::SimClock::nowUs() + (response.profile.responseDelayMs + jitterMs(response.profile)) * 1000ULL;
+    std::vector<uint8_t> bytes(response.profile.garbage);
+    bytes.insert(bytes.end(), response.frame.begin(), response.frame.end());
+    const uint64_t endUs = schedule(bytes, startUs, response.profile);
+    _lastWireTimeMs = static_cast<uint32_t>((endUs - mocks::SimClock::nowUs()) / 1000);
+  }
+
+  private:
+  struct Response
+  {
+    std::vector<uint8_t> frame;
+    FaultProfile profile;
+  };
+
+  struct RxByte
+  {
+    uint64_t timeUs;
+    uint8_t data;
+  };
+
+  uint32_t jitterMs(const FaultProfile& profile)
+  {
+    if (profile.jitterMs == 0) return 0;
+    std::uniform_int_distribution<uint32_t> dist(0, profile.jitterMs);
+    return dist(_random);
+  }
+
+  /** Schedules the bytes on the wire, returns the arrival time of the last byte. */
+  uint64_t schedule(const std::vector<uint8_t>& bytes, uint64_t startUs, const FaultProfile& profile)
+  {
+    // Bytes can not overtake bytes, which are already on the wire
+    uint64_t timeUs = _rxBytes.empty() ? startUs : std::max(startUs, _rxBytes.back().timeUs);
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+    {
+      if (profile.chunkSize > 0 && i > 0 && (i % profile.chunkSize) == 0)
+        timeUs += (profile.chunkGapMs + jitterMs(profile)) * 1000ULL;
+
+      timeUs += profile.byteTimeUs;
+      _rxBytes.push_back({timeUs, bytes[i]});
+    }
+    return timeUs;
+  }
+
+  std::mt19937 _random;
+  std::deque<Response> _responses;
+  std::function<std::vector<uint8_t>(const std::vector<uint8_t>&)> _responder {};
+  FaultProfile _responderProfile {};
+  std::deque<RxByte> _rxBytes;
+  std::vector<std::vector<uint8_t>> _requests;
+  std::vector<uint8_t> _currentRequest;
+  uint32_t _lastWireTimeMs {0};
+};
+
+} // namespace test
+} // namespace serialbms
+
+#endif // SERIALBMSSIMULATOR_H
@@ -0,0 +1,366 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <map>
+#include <common/SerialBmsSimulator.hpp>
+#include <BscFakes.hpp>
+
+// The modules under test are compiled together with the test, see platformio.ini (-Isrc).
+// Every module has its own static TAG, so it is renamed while including the module.
+#define TAG TAG_BmsData
+#include <BmsData.cpp>
+#undef TAG
+#include <SerialRx.cpp>
+#include <devices/DalyBms.cpp>
+
+namespace dalybms
+{
+namespace test
+{
+
+using serialbms::test::FaultProfile;
+using serialbms::test::SerialBmsSimulator;
+
+/** Simulated Daly BMS, answers every request with the frames of its current values. */
+struct DalyDevice
+{
+  std::vector<uint16_t> cells {3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3311, 3312, 3313, 3314};
+  std::vector<int8_t> temperatures {25, 27};
+  uint16_t totalVoltage {462};   // 0.1V
+  uint16_t current {30050};      // 0.1A, offset 30000
+  uint16_t soc {875};            // 0.1%
+  bool balancing {true};
+  uint8_t failure {0x00};        // Byte 0 of the failure frame
+  std::map<uint8_t, bool> silent {};  // Requests which are not answered
+  std::map<uint8_t, uint32_t> requestCount {};
+
+  static std::vector<uint8_t> makeFrame(uint8_t cmd, const std::vector<uint8_t>& data)
+  {
+    std::vector<uint8_t> frame {DALAY_START_BYTE, 0x01, cmd, 0x08};
+    frame.insert(frame.end(), data.begin(), data.end());
+    frame.resize(DALY_FRAME_SIZE - 1, 0x00);
+
+    uint8_t sum = 0;
+    for (uint8_t b : frame) sum += b;
+    frame.push_back(sum);
+    return frame;
+  }
+
+  std::vector<uint8_t> answer(const std::vector<uint8_t>& request)
+  {
+    if (request.size() != DALY_FRAME_SIZE || request[0] != DALAY_START_BYTE) return {};
+    const uint8_t cmd = request[2];
+    requestCount[cmd]++;
+    if (silent[cmd]) return {};
+
+    const uint16_t maxCell = *std::max_element(cells.begin(), cells.end());
+    const uint16_t minCell = *std::min_element(cells.begin(), cells.end());
+    std::vector<uint8_t> frames;
+    auto add = [&frames](const std::vector<uint8_t>& frame) { frames.insert(frames.end(), frame.begin(), frame.end()); };
+
+    switch (cmd)
+    {
+      case DALY_REQUEST_BATTERY_SOC:
+        add(makeFrame(cmd, {hi(totalVoltage), lo(totalVoltage), 0, 0, hi(current), lo(current), hi(soc), lo(soc)}));
+        break;
+      case DALY_REQUEST_MIN_MAX_VOLTAGE:
+        add(makeFrame(cmd, {hi(maxCell), lo(maxCell), 14, hi(minCell), lo(minCell), 1}));
+        break;
+      case DALY_REQUEST_MOS:
+        add(makeFrame(cmd, {0x01, 0x01, 0x01}));
+        break;
+      case DALY_REQUEST_STATUS:
+        add(makeFrame(cmd, {static_cast<uint8_t>(cells.size()), static_cast<uint8_t>(temperatures.size())}));
+        break;
+      case DALY_REQUEST_CELL_VOLTAGE:
+        for (std::size_t n = 0; n * 3 < cells.size(); ++n)
+        {
+          std::vector<uint8_t> data {static_cast<uint8_t>(n + 1)};
+          for (std::size_t i = n * 3; i < n * 3 + 3; ++i)
+          {
+            const uint16_t cell = (i < cells.size()) ? cells[i] : 0;
+            data.push_back(hi(cell));
+            data.push_back(lo(cell));
+          }
+          add(makeFrame(cmd, data));
+        }
+        break;
+      case DALY_REQUEST_TEMPERATURE:
+      {
+        std::vector<uint8_t> data {0x01};
+        for (int8_t t : temperatures) data.push_back(static_cast<uint8_t>(t + DALY_TEMPERATURE_OFFSET));
+        add(makeFrame(cmd, data));
+        break;
+      }
+      case DALY_REQUEST_BALLANCER:
+        add(makeFrame(cmd, {static_cast<uint8_t>(balancing ? 0x04 : 0x00)}));
+        break;
+      case DALY_REQUEST_FAILURE:
+        add(makeFrame(cmd, {failure}));
+        break;
+      default:
+        break;
+    }
+    return frames;
+  }
+
+  static uint8_t hi(uint16_t value) { return static_cast<uint8_t>(value >> 8); }
+  static uint8_t lo(uint16_t value) { return static_cast<uint8_t>(value & 0xFF); }
+};
+
+class DalyBmsTest :
+  public ::testing::Test
+{
+  protected:
+  DalyBmsTest() {}
+  virtual ~DalyBmsTest() {}
+
+  static constexpr uint32_t RECV_TIMEOUT_MS {200};
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    mocks::SimClock::reset(1000000);
+    mocks::FakeSettings::clear();
+    bmsDataInit();
+    serialRxInit();
+
+    // The driver keeps its schedule per serial device, so every test uses its own device
+    _serialNr = _nextSerialNr++;
+    _devData.u8_deviceNr = _serialNr;
+    _devData.u8_NumberOfDevices = 1;
+    _devData.u8_BmsDataAdr = _serialNr;
+    _devData.bo_sendMqttMsg = true;
+    _devData.bo_writeData = false;
+    _devData.rwDataLen = 0;
+
+    _sim.setResponder([this](const std::vector<uint8_t>& request) { return _device.answer(request); });
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static void callbackSetRxTxEn(uint8_t, uint8_t) {}
+
+  bool readBms()
+  {
+    return DalyBms_readBmsData(&_sim, _serialNr, &callbackSetRxTxEn, &_devData);
+  }
+
+  /** Duration of one poll cycle in ms (simulated time) */
+  uint32_t pollCycleMs(bool* result = nullptr)
+  {
+    const uint64_t startUs = mocks::SimClock::nowUs();
+    const bool ret = readBms();
+    if (result != nullptr) *result = ret;
+    return static_cast<uint32_t>((mocks::SimClock::nowUs() - startUs) / 1000);
+  }
+
+  uint8_t bmsDataNr() const { return BT_DEVICES_COUNT + _serialNr; }
+
+  static inline uint8_t _nextSerialNr {0};
+  uint8_t _serialNr {0};
+  serialDevData_s _devData {};
+  DalyDevice _device;
+  SerialBmsSimulator _sim;
+};
+
+TEST_F(DalyBmsTest, FirstCycle_AllFieldsUpdated)
+{
+  _device.failure = 0x01; // Cell volt high level 1
+
+  ASSERT_TRUE(readBms());
+  EXPECT_EQ(8u, _sim.getRequests().size());
+
+  const uint8_t nr = bmsDataNr();
+  EXPECT_FLOAT_EQ(46.2f, getBmsTotalVoltage(nr));
+  EXPECT_FLOAT_EQ(5.0f, getBmsTotalCurrent(nr));
+  EXPECT_EQ(87, getBmsChargePercentage(nr));
+  EXPECT_EQ(3314, getBmsMaxCellVoltage(nr));
+  EXPECT_EQ(14, getBmsMaxVoltageCellNumber(nr));
+  EXPECT_EQ(3301, getBmsMinCellVoltage(nr));
+  EXPECT_EQ(1, getBmsMinVoltageCellNumber(nr));
+  EXPECT_EQ(13, getBmsMaxCellDifferenceVoltage(nr));
+  EXPECT_TRUE(getBmsStateFETsCharge(nr));
+  EXPECT_TRUE(getBmsStateFETsDischarge(nr));
+  for (uint8_t i = 0; i < _device.cells.size(); ++i) EXPECT_EQ(_device.cells[i], getBmsCellVoltage(nr, i)) << "Cell " << +i;
+  EXPECT_EQ(3307, getBmsAvgVoltage(nr));
+  EXPECT_FLOAT_EQ(25.0f, getBmsTempature(nr, 0));
+  EXPECT_FLOAT_EQ(27.0f, getBmsTempature(nr, 1));
+  EXPECT_EQ(1, getBmsIsBalancingActive(nr));
+  EXPECT_EQ(1u, getBmsErrors(nr));
+}
+
+TEST_F(DalyBmsTest, SlowGroups_PolledEveryNCycles)
+{
+  constexpr uint32_t cycles = DALY_SLOW_REQUEST_CYCLES * 3;
+  for (uint32_t i = 0; i < cycles; ++i) ASSERT_TRUE(readBms()) << "Cycle " << i;
+
+  for (uint8_t cmd : {DALY_REQUEST_BATTERY_SOC, DALY_REQUEST_MIN_MAX_VOLTAGE, DALY_REQUEST_MOS, DALY_REQUEST_CELL_VOLTAGE,
+                      DALY_REQUEST_TEMPERATURE})
+  {
+    EXPECT_EQ(cycles, _device.requestCount[cmd]) << "Request " << std::hex << +cmd;
+  }
+  for (uint8_t cmd : {DALY_REQUEST_STATUS, DALY_REQUEST_BALLANCER, DALY_REQUEST_FAILURE})
+  {
+    EXPECT_EQ(3u, _device.requestCount[cmd]) << "Request " << std::hex << +cmd;
+  }
+  EXPECT_EQ(0u, _device.requestCount[DALY_REQUEST_MIN_MAX_TEMPERATURE]);
+}
+
+TEST_F(DalyBmsTest, AllFieldsFollowTheDevice)
+{
+  ASSERT_TRUE(readBms());
+
+  // All values of the device change, after one period of the slow groups every field is updated
+  _device.cells.assign(_device.cells.size(), 3200);
+  _device.cells[5] = 3250;
+  _device.temperatures = {-5, 40};
+  _device.totalVoltage = 448;
+  _device.current = 29900;
+  _device.soc = 500;
+  _device.balancing = false;
+
+  for (uint32_t i = 0; i < DALY_SLOW_REQUEST_CYCLES; ++i) ASSERT_TRUE(readBms());
+
+  const uint8_t nr = bmsDataNr();
+  EXPECT_FLOAT_EQ(44.8f, getBmsTotalVoltage(nr));
+  EXPECT_FLOAT_EQ(-10.0f, getBmsTotalCurrent(nr));
+  EXPECT_EQ(50, getBmsChargePercentage(nr));
+  EXPECT_EQ(3250, getBmsMaxCellVoltage(nr));
+  EXPECT_EQ(3200, getBmsMinCellVoltage(nr));
+  EXPECT_EQ(3250, getBmsCellVoltage(nr, 5));
+  EXPECT_EQ(3200, getBmsCellVoltage(nr, 13));
+  EXPECT_FLOAT_EQ(-5.0f, getBmsTempature(nr, 0));
+  EXPECT_FLOAT_EQ(40.0f, getBmsTempature(nr, 1));
+  EXPECT_EQ(0, getBmsIsBalancingActive(nr));
+}
+
+TEST_F(DalyBmsTest, ActiveErrors_FailurePolledEveryCycle)
+{
+  _device.failure = 0x04; // Cell volt low level 1
+  ASSERT_TRUE(readBms());
+  ASSERT_EQ(2u, getBmsErrors(bmsDataNr()));
+
+  // Error gone: it is detected in the next cycle and not only with the next slow cycle
+  _device.failure = 0x00;
+  ASSERT_TRUE(readBms());
+  EXPECT_EQ(2u, _device.requestCount[DALY_REQUEST_FAILURE]);
+  EXPECT_EQ(0u, getBmsErrors(bmsDataNr()));
+
+  ASSERT_TRUE(readBms());
+  EXPECT_EQ(2u, _device.requestCount[DALY_REQUEST_FAILURE]);
+}
+
+TEST_F(DalyBmsTest, SlowGroupFailed_RetriedInNextCycle)
+{
+  _device.silent[DALY_REQUEST_BALLANCER] = true;
+  ASSERT_FALSE(readBms());
+  EXPECT_EQ(1u, _device.requestCount[DALY_REQUEST_BALLANCER]);
+
+  _device.silent[DALY_REQUEST_BALLANCER] = false;
+  ASSERT_TRUE(readBms());
+  EXPECT_EQ(2u, _device.requestCount[DALY_REQUEST_BALLANCER]);
+  EXPECT_EQ(1, getBmsIsBalancingActive(bmsDataNr()));
+
+  ASSERT_TRUE(readBms());
+  EXPECT_EQ(2u, _device.requestCount[DALY_REQUEST_BALLANCER]);
+}
+
+TEST_F(DalyBmsTest, StatusMissing_NoCellVoltageRequest)
+{
+  // Without the number of cells the length of the cell voltage answer is unknown
+  _device.silent[DALY_REQUEST_STATUS] = true;
+  ASSERT_FALSE(readBms());
+  EXPECT_EQ(0u, _device.requestCount[DALY_REQUEST_CELL_VOLTAGE]);
+  EXPECT_EQ(1u, _device.requestCount[DALY_REQUEST_TEMPERATURE]);
+
+  _device.silent[DALY_REQUEST_STATUS] = false;
+  ASSERT_TRUE(readBms());
+  EXPECT_EQ(2u, _device.requestCount[DALY_REQUEST_STATUS]);
+  EXPECT_EQ(_device.cells[13], getBmsCellVoltage(bmsDataNr(), 13));
+}
+
+TEST_F(DalyBmsTest, FastDevice_ShorterPollCycle)
+{
+  // The fixed pause of 20ms between the requests is replaced by the measured response latency of the device
+  FaultProfile profile;
+  profile.responseDelayMs = 3;
+  _sim.setResponder([this](const std::vector<uint8_t>& request) { return _device.answer(request); }, profile);
+
+  bool ok = false;
+  const uint32_t firstCycleMs = pollCycleMs(&ok);
+  ASSERT_TRUE(ok);
+
+  uint32_t fastCycleMs = 0;
+  for (uint32_t i = 1; i < DALY_SLOW_REQUEST_CYCLES; ++i)
+  {
+    fastCycleMs = pollCycleMs(&ok);
+    ASSERT_TRUE(ok);
+  }
+  const uint32_t slowCycleMs = pollCycleMs(&ok);
+  ASSERT_TRUE(ok);
+
+  // Previous implementation: 8 answers (14 frames) plus 7 pauses of 20ms
+  const uint32_t answersMs = (14 * DALY_FRAME_SIZE * profile.byteTimeUs) / 1000 + 8 * profile.responseDelayMs;
+  EXPECT_LT(firstCycleMs, answersMs + 7 * DALY_SEND_DELAY_MAX);
+  EXPECT_LT(slowCycleMs, answersMs + 7 * 5);
+  EXPECT_LT(slowCycleMs, firstCycleMs);
+  EXPECT_LT(fastCycleMs, slowCycleMs); // Status, balancer and failure are skipped
+}
+
+TEST_F(DalyBmsTest, SlowDevice_PauseFollowsLatency)
+{
+  // A device with a long latency keeps the max. pause
+  FaultProfile profile;
+  profile.responseDelayMs = 30;
+  _sim.setResponder([this](const std::vector<uint8_t>& request) { return _device.answer(request); }, profile);
+
+  ASSERT_TRUE(readBms());
+  ASSERT_TRUE(readBms());
+  EXPECT_EQ(DALY_SEND_DELAY_MAX, u8_mSendDelay[_serialNr]);
+}
+
+TEST_F(DalyBmsTest, NoAnswer_CycleAbortedAfterMaxTimeouts)
+{
+  _sim.setResponder([](const std::vector<uint8_t>&) { return std::vector<uint8_t>(); });
+
+  bool ok = true;
+  const uint32_t cycleMs = pollCycleMs(&ok);
+  EXPECT_FALSE(ok);
+  EXPECT_EQ(DALY_MAX_TIMEOUTS, _sim.getRequests().size());
+  EXPECT_LT(cycleMs, DALY_MAX_TIMEOUTS * (RECV_TIMEOUT_MS + DALY_SEND_DELAY_MAX + 5));
+
+  commstats::Statistics stats;
+  serialRxGetCommStatistics(_serialNr, stats);
+  EXPECT_EQ(DALY_MAX_TIMEOUTS, stats.timeouts);
+}
+
+TEST_F(DalyBmsTest, ChecksumError_NotCountedAsTimeout)
+{
+  // Broken frames do not abort the cycle
+  FaultProfile profile;
+  _sim.setResponder([this](const std::vector<uint8_t>& request)
+  {
+    std::vector<uint8_t> frames = _device.answer(request);
+    if (request[2] != DALY_REQUEST_STATUS && !frames.empty()) frames.back() ^= 0xFF;
+    return frames;
+  }, profile);
+
+  ASSERT_FALSE(readBms());
+  EXPECT_EQ(8u, _sim.getRequests().size());
+}
+
+} // namespace test
+} // namespace dalybms
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
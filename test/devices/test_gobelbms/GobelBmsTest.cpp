@@ -0,0 +1,305 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <common/SerialBmsSimulator.hpp>
+#include <BscFakes.hpp>
+
+// The modules under test are compiled together with the test, see platformio.ini (-Isrc).
+// Every module has its own static TAG, so it is renamed while including the module.
+#define TAG TAG_BmsData
+#include <BmsData.cpp>
+#undef TAG
+#include <SerialRx.cpp>
+#include <devices/GobelBms.cpp>
+
+namespace gobelbms
+{
+namespace test
+{
+
+using serialbms::test::FaultProfile;
+using serialbms::test::SerialBmsSimulator;
+
+class GobelBmsTest :
+  public ::testing::Test
+{
+  protected:
+  GobelBmsTest() {}
+  virtual ~GobelBmsTest() {}
+
+  static constexpr uint8_t SERIAL_NR {0};
+  static constexpr uint8_t BMS_DATA_NR {BT_DEVICES_COUNT + SERIAL_NR};
+  static constexpr uint8_t START_BYTE {0x37};
+  static constexpr uint8_t CID2_DATA {0xB0};
+  static constexpr uint8_t CID2_WARN {0xB1};
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    mocks::SimClock::reset(1000000);
+    mocks::FakeSettings::clear();
+    bmsDataInit();
+    serialRxInit();
+
+    _devData.u8_deviceNr = 0;
+    _devData.u8_NumberOfDevices = 1;
+    _devData.u8_BmsDataAdr = SERIAL_NR;
+    _devData.bo_sendMqttMsg = true;
+    _devData.bo_writeData = false;
+    _devData.rwDataLen = 0;
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static void callbackSetRxTxEn(uint8_t, uint8_t) {}
+
+  bool readBms(SerialBmsSimulator& sim)
+  {
+    return GobelBms_readBmsData(&sim, SERIAL_NR, &callbackSetRxTxEn, &_devData);
+  }
+
+  static void append16(std::vector<uint8_t>& data, uint16_t value)
+  {
+    data.push_back(value >> 8);
+    data.push_back(value & 0xFF);
+  }
+
+  static void append32(std::vector<uint8_t>& data, uint32_t value)
+  {
+    append16(data, value >> 16);
+    append16(data, value & 0xFFFF);
+  }
+
+  /** Builds an answer frame: 0x37 0x45, VER, ADR, CID1, RTN, LCHKSUM + length (12 bit), info, checksum, 0x0D */
+  static std::vector<uint8_t> makeFrame(const std::vector<uint8_t>& info, uint8_t address = 0)
+  {
+    const uint16_t len = info.size();
+    const uint16_t lchksum = (~(((len & 0xF) + ((len >> 4) & 0xF) + ((len >> 8) & 0xF)) % 16) + 1) & 0xF;
+    std::vector<uint8_t> frame {START_BYTE, 0x45, 0x11, address, 0x46, 0x00};
+    append16(frame, (lchksum << 12) | len);
+    frame.insert(frame.end(), info.begin(), info.end());
+
+    uint16_t sum = 0;
+    for (std::size_t i = 2; i < frame.size(); ++i) sum += frame[i];
+    append16(frame, ~sum + 1);
+    frame.push_back(0x0D);
+    return frame;
+  }
+
+  /** Recorded analog data of one pack: 16 cells 3300mV + cellNr, -14.39A, 53.12V, 47% */
+  static std::vector<uint8_t> dataFrame(uint8_t address = 0)
+  {
+    std::vector<uint8_t> info {CID2_DATA, 0x00, 0xC5, 0x5C};
+    info.push_back(1);                            // Total pack number
+    info.push_back(address);                      // Pack address
+    append16(info, static_cast<uint16_t>(-1439)); // Current, 10mA
+    append32(info, 53120);                        // Voltage, mV
+    append16(info, 13659);                        // Remaining capacity, 10mAh
+    info.push_back(0x05);
+    append16(info, 29000);                        // Total capacity, 10mAh
+    append16(info, 28000);                        // Design capacity, 10mAh
+    append16(info, 3);                            // Cycles
+    info.push_back(47);                           // SoC, %
+    info.push_back(100);                          // SoH, %
+    info.push_back(1);                            // Parallel number
+    info.push_back(0);                            // Slave address
+    info.push_back(16);                           // Number of cells
+    for (uint16_t i = 0; i < 16; ++i) append16(info, 3300 + i);
+    info.push_back(4);                            // Cell NTCs
+    append16(info, 2731 + 250);                   // 0.1K
+    append16(info, 2731 + 265);
+    append16(info, 2731 + 240);
+    append16(info, 2731 + 245);
+    info.push_back(1);                            // MOS NTCs
+    append16(info, 2731 + 300);
+    info.push_back(1);                            // Ambient NTCs
+    append16(info, 2731 + 220);
+    append32(info, 0x48D4F2A5);                   // CRC32
+    return makeFrame(info, address);
+  }
+
+  /** Recorded warnings of one pack, cellWarning is set for the first cell */
+  static std::vector<uint8_t> warnFrame(uint8_t cellWarning = 0x00, uint8_t address = 0)
+  {
+    std::vector<uint8_t> info {CID2_WARN, 0x00, 0xC5, 0x5C};
+    info.push_back(1);                            // Total pack number
+    info.push_back(address);                      // Pack address
+    info.push_back(16);                           // Number of cells
+    info.push_back(cellWarning);
+    info.insert(info.end(), 15, 0x00);            // Cell warnings
+    info.push_back(4);                            // Cell NTCs
+    info.insert(info.end(), 4, 0x00);
+    info.push_back(1);                            // Ambient NTCs
+    info.push_back(0x00);
+    info.push_back(1);                            // MOS NTCs
+    info.push_back(0x00);
+    info.push_back(0x00);                         // Charge current warning
+    info.push_back(0x00);                         // Pack voltage warning
+    info.push_back(0x00);                         // Discharge current warning
+    for (uint8_t i = 0; i < 7; ++i) append32(info, 0); // State codes
+    for (uint8_t i = 0; i < 3; ++i) append16(info, 0); // BMS&Inverter state code, max charge/discharge current
+    append32(info, 0x12345678);                   // CRC32
+    return makeFrame(info, address);
+  }
+
+  static void verifyData(uint8_t bmsDataNr = BMS_DATA_NR)
+  {
+    for (uint8_t i = 0; i < 16; ++i)
+      ASSERT_EQ(3300 + i, getBmsCellVoltage(bmsDataNr, i)) << "Failed cell: " << static_cast<int>(i);
+
+    ASSERT_EQ(3315, getBmsMaxCellVoltage(bmsDataNr));
+    ASSERT_EQ(3300, getBmsMinCellVoltage(bmsDataNr));
+    ASSERT_EQ(15, getBmsMaxVoltageCellNumber(bmsDataNr));
+    ASSERT_EQ(0, getBmsMinVoltageCellNumber(bmsDataNr));
+    ASSERT_EQ(15, getBmsMaxCellDifferenceVoltage(bmsDataNr));
+    ASSERT_EQ(3307, getBmsAvgVoltage(bmsDataNr));
+
+    ASSERT_NEAR(25.0f, getBmsTempature(bmsDataNr, 0), 0.01f);
+    ASSERT_NEAR(26.5f, getBmsTempature(bmsDataNr, 1), 0.01f);
+    ASSERT_NEAR(24.0f, getBmsTempature(bmsDataNr, 2), 0.01f);
+    ASSERT_FLOAT_EQ(-14.39f, getBmsTotalCurrent(bmsDataNr));
+    ASSERT_FLOAT_EQ(53.12f, getBmsTotalVoltage(bmsDataNr));
+    ASSERT_EQ(47, getBmsChargePercentage(bmsDataNr));
+  }
+
+  serialDevData_s _devData;
+};
+
+TEST_F(GobelBmsTest, CleanResponses_AllValuesUpdated)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(dataFrame());
+  sim.addResponse(warnFrame());
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(2u, sim.getRequests().size());
+  ASSERT_EQ(0x00, sim.getRequests()[0][3]); // Address of a single pack
+  ASSERT_EQ(CID2_DATA, sim.getRequests()[0][5]);
+  ASSERT_EQ(CID2_WARN, sim.getRequests()[1][5]);
+  ASSERT_EQ(0u, sim.getUnreadBytes());
+
+  verifyData();
+  ASSERT_EQ(0u, getBmsErrors(BMS_DATA_NR));
+  ASSERT_NE(0u, getBmsLastDataMillis(BMS_DATA_NR));
+}
+
+TEST_F(GobelBmsTest, ByteSplitsAndJitter_AllValuesUpdated)
+{
+  FaultProfile profile;
+  profile.jitterMs = 8;
+  profile.chunkSize = 3;
+  profile.chunkGapMs = 4;
+
+  for (uint32_t seed = 1; seed <= 20; ++seed)
+  {
+    SerialBmsSimulator sim(seed);
+    sim.addResponse(dataFrame(), profile);
+    sim.addResponse(warnFrame(), profile);
+
+    ASSERT_TRUE(readBms(sim)) << "Failed seed: " << seed;
+    verifyData();
+  }
+}
+
+TEST_F(GobelBmsTest, GarbageBeforeFrame_FrameIsFound)
+{
+  SerialBmsSimulator sim;
+  FaultProfile profile;
+  profile.garbage = sim.randomBytes(20, {START_BYTE}); // The driver resyncs on the start byte only
+
+  sim.addResponse(dataFrame(), profile);
+  sim.addResponse(warnFrame(), profile);
+
+  ASSERT_TRUE(readBms(sim));
+  verifyData();
+}
+
+TEST_F(GobelBmsTest, Warnings_ErrorsUpdated)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(dataFrame());
+  sim.addResponse(warnFrame(0x02)); // Cell voltage above the upper limit
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(BMS_ERR_STATUS_CELL_OVP, getBmsErrors(BMS_DATA_NR));
+}
+
+TEST_F(GobelBmsTest, MultiplePacks_EveryPackIsRead)
+{
+  _devData.u8_NumberOfDevices = 2;
+
+  SerialBmsSimulator sim;
+  sim.addResponse(dataFrame(1));
+  sim.addResponse(warnFrame(0x00, 1));
+  sim.addResponse(dataFrame(2));
+  sim.addResponse(warnFrame(0x00, 2));
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(4u, sim.getRequests().size());
+  ASSERT_EQ(1, sim.getRequests()[0][3]);
+  ASSERT_EQ(1, sim.getRequests()[1][3]);
+  ASSERT_EQ(2, sim.getRequests()[2][3]);
+  ASSERT_EQ(2, sim.getRequests()[3][3]);
+  verifyData(BMS_DATA_NR);
+  verifyData(BMS_DATA_NR + 1);
+}
+
+TEST_F(GobelBmsTest, WarnTimeout_DataIsKept)
+{
+  SerialBmsSimulator sim;
+  FaultProfile timeout;
+  timeout.timeout = true;
+
+  sim.addResponse(dataFrame());
+  sim.addResponse({}, timeout);
+
+  // The warnings are optional, a missing answer does not fail the read
+  ASSERT_TRUE(readBms(sim));
+  verifyData();
+}
+
+TEST_F(GobelBmsTest, Timeout_ReadFailsAndOtherValuesAreKept)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(dataFrame());
+  sim.addResponse(warnFrame());
+  ASSERT_TRUE(readBms(sim));
+
+  FaultProfile timeout;
+  timeout.timeout = true;
+  sim.addResponse({}, timeout);
+
+  const unsigned long startTime = millis();
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_GE(millis() - startTime, 500u); // recvAnswer timeout
+  verifyData();
+}
+
+TEST_F(GobelBmsTest, WrongChecksum_ReadFails)
+{
+  SerialBmsSimulator sim;
+  std::vector<uint8_t> frame = dataFrame();
+  frame[frame.size() - 2] ^= 0x01;
+
+  sim.addResponse(frame);
+  sim.addResponse(warnFrame());
+
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_EQ(1u, sim.getRequests().size()); // The warnings are not requested
+  ASSERT_EQ(0xFFFF, getBmsCellVoltage(BMS_DATA_NR, 0));
+}
+
+} // namespace test
+} // namespace gobelbms
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
@@ -0,0 +1,308 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <common/SerialBmsSimulator.hpp>
+#include <BscFakes.hpp>
+
+// The modules under test are compiled together with the test, see platformio.ini (-Isrc).
+// Every module has its own static TAG, so it is renamed while including the module.
+#define TAG TAG_BmsData
+#include <BmsData.cpp>
+#undef TAG
+#include <SerialRx.cpp>
+#include <devices/JbdBms.cpp>
+
+namespace jbdbms
+{
+namespace test
+{
+
+using serialbms::test::FaultProfile;
+using serialbms::test::SerialBmsSimulator;
+
+class JbdBmsTest :
+  public ::testing::Test
+{
+  protected:
+  JbdBmsTest() {}
+  virtual ~JbdBmsTest() {}
+
+  static constexpr uint8_t SERIAL_NR {0};
+  static constexpr uint8_t BMS_DATA_NR {BT_DEVICES_COUNT + SERIAL_NR};
+  static constexpr uint8_t START_BYTE {0xDD};
+  static constexpr uint8_t CMD_BASIC_INFO {0x03};
+  static constexpr uint8_t CMD_CELL_VOLTAGES {0x04};
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    mocks::SimClock::reset(1000000);
+    mocks::FakeSettings::clear();
+    bmsDataInit();
+
+    _devData.u8_deviceNr = 0;
+    _devData.u8_NumberOfDevices = 1;
+    _devData.u8_BmsDataAdr = SERIAL_NR;
+    _devData.bo_sendMqttMsg = true;
+    _devData.bo_writeData = false;
+    _devData.rwDataLen = 0;
+
+    // The driver drops a total voltage which is more than 10% below the last one. The initial value
+    // is 0xFFFF, so the first basic message after startup is always dropped. Prime the filter once.
+    SerialBmsSimulator sim;
+    sim.addResponse(basicInfoFrame());
+    sim.addResponse(cellVoltageFrame());
+    readBms(sim);
+    bmsDataInit();
+    serialRxInit();
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static void callbackSetRxTxEn(uint8_t, uint8_t) {}
+
+  bool readBms(SerialBmsSimulator& sim)
+  {
+    return JbdBms_readBmsData(&sim, SERIAL_NR, &callbackSetRxTxEn, &_devData);
+  }
+
+  /** Builds an answer frame: 0xDD, cmd, status, len, data, checksum, 0x77 */
+  static std::vector<uint8_t> makeFrame(uint8_t cmd, const std::vector<uint8_t>& data)
+  {
+    std::vector<uint8_t> frame {START_BYTE, cmd, 0x00, static_cast<uint8_t>(data.size())};
+    frame.insert(frame.end(), data.begin(), data.end());
+
+    uint16_t sum = 0;
+    for (uint8_t b : data) sum += b;
+    const uint16_t checksum = (sum + data.size() - 1) ^ 0xFFFF;
+    frame.push_back(checksum >> 8);
+    frame.push_back(checksum & 0xFF);
+    frame.push_back(0x77);
+    return frame;
+  }
+
+  static void append16(std::vector<uint8_t>& data, uint16_t value)
+  {
+    data.push_back(value >> 8);
+    data.push_back(value & 0xFF);
+  }
+
+  /** Recorded basic info: 53.12V, 5.00A, 87%, FET charge+discharge on, 2 NTCs (25.0°C, 26.5°C) */
+  static std::vector<uint8_t> basicInfoFrame()
+  {
+    std::vector<uint8_t> data;
+    append16(data, 5312);      // Total voltage, 10mV
+    append16(data, 500);       // Current, 10mA
+    append16(data, 8700);      // Balance capacity, 10mAh
+    append16(data, 10000);     // Full capacity, 10mAh
+    append16(data, 42);        // Cycles
+    append16(data, 0x2A21);    // Production date
+    append16(data, 0x0001);    // Balance status
+    append16(data, 0x0000);    // Balance status 2
+    append16(data, 0x0000);    // Errors
+    data.push_back(0x10);      // Software version
+    data.push_back(87);        // RSOC
+    data.push_back(0x03);      // FET status
+    data.push_back(16);        // Battery series
+    data.push_back(2);         // Number of NTCs
+    append16(data, 2731+250);  // NTC 1, 0.1K
+    append16(data, 2731+265);  // NTC 2, 0.1K
+    return makeFrame(CMD_BASIC_INFO, data);
+  }
+
+  /** Recorded cell voltages of a 16s pack: 3300mV + cellNr */
+  static std::vector<uint8_t> cellVoltageFrame()
+  {
+    std::vector<uint8_t> data;
+    for (uint16_t i = 0; i < 16; ++i) append16(data, 3300 + i);
+    return makeFrame(CMD_CELL_VOLTAGES, data);
+  }
+
+  static void verifyBasicInfo()
+  {
+    ASSERT_FLOAT_EQ(53.12f, getBmsTotalVoltage(BMS_DATA_NR));
+    ASSERT_FLOAT_EQ(5.0f, getBmsTotalCurrent(BMS_DATA_NR));
+    ASSERT_EQ(87, getBmsChargePercentage(BMS_DATA_NR));
+    ASSERT_EQ(0u, getBmsErrors(BMS_DATA_NR));
+    ASSERT_TRUE(getBmsStateFETsCharge(BMS_DATA_NR));
+    ASSERT_TRUE(getBmsStateFETsDischarge(BMS_DATA_NR));
+    ASSERT_FLOAT_EQ(25.0f, getBmsTempature(BMS_DATA_NR, 0));
+    ASSERT_FLOAT_EQ(26.5f, getBmsTempature(BMS_DATA_NR, 1));
+  }
+
+  static void verifyCellVoltages()
+  {
+    for (uint8_t i = 0; i < 16; ++i)
+      ASSERT_EQ(3300 + i, getBmsCellVoltage(BMS_DATA_NR, i)) << "Failed cell: " << static_cast<int>(i);
+
+    ASSERT_EQ(3315, getBmsMaxCellVoltage(BMS_DATA_NR));
+    ASSERT_EQ(3300, getBmsMinCellVoltage(BMS_DATA_NR));
+    ASSERT_EQ(15, getBmsMaxVoltageCellNumber(BMS_DATA_NR));
+    ASSERT_EQ(0, getBmsMinVoltageCellNumber(BMS_DATA_NR));
+    ASSERT_EQ(15, getBmsMaxCellDifferenceVoltage(BMS_DATA_NR));
+    ASSERT_EQ(3307, getBmsAvgVoltage(BMS_DATA_NR));
+  }
+
+  serialDevData_s _devData;
+};
+
+TEST_F(JbdBmsTest, CleanResponses_AllValuesUpdated)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(basicInfoFrame());
+  sim.addResponse(cellVoltageFrame());
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(2u, sim.getRequests().size());
+  ASSERT_EQ(CMD_BASIC_INFO, sim.getRequests()[0][2]);
+  ASSERT_EQ(CMD_CELL_VOLTAGES, sim.getRequests()[1][2]);
+  ASSERT_EQ(0u, sim.getUnreadBytes());
+
+  verifyBasicInfo();
+  verifyCellVoltages();
+}
+
+TEST_F(JbdBmsTest, ByteSplitsAndJitter_AllValuesUpdated)
+{
+  FaultProfile profile;
+  profile.jitterMs = 8;
+  profile.chunkSize = 3;
+  profile.chunkGapMs = 4;
+
+  for (uint32_t seed = 1; seed <= 20; ++seed)
+  {
+    SerialBmsSimulator sim(seed);
+    sim.addResponse(basicInfoFrame(), profile);
+    sim.addResponse(cellVoltageFrame(), profile);
+
+    ASSERT_TRUE(readBms(sim)) << "Failed seed: " << seed;
+    verifyBasicInfo();
+    verifyCellVoltages();
+  }
+}
+
+TEST_F(JbdBmsTest, GarbageBeforeFrame_FrameIsFound)
+{
+  SerialBmsSimulator sim;
+  FaultProfile profile;
+  profile.garbage = sim.randomBytes(20, {START_BYTE}); // The driver resyncs on the start byte only
+
+  sim.addResponse(basicInfoFrame(), profile);
+  sim.addResponse(cellVoltageFrame(), profile);
+
+  ASSERT_TRUE(readBms(sim));
+  verifyBasicInfo();
+  verifyCellVoltages();
+}
+
+TEST_F(JbdBmsTest, Timeout_ReadFailsAndOtherValuesAreKept)
+{
+  SerialBmsSimulator sim;
+  FaultProfile timeout;
+  timeout.timeout = true;
+
+  sim.addResponse(basicInfoFrame());
+  sim.addResponse({}, timeout);
+
+  const unsigned long startTime = millis();
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_GE(millis() - startTime, 200u); // recvAnswer timeout
+  verifyBasicInfo();
+  ASSERT_EQ(0xFFFF, getBmsCellVoltage(BMS_DATA_NR, 0));
+}
+
+TEST_F(JbdBmsTest, WrongChecksum_ReadFails)
+{
+  SerialBmsSimulator sim;
+  std::vector<uint8_t> frame = cellVoltageFrame();
+  frame[frame.size() - 2] ^= 0x01;
+
+  sim.addResponse(basicInfoFrame());
+  sim.addResponse(frame);
+
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_EQ(0xFFFF, getBmsCellVoltage(BMS_DATA_NR, 0));
+}
+
+TEST_F(JbdBmsTest, ResponseTime_CloseToWireTime)
+{
+  SerialBmsSimulator sim;
+  ASSERT_TRUE(serialRxRegisterPort(&sim, false));
+  sim.addResponse(basicInfoFrame());
+  FaultProfile slow;
+  slow.responseDelayMs = 30;
+  sim.addResponse(cellVoltageFrame(), slow);
+
+  ASSERT_TRUE(readBms(sim));
+
+  commstats::Statistics stats;
+  serialRxGetCommStatistics(SERIAL_NR, stats);
+  ASSERT_EQ(2u, stats.responses);
+  ASSERT_EQ(0u, stats.timeouts);
+  // The answer is read as soon as it arrives: at most one polling period (1ms) after the last byte
+  const uint32_t wireTimeUs = sim.getLastWireTimeMs() * 1000;
+  ASSERT_GE(stats.responseLastUs, wireTimeUs);
+  ASSERT_LE(stats.responseLastUs, wireTimeUs + 2000);
+  ASSERT_LT(stats.responseMinUs, stats.responseMaxUs);
+}
+
+TEST_F(JbdBmsTest, Timeout_IsCounted)
+{
+  SerialBmsSimulator sim;
+  FaultProfile timeout;
+  timeout.timeout = true;
+  sim.addResponse({}, timeout);
+  sim.addResponse(cellVoltageFrame());
+
+  ASSERT_FALSE(readBms(sim));
+
+  commstats::Statistics stats;
+  serialRxGetCommStatistics(SERIAL_NR, stats);
+  ASSERT_EQ(1u, stats.responses);
+  ASSERT_EQ(1u, stats.timeouts);
+}
+
+TEST_F(JbdBmsTest, MeasureParseLatency)
+{
+  constexpr uint32_t NUMBER_OF_POLLS {50};
+  uint64_t simTimeUs = 0;
+  uint64_t wireTimeMs = 0;
+
+  const auto wallStart = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < NUMBER_OF_POLLS; ++i)
+  {
+    SerialBmsSimulator sim(i);
+    sim.addResponse(basicInfoFrame());
+    sim.addResponse(cellVoltageFrame());
+
+    const uint64_t startUs = mocks::SimClock::nowUs();
+    ASSERT_TRUE(readBms(sim));
+    simTimeUs += mocks::SimClock::nowUs() - startUs;
+    wireTimeMs += sim.getLastWireTimeMs();
+  }
+  const auto wallTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - wallStart).count();
+
+  const uint32_t avgPollTimeMs = static_cast<uint32_t>(simTimeUs / NUMBER_OF_POLLS / 1000);
+  RecordProperty("avgSimulatedPollTimeMs", static_cast<int>(avgPollTimeMs));
+  RecordProperty("avgWireTimeLastAnswerMs", static_cast<int>(wireTimeMs / NUMBER_OF_POLLS));
+  RecordProperty("avgHostCpuTimeUs", static_cast<int>(wallTimeUs / NUMBER_OF_POLLS));
+
+  // Two answers on the wire (~30ms + ~45ms), 40ms pause between the requests and the polling granularity of the driver
+  ASSERT_LT(avgPollTimeMs, 200u);
+}
+
+} // namespace test
+} // namespace jbdbms
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
@@ -0,0 +1,253 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <common/SerialBmsSimulator.hpp>
+#include <BscFakes.hpp>
+
+// The modules under test are compiled together with the test, see platformio.ini (-Isrc).
+// Every module has its own static TAG, so it is renamed while including the module.
+#define TAG TAG_BmsData
+#include <BmsData.cpp>
+#undef TAG
+#include <SerialRx.cpp>
+#include <devices/JkBms.cpp>
+
+namespace jkbms
+{
+namespace test
+{
+
+using serialbms::test::FaultProfile;
+using serialbms::test::SerialBmsSimulator;
+
+class JkBmsTest :
+  public ::testing::Test
+{
+  protected:
+  JkBmsTest() {}
+  virtual ~JkBmsTest() {}
+
+  static constexpr uint8_t SERIAL_NR {0};
+  static constexpr uint8_t BMS_DATA_NR {BT_DEVICES_COUNT + SERIAL_NR};
+  static constexpr uint8_t START_BYTE {0x4E};
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    mocks::SimClock::reset(1000000);
+    mocks::FakeSettings::clear();
+    bmsDataInit();
+    serialRxInit();
+
+    _devData.u8_deviceNr = 0;
+    _devData.u8_NumberOfDevices = 1;
+    _devData.u8_BmsDataAdr = SERIAL_NR;
+    _devData.bo_sendMqttMsg = true;
+    _devData.bo_writeData = false;
+    _devData.rwDataLen = 0;
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static void callbackSetRxTxEn(uint8_t, uint8_t) {}
+
+  /** The JK BMS is connected with 115200 baud */
+  static FaultProfile wire()
+  {
+    FaultProfile profile;
+    profile.byteTimeUs = SerialBmsSimulator::BYTE_TIME_US_115200;
+    return profile;
+  }
+
+  bool readBms(SerialBmsSimulator& sim)
+  {
+    return JkBms_readBmsData(&sim, SERIAL_NR, &callbackSetRxTxEn, &_devData);
+  }
+
+  static void append16(std::vector<uint8_t>& data, uint16_t value)
+  {
+    data.push_back(value >> 8);
+    data.push_back(value & 0xFF);
+  }
+
+  /**
+   * Builds an answer frame: 0x4E 0x57, length (from the length field up to the end), terminal number (4 bytes),
+   * command, source, transport type, data, record number (4 bytes), 0x68, checksum (4 bytes, sum of all bytes)
+   */
+  static std::vector<uint8_t> makeFrame(const std::vector<uint8_t>& data)
+  {
+    std::vector<uint8_t> frame {START_BYTE, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01};
+    frame.insert(frame.end(), data.begin(), data.end());
+    frame.insert(frame.end(), {0x00, 0x00, 0x00, 0x00, 0x68});
+    const uint16_t len = frame.size() - 2 + 4;
+    frame[2] = len >> 8;
+    frame[3] = len & 0xFF;
+
+    uint16_t sum = 0;
+    for (uint8_t b : frame) sum += b;
+    append16(frame, 0);
+    append16(frame, sum);
+    return frame;
+  }
+
+  /** Recorded answer of a 16s pack: cells 3300mV + cellNr, 52.92V, 5.00A charge, 87%, FETs on, balancing */
+  static std::vector<uint8_t> answerFrame(uint16_t warnings = 0x0000, uint16_t status = 0x0007)
+  {
+    std::vector<uint8_t> data {0x79, 16 * 3};
+    for (uint8_t i = 0; i < 16; ++i)
+    {
+      data.push_back(i + 1);
+      append16(data, 3300 + i);
+    }
+    data.push_back(0x80); append16(data, 30);      // MOS temperature, °C
+    data.push_back(0x81); append16(data, 25);      // Battery box temperature
+    data.push_back(0x82); append16(data, 26);      // Battery temperature
+    data.push_back(0x83); append16(data, 5292);    // Total voltage, 10mV
+    data.push_back(0x84); append16(data, 0x8000 | 500); // Current, 10mA, bit 15: charging
+    data.push_back(0x85); data.push_back(87);      // SoC, %
+    data.push_back(0x86); data.push_back(2);       // Number of temperature sensors
+    data.push_back(0x87); append16(data, 42);      // Cycles
+    data.push_back(0x89); append16(data, 0); append16(data, 12000); // Total cycle capacity, Ah
+    data.push_back(0x8A); append16(data, 16);      // Total number of cells
+    data.push_back(0x8B); append16(data, warnings);
+    data.push_back(0x8C); append16(data, status);  // Bit 0: charge, bit 1: discharge, bit 2: balancing
+    return makeFrame(data);
+  }
+
+  static void verifyAnswer()
+  {
+    for (uint8_t i = 0; i < 16; ++i)
+      ASSERT_EQ(3300 + i, getBmsCellVoltage(BMS_DATA_NR, i)) << "Failed cell: " << static_cast<int>(i);
+
+    ASSERT_EQ(3315, getBmsMaxCellVoltage(BMS_DATA_NR));
+    ASSERT_EQ(3300, getBmsMinCellVoltage(BMS_DATA_NR));
+    ASSERT_EQ(15, getBmsMaxVoltageCellNumber(BMS_DATA_NR));
+    ASSERT_EQ(0, getBmsMinVoltageCellNumber(BMS_DATA_NR));
+    ASSERT_EQ(15, getBmsMaxCellDifferenceVoltage(BMS_DATA_NR));
+    ASSERT_EQ(3307, getBmsAvgVoltage(BMS_DATA_NR));
+
+    ASSERT_FLOAT_EQ(30.0f, getBmsTempature(BMS_DATA_NR, 0));
+    ASSERT_FLOAT_EQ(25.0f, getBmsTempature(BMS_DATA_NR, 1));
+    ASSERT_FLOAT_EQ(26.0f, getBmsTempature(BMS_DATA_NR, 2));
+    ASSERT_FLOAT_EQ(52.92f, getBmsTotalVoltage(BMS_DATA_NR));
+    ASSERT_FLOAT_EQ(5.0f, getBmsTotalCurrent(BMS_DATA_NR));
+    ASSERT_EQ(87, getBmsChargePercentage(BMS_DATA_NR));
+    ASSERT_EQ(0u, getBmsErrors(BMS_DATA_NR));
+    ASSERT_TRUE(getBmsStateFETsCharge(BMS_DATA_NR));
+    ASSERT_TRUE(getBmsStateFETsDischarge(BMS_DATA_NR));
+    ASSERT_TRUE(getBmsIsBalancingActive(BMS_DATA_NR));
+  }
+
+  serialDevData_s _devData;
+};
+
+TEST_F(JkBmsTest, CleanResponses_AllValuesUpdated)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(answerFrame(), wire());
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(1u, sim.getRequests().size());
+  ASSERT_EQ(std::vector<uint8_t>(getDataMsg, getDataMsg + sizeof(getDataMsg)), sim.getRequests()[0]);
+  ASSERT_EQ(0u, sim.getUnreadBytes());
+
+  verifyAnswer();
+}
+
+TEST_F(JkBmsTest, ByteSplitsAndJitter_AllValuesUpdated)
+{
+  // The answer (~100 bytes) has to arrive within 200ms, so the chunks are larger
+  FaultProfile profile = wire();
+  profile.jitterMs = 8;
+  profile.chunkSize = 8;
+  profile.chunkGapMs = 4;
+
+  for (uint32_t seed = 1; seed <= 20; ++seed)
+  {
+    SerialBmsSimulator sim(seed);
+    sim.addResponse(answerFrame(), profile);
+
+    ASSERT_TRUE(readBms(sim)) << "Failed seed: " << seed;
+    verifyAnswer();
+  }
+}
+
+TEST_F(JkBmsTest, GarbageBeforeFrame_FrameIsFound)
+{
+  SerialBmsSimulator sim;
+  FaultProfile profile = wire();
+  profile.garbage = sim.randomBytes(20, {START_BYTE}); // The driver resyncs on the start byte only
+
+  sim.addResponse(answerFrame(), profile);
+
+  ASSERT_TRUE(readBms(sim));
+  verifyAnswer();
+}
+
+TEST_F(JkBmsTest, WarningsAndStatus_Updated)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(answerFrame(0x0008, 0x0002), wire()); // Cell overvoltage, charge FET off, no balancing
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(BMS_ERR_STATUS_CELL_OVP, getBmsErrors(BMS_DATA_NR));
+  ASSERT_FALSE(getBmsStateFETsCharge(BMS_DATA_NR));
+  ASSERT_TRUE(getBmsStateFETsDischarge(BMS_DATA_NR));
+  ASSERT_FALSE(getBmsIsBalancingActive(BMS_DATA_NR));
+}
+
+TEST_F(JkBmsTest, Timeout_ReadFailsAndOtherValuesAreKept)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(answerFrame(), wire());
+  ASSERT_TRUE(readBms(sim));
+
+  FaultProfile timeout;
+  timeout.timeout = true;
+  sim.addResponse({}, timeout);
+
+  const unsigned long startTime = millis();
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_GE(millis() - startTime, 200u); // recvAnswer timeout
+  verifyAnswer();
+}
+
+TEST_F(JkBmsTest, WrongChecksum_ReadFails)
+{
+  SerialBmsSimulator sim;
+  std::vector<uint8_t> frame = answerFrame();
+  frame.back() ^= 0x01;
+
+  sim.addResponse(frame, wire());
+
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_EQ(0xFFFF, getBmsCellVoltage(BMS_DATA_NR, 0));
+}
+
+TEST_F(JkBmsTest, MissingEndMarker_ReadFails)
+{
+  SerialBmsSimulator sim;
+  std::vector<uint8_t> frame = answerFrame();
+  frame[frame.size() - 5] = 0x69;
+  frame.back() += 1; // Keep the checksum valid
+
+  sim.addResponse(frame, wire());
+
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_EQ(0xFFFF, getBmsCellVoltage(BMS_DATA_NR, 0));
+}
+
+} // namespace test
+} // namespace jkbms
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
@@ -0,0 +1,204 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <common/SerialBmsSimulator.hpp>
+#include <BscFakes.hpp>
+
+// The modules under test are compiled together with the test, see platformio.ini (-Isrc).
+// Every module has its own static TAG, so it is renamed while including the module.
+#define TAG TAG_BmsData
+#include <BmsData.cpp>
+#undef TAG
+#include <SerialRx.cpp>
+#include <devices/JkBmsV13.cpp>
+
+namespace jkbmsv13
+{
+namespace test
+{
+
+using serialbms::test::FaultProfile;
+using serialbms::test::SerialBmsSimulator;
+
+class JkBmsV13Test :
+  public ::testing::Test
+{
+  protected:
+  JkBmsV13Test() {}
+  virtual ~JkBmsV13Test() {}
+
+  static constexpr uint8_t SERIAL_NR {0};
+  static constexpr uint8_t BMS_DATA_NR {BT_DEVICES_COUNT + SERIAL_NR};
+  static constexpr uint8_t START_BYTE {0xEB};
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    mocks::SimClock::reset(1000000);
+    mocks::FakeSettings::clear();
+    bmsDataInit();
+    serialRxInit();
+
+    _devData.u8_deviceNr = 0;
+    _devData.u8_NumberOfDevices = 1;
+    _devData.u8_BmsDataAdr = SERIAL_NR;
+    _devData.bo_sendMqttMsg = true;
+    _devData.bo_writeData = false;
+    _devData.rwDataLen = 0;
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static void callbackSetRxTxEn(uint8_t, uint8_t) {}
+
+  bool readBms(SerialBmsSimulator& sim)
+  {
+    return JkBmsV13_readBmsData(&sim, SERIAL_NR, &callbackSetRxTxEn, &_devData);
+  }
+
+  static void put16(std::vector<uint8_t>& frame, std::size_t pos, uint16_t value)
+  {
+    frame[pos] = value >> 8;
+    frame[pos + 1] = value & 0xFF;
+  }
+
+  /**
+   * Recorded answer of a 16s pack (74 bytes): 0xEB 0x90, slave address, 0xFF, data, checksum (sum of all bytes).
+   * Cells 3300mV + cellNr, 25°C, balancing with 120mA.
+   */
+  static std::vector<uint8_t> answerFrame(uint8_t errors = 0x00)
+  {
+    std::vector<uint8_t> frame(headerLen + JKBMSV13_MAX_ANSWER_LEN, 0x00);
+    frame[0] = START_BYTE;
+    frame[1] = 0x90;
+    frame[2] = JK_V13_SLAVE_ADDR;
+    frame[3] = 0xFF;
+    put16(frame, 4, 5292);                  // Stack voltage, 10mV
+    put16(frame, 6, 331);                   // Average cell voltage, 10mV
+    frame[12] = errors;
+    put16(frame, 15, 120);                  // Balance current, mA
+    frame[21] = 0x01;                       // Balancing active
+    frame[22] = 16;                         // Number of cells
+    for (uint8_t i = 0; i < 16; ++i) put16(frame, 23 + 2 * i, 3300 + i);
+    put16(frame, 71, 25);                   // Temperature, °C
+
+    uint8_t sum = 0;
+    for (std::size_t i = 0; i < frame.size() - 1; ++i) sum += frame[i];
+    frame.back() = sum;
+    return frame;
+  }
+
+  static void verifyAnswer()
+  {
+    for (uint8_t i = 0; i < 16; ++i)
+      ASSERT_EQ(3300 + i, getBmsCellVoltage(BMS_DATA_NR, i)) << "Failed cell: " << static_cast<int>(i);
+
+    ASSERT_FLOAT_EQ(52.92f, getBmsTotalVoltage(BMS_DATA_NR)); // Sum of the cells
+    ASSERT_EQ(3315, getBmsMaxCellVoltage(BMS_DATA_NR));
+    ASSERT_EQ(3300, getBmsMinCellVoltage(BMS_DATA_NR));
+    ASSERT_EQ(16, getBmsMaxVoltageCellNumber(BMS_DATA_NR));
+    ASSERT_EQ(1, getBmsMinVoltageCellNumber(BMS_DATA_NR));
+    ASSERT_TRUE(getBmsIsBalancingActive(BMS_DATA_NR));
+    ASSERT_FLOAT_EQ(0.12f, getBmsBalancingCurrent(BMS_DATA_NR));
+    ASSERT_FLOAT_EQ(25.0f, getBmsTempature(BMS_DATA_NR, 0));
+    ASSERT_EQ(0u, getBmsErrors(BMS_DATA_NR));
+  }
+
+  serialDevData_s _devData;
+};
+
+TEST_F(JkBmsV13Test, CleanResponses_AllValuesUpdated)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(answerFrame());
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(1u, sim.getRequests().size());
+  const std::vector<uint8_t> expectedRequest {0x55, 0xAA, JK_V13_SLAVE_ADDR, 0xFF, 0x00, 0x00, 0xFE};
+  ASSERT_EQ(expectedRequest, sim.getRequests()[0]);
+  ASSERT_EQ(0u, sim.getUnreadBytes());
+
+  verifyAnswer();
+  ASSERT_NE(0u, getBmsLastDataMillis(BMS_DATA_NR));
+}
+
+TEST_F(JkBmsV13Test, ByteSplitsAndJitter_AllValuesUpdated)
+{
+  FaultProfile profile;
+  profile.jitterMs = 8;
+  profile.chunkSize = 3;
+  profile.chunkGapMs = 4;
+
+  for (uint32_t seed = 1; seed <= 20; ++seed)
+  {
+    SerialBmsSimulator sim(seed);
+    sim.addResponse(answerFrame(), profile);
+
+    ASSERT_TRUE(readBms(sim)) << "Failed seed: " << seed;
+    verifyAnswer();
+  }
+}
+
+TEST_F(JkBmsV13Test, GarbageBeforeFrame_FrameIsFound)
+{
+  SerialBmsSimulator sim;
+  FaultProfile profile;
+  profile.garbage = sim.randomBytes(20, {START_BYTE}); // The driver resyncs on the start byte only
+
+  sim.addResponse(answerFrame(), profile);
+
+  ASSERT_TRUE(readBms(sim));
+  verifyAnswer();
+}
+
+TEST_F(JkBmsV13Test, Errors_Updated)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(answerFrame(BMS_ERR_STATUS_CELL_OVP));
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(BMS_ERR_STATUS_CELL_OVP, getBmsErrors(BMS_DATA_NR));
+}
+
+TEST_F(JkBmsV13Test, Timeout_ReadFailsAndOtherValuesAreKept)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(answerFrame());
+  ASSERT_TRUE(readBms(sim));
+
+  FaultProfile timeout;
+  timeout.timeout = true;
+  sim.addResponse({}, timeout);
+
+  const unsigned long startTime = millis();
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_GE(millis() - startTime, 500u); // recvAnswer timeout
+  verifyAnswer();
+}
+
+TEST_F(JkBmsV13Test, WrongChecksum_ReadFails)
+{
+  SerialBmsSimulator sim;
+  std::vector<uint8_t> frame = answerFrame();
+  frame.back() ^= 0x01;
+
+  sim.addResponse(frame);
+
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_EQ(0xFFFF, getBmsCellVoltage(BMS_DATA_NR, 0));
+}
+
+} // namespace test
+} // namespace jkbmsv13
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
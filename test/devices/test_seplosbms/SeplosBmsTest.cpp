@@ -0,0 +1,304 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <common/SerialBmsSimulator.hpp>
+#include <BscFakes.hpp>
+
+// The modules under test are compiled together with the test, see platformio.ini (-Isrc).
+// Every module has its own static TAG, so it is renamed while including the module.
+#define TAG TAG_BmsData
+#include <BmsData.cpp>
+#undef TAG
+#include <SerialRx.cpp>
+#include <devices/SeplosBms.cpp>
+
+namespace seplosbms
+{
+namespace test
+{
+
+using serialbms::test::FaultProfile;
+using serialbms::test::SerialBmsSimulator;
+
+class SeplosBmsTest :
+  public ::testing::Test
+{
+  protected:
+  SeplosBmsTest() {}
+  virtual ~SeplosBmsTest() {}
+
+  static constexpr uint8_t SERIAL_NR {0};
+  static constexpr uint8_t BMS_DATA_NR {BT_DEVICES_COUNT + SERIAL_NR};
+  static constexpr uint8_t START_BYTE {0x7E};
+  static constexpr uint8_t CID2_ANALOG {0x42};
+  static constexpr uint8_t CID2_ALARMS {0x44};
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    mocks::SimClock::reset(1000000);
+    mocks::FakeSettings::clear();
+    bmsDataInit();
+    serialRxInit();
+
+    _devData.u8_deviceNr = 0;
+    _devData.u8_NumberOfDevices = 1;
+    _devData.u8_BmsDataAdr = SERIAL_NR;
+    _devData.bo_sendMqttMsg = true;
+    _devData.bo_writeData = false;
+    _devData.rwDataLen = 0;
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static void callbackSetRxTxEn(uint8_t, uint8_t) {}
+
+  /** The Seplos BMS is connected with 19200 baud */
+  static FaultProfile wire()
+  {
+    FaultProfile profile;
+    profile.byteTimeUs = SerialBmsSimulator::BYTE_TIME_US_19200;
+    return profile;
+  }
+
+  bool readBms(SerialBmsSimulator& sim)
+  {
+    return SeplosBms_readBmsData(&sim, SERIAL_NR, &callbackSetRxTxEn, &_devData);
+  }
+
+  /** Returns the byte i of an ASCII hex request (without the '~') */
+  static uint8_t requestByte(const std::vector<uint8_t>& request, std::size_t i)
+  {
+    return convertAsciiHexToByte(request[1 + 2 * i], request[2 + 2 * i]);
+  }
+
+  static void appendHex(std::vector<uint8_t>& frame, uint8_t value)
+  {
+    static constexpr char hex[] = "0123456789ABCDEF";
+    frame.push_back(hex[value >> 4]);
+    frame.push_back(hex[value & 0x0F]);
+  }
+
+  static void append16(std::vector<uint8_t>& data, uint16_t value)
+  {
+    data.push_back(value >> 8);
+    data.push_back(value & 0xFF);
+  }
+
+  /** Builds an answer frame: '~', VER, ADR, CID1, RTN, LENID, info (all ASCII hex), checksum (4 chars), CR */
+  static std::vector<uint8_t> makeFrame(const std::vector<uint8_t>& info, uint8_t address = 0)
+  {
+    const uint16_t lenid = lCrc(info.size() * 2);
+    std::vector<uint8_t> bytes {0x20, address, 0x46, 0x00, static_cast<uint8_t>(lenid >> 8), static_cast<uint8_t>(lenid)};
+    bytes.insert(bytes.end(), info.begin(), info.end());
+
+    std::vector<uint8_t> frame {START_BYTE};
+    for (uint8_t b : bytes) appendHex(frame, b);
+
+    uint16_t sum = 0;
+    for (std::size_t i = 1; i < frame.size(); ++i) sum += frame[i];
+    const uint16_t checksum = ~sum + 1;
+    appendHex(frame, checksum >> 8);
+    appendHex(frame, checksum & 0xFF);
+    frame.push_back(0x0D);
+    return frame;
+  }
+
+  /** Recorded analog values: 16 cells 3300mV + cellNr, 6 NTCs, -5.00A, 52.80V, 87.5% */
+  static std::vector<uint8_t> analogFrame(uint8_t address = 0)
+  {
+    std::vector<uint8_t> info {0x00, 0x00, 16};  // Data flag, group, number of cells
+    for (uint16_t i = 0; i < 16; ++i) append16(info, 3300 + i);
+    info.push_back(6);                            // Number of temperatures
+    append16(info, 2731 + 250);                   // Cell temperature 1, 0.1K
+    append16(info, 2731 + 265);                   // Cell temperature 2
+    append16(info, 2731 + 240);                   // Cell temperature 3
+    append16(info, 2731 + 245);                   // Cell temperature 4
+    append16(info, 2731 + 220);                   // Environment temperature
+    append16(info, 2731 + 300);                   // Mosfet temperature
+    append16(info, static_cast<uint16_t>(-500));  // Current, 10mA
+    append16(info, 5280);                         // Total voltage, 10mV
+    append16(info, 13390);                        // Remaining capacity, 10mAh
+    info.push_back(10);                           // Custom number
+    append16(info, 17000);                        // Battery capacity, 10mAh
+    append16(info, 875);                          // SoC, 0.1%
+    append16(info, 18000);                        // Rated capacity, 10mAh
+    append16(info, 70);                           // Cycles
+    append16(info, 1000);                         // SoH, 0.1%
+    append16(info, 5279);                         // Port voltage, 10mV
+    for (uint8_t i = 0; i < 4; ++i) append16(info, 0);  // Reserved
+    return makeFrame(info, address);
+  }
+
+  /** Recorded alarms: no byte alarms, alarm event 2 and the on-off state are given */
+  static std::vector<uint8_t> alarmFrame(uint8_t alarmEvent2 = 0x00, uint8_t onOffState = 0x03)
+  {
+    std::vector<uint8_t> info {0x00, 0x01, 16};   // Data flag, group, number of cells
+    info.insert(info.end(), 16, 0x00);            // Cell alarms
+    info.push_back(6);                            // Number of temperatures
+    info.insert(info.end(), 6, 0x00);             // Temperature alarms
+    info.push_back(0x00);                         // Current alarm
+    info.push_back(0x00);                         // Total voltage alarm
+    info.push_back(20);                           // Number of custom alarms
+    info.push_back(0x00);                         // Alarm event 1
+    info.push_back(alarmEvent2);                  // Alarm event 2
+    info.insert(info.end(), 4, 0x00);             // Alarm event 3..6
+    info.push_back(onOffState);                   // On-off state
+    info.insert(info.end(), 13, 0x00);            // Equilibrium, system and disconnection state, alarm event 7/8, reserved
+    return makeFrame(info);
+  }
+
+  static void verifyAnalog(uint8_t bmsDataNr = BMS_DATA_NR)
+  {
+    for (uint8_t i = 0; i < 16; ++i)
+      ASSERT_EQ(3300 + i, getBmsCellVoltage(bmsDataNr, i)) << "Failed cell: " << static_cast<int>(i);
+
+    ASSERT_EQ(3315, getBmsMaxCellVoltage(bmsDataNr));
+    ASSERT_EQ(3300, getBmsMinCellVoltage(bmsDataNr));
+    ASSERT_EQ(15, getBmsMaxVoltageCellNumber(bmsDataNr));
+    ASSERT_EQ(0, getBmsMinVoltageCellNumber(bmsDataNr));
+    ASSERT_EQ(15, getBmsMaxCellDifferenceVoltage(bmsDataNr));
+    ASSERT_EQ(3307, getBmsAvgVoltage(bmsDataNr));
+
+    ASSERT_NEAR(25.0f, getBmsTempature(bmsDataNr, 0), 0.01f);
+    ASSERT_NEAR(26.5f, getBmsTempature(bmsDataNr, 1), 0.01f);
+    ASSERT_NEAR(24.0f, getBmsTempature(bmsDataNr, 2), 0.01f);
+    ASSERT_FLOAT_EQ(-5.0f, getBmsTotalCurrent(bmsDataNr));
+    ASSERT_FLOAT_EQ(52.8f, getBmsTotalVoltage(bmsDataNr));
+    ASSERT_EQ(87, getBmsChargePercentage(bmsDataNr));
+  }
+
+  static void verifyAlarms(uint8_t bmsDataNr = BMS_DATA_NR)
+  {
+    ASSERT_EQ(0u, getBmsErrors(bmsDataNr));
+    ASSERT_TRUE(getBmsStateFETsCharge(bmsDataNr));
+    ASSERT_TRUE(getBmsStateFETsDischarge(bmsDataNr));
+  }
+
+  serialDevData_s _devData;
+};
+
+TEST_F(SeplosBmsTest, CleanResponses_AllValuesUpdated)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(analogFrame(), wire());
+  sim.addResponse(alarmFrame(), wire());
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(2u, sim.getRequests().size());
+  ASSERT_EQ(0x00, requestByte(sim.getRequests()[0], 1));
+  ASSERT_EQ(CID2_ANALOG, requestByte(sim.getRequests()[0], 3));
+  ASSERT_EQ(CID2_ALARMS, requestByte(sim.getRequests()[1], 3));
+  ASSERT_EQ(0u, sim.getUnreadBytes());
+
+  verifyAnalog();
+  verifyAlarms();
+}
+
+TEST_F(SeplosBmsTest, ByteSplitsAndJitter_AllValuesUpdated)
+{
+  // The answers are long (~170 bytes) and have to arrive within 200ms, so the chunks are larger
+  FaultProfile profile = wire();
+  profile.jitterMs = 8;
+  profile.chunkSize = 32;
+  profile.chunkGapMs = 4;
+
+  for (uint32_t seed = 1; seed <= 20; ++seed)
+  {
+    SerialBmsSimulator sim(seed);
+    sim.addResponse(analogFrame(), profile);
+    sim.addResponse(alarmFrame(), profile);
+
+    ASSERT_TRUE(readBms(sim)) << "Failed seed: " << seed;
+    verifyAnalog();
+    verifyAlarms();
+  }
+}
+
+TEST_F(SeplosBmsTest, GarbageBeforeFrame_FrameIsFound)
+{
+  SerialBmsSimulator sim;
+  FaultProfile profile = wire();
+  profile.garbage = sim.randomBytes(20, {START_BYTE}); // The driver resyncs on the start byte only
+
+  sim.addResponse(analogFrame(), profile);
+  sim.addResponse(alarmFrame(), profile);
+
+  ASSERT_TRUE(readBms(sim));
+  verifyAnalog();
+  verifyAlarms();
+}
+
+TEST_F(SeplosBmsTest, Alarms_ErrorsAndFetsUpdated)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(analogFrame(), wire());
+  sim.addResponse(alarmFrame(0x01, 0x01), wire()); // Cell high voltage alarm, charge FET off
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(BMS_ERR_STATUS_CELL_OVP, getBmsErrors(BMS_DATA_NR));
+  ASSERT_FALSE(getBmsStateFETsCharge(BMS_DATA_NR));
+  ASSERT_TRUE(getBmsStateFETsDischarge(BMS_DATA_NR));
+}
+
+TEST_F(SeplosBmsTest, MultiplePacks_AddressStartsAtOne)
+{
+  _devData.u8_deviceNr = 1;
+  _devData.u8_NumberOfDevices = 2;
+  _devData.u8_BmsDataAdr = 1;
+
+  SerialBmsSimulator sim;
+  sim.addResponse(analogFrame(2), wire());
+  sim.addResponse(alarmFrame(), wire());
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(2, requestByte(sim.getRequests()[0], 1));
+  ASSERT_EQ(2, requestByte(sim.getRequests()[1], 1));
+  verifyAnalog(BMS_DATA_NR + 1);
+  verifyAlarms(BMS_DATA_NR + 1);
+  ASSERT_EQ(0xFFFF, getBmsCellVoltage(BMS_DATA_NR, 0));
+}
+
+TEST_F(SeplosBmsTest, Timeout_ReadFailsAndOtherValuesAreKept)
+{
+  SerialBmsSimulator sim;
+  FaultProfile timeout;
+  timeout.timeout = true;
+
+  sim.addResponse(analogFrame(), wire());
+  sim.addResponse({}, timeout);
+
+  const unsigned long startTime = millis();
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_GE(millis() - startTime, 200u); // recvAnswer timeout
+  verifyAnalog();
+}
+
+TEST_F(SeplosBmsTest, WrongChecksum_ReadFails)
+{
+  SerialBmsSimulator sim;
+  std::vector<uint8_t> frame = analogFrame();
+  frame[frame.size() - 2] = (frame[frame.size() - 2] == '0') ? '1' : '0';
+
+  sim.addResponse(frame, wire());
+  sim.addResponse(alarmFrame(), wire());
+
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_EQ(1u, sim.getRequests().size()); // The alarms are not requested
+  ASSERT_EQ(0xFFFF, getBmsCellVoltage(BMS_DATA_NR, 0));
+}
+
+} // namespace test
+} // namespace seplosbms
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
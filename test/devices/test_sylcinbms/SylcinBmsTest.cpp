@@ -0,0 +1,308 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <common/SerialBmsSimulator.hpp>
+#include <BscFakes.hpp>
+
+// The modules under test are compiled together with the test, see platformio.ini (-Isrc).
+// Every module has its own static TAG, so it is renamed while including the module.
+#define TAG TAG_BmsData
+#include <BmsData.cpp>
+#undef TAG
+#include <SerialRx.cpp>
+#include <devices/SylcinBms.cpp>
+
+namespace sylcinbms
+{
+namespace test
+{
+
+using serialbms::test::FaultProfile;
+using serialbms::test::SerialBmsSimulator;
+
+class SylcinBmsTest :
+  public ::testing::Test
+{
+  protected:
+  SylcinBmsTest() {}
+  virtual ~SylcinBmsTest() {}
+
+  static constexpr uint8_t SERIAL_NR {0};
+  static constexpr uint8_t BMS_DATA_NR {BT_DEVICES_COUNT + SERIAL_NR};
+  static constexpr uint8_t START_BYTE {0x7E};
+  static constexpr uint8_t CID2_ANALOG {0x42};
+  static constexpr uint8_t CID2_ALARMS {0x44};
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    mocks::SimClock::reset(1000000);
+    mocks::FakeSettings::clear();
+    bmsDataInit();
+    serialRxInit();
+
+    _devData.u8_deviceNr = 0;
+    _devData.u8_NumberOfDevices = 1;
+    _devData.u8_BmsDataAdr = SERIAL_NR;
+    _devData.bo_sendMqttMsg = true;
+    _devData.bo_writeData = false;
+    _devData.rwDataLen = 0;
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static void callbackSetRxTxEn(uint8_t, uint8_t) {}
+
+  bool readBms(SerialBmsSimulator& sim)
+  {
+    return SylcinBms_readBmsData(&sim, SERIAL_NR, &callbackSetRxTxEn, &_devData);
+  }
+
+  /** Returns the byte i of an ASCII hex request (without the '~') */
+  static uint8_t requestByte(const std::vector<uint8_t>& request, std::size_t i)
+  {
+    return sylcinconvertAsciiHexToByte(request[1 + 2 * i], request[2 + 2 * i]);
+  }
+
+  static void appendHex(std::vector<uint8_t>& frame, uint8_t value)
+  {
+    static constexpr char hex[] = "0123456789ABCDEF";
+    frame.push_back(hex[value >> 4]);
+    frame.push_back(hex[value & 0x0F]);
+  }
+
+  static void append16(std::vector<uint8_t>& data, uint16_t value)
+  {
+    data.push_back(value >> 8);
+    data.push_back(value & 0xFF);
+  }
+
+  /** Builds an answer frame: '~', VER, ADR, CID1, RTN, LENID, info (all ASCII hex), checksum (4 chars), CR */
+  static std::vector<uint8_t> makeFrame(const std::vector<uint8_t>& info, uint8_t address = 1, uint8_t rtn = 0x00)
+  {
+    const uint16_t lenid = sylcinlCrc(info.size() * 2);
+    std::vector<uint8_t> bytes {0x52, address, 0x46, rtn, static_cast<uint8_t>(lenid >> 8), static_cast<uint8_t>(lenid)};
+    bytes.insert(bytes.end(), info.begin(), info.end());
+
+    std::vector<uint8_t> frame {START_BYTE};
+    for (uint8_t b : bytes) appendHex(frame, b);
+
+    uint16_t sum = 0;
+    for (std::size_t i = 1; i < frame.size(); ++i) sum += frame[i];
+    const uint16_t checksum = ~sum + 1;
+    appendHex(frame, checksum >> 8);
+    appendHex(frame, checksum & 0xFF);
+    frame.push_back(0x0D);
+    return frame;
+  }
+
+  /** Recorded analog values (66 bytes): 16 cells 3300mV + cellNr, 6 NTCs, -5.00A, 52.80V, 87% */
+  static std::vector<uint8_t> analogFrame(uint8_t address = 1, uint8_t rtn = 0x00)
+  {
+    std::vector<uint8_t> info {0x01, 16};         // Battery number, number of cells
+    for (uint16_t i = 0; i < 16; ++i) append16(info, 3300 + i);
+    info.push_back(6);                            // Number of temperatures
+    append16(info, 40 + 25);                      // Cell temperature 1, °C + 40
+    append16(info, 40 + 27);                      // Cell temperature 2
+    append16(info, 40 + 24);                      // Cell temperature 3
+    append16(info, 40 + 24);                      // Cell temperature 4
+    append16(info, 40 + 22);                      // Environment temperature
+    append16(info, 40 + 30);                      // Mosfet temperature
+    append16(info, static_cast<uint16_t>(-500));  // Current, 10mA
+    append16(info, 5280);                         // Total voltage, 10mV
+    append16(info, 13390);                        // Remaining capacity, 10mAh
+    info.push_back(2);                            // Custom number
+    append16(info, 17000);                        // Battery capacity, 10mAh
+    append16(info, 70);                           // Cycles
+    info.push_back(87);                           // SoC, %
+    info.push_back(100);                          // SoH, %
+    info.insert(info.end(), 6, 0x00);             // Reserved
+    return makeFrame(info, address, rtn);
+  }
+
+  /** Recorded alarms (46 bytes): no byte alarms, OEM byte 2 and the FET state (OEM byte 6) are given */
+  static std::vector<uint8_t> alarmFrame(uint8_t oem2 = 0x00, uint8_t fetState = 0x03)
+  {
+    std::vector<uint8_t> info {0x01, 16};         // Group, number of cells
+    info.insert(info.end(), 16, 0x00);            // Cell alarms
+    info.push_back(6);                            // Number of temperatures
+    info.insert(info.end(), 6, 0x00);             // Temperature alarms
+    info.push_back(0x00);                         // Current alarm
+    info.push_back(0x00);                         // Total voltage alarm
+    info.push_back(0x00);                         // Short circuit state
+    info.push_back(0x00);                         // Short circuit times
+    info.push_back(16);                           // Number of OEM bytes
+    info.push_back(0x00);                         // OEM 1
+    info.push_back(oem2);                         // OEM 2: voltage and current protections
+    info.insert(info.end(), 3, 0x00);             // OEM 3..5
+    info.push_back(fetState);                     // OEM 6: FET state
+    info.insert(info.end(), 10, 0x00);            // OEM 7..16
+    return makeFrame(info);
+  }
+
+  static void verifyAnalog(uint8_t bmsDataNr = BMS_DATA_NR)
+  {
+    for (uint8_t i = 0; i < 16; ++i)
+      ASSERT_EQ(3300 + i, getBmsCellVoltage(bmsDataNr, i)) << "Failed cell: " << static_cast<int>(i);
+
+    ASSERT_EQ(3315, getBmsMaxCellVoltage(bmsDataNr));
+    ASSERT_EQ(3300, getBmsMinCellVoltage(bmsDataNr));
+    ASSERT_EQ(15, getBmsMaxVoltageCellNumber(bmsDataNr));
+    ASSERT_EQ(0, getBmsMinVoltageCellNumber(bmsDataNr));
+    ASSERT_EQ(15, getBmsMaxCellDifferenceVoltage(bmsDataNr));
+    ASSERT_EQ(3307, getBmsAvgVoltage(bmsDataNr));
+
+    ASSERT_FLOAT_EQ(25.0f, getBmsTempature(bmsDataNr, 0));
+    ASSERT_FLOAT_EQ(27.0f, getBmsTempature(bmsDataNr, 1));
+    ASSERT_FLOAT_EQ(24.0f, getBmsTempature(bmsDataNr, 2));
+    ASSERT_FLOAT_EQ(-5.0f, getBmsTotalCurrent(bmsDataNr));
+    ASSERT_FLOAT_EQ(52.8f, getBmsTotalVoltage(bmsDataNr));
+    ASSERT_EQ(87, getBmsChargePercentage(bmsDataNr));
+  }
+
+  static void verifyAlarms(uint8_t bmsDataNr = BMS_DATA_NR)
+  {
+    ASSERT_EQ(0u, getBmsErrors(bmsDataNr));
+    ASSERT_TRUE(getBmsStateFETsCharge(bmsDataNr));
+    ASSERT_TRUE(getBmsStateFETsDischarge(bmsDataNr));
+  }
+
+  serialDevData_s _devData;
+};
+
+TEST_F(SylcinBmsTest, CleanResponses_AllValuesUpdated)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(analogFrame());
+  sim.addResponse(alarmFrame());
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(2u, sim.getRequests().size());
+  ASSERT_EQ(0x01, requestByte(sim.getRequests()[0], 1)); // The Sylcin addresses start at 1
+  ASSERT_EQ(CID2_ANALOG, requestByte(sim.getRequests()[0], 3));
+  ASSERT_EQ(CID2_ALARMS, requestByte(sim.getRequests()[1], 3));
+  ASSERT_EQ(0u, sim.getUnreadBytes());
+
+  verifyAnalog();
+  verifyAlarms();
+}
+
+TEST_F(SylcinBmsTest, ByteSplitsAndJitter_AllValuesUpdated)
+{
+  // The answers are long (~150 bytes) and have to arrive within 700ms, so the chunks are larger
+  FaultProfile profile;
+  profile.jitterMs = 8;
+  profile.chunkSize = 16;
+  profile.chunkGapMs = 4;
+
+  for (uint32_t seed = 1; seed <= 20; ++seed)
+  {
+    SerialBmsSimulator sim(seed);
+    sim.addResponse(analogFrame(), profile);
+    sim.addResponse(alarmFrame(), profile);
+
+    ASSERT_TRUE(readBms(sim)) << "Failed seed: " << seed;
+    verifyAnalog();
+    verifyAlarms();
+  }
+}
+
+TEST_F(SylcinBmsTest, GarbageBeforeFrame_FrameIsFound)
+{
+  SerialBmsSimulator sim;
+  FaultProfile profile;
+  profile.garbage = sim.randomBytes(20, {START_BYTE}); // The driver resyncs on the start byte only
+
+  sim.addResponse(analogFrame(), profile);
+  sim.addResponse(alarmFrame(), profile);
+
+  ASSERT_TRUE(readBms(sim));
+  verifyAnalog();
+  verifyAlarms();
+}
+
+TEST_F(SylcinBmsTest, Alarms_ErrorsAndFetsUpdated)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(analogFrame());
+  sim.addResponse(alarmFrame(0x01, 0x01)); // Cell overvoltage, charge FET off
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(BMS_ERR_STATUS_CELL_OVP, getBmsErrors(BMS_DATA_NR));
+  ASSERT_FALSE(getBmsStateFETsCharge(BMS_DATA_NR));
+  ASSERT_TRUE(getBmsStateFETsDischarge(BMS_DATA_NR));
+}
+
+TEST_F(SylcinBmsTest, SecondPack_AddressIsDeviceNrPlusOne)
+{
+  _devData.u8_deviceNr = 1;
+  _devData.u8_NumberOfDevices = 2;
+  _devData.u8_BmsDataAdr = 1;
+
+  SerialBmsSimulator sim;
+  sim.addResponse(analogFrame(2));
+  sim.addResponse(alarmFrame());
+
+  ASSERT_TRUE(readBms(sim));
+  ASSERT_EQ(2, requestByte(sim.getRequests()[0], 1));
+  ASSERT_EQ(2, requestByte(sim.getRequests()[1], 1));
+  verifyAnalog(BMS_DATA_NR + 1);
+  verifyAlarms(BMS_DATA_NR + 1);
+  ASSERT_EQ(0xFFFF, getBmsCellVoltage(BMS_DATA_NR, 0));
+}
+
+TEST_F(SylcinBmsTest, ErrorReturnCode_ReadFails)
+{
+  SerialBmsSimulator sim;
+  sim.addResponse(analogFrame(1, 0x02)); // RTN: checksum error
+  sim.addResponse(alarmFrame());
+
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_EQ(1u, sim.getRequests().size()); // The alarms are not requested
+  ASSERT_EQ(0xFFFF, getBmsCellVoltage(BMS_DATA_NR, 0));
+}
+
+TEST_F(SylcinBmsTest, Timeout_ReadFailsAndOtherValuesAreKept)
+{
+  SerialBmsSimulator sim;
+  FaultProfile timeout;
+  timeout.timeout = true;
+
+  sim.addResponse(analogFrame());
+  sim.addResponse({}, timeout);
+
+  const unsigned long startTime = millis();
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_GE(millis() - startTime, 500u); // recvAnswer timeout
+  verifyAnalog();
+}
+
+TEST_F(SylcinBmsTest, WrongChecksum_ReadFails)
+{
+  SerialBmsSimulator sim;
+  std::vector<uint8_t> frame = analogFrame();
+  frame[frame.size() - 2] = (frame[frame.size() - 2] == '0') ? '1' : '0';
+
+  sim.addResponse(frame);
+  sim.addResponse(alarmFrame());
+
+  ASSERT_FALSE(readBms(sim));
+  ASSERT_EQ(1u, sim.getRequests().size()); // The alarms are not requested
+  ASSERT_EQ(0xFFFF, getBmsCellVoltage(BMS_DATA_NR, 0));
+}
+
+
+} // namespace test
+} // namespace sylcinbms
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
@@ -0,0 +1,218 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef MOCKS_ARDUINO_H
+#define MOCKS_ARDUINO_H
+
+/**
+ * @file
+ * Minimal host replacement of the Arduino, FreeRTOS and ESP-IDF APIs used by the BSC sources.
+ * It allows to compile modules like the serial BMS drivers and the BmsData module in the native
+ * test environment.
+ *
+ * The time is simulated (see mocks::SimClock). Every call of millis()/micros() consumes a small amount
+ * of simulated CPU time, vTaskDelay()/delay()/usleep() advance the clock by the requested time.
+ * So polling loops with timeouts always terminate and run deterministically and fast on the host.
+ *
+ * NOTE: Only the subset required by the BSC sources is implemented.
+*/
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace mocks
+{
+
+/** Simulated time base for millis(), micros() and all delay functions. */
+class SimClock
+{
+  public:
+  /** Simulated CPU time consumed by each call of millis() or micros() */
+  static constexpr uint64_t CALL_COST_US {5};
+
+  static uint64_t nowUs() { return _nowUs; }
+  static void advanceUs(uint64_t us) { _nowUs += us; }
+  static void advanceMs(uint64_t ms) { _nowUs += ms * 1000; }
+  static void reset(uint64_t startUs = 0) { _nowUs = startUs; }
+
+  private:
+  static inline uint64_t _nowUs {0};
+};
+
+} // namespace mocks
+
+/* Arduino types */
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define F(string_literal) (string_literal)
+#define HEX 16
+#define DEC 10
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+
+/* Arduino time functions */
+inline unsigned long millis()
+{
+  mocks::SimClock::advanceUs(mocks::SimClock::CALL_COST_US);
+  return static_cast<unsigned long>(mocks::SimClock::nowUs() / 1000);
+}
+
+inline unsigned long micros()
+{
+  mocks::SimClock::advanceUs(mocks::SimClock::CALL_COST_US);
+  return static_cast<unsigned long>(mocks::SimClock::nowUs());
+}
+
+inline void delay(unsigned long ms) { mocks::SimClock::advanceMs(ms); }
+inline void delayMicroseconds(unsigned int us) { mocks::SimClock::advanceUs(us); }
+inline int usleep(unsigned int us) { mocks::SimClock::advanceUs(us); return 0; }
+
+// Like the ESP32 core
+using std::min;
+using std::max;
+
+/* Arduino String (reduced to the methods used by the BSC sources) */
+class String
+{
+  public:
+  String() = default;
+  String(const char* str) : _str(str ? str : "") {}
+  String(const std::string& str) : _str(str) {}
+  explicit String(char c) : _str(1, c) {}
+  explicit String(unsigned char value, unsigned char base = 10) : _str(toString(value, base)) {}
+  explicit String(int value, unsigned char base = 10) : _str(toString(value, base)) {}
+  explicit String(unsigned int value, unsigned char base = 10) : _str(toString(value, base)) {}
+  explicit String(long value, unsigned char base = 10) : _str(toString(value, base)) {}
+  explicit String(unsigned long value, unsigned char base = 10) : _str(toString(value, base)) {}
+  explicit String(float value, unsigned char decimalPlaces = 2) : _str(toString(static_cast<double>(value), decimalPlaces)) {}
+  explicit String(double value, unsigned char decimalPlaces = 2) : _str(toString(value, decimalPlaces)) {}
+
+  const char* c_str() const { return _str.c_str(); }
+  unsigned int length() const { return static_cast<unsigned int>(_str.length()); }
+  long toInt() const { return std::strtol(_str.c_str(), nullptr, 10); }
+  float toFloat() const { return std::strtof(_str.c_str(), nullptr); }
+  unsigned char reserve(unsigned int size) { _str.reserve(size); return 1; }
+  bool equals(const String& rhs) const { return _str == rhs._str; }
+
+  String& operator+=(const String& rhs) { _str += rhs._str; return *this; }
+  String& operator+=(const char* rhs) { _str += rhs; return *this; }
+  String& operator+=(char rhs) { _str += rhs; return *this; }
+
+  friend String operator+(const String& lhs, const String& rhs) { return String(lhs._str + rhs._str); }
+  friend String operator+(const char* lhs, const String& rhs) { return String(std::string(lhs) + rhs._str); }
+  friend String operator+(const String& lhs, const char* rhs) { return String(lhs._str + rhs); }
+  friend bool operator==(const String& lhs, const String& rhs) { return lhs._str == rhs._str; }
+  friend bool operator==(const String& lhs, const char* rhs) { return lhs._str == rhs; }
+
+  private:
+  template<typename T>
+  static std::string toString(T value, unsigned char base)
+  {
+    char buf[72];
+    if (base == 16) std::snprintf(buf, sizeof(buf), "%llx", static_cast<unsigned long long>(value));
+    else std::snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(value));
+    return buf;
+  }
+
+  static std::string toString(double value, unsigned char decimalPlaces)
+  {
+    char buf[72];
+    std::snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+    return buf;
+  }
+
+  std::string _str;
+};
+
+/* Arduino Print and Stream interfaces */
+class Print
+{
+  public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t data) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size)
+  {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char* str) { return write(reinterpret_cast<const uint8_t*>(str), std::strlen(str)); }
+  virtual void flush() {}
+};
+
+class Stream : public Print
+{
+  public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  size_t readBytes(uint8_t* buffer, size_t length)
+  {
+    size_t n = 0;
+    while (n < length && available() > 0) buffer[n++] = static_cast<uint8_t>(read());
+    return n;
+  }
+};
+
+/* FreeRTOS */
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef void* SemaphoreHandle_t;
+typedef void* TaskHandle_t;
+
+#define portMAX_DELAY 0xFFFFFFFFUL
+#define portTICK_PERIOD_MS 1
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define pdMS_TO_TICKS(ms) (static_cast<TickType_t>(ms))
+
+inline void vTaskDelay(TickType_t ticks) { mocks::SimClock::advanceMs(ticks); }
+inline TickType_t xTaskGetTickCount() { return static_cast<TickType_t>(mocks::SimClock::nowUs() / 1000); }
+
+// The host tests are single threaded, so the mutexes are just dummies
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { static int dummy; return &dummy; }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+// Binary semaphores are signaled by other tasks (e.g. UART events), which do not exist on the host
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return nullptr; }
+
+/* ESP-IDF logging */
+typedef enum
+{
+  ESP_LOG_NONE,
+  ESP_LOG_ERROR,
+  ESP_LOG_WARN,
+  ESP_LOG_INFO,
+  ESP_LOG_DEBUG,
+  ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+#ifndef LOG_LOCAL_LEVEL_BSC
+#define LOG_LOCAL_LEVEL_BSC ESP_LOG_NONE
+#endif
+
+#define LOG_SYSTEM_TIME_FORMAT(letter, format) #letter " (%s) %s: " format "\n"
+
+inline void esp_log_write(esp_log_level_t, const char*, const char*, ...) {}
+
+#define ESP_LOGE(tag, format, ...) do {} while(0)
+#define ESP_LOGW(tag, format, ...) do {} while(0)
+#define ESP_LOGI(tag, format, ...) do {} while(0)
+#define ESP_LOGD(tag, format, ...) do {} while(0)
+#define ESP_LOGV(tag, format, ...) do {} while(0)
+
+#endif // MOCKS_ARDUINO_H
@@ -0,0 +1,82 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef MOCKS_BSCFAKES_H
+#define MOCKS_BSCFAKES_H
+
+#include <Arduino.h>
+#include <map>
+#include <utility>
+#include "WebSettings.h"
+#include "mqtt_t.h"
+#include "bscTime.h"
+
+/**
+ * @file
+ * Fake implementations of the BSC modules, which are required to link the BmsData module and the
+ * serial BMS drivers in the native test environment:
+ *  - WebSettings: The parameters are read from mocks::FakeSettings (default 0), strings are empty.
+ *  - mqtt: mqttPublish() only counts the messages (mocks::FakeMqtt).
+ *  - bscTime: getBscDateTimeCc() returns an empty string.
+ *
+ * NOTE: This file contains definitions and must be included only once per test application.
+*/
+
+namespace mocks
+{
+
+class FakeSettings
+{
+  public:
+  static void setInt(uint16_t name, uint8_t groupNr, int32_t value) { values()[{name, groupNr}] = value; }
+  static void clear() { values().clear(); }
+
+  static int32_t getInt(uint16_t name, uint8_t groupNr)
+  {
+    const auto it = values().find({name, groupNr});
+    return (it != values().end()) ? it->second : 0;
+  }
+
+  private:
+  static std::map<std::pair<uint16_t, uint8_t>, int32_t>& values()
+  {
+    static std::map<std::pair<uint16_t, uint8_t>, int32_t> settings;
+    return settings;
+  }
+};
+
+struct FakeMqtt
+{
+  static inline uint32_t publishCount {0};
+};
+
+} // namespace mocks
+
+/* WebSettings */
+String  WebSettings::getString(uint16_t, uint8_t) { return String(); }
+int32_t WebSettings::getInt(uint16_t name, uint8_t) { return mocks::FakeSettings::getInt(name, 0); }
+int32_t WebSettings::getInt(uint16_t name, uint8_t groupNr, uint8_t) { return mocks::FakeSettings::getInt(name, groupNr); }
+int     WebSettings::getIntFlash(uint16_t name, uint8_t groupNr, uint8_t) { return mocks::FakeSettings::getInt(name, groupNr); }
+int     WebSettings::getIntFlash(uint16_t name, uint8_t groupNr) { return mocks::FakeSettings::getInt(name, groupNr); }
+float   WebSettings::getFloat(uint16_t name) { return static_cast<float>(mocks::FakeSettings::getInt(name, 0)); }
+float   WebSettings::getFloat(uint16_t name, uint8_t groupNr) { return static_cast<float>(mocks::FakeSettings::getInt(name, groupNr)); }
+float   WebSettings::getFloatFlash(uint16_t name, uint8_t groupNr) { return static_cast<float>(mocks::FakeSettings::getInt(name, groupNr)); }
+float   WebSettings::getFloatFlash(uint16_t name) { return static_cast<float>(mocks::FakeSettings::getInt(name, 0)); }
+bool    WebSettings::getBool(uint16_t name) { return mocks::FakeSettings::getInt(name, 0) != 0; }
+bool    WebSettings::getBool(uint16_t name, uint8_t groupNr) { return mocks::FakeSettings::getInt(name, groupNr) != 0; }
+boolean WebSettings::getBoolFlash(uint16_t name, uint8_t groupNr) { return mocks::FakeSettings::getInt(name, groupNr) != 0; }
+boolean WebSettings::getBoolFlash(uint16_t name) { return mocks::FakeSettings::getInt(name, 0) != 0; }
+
+/* mqtt */
+void mqttPublish(int8_t, int8_t, int8_t, int8_t, String) { mocks::FakeMqtt::publishCount++; }
+void mqttPublish(int8_t, int8_t, int8_t, int8_t, uint32_t) { mocks::FakeMqtt::publishCount++; }
+void mqttPublish(int8_t, int8_t, int8_t, int8_t, int32_t) { mocks::FakeMqtt::publishCount++; }
+void mqttPublish(int8_t, int8_t, int8_t, int8_t, float) { mocks::FakeMqtt::publishCount++; }
+void mqttPublish(int8_t, int8_t, int8_t, int8_t, bool) { mocks::FakeMqtt::publishCount++; }
+
+/* bscTime */
+const char* getBscDateTimeCc() { return ""; }
+
+#endif // MOCKS_BSCFAKES_H
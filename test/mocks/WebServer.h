@@ -0,0 +1,19 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef MOCKS_WEBSERVER_H
+#define MOCKS_WEBSERVER_H
+
+#include <Arduino.h>
+
+/**
+ * @file
+ * Host replacement of the ESP32 WebServer. Only the type is required to compile headers like WebSettings.h.
+*/
+class WebServer
+{
+};
+
+#endif // MOCKS_WEBSERVER_H
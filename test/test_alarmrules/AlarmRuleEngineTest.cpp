@@ -0,0 +1,515 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <AlarmRuleEngine.hpp>
+
+namespace test
+{
+
+using namespace alarmrules;
+
+/** Synthetic data source for the RuleEngine */
+class FakeAlarmData
+{
+  public:
+  static constexpr uint8_t NUMBER_OF_BMS {4};
+
+  FakeAlarmData()
+  {
+    for (uint8_t i = 0; i < NUMBER_OF_BMS; ++i)
+    {
+      for (std::size_t c = 0; c < BMSDATA_MAX_CELLS; ++c) bmsData[i].cellVoltage[c] = 3300;
+      bmsData[i].totalVoltage = 5280;
+    }
+  }
+
+  const BmsDataSnapshot& bms(uint8_t bmsNr) { bmsReads++; return bmsData[bmsNr]; }
+  float owTemperature(uint8_t sensorNr) { return owTemp[sensorNr]; }
+  uint8_t cellVoltageUnchangedCycles(uint8_t bmsNr) { return unchangedCycles[bmsNr]; }
+  uint8_t owSensorErrors() { return owErrors; }
+  bool batteryOnline() { return online; }
+  uint16_t soc() { return socValue; }
+  uint8_t digitalInputs() { return inputs; }
+
+  BmsDataSnapshot bmsData[NUMBER_OF_BMS] {};
+  float owTemp[8] {};
+  uint8_t unchangedCycles[NUMBER_OF_BMS] {};
+  uint8_t owErrors {0};
+  bool online {true};
+  uint16_t socValue {50};
+  uint8_t inputs {0};
+  uint32_t bmsReads {0};
+};
+
+class AlarmRuleEngineTest :
+  public ::testing::Test
+{
+  protected:
+  static constexpr std::size_t MAX_RULES {16};
+  static constexpr std::size_t TRIGGERS {10};
+
+  AlarmRuleEngineTest() {}
+  virtual ~AlarmRuleEngineTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  /** One cycle as in runAlarmRules() */
+  void run(uint32_t nowMs = 0)
+  {
+    triggers.beginCycle();
+    engine.evaluate(table, data, nowMs, triggers);
+  }
+
+  static Rule makeRule(RuleType type, uint8_t trigger)
+  {
+    Rule rule {};
+    rule.type = type;
+    rule.trigger = trigger;
+    return rule;
+  }
+
+  static uint16_t causeBit(Cause cause) { return static_cast<uint16_t>(1 << static_cast<uint8_t>(cause)); }
+
+  RuleTable<MAX_RULES> table;
+  RuleEngine<MAX_RULES> engine;
+  TriggerState<TRIGGERS> triggers;
+  FakeAlarmData data;
+};
+
+TEST_F(AlarmRuleEngineTest, EvaluatesOnlyTheRulesOfTheTable)
+{
+  run();
+  EXPECT_EQ(0u, data.bmsReads);
+  for (std::size_t i = 0; i < TRIGGERS; ++i) EXPECT_FALSE(triggers.isActive(i));
+
+  Rule rule = makeRule(RuleType::BMS_TOTAL_VOLTAGE_RANGE, 1);
+  rule.source = 2;
+  rule.low = 48;
+  rule.high = 56;
+  ASSERT_TRUE(table.add(rule));
+  run();
+  EXPECT_EQ(1u, data.bmsReads);
+
+  for (std::size_t i = 1; i < MAX_RULES; ++i) ASSERT_TRUE(table.add(rule));
+  EXPECT_FALSE(table.add(rule)) << "Table is full";
+  EXPECT_EQ(MAX_RULES, table.size());
+}
+
+TEST_F(AlarmRuleEngineTest, CellVoltageChecksTheConfiguredCells)
+{
+  Rule rule = makeRule(RuleType::BMS_CELL_VOLTAGE_RANGE, 3);
+  rule.source = 1;
+  rule.first = 0;
+  rule.last = 15;
+  rule.low = 2800;
+  rule.high = 3600;
+  table.add(rule);
+
+  run();
+  EXPECT_FALSE(triggers.isActive(2));
+
+  data.bmsData[1].cellVoltage[16] = 2000; // Not monitored
+  run();
+  EXPECT_FALSE(triggers.isActive(2));
+
+  data.bmsData[1].cellVoltage[15] = 3601;
+  run();
+  EXPECT_TRUE(triggers.isActive(2));
+  EXPECT_EQ(causeBit(Cause::BMS_CELL_VOLTAGE_RANGE), triggers.causes(2));
+
+  data.bmsData[1].cellVoltage[15] = 3600;
+  run();
+  EXPECT_FALSE(triggers.isActive(2));
+  EXPECT_EQ(0, triggers.causes(2));
+}
+
+TEST_F(AlarmRuleEngineTest, TotalVoltageHysteresis)
+{
+  Rule rule = makeRule(RuleType::BMS_TOTAL_VOLTAGE_RANGE, 1);
+  rule.source = 0;
+  rule.low = 48.0f;
+  rule.high = 56.0f;
+  rule.hysteresis = 1.0f;
+  table.add(rule);
+
+  const auto runWithVoltage = [&](int16_t voltage10mV) { data.bmsData[0].totalVoltage = voltage10mV; run(); return triggers.isActive(0); };
+
+  EXPECT_FALSE(runWithVoltage(5000));
+  EXPECT_TRUE(runWithVoltage(4790));
+  EXPECT_EQ(causeBit(Cause::BMS_TOTAL_VOLTAGE_MIN), triggers.causes(0));
+  EXPECT_TRUE(runWithVoltage(4850)) << "Within the hysteresis";
+  EXPECT_TRUE(runWithVoltage(4900)) << "Within the hysteresis";
+  EXPECT_FALSE(runWithVoltage(4910));
+  EXPECT_FALSE(runWithVoltage(4850)) << "Hysteresis is only used after an alarm";
+
+  EXPECT_TRUE(runWithVoltage(5610));
+  EXPECT_EQ(causeBit(Cause::BMS_TOTAL_VOLTAGE_MAX), triggers.causes(0));
+  EXPECT_TRUE(runWithVoltage(5500));
+  EXPECT_FALSE(runWithVoltage(5490));
+
+  // Directly from max to min
+  EXPECT_TRUE(runWithVoltage(5610));
+  EXPECT_TRUE(runWithVoltage(4700));
+  EXPECT_EQ(causeBit(Cause::BMS_TOTAL_VOLTAGE_MIN), triggers.causes(0));
+}
+
+TEST_F(AlarmRuleEngineTest, TemperatureMaxWithHysteresisIgnoresReadErrors)
+{
+  Rule rule = makeRule(RuleType::TEMP_MAX, 2);
+  rule.source = static_cast<uint8_t>(TempSource::ONEWIRE);
+  rule.first = 1;
+  rule.last = 3;
+  rule.high = 40.0f;
+  rule.hysteresis = 5.0f;
+  table.add(rule);
+
+  data.owTemp[0] = 80.0f; // Not monitored
+  data.owTemp[2] = SENSOR_READ_ERROR;
+  run();
+  EXPECT_FALSE(triggers.isActive(1));
+
+  data.owTemp[3] = 40.5f;
+  run();
+  EXPECT_TRUE(triggers.isActive(1));
+  EXPECT_EQ(causeBit(Cause::TEMPERATURE), triggers.causes(1));
+
+  data.owTemp[3] = 36.0f;
+  run();
+  EXPECT_TRUE(triggers.isActive(1)) << "Within the hysteresis";
+
+  data.owTemp[3] = 35.0f;
+  run();
+  EXPECT_FALSE(triggers.isActive(1));
+
+  data.owTemp[3] = 36.0f;
+  run();
+  EXPECT_FALSE(triggers.isActive(1));
+}
+
+TEST_F(AlarmRuleEngineTest, TemperatureOfTheBmsAndReference)
+{
+  Rule rule = makeRule(RuleType::TEMP_MAX_REFERENCE, 4);
+  rule.source = static_cast<uint8_t>(TempSource::BMS);
+  rule.bms = 2;
+  rule.first = 1;
+  rule.last = 2;
+  rule.limit = 0;        // Reference sensor
+  rule.high = 10.0f;     // Offset
+  rule.hysteresis = 2.0f;
+  table.add(rule);
+
+  data.bmsData[2].temperature[0] = 2000;
+  data.bmsData[2].temperature[1] = 2900;
+  data.bmsData[2].temperature[2] = 3000;
+  run();
+  EXPECT_FALSE(triggers.isActive(3));
+
+  data.bmsData[2].temperature[2] = 3001;
+  run();
+  EXPECT_TRUE(triggers.isActive(3));
+
+  data.bmsData[2].temperature[0] = 2300; // Reference rises above the hysteresis
+  run();
+  EXPECT_FALSE(triggers.isActive(3));
+}
+
+TEST_F(AlarmRuleEngineTest, TemperatureDifference)
+{
+  Rule rule = makeRule(RuleType::TEMP_DIFFERENCE, 5);
+  rule.source = static_cast<uint8_t>(TempSource::ONEWIRE);
+  rule.first = 0;
+  rule.last = 2;
+  rule.high = 10.0f;
+  rule.hysteresis = 3.0f;
+  table.add(rule);
+
+  data.owTemp[0] = 20.0f;
+  data.owTemp[1] = 25.0f;
+  data.owTemp[2] = 29.0f;
+  run();
+  EXPECT_FALSE(triggers.isActive(4));
+
+  data.owTemp[2] = 30.0f;
+  run();
+  EXPECT_TRUE(triggers.isActive(4));
+
+  data.owTemp[2] = 27.0f;
+  run();
+  EXPECT_TRUE(triggers.isActive(4)) << "Within the hysteresis";
+
+  data.owTemp[2] = 26.9f;
+  run();
+  EXPECT_FALSE(triggers.isActive(4));
+}
+
+TEST_F(AlarmRuleEngineTest, NoDataAfterTheDelay)
+{
+  Rule rule = makeRule(RuleType::BMS_NO_DATA, 6);
+  rule.source = 3;
+  rule.limit = 10; // s
+  table.add(rule);
+
+  data.bmsData[3].lastDataMillis = 5000;
+  run(5000);
+  EXPECT_FALSE(triggers.isActive(5));
+  run(15000);
+  EXPECT_FALSE(triggers.isActive(5)) << "Exactly the delay";
+  run(15001);
+  EXPECT_TRUE(triggers.isActive(5));
+  EXPECT_EQ(causeBit(Cause::BMS_NO_DATA), triggers.causes(5));
+
+  data.bmsData[3].lastDataMillis = 15500;
+  run(15600);
+  EXPECT_FALSE(triggers.isActive(5));
+
+  // Overflow of millis()
+  data.bmsData[3].lastDataMillis = 0xFFFFF000;
+  run(0x00000100);
+  EXPECT_FALSE(triggers.isActive(5));
+}
+
+TEST_F(AlarmRuleEngineTest, OwSensorErrorsAndPlausibility)
+{
+  Rule owRule = makeRule(RuleType::OW_SENSOR_ERROR, 7);
+  owRule.limit = 3;
+  table.add(owRule);
+
+  Rule plausibilityRule = makeRule(RuleType::CELL_VOLTAGE_PLAUSIBILITY, 8);
+  plausibilityRule.first = 1;
+  plausibilityRule.last = 3;
+  plausibilityRule.limit = 5;
+  table.add(plausibilityRule);
+
+  data.owErrors = 3;
+  data.unchangedCycles[0] = 100; // Not monitored
+  data.unchangedCycles[2] = 5;
+  run();
+  EXPECT_FALSE(triggers.isActive(6));
+  EXPECT_FALSE(triggers.isActive(7));
+
+  data.owErrors = 4;
+  data.unchangedCycles[2] = 6;
+  run();
+  EXPECT_TRUE(triggers.isActive(6));
+  EXPECT_TRUE(triggers.isActive(7)) << "One BMS is enough, even if the following are ok";
+}
+
+TEST_F(AlarmRuleEngineTest, SocLatchesBetweenOnAndOff)
+{
+  Rule chargedRule = makeRule(RuleType::SOC, 1);
+  chargedRule.high = 90; // On
+  chargedRule.low = 80;  // Off
+  table.add(chargedRule);
+
+  Rule emptyRule = makeRule(RuleType::SOC, 2);
+  emptyRule.high = 10;   // On
+  emptyRule.low = 20;    // Off
+  table.add(emptyRule);
+
+  const auto runWithSoc = [&](uint16_t soc) { data.socValue = soc; run(); };
+
+  runWithSoc(85);
+  EXPECT_FALSE(triggers.isActive(0));
+  runWithSoc(90);
+  EXPECT_TRUE(triggers.isActive(0));
+  runWithSoc(81);
+  EXPECT_TRUE(triggers.isActive(0)) << "Latched until off";
+  runWithSoc(80);
+  EXPECT_FALSE(triggers.isActive(0));
+  runWithSoc(85);
+  EXPECT_FALSE(triggers.isActive(0));
+
+  runWithSoc(10);
+  EXPECT_TRUE(triggers.isActive(1));
+  runWithSoc(19);
+  EXPECT_TRUE(triggers.isActive(1));
+  runWithSoc(20);
+  EXPECT_FALSE(triggers.isActive(1));
+
+  // Without battery the trigger keeps its state, but the latch is reset
+  runWithSoc(95);
+  EXPECT_TRUE(triggers.isActive(0));
+  data.online = false;
+  runWithSoc(85);
+  EXPECT_TRUE(triggers.isActive(0));
+  data.online = true;
+  runWithSoc(85);
+  EXPECT_TRUE(triggers.isActive(0)) << "Not touched between on and off";
+  runWithSoc(80);
+  EXPECT_TRUE(triggers.isActive(0)) << "Latch was reset, so off is not handled";
+}
+
+TEST_F(AlarmRuleEngineTest, DigitalInputs)
+{
+  Rule rule = makeRule(RuleType::DIGITAL_INPUT, 9);
+  rule.source = 2;
+  table.add(rule);
+  rule.trigger = 10;
+  rule.flags = FLAG_INVERT;
+  table.add(rule);
+
+  data.inputs = 0x04;
+  run();
+  EXPECT_TRUE(triggers.isActive(8));
+  EXPECT_FALSE(triggers.isActive(9));
+  EXPECT_EQ(causeBit(Cause::DI), triggers.causes(8));
+
+  data.inputs = 0x0B;
+  run();
+  EXPECT_FALSE(triggers.isActive(8));
+  EXPECT_TRUE(triggers.isActive(9));
+}
+
+TEST_F(AlarmRuleEngineTest, ActiveRuleWinsWithinOneCycle)
+{
+  // Two rules for the same trigger; the order must not matter
+  Rule input = makeRule(RuleType::DIGITAL_INPUT, 1);
+  input.source = 0;
+  Rule ow = makeRule(RuleType::OW_SENSOR_ERROR, 1);
+  ow.limit = 0;
+  table.add(input);
+  table.add(ow);
+
+  data.inputs = 0x00;
+  data.owErrors = 1;
+  run();
+  EXPECT_TRUE(triggers.isActive(0));
+  EXPECT_EQ(causeBit(Cause::OW_SENSOR_ERROR), triggers.causes(0));
+
+  data.inputs = 0x01;
+  data.owErrors = 0;
+  run();
+  EXPECT_TRUE(triggers.isActive(0));
+  EXPECT_EQ(causeBit(Cause::DI), triggers.causes(0));
+
+  data.inputs = 0x01;
+  data.owErrors = 1;
+  run();
+  EXPECT_EQ(causeBit(Cause::DI) | causeBit(Cause::OW_SENSOR_ERROR), triggers.causes(0));
+
+  data.inputs = 0x00;
+  data.owErrors = 0;
+  run();
+  EXPECT_FALSE(triggers.isActive(0));
+}
+
+TEST_F(AlarmRuleEngineTest, TriggerStateIgnoresInvalidTriggersAndResets)
+{
+  triggers.beginCycle();
+  triggers.set(0, true, Cause::SOC);
+  triggers.set(TRIGGERS + 1, true, Cause::SOC);
+  triggers.set(TRIGGERS, true, Cause::VIRTUAL_TRIGGER);
+  for (std::size_t i = 0; i + 1 < TRIGGERS; ++i) EXPECT_FALSE(triggers.isActive(i));
+  EXPECT_TRUE(triggers.isActive(TRIGGERS - 1));
+
+  // Not touched in the next cycle: keeps the state, but the causes are cleared
+  triggers.beginCycle();
+  EXPECT_TRUE(triggers.isActive(TRIGGERS - 1));
+  EXPECT_EQ(0, triggers.causes(TRIGGERS - 1));
+
+  triggers.reset(TRIGGERS - 1);
+  EXPECT_FALSE(triggers.isActive(TRIGGERS - 1));
+}
+
+TEST_F(AlarmRuleEngineTest, ResetClearsTheHysteresis)
+{
+  Rule rule = makeRule(RuleType::BMS_TOTAL_VOLTAGE_RANGE, 1);
+  rule.low = 48.0f;
+  rule.high = 56.0f;
+  rule.hysteresis = 2.0f;
+  table.add(rule);
+
+  data.bmsData[0].totalVoltage = 4700;
+  run();
+  EXPECT_TRUE(triggers.isActive(0));
+
+  engine.reset();
+  triggers.reset(0);
+  data.bmsData[0].totalVoltage = 4900;
+  run();
+  EXPECT_FALSE(triggers.isActive(0));
+}
+
+TEST_F(AlarmRuleEngineTest, UpdateKeepsTheLatchesOfUnchangedRules)
+{
+  Rule otherRule = makeRule(RuleType::DIGITAL_INPUT, 3);
+  table.add(otherRule);
+  Rule socRule = makeRule(RuleType::SOC, 1);
+  socRule.high = 90; // On
+  socRule.low = 80;  // Off
+  table.add(socRule);
+  Rule voltageRule = makeRule(RuleType::BMS_TOTAL_VOLTAGE_RANGE, 2);
+  voltageRule.low = 48.0f;
+  voltageRule.high = 56.0f;
+  voltageRule.hysteresis = 2.0f;
+  table.add(voltageRule);
+  engine.update(table, triggers);
+
+  data.socValue = 95;
+  data.bmsData[0].totalVoltage = 4700;
+  run();
+  ASSERT_TRUE(triggers.isActive(0));
+  ASSERT_TRUE(triggers.isActive(1));
+
+  // An unrelated parameter was changed: the view is rebuilt with the same rules (here in a different order)
+  table.clear();
+  table.add(voltageRule);
+  table.add(socRule);
+  table.add(otherRule);
+  engine.update(table, triggers);
+
+  data.socValue = 85;
+  data.bmsData[0].totalVoltage = 4900;
+  run();
+  EXPECT_TRUE(triggers.isActive(0)) << "Still latched until off";
+  EXPECT_TRUE(triggers.isActive(1)) << "Within the hysteresis";
+
+  data.socValue = 80;
+  data.bmsData[0].totalVoltage = 5100;
+  run();
+  EXPECT_FALSE(triggers.isActive(0));
+  EXPECT_FALSE(triggers.isActive(1));
+}
+
+TEST_F(AlarmRuleEngineTest, UpdateReleasesTheTriggersOfChangedRules)
+{
+  Rule socRule = makeRule(RuleType::SOC, 1);
+  socRule.high = 90;
+  socRule.low = 80;
+  table.add(socRule);
+  engine.update(table, triggers);
+
+  data.socValue = 95;
+  run();
+  ASSERT_TRUE(triggers.isActive(0));
+
+  // The on threshold was changed; the SoC is between off and the new on threshold
+  table.clear();
+  socRule.high = 98;
+  table.add(socRule);
+  engine.update(table, triggers);
+  run();
+  EXPECT_FALSE(triggers.isActive(0)) << "Evaluated again without the latch of the old rule";
+
+  data.socValue = 98;
+  run();
+  EXPECT_TRUE(triggers.isActive(0));
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
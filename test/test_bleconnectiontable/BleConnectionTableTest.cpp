@@ -0,0 +1,139 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <BleConnectionTable.hpp>
+
+namespace test
+{
+
+class BleConnectionTableTest :
+  public ::testing::Test
+{
+  protected:
+  BleConnectionTableTest() {}
+  virtual ~BleConnectionTableTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+};
+
+TEST_F(BleConnectionTableTest, FindsTheDeviceOfAConnection)
+{
+  ble::ConnectionTable<7> table;
+  EXPECT_EQ(ble::NO_DEVICE, table.find(0));
+  EXPECT_EQ(ble::NO_DEVICE, table.find(ble::INVALID_CONN_HANDLE));
+
+  table.add(1, 3);
+  table.add(2, 0);
+  table.add(500, 6); // Not in the direct slots
+  EXPECT_EQ(3, table.find(1));
+  EXPECT_EQ(0, table.find(2));
+  EXPECT_EQ(6, table.find(500));
+  EXPECT_EQ(ble::NO_DEVICE, table.find(3));
+  EXPECT_EQ(ble::NO_DEVICE, table.find(501));
+  EXPECT_EQ(500, table.handle(6));
+}
+
+TEST_F(BleConnectionTableTest, ReconnectReplacesTheOldHandle)
+{
+  ble::ConnectionTable<7> table;
+  table.add(1, 3);
+  table.add(4, 3);
+  EXPECT_EQ(ble::NO_DEVICE, table.find(1));
+  EXPECT_EQ(3, table.find(4));
+
+  // The handle is reused by the host for another device
+  table.add(4, 5);
+  EXPECT_EQ(5, table.find(4));
+  EXPECT_EQ(ble::INVALID_CONN_HANDLE, table.handle(3));
+
+  table.removeDevice(5);
+  EXPECT_EQ(ble::NO_DEVICE, table.find(4));
+
+  table.add(700, 2);
+  table.removeHandle(700);
+  EXPECT_EQ(ble::NO_DEVICE, table.find(700));
+}
+
+TEST_F(BleConnectionTableTest, IgnoresInvalidEntries)
+{
+  ble::ConnectionTable<7> table;
+  table.add(1, 7);
+  table.add(ble::INVALID_CONN_HANDLE, 1);
+  EXPECT_EQ(ble::NO_DEVICE, table.find(1));
+  EXPECT_EQ(ble::INVALID_CONN_HANDLE, table.handle(1));
+  EXPECT_EQ(ble::NO_DEVICE, table.find(ble::INVALID_CONN_HANDLE));
+}
+
+TEST_F(BleConnectionTableTest, MonitorCountsNotificationsAndRate)
+{
+  ble::NotifyMonitor monitor(5000, 10000);
+  monitor.connected(1000);
+
+  // 5 notifications per second for 10 s
+  uint32_t now = 1000;
+  for (uint32_t i = 0; i < 50; ++i)
+  {
+    now += 200;
+    monitor.notify(now, 128);
+  }
+
+  ble::NotifyStatistics stats = monitor.statistics(now);
+  EXPECT_EQ(1u, stats.connects);
+  EXPECT_EQ(50u, stats.notifications);
+  EXPECT_EQ(50u * 128u, stats.bytes);
+  EXPECT_FLOAT_EQ(5.0f, stats.notifyRate);
+  EXPECT_EQ(200u, stats.maxGapMs);
+  EXPECT_EQ(0u, stats.staleGaps);
+  EXPECT_EQ(0u, stats.lastNotifyAgeMs);
+
+  // No notifications for longer than the window
+  stats = monitor.statistics(now + 10001);
+  EXPECT_FLOAT_EQ(0.0f, stats.notifyRate);
+  EXPECT_EQ(10001u, stats.lastNotifyAgeMs);
+}
+
+TEST_F(BleConnectionTableTest, MonitorCountsStaleGapsAndErrors)
+{
+  ble::NotifyMonitor monitor(5000, 10000);
+  monitor.connected(0);
+  monitor.notify(6000, 20);   // First data 6 s after the connect
+  monitor.notify(6100, 20);
+  monitor.notify(20000, 20);
+  monitor.reassemblyError();
+
+  ble::NotifyStatistics stats = monitor.statistics(20000);
+  EXPECT_EQ(2u, stats.staleGaps);
+  EXPECT_EQ(13900u, stats.maxGapMs);
+  EXPECT_EQ(1u, stats.reassemblyErrors);
+
+  // The time without connection is no gap
+  monitor.disconnected();
+  monitor.disconnected();
+  monitor.connected(100000);
+  monitor.notify(100500, 20);
+  stats = monitor.statistics(100500);
+  EXPECT_EQ(1u, stats.disconnects);
+  EXPECT_EQ(2u, stats.connects);
+  EXPECT_EQ(2u, stats.staleGaps);
+  EXPECT_EQ(13900u, stats.maxGapMs);
+
+  monitor.disconnected();
+  EXPECT_EQ(0u, monitor.statistics(200000).lastNotifyAgeMs);
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
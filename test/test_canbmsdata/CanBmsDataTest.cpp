@@ -0,0 +1,217 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <set>
+#include <utility>
+#include <vector>
+#include <CanBmsData.hpp>
+
+namespace test
+{
+
+class CanBmsDataTest :
+  public ::testing::Test
+{
+  protected:
+  CanBmsDataTest() {}
+  virtual ~CanBmsDataTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static BmsDataSnapshot makeSnapshot(uint16_t seed)
+  {
+    BmsDataSnapshot snapshot {};
+    for (std::size_t i = 0; i < BMSDATA_MAX_CELLS; ++i)
+      snapshot.cellVoltage[i] = static_cast<uint16_t>(seed + i * 7);
+    snapshot.cellVoltage[23] = 0xFFFF;
+    snapshot.stateFETs = 0x02;
+    snapshot.isBalancingActive = 1;
+    snapshot.balancingCurrent = -321;
+    return snapshot;
+  }
+
+  /** Sends all frames of the BMS through encoder and decoder */
+  static BmsDataSnapshot roundTrip(const BmsDataSnapshot& snapshot)
+  {
+    BmsDataSnapshot decoded {};
+    for (uint8_t frame = 0; frame < canbmsdata::FRAMES_PER_BMS; ++frame)
+    {
+      uint8_t data[canbmsdata::FRAME_LEN_MAX] {};
+      const uint8_t len = canbmsdata::encodeFrame(snapshot, frame, data);
+      EXPECT_GT(len, 0) << "Frame " << (int)frame;
+      EXPECT_LE(len, canbmsdata::FRAME_LEN_MAX) << "Frame " << (int)frame;
+      EXPECT_TRUE(canbmsdata::decodeFrame(frame, data, len, decoded)) << "Frame " << (int)frame;
+    }
+    return decoded;
+  }
+};
+
+TEST_F(CanBmsDataTest, RoundTripsAllFields)
+{
+  const BmsDataSnapshot snapshot = makeSnapshot(3100);
+  const BmsDataSnapshot decoded = roundTrip(snapshot);
+
+  for (std::size_t i = 0; i < BMSDATA_MAX_CELLS; ++i)
+    ASSERT_EQ(snapshot.cellVoltage[i], decoded.cellVoltage[i]) << "Cell " << i;
+  ASSERT_EQ(snapshot.getStateFETsCharge(), decoded.getStateFETsCharge());
+  ASSERT_EQ(snapshot.getStateFETsDischarge(), decoded.getStateFETsDischarge());
+  ASSERT_EQ(snapshot.isBalancingActive, decoded.isBalancingActive);
+  ASSERT_EQ(snapshot.balancingCurrent, decoded.balancingCurrent);
+}
+
+TEST_F(CanBmsDataTest, RoundTripsAllStateCombinations)
+{
+  for (uint8_t fets = 0; fets < 4; ++fets)
+  {
+    for (uint8_t balancing = 0; balancing < 2; ++balancing)
+    {
+      BmsDataSnapshot snapshot = makeSnapshot(0);
+      snapshot.stateFETs = fets;
+      snapshot.isBalancingActive = balancing;
+      const BmsDataSnapshot decoded = roundTrip(snapshot);
+      ASSERT_EQ(fets, decoded.stateFETs);
+      ASSERT_EQ(balancing, decoded.isBalancingActive);
+    }
+  }
+
+  for (int16_t current : {INT16_MIN, -1, 0, 1, INT16_MAX})
+  {
+    BmsDataSnapshot snapshot = makeSnapshot(0);
+    snapshot.balancingCurrent = current;
+    ASSERT_EQ(current, roundTrip(snapshot).balancingCurrent);
+  }
+}
+
+/** The frames 0..5 must be identical to the former layout (packed structs on the little endian ESP32) */
+TEST_F(CanBmsDataTest, KeepsTheFormerLayoutOfTheFirstFrames)
+{
+  const BmsDataSnapshot snapshot = makeSnapshot(3300);
+  uint8_t data[canbmsdata::FRAME_LEN_MAX];
+
+  ASSERT_EQ(8, canbmsdata::encodeFrame(snapshot, 1, data));
+  const uint8_t expectedCells[] = {0x00, 0x0D, 0x07, 0x0D, 0x0E, 0x0D, 0x15, 0x0D}; // Cells 4..7: 3328, 3335, 3342, 3349
+  ASSERT_EQ(0, std::memcmp(expectedCells, data, sizeof(expectedCells)));
+
+  ASSERT_EQ(3, canbmsdata::encodeFrame(snapshot, canbmsdata::FRAME_STATE, data));
+  ASSERT_EQ(0, data[0]);
+  ASSERT_EQ(1, data[1]);
+  ASSERT_EQ(1, data[2]);
+
+  ASSERT_EQ(2, canbmsdata::encodeFrame(snapshot, canbmsdata::FRAME_BALANCING, data));
+  ASSERT_EQ(0xBF, data[0]); // -321
+  ASSERT_EQ(0xFE, data[1]);
+
+  ASSERT_EQ(0x400u, canbmsdata::canId(0, 0));
+  ASSERT_EQ(0x404u, canbmsdata::canId(0, canbmsdata::FRAME_STATE));
+  ASSERT_EQ(0x432u, canbmsdata::canId(1, 0));
+  ASSERT_EQ(0x439u, canbmsdata::canId(1, 7));
+}
+
+TEST_F(CanBmsDataTest, DecodesBmsAndFrameFromCanId)
+{
+  constexpr uint8_t NUMBER_OF_BMS {18};
+  for (uint8_t bms = 0; bms < NUMBER_OF_BMS; ++bms)
+  {
+    for (uint8_t frame = 0; frame < canbmsdata::FRAMES_PER_BMS; ++frame)
+    {
+      uint8_t bmsNr = 0xFF;
+      uint8_t frameNr = 0xFF;
+      ASSERT_TRUE(canbmsdata::fromCanId(canbmsdata::canId(bms, frame), NUMBER_OF_BMS, bmsNr, frameNr));
+      ASSERT_EQ(bms, bmsNr);
+      ASSERT_EQ(frame, frameNr);
+    }
+  }
+
+  uint8_t bmsNr, frameNr;
+  ASSERT_FALSE(canbmsdata::fromCanId(0x3FF, NUMBER_OF_BMS, bmsNr, frameNr));
+  ASSERT_FALSE(canbmsdata::fromCanId(canbmsdata::canId(0, canbmsdata::FRAMES_PER_BMS), NUMBER_OF_BMS, bmsNr, frameNr));
+  ASSERT_FALSE(canbmsdata::fromCanId(canbmsdata::canId(NUMBER_OF_BMS, 0), NUMBER_OF_BMS, bmsNr, frameNr));
+}
+
+TEST_F(CanBmsDataTest, RejectsInvalidFrames)
+{
+  BmsDataSnapshot snapshot = makeSnapshot(0);
+  uint8_t data[canbmsdata::FRAME_LEN_MAX] {};
+  ASSERT_EQ(0, canbmsdata::encodeFrame(snapshot, canbmsdata::FRAMES_PER_BMS, data));
+  ASSERT_FALSE(canbmsdata::decodeFrame(canbmsdata::FRAMES_PER_BMS, data, 8, snapshot));
+  ASSERT_FALSE(canbmsdata::decodeFrame(0, data, 7, snapshot));
+  ASSERT_FALSE(canbmsdata::decodeFrame(canbmsdata::FRAME_STATE, data, 2, snapshot));
+  ASSERT_FALSE(canbmsdata::decodeFrame(canbmsdata::FRAME_BALANCING, data, 1, snapshot));
+}
+
+TEST_F(CanBmsDataTest, SchedulerSendsOneBmsPerCycleByDefault)
+{
+  canbmsdata::Scheduler scheduler;
+  std::vector<std::pair<uint8_t, uint8_t>> sent;
+  auto send = [&sent](uint8_t bms, uint8_t frame) { sent.emplace_back(bms, frame); };
+
+  for (uint8_t cycle = 0; cycle < 3; ++cycle)
+  {
+    sent.clear();
+    ASSERT_EQ(canbmsdata::FRAMES_PER_BMS, scheduler.run(2, 0, send));
+    for (uint8_t frame = 0; frame < canbmsdata::FRAMES_PER_BMS; ++frame)
+    {
+      ASSERT_EQ(cycle % 2, sent[frame].first);
+      ASSERT_EQ(frame, sent[frame].second);
+    }
+  }
+}
+
+TEST_F(CanBmsDataTest, SchedulerLimitsFramesPerCycleAndCoversAllFrames)
+{
+  constexpr uint8_t NUMBER_OF_BMS {3};
+  constexpr uint8_t FRAMES_PER_CYCLE {5};
+  canbmsdata::Scheduler scheduler;
+  std::set<std::pair<uint8_t, uint8_t>> sent;
+  std::vector<std::pair<uint8_t, uint8_t>> order;
+  auto send = [&](uint8_t bms, uint8_t frame) { sent.emplace(bms, frame); order.emplace_back(bms, frame); };
+
+  const uint8_t cycles = (NUMBER_OF_BMS * canbmsdata::FRAMES_PER_BMS + FRAMES_PER_CYCLE - 1) / FRAMES_PER_CYCLE;
+  for (uint8_t cycle = 0; cycle < cycles; ++cycle)
+    ASSERT_EQ(FRAMES_PER_CYCLE, scheduler.run(NUMBER_OF_BMS, FRAMES_PER_CYCLE, send));
+
+  ASSERT_EQ(NUMBER_OF_BMS * canbmsdata::FRAMES_PER_BMS, sent.size());
+  for (std::size_t i = 0; i < order.size(); ++i)
+  {
+    ASSERT_EQ((i / canbmsdata::FRAMES_PER_BMS) % NUMBER_OF_BMS, order[i].first) << "Frame " << i;
+    ASSERT_EQ(i % canbmsdata::FRAMES_PER_BMS, order[i].second) << "Frame " << i;
+  }
+}
+
+TEST_F(CanBmsDataTest, SchedulerRestartsWhenTheNumberOfBmsShrinks)
+{
+  canbmsdata::Scheduler scheduler;
+  auto send = [](uint8_t, uint8_t) {};
+  scheduler.run(5, 0, send);
+  scheduler.run(5, 0, send);
+  scheduler.run(5, 3, send);
+  ASSERT_EQ(2, scheduler.nextBms());
+  ASSERT_EQ(3, scheduler.nextFrame());
+
+  // Finishes the current BMS with the default mode
+  ASSERT_EQ(canbmsdata::FRAMES_PER_BMS - 3, scheduler.run(5, 0, send));
+  ASSERT_EQ(3, scheduler.nextBms());
+
+  ASSERT_EQ(0, scheduler.run(0, 0, send));
+  scheduler.run(2, 1, send);
+  ASSERT_EQ(0, scheduler.nextBms());
+  ASSERT_EQ(1, scheduler.nextFrame());
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
@@ -0,0 +1,124 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <CommStats.hpp>
+
+namespace test
+{
+
+using commstats::Recorder;
+using commstats::Statistics;
+
+class CommStatsTest :
+  public ::testing::Test
+{
+  protected:
+  CommStatsTest() {}
+  virtual ~CommStatsTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  Recorder recorder;
+};
+
+TEST_F(CommStatsTest, SortsResponseTimesIntoTheHistogram)
+{
+  EXPECT_EQ(0u, commstats::histogramBin(0));
+  EXPECT_EQ(0u, commstats::histogramBin(9999));
+  EXPECT_EQ(1u, commstats::histogramBin(10000));
+  EXPECT_EQ(3u, commstats::histogramBin(99999));
+  EXPECT_EQ(7u, commstats::histogramBin(1999999));
+  EXPECT_EQ(8u, commstats::histogramBin(2000000));
+  EXPECT_EQ(8u, commstats::histogramBin(0xFFFFFFFF));
+}
+
+TEST_F(CommStatsTest, RecordsMinAvgMaxOfTheResponseTime)
+{
+  recorder.request();
+  recorder.response(40000);
+  Statistics stats = recorder.statistics();
+  EXPECT_EQ(40000u, stats.responseMinUs);
+  EXPECT_EQ(40000u, stats.responseAvgUs);
+  EXPECT_EQ(40000u, stats.responseMaxUs);
+
+  recorder.request();
+  recorder.response(8000);
+  recorder.request();
+  recorder.response(120000);
+  stats = recorder.statistics();
+  EXPECT_EQ(3u, stats.requests);
+  EXPECT_EQ(3u, stats.responses);
+  EXPECT_EQ(120000u, stats.responseLastUs);
+  EXPECT_EQ(8000u, stats.responseMinUs);
+  EXPECT_EQ(120000u, stats.responseMaxUs);
+  EXPECT_EQ(((40000u * 7 + 8000) / 8 * 7 + 120000) / 8, stats.responseAvgUs);
+  EXPECT_EQ(1u, stats.histogram[0]);
+  EXPECT_EQ(1u, stats.histogram[2]);
+  EXPECT_EQ(1u, stats.histogram[4]);
+}
+
+TEST_F(CommStatsTest, UsesTheGapBetweenReceivedFramesAsResponseTime)
+{
+  recorder.received(1000000, 5000000);
+  EXPECT_EQ(0u, recorder.statistics().responses);
+
+  recorder.received(1500000, 5000000);
+  recorder.received(7500000, 5000000); // Gap of 6 s: timeout
+  const Statistics stats = recorder.statistics();
+  EXPECT_EQ(2u, stats.responses);
+  EXPECT_EQ(1u, stats.timeouts);
+  EXPECT_EQ(500000u, stats.responseMinUs);
+  EXPECT_EQ(6000000u, stats.responseMaxUs);
+  EXPECT_EQ(1u, stats.histogram[6]);
+  EXPECT_EQ(1u, stats.histogram[8]);
+}
+
+TEST_F(CommStatsTest, HandlesTheOverflowOfMicros)
+{
+  recorder.received(0xFFFFFF00, 5000000);
+  recorder.received(0x00000100, 5000000);
+  EXPECT_EQ(0x200u, recorder.statistics().responseLastUs);
+  EXPECT_EQ(0u, recorder.statistics().timeouts);
+}
+
+TEST_F(CommStatsTest, CountsErrorsAndResetsAll)
+{
+  recorder.request();
+  recorder.timeout();
+  recorder.checksumError();
+  recorder.checksumError(2);
+  recorder.resync(3);
+  recorder.plausibilityTrip();
+  Statistics stats = recorder.statistics();
+  EXPECT_TRUE(commstats::hasTraffic(stats));
+  EXPECT_EQ(1u, stats.timeouts);
+  EXPECT_EQ(3u, stats.checksumErrors);
+  EXPECT_EQ(3u, stats.resyncs);
+  EXPECT_EQ(1u, stats.plausibilityTrips);
+
+  recorder.reset();
+  stats = recorder.statistics();
+  EXPECT_FALSE(commstats::hasTraffic(stats));
+  EXPECT_EQ(0u, stats.checksumErrors);
+
+  // After the reset the first received frame only starts the measurement again
+  recorder.received(1000, 5000000);
+  EXPECT_EQ(0u, recorder.statistics().responses);
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
@@ -0,0 +1,205 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+#include <I2cBulkFrame.hpp>
+#include <crc.cpp>
+
+namespace test
+{
+
+class I2cBulkFrameTest :
+  public ::testing::Test
+{
+  protected:
+  I2cBulkFrameTest() {}
+  virtual ~I2cBulkFrameTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static BmsDataSnapshot makeSnapshot()
+  {
+    BmsDataSnapshot snapshot {};
+    for (std::size_t i = 0; i < BMSDATA_MAX_CELLS; ++i)
+      snapshot.cellVoltage[i] = static_cast<uint16_t>(3200 + i * 11);
+    snapshot.cellVoltage[20] = 0xFFFF;
+    snapshot.totalVoltage = 5312;
+    snapshot.maxCellDifferenceVoltage = 253;
+    snapshot.avgVoltage = 3320;
+    snapshot.totalCurrent = -15000;
+    snapshot.maxCellVoltage = 3453;
+    snapshot.minCellVoltage = 3200;
+    snapshot.maxVoltageCellNumber = 23;
+    snapshot.minVoltageCellNumber = 0;
+    snapshot.isBalancingActive = 1;
+    snapshot.chargePercentage = 99;
+    snapshot.balancingCurrent = -42;
+    snapshot.temperature[0] = 2512;
+    snapshot.temperature[1] = -1050;
+    snapshot.temperature[2] = 0;
+    snapshot.errors = 0x80001234;
+    snapshot.stateFETs = 0x03;
+    snapshot.lastDataMillis = 4711;
+    return snapshot;
+  }
+
+  static std::vector<uint8_t> encode(const BmsDataSnapshot& snapshot, uint8_t bmsNr = 3, uint8_t sequence = 17,
+    uint8_t flags = i2cbulk::FLAG_DATA_VALID)
+  {
+    std::vector<uint8_t> frame(i2cbulk::BMS_FRAME_LEN + 8, 0xEE);
+    const std::size_t len = i2cbulk::encodeBms(snapshot, bmsNr, sequence, flags, frame.data());
+    EXPECT_EQ(i2cbulk::BMS_FRAME_LEN, len);
+    EXPECT_EQ(0xEE, frame[len]) << "Wrote behind the frame";
+    frame.resize(len);
+    return frame;
+  }
+};
+
+TEST_F(I2cBulkFrameTest, RoundTripsAllFields)
+{
+  const BmsDataSnapshot snapshot = makeSnapshot();
+  const std::vector<uint8_t> frame = encode(snapshot);
+
+  i2cbulk::FrameHeader header {};
+  BmsDataSnapshot decoded {};
+  ASSERT_EQ(i2cbulk::DecodeResult::OK, i2cbulk::decodeBms(frame.data(), frame.size(), header, decoded));
+
+  EXPECT_EQ(i2cbulk::VERSION, header.version);
+  EXPECT_EQ(i2cbulk::TYPE_BMS, header.type);
+  EXPECT_EQ(3, header.bmsNr);
+  EXPECT_EQ(17, header.sequence);
+  EXPECT_EQ(i2cbulk::FLAG_DATA_VALID, header.flags);
+
+  for (std::size_t i = 0; i < BMSDATA_MAX_CELLS; ++i)
+    EXPECT_EQ(snapshot.cellVoltage[i], decoded.cellVoltage[i]) << "Cell " << i;
+  EXPECT_EQ(snapshot.totalVoltage, decoded.totalVoltage);
+  EXPECT_EQ(snapshot.maxCellDifferenceVoltage, decoded.maxCellDifferenceVoltage);
+  EXPECT_EQ(snapshot.avgVoltage, decoded.avgVoltage);
+  EXPECT_EQ(snapshot.totalCurrent, decoded.totalCurrent);
+  EXPECT_EQ(snapshot.maxCellVoltage, decoded.maxCellVoltage);
+  EXPECT_EQ(snapshot.minCellVoltage, decoded.minCellVoltage);
+  EXPECT_EQ(snapshot.maxVoltageCellNumber, decoded.maxVoltageCellNumber);
+  EXPECT_EQ(snapshot.minVoltageCellNumber, decoded.minVoltageCellNumber);
+  EXPECT_EQ(snapshot.isBalancingActive, decoded.isBalancingActive);
+  EXPECT_EQ(snapshot.chargePercentage, decoded.chargePercentage);
+  EXPECT_EQ(snapshot.balancingCurrent, decoded.balancingCurrent);
+  for (std::size_t i = 0; i < BMSDATA_MAX_TEMPERATURES; ++i)
+    EXPECT_EQ(snapshot.temperature[i], decoded.temperature[i]) << "Temperature " << i;
+  EXPECT_EQ(snapshot.errors, decoded.errors);
+  EXPECT_EQ(snapshot.stateFETs, decoded.stateFETs);
+  EXPECT_EQ(0u, decoded.lastDataMillis) << "lastDataMillis is not part of the frame";
+}
+
+TEST_F(I2cBulkFrameTest, HasTheDocumentedLayout)
+{
+  const std::vector<uint8_t> frame = encode(makeSnapshot(), 5, 0xFE, 0);
+
+  ASSERT_EQ(85u, frame.size());
+  EXPECT_EQ(1, frame[0]);
+  EXPECT_EQ(1, frame[1]);
+  EXPECT_EQ(5, frame[2]);
+  EXPECT_EQ(0xFE, frame[3]);
+  EXPECT_EQ(0, frame[4]);
+  EXPECT_EQ(i2cbulk::BMS_PAYLOAD_LEN, frame[5]);
+  EXPECT_EQ(0x80, frame[6]); // Cell 0: 3200 = 0x0C80
+  EXPECT_EQ(0x0C, frame[7]);
+
+  uint8_t data[i2cbulk::BMS_FRAME_LEN];
+  std::memcpy(data, frame.data(), frame.size());
+  const uint16_t crc = crc16(data, i2cbulk::BMS_FRAME_LEN - 2);
+  EXPECT_EQ(crc & 0xFF, frame[frame.size() - 2]);
+  EXPECT_EQ(crc >> 8, frame[frame.size() - 1]);
+}
+
+TEST_F(I2cBulkFrameTest, DetectsEverySingleBitError)
+{
+  const BmsDataSnapshot snapshot = makeSnapshot();
+  const std::vector<uint8_t> frame = encode(snapshot);
+
+  for (std::size_t byte = 0; byte < frame.size(); ++byte)
+  {
+    for (uint8_t bit = 0; bit < 8; ++bit)
+    {
+      std::vector<uint8_t> corrupted = frame;
+      corrupted[byte] ^= static_cast<uint8_t>(1 << bit);
+
+      i2cbulk::FrameHeader header {};
+      BmsDataSnapshot decoded = snapshot;
+      decoded.chargePercentage = 0;
+      const i2cbulk::DecodeResult result = i2cbulk::decodeBms(corrupted.data(), corrupted.size(), header, decoded);
+      ASSERT_NE(i2cbulk::DecodeResult::OK, result) << "Byte " << byte << ", bit " << (int)bit;
+      ASSERT_EQ(0, decoded.chargePercentage) << "Snapshot changed by an invalid frame";
+    }
+  }
+}
+
+TEST_F(I2cBulkFrameTest, RejectsShortFramesAndOtherVersions)
+{
+  const std::vector<uint8_t> frame = encode(makeSnapshot());
+  i2cbulk::FrameHeader header {};
+  BmsDataSnapshot decoded {};
+
+  EXPECT_EQ(i2cbulk::DecodeResult::TOO_SHORT, i2cbulk::decodeBms(frame.data(), 0, header, decoded));
+  EXPECT_EQ(i2cbulk::DecodeResult::TOO_SHORT, i2cbulk::decodeBms(frame.data(), frame.size() - 1, header, decoded));
+
+  // A frame with another version, but valid CRC
+  std::vector<uint8_t> other = frame;
+  other[0] = i2cbulk::VERSION + 1;
+  const uint16_t crc = crc16(other.data(), static_cast<uint16_t>(other.size() - 2));
+  other[other.size() - 2] = static_cast<uint8_t>(crc & 0xFF);
+  other[other.size() - 1] = static_cast<uint8_t>(crc >> 8);
+  EXPECT_EQ(i2cbulk::DecodeResult::WRONG_VERSION, i2cbulk::decodeBms(other.data(), other.size(), header, decoded));
+}
+
+TEST_F(I2cBulkFrameTest, IgnoresAppendedPayload)
+{
+  const BmsDataSnapshot snapshot = makeSnapshot();
+  std::vector<uint8_t> frame = encode(snapshot);
+
+  // Payload of a future sender with two additional bytes
+  frame.resize(frame.size() - 2);
+  frame.push_back(0xAB);
+  frame.push_back(0xCD);
+  frame[5] = static_cast<uint8_t>(i2cbulk::BMS_PAYLOAD_LEN + 2);
+  const uint16_t crc = crc16(frame.data(), static_cast<uint16_t>(frame.size()));
+  frame.push_back(static_cast<uint8_t>(crc & 0xFF));
+  frame.push_back(static_cast<uint8_t>(crc >> 8));
+
+  i2cbulk::FrameHeader header {};
+  BmsDataSnapshot decoded {};
+  ASSERT_EQ(i2cbulk::DecodeResult::OK, i2cbulk::decodeBms(frame.data(), frame.size(), header, decoded));
+  EXPECT_EQ(snapshot.stateFETs, decoded.stateFETs);
+  EXPECT_EQ(snapshot.errors, decoded.errors);
+}
+
+TEST_F(I2cBulkFrameTest, SequenceTrackerCountsLostFrames)
+{
+  i2cbulk::SequenceTracker tracker;
+  EXPECT_EQ(0, tracker.update(200));
+  EXPECT_EQ(0, tracker.update(201));
+  EXPECT_EQ(2, tracker.update(204));
+  EXPECT_EQ(0, tracker.update(205));
+  EXPECT_EQ(50, tracker.update(0)); // Overflow 205 -> 0: 206..255 lost
+
+  tracker.reset();
+  EXPECT_EQ(0, tracker.update(17));
+  EXPECT_EQ(0, tracker.update(18));
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
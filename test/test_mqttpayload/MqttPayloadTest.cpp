@@ -0,0 +1,106 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <MqttPayload.hpp>
+
+namespace test
+{
+
+class MqttPayloadTest :
+  public ::testing::Test
+{
+  protected:
+  MqttPayloadTest() {}
+  virtual ~MqttPayloadTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static BmsDataSnapshot makeSnapshot()
+  {
+    BmsDataSnapshot snapshot {};
+    for (std::size_t i = 0; i < BMSDATA_MAX_CELLS; ++i) snapshot.cellVoltage[i] = 0xFFFF;
+    snapshot.cellVoltage[0] = 3300;
+    snapshot.cellVoltage[2] = 3302;
+    snapshot.maxCellVoltage = 3302;
+    snapshot.minCellVoltage = 3300;
+    snapshot.chargePercentage = 87;
+    snapshot.stateFETs = 0x01;
+    return snapshot;
+  }
+};
+
+TEST_F(MqttPayloadTest, WritesInvalidCellsAsNullAndOmitsTrailingCells)
+{
+  mqttpayload::Payload<1024> payload;
+  mqttpayload::writeBmsData(payload, makeSnapshot(), true);
+  ASSERT_FALSE(payload.overflow());
+
+  const std::string json(payload.data(), payload.length());
+  EXPECT_EQ(0u, json.find(std::string("{\"") + mqttTopics[MQTT_TOPIC2_CELL_VOLTAGE] + "\":[3300,null,3302],"));
+  EXPECT_NE(std::string::npos, json.find(std::string("\"") + mqttTopics[MQTT_TOPIC2_CHARGE_PERCENT] + "\":87,"));
+  EXPECT_NE(std::string::npos, json.find(std::string("\"") + mqttTopics[MQTT_TOPIC2_FET_STATE_CHARGE] + "\":1,"));
+  EXPECT_EQ(std::string("\"") + mqttTopics[MQTT_TOPIC2_BMS_DATA_VALID] + "\":1}",
+    json.substr(json.rfind('"', json.rfind('"') - 1)));
+}
+
+TEST_F(MqttPayloadTest, WritesOnlyTheValidFlagForOldData)
+{
+  mqttpayload::Payload<1024> payload;
+  mqttpayload::writeBmsData(payload, makeSnapshot(), false);
+  EXPECT_EQ(std::string("{\"") + mqttTopics[MQTT_TOPIC2_BMS_DATA_VALID] + "\":0}", payload.data());
+}
+
+TEST_F(MqttPayloadTest, WritesTheCommStatistics)
+{
+  commstats::Statistics stats {};
+  stats.requests = 5;
+  stats.responses = 4;
+  stats.timeouts = 1;
+  stats.resyncs = 2;
+  stats.responseLastUs = 25000;
+  stats.responseMinUs = 21000;
+  stats.responseAvgUs = 24000;
+  stats.responseMaxUs = 30000;
+  stats.histogram[2] = 4;
+
+  mqttpayload::Payload<512> payload;
+  mqttpayload::writeCommStatistics(payload, commstats::Source::SERIAL_BMS, stats);
+  ASSERT_FALSE(payload.overflow());
+  EXPECT_STREQ("{\"src\":\"serial\",\"requests\":5,\"responses\":4,\"timeouts\":1,\"checksum_errors\":0,\"resyncs\":2,"
+    "\"plausibility_trips\":0,\"rt_last_us\":25000,\"rt_min_us\":21000,\"rt_avg_us\":24000,\"rt_max_us\":30000,"
+    "\"histogram\":[0,0,4,0,0,0,0,0,0]}", payload.data());
+}
+
+TEST_F(MqttPayloadTest, MarksTheDocumentAsOverflowed)
+{
+  mqttpayload::Payload<16> payload;
+  payload.reset();
+  payload.append("0123456789");
+  EXPECT_FALSE(payload.overflow());
+  payload.append("0123456789");
+  EXPECT_TRUE(payload.overflow());
+  EXPECT_EQ(10u, payload.length());
+
+  payload.reset();
+  EXPECT_FALSE(payload.overflow());
+  EXPECT_EQ(0u, payload.length());
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
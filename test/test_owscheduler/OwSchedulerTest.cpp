@@ -0,0 +1,271 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+#include <OwScheduler.hpp>
+
+namespace test
+{
+
+/** Bus with scripted read results */
+class FakeOwBus
+{
+  public:
+  void startConversion() { conversions++; }
+
+  owscheduler::ReadResult read(uint8_t nr, int16_t& tempC100)
+  {
+    reads.push_back(nr);
+    std::vector<owscheduler::ReadResult>& script = results[nr];
+    owscheduler::ReadResult result = owscheduler::ReadResult::OK;
+    if (!script.empty())
+    {
+      result = script.front();
+      script.erase(script.begin());
+    }
+    tempC100 = static_cast<int16_t>(2000 + nr);
+    return result;
+  }
+
+  void onTemperature(uint8_t nr, int16_t tempC100) { temperatures[nr] = tempC100; }
+
+  uint32_t conversions {0};
+  std::vector<uint8_t> reads;
+  std::map<uint8_t, std::vector<owscheduler::ReadResult>> results;
+  std::map<uint8_t, int16_t> temperatures;
+};
+
+class OwSchedulerTest :
+  public ::testing::Test
+{
+  protected:
+  OwSchedulerTest() {}
+  virtual ~OwSchedulerTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static void setCrc(uint8_t (&scratchPad)[9])
+  {
+    scratchPad[8] = owscheduler::crc8(scratchPad, 8);
+  }
+};
+
+TEST_F(OwSchedulerTest, ConversionTimeDependsOnTheResolution)
+{
+  EXPECT_EQ(750, owscheduler::conversionTimeMs(12));
+  EXPECT_EQ(375, owscheduler::conversionTimeMs(11));
+  EXPECT_EQ(187, owscheduler::conversionTimeMs(10));
+  EXPECT_EQ(93, owscheduler::conversionTimeMs(9));
+  EXPECT_EQ(93, owscheduler::conversionTimeMs(0));
+  EXPECT_EQ(750, owscheduler::conversionTimeMs(16));
+}
+
+TEST_F(OwSchedulerTest, DecodesTheScratchPad)
+{
+  // Power-on value of a DS18B20 (85 °C) with the CRC of the datasheet
+  const uint8_t powerOn[9] = {0x50, 0x05, 0x4B, 0x46, 0x7F, 0xFF, 0x0C, 0x10, 0x1C};
+  int16_t temp = 0;
+  ASSERT_EQ(owscheduler::ReadResult::OK, owscheduler::decodeScratchPad(0x28, powerOn, temp));
+  EXPECT_EQ(8500, temp);
+
+  // +25.0625 °C, 12 bit
+  uint8_t scratchPad[9] = {0x91, 0x01, 0x4B, 0x46, 0x7F, 0xFF, 0x0F, 0x10, 0x00};
+  setCrc(scratchPad);
+  ASSERT_EQ(owscheduler::ReadResult::OK, owscheduler::decodeScratchPad(0x28, scratchPad, temp));
+  EXPECT_EQ(2506, temp);
+
+  // The same value at 9 bit: the undefined low bits are ignored
+  scratchPad[4] = 0x1F;
+  setCrc(scratchPad);
+  ASSERT_EQ(owscheduler::ReadResult::OK, owscheduler::decodeScratchPad(0x28, scratchPad, temp));
+  EXPECT_EQ(2500, temp);
+
+  // -10.125 °C, 12 bit
+  uint8_t negative[9] = {0x5E, 0xFF, 0x4B, 0x46, 0x7F, 0xFF, 0x02, 0x10, 0x00};
+  setCrc(negative);
+  ASSERT_EQ(owscheduler::ReadResult::OK, owscheduler::decodeScratchPad(0x28, negative, temp));
+  EXPECT_EQ(-1012, temp);
+
+  // DS18S20: +25 °C with COUNT_REMAIN 12 and COUNT_PER_C 16
+  uint8_t ds18s20[9] = {0x32, 0x00, 0x4B, 0x46, 0xFF, 0xFF, 0x0C, 0x10, 0x00};
+  setCrc(ds18s20);
+  ASSERT_EQ(owscheduler::ReadResult::OK, owscheduler::decodeScratchPad(owscheduler::FAMILY_DS18S20, ds18s20, temp));
+  EXPECT_EQ(2500, temp);
+}
+
+TEST_F(OwSchedulerTest, DetectsCorruptedScratchPads)
+{
+  const uint8_t powerOn[9] = {0x50, 0x05, 0x4B, 0x46, 0x7F, 0xFF, 0x0C, 0x10, 0x1C};
+  int16_t temp = 4711;
+
+  for (uint8_t byte = 0; byte < 9; ++byte)
+  {
+    for (uint8_t bit = 0; bit < 8; ++bit)
+    {
+      uint8_t corrupted[9];
+      std::copy(std::begin(powerOn), std::end(powerOn), corrupted);
+      corrupted[byte] ^= static_cast<uint8_t>(1 << bit);
+      ASSERT_EQ(owscheduler::ReadResult::CRC_ERROR, owscheduler::decodeScratchPad(0x28, corrupted, temp))
+        << "Byte " << (int)byte << ", bit " << (int)bit;
+    }
+  }
+  EXPECT_EQ(4711, temp);
+
+  const uint8_t zeros[9] = {};
+  const uint8_t ones[9] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+  EXPECT_EQ(owscheduler::ReadResult::NO_RESPONSE, owscheduler::decodeScratchPad(0x28, zeros, temp));
+  EXPECT_EQ(owscheduler::ReadResult::NO_RESPONSE, owscheduler::decodeScratchPad(0x28, ones, temp));
+}
+
+TEST_F(OwSchedulerTest, NeverWaitsForTheConversion)
+{
+  owscheduler::Scheduler<4> scheduler(8);
+  FakeOwBus bus;
+  scheduler.configure(0, true, 12, 1000);
+  scheduler.configure(2, true, 12, 1000);
+
+  EXPECT_EQ(0, scheduler.run(0, bus));
+  EXPECT_EQ(1u, bus.conversions);
+  EXPECT_FALSE(scheduler.idle());
+
+  EXPECT_EQ(0, scheduler.run(749, bus));
+  EXPECT_TRUE(bus.reads.empty());
+
+  EXPECT_EQ(2, scheduler.run(750, bus));
+  EXPECT_EQ((std::vector<uint8_t>{0, 2}), bus.reads);
+  EXPECT_EQ(2000, bus.temperatures[0]);
+  EXPECT_EQ(2002, bus.temperatures[2]);
+  EXPECT_TRUE(scheduler.idle());
+  EXPECT_EQ(1u, scheduler.conversions());
+
+  // Not due before the interval (from the start of the conversion) has elapsed
+  EXPECT_EQ(0, scheduler.run(999, bus));
+  EXPECT_EQ(1u, bus.conversions);
+  EXPECT_EQ(0, scheduler.run(1000, bus));
+  EXPECT_EQ(2u, bus.conversions);
+}
+
+TEST_F(OwSchedulerTest, WaitsOnlyForTheHighestDueResolution)
+{
+  owscheduler::Scheduler<4> scheduler(8);
+  FakeOwBus bus;
+  scheduler.configure(0, true, 9, 500);
+  scheduler.configure(1, true, 12, 5000);
+
+  scheduler.run(0, bus);
+  EXPECT_EQ(0, scheduler.run(100, bus));
+  EXPECT_EQ(2, scheduler.run(750, bus));
+
+  // Only the fast 9 bit sensor is due
+  scheduler.run(800, bus);
+  EXPECT_EQ(2u, bus.conversions);
+  EXPECT_EQ(1, scheduler.run(893, bus));
+  EXPECT_EQ(0, bus.reads.back());
+  EXPECT_EQ(3u, bus.reads.size());
+}
+
+TEST_F(OwSchedulerTest, LimitsTheReadsPerRun)
+{
+  owscheduler::Scheduler<20> scheduler(8);
+  FakeOwBus bus;
+  for (uint8_t i = 0; i < 20; ++i) scheduler.configure(i, true, 10, 10000);
+
+  scheduler.run(0, bus);
+  EXPECT_EQ(8, scheduler.run(200, bus));
+  EXPECT_FALSE(scheduler.idle());
+  EXPECT_EQ(8, scheduler.run(300, bus));
+  EXPECT_EQ(4, scheduler.run(400, bus));
+  EXPECT_TRUE(scheduler.idle());
+  EXPECT_EQ(20u, bus.reads.size());
+  EXPECT_EQ(1u, bus.conversions);
+}
+
+TEST_F(OwSchedulerTest, CompletesTheRoundWithTheLastRead)
+{
+  owscheduler::Scheduler<20> scheduler(8);
+  FakeOwBus bus;
+  for (uint8_t i = 0; i < 8; ++i) scheduler.configure(i, true, 9, 10000);
+
+  scheduler.run(0, bus);
+  EXPECT_EQ(8, scheduler.run(100, bus));
+  EXPECT_TRUE(scheduler.idle()) << "No further sensor is pending";
+}
+
+TEST_F(OwSchedulerTest, RetriesInTheNextRoundAndCountsErrors)
+{
+  owscheduler::Scheduler<2> scheduler(8);
+  FakeOwBus bus;
+  scheduler.configure(0, true, 9, 10000);
+  scheduler.configure(1, true, 9, 10000);
+  bus.results[1] = {owscheduler::ReadResult::CRC_ERROR, owscheduler::ReadResult::NO_RESPONSE,
+    owscheduler::ReadResult::CRC_ERROR, owscheduler::ReadResult::OK};
+
+  uint32_t now = 0;
+  auto round = [&]()
+  {
+    scheduler.run(now, bus);
+    now += 100;
+    const uint8_t reads = scheduler.run(now, bus);
+    now += 100;
+    return reads;
+  };
+
+  EXPECT_EQ(2, round());
+  EXPECT_FALSE(scheduler.failed(1));
+  EXPECT_EQ(1, round()) << "Only the failed sensor is read again";
+  EXPECT_EQ(1, round());
+  EXPECT_TRUE(scheduler.failed(1));
+  EXPECT_TRUE(scheduler.anyFailed());
+  EXPECT_EQ(0, bus.temperatures.count(1));
+
+  const owscheduler::SensorStatistics& stats = scheduler.statistics(1);
+  EXPECT_EQ(0u, stats.reads);
+  EXPECT_EQ(2u, stats.crcErrors);
+  EXPECT_EQ(1u, stats.noResponse);
+  EXPECT_EQ(2u, stats.retries);
+  EXPECT_EQ(1u, stats.failures);
+  EXPECT_EQ(1u, scheduler.statistics(0).reads);
+
+  // After all retries the sensor waits for its interval
+  EXPECT_EQ(0, round());
+
+  now = 10400;
+  EXPECT_EQ(2, round());
+  EXPECT_FALSE(scheduler.failed(1));
+  EXPECT_FALSE(scheduler.anyFailed());
+  EXPECT_EQ(2001, bus.temperatures[1]);
+  EXPECT_EQ(1u, scheduler.statistics(1).reads);
+}
+
+TEST_F(OwSchedulerTest, IgnoresSensorsWithoutAddress)
+{
+  owscheduler::Scheduler<4> scheduler(8);
+  FakeOwBus bus;
+  scheduler.configure(1, false, 12, 1000);
+
+  EXPECT_EQ(0, scheduler.run(0, bus));
+  EXPECT_EQ(0, scheduler.run(1000, bus));
+  EXPECT_EQ(0u, bus.conversions);
+  EXPECT_TRUE(scheduler.idle());
+  EXPECT_FALSE(scheduler.present(1));
+  EXPECT_FALSE(scheduler.failed(1));
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
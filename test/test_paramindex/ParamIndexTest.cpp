@@ -0,0 +1,168 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <string>
+#include <params.h>
+#include <params_idx.h>
+#include <Json.cpp>
+
+/**
+ * The index in params_idx.h is generated by scripts/prebuild_parameter.py. These tests compare it with the
+ * values found by the JSON scanner (Json::getValue()), which was used by the WebSettings before.
+*/
+
+namespace test
+{
+
+class ParamIndexTest :
+  public ::testing::TestWithParam<std::pair<const char*, const paramIdx_s*>>
+{
+  protected:
+  ParamIndexTest() {}
+  virtual ~ParamIndexTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static std::string idxString(const char* json, const paramIdxStr_s& str)
+  {
+    return std::string(json + str.pos, str.len);
+  }
+
+  /** Returns the value of the key found by the JSON scanner. Returns false, if the key does not exist. */
+  static bool scanValue(const char* json, uint16_t idx, const char* key, uint32_t startPos, std::string& value, uint32_t& arrayStart)
+  {
+    String retValue;
+    const bool found = json_.getValue(json, idx, key, startPos, retValue, arrayStart);
+    value = retValue.c_str();
+    return found;
+  }
+
+  /** Compares the elements [first, first+cnt) of the index with the elements of the JSON array at jsonStartPos. */
+  static void verifyElements(const char* json, const paramIdx_s& index, uint16_t first, uint16_t cnt, uint32_t jsonStartPos)
+  {
+    ASSERT_EQ(json_.getArraySize(json, jsonStartPos), cnt);
+
+    for (uint16_t a = 0; a < cnt; ++a)
+    {
+      const paramIdxEntry_s& entry = index.entries[first + a];
+      std::string value;
+      uint32_t arrayStart = 0;
+
+      ASSERT_TRUE(scanValue(json, a, "type", jsonStartPos, value, arrayStart)) << "Element " << a;
+      EXPECT_EQ(std::stoi(value), entry.type) << "Element " << a;
+
+      // The scanner also finds the keys of the group elements, so for groups only the own keys are compared
+      if (entry.type == HTML_OPTIONGROUP || entry.type == HTML_OPTIONGROUP_COLLAPSIBLE)
+      {
+        if (entry.label.pos != 0)
+        {
+          ASSERT_TRUE(scanValue(json, a, "label", jsonStartPos, value, arrayStart)) << "Element " << a;
+          EXPECT_EQ(value, idxString(json, entry.label)) << "Element " << a;
+        }
+
+        ASSERT_TRUE(scanValue(json, a, "groupsize", jsonStartPos, value, arrayStart)) << "Element " << a;
+        EXPECT_EQ(std::stoi(value), entry.groupsize) << "Element " << a;
+
+        ASSERT_TRUE(scanValue(json, a, "group", jsonStartPos, value, arrayStart)) << "Element " << a;
+        verifyElements(json, index, entry.childFirst, entry.childCnt, arrayStart);
+        continue;
+      }
+
+      if (scanValue(json, a, "label", jsonStartPos, value, arrayStart))
+        EXPECT_EQ(value, idxString(json, entry.label)) << "Element " << a;
+      else
+        EXPECT_EQ(0, entry.label.pos) << "Element " << a;
+
+      if (scanValue(json, a, "name", jsonStartPos, value, arrayStart))
+        EXPECT_EQ(std::stoi(value), entry.name) << "Element " << a;
+      else
+        EXPECT_EQ(0, entry.name) << "Element " << a;
+
+      if (scanValue(json, a, "dt", jsonStartPos, value, arrayStart))
+      {
+        EXPECT_EQ(std::stoi(value), entry.dt) << "Element " << a;
+      }
+
+      if (scanValue(json, a, "default", jsonStartPos, value, arrayStart))
+        EXPECT_EQ(value, idxString(json, entry.def)) << "Element " << a;
+      else
+        EXPECT_EQ(0, entry.def.pos) << "Element " << a;
+
+      if (scanValue(json, a, "options", jsonStartPos, value, arrayStart))
+      {
+        ASSERT_EQ(json_.getArraySize(json, arrayStart), entry.optionsCnt) << "Element " << a;
+        for (uint8_t o = 0; o < entry.optionsCnt; ++o)
+        {
+          const paramIdxOption_s& option = index.options[entry.optionsFirst + o];
+          uint32_t unused = 0;
+          ASSERT_TRUE(scanValue(json, o, "v", arrayStart, value, unused));
+          EXPECT_EQ(value, idxString(json, option.v)) << "Element " << a << ", option " << (int)o;
+          ASSERT_TRUE(scanValue(json, o, "l", arrayStart, value, unused));
+          EXPECT_EQ(value, idxString(json, option.l)) << "Element " << a << ", option " << (int)o;
+        }
+      }
+      else
+      {
+        EXPECT_EQ(0, entry.optionsCnt) << "Element " << a;
+      }
+    }
+  }
+
+  static inline Json json_;
+};
+
+TEST_P(ParamIndexTest, IndexMatchesJsonScanner)
+{
+  const char* json = GetParam().first;
+  const paramIdx_s& index = *GetParam().second;
+
+  ASSERT_GT(index.pageCnt, 0);
+  ASSERT_GE(index.entryCnt, index.pageCnt);
+  verifyElements(json, index, 0, index.pageCnt, 8);
+}
+
+TEST_P(ParamIndexTest, GroupsReferenceElementsBehindThePage)
+{
+  const paramIdx_s& index = *GetParam().second;
+
+  for (uint16_t i = 0; i < index.entryCnt; ++i)
+  {
+    const paramIdxEntry_s& entry = index.entries[i];
+    if (entry.childCnt == 0) continue;
+
+    EXPECT_GT(entry.childFirst, i) << "Element " << i;
+    EXPECT_LE(entry.childFirst + entry.childCnt, index.entryCnt) << "Element " << i;
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllPages, ParamIndexTest, ::testing::Values(
+  std::make_pair(paramSystem, &paramSystemIdx),
+  std::make_pair(paramBluetooth, &paramBluetoothIdx),
+  std::make_pair(paramSerial, &paramSerialIdx),
+  std::make_pair(paramAlarmBms, &paramAlarmBmsIdx),
+  std::make_pair(paramAlarmTemp, &paramAlarmTempIdx),
+  std::make_pair(paramDigitalOut, &paramDigitalOutIdx),
+  std::make_pair(paramDigitalIn, &paramDigitalInIdx),
+  std::make_pair(paramOnewireAdr, &paramOnewireAdrIdx),
+  std::make_pair(paramOnewire2, &paramOnewire2Idx),
+  std::make_pair(paramBmsToInverter, &paramBmsToInverterIdx),
+  std::make_pair(paramDeviceNeeyBalancer, &paramDeviceNeeyBalancerIdx),
+  std::make_pair(paramDeviceJbdBms, &paramDeviceJbdBmsIdx),
+  std::make_pair(paramDeviceBpn, &paramDeviceBpnIdx)));
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
@@ -0,0 +1,192 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <PollScheduler.hpp>
+
+namespace test
+{
+
+using pollscheduler::Activity;
+using pollscheduler::Config;
+using pollscheduler::Sample;
+using pollscheduler::Scheduler;
+
+class PollSchedulerTest :
+  public ::testing::Test
+{
+  protected:
+  PollSchedulerTest() {}
+  virtual ~PollSchedulerTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    config.minIntervalMs = 250;
+    config.maxIntervalMs = 4000;
+    config.busyCurrentRate = 100; // 1 A/s
+    config.busyVoltageRate = 2;
+    config.budgetPermille = 800;
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  /** Polls the device each time it is due, until untilMs; the current changes by currentStep each poll */
+  template<std::size_t N>
+  static void pollUntil(Scheduler<N>& scheduler, uint32_t& nowMs, uint32_t untilMs, const int16_t (&currentStep)[N],
+    uint32_t durationMs)
+  {
+    int16_t current[N] {};
+    for (; nowMs < untilMs; nowMs += 10)
+    {
+      for (uint8_t nr = 0; nr < N; ++nr)
+      {
+        if (!scheduler.due(nr, nowMs)) continue;
+        current[nr] = static_cast<int16_t>(current[nr] + currentStep[nr]);
+        scheduler.polled(nr, nowMs, durationMs, true, Sample {current[nr], 3300, 3310});
+      }
+    }
+  }
+
+  Config config;
+};
+
+TEST_F(PollSchedulerTest, EnabledDeviceIsDueImmediately)
+{
+  Scheduler<3> scheduler(config);
+  ASSERT_FALSE(scheduler.due(0, 100));
+  ASSERT_EQ(0u, scheduler.intervalMs(0));
+  ASSERT_EQ(config.maxIntervalMs, scheduler.nextDueMs(100));
+
+  scheduler.enable(0, true);
+  ASSERT_TRUE(scheduler.due(0, 100));
+  ASSERT_EQ(0u, scheduler.nextDueMs(100));
+  ASSERT_EQ(pollscheduler::START_INTERVAL_MS, scheduler.intervalMs(0));
+
+  scheduler.polled(0, 100, 20, true, Sample {0, 3300, 3300});
+  ASSERT_FALSE(scheduler.due(0, 100 + pollscheduler::START_INTERVAL_MS - 1));
+  ASSERT_TRUE(scheduler.due(0, 100 + pollscheduler::START_INTERVAL_MS));
+  ASSERT_EQ(400u, scheduler.nextDueMs(700));
+
+  // Enabling again has no effect, disabling removes the device
+  scheduler.enable(0, true);
+  ASSERT_FALSE(scheduler.due(0, 700));
+  scheduler.enable(0, false);
+  ASSERT_FALSE(scheduler.due(0, 5000));
+  ASSERT_EQ(0u, scheduler.intervalMs(0));
+  ASSERT_FALSE(scheduler.due(3, 5000)); // Invalid number
+}
+
+TEST_F(PollSchedulerTest, BusyPackIsPolledFaster)
+{
+  Scheduler<1> scheduler(config);
+  scheduler.enable(0, true);
+  uint32_t nowMs = 0;
+  pollUntil(scheduler, nowMs, 5000, {500}, 20); // 5 A per poll
+
+  ASSERT_EQ(config.minIntervalMs, scheduler.intervalMs(0));
+  ASSERT_EQ(Activity::BUSY, scheduler.statistics(0).activity);
+}
+
+TEST_F(PollSchedulerTest, QuietPackIsPolledSlower)
+{
+  Scheduler<1> scheduler(config);
+  scheduler.enable(0, true);
+  uint32_t nowMs = 0;
+  pollUntil(scheduler, nowMs, 30000, {0}, 20);
+
+  ASSERT_EQ(config.maxIntervalMs, scheduler.intervalMs(0));
+  ASSERT_EQ(Activity::QUIET, scheduler.statistics(0).activity);
+}
+
+TEST_F(PollSchedulerTest, CellVoltagesMakeAPackBusy)
+{
+  Scheduler<1> scheduler(config);
+  scheduler.enable(0, true);
+  scheduler.polled(0, 0, 20, true, Sample {0, 3300, 3310});
+  scheduler.polled(0, 1000, 20, true, Sample {0, 3300, 3313}); // 3 mV/s
+  ASSERT_EQ(Activity::BUSY, scheduler.statistics(0).activity);
+  ASSERT_EQ(500u, scheduler.intervalMs(0));
+
+  scheduler.polled(0, 1500, 20, true, Sample {0, 3299, 3313}); // 2 mV/s
+  ASSERT_EQ(Activity::BUSY, scheduler.statistics(0).activity);
+  ASSERT_EQ(250u, scheduler.intervalMs(0));
+
+  scheduler.polled(0, 2500, 20, true, Sample {0, 3298, 3313}); // 1 mV/s
+  ASSERT_EQ(Activity::NORMAL, scheduler.statistics(0).activity);
+  ASSERT_EQ(250u, scheduler.intervalMs(0));
+}
+
+TEST_F(PollSchedulerTest, FailedPollKeepsTheInterval)
+{
+  Scheduler<1> scheduler(config);
+  scheduler.enable(0, true);
+  scheduler.polled(0, 0, 20, true, Sample {0, 3300, 3300});
+  scheduler.polled(0, 1000, 200, false, Sample {5000, 0, 0});
+  ASSERT_EQ(pollscheduler::START_INTERVAL_MS, scheduler.intervalMs(0));
+  ASSERT_EQ(Activity::UNKNOWN, scheduler.statistics(0).activity);
+  ASSERT_EQ(2u, scheduler.statistics(0).polls);
+  ASSERT_FALSE(scheduler.due(0, 1999));
+  ASSERT_TRUE(scheduler.due(0, 2000));
+
+  // The sample of the failed poll is ignored
+  scheduler.polled(0, 2000, 20, true, Sample {0, 3300, 3300});
+  ASSERT_EQ(Activity::QUIET, scheduler.statistics(0).activity);
+}
+
+TEST_F(PollSchedulerTest, BusyPacksGetTheTimeOfQuietPacks)
+{
+  // Three slow devices on one bus, 200 ms per poll: all busy would need 2400 permille of the bus
+  Scheduler<3> scheduler(config);
+  for (uint8_t nr = 0; nr < 3; ++nr) scheduler.enable(nr, true);
+
+  uint32_t nowMs = 0;
+  pollUntil(scheduler, nowMs, 30000, {500, 500, 500}, 200);
+  ASSERT_LE(scheduler.loadPermille(), config.budgetPermille + 10);
+  const uint32_t sharedMs = scheduler.intervalMs(0);
+  ASSERT_GT(sharedMs, config.minIntervalMs);
+
+  // Two packs become quiet, the remaining busy pack is polled faster
+  pollUntil(scheduler, nowMs, 90000, {500, 0, 0}, 200);
+  ASSERT_EQ(config.maxIntervalMs, scheduler.intervalMs(1));
+  ASSERT_EQ(config.maxIntervalMs, scheduler.intervalMs(2));
+  ASSERT_LT(scheduler.intervalMs(0), sharedMs);
+  ASSERT_LE(scheduler.loadPermille(), config.budgetPermille + 10);
+}
+
+TEST_F(PollSchedulerTest, ConfigLimitsTheIntervals)
+{
+  Scheduler<2> scheduler(config);
+  scheduler.enable(0, true);
+  scheduler.enable(1, true);
+  uint32_t nowMs = 0;
+  pollUntil(scheduler, nowMs, 30000, {0, 500}, 20);
+  ASSERT_EQ(4000u, scheduler.intervalMs(0));
+  ASSERT_EQ(250u, scheduler.intervalMs(1));
+
+  config.minIntervalMs = 500;
+  config.maxIntervalMs = 2000;
+  scheduler.setConfig(config);
+  ASSERT_EQ(2000u, scheduler.intervalMs(0));
+  ASSERT_EQ(500u, scheduler.intervalMs(1));
+
+  // Invalid bounds
+  config.minIntervalMs = 3000;
+  config.maxIntervalMs = 1000;
+  scheduler.setConfig(config);
+  ASSERT_EQ(3000u, scheduler.config().maxIntervalMs);
+  ASSERT_EQ(3000u, scheduler.intervalMs(1));
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
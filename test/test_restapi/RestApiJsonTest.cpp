@@ -0,0 +1,189 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <regex>
+#include <string>
+#include <Arduino.h>
+#include <RestApiJson.hpp>
+#include <common/LegacyRestJson.hpp>
+#include <utils/JsonWriter.hpp>
+
+namespace test
+{
+
+class RestApiJsonTest :
+  public ::testing::Test
+{
+  protected:
+  RestApiJsonTest() {}
+  virtual ~RestApiJsonTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() { output.clear(); }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  struct Sink
+  {
+    std::string* output;
+    void operator()(const char* data, std::size_t len) { output->append(data, len); }
+  };
+
+  static BmsDataSnapshot makeSnapshot()
+  {
+    BmsDataSnapshot snapshot {};
+    for (std::size_t i = 0; i < BMSDATA_MAX_CELLS; ++i)
+      snapshot.cellVoltage[i] = static_cast<uint16_t>(3300 + i);
+    snapshot.cellVoltage[3] = 0xFFFF;
+    snapshot.totalVoltage = 5321;
+    snapshot.totalCurrent = -1250;
+    snapshot.chargePercentage = 87;
+    snapshot.maxCellDifferenceVoltage = 15;
+    snapshot.maxCellVoltage = 3315;
+    snapshot.minCellVoltage = 3300;
+    snapshot.maxVoltageCellNumber = 15;
+    snapshot.minVoltageCellNumber = 0;
+    snapshot.isBalancingActive = 1;
+    snapshot.stateFETs = 3;
+    snapshot.errors = 4096;
+    snapshot.temperature[0] = 2150;
+    snapshot.temperature[1] = -530;
+    snapshot.temperature[2] = 0;
+    return snapshot;
+  }
+
+  /** Converts the legacy output into the new format: Numbers are no longer quoted and there are no line breaks */
+  static std::string normalizeLegacy(const String& legacy)
+  {
+    std::string str = legacy.c_str();
+    str = std::regex_replace(str, std::regex("\n"), "");
+    return std::regex_replace(str, std::regex(":\"(-?[0-9]+(\\.[0-9]+)?)\""), ":$1");
+  }
+
+  std::string output;
+};
+
+TEST_F(RestApiJsonTest, BmsEntryGoldenOutput)
+{
+  utils::JsonWriter<128, Sink> json(Sink{&output});
+  restapi::writeBmsEntry(json, makeSnapshot(), true, true, 2, 250, 4, true);
+  json.flush();
+
+  ASSERT_EQ("{\"en\":1,\"valid\":1,\"nr\":2,\"cycleTime\":250,\"cells\":4,\"totalVolt\":53.21,\"totalCurr\":-12.50,"
+            "\"soc\":87,\"maxZellDiff\":15,\"maxCellVolt\":3315,\"minCellVolt\":3300,\"maxCellVoltNr\":15,"
+            "\"minCellVoltNr\":0,\"balOn\":1,\"FetState\":3,\"bmsErr\":4096,"
+            "\"cell_voltage\":[3300,3301,3302,0],\"temperature\":[21,-5,0]}", output);
+}
+
+TEST_F(RestApiJsonTest, BmsEntryWithoutCycleTimeAndRawCellVoltages)
+{
+  utils::JsonWriter<128, Sink> json(Sink{&output});
+  restapi::writeBmsEntry(json, makeSnapshot(), false, false, 0, restapi::NO_CYCLE_TIME, 4, false);
+  json.flush();
+
+  ASSERT_EQ(std::string::npos, output.find("cycleTime"));
+  ASSERT_NE(std::string::npos, output.find("\"en\":0,\"valid\":0,\"nr\":0,\"cells\":4,"));
+  ASSERT_NE(std::string::npos, output.find("\"cell_voltage\":[3300,3301,3302,65535]"));
+}
+
+TEST_F(RestApiJsonTest, BmsSerialArrayMatchesLegacySchema)
+{
+  constexpr uint8_t NUMBER_OF_BMS {3};
+  constexpr uint8_t NUMBER_OF_CELLS {16};
+  const BmsDataSnapshot snapshot = makeSnapshot();
+
+  String legacyOut;
+  legacyOut += "{";
+  legacy::bmsSerialArray(snapshot, NUMBER_OF_BMS, NUMBER_OF_CELLS, legacyOut, true);
+  legacy::genJsonEntryArray(legacy::arrEnd, "", "", legacyOut, true);
+
+  utils::JsonWriter<64, Sink> json(Sink{&output});
+  json.beginObject().beginArray("bms_serial");
+  for (uint8_t nr = 0; nr < NUMBER_OF_BMS; ++nr)
+    restapi::writeBmsEntry(json, snapshot, true, true, nr, 250, NUMBER_OF_CELLS, true);
+  json.endArray().endObject();
+  json.flush();
+
+  ASSERT_FALSE(json.hasError());
+  ASSERT_EQ(normalizeLegacy(legacyOut), output);
+}
+
+TEST_F(RestApiJsonTest, PollEntryGoldenOutput)
+{
+  utils::JsonWriter<64, Sink> json(Sink{&output});
+  json.beginArray("serial");
+  restapi::writePollEntry(json, 0, pollscheduler::DeviceStatistics {false, 0, 0, pollscheduler::Activity::UNKNOWN, 0});
+  restapi::writePollEntry(json, 1, pollscheduler::DeviceStatistics {true, 500, 42, pollscheduler::Activity::BUSY, 17});
+  json.endArray();
+  json.flush();
+
+  ASSERT_EQ("\"serial\":[{\"nr\":1,\"interval_ms\":500,\"duration_ms\":42,\"activity\":\"busy\",\"polls\":17}]", output);
+}
+
+TEST_F(RestApiJsonTest, CommEntryGoldenOutput)
+{
+  commstats::Statistics stats {};
+  stats.requests = 10;
+  stats.responses = 8;
+  stats.timeouts = 2;
+  stats.checksumErrors = 1;
+  stats.resyncs = 3;
+  stats.plausibilityTrips = 1;
+  stats.responseLastUs = 45000;
+  stats.responseMinUs = 30000;
+  stats.responseAvgUs = 41000;
+  stats.responseMaxUs = 120000;
+  stats.histogram[3] = 7;
+  stats.histogram[5] = 1;
+
+  utils::JsonWriter<64, Sink> json(Sink{&output});
+  json.beginArray("comm");
+  restapi::writeCommEntry(json, commstats::Source::BT_BMS, 0, commstats::Statistics {});
+  restapi::writeCommEntry(json, commstats::Source::CAN_BMS, 1, stats);
+  json.endArray();
+  json.flush();
+
+  ASSERT_EQ("\"comm\":[{\"src\":\"can\",\"nr\":1,\"requests\":10,\"responses\":8,\"timeouts\":2,"
+    "\"checksum_errors\":1,\"resyncs\":3,\"plausibility_trips\":1,\"rt_last_us\":45000,\"rt_min_us\":30000,"
+    "\"rt_avg_us\":41000,\"rt_max_us\":120000,\"histogram\":[0,0,0,7,0,1,0,0,0]}]", output);
+}
+
+/**
+ * The JsonWriter document of 11 BMS is smaller than the legacy one (numbers are no longer quoted).
+ * The build time of both is compared in test_bench_serializers.
+*/
+TEST_F(RestApiJsonTest, BmsSerialArraySmallerThanLegacy)
+{
+  constexpr uint8_t NUMBER_OF_BMS {11};
+  constexpr uint8_t NUMBER_OF_CELLS {16};
+  const BmsDataSnapshot snapshot = makeSnapshot();
+
+  String legacyOut;
+  legacy::bmsSerialArray(snapshot, NUMBER_OF_BMS, NUMBER_OF_CELLS, legacyOut, false);
+
+  std::size_t writerBytes = 0;
+  auto sink = [&writerBytes](const char*, std::size_t len) { writerBytes += len; };
+  utils::JsonWriter<512, decltype(sink)> json(sink);
+  json.beginArray("bms_serial");
+  for (uint8_t nr = 0; nr < NUMBER_OF_BMS; ++nr)
+    restapi::writeBmsEntry(json, snapshot, true, true, nr, 250, NUMBER_OF_CELLS, true);
+  json.endArray();
+  json.flush();
+
+  ASSERT_FALSE(json.hasError());
+  ASSERT_LT(writerBytes, legacyOut.length());
+}
+
+} // namespace test
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
@@ -0,0 +1,239 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <common/SerialBmsSimulator.hpp>
+
+// The module under test is compiled together with the test, see platformio.ini (-Isrc).
+#include <SerialRx.cpp>
+
+namespace serialrx
+{
+namespace test
+{
+
+using serialbms::test::FaultProfile;
+using serialbms::test::SerialBmsSimulator;
+
+class SerialRxTest :
+  public ::testing::Test
+{
+  protected:
+  SerialRxTest() {}
+  virtual ~SerialRxTest() {}
+
+  static constexpr uint8_t DEV_NR {1};
+  static constexpr uint32_t TIMEOUT_MS {200};
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    mocks::SimClock::reset(1000000);
+    serialRxInit();
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  /** Sends a request, so the next scripted answer of the simulator is scheduled */
+  static void request(SerialBmsSimulator& sim)
+  {
+    const uint8_t req[] {0xDD, 0xA5, 0x03, 0x00, 0xFF, 0xFD, 0x77};
+    sim.write(req, sizeof(req));
+    sim.flush();
+  }
+
+  /** Reads count bytes, stops at the first timeout */
+  static std::vector<uint8_t> readBytes(SerialBmsSimulator& sim, std::size_t count, uint32_t startUs)
+  {
+    std::vector<uint8_t> bytes;
+    while (bytes.size() < count)
+    {
+      const int16_t b = serialRxReadByte(&sim, startUs, TIMEOUT_MS);
+      if (b < 0) break;
+      bytes.push_back(static_cast<uint8_t>(b));
+    }
+    return bytes;
+  }
+
+  static std::vector<uint8_t> makeAnswer(std::size_t len)
+  {
+    std::vector<uint8_t> answer;
+    for (std::size_t i = 0; i < len; ++i) answer.push_back(static_cast<uint8_t>(i * 7));
+    return answer;
+  }
+};
+
+TEST_F(SerialRxTest, RegisteredPort_ReadsChunksInOrder)
+{
+  const std::vector<uint8_t> answer = makeAnswer(300); // More than one chunk of the port buffer
+  FaultProfile profile;
+  profile.byteTimeUs = SerialBmsSimulator::BYTE_TIME_US_115200;
+  profile.jitterMs = 3;
+  profile.chunkSize = 17;
+  profile.chunkGapMs = 2;
+
+  for (uint32_t seed = 1; seed <= 10; ++seed)
+  {
+    SerialBmsSimulator sim(seed);
+    ASSERT_TRUE(serialRxRegisterPort(&sim, false));
+    sim.addResponse(answer, profile);
+
+    request(sim);
+    const uint32_t startUs = micros();
+    ASSERT_EQ(answer, readBytes(sim, answer.size(), startUs)) << "Failed seed: " << seed;
+    ASSERT_EQ(0u, sim.getUnreadBytes());
+    serialRxInit();
+  }
+}
+
+TEST_F(SerialRxTest, NotRegisteredPort_IsReadDirectly)
+{
+  const std::vector<uint8_t> answer = makeAnswer(40);
+  SerialBmsSimulator sim;
+  sim.addResponse(answer);
+
+  request(sim);
+  ASSERT_EQ(answer, readBytes(sim, answer.size(), micros()));
+  ASSERT_EQ(0u, sim.getUnreadBytes());
+}
+
+TEST_F(SerialRxTest, NoAnswer_TimeoutAfterTimeoutMs)
+{
+  SerialBmsSimulator sim;
+  ASSERT_TRUE(serialRxRegisterPort(&sim, false));
+  FaultProfile timeout;
+  timeout.timeout = true;
+  sim.addResponse({}, timeout);
+
+  request(sim);
+  const uint32_t startUs = micros();
+  ASSERT_EQ(-1, serialRxReadByte(&sim, startUs, TIMEOUT_MS));
+
+  const uint32_t elapsedMs = (micros() - startUs) / 1000;
+  ASSERT_GE(elapsedMs, TIMEOUT_MS);
+  ASSERT_LE(elapsedMs, TIMEOUT_MS + 2); // Polling granularity of ports without RX event
+}
+
+TEST_F(SerialRxTest, Clear_DropsBufferedAndPendingBytes)
+{
+  SerialBmsSimulator sim;
+  ASSERT_TRUE(serialRxRegisterPort(&sim, false));
+  sim.addResponse(makeAnswer(20));
+  sim.addResponse({0x42});
+
+  request(sim);
+  mocks::SimClock::advanceMs(50); // The whole answer is in the UART buffer
+  ASSERT_EQ(0, serialRxReadByte(&sim, micros(), TIMEOUT_MS)); // The rest of the answer is in the port buffer now
+
+  serialRxClear(&sim);
+  ASSERT_EQ(0u, sim.getUnreadBytes());
+
+  request(sim);
+  ASSERT_EQ(0x42, serialRxReadByte(&sim, micros(), TIMEOUT_MS));
+}
+
+TEST_F(SerialRxTest, RegisterPort_WithoutRxEvent)
+{
+  SerialBmsSimulator sim1;
+  SerialBmsSimulator sim2;
+
+  // There is no second task on the host, which could signal RX events
+  ASSERT_FALSE(serialRxRegisterPort(&sim1, true));
+  ASSERT_TRUE(serialRxRegisterPort(&sim1, false));
+  ASSERT_TRUE(serialRxRegisterPort(&sim1, false)); // Registered twice, same entry
+  ASSERT_TRUE(serialRxRegisterPort(&sim2, false));
+  ASSERT_FALSE(serialRxRegisterPort(nullptr, false));
+
+  std::vector<SerialBmsSimulator> others(SERIAL_RX_PORT_COUNT);
+  ASSERT_TRUE(serialRxRegisterPort(&others[0], false));
+  ASSERT_TRUE(serialRxRegisterPort(&others[1], false));
+  ASSERT_FALSE(serialRxRegisterPort(&others[2], false)); // All entries used
+}
+
+TEST_F(SerialRxTest, Statistics_MinAvgMaxOfTheResponseTime)
+{
+  commstats::Statistics stats;
+  serialRxGetCommStatistics(DEV_NR, stats);
+  ASSERT_EQ(0u, stats.responses);
+  ASSERT_EQ(0u, stats.timeouts);
+
+  for (uint32_t rttMs : {40, 20, 80, 40})
+  {
+    const uint32_t startUs = static_cast<uint32_t>(mocks::SimClock::nowUs());
+    mocks::SimClock::advanceMs(rttMs);
+    serialRxRecordResponse(DEV_NR, startUs);
+  }
+  serialRxRecordTimeout(DEV_NR);
+
+  serialRxGetCommStatistics(DEV_NR, stats);
+  ASSERT_EQ(4u, stats.responses);
+  ASSERT_EQ(1u, stats.timeouts);
+  ASSERT_NEAR(40000, stats.responseLastUs, 10);
+  ASSERT_NEAR(20000, stats.responseMinUs, 10);
+  ASSERT_NEAR(80000, stats.responseMaxUs, 10);
+  // Moving average 1/8: 40 -> 37.5 -> 42.8 -> 42.5
+  ASSERT_NEAR(42461, stats.responseAvgUs, 20);
+
+  // Other devices and invalid numbers
+  serialRxGetCommStatistics(DEV_NR + 1, stats);
+  ASSERT_EQ(0u, stats.responses);
+  serialRxRecordTimeout(SERIAL_BMS_DEVICES_COUNT);
+  serialRxGetCommStatistics(SERIAL_BMS_DEVICES_COUNT, stats);
+  ASSERT_EQ(0u, stats.timeouts);
+}
+
+TEST_F(SerialRxTest, ReadFrame_RecordsRequestsChecksumErrorsAndResyncs)
+{
+  // Fixed frames of 4 bytes: SOI 0xA5, 2 data bytes, Sum8
+  utils::FrameFormat format;
+  format.soi[0] = 0xA5;
+  format.fixedLen = 4;
+  format.checksum = utils::FrameFormat::Checksum::Sum8;
+  format.checksumSize = 1;
+
+  SerialBmsSimulator sim;
+  ASSERT_TRUE(serialRxRegisterPort(&sim, false));
+  // Garbage, a frame with a wrong checksum and then a valid frame
+  sim.addResponse({0x00, 0x11, 0xA5, 0x01, 0x02, 0x00, 0xA5, 0x01, 0x02, 0xA8});
+  FaultProfile timeout;
+  timeout.timeout = true;
+  sim.addResponse({}, timeout);
+
+  // The wrong checksum ends the first read, the valid frame is read by the next one (without a new request)
+  request(sim);
+  for (utils::FrameDecoder::Status expected : {utils::FrameDecoder::Status::ChecksumError,
+    utils::FrameDecoder::Status::Frame, utils::FrameDecoder::Status::Incomplete})
+  {
+    uint8_t frame[4];
+    utils::FrameDecoder decoder(format, frame, sizeof(frame));
+    if (expected == utils::FrameDecoder::Status::Incomplete) request(sim);
+    ASSERT_EQ(expected, serialRxReadFrame(&sim, DEV_NR, decoder, micros(), TIMEOUT_MS));
+  }
+
+  commstats::Statistics stats;
+  serialRxGetCommStatistics(DEV_NR, stats);
+  ASSERT_EQ(3u, stats.requests);
+  ASSERT_EQ(1u, stats.responses);
+  ASSERT_EQ(1u, stats.timeouts);
+  ASSERT_EQ(1u, stats.checksumErrors);
+  ASSERT_EQ(1u, stats.resyncs); // Skipped garbage
+  ASSERT_EQ(0u, stats.plausibilityTrips);
+
+  serialRxRecordPlausibilityTrip(DEV_NR);
+  serialRxGetCommStatistics(DEV_NR, stats);
+  ASSERT_EQ(1u, stats.plausibilityTrips);
+}
+
+} // namespace test
+} // namespace serialrx
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
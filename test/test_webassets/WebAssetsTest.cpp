@@ -0,0 +1,83 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <WebAssets.hpp>
+
+namespace webassets
+{
+namespace test
+{
+
+class WebAssetsTest :
+  public ::testing::Test
+{
+  protected:
+  WebAssetsTest() {}
+  virtual ~WebAssetsTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+};
+
+TEST_F(WebAssetsTest, DetectsGzipInAcceptEncoding)
+{
+  EXPECT_TRUE(acceptsGzip("gzip"));
+  EXPECT_TRUE(acceptsGzip("gzip, deflate, br"));
+  EXPECT_TRUE(acceptsGzip("deflate, br, GZIP"));
+  EXPECT_TRUE(acceptsGzip("br;q=1.0, gzip;q=0.8, *;q=0.1"));
+  EXPECT_TRUE(acceptsGzip("x-gzip"));
+  EXPECT_TRUE(acceptsGzip("*"));
+
+  EXPECT_FALSE(acceptsGzip(nullptr));
+  EXPECT_FALSE(acceptsGzip(""));
+  EXPECT_FALSE(acceptsGzip("identity"));
+  EXPECT_FALSE(acceptsGzip("deflate, br"));
+  EXPECT_FALSE(acceptsGzip("gzipx"));
+  EXPECT_FALSE(acceptsGzip("gzip;q=0"));
+  EXPECT_FALSE(acceptsGzip("br, gzip ; q=0.000"));
+  EXPECT_TRUE(acceptsGzip("gzip;q=0.001"));
+}
+
+TEST_F(WebAssetsTest, MatchesTheEtagOfIfNoneMatch)
+{
+  const char* etag = "\"28c33610eb64d6bc\"";
+  EXPECT_TRUE(etagMatches("\"28c33610eb64d6bc\"", etag));
+  EXPECT_TRUE(etagMatches("W/\"28c33610eb64d6bc\"", etag));
+  EXPECT_TRUE(etagMatches("\"1234\", \"28c33610eb64d6bc\"", etag));
+  EXPECT_TRUE(etagMatches(" * ", etag));
+
+  EXPECT_FALSE(etagMatches(nullptr, etag));
+  EXPECT_FALSE(etagMatches("", etag));
+  EXPECT_FALSE(etagMatches("\"28c33610eb64d6b\"", etag));
+  EXPECT_FALSE(etagMatches("28c33610eb64d6bc", etag));
+  EXPECT_FALSE(etagMatches("\"1234\", \"5678\"", etag));
+  EXPECT_FALSE(etagMatches("\"28c33610eb64d6bc\"", ""));
+}
+
+TEST_F(WebAssetsTest, BuildsTheEtagOfFiles)
+{
+  char etag[24];
+  fileEtag(etag, sizeof(etag), 1234, 0x65A0B1C2);
+  EXPECT_STREQ("\"4d2-65a0b1c2\"", etag);
+
+  fileEtag(etag, sizeof(etag), UINT32_MAX, UINT32_MAX);
+  EXPECT_STREQ("\"ffffffff-ffffffff\"", etag);
+  EXPECT_TRUE(etagMatches(etag, etag));
+}
+
+} // namespace test
+} // namespace webassets
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
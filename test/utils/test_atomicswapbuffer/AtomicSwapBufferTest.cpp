@@ -0,0 +1,195 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <utils/AtomicSwapBuffer.hpp>
+
+namespace utils
+{
+namespace test
+{
+
+class AtomicSwapBufferTest :
+  public ::testing::Test
+{
+  protected:
+  AtomicSwapBufferTest() {}
+  virtual ~AtomicSwapBufferTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  struct Settings
+  {
+    uint16_t cellVoltageMin[20];
+    uint16_t cellVoltageMax[20];
+    float totalVoltageMin;
+    uint32_t counter;
+  };
+
+  /** Fills all fields of the settings with values derived from the counter. */
+  static void fill(Settings& settings, uint32_t counter)
+  {
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+      settings.cellVoltageMin[i] = static_cast<uint16_t>(counter);
+      settings.cellVoltageMax[i] = static_cast<uint16_t>(counter + 1);
+    }
+    settings.totalVoltageMin = static_cast<float>(counter);
+    settings.counter = counter;
+  }
+
+  /** Returns true, if all values of the settings belong to the same publication. */
+  static bool isConsistent(const Settings& settings)
+  {
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+      if (settings.cellVoltageMin[i] != static_cast<uint16_t>(settings.counter) ||
+          settings.cellVoltageMax[i] != static_cast<uint16_t>(settings.counter + 1))
+        return false;
+    }
+    return settings.totalVoltageMin == static_cast<float>(settings.counter);
+  }
+};
+
+TEST_F(AtomicSwapBufferTest, GetReturnsValueInitializedBufferBeforeFirstPublish)
+{
+  AtomicSwapBuffer<Settings> buffer;
+
+  ASSERT_NE(nullptr, buffer.get());
+  ASSERT_EQ(0u, buffer.get()->counter);
+  ASSERT_EQ(0u, buffer.generation());
+}
+
+TEST_F(AtomicSwapBufferTest, WriteBufferIsNotVisibleUntilPublished)
+{
+  AtomicSwapBuffer<Settings> buffer;
+
+  fill(buffer.writeBuffer(), 42);
+  ASSERT_EQ(0u, buffer.get()->counter);
+
+  buffer.publish();
+  ASSERT_EQ(42u, buffer.get()->counter);
+  ASSERT_TRUE(isConsistent(*buffer.get()));
+  ASSERT_EQ(1u, buffer.generation());
+}
+
+TEST_F(AtomicSwapBufferTest, WriteBufferIsNeverThePublishedBuffer)
+{
+  AtomicSwapBuffer<Settings, 3> buffer;
+
+  for (uint32_t i = 1; i <= 10; ++i)
+  {
+    ASSERT_NE(buffer.get(), &buffer.writeBuffer()) << "Failed publication: " << i;
+    fill(buffer.writeBuffer(), i);
+    buffer.publish();
+    ASSERT_EQ(i, buffer.get()->counter);
+    ASSERT_EQ(i, buffer.generation());
+  }
+}
+
+TEST_F(AtomicSwapBufferTest, PointerStaysValidForBufferCountMinusOnePublications)
+{
+  AtomicSwapBuffer<Settings, 3> buffer;
+  fill(buffer.writeBuffer(), 1);
+  buffer.publish();
+
+  // A reader fetched the pointer ...
+  const Settings* reader = buffer.get();
+
+  // ... and the writer publishes again and already fills the next buffer
+  fill(buffer.writeBuffer(), 2);
+  buffer.publish();
+  fill(buffer.writeBuffer(), 3);
+
+  ASSERT_EQ(1u, reader->counter);
+  ASSERT_TRUE(isConsistent(*reader));
+  ASSERT_EQ(2u, buffer.get()->counter);
+}
+
+TEST_F(AtomicSwapBufferTest, HeldValueIsNotReusedByTheWriter)
+{
+  AtomicSwapBuffer<Settings, 3> buffer;
+  fill(*buffer.tryWriteBuffer(), 1);
+  buffer.publish();
+
+  const Settings* reader = buffer.acquire();
+  for (uint32_t i = 2; i < 10; ++i)
+  {
+    Settings* value = buffer.tryWriteBuffer();
+    ASSERT_NE(nullptr, value);
+    ASSERT_NE(reader, value) << "Failed publication: " << i;
+    fill(*value, i);
+    buffer.publish();
+  }
+  ASSERT_EQ(1u, reader->counter);
+  ASSERT_TRUE(isConsistent(*reader));
+  ASSERT_EQ(9u, buffer.get()->counter);
+
+  // A second reader holds the value, which is then replaced: no buffer left for the writer
+  const Settings* reader2 = buffer.acquire();
+  fill(*buffer.tryWriteBuffer(), 10);
+  buffer.publish();
+  ASSERT_EQ(nullptr, buffer.tryWriteBuffer());
+  buffer.release(reader);
+  ASSERT_EQ(reader, buffer.tryWriteBuffer());
+  ASSERT_EQ(9u, reader2->counter);
+  buffer.release(reader2);
+}
+
+TEST_F(AtomicSwapBufferTest, HeldValuesAreConsistentWhilePublishing)
+{
+  AtomicSwapBuffer<Settings, 3> buffer;
+  fill(*buffer.tryWriteBuffer(), 0);
+  buffer.publish();
+
+  std::atomic<bool> stop {false};
+  std::atomic<uint32_t> tornReads {0};
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 3; ++r)
+  {
+    readers.emplace_back([&]()
+    {
+      while (!stop.load())
+      {
+        const Settings* value = buffer.acquire();
+        if (!isConsistent(*value)) tornReads++;
+        std::this_thread::yield(); // Keep the value over several publications
+        if (!isConsistent(*value)) tornReads++;
+        buffer.release(value);
+      }
+    });
+  }
+
+  for (uint32_t i = 1; i <= 20000; ++i)
+  {
+    Settings* value;
+    while ((value = buffer.tryWriteBuffer()) == nullptr) std::this_thread::yield();
+    fill(*value, i);
+    buffer.publish();
+  }
+  stop = true;
+  for (std::thread& reader : readers) reader.join();
+
+  ASSERT_EQ(0u, tornReads.load());
+  ASSERT_EQ(20000u, buffer.get()->counter);
+}
+
+} // namespace test
+} // namespace utils
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
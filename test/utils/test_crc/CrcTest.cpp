@@ -0,0 +1,222 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include <utils/Crc.hpp>
+
+namespace utils
+{
+namespace test
+{
+
+/** Tables of the former byte wise implementation in src/crc.cpp */
+static const uint16_t LEGACY_CRC16_TABLE[256] = {
+  0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+  0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+  0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+  0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+  0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+  0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+  0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+  0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+  0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+  0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+  0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+  0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+  0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+  0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+  0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+  0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+  0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+  0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+  0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+  0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+  0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+  0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+  0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+  0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+  0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+  0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+  0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+  0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+  0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+  0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+  0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+  0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040,
+};
+
+static const uint32_t LEGACY_CRC32_TABLE[256] = {
+  0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+  0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+  0x4C11DB70, 0x48D0C6C7, 0x4593E01E, 0x4152FDA9, 0x5F15ADAC, 0x5BD4B01B, 0x569796C2, 0x52568B75,
+  0x6A1936C8, 0x6ED82B7F, 0x639B0DA6, 0x675A1011, 0x791D4014, 0x7DDC5DA3, 0x709F7B7A, 0x745E66CD,
+  0x9823B6E0, 0x9CE2AB57, 0x91A18D8E, 0x95609039, 0x8B27C03C, 0x8FE6DD8B, 0x82A5FB52, 0x8664E6E5,
+  0xBE2B5B58, 0xBAEA46EF, 0xB7A96036, 0xB3687D81, 0xAD2F2D84, 0xA9EE3033, 0xA4AD16EA, 0xA06C0B5D,
+  0xD4326D90, 0xD0F37027, 0xDDB056FE, 0xD9714B49, 0xC7361B4C, 0xC3F706FB, 0xCEB42022, 0xCA753D95,
+  0xF23A8028, 0xF6FB9D9F, 0xFBB8BB46, 0xFF79A6F1, 0xE13EF6F4, 0xE5FFEB43, 0xE8BCCD9A, 0xEC7DD02D,
+  0x34867077, 0x30476DC0, 0x3D044B19, 0x39C556AE, 0x278206AB, 0x23431B1C, 0x2E003DC5, 0x2AC12072,
+  0x128E9DCF, 0x164F8078, 0x1B0CA6A1, 0x1FCDBB16, 0x018AEB13, 0x054BF6A4, 0x0808D07D, 0x0CC9CDCA,
+  0x7897AB07, 0x7C56B6B0, 0x71159069, 0x75D48DDE, 0x6B93DDDB, 0x6F52C06C, 0x6211E6B5, 0x66D0FB02,
+  0x5E9F46BF, 0x5A5E5B08, 0x571D7DD1, 0x53DC6066, 0x4D9B3063, 0x495A2DD4, 0x44190B0D, 0x40D816BA,
+  0xACA5C697, 0xA864DB20, 0xA527FDF9, 0xA1E6E04E, 0xBFA1B04B, 0xBB60ADFC, 0xB6238B25, 0xB2E29692,
+  0x8AAD2B2F, 0x8E6C3698, 0x832F1041, 0x87EE0DF6, 0x99A95DF3, 0x9D684044, 0x902B669D, 0x94EA7B2A,
+  0xE0B41DE7, 0xE4750050, 0xE9362689, 0xEDF73B3E, 0xF3B06B3B, 0xF771768C, 0xFA325055, 0xFEF34DE2,
+  0xC6BCF05F, 0xC27DEDE8, 0xCF3ECB31, 0xCBFFD686, 0xD5B88683, 0xD1799B34, 0xDC3ABDED, 0xD8FBA05A,
+  0x690CE0EE, 0x6DCDFD59, 0x608EDB80, 0x644FC637, 0x7A089632, 0x7EC98B85, 0x738AAD5C, 0x774BB0EB,
+  0x4F040D56, 0x4BC510E1, 0x46863638, 0x42472B8F, 0x5C007B8A, 0x58C1663D, 0x558240E4, 0x51435D53,
+  0x251D3B9E, 0x21DC2629, 0x2C9F00F0, 0x285E1D47, 0x36194D42, 0x32D850F5, 0x3F9B762C, 0x3B5A6B9B,
+  0x0315D626, 0x07D4CB91, 0x0A97ED48, 0x0E56F0FF, 0x1011A0FA, 0x14D0BD4D, 0x19939B94, 0x1D528623,
+  0xF12F560E, 0xF5EE4BB9, 0xF8AD6D60, 0xFC6C70D7, 0xE22B20D2, 0xE6EA3D65, 0xEBA91BBC, 0xEF68060B,
+  0xD727BBB6, 0xD3E6A601, 0xDEA580D8, 0xDA649D6F, 0xC423CD6A, 0xC0E2D0DD, 0xCDA1F604, 0xC960EBB3,
+  0xBD3E8D7E, 0xB9FF90C9, 0xB4BCB610, 0xB07DABA7, 0xAE3AFBA2, 0xAAFBE615, 0xA7B8C0CC, 0xA379DD7B,
+  0x9B3660C6, 0x9FF77D71, 0x92B45BA8, 0x9675461F, 0x8832161A, 0x8CF30BAD, 0x81B02D74, 0x857130C3,
+  0x5D8A9099, 0x594B8D2E, 0x5408ABF7, 0x50C9B640, 0x4E8EE645, 0x4A4FFBF2, 0x470CDD2B, 0x43CDC09C,
+  0x7B827D21, 0x7F436096, 0x7200464F, 0x76C15BF8, 0x68860BFD, 0x6C47164A, 0x61043093, 0x65C52D24,
+  0x119B4BE9, 0x155A565E, 0x18197087, 0x1CD86D30, 0x029F3D35, 0x065E2082, 0x0B1D065B, 0x0FDC1BEC,
+  0x3793A651, 0x3352BBE6, 0x3E119D3F, 0x3AD08088, 0x2497D08D, 0x2056CD3A, 0x2D15EBE3, 0x29D4F654,
+  0xC5A92679, 0xC1683BCE, 0xCC2B1D17, 0xC8EA00A0, 0xD6AD50A5, 0xD26C4D12, 0xDF2F6BCB, 0xDBEE767C,
+  0xE3A1CBC1, 0xE760D676, 0xEA23F0AF, 0xEEE2ED18, 0xF0A5BD1D, 0xF464A0AA, 0xF9278673, 0xFDE69BC4,
+  0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0, 0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C,
+  0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4,
+};
+
+class CrcTest :
+  public ::testing::Test
+{
+  protected:
+  CrcTest() {}
+  virtual ~CrcTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    _data.resize(1031);
+    for (std::size_t i = 0; i < _data.size(); ++i) _data[i] = static_cast<uint8_t>(i * 131 + (i >> 3));
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static uint16_t legacyCrc16(const uint8_t* data, std::size_t len)
+  {
+    uint16_t crc = 0xFFFF;
+    while (len--) crc = static_cast<uint16_t>((crc >> 8) ^ LEGACY_CRC16_TABLE[(crc ^ *data++) & 0xFF]);
+    return crc;
+  }
+
+  static uint32_t legacyCrc32(uint32_t crc, const uint8_t* data, std::size_t len)
+  {
+    while (len--) crc = (crc << 8) ^ LEGACY_CRC32_TABLE[((crc >> 24) ^ *data++) & 0xFF];
+    return crc;
+  }
+
+  /** Bit wise Dallas CRC8 (OneWire library) */
+  static uint8_t bitwiseCrc8(const uint8_t* data, std::size_t len)
+  {
+    uint8_t crc = 0;
+    while (len--)
+    {
+      uint8_t inbyte = *data++;
+      for (uint8_t i = 0; i < 8; ++i)
+      {
+        const uint8_t mix = (crc ^ inbyte) & 0x01;
+        crc >>= 1;
+        if (mix) crc ^= 0x8C;
+        inbyte >>= 1;
+      }
+    }
+    return crc;
+  }
+
+  std::vector<uint8_t> _data;
+};
+
+TEST_F(CrcTest, GeneratedTablesMatchTheLegacyTables)
+{
+  for (std::size_t i = 0; i < 256; ++i)
+  {
+    EXPECT_EQ(LEGACY_CRC16_TABLE[i], Crc16Modbus::TABLES<1>[0][i]) << "index " << i;
+    EXPECT_EQ(LEGACY_CRC32_TABLE[i], Crc32Mpeg2::TABLES<1>[0][i]) << "index " << i;
+  }
+}
+
+TEST_F(CrcTest, CalculatesTheCheckValues)
+{
+  const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  EXPECT_EQ(0x4B37, Crc16Modbus::compute<1>(check, sizeof(check)));
+  EXPECT_EQ(0x4B37, Crc16Modbus::compute<4>(check, sizeof(check)));
+  EXPECT_EQ(0x4B37, Crc16Modbus::compute<8>(check, sizeof(check)));
+  EXPECT_EQ(0x0376E6E7u, Crc32Mpeg2::compute<1>(check, sizeof(check)));
+  EXPECT_EQ(0x0376E6E7u, Crc32Mpeg2::compute<4>(check, sizeof(check)));
+  EXPECT_EQ(0x0376E6E7u, Crc32Mpeg2::compute<8>(check, sizeof(check)));
+  EXPECT_EQ(0xA1, Crc8Maxim::compute<1>(check, sizeof(check)));
+  EXPECT_EQ(0xA1, Crc8Maxim::compute<4>(check, sizeof(check)));
+  EXPECT_EQ(0xA1, Crc8Maxim::compute<8>(check, sizeof(check)));
+}
+
+/** All lengths and offsets, so that every path of the slicing (blocks and remaining bytes) is used */
+TEST_F(CrcTest, AllStrategiesMatchTheReference)
+{
+  for (std::size_t offset = 0; offset < 8; ++offset)
+  {
+    for (std::size_t len = 0; len <= 40; ++len)
+    {
+      const uint8_t* data = _data.data() + offset;
+      const uint16_t crc16 = legacyCrc16(data, len);
+      EXPECT_EQ(crc16, Crc16Modbus::compute<1>(data, len)) << "len " << len;
+      EXPECT_EQ(crc16, Crc16Modbus::compute<4>(data, len)) << "len " << len;
+      EXPECT_EQ(crc16, Crc16Modbus::compute<8>(data, len)) << "len " << len;
+
+      const uint32_t crc32 = legacyCrc32(0xFFFFFFFF, data, len);
+      EXPECT_EQ(crc32, Crc32Mpeg2::compute<1>(data, len)) << "len " << len;
+      EXPECT_EQ(crc32, Crc32Mpeg2::compute<4>(data, len)) << "len " << len;
+      EXPECT_EQ(crc32, Crc32Mpeg2::compute<8>(data, len)) << "len " << len;
+
+      const uint8_t crc8 = bitwiseCrc8(data, len);
+      EXPECT_EQ(crc8, Crc8Maxim::compute<1>(data, len)) << "len " << len;
+      EXPECT_EQ(crc8, Crc8Maxim::compute<8>(data, len)) << "len " << len;
+    }
+  }
+
+  EXPECT_EQ(legacyCrc16(_data.data(), _data.size()), Crc16Modbus::compute<8>(_data.data(), _data.size()));
+  EXPECT_EQ(legacyCrc32(0xFFFFFFFF, _data.data(), _data.size()), Crc32Mpeg2::compute<8>(_data.data(), _data.size()));
+}
+
+TEST_F(CrcTest, UpdateContinuesThePreviousResult)
+{
+  const std::size_t split = 333;
+  const uint32_t expected = Crc32Mpeg2::compute(_data.data(), _data.size());
+  uint32_t crc = Crc32Mpeg2::INIT;
+  crc = Crc32Mpeg2::update<8>(crc, _data.data(), split);
+  crc = Crc32Mpeg2::update<4>(crc, _data.data() + split, _data.size() - split);
+  EXPECT_EQ(expected, crc);
+
+  const uint16_t crc16 = Crc16Modbus::update(Crc16Modbus::compute(_data.data(), split), _data.data() + split, 5);
+  EXPECT_EQ(Crc16Modbus::compute(_data.data(), split + 5), crc16);
+}
+
+TEST_F(CrcTest, CalculatesTheChecksumsOfTheDevices)
+{
+  const uint8_t data[] = {0xDD, 0xA5, 0x03, 0x00, 0xFF, 0xFD, 0x77};
+  EXPECT_EQ(0xF8, checksum::sum8(data, sizeof(data)));
+  EXPECT_EQ(0x03F8, checksum::sum16(data, sizeof(data)));
+  EXPECT_EQ(0xFC08, checksum::negSum16(data, sizeof(data)));
+  EXPECT_EQ(0, static_cast<uint16_t>(checksum::sum16(data, sizeof(data)) + checksum::negSum16(data, sizeof(data))));
+  EXPECT_EQ(0xDD ^ 0xA5 ^ 0x03 ^ 0x00 ^ 0xFF ^ 0xFD ^ 0x77, checksum::xor8(data, sizeof(data)));
+  EXPECT_EQ(0, checksum::sum8(data, 0));
+}
+
+} // namespace test
+} // namespace utils
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
@@ -0,0 +1,322 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <utils/FrameDecoder.hpp>
+
+namespace utils
+{
+namespace test
+{
+
+using Status = FrameDecoder::Status;
+
+/** JBD: 0xDD, cmd, status, len, data, checksum (2 bytes), 0x77 */
+static constexpr FrameFormat JBD_FORMAT {
+  .soi = {0xDD}, .soiLen = 1, .storeSoi = true, .eoi = 0x77,
+  .length = FrameFormat::Length::Field, .lenPos = 3, .lenSize = 1, .lenAdd = 7, .maxLen = 0xFF + 7,
+  .checksum = FrameFormat::Checksum::NegSum16, .checksumSize = 2, .checksumTail = 1, .checksumStart = 2};
+
+/** Daly: 0xA5, address, cmd, 0x08, 8 data bytes, sum8 */
+static constexpr FrameFormat DALY_FORMAT {
+  .soi = {0xA5}, .soiLen = 1, .storeSoi = true,
+  .length = FrameFormat::Length::Fixed, .fixedLen = 13,
+  .checksum = FrameFormat::Checksum::Sum8, .checksumSize = 1};
+
+/** JK: 0x4E 0x57, length (2 bytes, counted from the length field), ..., 4 bytes sum16 (SOI included) */
+static constexpr FrameFormat JK_FORMAT {
+  .soi = {0x4E, 0x57}, .soiLen = 2, .storeSoi = false,
+  .length = FrameFormat::Length::Field, .lenPos = 2, .lenSize = 2, .lenAdd = 2, .maxLen = 0x200,
+  .checksum = FrameFormat::Checksum::Sum16, .checksumSize = 4};
+
+/** Seplos: '~', ASCII-hex payload, 4 characters negSum16, CR */
+static constexpr FrameFormat SEPLOS_FORMAT {
+  .soi = {0x7E}, .soiLen = 1, .storeSoi = false, .eoi = 0x0D,
+  .length = FrameFormat::Length::Eoi, .maxLen = 0xFF,
+  .encoding = FrameFormat::Encoding::AsciiHex,
+  .checksum = FrameFormat::Checksum::NegSum16, .checksumSize = 4, .checksumTail = 1, .checksumStart = 1};
+
+class FrameDecoderTest :
+  public ::testing::Test
+{
+  protected:
+  FrameDecoderTest() {}
+  virtual ~FrameDecoderTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static std::vector<uint8_t> jbdFrame(uint8_t cmd, const std::vector<uint8_t>& data)
+  {
+    std::vector<uint8_t> frame {0xDD, cmd, 0x00, static_cast<uint8_t>(data.size())};
+    frame.insert(frame.end(), data.begin(), data.end());
+    uint16_t sum = 0;
+    for (uint8_t b : data) sum += b;
+    const uint16_t checksum = (sum + data.size() - 1) ^ 0xFFFF;
+    frame.push_back(checksum >> 8);
+    frame.push_back(checksum & 0xFF);
+    frame.push_back(0x77);
+    return frame;
+  }
+
+  static std::vector<uint8_t> dalyFrame(uint8_t cmd, uint8_t value)
+  {
+    std::vector<uint8_t> frame {0xA5, 0x01, cmd, 0x08, value, 0, 0, 0, 0, 0, 0, 0};
+    uint8_t sum = 0;
+    for (uint8_t b : frame) sum += b;
+    frame.push_back(sum);
+    return frame;
+  }
+
+  static std::vector<uint8_t> jkFrame(const std::vector<uint8_t>& data)
+  {
+    const uint16_t len = static_cast<uint16_t>(data.size() + 2 + 4);
+    std::vector<uint8_t> frame {0x4E, 0x57, static_cast<uint8_t>(len >> 8), static_cast<uint8_t>(len & 0xFF)};
+    frame.insert(frame.end(), data.begin(), data.end());
+    uint16_t sum = 0;
+    for (uint8_t b : frame) sum += b;
+    for (uint8_t b : {uint8_t(0), uint8_t(0), static_cast<uint8_t>(sum >> 8), static_cast<uint8_t>(sum & 0xFF)}) frame.push_back(b);
+    return frame;
+  }
+
+  static std::vector<uint8_t> seplosFrame(const char* payload)
+  {
+    std::vector<uint8_t> frame {0x7E};
+    uint16_t sum = 0;
+    for (const char* p = payload; *p != 0; ++p)
+    {
+      frame.push_back(static_cast<uint8_t>(*p));
+      sum += static_cast<uint8_t>(*p);
+    }
+    char checksum[5];
+    std::snprintf(checksum, sizeof(checksum), "%04X", static_cast<uint16_t>(~sum + 1));
+    for (int i = 0; i < 4; ++i) frame.push_back(static_cast<uint8_t>(checksum[i]));
+    frame.push_back(0x0D);
+    return frame;
+  }
+
+  /** Pushes all bytes, returns the decoded frames */
+  static std::vector<std::vector<uint8_t>> decodeAll(FrameDecoder& decoder, const std::vector<uint8_t>& stream, std::size_t chunkSize = 1)
+  {
+    std::vector<std::vector<uint8_t>> frames;
+    for (std::size_t pos = 0; pos < stream.size();)
+    {
+      const std::size_t len = std::min(chunkSize, stream.size() - pos);
+      std::size_t consumed = 0;
+      if (decoder.feed(&stream[pos], len, consumed) == Status::Frame)
+        frames.emplace_back(decoder.frame(), decoder.frame() + decoder.length());
+      pos += consumed;
+    }
+    return frames;
+  }
+
+  static void append(std::vector<uint8_t>& stream, const std::vector<uint8_t>& bytes)
+  {
+    stream.insert(stream.end(), bytes.begin(), bytes.end());
+  }
+};
+
+TEST_F(FrameDecoderTest, Jbd_FrameStoredWithSoi)
+{
+  uint8_t buf[300];
+  FrameDecoder decoder(JBD_FORMAT, buf, sizeof(buf));
+  const std::vector<uint8_t> frame = jbdFrame(0x03, {1, 2, 3, 4, 5});
+
+  for (std::size_t i = 0; i < frame.size() - 1; ++i) ASSERT_EQ(Status::Incomplete, decoder.push(frame[i]));
+  ASSERT_EQ(Status::Frame, decoder.push(frame.back()));
+  ASSERT_EQ(frame, std::vector<uint8_t>(decoder.frame(), decoder.frame() + decoder.length()));
+  ASSERT_EQ(0u, decoder.pending());
+  ASSERT_EQ(1u, decoder.statistics().frames);
+}
+
+TEST_F(FrameDecoderTest, Jk_FrameWithoutSoi)
+{
+  uint8_t buf[0x200];
+  FrameDecoder decoder(JK_FORMAT, buf, sizeof(buf));
+  const std::vector<uint8_t> frame = jkFrame({0x79, 0x03, 0x01, 0x0C, 0xE4, 0x68});
+
+  const auto frames = decodeAll(decoder, frame);
+  ASSERT_EQ(1u, frames.size());
+  ASSERT_EQ(std::vector<uint8_t>(frame.begin() + 2, frame.end()), frames[0]);
+}
+
+TEST_F(FrameDecoderTest, Seplos_AsciiHexChecksum)
+{
+  uint8_t buf[0xFF];
+  FrameDecoder decoder(SEPLOS_FORMAT, buf, sizeof(buf));
+  std::vector<uint8_t> frame = seplosFrame("20004600106A0001");
+
+  auto frames = decodeAll(decoder, frame);
+  ASSERT_EQ(1u, frames.size());
+  ASSERT_EQ(std::vector<uint8_t>(frame.begin() + 1, frame.end()), frames[0]);
+
+  frame[frame.size() - 2] = 'G'; // Not a hex character
+  ASSERT_TRUE(decodeAll(decoder, frame).empty());
+  frame[frame.size() - 2] = (frame[frame.size() - 2] == '0') ? '1' : '0';
+  ASSERT_TRUE(decodeAll(decoder, frame).empty());
+  ASSERT_EQ(2u, decoder.statistics().checksumErrors);
+}
+
+TEST_F(FrameDecoderTest, ArbitraryChunkSizes)
+{
+  std::vector<uint8_t> stream;
+  std::vector<std::vector<uint8_t>> expected;
+  for (uint8_t i = 0; i < 10; ++i)
+  {
+    expected.push_back(jbdFrame(0x03 + (i & 1), std::vector<uint8_t>(i * 3, i)));
+    append(stream, {0x00, 0x13});
+    append(stream, expected.back());
+  }
+
+  for (std::size_t chunkSize = 1; chunkSize <= stream.size(); ++chunkSize)
+  {
+    uint8_t buf[300];
+    FrameDecoder decoder(JBD_FORMAT, buf, sizeof(buf));
+    ASSERT_EQ(expected, decodeAll(decoder, stream, chunkSize)) << "Chunk size " << chunkSize;
+    ASSERT_EQ(20u, decoder.statistics().skippedBytes);
+  }
+}
+
+TEST_F(FrameDecoderTest, GarbageWithSoi_NextFrameNotLost)
+{
+  uint8_t buf[300];
+  FrameDecoder decoder(JBD_FORMAT, buf, sizeof(buf));
+  const std::vector<uint8_t> frame = jbdFrame(0x04, {0x0C, 0xE4, 0x0C, 0xE5});
+
+  // The SOI in the garbage starts a frame with a length of 0x30, which swallows the real frame
+  std::vector<uint8_t> stream {0xDD, 0x01, 0x00, 0x30};
+  append(stream, frame);
+
+  const auto frames = decodeAll(decoder, stream);
+  ASSERT_EQ(0u, frames.size()); // The garbage frame is not complete yet
+
+  // A frame with the wrong EOI ends the garbage frame, the replay finds the real frame and the next one
+  std::vector<uint8_t> rest(0x30 + 7 - stream.size(), 0x00);
+  append(rest, frame);
+  const auto frames2 = decodeAll(decoder, rest);
+  ASSERT_EQ(2u, frames2.size());
+  ASSERT_EQ(frame, frames2[0]);
+  ASSERT_EQ(frame, frames2[1]);
+  ASSERT_EQ(1u, decoder.statistics().formatErrors);
+}
+
+TEST_F(FrameDecoderTest, FixedLength_FakeSoiBetweenFrames)
+{
+  // Daly sends several frames of 13 bytes; a 0xA5 in the garbage shifts the frame boundaries
+  uint8_t buf[2 * 13];
+  FrameDecoder decoder(DALY_FORMAT, buf, sizeof(buf));
+  const std::vector<uint8_t> frame1 = dalyFrame(0x95, 1);
+  const std::vector<uint8_t> frame2 = dalyFrame(0x95, 2);
+  const std::vector<uint8_t> frame3 = dalyFrame(0x95, 3);
+
+  std::vector<uint8_t> stream {0xA5, 0x18};
+  append(stream, frame1);
+  append(stream, frame2);
+  append(stream, {0xA5});
+  append(stream, frame3);
+
+  for (std::size_t chunkSize : {1, 5, 13, 64})
+  {
+    decoder.reset();
+    const auto frames = decodeAll(decoder, stream, chunkSize);
+    ASSERT_EQ((std::vector<std::vector<uint8_t>> {frame1, frame2, frame3}), frames) << "Chunk size " << chunkSize;
+  }
+}
+
+TEST_F(FrameDecoderTest, FrameTooLong_FormatError)
+{
+  uint8_t buf[32];
+  FrameDecoder decoder(JBD_FORMAT, buf, sizeof(buf));
+  const std::vector<uint8_t> tooLong = jbdFrame(0x03, std::vector<uint8_t>(40, 0x11));
+  const std::vector<uint8_t> frame = jbdFrame(0x03, {0x22});
+
+  std::vector<uint8_t> stream(tooLong);
+  append(stream, frame);
+  const auto frames = decodeAll(decoder, stream);
+  ASSERT_EQ(1u, frames.size());
+  ASSERT_EQ(frame, frames[0]);
+  ASSERT_EQ(1u, decoder.statistics().formatErrors);
+}
+
+TEST_F(FrameDecoderTest, ChecksumError_StatusAndStatistics)
+{
+  uint8_t buf[300];
+  FrameDecoder decoder(JBD_FORMAT, buf, sizeof(buf));
+  std::vector<uint8_t> frame = jbdFrame(0x03, {1, 2, 3});
+  frame[5] ^= 0x01;
+
+  Status status = Status::Incomplete;
+  for (uint8_t b : frame) status = decoder.push(b);
+  ASSERT_EQ(Status::ChecksumError, status);
+  ASSERT_EQ(1u, decoder.statistics().checksumErrors);
+  ASSERT_EQ(0u, decoder.statistics().frames);
+}
+
+TEST_F(FrameDecoderTest, RandomGarbage_AllFramesFound)
+{
+  for (uint32_t seed = 1; seed <= 50; ++seed)
+  {
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int> byteDist(0, 255);
+    std::uniform_int_distribution<int> lenDist(0, 40);
+
+    std::vector<uint8_t> stream;
+    std::vector<std::vector<uint8_t>> expected;
+    for (uint8_t i = 0; i < 20; ++i)
+    {
+      // Garbage with SOI bytes, but without an EOI (0x77), so no garbage frame can be valid
+      for (int n = lenDist(random); n > 0; --n)
+      {
+        uint8_t b = static_cast<uint8_t>(byteDist(random));
+        if (b == 0x77) b = 0xDD;
+        stream.push_back(b);
+      }
+      std::vector<uint8_t> data;
+      for (int n = lenDist(random); n > 0; --n) data.push_back(static_cast<uint8_t>(byteDist(random)));
+      expected.push_back(jbdFrame(0x03, data));
+      append(stream, expected.back());
+    }
+
+    uint8_t buf[300];
+    FrameDecoder decoder(JBD_FORMAT, buf, sizeof(buf));
+    const std::size_t chunkSize = 1 + (seed % 17);
+    std::vector<std::vector<uint8_t>> frames = decodeAll(decoder, stream, chunkSize);
+    // A frame started in the garbage in front of the last frames may still wait for its end
+    while (decoder.flush() == Status::Frame) frames.emplace_back(decoder.frame(), decoder.frame() + decoder.length());
+    ASSERT_EQ(expected, frames) << "Failed seed: " << seed;
+  }
+}
+
+TEST_F(FrameDecoderTest, Reset_DropsPendingBytes)
+{
+  uint8_t buf[2 * 13];
+  FrameDecoder decoder(DALY_FORMAT, buf, sizeof(buf));
+  const std::vector<uint8_t> frame = dalyFrame(0x90, 7);
+
+  std::vector<uint8_t> stream(frame.begin(), frame.begin() + 5);
+  ASSERT_TRUE(decodeAll(decoder, stream).empty());
+  ASSERT_EQ(5u, decoder.pending());
+
+  decoder.reset();
+  ASSERT_EQ(0u, decoder.pending());
+  ASSERT_EQ((std::vector<std::vector<uint8_t>> {frame}), decodeAll(decoder, frame));
+}
+
+} // namespace test
+} // namespace utils
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
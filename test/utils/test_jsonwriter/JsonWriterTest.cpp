@@ -0,0 +1,177 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include <utils/JsonWriter.hpp>
+
+namespace utils
+{
+namespace test
+{
+
+class JsonWriterTest :
+  public ::testing::Test
+{
+  protected:
+  JsonWriterTest() {}
+  virtual ~JsonWriterTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp()
+  {
+    output.clear();
+    chunkSizes.clear();
+  }
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  /** Sink, which collects the chunks like WebServer::sendContent() */
+  struct Sink
+  {
+    JsonWriterTest* test;
+    void operator()(const char* data, std::size_t len)
+    {
+      test->output.append(data, len);
+      test->chunkSizes.push_back(len);
+    }
+  };
+
+  std::string output;
+  std::vector<std::size_t> chunkSizes;
+};
+
+TEST_F(JsonWriterTest, WritesNativeNumbersAndBooleans)
+{
+  JsonWriter<64, Sink> json(Sink{this});
+  json.beginObject()
+    .add("u8", static_cast<uint8_t>(255))
+    .add("i16", static_cast<int16_t>(-1234))
+    .add("u32", std::numeric_limits<uint32_t>::max())
+    .add("i32", std::numeric_limits<int32_t>::min())
+    .add("zero", 0)
+    .add("float", 53.2f)
+    .add("double", -0.125, 3)
+    .add("on", true)
+    .add("off", false)
+    .endObject();
+  json.flush();
+
+  ASSERT_EQ("{\"u8\":255,\"i16\":-1234,\"u32\":4294967295,\"i32\":-2147483648,\"zero\":0,"
+            "\"float\":53.20,\"double\":-0.125,\"on\":true,\"off\":false}", output);
+  ASSERT_EQ(0, json.depth());
+  ASSERT_FALSE(json.hasError());
+}
+
+TEST_F(JsonWriterTest, WritesNestedObjectsAndArrays)
+{
+  JsonWriter<64, Sink> json(Sink{this});
+  json.beginObject();
+  json.beginObject("system").add("name", "bsc").endObject();
+  json.beginArray("cells").value(3300).value(3301).value(3302).endArray();
+  json.beginArray("bms");
+  json.beginObject().add("nr", 0).endObject();
+  json.beginObject().add("nr", 1).beginArray("empty").endArray().endObject();
+  json.endArray();
+  json.beginObject("empty").endObject();
+  json.endObject();
+  json.flush();
+
+  ASSERT_EQ("{\"system\":{\"name\":\"bsc\"},\"cells\":[3300,3301,3302],"
+            "\"bms\":[{\"nr\":0},{\"nr\":1,\"empty\":[]}],\"empty\":{}}", output);
+  ASSERT_FALSE(json.hasError());
+}
+
+TEST_F(JsonWriterTest, EscapesStrings)
+{
+  JsonWriter<32, Sink> json(Sink{this});
+  json.beginArray()
+    .value("a\"b\\c")
+    .value("line1\nline2\r\t")
+    .value("\x01\x1f")
+    .value("Grad °C")
+    .value(static_cast<const char*>(nullptr))
+    .endArray();
+  json.flush();
+
+  ASSERT_EQ("[\"a\\\"b\\\\c\",\"line1\\nline2\\r\\t\",\"\\u0001\\u001f\",\"Grad °C\",null]", output);
+}
+
+TEST_F(JsonWriterTest, WritesNullForNotFiniteValues)
+{
+  JsonWriter<32, Sink> json(Sink{this});
+  json.beginArray().value(NAN).value(INFINITY).value(1.5f).addNull(nullptr).endArray();
+  json.flush();
+
+  ASSERT_EQ("[null,null,1.50,null]", output);
+}
+
+TEST_F(JsonWriterTest, StreamsChunksOfBufferSize)
+{
+  constexpr std::size_t BUFFER_SIZE {32};
+  JsonWriter<BUFFER_SIZE, Sink> json(Sink{this});
+
+  json.beginArray();
+  for (uint16_t i = 0; i < 100; ++i)
+    json.value(static_cast<uint16_t>(3000 + i));
+  json.endArray();
+
+  // The buffer already ran full several times, also in the middle of a value
+  ASSERT_GT(chunkSizes.size(), 1u);
+  json.flush();
+
+  std::string expected = "[";
+  for (uint16_t i = 0; i < 100; ++i)
+  {
+    if (i > 0) expected += ",";
+    expected += std::to_string(3000 + i);
+  }
+  expected += "]";
+
+  ASSERT_EQ(expected, output);
+  ASSERT_EQ(expected.size(), json.bytesWritten());
+  ASSERT_EQ(chunkSizes.size(), json.chunks());
+  for (std::size_t i = 0; i + 1 < chunkSizes.size(); ++i)
+    ASSERT_EQ(BUFFER_SIZE, chunkSizes[i]) << "Chunk " << i;
+  ASSERT_LE(chunkSizes.back(), BUFFER_SIZE);
+}
+
+TEST_F(JsonWriterTest, FlushWithoutDataDoesNotCallTheSink)
+{
+  JsonWriter<32, Sink> json(Sink{this});
+  json.flush();
+  ASSERT_EQ(0u, chunkSizes.size());
+  ASSERT_EQ(0u, json.chunks());
+}
+
+TEST_F(JsonWriterTest, DetectsWrongNesting)
+{
+  JsonWriter<32, Sink> json(Sink{this});
+  json.beginObject().endObject();
+  ASSERT_FALSE(json.hasError());
+  json.endObject();
+  ASSERT_TRUE(json.hasError());
+
+  JsonWriter<32, Sink> deep(Sink{this});
+  for (uint8_t i = 0; i <= JsonWriter<32, Sink>::MAX_DEPTH; ++i)
+    deep.beginArray();
+  ASSERT_TRUE(deep.hasError());
+}
+
+} // namespace test
+} // namespace utils
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
@@ -0,0 +1,171 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <utils/SeqLock.hpp>
+#include <BmsDataTypes.hpp>
+
+namespace utils
+{
+namespace test
+{
+
+class SeqLockTest :
+  public ::testing::Test
+{
+  protected:
+  SeqLockTest() {}
+  virtual ~SeqLockTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  /** Creates a snapshot, with all cell voltages and the derived values set to the given counter value. */
+  static BmsDataSnapshot makeSnapshot(uint32_t counter)
+  {
+    const uint16_t value = static_cast<uint16_t>(counter);
+    BmsDataSnapshot snapshot {};
+    for (std::size_t i = 0; i < BMSDATA_MAX_CELLS; ++i)
+      snapshot.cellVoltage[i] = value;
+
+    snapshot.maxCellVoltage = value;
+    snapshot.minCellVoltage = value;
+    snapshot.avgVoltage = value;
+    snapshot.lastDataMillis = counter;
+    return snapshot;
+  }
+
+  /** Returns true, if all values of the snapshot belong to the same write. */
+  static bool isConsistent(const BmsDataSnapshot& snapshot)
+  {
+    const uint16_t value = static_cast<uint16_t>(snapshot.lastDataMillis);
+    for (std::size_t i = 0; i < BMSDATA_MAX_CELLS; ++i)
+    {
+      if (snapshot.cellVoltage[i] != value)
+        return false;
+    }
+
+    return (snapshot.maxCellVoltage == value) &&
+           (snapshot.minCellVoltage == value) &&
+           (snapshot.avgVoltage == value);
+  }
+};
+
+TEST_F(SeqLockTest, ReadReturnsLastWrittenValue)
+{
+  SeqLock<BmsDataSnapshot> seqLock;
+  BmsDataSnapshot snapshot {};
+
+  seqLock.write(makeSnapshot(3300));
+  ASSERT_TRUE(seqLock.tryRead(snapshot));
+  ASSERT_EQ(3300, snapshot.cellVoltage[BMSDATA_MAX_CELLS - 1]);
+  ASSERT_TRUE(isConsistent(snapshot));
+
+  seqLock.write(makeSnapshot(3456));
+  ASSERT_TRUE(seqLock.read(snapshot, 0));
+  ASSERT_EQ(3456, snapshot.cellVoltage[0]);
+  ASSERT_TRUE(isConsistent(snapshot));
+}
+
+TEST_F(SeqLockTest, SequenceIsIncrementedByTwoPerWrite)
+{
+  SeqLock<BmsDataSnapshot> seqLock;
+  ASSERT_EQ(0u, seqLock.sequence());
+
+  seqLock.write(makeSnapshot(1));
+  ASSERT_EQ(2u, seqLock.sequence());
+
+  seqLock.write(makeSnapshot(2));
+  ASSERT_EQ(4u, seqLock.sequence());
+}
+
+TEST_F(SeqLockTest, SupportsSizesNotMultipleOfWordSize)
+{
+  struct OddSize
+  {
+    uint8_t data[7];
+  };
+
+  SeqLock<OddSize> seqLock;
+  const OddSize written {{1, 2, 3, 4, 5, 6, 7}};
+  OddSize read {};
+
+  seqLock.write(written);
+  ASSERT_TRUE(seqLock.tryRead(read));
+  for (std::size_t i = 0; i < sizeof(written.data); ++i)
+    ASSERT_EQ(written.data[i], read.data[i]) << "Failed index: " << i;
+}
+
+TEST_F(SeqLockTest, StressTest_NoTornCellVoltages)
+{
+  constexpr std::size_t NUMBER_OF_READERS {3};
+  constexpr uint32_t NUMBER_OF_WRITES {200000};
+
+  SeqLock<BmsDataSnapshot> seqLock;
+  seqLock.write(makeSnapshot(0));
+
+  std::atomic<bool> writerDone {false};
+  std::atomic<uint32_t> tornReads {0};
+  std::atomic<uint32_t> consistentReads {0};
+  std::atomic<uint32_t> outOfOrderReads {0};
+
+  std::vector<std::thread> readers;
+  for (std::size_t r = 0; r < NUMBER_OF_READERS; ++r)
+  {
+    readers.emplace_back([&]()
+    {
+      BmsDataSnapshot snapshot;
+      unsigned long lastCounter = 0;
+      while (!writerDone.load(std::memory_order_relaxed))
+      {
+        if (!seqLock.read(snapshot, 100))
+          continue;
+
+        if (!isConsistent(snapshot))
+          tornReads++;
+        else
+          consistentReads++;
+
+        // The writer only increments the counter, so a reader must never see an older value.
+        if (snapshot.lastDataMillis < lastCounter)
+          outOfOrderReads++;
+        lastCounter = snapshot.lastDataMillis;
+      }
+    });
+  }
+
+  for (uint32_t i = 1; i <= NUMBER_OF_WRITES; ++i)
+    seqLock.write(makeSnapshot(i));
+
+  writerDone = true;
+  for (auto& reader : readers)
+    reader.join();
+
+  ASSERT_EQ(0u, tornReads.load());
+  ASSERT_EQ(0u, outOfOrderReads.load());
+  ASSERT_LT(0u, consistentReads.load());
+
+  BmsDataSnapshot snapshot;
+  ASSERT_TRUE(seqLock.tryRead(snapshot));
+  ASSERT_EQ(NUMBER_OF_WRITES, snapshot.lastDataMillis);
+  ASSERT_TRUE(isConsistent(snapshot));
+}
+
+} // namespace test
+} // namespace utils
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
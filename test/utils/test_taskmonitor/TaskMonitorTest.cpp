@@ -0,0 +1,142 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <utils/TaskMonitor.hpp>
+
+namespace utils
+{
+namespace test
+{
+
+class TaskMonitorTest :
+  public ::testing::Test
+{
+  protected:
+  TaskMonitorTest() {}
+  virtual ~TaskMonitorTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  /** Runs one cycle with the given duration and returns the start of the next cycle */
+  static uint32_t cycle(TaskMonitor& monitor, uint32_t nowUs, uint32_t durationUs, uint32_t periodUs)
+  {
+    monitor.begin(nowUs);
+    monitor.end(nowUs + durationUs);
+    return nowUs + periodUs;
+  }
+};
+
+TEST_F(TaskMonitorTest, SortsDurationsIntoBuckets)
+{
+  EXPECT_EQ(0u, TaskMonitor::bucket(0));
+  EXPECT_EQ(0u, TaskMonitor::bucket(100));
+  EXPECT_EQ(1u, TaskMonitor::bucket(101));
+  EXPECT_EQ(2u, TaskMonitor::bucket(1000));
+  EXPECT_EQ(TASK_MONITOR_BUCKETS - 2, TaskMonitor::bucket(1000000));
+  EXPECT_EQ(TASK_MONITOR_BUCKETS - 1, TaskMonitor::bucket(1000001));
+  EXPECT_EQ(TASK_MONITOR_BUCKETS - 1, TaskMonitor::bucket(UINT32_MAX));
+}
+
+TEST_F(TaskMonitorTest, CollectsTheCycleDurations)
+{
+  TaskMonitor monitor;
+  uint32_t now = 0;
+  now = cycle(monitor, now, 50, 1000000);
+  now = cycle(monitor, now, 2000, 1000000);
+  now = cycle(monitor, now, 2000, 1000000);
+  now = cycle(monitor, now, 3000000, 4000000);
+
+  const TaskStatistics stats = monitor.statistics();
+  EXPECT_EQ(4u, stats.cycles);
+  EXPECT_EQ(3000000u, stats.durationLastUs);
+  EXPECT_EQ(50u, stats.durationMinUs);
+  EXPECT_EQ(3000000u, stats.durationMaxUs);
+  EXPECT_EQ((50u + 2000u + 2000u + 3000000u) / 4u, stats.durationAvgUs);
+  EXPECT_EQ(1u, stats.histogram[0]);
+  EXPECT_EQ(2u, stats.histogram[3]);
+  EXPECT_EQ(1u, stats.histogram[TASK_MONITOR_BUCKETS - 1]);
+}
+
+TEST_F(TaskMonitorTest, EndWithoutBeginIsIgnored)
+{
+  TaskMonitor monitor;
+  monitor.end(100);
+  monitor.begin(200);
+  monitor.end(300);
+  monitor.end(400);
+  const TaskStatistics stats = monitor.statistics();
+  EXPECT_EQ(1u, stats.cycles);
+  EXPECT_EQ(100u, stats.durationLastUs);
+}
+
+TEST_F(TaskMonitorTest, MeasuresTheJitterOfThePeriod)
+{
+  TaskMonitor monitor;
+  uint32_t now = 0;
+  for (int i = 0; i < 10; ++i) now = cycle(monitor, now, 10, 1000);
+  TaskStatistics stats = monitor.statistics();
+  EXPECT_EQ(1000u, stats.periodLastUs);
+  EXPECT_EQ(0u, stats.jitterUs);
+  EXPECT_EQ(0u, stats.jitterMaxUs);
+
+  // One late cycle: two periods differ by 500 µs
+  now += 500;
+  now = cycle(monitor, now, 10, 1000);
+  now = cycle(monitor, now, 10, 1000);
+  stats = monitor.statistics();
+  EXPECT_EQ(500u, stats.jitterMaxUs);
+  EXPECT_EQ(1000u, stats.periodLastUs);
+  EXPECT_NEAR(500.0 / 16 + (500.0 - 500.0 / 16) / 16, stats.jitterUs, 1.0);
+
+  // The smoothed jitter decays again with regular periods
+  for (int i = 0; i < 200; ++i) now = cycle(monitor, now, 10, 1000);
+  EXPECT_EQ(0u, monitor.statistics().jitterUs);
+  EXPECT_EQ(500u, monitor.statistics().jitterMaxUs);
+}
+
+TEST_F(TaskMonitorTest, CalculatesTheCpuShareOfTheWindow)
+{
+  TaskMonitor monitor(100000);
+  uint32_t now = 0;
+  EXPECT_EQ(0, monitor.statistics().cpuPermille);
+
+  // 25 % busy
+  for (int i = 0; i < 10; ++i) now = cycle(monitor, now, 2500, 10000);
+  cycle(monitor, now, 0, 10000);
+  EXPECT_EQ(250, monitor.statistics().cpuPermille);
+
+  // 5 % busy in the next window
+  for (int i = 0; i < 10; ++i) now = cycle(monitor, now, 500, 10000);
+  cycle(monitor, now, 0, 10000);
+  EXPECT_EQ(50, monitor.statistics().cpuPermille);
+}
+
+TEST_F(TaskMonitorTest, HandlesTheWrapAroundOfTheTimestamps)
+{
+  TaskMonitor monitor;
+  uint32_t now = UINT32_MAX - 1500;
+  now = cycle(monitor, now, 2000, 1000000);
+  cycle(monitor, now, 2000, 1000000);
+  const TaskStatistics stats = monitor.statistics();
+  EXPECT_EQ(2000u, stats.durationMaxUs);
+  EXPECT_EQ(1000000u, stats.periodLastUs);
+}
+
+} // namespace test
+} // namespace utils
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
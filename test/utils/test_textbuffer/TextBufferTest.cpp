@@ -0,0 +1,93 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <utils/TextBuffer.hpp>
+
+namespace utils
+{
+namespace test
+{
+
+class TextBufferTest :
+  public ::testing::Test
+{
+  protected:
+  TextBufferTest() {}
+  virtual ~TextBufferTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+};
+
+TEST_F(TextBufferTest, AppendsPlainAndFormattedText)
+{
+  TextBuffer<64> buf;
+  EXPECT_EQ(0u, buf.length());
+  EXPECT_STREQ("", buf.data());
+
+  buf.append("1234");
+  buf.appendf(" / %u|", 5678u);
+  buf.appendf("%.2f;%.2f;%u", 53.125f, -1.5f, 87u);
+  EXPECT_STREQ("1234 / 5678|53.12;-1.50;87", buf.data());
+  EXPECT_EQ(26u, buf.length());
+  EXPECT_FALSE(buf.overflow());
+  EXPECT_EQ(63u, buf.capacity());
+}
+
+TEST_F(TextBufferTest, DropsTheTextWhichDoesNotFit)
+{
+  TextBuffer<8> buf;
+  buf.append("12345");
+  buf.appendf("%s", "678");       // 8 characters + terminator do not fit
+  EXPECT_TRUE(buf.overflow());
+  EXPECT_STREQ("12345", buf.data());
+  EXPECT_EQ(5u, buf.length());
+
+  buf.append("6");                // Ignored after an overflow
+  EXPECT_STREQ("12345", buf.data());
+  EXPECT_EQ(1u, buf.overflows());
+
+  buf.reset();
+  buf.append("1234567");          // Exactly the capacity
+  EXPECT_FALSE(buf.overflow());
+  EXPECT_STREQ("1234567", buf.data());
+  buf.append("8");
+  EXPECT_TRUE(buf.overflow());
+  EXPECT_EQ(2u, buf.overflows());
+}
+
+TEST_F(TextBufferTest, ResetRewindsAndKeepsTheHighWaterMark)
+{
+  TextBuffer<32> buf;
+  buf.append("0123456789");
+  EXPECT_EQ(10u, buf.highWater());
+
+  buf.reset();
+  EXPECT_EQ(0u, buf.length());
+  EXPECT_STREQ("", buf.data());
+  buf.append("abc");
+  EXPECT_STREQ("abc", buf.data());
+  EXPECT_EQ(10u, buf.highWater());
+
+  buf.append(nullptr);
+  EXPECT_STREQ("abc", buf.data());
+  EXPECT_FALSE(buf.overflow());
+}
+
+} // namespace test
+} // namespace utils
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>
@@ -0,0 +1,300 @@
+// Copyright (c) 2024 Meik Jäckle
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <utils/TimeSeries.hpp>
+
+namespace utils
+{
+namespace test
+{
+
+/** Storage in RAM, which counts the accesses like a file on the flash */
+class MemoryStorage
+{
+  public:
+  bool read(uint32_t offset, void* data, std::size_t len)
+  {
+    reads++;
+    bytesRead += len;
+    if (offset + len > buffer.size()) return false;
+    std::memcpy(data, &buffer[offset], len);
+    return true;
+  }
+
+  bool write(uint32_t offset, const void* data, std::size_t len)
+  {
+    writes++;
+    if (offset > buffer.size()) return false; // Writes must not leave gaps
+    if (offset + len > buffer.size()) buffer.resize(offset + len);
+    std::memcpy(&buffer[offset], data, len);
+    return true;
+  }
+
+  std::vector<uint8_t> buffer;
+  uint32_t reads {0};
+  uint32_t writes {0};
+  std::size_t bytesRead {0};
+};
+
+class TimeSeriesTest :
+  public ::testing::Test
+{
+  protected:
+  static constexpr std::size_t CHANNELS {2};
+  static constexpr std::size_t BATCH {4};
+  static constexpr uint32_t CAPACITY {10};
+
+  using Record = TimeSeriesRecord<CHANNELS>;
+  using Store = TimeSeriesStore<Record, MemoryStorage, BATCH>;
+
+  TimeSeriesTest() {}
+  virtual ~TimeSeriesTest() {}
+
+  /**
+   * @brief Code here will be called immediately after the constructor (right before each test).
+   */
+  virtual void SetUp() {}
+
+  /**
+   * @brief Code here will be called immediately after each test (right before the destructor).
+   */
+  virtual void TearDown() {}
+
+  static Record makeRecord(uint32_t time)
+  {
+    Record record {};
+    record.time = time;
+    for (std::size_t i = 0; i < CHANNELS; ++i)
+    {
+      record.min[i] = static_cast<int16_t>(time - 1);
+      record.max[i] = static_cast<int16_t>(time + 1);
+      record.avg[i] = static_cast<int16_t>(time);
+    }
+    return record;
+  }
+
+  static std::vector<uint32_t> readTimes(Store& store, uint32_t from, uint32_t to, uint32_t maxRecords = 0)
+  {
+    std::vector<uint32_t> times;
+    store.readRange(from, to, [&](const Record& record)
+    {
+      EXPECT_EQ(static_cast<int16_t>(record.time), record.avg[1]);
+      times.push_back(record.time);
+    }, maxRecords);
+    return times;
+  }
+
+  static std::vector<uint32_t> range(uint32_t first, uint32_t last, uint32_t step = 1)
+  {
+    std::vector<uint32_t> times;
+    for (uint32_t time = first; time <= last; time += step) times.push_back(time);
+    return times;
+  }
+
+  MemoryStorage storage;
+};
+
+TEST_F(TimeSeriesTest, AggregatesMinMaxAvgPerPeriod)
+{
+  TimeSeriesAggregator<CHANNELS> aggregator(60);
+  Record record {};
+
+  EXPECT_FALSE(aggregator.add(120, {10, -5}, record));
+  EXPECT_FALSE(aggregator.add(130, {30, -15}, record));
+  EXPECT_FALSE(aggregator.add(179, {20, -10}, record));
+
+  // The first sample of the next period completes the previous one
+  ASSERT_TRUE(aggregator.add(180, {7, 7}, record));
+  EXPECT_EQ(120u, record.time);
+  EXPECT_EQ(10, record.min[0]);
+  EXPECT_EQ(30, record.max[0]);
+  EXPECT_EQ(20, record.avg[0]);
+  EXPECT_EQ(-15, record.min[1]);
+  EXPECT_EQ(-5, record.max[1]);
+  EXPECT_EQ(-10, record.avg[1]);
+
+  ASSERT_TRUE(aggregator.flush(record));
+  EXPECT_EQ(180u, record.time);
+  EXPECT_EQ(7, record.min[0]);
+  EXPECT_EQ(7, record.max[0]);
+  EXPECT_FALSE(aggregator.flush(record));
+}
+
+TEST_F(TimeSeriesTest, AggregatorHandlesGapsAndExtremeValues)
+{
+  TimeSeriesAggregator<CHANNELS> aggregator(60);
+  Record record {};
+
+  for (uint32_t time = 0; time < 60; ++time) aggregator.add(time, {INT16_MAX, INT16_MIN}, record);
+
+  // Several periods without samples: only one record with the start of the old period
+  ASSERT_TRUE(aggregator.add(600, {0, 0}, record));
+  EXPECT_EQ(0u, record.time);
+  EXPECT_EQ(INT16_MAX, record.avg[0]);
+  EXPECT_EQ(INT16_MIN, record.avg[1]);
+}
+
+TEST_F(TimeSeriesTest, WritesRecordsInBatches)
+{
+  Store store(storage, CAPACITY);
+  EXPECT_FALSE(store.begin());
+  const uint32_t writesAfterBegin = storage.writes;
+  EXPECT_EQ(Store::HEADER_SIZE, storage.buffer.size());
+
+  for (uint32_t time = 1; time < BATCH; ++time) store.append(makeRecord(time));
+  EXPECT_EQ(writesAfterBegin, storage.writes) << "No write before the batch is full";
+  EXPECT_EQ(BATCH - 1, store.pending());
+
+  store.append(makeRecord(BATCH));
+  EXPECT_EQ(writesAfterBegin + 2, storage.writes) << "One write for the records, one for the header";
+  EXPECT_EQ(0u, store.pending());
+  EXPECT_EQ(BATCH * sizeof(Record), store.bytesWritten());
+  EXPECT_EQ(range(1, BATCH), readTimes(store, 0, UINT32_MAX));
+}
+
+TEST_F(TimeSeriesTest, WrapsAroundAndKeepsTheNewestRecords)
+{
+  Store store(storage, CAPACITY);
+  store.begin();
+
+  for (uint32_t time = 1; time <= 25; ++time) store.append(makeRecord(time * 10));
+  store.flush();
+
+  EXPECT_EQ(CAPACITY, store.size());
+  EXPECT_EQ(Store::HEADER_SIZE + CAPACITY * sizeof(Record), storage.buffer.size()) << "The file must not grow";
+  EXPECT_EQ(range(160, 250, 10), readTimes(store, 0, UINT32_MAX));
+  EXPECT_EQ(range(200, 230, 10), readTimes(store, 195, 230));
+  EXPECT_EQ(range(160, 180, 10), readTimes(store, 0, UINT32_MAX, 3));
+  EXPECT_TRUE(readTimes(store, 251, UINT32_MAX).empty());
+  EXPECT_TRUE(readTimes(store, 300, 200).empty());
+}
+
+TEST_F(TimeSeriesTest, RangeQueryReadsOnlyTheRequestedRecords)
+{
+  constexpr uint32_t BIG_CAPACITY {1024};
+  TimeSeriesStore<Record, MemoryStorage, 64> store(storage, BIG_CAPACITY);
+  store.begin();
+  for (uint32_t time = 1; time <= BIG_CAPACITY; ++time) store.append(makeRecord(time));
+  store.flush();
+
+  storage.bytesRead = 0;
+  std::vector<uint32_t> times;
+  store.readRange(500, 503, [&](const Record& record) { times.push_back(record.time); });
+  EXPECT_EQ(range(500, 503), times);
+
+  // Binary search (10 times) and one chunk instead of the whole file
+  EXPECT_LT(storage.bytesRead, 12 * sizeof(Record));
+}
+
+TEST_F(TimeSeriesTest, IncludesPendingRecordsInTheRange)
+{
+  Store store(storage, CAPACITY);
+  store.begin();
+  for (uint32_t time = 1; time <= BATCH + 2; ++time) store.append(makeRecord(time));
+
+  EXPECT_EQ(2u, store.pending());
+  EXPECT_EQ(range(1, BATCH + 2), readTimes(store, 0, UINT32_MAX));
+  EXPECT_EQ(range(BATCH, BATCH + 1), readTimes(store, BATCH, BATCH + 1));
+}
+
+TEST_F(TimeSeriesTest, RestoresTheRecordsFromTheStorage)
+{
+  {
+    Store store(storage, CAPACITY);
+    store.begin();
+    for (uint32_t time = 1; time <= 13; ++time) store.append(makeRecord(time));
+    store.flush();
+  }
+
+  Store restored(storage, CAPACITY);
+  EXPECT_TRUE(restored.begin());
+  EXPECT_EQ(CAPACITY, restored.size());
+  EXPECT_EQ(range(4, 13), readTimes(restored, 0, UINT32_MAX));
+
+  // The last time is restored as well
+  restored.append(makeRecord(13));
+  EXPECT_EQ(1u, restored.dropped());
+  restored.append(makeRecord(14));
+  restored.flush();
+  EXPECT_EQ(range(5, 14), readTimes(restored, 0, UINT32_MAX));
+}
+
+TEST_F(TimeSeriesTest, StartsEmptyIfTheHeaderDoesNotMatch)
+{
+  {
+    Store store(storage, CAPACITY);
+    store.begin();
+    for (uint32_t time = 1; time <= BATCH; ++time) store.append(makeRecord(time));
+  }
+
+  // Other capacity
+  Store other(storage, CAPACITY + 1);
+  EXPECT_FALSE(other.begin());
+  EXPECT_EQ(0u, other.size());
+
+  // Other layout
+  Store otherLayout(storage, CAPACITY);
+  EXPECT_FALSE(otherLayout.begin(1));
+  EXPECT_EQ(0u, otherLayout.size());
+
+  // Corrupted header
+  storage.buffer[0] ^= 0xFF;
+  Store corrupted(storage, CAPACITY);
+  EXPECT_FALSE(corrupted.begin());
+  EXPECT_EQ(0u, corrupted.size());
+  EXPECT_TRUE(readTimes(corrupted, 0, UINT32_MAX).empty());
+}
+
+TEST_F(TimeSeriesTest, CanBeReconfigured)
+{
+  Store store(storage, CAPACITY);
+  store.begin(60);
+  for (uint32_t time = 1; time <= BATCH; ++time) store.append(makeRecord(time));
+
+  store.setCapacity(2);
+  EXPECT_FALSE(store.begin(900));
+  EXPECT_EQ(2u, store.capacity());
+
+  // The batch is written as soon as it holds as many records as the ring
+  store.append(makeRecord(10));
+  store.append(makeRecord(11));
+  EXPECT_EQ(0u, store.pending());
+
+  Store restored(storage, 2);
+  EXPECT_TRUE(restored.begin(900));
+  EXPECT_EQ(range(10, 11), readTimes(restored, 0, UINT32_MAX));
+
+  TimeSeriesAggregator<CHANNELS> aggregator(60);
+  Record record {};
+  const int16_t values[CHANNELS] {1, 2};
+  aggregator.add(100, values, record);
+  aggregator.setPeriod(10);
+  EXPECT_EQ(10u, aggregator.periodS());
+  EXPECT_FALSE(aggregator.flush(record)) << "The samples of the old period are discarded";
+}
+
+TEST_F(TimeSeriesTest, DropsRecordsWhichAreNotNewer)
+{
+  Store store(storage, CAPACITY);
+  store.begin();
+  store.append(makeRecord(100));
+  store.append(makeRecord(100));
+  store.append(makeRecord(50));
+  store.append(makeRecord(101));
+
+  EXPECT_EQ(2u, store.dropped());
+  EXPECT_EQ(std::vector<uint32_t>({100, 101}), readTimes(store, 0, UINT32_MAX));
+}
+
+} // namespace test
+} // namespace utils
+
+// Note: This is just a workaround, to prevent duplicate code for test application startup.
+//       If I have found a way to use multiple sources for unit tests within platformio, this include can be removed.
+#include <common/main-test.cpp>